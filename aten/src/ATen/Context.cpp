@@ -227,6 +227,14 @@ void Context::setBenchmarkLimitCuDNN(int b) {
   benchmark_limit_cudnn = b;
 }
 
+const std::string& Context::planCachePathCuDNN() const {
+  return plan_cache_path_cudnn;
+}
+
+void Context::setPlanCachePathCuDNN(const std::string& path) {
+  plan_cache_path_cudnn = path;
+}
+
 bool Context::allowTF32CuBLAS() const {
   return float32_matmul_precision != at::Float32MatmulPrecision::HIGHEST;
 }
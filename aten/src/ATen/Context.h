@@ -110,6 +110,21 @@ class TORCH_API Context {
     }
   }
 
+  // Eagerly performs all the lazy first-use initializations for `device`:
+  // the accelerator runtime init plus whatever the backend defers to first
+  // use (e.g. cuDNN and cuBLAS handle creation, per-stream workspace
+  // allocation, caching allocator priming on CUDA). Serving workloads can
+  // call this at startup so the cold-start cost is paid before the first
+  // request instead of inside it. No-op for CPU.
+  void warmupAll(Device device) {
+    auto device_type = device.type();
+    if (device_type == at::kCPU) {
+      return;
+    }
+    lazyInitDevice(device_type);
+    getAcceleratorHooksInterface(device_type).warmup(device.index());
+  }
+
   static bool hasOpenMP();
   static bool hasMKL();
   static bool hasLAPACK();
@@ -183,6 +198,8 @@ class TORCH_API Context {
   void setBenchmarkCuDNN(bool);
   int benchmarkLimitCuDNN() const;
   void setBenchmarkLimitCuDNN(int);
+  const std::string& planCachePathCuDNN() const;
+  void setPlanCachePathCuDNN(const std::string& path);
   bool deterministicCuDNN() const;
   void setDeterministicCuDNN(bool);
   bool deterministicMkldnn() const;
@@ -391,6 +408,7 @@ class TORCH_API Context {
       ? at::Float32MatmulPrecision::HIGH
       : at::Float32MatmulPrecision::HIGHEST;
   int benchmark_limit_cudnn = 10;
+  std::string plan_cache_path_cudnn;
   bool allow_tf32_cudnn = true;
   bool allow_fp16_reduction_cublas = true;
   bool allow_bf16_reduction_cublas = true;
@@ -5,8 +5,10 @@
 #include <ATen/Context.h>
 #include <ATen/detail/PrivateUse1HooksInterface.h>
 #include <c10/core/CPUAllocator.h>
+#include <c10/core/alignment.h>
 #include <c10/util/safe_numerics.h>
 
+#include <atomic>
 #include <limits>
 
 namespace at::detail {
@@ -255,6 +257,92 @@ TensorBase empty_strided_symint_generic(
   return _empty_strided_generic<SymIntArrayRef>(size, stride, allocator, ks, scalar_type);
 }
 
+namespace {
+
+// Shared ownership context for the storage slab handed out by
+// empty_batch_generic: every storage carved from the slab holds one
+// reference, and the slab is returned to the allocator when the last
+// storage dies.
+struct BatchSlabContext {
+  at::DataPtr slab;
+  std::atomic<size_t> refcount;
+};
+
+void batch_slab_release(void* ctx) {
+  auto* slab = static_cast<BatchSlabContext*>(ctx);
+  if (slab->refcount.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    delete slab;
+  }
+}
+
+} // namespace (anonymous)
+
+std::vector<TensorBase> empty_batch_generic(
+    ArrayRef<IntArrayRef> sizes,
+    c10::Allocator* allocator,
+    c10::DispatchKeySet ks,
+    ScalarType scalar_type) {
+  at::detail::raise_warning_for_complex_half(scalar_type);
+  caffe2::TypeMeta dtype = scalarTypeToTypeMeta(scalar_type);
+
+  // One pass to compute gAlignment-aligned offsets into the slab.
+  std::vector<size_t> offsets;
+  offsets.reserve(sizes.size());
+  size_t total_bytes = 0;
+  for (const auto& size : sizes) {
+    at::detail::check_size_nonnegative(size);
+    offsets.push_back(total_bytes);
+    auto size_bytes = computeStorageNbytesContiguous(size, dtype.itemsize());
+    total_bytes += (size_bytes + c10::gAlignment - 1) & ~(c10::gAlignment - 1);
+  }
+
+  // A single allocator call backs every storage in the batch.
+  auto* context = new BatchSlabContext{
+      allocator->allocate(total_bytes), {sizes.size()}};
+  auto* slab_base = static_cast<uint8_t*>(context->slab.get());
+  const auto device = context->slab.device();
+
+  std::vector<TensorBase> tensors;
+  tensors.reserve(sizes.size());
+  for (const auto i : c10::irange(sizes.size())) {
+    auto size_bytes =
+        computeStorageNbytesContiguous(sizes[i], dtype.itemsize());
+    at::DataPtr data_ptr(
+        slab_base + offsets[i], context, &batch_slab_release, device);
+    auto storage_impl = c10::make_intrusive<StorageImpl>(
+        c10::StorageImpl::use_byte_size_t(),
+        size_bytes,
+        std::move(data_ptr),
+        /*allocator=*/nullptr,
+        /*resizable=*/false);
+    auto tensor = detail::make_tensor_base<TensorImpl>(
+        std::move(storage_impl), ks, dtype);
+    if (ks.has(c10::DispatchKey::Meta) || sizes[i].size() != 1 ||
+        sizes[i][0] != 0) {
+      tensor.unsafeGetTensorImpl()->generic_set_sizes_contiguous(sizes[i]);
+    }
+    tensors.push_back(std::move(tensor));
+  }
+  return tensors;
+}
+
+std::vector<TensorBase> empty_batch_cpu(
+    ArrayRef<IntArrayRef> sizes,
+    const TensorOptions& options) {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+      device_or_default(options.device_opt()).type() == DeviceType::CPU);
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+      layout_or_default(options.layout_opt()) == Layout::Strided);
+  auto allocator = GetCPUAllocatorMaybePinned(
+      pinned_memory_or_default(options.pinned_memory_opt()));
+  constexpr c10::DispatchKeySet cpu_ks(c10::DispatchKey::CPU);
+  return empty_batch_generic(
+      sizes,
+      allocator,
+      cpu_ks,
+      dtype_or_default(optTypeMetaToScalarType(options.dtype_opt())));
+}
+
 TensorBase empty_cpu(IntArrayRef size, ScalarType dtype, bool pin_memory,
                      std::optional<c10::MemoryFormat> memory_format_opt) {
   auto allocator = GetCPUAllocatorMaybePinned(pin_memory);
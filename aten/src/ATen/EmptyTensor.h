@@ -72,6 +72,22 @@ TORCH_API TensorBase empty_strided_symint_generic(
     c10::DispatchKeySet ks,
     ScalarType scalar_type);
 
+// Creates one contiguous tensor per entry of `sizes`, backing all of
+// them with a single allocator call: storages are carved out of one
+// contiguous slab and share a refcounted deleter that frees the slab
+// when the last tensor dies. This amortizes allocation cost for
+// workloads that create many small transient tensors at once. The
+// resulting storages are not resizable.
+TORCH_API std::vector<TensorBase> empty_batch_generic(
+    ArrayRef<IntArrayRef> sizes,
+    c10::Allocator* allocator,
+    c10::DispatchKeySet ks,
+    ScalarType scalar_type);
+
+TORCH_API std::vector<TensorBase> empty_batch_cpu(
+    ArrayRef<IntArrayRef> sizes,
+    const TensorOptions& options);
+
 TORCH_API TensorBase empty_cpu(
     IntArrayRef size,
     ScalarType dtype,
@@ -26,8 +26,78 @@ TORCH_API int get_thread_num();
 // Checks whether the code runs in parallel region
 TORCH_API bool in_parallel_region();
 
+// NUMA-partitioned intra-op parallelism (native parallel backend only).
+// When enabled, the intra-op pool is complemented by per-NUMA-node worker
+// subsets bound to their node, and parallel_for calls under a
+// NumaPlacementGuard run their chunks on the workers of the node that
+// owns the guarded storage, avoiding remote-node memory traffic on
+// multi-socket machines. Other parallel backends ignore the setting.
+TORCH_API void set_numa_partitioned(bool enable);
+TORCH_API bool numa_partitioned();
+
+// Dynamic (work-stealing style) scheduling for the native parallel
+// backend. By default parallel_for splits [begin, end) into one static
+// chunk per thread, so a skewed workload (ragged EmbeddingBag rows,
+// nonzero) leaves cores idle behind the slowest chunk. When enabled,
+// ranges are split into grain_size-sized units that idle workers claim
+// dynamically, so the tail of a skewed loop is shared by all workers.
+// Other parallel backends ignore the setting.
+TORCH_API void set_work_stealing_parallel(bool enable);
+TORCH_API bool work_stealing_parallel();
+
+// Unified intra-op/inter-op thread pool (native parallel backend only).
+// By default at::launch tasks run on a separate inter-op pool, so under
+// load the two pools oversubscribe the machine and context-switch. When
+// enabled, inter-op tasks are submitted to the intra-op pool instead and
+// their parallel_for chunks go into the pool's high-priority lane, so a
+// running task's chunks are never stuck behind queued sibling tasks. The
+// shared pool is sized by at::set_num_threads; the inter-op pool is not
+// created. Other parallel backends ignore the setting.
+TORCH_API void set_unified_thread_pool(bool enable);
+TORCH_API bool unified_thread_pool();
+
+// Affinity policy for ATen thread pool workers (Linux only; a no-op on
+// other platforms). Candidate CPUs come from the process' allowed cpuset
+// (sched_getaffinity), so cgroup cpusets and taskset masks in containers
+// are respected. The policy is consulted when a worker starts, so set it
+// before the first parallel call; already-running workers are not
+// re-pinned.
+enum class ThreadAffinityPolicy {
+  // Leave workers unpinned (default).
+  None,
+  // Pin one worker per physical core, skipping SMT siblings, so chunks
+  // never compete for a core's execution units or migrate between
+  // siblings. Pair with set_num_threads(physical core count) for
+  // latency-sensitive inference.
+  Latency,
+  // Pin workers round-robin over every allowed CPU, including SMT
+  // siblings, for pools sized to the full hardware thread count.
+  Throughput,
+};
+TORCH_API void set_thread_affinity_policy(ThreadAffinityPolicy policy);
+TORCH_API ThreadAffinityPolicy thread_affinity_policy();
+
+// Scoped hint associating parallel_for calls in the current thread with
+// the NUMA node owning `ptr` (typically a tensor's data pointer), or with
+// an explicit node id.
+class TORCH_API NumaPlacementGuard {
+ public:
+  explicit NumaPlacementGuard(const void* ptr);
+  explicit NumaPlacementGuard(int node);
+  NumaPlacementGuard(const NumaPlacementGuard&) = delete;
+  NumaPlacementGuard& operator=(const NumaPlacementGuard&) = delete;
+  ~NumaPlacementGuard();
+
+ private:
+  int prev_node_;
+};
+
 namespace internal {
 
+// Returns the NUMA node set by the innermost NumaPlacementGuard in the
+// current thread, or -1 if there is none.
+TORCH_API int current_numa_placement_node();
+
 // Initialise num_threads lazily at first parallel call
 inline void lazy_init_num_threads() {
   thread_local bool init = false;
@@ -39,6 +109,11 @@ inline void lazy_init_num_threads() {
 
 TORCH_API void set_thread_num(int);
 
+// Pins the calling thread according to the current affinity policy.
+// Called from pool worker initialization; each call claims the next CPU
+// of the policy's candidate list round-robin.
+TORCH_API void apply_thread_affinity();
+
 class TORCH_API ThreadIdGuard {
  public:
   ThreadIdGuard(int new_id) : old_id_(at::get_thread_num()) {
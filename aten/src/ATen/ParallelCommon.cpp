@@ -3,8 +3,11 @@
 #include <ATen/Config.h>
 #include <ATen/PTThreadPool.h>
 #include <ATen/Version.h>
+#include <c10/util/cpu_affinity.h>
 #include <c10/util/env.h>
+#include <c10/util/numa.h>
 
+#include <atomic>
 #include <sstream>
 #include <thread>
 
@@ -128,4 +131,91 @@ int intraop_default_num_threads() {
 #endif /* !defined(C10_MOBILE) */
 }
 
+namespace {
+
+std::atomic<bool> numa_partitioned_{false};
+
+std::atomic<bool> work_stealing_parallel_{false};
+
+std::atomic<bool> unified_thread_pool_{false};
+
+std::atomic<ThreadAffinityPolicy> thread_affinity_policy_{
+    ThreadAffinityPolicy::None};
+
+// NUMA node hint installed by NumaPlacementGuard; -1 means no hint.
+thread_local int numa_placement_node_ = -1;
+
+} // namespace (anonymous)
+
+void set_numa_partitioned(bool enable) {
+  numa_partitioned_.store(enable, std::memory_order_relaxed);
+}
+
+bool numa_partitioned() {
+  return numa_partitioned_.load(std::memory_order_relaxed);
+}
+
+void set_work_stealing_parallel(bool enable) {
+  work_stealing_parallel_.store(enable, std::memory_order_relaxed);
+}
+
+bool work_stealing_parallel() {
+  return work_stealing_parallel_.load(std::memory_order_relaxed);
+}
+
+void set_unified_thread_pool(bool enable) {
+  unified_thread_pool_.store(enable, std::memory_order_relaxed);
+}
+
+bool unified_thread_pool() {
+  return unified_thread_pool_.load(std::memory_order_relaxed);
+}
+
+void set_thread_affinity_policy(ThreadAffinityPolicy policy) {
+  thread_affinity_policy_.store(policy, std::memory_order_relaxed);
+}
+
+ThreadAffinityPolicy thread_affinity_policy() {
+  return thread_affinity_policy_.load(std::memory_order_relaxed);
+}
+
+NumaPlacementGuard::NumaPlacementGuard(const void* ptr)
+    : prev_node_(numa_placement_node_) {
+  numa_placement_node_ = c10::IsNUMAEnabled() ? c10::GetNUMANode(ptr) : -1;
+}
+
+NumaPlacementGuard::NumaPlacementGuard(int node)
+    : prev_node_(numa_placement_node_) {
+  numa_placement_node_ = node;
+}
+
+NumaPlacementGuard::~NumaPlacementGuard() {
+  numa_placement_node_ = prev_node_;
+}
+
+namespace internal {
+
+int current_numa_placement_node() {
+  return numa_placement_node_;
+}
+
+void apply_thread_affinity() {
+  const auto policy = at::thread_affinity_policy();
+  if (policy == ThreadAffinityPolicy::None) {
+    return;
+  }
+  const std::vector<int> cpus = policy == ThreadAffinityPolicy::Latency
+      ? c10::GetPhysicalCoreCPUs()
+      : c10::GetAllowedCPUs();
+  if (cpus.empty()) {
+    // Affinity is unsupported on this platform; leave the worker unpinned.
+    return;
+  }
+  static std::atomic<size_t> next_slot{0};
+  const size_t slot = next_slot.fetch_add(1, std::memory_order_relaxed);
+  c10::BindThreadToCPU(cpus[slot % cpus.size()]);
+}
+
+} // namespace internal
+
 } // namespace at
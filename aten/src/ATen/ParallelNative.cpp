@@ -7,11 +7,15 @@
 #ifndef C10_MOBILE
 #include <c10/core/thread_pool.h>
 #include <c10/util/irange.h>
+#include <c10/util/numa.h>
+#include <memory>
+#include <vector>
 #else
 #include <caffe2/utils/threadpool/pthreadpool-cpp.h>
 #endif // C10_MOBILE
 
 #include <atomic>
+#include <chrono>
 #include <utility>
 
 #ifdef _OPENMP
@@ -83,14 +87,57 @@ TaskThreadPoolBase& _get_intraop_pool() {
   return *pool;
 }
 
+// Per-NUMA-node worker subsets used in NUMA-partitioned mode (see
+// at::set_numa_partitioned). Each sub-pool's workers NUMABind themselves
+// to their node at startup; the intra-op thread budget is divided evenly
+// across nodes. Sub-pools are created lazily on the first partitioned
+// parallel_for, so processes that never enable the mode pay nothing.
+TaskThreadPool& _get_numa_pool(int numa_node_id) {
+  static auto* pools = []() {
+    auto* v = new std::vector<std::unique_ptr<TaskThreadPool>>();
+    const int num_nodes = std::max(1, c10::GetNumNUMANodes());
+    const int per_node = std::max(1, at::get_num_threads() / num_nodes);
+    v->reserve(num_nodes);
+    for (const auto node : c10::irange(num_nodes)) {
+      v->push_back(
+          std::make_unique<TaskThreadPool>(per_node, static_cast<int>(node)));
+    }
+    return v;
+  }();
+  return *(*pools)[numa_node_id];
+}
+
 #endif // C10_MOBILE
 
 // Run lambda function `fn` over `task_id` in [0, `range`) with threadpool.
 // `fn` will be called with params: (thread_pool_task_id, task_id).
 void _run_with_pool(const std::function<void(int, size_t)>& fn, size_t range) {
 #ifndef C10_MOBILE
-  for (const auto i : c10::irange(1, range)) {
-    _get_intraop_pool().run([fn, i]() { fn((int)i, i); });
+  // In NUMA-partitioned mode, chunks belonging to a storage with a known
+  // node (set via NumaPlacementGuard) run on that node's bound workers.
+  if (C10_UNLIKELY(at::numa_partitioned() && c10::IsNUMAEnabled())) {
+    const int node = internal::current_numa_placement_node();
+    if (node >= 0 && node < c10::GetNumNUMANodes()) {
+      auto& pool = _get_numa_pool(node);
+      for (const auto i : c10::irange(1, range)) {
+        pool.run([fn, i]() { fn((int)i, i); });
+      }
+      fn(0, 0);
+      return;
+    }
+  }
+  // In unified-pool mode the pool also holds queued inter-op tasks;
+  // submitting chunks to the prioritized lane inherits the running
+  // parent's place in line instead of queueing behind its siblings.
+  auto& pool = _get_intraop_pool();
+  if (C10_UNLIKELY(at::unified_thread_pool())) {
+    for (const auto i : c10::irange(1, range)) {
+      pool.run_prioritized([fn, i]() { fn((int)i, i); });
+    }
+  } else {
+    for (const auto i : c10::irange(1, range)) {
+      pool.run([fn, i]() { fn((int)i, i); });
+    }
   }
   // Run the first task on the current thread directly.
   fn(0, 0);
@@ -120,6 +167,34 @@ struct ParallelRegionGuard {
   }
 };
 
+// Wait until the `remaining` tasks of the current parallel region are
+// done. In unified-pool mode the waiter may itself occupy a pool thread,
+// so instead of sleeping it helps drain the prioritized lane its chunks
+// were queued in; otherwise every worker could end up blocked here with
+// no thread left to run anyone's chunks.
+void _wait_for_remaining(
+    std::mutex& mutex,
+    std::condition_variable& cv,
+    std::atomic_size_t& remaining) {
+  std::unique_lock<std::mutex> lk(mutex);
+#ifndef C10_MOBILE
+  if (C10_UNLIKELY(at::unified_thread_pool())) {
+    while (remaining.load() != 0) {
+      lk.unlock();
+      const bool helped = _get_intraop_pool().tryRunPrioritizedTask();
+      lk.lock();
+      if (!helped && remaining.load() != 0) {
+        cv.wait_for(lk, std::chrono::milliseconds(1));
+      }
+    }
+    return;
+  }
+#endif
+  if (remaining != 0) {
+    cv.wait(lk);
+  }
+}
+
 } // namespace
 
 namespace internal {
@@ -137,6 +212,67 @@ inline std::tuple<size_t, size_t> calc_num_tasks_and_chunk_size(
   return std::make_tuple(num_tasks, chunk_size);
 }
 
+// Dynamic-scheduling variant of invoke_parallel (see
+// at::set_work_stealing_parallel). The range is split into
+// grain_size-sized units claimed from a shared counter: each worker
+// keeps pulling the next unclaimed unit until the range is exhausted, so
+// a slow unit only ever delays the worker that claimed it. This gives
+// work-stealing's load-balancing behavior for loop parallelism without
+// per-thread deques, since loop iterations never spawn nested tasks to
+// steal.
+static void invoke_parallel_dynamic(
+    const int64_t begin,
+    const int64_t end,
+    const int64_t grain_size,
+    const std::function<void(int64_t, int64_t)>& f) {
+  const int64_t unit = std::max(grain_size, (int64_t)1);
+  const size_t num_workers = std::max(
+      (size_t)1,
+      std::min(
+          (size_t)at::get_num_threads(), (size_t)divup((end - begin), unit)));
+
+  struct {
+    std::atomic_flag err_flag = ATOMIC_FLAG_INIT;
+    std::exception_ptr eptr;
+    std::mutex mutex;
+    std::atomic_int64_t next{0};
+    std::atomic_size_t remaining{0};
+    std::condition_variable cv;
+  } state;
+
+  auto task = [f, &state, begin, end, unit](int /* unused */, size_t task_id) {
+    try {
+      ParallelRegionGuard guard(task_id);
+      while (true) {
+        const int64_t local_start =
+            begin + state.next.fetch_add(unit, std::memory_order_relaxed);
+        if (local_start >= end) {
+          break;
+        }
+        f(local_start, std::min(end, local_start + unit));
+      }
+    } catch (...) {
+      if (!state.err_flag.test_and_set()) {
+        state.eptr = std::current_exception();
+      }
+    }
+    {
+      std::unique_lock<std::mutex> lk(state.mutex);
+      if (--state.remaining == 0) {
+        state.cv.notify_one();
+      }
+    }
+  };
+  state.remaining = num_workers;
+  _run_with_pool(std::move(task), num_workers);
+
+  // Wait for all workers to finish.
+  _wait_for_remaining(state.mutex, state.cv, state.remaining);
+  if (state.eptr) {
+    std::rethrow_exception(state.eptr);
+  }
+}
+
 void invoke_parallel(
   const int64_t begin,
   const int64_t end,
@@ -144,6 +280,11 @@ void invoke_parallel(
   const std::function<void(int64_t, int64_t)>& f) {
   at::internal::lazy_init_num_threads();
 
+  if (C10_UNLIKELY(at::work_stealing_parallel())) {
+    invoke_parallel_dynamic(begin, end, grain_size, f);
+    return;
+  }
+
   size_t num_tasks = 0, chunk_size = 0;
   std::tie(num_tasks, chunk_size) =
       internal::calc_num_tasks_and_chunk_size(begin, end, grain_size);
@@ -181,12 +322,7 @@ void invoke_parallel(
   _run_with_pool(std::move(task), num_tasks);
 
   // Wait for all tasks to finish.
-  {
-    std::unique_lock<std::mutex> lk(state.mutex);
-    if (state.remaining != 0) {
-      state.cv.wait(lk);
-    }
-  }
+  _wait_for_remaining(state.mutex, state.cv, state.remaining);
   if (state.eptr) {
     std::rethrow_exception(state.eptr);
   }
@@ -263,6 +399,13 @@ int get_thread_num() {
 
 bool in_parallel_region() {
 #ifndef C10_MOBILE
+  if (C10_UNLIKELY(unified_thread_pool())) {
+    // In unified mode pool threads run whole inter-op tasks, not just
+    // intra-op chunks, so pool residency alone does not make a parallel
+    // region; only the chunk guard does. This is what lets an inter-op
+    // task fan out its own parallel_for instead of running it serially.
+    return in_parallel_region_;
+  }
   return in_parallel_region_ || (
     num_intraop_threads.load() == CONSUMED &&
     // Needed as intraop_launch() doesn't set in_parallel_region().
@@ -58,6 +58,12 @@ void set_num_interop_threads(int nthreads) {
 
 int get_num_interop_threads() {
   at::internal::lazy_init_num_threads();
+#if AT_PARALLEL_NATIVE && !defined(C10_MOBILE)
+  if (C10_UNLIKELY(unified_thread_pool())) {
+    // There is only the shared pool, sized by at::set_num_threads.
+    return get_num_threads();
+  }
+#endif
   int nthreads = num_interop_threads.load();
   if (nthreads > 0) {
     return nthreads;
@@ -74,6 +80,15 @@ void launch_no_thread_state(std::function<void()> fn) {
 #if AT_EXPERIMENTAL_SINGLE_THREAD_POOL
   intraop_launch(std::move(fn));
 #else
+#if AT_PARALLEL_NATIVE && !defined(C10_MOBILE)
+  if (C10_UNLIKELY(at::unified_thread_pool())) {
+    // Inter-op tasks share the intra-op pool in unified mode; they queue
+    // in the regular lane while their parallel_for chunks use the
+    // prioritized lane (see _run_with_pool in ParallelNative.cpp).
+    intraop_launch(std::move(fn));
+    return;
+  }
+#endif
   get_pool().run(std::move(fn));
 #endif
 }
@@ -54,6 +54,7 @@ void SparseTensorImpl::release_resources() {
   TensorImpl::release_resources();
   values_.reset();
   indices_.reset();
+  cached_coalesced_.reset();
 }
 
 void SparseTensorImpl::set_size(int64_t dim, int64_t new_size) {
@@ -109,6 +110,7 @@ void SparseTensorImpl::set_indices_and_values_unsafe(const Tensor& indices, cons
   AT_ASSERT(values_.device() == indices_.device());
 
   coalesced_ = TORCH_GUARD_SIZE_OBLIVIOUS(sym_nnz().sym_lt(2));
+  clear_coalesce_cache();
 }
 
 
@@ -6,6 +6,8 @@
 #include <c10/util/Exception.h>
 #include <c10/util/irange.h>
 
+#include <mutex>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #else
@@ -39,6 +41,19 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
   // because many algorithms proceed by merging two sorted lists (of indices).
   bool coalesced_ = false;
 
+  // Cached result of coalesce(), keyed on the version counters of this
+  // tensor and of the cached result, so that structure-static sparse tensors
+  // (e.g. a fixed graph multiplied every training step) pay the coalesce
+  // cost exactly once. See NOTE [ coalesce cache ] in
+  // native/sparse/SparseTensor.cpp. Deliberately not copied by
+  // copy_tensor_metadata, and cleared whenever indices_/values_ are replaced
+  // through paths that do not bump the version counter. Holding the cache
+  // keeps one coalesced copy of the tensor alive alongside the original.
+  std::mutex coalesce_cache_mutex_;
+  Tensor cached_coalesced_;
+  uint32_t cached_coalesced_self_version_ = 0;
+  uint32_t cached_coalesced_result_version_ = 0;
+
   // compute_numel with integer multiplication overflow check, see gh-57542
   void refresh_numel() {
     TensorImpl::safe_refresh_numel();
@@ -66,6 +81,38 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
   bool coalesced() const {
     return coalesced_;
   }
+
+  // Returns the cached coalesce() result if it was computed for
+  // `self_version` and has not itself been modified since; otherwise an
+  // undefined tensor.
+  Tensor cached_coalesced(uint32_t self_version) {
+    std::lock_guard<std::mutex> lock(coalesce_cache_mutex_);
+    if (cached_coalesced_.defined() &&
+        cached_coalesced_self_version_ == self_version &&
+        cached_coalesced_.unsafeGetTensorImpl()->version_counter().enabled() &&
+        cached_coalesced_.unsafeGetTensorImpl()
+                ->version_counter()
+                .current_version() == cached_coalesced_result_version_) {
+      return cached_coalesced_;
+    }
+    return Tensor();
+  }
+
+  void set_cached_coalesced(const Tensor& coalesced, uint32_t self_version) {
+    if (!coalesced.unsafeGetTensorImpl()->version_counter().enabled()) {
+      return;
+    }
+    std::lock_guard<std::mutex> lock(coalesce_cache_mutex_);
+    cached_coalesced_ = coalesced;
+    cached_coalesced_self_version_ = self_version;
+    cached_coalesced_result_version_ =
+        coalesced.unsafeGetTensorImpl()->version_counter().current_version();
+  }
+
+  void clear_coalesce_cache() {
+    std::lock_guard<std::mutex> lock(coalesce_cache_mutex_);
+    cached_coalesced_.reset();
+  }
   Tensor indices() const {
     return indices_;
   }
@@ -95,6 +142,7 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     sparse_dim_ = sparse_dim;
     dense_dim_ = dense_dim;
     refresh_numel();
+    clear_coalesce_cache();
   }
 
   // NOTE: This function preserves invariants of sparse_dim/dense_dim with
@@ -226,6 +274,7 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     sparse_dim_ = sparse_dim;
     dense_dim_ = dense_dim;
     refresh_numel();
+    clear_coalesce_cache();
   }
 
   void resize_(int64_t sparse_dim, int64_t dense_dim, ArrayRef<int64_t> size) {
@@ -295,6 +344,7 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     if (new_nnz < 2) {
       coalesced_ = true;
     }
+    clear_coalesce_cache();
   }
 
   // Takes indices and values and directly puts them into the sparse tensor, no
@@ -413,6 +463,7 @@ struct TORCH_API SparseTensorImpl : public TensorImpl {
     dest_sparse_impl->indices_ = src_sparse_impl->indices();
     dest_sparse_impl->values_ = src_sparse_impl->values();
     dest_sparse_impl->coalesced_ = src_sparse_impl->coalesced();
+    dest_sparse_impl->clear_coalesce_cache();
   }
 
   const char* tensorimpl_type_name() const override;
@@ -0,0 +1,164 @@
+#include <ATen/TaskGroup.h>
+
+#include <ATen/Parallel.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace at {
+
+struct TaskGroup::Task {
+  explicit Task(std::function<void()> fn) : fn(std::move(fn)) {}
+
+  std::function<void()> fn;
+  // Tasks to release when this one finishes; guarded by State::mutex.
+  std::vector<std::shared_ptr<Task>> successors;
+  // Number of unfinished predecessors; guarded by State::mutex.
+  size_t pending{0};
+  bool done{false};
+};
+
+struct TaskGroup::State {
+  std::mutex mutex;
+  std::condition_variable cv;
+  size_t outstanding{0};
+  std::exception_ptr error;
+
+  // Who last wrote and who has read since, per storage (or per impl for
+  // storage-less tensors); this is what turns the declared read/write
+  // sets into graph edges.
+  struct AccessInfo {
+    std::shared_ptr<Task> writer;
+    std::vector<std::shared_ptr<Task>> readers;
+  };
+  std::unordered_map<const void*, AccessInfo> accesses;
+};
+
+namespace {
+
+const void* accessKey(const Tensor& tensor) {
+  if (tensor.unsafeGetTensorImpl()->has_storage()) {
+    return tensor.storage().unsafeGetStorageImpl();
+  }
+  return tensor.unsafeGetTensorImpl();
+}
+
+} // namespace
+
+// Called on the inter-op pool.
+void TaskGroup::runTask(
+    const std::shared_ptr<TaskGroup::State>& state,
+    const std::shared_ptr<TaskGroup::Task>& task) {
+  try {
+    task->fn();
+  } catch (...) {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    if (!state->error) {
+      state->error = std::current_exception();
+    }
+  }
+  std::vector<std::shared_ptr<TaskGroup::Task>> ready;
+  {
+    std::lock_guard<std::mutex> lock(state->mutex);
+    task->done = true;
+    task->fn = nullptr;
+    for (auto& successor : task->successors) {
+      if (--successor->pending == 0) {
+        ready.push_back(successor);
+      }
+    }
+    task->successors.clear();
+    --state->outstanding;
+  }
+  state->cv.notify_all();
+  for (auto& successor : ready) {
+    launchTask(state, successor);
+  }
+}
+
+void TaskGroup::launchTask(
+    const std::shared_ptr<TaskGroup::State>& state,
+    const std::shared_ptr<TaskGroup::Task>& task) {
+  launch([state, task] { runTask(state, task); });
+}
+
+TaskGroup::TaskGroup() : state_(std::make_shared<State>()) {}
+
+TaskGroup::~TaskGroup() {
+  try {
+    wait();
+  } catch (const std::exception& e) {
+    TORCH_WARN("TaskGroup destroyed with a failed task: ", e.what());
+  } catch (...) {
+    TORCH_WARN("TaskGroup destroyed with a failed task");
+  }
+}
+
+void TaskGroup::run(std::function<void()> fn, TensorList reads, TensorList writes) {
+  auto task = std::make_shared<Task>(std::move(fn));
+  bool readyNow = false;
+  {
+    std::lock_guard<std::mutex> lock(state_->mutex);
+
+    auto addDependency = [&](const std::shared_ptr<Task>& dep) {
+      if (dep == nullptr || dep->done || dep == task) {
+        return;
+      }
+      // A duplicate edge just bumps pending twice and gets released
+      // twice; avoid it so pending hits zero exactly once.
+      for (const auto& successor : dep->successors) {
+        if (successor == task) {
+          return;
+        }
+      }
+      dep->successors.push_back(task);
+      ++task->pending;
+    };
+
+    for (const auto& tensor : reads) {
+      if (!tensor.defined()) {
+        continue;
+      }
+      auto& access = state_->accesses[accessKey(tensor)];
+      addDependency(access.writer);
+      access.readers.push_back(task);
+    }
+    for (const auto& tensor : writes) {
+      if (!tensor.defined()) {
+        continue;
+      }
+      auto& access = state_->accesses[accessKey(tensor)];
+      addDependency(access.writer);
+      for (const auto& reader : access.readers) {
+        addDependency(reader);
+      }
+      access.writer = task;
+      access.readers.clear();
+    }
+
+    ++state_->outstanding;
+    readyNow = task->pending == 0;
+  }
+  if (readyNow) {
+    launchTask(state_, task);
+  }
+}
+
+void TaskGroup::wait() {
+  std::unique_lock<std::mutex> lock(state_->mutex);
+  state_->cv.wait(lock, [&] { return state_->outstanding == 0; });
+  // The graph is drained; start the next round of recording fresh.
+  state_->accesses.clear();
+  if (state_->error) {
+    auto error = std::exchange(state_->error, nullptr);
+    lock.unlock();
+    std::rethrow_exception(error);
+  }
+}
+
+} // namespace at
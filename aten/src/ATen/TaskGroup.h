@@ -0,0 +1,67 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <c10/macros/Export.h>
+
+#include <functional>
+#include <memory>
+
+namespace at {
+
+// TaskGroup is an eager-mode task graph over the inter-op thread pool.
+// It records op closures and runs them via at::launch, inferring the
+// ordering between tasks from the tensors they declare as reads and
+// writes: a task waits for the previous writer of anything it touches
+// and for previous readers of anything it writes, while independent
+// tasks (e.g. the towers of a multi-tower model) run concurrently.
+//
+//   at::TaskGroup group;
+//   group.run([&] { out_a = tower_a.forward(input); }, /*reads=*/{input});
+//   group.run([&] { out_b = tower_b.forward(input); }, /*reads=*/{input});
+//   group.wait();
+//
+// Aliasing is resolved at storage granularity, so a task writing a view
+// is correctly ordered against tasks touching the base tensor. Tasks
+// that fail do not cancel their dependents; wait() rethrows the first
+// recorded error once every task has finished. A TaskGroup is not
+// thread-safe: record and wait from one thread, and keep the tensors
+// captured by the closures alive until wait() returns.
+class TORCH_API TaskGroup {
+ public:
+  TaskGroup();
+  ~TaskGroup();
+  TaskGroup(const TaskGroup&) = delete;
+  TaskGroup(TaskGroup&&) = delete;
+  TaskGroup& operator=(const TaskGroup&) = delete;
+  TaskGroup& operator=(TaskGroup&&) = delete;
+
+  // Records `fn` and schedules it as soon as the tasks it depends on
+  // (per the declared read and write sets) have finished; a task with
+  // no unfinished dependencies is launched immediately.
+  void run(
+      std::function<void()> fn,
+      TensorList reads = {},
+      TensorList writes = {});
+
+  // Blocks until every recorded task has finished, then rethrows the
+  // first error raised by a task, if any. The destructor also waits,
+  // but warns instead of throwing.
+  void wait();
+
+ private:
+  struct Task;
+  struct State;
+
+  // Submits the task to the inter-op pool.
+  static void launchTask(
+      const std::shared_ptr<State>& state,
+      const std::shared_ptr<Task>& task);
+  // Runs the task's closure and releases its successors.
+  static void runTask(
+      const std::shared_ptr<State>& state,
+      const std::shared_ptr<Task>& task);
+
+  std::shared_ptr<State> state_;
+};
+
+} // namespace at
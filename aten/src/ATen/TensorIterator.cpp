@@ -23,10 +23,14 @@
 
 #include <c10/util/irange.h>
 #include <c10/util/SmallBuffer.h>
+#include <c10/util/hash.h>
 
 #include <array>
 #include <algorithm>
+#include <atomic>
 #include <cmath>
+#include <mutex>
+#include <unordered_map>
 
 namespace at {
 
@@ -64,6 +68,52 @@ static OptionalTensorRef make_otr(const TensorBase &tensor) {
   }
 }
 
+// See set_tensor_iterator_plan_cache_enabled() in TensorIterator.h.
+std::atomic<bool> plan_cache_enabled_{false};
+
+struct CachedOperandPlan {
+  StrideVector stride_bytes;
+  ScalarType target_dtype = ScalarType::Undefined;
+  ScalarType current_dtype = ScalarType::Undefined;
+  Device device = kCPU;
+  // The tensor's logical geometry (as opposed to the coalesced stride_bytes
+  // above), used to materialize outputs that the caller left undefined.
+  DimVector tensor_sizes;
+  DimVector tensor_strides;
+};
+
+struct CachedIteratorPlan {
+  DimVector shape;
+  SmallVector<CachedOperandPlan, 4> operands;
+  Device common_device = kCPU;
+  ScalarType common_dtype = ScalarType::Undefined;
+  bool has_coalesced_dimensions = false;
+  bool all_ops_same_shape = false;
+  bool all_ops_are_scalars = false;
+};
+
+struct PlanSignatureHash {
+  size_t operator()(const std::vector<int64_t>& signature) const {
+    size_t seed = signature.size();
+    for (auto value : signature) {
+      seed = c10::hash_combine(seed, static_cast<size_t>(value));
+    }
+    return seed;
+  }
+};
+
+std::mutex& plan_cache_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::unordered_map<std::vector<int64_t>, CachedIteratorPlan, PlanSignatureHash>&
+plan_cache() {
+  static auto* cache = new std::
+      unordered_map<std::vector<int64_t>, CachedIteratorPlan, PlanSignatureHash>();
+  return *cache;
+}
+
 }
 
 namespace internal {
@@ -434,7 +484,7 @@ void TensorIteratorBase::compute_types(const TensorIteratorConfig& config) {
         continue;
       }
 
-      TORCH_CHECK(op.target_dtype == common_dtype_,
+      TORCH_CHECK_COLD(op.target_dtype == common_dtype_,
                   "Found dtype ", op.target_dtype, " but expected ", common_dtype_);
     }
   }
@@ -497,7 +547,7 @@ void TensorIteratorBase::compute_types(const TensorIteratorConfig& config) {
                     "Trying to pass too many CPU scalars to non-CPU kernel!");
         ++current_cpu_scalars_on_non_cpu;
       } else if (op.device.value() != common_device) {
-        TORCH_CHECK(false,
+        TORCH_CHECK_COLD(false,
                     "Expected all tensors to be on the same device, but "
                     "found at least two devices, ", common_device, " and ", op.device.value(), "!");
       }
@@ -505,7 +555,7 @@ void TensorIteratorBase::compute_types(const TensorIteratorConfig& config) {
 
     // Checks safe casting, if requested
     if (config.enforce_safe_casting_to_output_ && op.is_output && op.current_dtype != common_dtype_) {
-      TORCH_CHECK(canCast(common_dtype_, op.current_dtype),
+      TORCH_CHECK_COLD(canCast(common_dtype_, op.current_dtype),
                   "result type ", common_dtype_, " can't be cast to the "
                   "desired output type ", op.current_dtype);
     }
@@ -1132,14 +1182,14 @@ TensorIterator TensorIterator::reduce_op(TensorBase& out, const TensorBase& a) {
 TensorIterator TensorIterator::reduce_op(TensorBase& out1, TensorBase& out2, const TensorBase& a) {
   TORCH_INTERNAL_ASSERT(out1.defined());
   TORCH_INTERNAL_ASSERT(out2.defined());
-  TORCH_CHECK(a.device() == out1.device() && out1.device() == out2.device(),
+  TORCH_CHECK_COLD(a.device() == out1.device() && out1.device() == out2.device(),
       "reduce_op(): expected input and both outputs to be on same device, but input is on ", a.device(),
       ", output1 is on ", out1.device(), " and output2 is on", out2.device());
-  TORCH_CHECK(out1.dim() == out2.dim(), "reduce_op(): expected both outputs to have same number of dims, but output1 has ", out1.dim(),
+  TORCH_CHECK_COLD(out1.dim() == out2.dim(), "reduce_op(): expected both outputs to have same number of dims, but output1 has ", out1.dim(),
       " and output2 has ", out2.dim());
-  TORCH_CHECK(out1.sizes() == out2.sizes(), "reduce_op(): expected both outputs to have same sizes, but output1 has ", out1.sizes(),
+  TORCH_CHECK_COLD(out1.sizes() == out2.sizes(), "reduce_op(): expected both outputs to have same sizes, but output1 has ", out1.sizes(),
       " and output2 has ", out2.sizes());
-  TORCH_CHECK(out1.strides() == out2.strides(), "reduce_op(): expected both outputs to have same strides, but output1 has ", out1.strides(),
+  TORCH_CHECK_COLD(out1.strides() == out2.strides(), "reduce_op(): expected both outputs to have same strides, but output1 has ", out1.strides(),
       " and output2 has ", out2.strides());
   return TensorIteratorConfig()
     .set_check_mem_overlap(false)
@@ -1204,7 +1254,7 @@ void TensorIteratorBase::mark_resize_outputs(const TensorIteratorConfig& config)
         continue;
       }
       // for reduction, output size does not match shape_, as output is reduced size, and shape_ is size of the input
-      TORCH_CHECK(is_reduction_,  "output with shape ", output.sizes(), " doesn't match the broadcast shape ",
+      TORCH_CHECK_COLD(is_reduction_,  "output with shape ", output.sizes(), " doesn't match the broadcast shape ",
                  shape_);
     }
   }
@@ -1485,6 +1535,177 @@ FastSetupType TensorIteratorBase::compute_fast_setup_type(const TensorIteratorCo
 
 TensorIteratorBase::TensorIteratorBase() = default;
 
+void set_tensor_iterator_plan_cache_enabled(bool enabled) {
+  plan_cache_enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool tensor_iterator_plan_cache_enabled() {
+  return plan_cache_enabled_.load(std::memory_order_relaxed);
+}
+
+void clear_tensor_iterator_plan_cache() {
+  std::lock_guard<std::mutex> guard(plan_cache_mutex());
+  plan_cache().clear();
+}
+
+std::vector<int64_t> TensorIteratorBase::compute_plan_cache_signature(
+    const TensorIteratorConfig& config) const {
+  // Reductions carry extra state (accumulate_/final_output_) and static
+  // shapes rewrite operand geometry, so neither is worth special-casing.
+  if (is_reduction_ || config.static_shape_.has_value()) {
+    return {};
+  }
+  int64_t config_bits = (static_cast<int64_t>(config.check_mem_overlap_) << 0) |
+      (static_cast<int64_t>(config.allow_cpu_scalars_) << 1) |
+      (static_cast<int64_t>(config.resize_outputs_) << 2) |
+      (static_cast<int64_t>(config.check_all_same_dtype_) << 3) |
+      (static_cast<int64_t>(config.check_all_same_device_) << 4) |
+      (static_cast<int64_t>(config.enforce_safe_casting_to_output_) << 5) |
+      (static_cast<int64_t>(config.enforce_linear_iteration_) << 6) |
+      (static_cast<int64_t>(config.promote_inputs_to_common_dtype_) << 7) |
+      (static_cast<int64_t>(config.promote_integer_inputs_to_float_) << 8) |
+      (static_cast<int64_t>(config.cast_common_dtype_to_outputs_) << 9);
+  if (config.static_dtype_.has_value()) {
+    config_bits |= 1LL << 16;
+    config_bits |= static_cast<int64_t>(*config.static_dtype_) << 24;
+  }
+  if (config.static_device_.has_value()) {
+    config_bits |= 1LL << 17;
+    config_bits |= static_cast<int64_t>(config.static_device_->type()) << 40;
+    config_bits |= static_cast<int64_t>(config.static_device_->index() + 1)
+        << 48;
+  }
+  std::vector<int64_t> signature;
+  signature.reserve(2 + operands_.size() * 12);
+  signature.push_back(config_bits);
+  signature.push_back(num_outputs_);
+  for (const auto i : c10::irange(operands_.size())) {
+    const auto& op = operands_[i];
+    const auto& tensor = op.tensor_base();
+    if (!tensor.defined()) {
+      // Functional structured kernels build with undefined outputs, which a
+      // restored plan materializes through set_output_raw_strided; an
+      // undefined input has no plan to restore onto. The sentinel cannot
+      // collide with a defined operand, whose record starts with a
+      // non-negative dtype value.
+      if (i >= static_cast<size_t>(num_outputs_)) {
+        return {};
+      }
+      signature.push_back(-1);
+      continue;
+    }
+    // A plan can only be restored onto storage-backed, unnamed operands:
+    // named tensors need name propagation, which the cached fast path
+    // skips.
+    if (!tensor.has_storage() || tensor.has_names()) {
+      return {};
+    }
+    signature.push_back(static_cast<int64_t>(tensor.scalar_type()));
+    signature.push_back(
+        (static_cast<int64_t>(tensor.device().type()) << 8) |
+        static_cast<int64_t>(tensor.device().index() + 1));
+    signature.push_back(static_cast<int64_t>(op.is_const));
+    signature.push_back(tensor.dim());
+    for (auto size : tensor.sizes()) {
+      signature.push_back(size);
+    }
+    for (auto stride : tensor.strides()) {
+      signature.push_back(stride);
+    }
+  }
+  return signature;
+}
+
+bool TensorIteratorBase::try_use_cached_plan(
+    const std::vector<int64_t>& signature) {
+  std::lock_guard<std::mutex> guard(plan_cache_mutex());
+  auto it = plan_cache().find(signature);
+  if (it == plan_cache().end()) {
+    return false;
+  }
+  const auto& plan = it->second;
+  TORCH_INTERNAL_ASSERT(plan.operands.size() == operands_.size());
+  shape_ = plan.shape;
+  has_coalesced_dimensions_ = plan.has_coalesced_dimensions;
+  all_ops_same_shape_ = plan.all_ops_same_shape;
+  all_ops_are_scalars_ = plan.all_ops_are_scalars;
+  common_device_ = plan.common_device;
+  common_dtype_ = plan.common_dtype;
+  for (const auto i : c10::irange(operands_.size())) {
+    auto& op = operands_[i];
+    const auto& cached = plan.operands[i];
+    op.stride_bytes = cached.stride_bytes;
+    op.target_dtype = cached.target_dtype;
+    op.current_dtype = cached.current_dtype;
+    if (op.tensor_base().defined()) {
+      op.device = op.tensor_base().device();
+    } else {
+      // Functional structured kernels reach here with undefined outputs;
+      // materialize them from the cached geometry the same way
+      // allocate_or_resize_outputs() would have.
+      op.device = cached.device;
+      set_output_raw_strided(
+          static_cast<int64_t>(i),
+          cached.tensor_sizes,
+          cached.tensor_strides,
+          original_options(op),
+          {});
+    }
+    if (op.is_const) {
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+      op.data = const_cast<void*>(op.tensor_base().const_data_ptr());
+    } else {
+      op.data = op.tensor_base().mutable_data_ptr();
+    }
+  }
+  int64_t ndim_offsets = (ndim() ? ndim() : 1);
+  view_offsets_ = DimVector(ndim_offsets, 0);
+  return true;
+}
+
+void TensorIteratorBase::record_cached_plan(
+    const std::vector<int64_t>& signature,
+    const uint64_t undefined_output_mask) {
+  for (const auto i : c10::irange(operands_.size())) {
+    auto& op = operands_[i];
+    // Builds that inserted dtype-cast temporaries (original_tensor
+    // switcheroo, see set_output_raw_strided) mutate state a restored plan
+    // cannot reproduce; leave those uncached. The same goes for resized
+    // outputs, except ones the build allocated from scratch: those are
+    // recorded as undefined in the signature and get re-materialized on
+    // restore.
+    const bool allocated_output = i < static_cast<size_t>(num_outputs_) &&
+        ((undefined_output_mask >> i) & 1);
+    if (!op.tensor_base().defined() || op.original_tensor_base().defined() ||
+        (op.will_resize && !allocated_output)) {
+      return;
+    }
+  }
+  if (!names_.empty()) {
+    return;
+  }
+  CachedIteratorPlan plan;
+  plan.shape = shape_;
+  plan.common_device = common_device_;
+  plan.common_dtype = common_dtype_;
+  plan.has_coalesced_dimensions = has_coalesced_dimensions_;
+  plan.all_ops_same_shape = all_ops_same_shape_;
+  plan.all_ops_are_scalars = all_ops_are_scalars_;
+  plan.operands.reserve(operands_.size());
+  for (auto& op : operands_) {
+    const auto& tensor = op.tensor_base();
+    plan.operands.push_back(
+        {op.stride_bytes,
+         op.target_dtype,
+         op.current_dtype,
+         tensor.device(),
+         DimVector(tensor.sizes()),
+         DimVector(tensor.strides())});
+  }
+  std::lock_guard<std::mutex> guard(plan_cache_mutex());
+  plan_cache().emplace(signature, std::move(plan));
+}
+
 void TensorIteratorBase::build(TensorIteratorConfig& config) {
   // populate some persistent configuration fields
   is_reduction_ = config.is_reduction_;
@@ -1494,6 +1715,22 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   populate_operands(config);
   // set is_output and is_read_write flags on appropriate tensors
   mark_outputs();
+
+  // opt-in fast path: restore a previously built plan for identical
+  // operand geometry; see set_tensor_iterator_plan_cache_enabled()
+  std::vector<int64_t> plan_signature;
+  uint64_t undefined_output_mask = 0;
+  if (C10_UNLIKELY(tensor_iterator_plan_cache_enabled()) && !is_meta_) {
+    plan_signature = compute_plan_cache_signature(config);
+    if (!plan_signature.empty() && try_use_cached_plan(plan_signature)) {
+      return;
+    }
+    for (const auto i : c10::irange(num_outputs_)) {
+      if (!operands_[i].tensor_base().defined()) {
+        undefined_output_mask |= uint64_t(1) << i;
+      }
+    }
+  }
   // Check that the outputs have no internal overlap
   // and do not share memory with inputs.
   compute_mem_overlaps(config);
@@ -1554,6 +1791,10 @@ void TensorIteratorBase::build(TensorIteratorConfig& config) {
   // a valid value for the offset
   int64_t ndim_offsets = (ndim() ? ndim() : 1);
   view_offsets_ = DimVector(ndim_offsets, 0);
+
+  if (C10_UNLIKELY(!plan_signature.empty())) {
+    record_cached_plan(plan_signature, undefined_output_mask);
+  }
 }
 
 // This is the structured kernels' implementation of set_output.  It is
@@ -13,6 +13,7 @@
 
 #include <array>
 #include <bitset>
+#include <vector>
 
 namespace at {
 class Tensor;
@@ -635,6 +636,15 @@ struct TORCH_API TensorIteratorBase : public impl::MetaBase {
   void propagate_names_to_outputs();
   void coalesce_dimensions();
 
+  // Plan cache helpers; see set_tensor_iterator_plan_cache_enabled().
+  // The returned signature is empty when this build is not cacheable.
+  std::vector<int64_t> compute_plan_cache_signature(
+      const TensorIteratorConfig&) const;
+  bool try_use_cached_plan(const std::vector<int64_t>& signature);
+  void record_cached_plan(
+      const std::vector<int64_t>& signature,
+      uint64_t undefined_output_mask);
+
  protected:
   /// Records the "computation" shape of the output tensor. The computation
   /// shape is different from the regular shape in a few ways:
@@ -989,6 +999,26 @@ class TORCH_API TensorIteratorConfig final {
   SmallVector<size_t, 4> const_tensor_indices_;
 };
 
+/// Opt-in global cache of built iterator plans, keyed on operand
+/// dtypes/devices/sizes/strides and the iterator configuration. When
+/// enabled, TensorIteratorBase::build() restores the coalesced loop
+/// descriptor (computation shape, per-operand byte strides, type-promotion
+/// results) recorded by an earlier identical build instead of recomputing
+/// it, so repeat elementwise calls on static shapes jump straight into the
+/// inner loop. Operands must be storage-backed, unnamed, and already
+/// correctly sized, except that outputs may be undefined: a restored plan
+/// then materializes them through set_output_raw_strided from the recorded
+/// geometry, which lets functional structured kernels (whose meta function
+/// is the iterator build) skip their shape/dtype inference as well. Builds
+/// that resize existing outputs or that insert dtype-cast temporaries
+/// always take the full path. While a cached plan is reused, memory-overlap
+/// checks are only
+/// performed at record time, so this should stay off for workloads that may
+/// pass overlapping tensors.
+TORCH_API void set_tensor_iterator_plan_cache_enabled(bool enabled);
+TORCH_API bool tensor_iterator_plan_cache_enabled();
+TORCH_API void clear_tensor_iterator_plan_cache();
+
 /// A container-like struct that acts as if it contains splits of a
 /// TensorIterator that can use 32-bit indexing. Taken together the splits cover
 /// the original TensorIterator.
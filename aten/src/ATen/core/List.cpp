@@ -1,4 +1,7 @@
 #include <ATen/core/List.h>
+// The element storage's member functions are instantiated here and need
+// the complete IValue type.
+#include <ATen/core/ivalue.h>
 
 
 namespace c10::detail {
@@ -8,7 +8,10 @@
 #include <c10/util/TypeList.h>
 #include <c10/util/intrusive_ptr.h>
 #include <c10/util/ArrayRef.h>
+#include <iterator>
+#include <new>
 #include <optional>
+#include <stdexcept>
 #include <vector>
 
 namespace at {
@@ -21,8 +24,328 @@ struct Type;
 
 namespace detail {
 
+// Contiguous element storage for ListImpl with inline capacity for small
+// lists: lists of up to InlineElements elements live entirely inside the
+// ListImpl allocation and never touch the heap for their element buffer,
+// which matters for the many 2-4 element int lists (strides, paddings)
+// that flow through the JIT interpreter. Growth past the inline capacity
+// transparently promotes to a heap buffer with the usual doubling policy.
+//
+// IValue is an incomplete type when this header defines ListImpl, so the
+// inline buffer is sized via the explicit ByteSize/Align parameters
+// instead of sizeof(T); a static_assert in ivalue_inl.h keeps them in
+// sync with IValue. All member functions are instantiated lazily, at use
+// sites where IValue is complete.
+template <class T, size_t InlineElements, size_t ByteSize, size_t Align>
+class SmallListStorage final {
+ public:
+  using value_type = T;
+  using size_type = size_t;
+  using difference_type = ptrdiff_t;
+  using iterator = T*;
+  using const_iterator = const T*;
+  using reverse_iterator = std::reverse_iterator<iterator>;
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  SmallListStorage() = default;
+
+  SmallListStorage(const SmallListStorage& rhs) {
+    reserve(rhs.size_);
+    for (size_type i = 0; i < rhs.size_; ++i) {
+      new (data_ + i) T(rhs.data_[i]);
+    }
+    size_ = rhs.size_;
+  }
+
+  SmallListStorage(SmallListStorage&& rhs) noexcept {
+    if (rhs.is_heap()) {
+      data_ = rhs.data_;
+      capacity_ = rhs.capacity_;
+      size_ = rhs.size_;
+      rhs.data_ = rhs.inline_data();
+      rhs.capacity_ = InlineElements;
+      rhs.size_ = 0;
+    } else {
+      for (size_type i = 0; i < rhs.size_; ++i) {
+        new (data_ + i) T(std::move(rhs.data_[i]));
+        rhs.data_[i].~T();
+      }
+      size_ = rhs.size_;
+      rhs.size_ = 0;
+    }
+  }
+
+  SmallListStorage& operator=(const SmallListStorage& rhs) {
+    if (this != &rhs) {
+      clear();
+      reserve(rhs.size_);
+      for (size_type i = 0; i < rhs.size_; ++i) {
+        new (data_ + i) T(rhs.data_[i]);
+      }
+      size_ = rhs.size_;
+    }
+    return *this;
+  }
+
+  SmallListStorage& operator=(SmallListStorage&& rhs) noexcept {
+    if (this != &rhs) {
+      clear();
+      release_heap();
+      if (rhs.is_heap()) {
+        data_ = rhs.data_;
+        capacity_ = rhs.capacity_;
+        size_ = rhs.size_;
+        rhs.data_ = rhs.inline_data();
+        rhs.capacity_ = InlineElements;
+        rhs.size_ = 0;
+      } else {
+        for (size_type i = 0; i < rhs.size_; ++i) {
+          new (data_ + i) T(std::move(rhs.data_[i]));
+          rhs.data_[i].~T();
+        }
+        size_ = rhs.size_;
+        rhs.size_ = 0;
+      }
+    }
+    return *this;
+  }
+
+  ~SmallListStorage() {
+    clear();
+    release_heap();
+  }
+
+  T* data() {
+    return data_;
+  }
+  const T* data() const {
+    return data_;
+  }
+  size_type size() const {
+    return size_;
+  }
+  size_type capacity() const {
+    return capacity_;
+  }
+  bool empty() const {
+    return size_ == 0;
+  }
+
+  iterator begin() {
+    return data_;
+  }
+  const_iterator begin() const {
+    return data_;
+  }
+  const_iterator cbegin() const {
+    return data_;
+  }
+  iterator end() {
+    return data_ + size_;
+  }
+  const_iterator end() const {
+    return data_ + size_;
+  }
+  const_iterator cend() const {
+    return data_ + size_;
+  }
+  reverse_iterator rbegin() {
+    return reverse_iterator(end());
+  }
+  reverse_iterator rend() {
+    return reverse_iterator(begin());
+  }
+
+  T& operator[](size_type pos) {
+    return data_[pos];
+  }
+  const T& operator[](size_type pos) const {
+    return data_[pos];
+  }
+
+  T& at(size_type pos) {
+    if (pos >= size_) {
+      throw std::out_of_range("list index out of range");
+    }
+    return data_[pos];
+  }
+  const T& at(size_type pos) const {
+    if (pos >= size_) {
+      throw std::out_of_range("list index out of range");
+    }
+    return data_[pos];
+  }
+
+  void clear() {
+    for (size_type i = 0; i < size_; ++i) {
+      data_[i].~T();
+    }
+    size_ = 0;
+  }
+
+  void reserve(size_type new_cap) {
+    if (new_cap > capacity_) {
+      grow_to(new_cap);
+    }
+  }
+
+  void push_back(const T& value) {
+    emplace_back(value);
+  }
+  void push_back(T&& value) {
+    emplace_back(std::move(value));
+  }
+
+  template <class... Args>
+  T& emplace_back(Args&&... args) {
+    if (size_ == capacity_) {
+      grow_to(capacity_ * 2);
+    }
+    new (data_ + size_) T(std::forward<Args>(args)...);
+    return data_[size_++];
+  }
+
+  void pop_back() {
+    data_[--size_].~T();
+  }
+
+  template <class... Args>
+  iterator emplace(const_iterator pos, Args&&... args) {
+    return insert(pos, T(std::forward<Args>(args)...));
+  }
+
+  iterator insert(const_iterator pos, const T& value) {
+    return insert_impl(pos - cbegin(), T(value));
+  }
+  iterator insert(const_iterator pos, T&& value) {
+    return insert_impl(pos - cbegin(), std::move(value));
+  }
+
+  template <class InputIt>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    const size_type idx = pos - cbegin();
+    const size_type count = std::distance(first, last);
+    if (count == 0) {
+      return begin() + idx;
+    }
+    reserve(size_ + count);
+    // Shift the tail into place back to front; slots past the old end are
+    // uninitialized and must be placement-constructed.
+    for (size_type i = size_; i > idx; --i) {
+      const size_type from = i - 1;
+      const size_type to = from + count;
+      if (to >= size_) {
+        new (data_ + to) T(std::move(data_[from]));
+        data_[from].~T();
+      } else {
+        data_[to] = std::move(data_[from]);
+      }
+    }
+    for (size_type i = 0; i < count; ++i, ++first) {
+      const size_type to = idx + i;
+      if (to >= size_) {
+        new (data_ + to) T(*first);
+      } else {
+        data_[to] = *first;
+      }
+    }
+    size_ += count;
+    return begin() + idx;
+  }
+
+  iterator erase(const_iterator pos) {
+    return erase(pos, pos + 1);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    const size_type idx = first - cbegin();
+    const size_type count = last - first;
+    for (size_type i = idx; i + count < size_; ++i) {
+      data_[i] = std::move(data_[i + count]);
+    }
+    for (size_type i = size_ - count; i < size_; ++i) {
+      data_[i].~T();
+    }
+    size_ -= count;
+    return begin() + idx;
+  }
+
+  void resize(size_type count) {
+    resize(count, T());
+  }
+
+  void resize(size_type count, const T& value) {
+    if (count < size_) {
+      for (size_type i = count; i < size_; ++i) {
+        data_[i].~T();
+      }
+    } else {
+      reserve(count);
+      for (size_type i = size_; i < count; ++i) {
+        new (data_ + i) T(value);
+      }
+    }
+    size_ = count;
+  }
+
+ private:
+  T* inline_data() {
+    return reinterpret_cast<T*>(inline_storage_);
+  }
+
+  bool is_heap() const {
+    return capacity_ > InlineElements;
+  }
+
+  void release_heap() {
+    if (is_heap()) {
+      ::operator delete(data_);
+      data_ = inline_data();
+      capacity_ = InlineElements;
+    }
+  }
+
+  void grow_to(size_type new_cap) {
+    T* new_data = static_cast<T*>(::operator new(new_cap * sizeof(T)));
+    for (size_type i = 0; i < size_; ++i) {
+      new (new_data + i) T(std::move(data_[i]));
+      data_[i].~T();
+    }
+    if (is_heap()) {
+      ::operator delete(data_);
+    }
+    data_ = new_data;
+    capacity_ = new_cap;
+  }
+
+  iterator insert_impl(size_type idx, T&& value) {
+    if (size_ == capacity_) {
+      grow_to(capacity_ * 2);
+    }
+    if (idx == size_) {
+      new (data_ + size_) T(std::move(value));
+    } else {
+      new (data_ + size_) T(std::move(data_[size_ - 1]));
+      for (size_type i = size_ - 1; i > idx; --i) {
+        data_[i] = std::move(data_[i - 1]);
+      }
+      data_[idx] = std::move(value);
+    }
+    ++size_;
+    return begin() + idx;
+  }
+
+  alignas(Align) unsigned char inline_storage_[InlineElements * ByteSize];
+  T* data_ = inline_data();
+  size_type size_ = 0;
+  size_type capacity_ = InlineElements;
+};
+
 struct ListImpl final : public c10::intrusive_ptr_target {
-  using list_type = std::vector<IValue>;
+  // Inline capacity of 4 covers the strides/paddings/dilations-style int
+  // lists that dominate list construction on hot paths. The byte size and
+  // alignment of IValue are static_asserted in ivalue_inl.h.
+  using list_type = SmallListStorage<IValue, 4, 16, 8>;
 
   explicit TORCH_API ListImpl(list_type list_, TypePtr elementType_);
 
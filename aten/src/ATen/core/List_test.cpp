@@ -1152,6 +1152,31 @@ TEST(ListTest, canAccessTensorByReference) {
       "List<at::Tensor> access should be by const reference");
 }
 
+TEST(ListTest, smallListGrowsPastInlineCapacity) {
+  // Lists up to 4 elements use ListImpl's inline storage; growing past it
+  // must transparently promote to a heap buffer and keep the elements.
+  List<int64_t> list;
+  for (int64_t i = 0; i < 10; ++i) {
+    list.push_back(i);
+  }
+  EXPECT_EQ(10, list.size());
+  for (int64_t i = 0; i < 10; ++i) {
+    EXPECT_EQ(i, list.get(i));
+  }
+}
+
+TEST(ListTest, smallListInsertEraseAcrossInlineCapacity) {
+  List<int64_t> list({1, 2, 3, 4});
+  list.insert(list.begin() + 2, 99);
+  EXPECT_EQ(5, list.size());
+  EXPECT_EQ(99, list.get(2));
+  EXPECT_EQ(3, list.get(3));
+  list.erase(list.begin());
+  EXPECT_EQ(4, list.size());
+  EXPECT_EQ(2, list.get(0));
+  EXPECT_EQ(99, list.get(1));
+}
+
 TEST(ListTest, toTypedList) {
   List<std::string> stringList({"one", "two"});
   auto genericList = impl::toList(std::move(stringList));
@@ -85,13 +85,70 @@ using can_unbox =
 //
 template <class... Args>
 torch::jit::Stack boxArgs(Args... args) {
-  // TODO Reuse stack vector instead of allocating?
   torch::jit::Stack stack;
   stack.reserve(sizeof...(Args));
   torch::jit::push(stack, std::forward<Args>(args)...);
   return stack;
 }
 
+// Note [Boxed stack arena]
+// Every trip through BoxedKernelWrapper::call used to heap-allocate a fresh
+// torch::jit::Stack for the boxed kernel's arguments and returns. Workloads
+// that are dominated by boxed fallbacks (functionalization, vmap batching
+// rules) issue these calls in tight loops, so the allocation shows up as
+// fixed per-call overhead. Instead we keep a small per-thread free list of
+// stacks: a BoxedStackFrame pops a stack off the list on construction
+// (retaining whatever capacity it accumulated on previous calls) and clears
+// and returns it on destruction. Frames nest naturally when a boxed kernel
+// reenters the dispatcher, because each frame owns its own vector. Stacks
+// in the free list are always empty, so nothing IValue-like outlives a call.
+class BoxedStackFrame final {
+ public:
+  BoxedStackFrame() : stack_(acquire()) {}
+  BoxedStackFrame(const BoxedStackFrame&) = delete;
+  BoxedStackFrame& operator=(const BoxedStackFrame&) = delete;
+  BoxedStackFrame(BoxedStackFrame&&) = delete;
+  BoxedStackFrame& operator=(BoxedStackFrame&&) = delete;
+  ~BoxedStackFrame() {
+    release(std::move(stack_));
+  }
+
+  torch::jit::Stack& stack() {
+    return stack_;
+  }
+
+ private:
+  // Keep at most this many cached stacks per thread; deeper reentrant
+  // nesting falls back to ordinary allocation.
+  static constexpr size_t kMaxCachedStacks = 8;
+
+  static std::vector<torch::jit::Stack>& freeList() {
+    thread_local std::vector<torch::jit::Stack> free_list;
+    return free_list;
+  }
+
+  static torch::jit::Stack acquire() {
+    auto& free_list = freeList();
+    if (free_list.empty()) {
+      return torch::jit::Stack();
+    }
+    torch::jit::Stack stack = std::move(free_list.back());
+    free_list.pop_back();
+    return stack;
+  }
+
+  static void release(torch::jit::Stack&& stack) {
+    auto& free_list = freeList();
+    if (free_list.size() >= kMaxCachedStacks) {
+      return;
+    }
+    stack.clear();
+    free_list.push_back(std::move(stack));
+  }
+
+  torch::jit::Stack stack_;
+};
+
 template <class T>
 inline constexpr size_t boxed_size_one() {
   static_assert(!std::is_same<std::decay_t<T>, c10::TensorOptions>::value, "need to patch this path to support TensorOptions passed by reference");
@@ -184,7 +241,7 @@ private:
 // For a given function type FT, BoxedKernelWrapper<FT> implements
 // a `call` method that
 // - takes a boxed kernel and unboxed arguments as specified by FT,
-// - calls `boxArgs` to box the arguments
+// - boxes the arguments onto a pooled stack (see Note [Boxed stack arena])
 // - calls the boxed kernel
 // - unboxes and returns the result
 //
@@ -232,7 +289,10 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     Args... args
   ) {
-    torch::jit::Stack stack = boxArgs<Args...>(std::forward<Args>(args)...);
+    BoxedStackFrame frame; // see Note [Boxed stack arena]
+    torch::jit::Stack& stack = frame.stack();
+    stack.reserve(sizeof...(Args));
+    torch::jit::push(stack, std::forward<Args>(args)...);
     boxed_kernel_func.callBoxed(opHandle, dispatchKeySet, &stack);
 
     if constexpr (!std::is_same_v<void, Result>) {
@@ -269,7 +329,10 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     at::Tensor& outArg, OtherArgs... otherArgs
   ) {
-    torch::jit::Stack stack = boxArgs<at::Tensor&, OtherArgs...>(outArg, std::forward<OtherArgs>(otherArgs)...);
+    BoxedStackFrame frame; // see Note [Boxed stack arena]
+    torch::jit::Stack& stack = frame.stack();
+    stack.reserve(1 + sizeof...(OtherArgs));
+    torch::jit::push(stack, outArg, std::forward<OtherArgs>(otherArgs)...);
     boxed_kernel_func.callBoxed(opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -295,7 +358,10 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     const at::Tensor& outArg, OtherArgs... otherArgs
   ) {
-    torch::jit::Stack stack = boxArgs(outArg, otherArgs...);
+    BoxedStackFrame frame; // see Note [Boxed stack arena]
+    torch::jit::Stack& stack = frame.stack();
+    stack.reserve(1 + sizeof...(OtherArgs));
+    torch::jit::push(stack, outArg, otherArgs...);
     boxed_kernel_func.callBoxed(opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -332,7 +398,10 @@ struct BoxedKernelWrapper<
     DispatchKeySet dispatchKeySet,
     FirstArg firstArg, RestArgs... restArgs
   ) {
-    torch::jit::Stack stack = boxArgs<FirstArg, RestArgs...>(std::forward<FirstArg>(firstArg), std::forward<RestArgs>(restArgs)...);
+    BoxedStackFrame frame; // see Note [Boxed stack arena]
+    torch::jit::Stack& stack = frame.stack();
+    stack.reserve(1 + sizeof...(RestArgs));
+    torch::jit::push(stack, std::forward<FirstArg>(firstArg), std::forward<RestArgs>(restArgs)...);
     boxed_kernel_func.callBoxed(opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == 1,
@@ -371,7 +440,10 @@ struct BoxedKernelWrapper<
     using ArgTuple = std::tuple<Args...>;
     constexpr int RetCount = std::tuple_size<Result>();
 
-    torch::jit::Stack stack = boxArgs<Args...>(std::forward<Args>(args)...);
+    BoxedStackFrame frame; // see Note [Boxed stack arena]
+    torch::jit::Stack& stack = frame.stack();
+    stack.reserve(sizeof...(Args));
+    torch::jit::push(stack, std::forward<Args>(args)...);
     boxed_kernel_func.callBoxed(opHandle, dispatchKeySet, &stack);
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
       stack.size() == RetCount,
@@ -37,7 +37,18 @@ inline DispatchKeySet computeDispatchKeySet(
     // function (as opposed to just applying it to the input 'ks').
     DispatchKeySet key_mask
 ) {
-  c10::impl::LocalDispatchKeySet local = c10::impl::tls_local_dispatch_key_set();
+  c10::impl::PODLocalDispatchKeySet raw =
+      c10::impl::tls_raw_local_dispatch_key_set();
+  if (C10_LIKELY((raw.included_ | raw.excluded_) == 0)) {
+    // Threads which have never touched a mode or dispatch key guard still
+    // have their zero-initialized TLS (see Note [TLS Initialization]).  In
+    // that state the merge below only involves the compile-time default
+    // sets, so it folds into constants and we skip the XOR adjustments in
+    // PODLocalDispatchKeySet entirely.
+    return ((ks | c10::default_included_set) - c10::default_excluded_set) &
+        key_mask;
+  }
+  c10::impl::LocalDispatchKeySet local = raw;
   // TODO: It's a bit irritating that we have to do logical ORs here, it would
   // be nice to only do one.  Can always_included be folded into the TLS?  Well,
   // it's a bit troublesome, because fastpath TLS access requires the type of
@@ -97,8 +97,22 @@ C10_EXPORT Dispatcher& Dispatcher::realSingleton() {
 }
 
 std::optional<OperatorHandle> Dispatcher::findOp(const OperatorName& overload_name) {
-  return operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) -> std::optional<OperatorHandle> {
-    auto found = operatorLookupTable.find(overload_name);
+  // Names are interned at registration, so a name without a symbol was
+  // never registered and the (string-keyed) table probe can be skipped.
+  const auto symbol = findInternedOperatorName(overload_name);
+  if (!symbol.has_value()) {
+    return std::nullopt;
+  }
+  // Symbols index the frozen snapshot directly; see freezeOperatorLookup.
+  if (auto frozen = std::atomic_load_explicit(
+          &frozenOperatorLookupTable_, std::memory_order_acquire)) {
+    if (*symbol < frozen->size()) {
+      return (*frozen)[*symbol];
+    }
+    // Interned after the freeze; fall through to the live table.
+  }
+  return operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorNameSymbol, OperatorHandle>& operatorLookupTable) -> std::optional<OperatorHandle> {
+    auto found = operatorLookupTable.find(*symbol);
     if (found == operatorLookupTable.end()) {
       return std::nullopt;
     }
@@ -161,9 +175,9 @@ OperatorHandle Dispatcher::findSchemaOrThrow(const char* name, const char* overl
     // missing schema
     auto it2 = findOp({name, overload_name});
     if (!it2.has_value()) {
-      TORCH_CHECK(false, "Could not find schema for ", name, ".", overload_name);
+      TORCH_CHECK_COLD(false, "Could not find schema for ", name, ".", overload_name);
     } else {
-      TORCH_CHECK(false, "Could not find schema for ", name, ".", overload_name,
+      TORCH_CHECK_COLD(false, "Could not find schema for ", name, ".", overload_name,
         " but we found an implementation; did you forget to def() the operator?");
     }
   }
@@ -171,10 +185,10 @@ OperatorHandle Dispatcher::findSchemaOrThrow(const char* name, const char* overl
 }
 
 const std::vector<OperatorName> Dispatcher::getAllOpNames() {
-  return operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) -> std::vector<OperatorName> {
+  return operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorNameSymbol, OperatorHandle>& operatorLookupTable) -> std::vector<OperatorName> {
     std::vector<OperatorName> allOpNames;
     for (const auto& op : operatorLookupTable) {
-        allOpNames.push_back(op.first);
+        allOpNames.push_back(op.second.operator_name());
     }
     return allOpNames;
   });
@@ -190,9 +204,11 @@ OperatorHandle Dispatcher::findOrRegisterName_(const OperatorName& op_name) {
 
   operators_.emplace_back(OperatorName(op_name));
   OperatorHandle handle(--operators_.end());
-  operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
-    operatorLookupTable.emplace(op_name, handle);
+  const auto symbol = internOperatorName(op_name);
+  operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorNameSymbol, OperatorHandle>& operatorLookupTable) {
+    operatorLookupTable.emplace(symbol, handle);
   });
+  invalidateFrozenOperatorLookup_();
 
   return handle;
 }
@@ -426,9 +442,12 @@ void Dispatcher::cleanup(const OperatorHandle& op, const OperatorName& op_name)
     // NOTE: Making this call fast is the only reason OperatorHandle
     // stores operatorIterator_!
     operators_.erase(op.operatorIterator_);
-    operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) {
-      operatorLookupTable.erase(op_name);
+    const auto symbol = findInternedOperatorName(op_name);
+    TORCH_INTERNAL_ASSERT(symbol.has_value());
+    operatorLookupTable_.write([&] (ska::flat_hash_map<OperatorNameSymbol, OperatorHandle>& operatorLookupTable) {
+      operatorLookupTable.erase(*symbol);
     });
+    invalidateFrozenOperatorLookup_();
   }
 }
 
@@ -469,6 +488,56 @@ void Dispatcher::deregisterFallback_(DispatchKey dispatchKey) {
 }
 
 
+std::atomic<bool> Dispatcher::sealed_dispatch_{false};
+
+void Dispatcher::sealDispatch(DispatchKeySet ks) {
+  std::lock_guard<std::mutex> lock(guard_->mutex);
+  for (auto& op : operators_) {
+    op.op.seal(ks);
+  }
+  sealed_dispatch_.store(true, std::memory_order_relaxed);
+}
+
+void Dispatcher::unsealDispatch() {
+  std::lock_guard<std::mutex> lock(guard_->mutex);
+  sealed_dispatch_.store(false, std::memory_order_relaxed);
+  for (auto& op : operators_) {
+    op.op.unseal();
+  }
+}
+
+void Dispatcher::freezeOperatorLookup() {
+  std::lock_guard<std::mutex> lock(guard_->mutex);
+  auto frozen = std::make_shared<FrozenOperatorLookupTable>();
+  operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorNameSymbol, OperatorHandle>& operatorLookupTable) {
+    for (const auto& entry : operatorLookupTable) {
+      if (entry.first >= frozen->size()) {
+        frozen->resize(entry.first + 1);
+      }
+      (*frozen)[entry.first] = entry.second;
+    }
+  });
+  std::atomic_store_explicit(
+      &frozenOperatorLookupTable_,
+      std::shared_ptr<const FrozenOperatorLookupTable>(std::move(frozen)),
+      std::memory_order_release);
+}
+
+void Dispatcher::unfreezeOperatorLookup() {
+  std::lock_guard<std::mutex> lock(guard_->mutex);
+  invalidateFrozenOperatorLookup_();
+}
+
+void Dispatcher::invalidateFrozenOperatorLookup_() {
+  if (std::atomic_load_explicit(
+          &frozenOperatorLookupTable_, std::memory_order_relaxed) != nullptr) {
+    std::atomic_store_explicit(
+        &frozenOperatorLookupTable_,
+        std::shared_ptr<const FrozenOperatorLookupTable>(),
+        std::memory_order_release);
+  }
+}
+
 RegistrationHandleRAII Dispatcher::addRegistrationListener(std::unique_ptr<OpRegistrationListener> listener) {
   std::lock_guard<std::mutex> lock(guard_->mutex);
 
@@ -495,7 +564,7 @@ void Dispatcher::checkInvariants() const {
 }
 
 std::vector<OperatorHandle> Dispatcher::findDanglingImpls() const {
-  return operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) -> std::vector<OperatorHandle> {
+  return operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorNameSymbol, OperatorHandle>& operatorLookupTable) -> std::vector<OperatorHandle> {
     std::vector<OperatorHandle> opsWithDanglingImpls;
     for (const auto& op : operatorLookupTable) {
       if (!op.second.hasSchema()) {
@@ -507,12 +576,12 @@ std::vector<OperatorHandle> Dispatcher::findDanglingImpls() const {
 }
 
 std::vector<OperatorName> Dispatcher::getRegistrationsForDispatchKey(std::optional<DispatchKey> k) const {
-  return operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorName, OperatorHandle>& operatorLookupTable) -> std::vector<OperatorName> {
+  return operatorLookupTable_.read([&] (const ska::flat_hash_map<OperatorNameSymbol, OperatorHandle>& operatorLookupTable) -> std::vector<OperatorName> {
     std::vector<OperatorName> op_names;
     for (const auto& op : operatorLookupTable) {
       // If no DispatchKey is specified, print all of the operators.
       if (!k || op.second.hasKernelForDispatchKey(*k)) {
-          op_names.push_back(op.first);
+          op_names.push_back(op.second.operator_name());
       }
     }
     return op_names;
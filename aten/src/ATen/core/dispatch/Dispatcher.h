@@ -9,6 +9,7 @@
 #include <ATen/record_function.h>
 #include <c10/util/Exception.h>
 #include <c10/util/LeftRight.h>
+#include <atomic>
 #include <list>
 #include <mutex>
 #include <condition_variable>
@@ -270,6 +271,44 @@ public:
    */
   RegistrationHandleRAII addRegistrationListener(std::unique_ptr<OpRegistrationListener> listener);
 
+  // ------------------------------------------------------------------------
+  //
+  // Sealed dispatch
+  //
+  // ------------------------------------------------------------------------
+
+  /**
+   * Seals the dispatcher for a single-backend process: snapshots, for every
+   * registered operator, the kernel resolved for `ks` into a direct
+   * per-operator function pointer that is consulted before the regular
+   * dispatch-table lookup. Intended to be called once after warmup in
+   * processes that only ever dispatch with one key set (e.g. CPU +
+   * autograd); calls arriving with any other key set transparently fall
+   * back to the normal path. Note that sealed calls bypass per-op observers
+   * (RecordFunction step callbacks), which is part of the overhead being
+   * removed. Call sealDispatch again after loading additional libraries to
+   * refresh the snapshots, or unsealDispatch to restore normal dispatch.
+   */
+  void sealDispatch(DispatchKeySet ks);
+  void unsealDispatch();
+  static bool isDispatchSealed() {
+    return sealed_dispatch_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * Freezes operator-name lookup: snapshots operatorLookupTable_ into a
+   * table indexed directly by the interned OperatorNameSymbol, so findOp
+   * resolves a symbol with one bounds check and one load instead of a
+   * hash map probe. Symbols are assigned densely at interning, so the
+   * snapshot is a minimal perfect mapping of every registered name.
+   * Intended to be called once after all libraries are loaded (e.g. in
+   * Python-free serving); any later registration or deregistration drops
+   * the snapshot and lookups transparently fall back to the hash map
+   * until freezeOperatorLookup is called again.
+   */
+  void freezeOperatorLookup();
+  void unfreezeOperatorLookup();
+
   void checkInvariants() const;
 
   //
@@ -328,18 +367,32 @@ private:
   void deregisterLibrary_(const std::string& ns);
   void cleanup(const OperatorHandle& op, const OperatorName& op_name);
   void checkSchemaCompatibility(const OperatorHandle& op, const FunctionSchema& schema, const std::string& debug);
+  void invalidateFrozenOperatorLookup_();
+
+  // Frozen snapshot of operatorLookupTable_, indexed directly by symbol;
+  // see freezeOperatorLookup. Read with an atomic shared_ptr load so
+  // findOp never takes a lock; mutators invalidate it by storing nullptr
+  // (the shared_ptr keeps in-flight readers safe).
+  using FrozenOperatorLookupTable = std::vector<std::optional<OperatorHandle>>;
+  std::shared_ptr<const FrozenOperatorLookupTable> frozenOperatorLookupTable_;
 
   std::list<OperatorDef> operators_;
+  // Keyed by interned OperatorNameSymbol so probes hash and compare
+  // integers; names are interned at registration time.
 #if !defined(C10_MOBILE)
-  LeftRight<ska::flat_hash_map<OperatorName, OperatorHandle>> operatorLookupTable_;
+  LeftRight<ska::flat_hash_map<OperatorNameSymbol, OperatorHandle>> operatorLookupTable_;
 #else
-  RWSafeLeftRightWrapper<ska::flat_hash_map<OperatorName, OperatorHandle>> operatorLookupTable_;
+  RWSafeLeftRightWrapper<ska::flat_hash_map<OperatorNameSymbol, OperatorHandle>> operatorLookupTable_;
 #endif
   // Map from namespace to debug string (saying, e.g., where the library was defined)
   ska::flat_hash_map<std::string, std::string> libraries_;
 
   std::array<impl::AnnotatedKernel, num_runtime_entries> backendFallbackKernels_;
 
+  // Process-wide flag for the sealed-dispatch fast path; checked on every
+  // call, so kept as a relaxed atomic rather than behind the mutex.
+  static std::atomic<bool> sealed_dispatch_;
+
   std::unique_ptr<detail::RegistrationListenerList> listeners_;
 
   // This condition variable gets notified whenever we add a new def/impl to the
@@ -673,6 +726,13 @@ C10_ALWAYS_INLINE_UNLESS_MOBILE Return Dispatcher::call(const TypedOperatorHandl
     detail::_print_dispatch_trace("[call]", toString(op.operator_name()), dispatchKeySet);
   }
 #endif
+  if (C10_UNLIKELY(isDispatchSealed())) {
+    if (const KernelFunction* sealed =
+            op.operatorDef_->op.sealedLookup(dispatchKeySet)) {
+      return sealed->template call<Return, Args...>(
+          op, dispatchKeySet, std::forward<Args>(args)...);
+    }
+  }
   const KernelFunction& kernel = op.operatorDef_->op.lookup(dispatchKeySet);
 #ifndef PYTORCH_DISABLE_PER_OP_PROFILING
   auto step_callbacks = at::getStepCallbacksUnlessEmpty(at::RecordScope::FUNCTION);
@@ -191,6 +191,33 @@ public:
     return kernel;
   }
 
+  // Sealed-dispatch fast path (see Dispatcher::sealDispatch). Snapshots
+  // the kernel resolved for `ks` so that subsequent calls arriving with
+  // exactly that key set can skip the dispatch-table index computation.
+  // Operators with no valid kernel for `ks` stay unsealed and keep using
+  // the regular lookup path.
+  void seal(DispatchKeySet ks) {
+    const auto idx = ks.getDispatchTableIndexForDispatchKeySet();
+    if (idx == -1 || !dispatchTable_[idx].isValid()) {
+      unseal();
+      return;
+    }
+    sealed_kernel_ = &dispatchTable_[idx];
+    sealed_key_set_ = ks;
+  }
+
+  void unseal() {
+    sealed_kernel_ = nullptr;
+    sealed_key_set_ = DispatchKeySet();
+  }
+
+  C10_ALWAYS_INLINE const KernelFunction* sealedLookup(
+      DispatchKeySet ks) const {
+    return (sealed_kernel_ != nullptr && ks == sealed_key_set_)
+        ? sealed_kernel_
+        : nullptr;
+  }
+
   std::string listAllDispatchKeys() const;
 
   // Returns true if kernel_ has entry for any key in ks.
@@ -227,6 +254,10 @@ private:
   #endif
   std::array<KernelFunction, c10::num_runtime_entries> dispatchTable_;
   DispatchKeyExtractor dispatchKeyExtractor_;
+  // Sealed-dispatch snapshot; nullptr when this operator is not sealed.
+  // Points into dispatchTable_, so it stays valid across table updates.
+  const KernelFunction* sealed_kernel_ = nullptr;
+  DispatchKeySet sealed_key_set_;
   // Pointer to the torch.ops.ns.op.overload object for speed
   c10::PyHandleCache py_cache_;
 
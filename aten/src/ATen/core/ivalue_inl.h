@@ -38,6 +38,13 @@ TORCH_API bool isCustomClass(const c10::IValue& v);
 namespace c10 {
 struct IValue;
 struct ClassType;
+
+// ListImpl sizes its inline small-list buffer without seeing the complete
+// IValue type; keep the explicit parameters in sync (see List.h).
+static_assert(
+    sizeof(IValue) == 16 && alignof(IValue) == 8,
+    "Update the ByteSize/Align parameters of detail::ListImpl::list_type "
+    "when changing the layout of IValue");
 struct TupleType;
 struct EnumType;
 struct InferredType;
@@ -1302,6 +1302,26 @@ TEST(NewOperatorRegistrationTest, importTopLevel) {
   ASSERT_TRUE(Dispatcher::singleton().findOp({"test::impl1", ""}).has_value());
 }
 
+TEST(NewOperatorRegistrationTest, frozenOperatorLookup) {
+  auto m = MAKE_TORCH_LIBRARY(test);
+  m.def("frozen1(Tensor self) -> Tensor");
+
+  Dispatcher::singleton().freezeOperatorLookup();
+  ASSERT_TRUE(Dispatcher::singleton().findOp({"test::frozen1", ""}).has_value());
+  ASSERT_FALSE(Dispatcher::singleton().findOp({"test::frozen_missing", ""}).has_value());
+
+  // Registering after the freeze drops the snapshot; both old and new
+  // names must still resolve.
+  m.def("frozen2(Tensor self) -> Tensor");
+  ASSERT_TRUE(Dispatcher::singleton().findOp({"test::frozen1", ""}).has_value());
+  ASSERT_TRUE(Dispatcher::singleton().findOp({"test::frozen2", ""}).has_value());
+
+  Dispatcher::singleton().freezeOperatorLookup();
+  ASSERT_TRUE(Dispatcher::singleton().findOp({"test::frozen2", ""}).has_value());
+  Dispatcher::singleton().unfreezeOperatorLookup();
+  ASSERT_TRUE(Dispatcher::singleton().findOp({"test::frozen1", ""}).has_value());
+}
+
 TEST(NewOperatorRegistrationTest, overload) {
   auto m = MAKE_TORCH_LIBRARY(test);
   m.def("fn(Tensor self) -> Tensor");
@@ -1,7 +1,58 @@
 #include <ATen/core/operator_name.h>
 
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
 namespace c10 {
 
+namespace {
+
+struct OperatorNameInternTable {
+  std::shared_mutex mutex;
+  std::unordered_map<OperatorName, OperatorNameSymbol> symbols;
+};
+
+// Leaked: symbols must stay valid for operators deregistered (and
+// possibly re-registered) during static destruction.
+OperatorNameInternTable& internTable() {
+  static auto* table = new OperatorNameInternTable();
+  return *table;
+}
+
+} // namespace
+
+OperatorNameSymbol internOperatorName(const OperatorName& opName) {
+  auto& table = internTable();
+  {
+    std::shared_lock<std::shared_mutex> lock(table.mutex);
+    auto it = table.symbols.find(opName);
+    if (it != table.symbols.end()) {
+      return it->second;
+    }
+  }
+  std::unique_lock<std::shared_mutex> lock(table.mutex);
+  // Another writer may have raced us between the locks.
+  auto it = table.symbols.find(opName);
+  if (it != table.symbols.end()) {
+    return it->second;
+  }
+  const auto symbol = static_cast<OperatorNameSymbol>(table.symbols.size());
+  table.symbols.emplace(opName, symbol);
+  return symbol;
+}
+
+std::optional<OperatorNameSymbol> findInternedOperatorName(
+    const OperatorName& opName) {
+  auto& table = internTable();
+  std::shared_lock<std::shared_mutex> lock(table.mutex);
+  auto it = table.symbols.find(opName);
+  if (it == table.symbols.end()) {
+    return std::nullopt;
+  }
+  return it->second;
+}
+
 std::string toString(const OperatorName& opName) {
   std::ostringstream oss;
   oss << opName;
@@ -3,6 +3,7 @@
 #include <c10/macros/Macros.h>
 #include <c10/util/Exception.h>
 #include <c10/util/string_view.h>
+#include <cstdint>
 #include <optional>
 #include <ostream>
 #include <string>
@@ -72,6 +73,21 @@ struct OperatorNameView final {
   }
 };
 
+// Interned integer symbol for an OperatorName. Symbols are assigned at
+// first interning and stay stable for the process lifetime (they are not
+// reclaimed when an operator is deregistered), so tables keyed by them
+// hash and compare plain integers instead of two std::strings.
+using OperatorNameSymbol = uint32_t;
+
+// Interns `opName`, assigning a fresh symbol on first use.
+TORCH_API OperatorNameSymbol internOperatorName(const OperatorName& opName);
+
+// Returns the symbol for `opName` without interning, or nullopt if the
+// name has never been interned. Since names are interned at
+// registration, lookup paths can treat nullopt as "not registered".
+TORCH_API std::optional<OperatorNameSymbol> findInternedOperatorName(
+    const OperatorName& opName);
+
 inline bool operator==(const OperatorName& lhs, const OperatorName& rhs) {
   return lhs.name == rhs.name && lhs.overload_name == rhs.overload_name;
 }
@@ -824,6 +824,21 @@ inline void convert(const float* src, BFloat16* dst, int64_t n) {
   }
 }
 
+template <>
+inline void convert(const BFloat16* src, float* dst, int64_t n) {
+  int64_t i;
+  for (i = 0; i + Vectorized<BFloat16>::size() <= n; i += Vectorized<BFloat16>::size()) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    __m256 o1, o2;
+    cvtbf16_fp32(a, o1, o2);
+    _mm256_storeu_ps(&dst[i], o1);
+    _mm256_storeu_ps(&dst[i + 8], o2);
+  }
+  for (; i < n; i++) {
+    dst[i] = c10::convert<float>(src[i]);
+  }
+}
+
 template <>
 inline void convert(const double* src, BFloat16* dst, int64_t n) {
   auto load_float = [](const double *src) -> __m256 {
@@ -1026,6 +1041,21 @@ inline void convert(const float* src, Half* dst, int64_t n) {
   }
 }
 
+template <>
+inline void convert(const Half* src, float* dst, int64_t n) {
+  int64_t i;
+  for (i = 0; i + Vectorized<Half>::size() <= n; i += Vectorized<Half>::size()) {
+    __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(&src[i]));
+    __m256 o1, o2;
+    cvtfp16_fp32(a, o1, o2);
+    _mm256_storeu_ps(&dst[i], o1);
+    _mm256_storeu_ps(&dst[i + 8], o2);
+  }
+  for (; i < n; i++) {
+    dst[i] = c10::convert<float>(src[i]);
+  }
+}
+
 template <>
 inline void convert(const double* src, Half* dst, int64_t n) {
   auto load_float = [](const double *src) -> __m256 {
@@ -944,6 +944,21 @@ inline void convert(const float* src, BFloat16* dst, int64_t n) {
   }
 }
 
+template <>
+inline void convert(const BFloat16* src, float* dst, int64_t n) {
+  int64_t i;
+  for (i = 0; i + Vectorized<BFloat16>::size() <= n; i += Vectorized<BFloat16>::size()) {
+    __m512i a = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(&src[i]));
+    __m512 o1, o2;
+    cvtbf16_fp32(a, o1, o2);
+    _mm512_storeu_ps(&dst[i], o1);
+    _mm512_storeu_ps(&dst[i + 16], o2);
+  }
+  for (; i < n; i++) {
+    dst[i] = c10::convert<float>(src[i]);
+  }
+}
+
 template <>
 inline void convert(const double* src, BFloat16* dst, int64_t n) {
   auto load_float = [](const double *src) -> __m512 {
@@ -1610,6 +1625,21 @@ inline void convert(const float* src, Half* dst, int64_t n) {
   }
 }
 
+template <>
+inline void convert(const Half* src, float* dst, int64_t n) {
+  int64_t i;
+  for (i = 0; i + Vectorized<Half>::size() <= n; i += Vectorized<Half>::size()) {
+    __m512i a = _mm512_loadu_si512(reinterpret_cast<const __m512i*>(&src[i]));
+    __m512 o1, o2;
+    cvtfp16_fp32(a, o1, o2);
+    _mm512_storeu_ps(&dst[i], o1);
+    _mm512_storeu_ps(&dst[i + 16], o2);
+  }
+  for (; i < n; i++) {
+    dst[i] = c10::convert<float>(src[i]);
+  }
+}
+
 template <>
 inline void convert(const double* src, Half* dst, int64_t n) {
   auto load_float = [](const double *src) -> __m512 {
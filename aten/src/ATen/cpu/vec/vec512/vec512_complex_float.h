@@ -894,16 +894,15 @@ template <> Vectorized<c10::complex<float>> inline operator-(const Vectorized<c1
 template <> Vectorized<c10::complex<float>> inline operator*(const Vectorized<c10::complex<float>> &a,
                                                             const Vectorized<c10::complex<float>> &b) {
   //(a + bi)  * (c + di) = (ac - bd) + (ad + bc)i
-  const __m512 sign_mask = _mm512_setr_ps(0.0, -0.0, 0.0, -0.0, 0.0, -0.0, 0.0, -0.0,
-                                          0.0, -0.0, 0.0, -0.0, 0.0, -0.0, 0.0, -0.0);
-  auto ac_bd = _mm512_mul_ps(a, b);         //ac       bd
-
-  auto d_c = _mm512_permute_ps(b, 0xB1);    //d        c
-  d_c = _mm512_xor_ps(sign_mask, d_c);      //d       -c
-  auto ad_bc = _mm512_mul_ps(a, d_c);       //ad      -bc
-
-  auto ret = Vectorized<c10::complex<float>>::hsub_ps(ac_bd, ad_bc);  //ac - bd  ad + bc
-  return ret;
+  // Shuffle-based multiply: broadcasting the real/imag parts of a and
+  // alternating add/sub via fmaddsub avoids the cross-lane permutes that
+  // hsub_ps needs.
+  auto a_re = _mm512_moveldup_ps(a);         //a        a
+  auto a_im = _mm512_movehdup_ps(a);         //b        b
+  auto d_c = _mm512_permute_ps(b, 0xB1);     //d        c
+  auto bd_bc = _mm512_mul_ps(a_im, d_c);     //bd       bc
+  // fmaddsub subtracts in the even (real) lanes and adds in the odd ones
+  return _mm512_fmaddsub_ps(a_re, b, bd_bc); //ac - bd  ad + bc
 }
 
 template <> Vectorized<c10::complex<float>> inline operator/(const Vectorized<c10::complex<float>> &a,
@@ -912,17 +911,24 @@ template <> Vectorized<c10::complex<float>> inline operator/(const Vectorized<c1
   auto mask = _mm512_set1_ps(-0.f);
   auto fabs_cd = _mm512_andnot_ps(mask, b);     // |c|    |d|
   auto fabs_dc = _mm512_permute_ps(fabs_cd, 0xB1);   // |d|    |c|
-  auto scale = _mm512_rcp14_ps(_mm512_max_ps(fabs_cd, fabs_dc));  // 1/sc     1/sc
+  auto max_cd = _mm512_max_ps(fabs_cd, fabs_dc);
+  // rcp14 only carries ~14 bits; one Newton-Raphson step brings the scale
+  // back to (nearly) full precision so it cancels cleanly between the
+  // numerator and the denominator.
+  auto scale = _mm512_rcp14_ps(max_cd);      // 1/sc     1/sc
+  const auto two = _mm512_set1_ps(2.0f);
+  scale = _mm512_mul_ps(scale, _mm512_fnmadd_ps(max_cd, scale, two));
   auto a2 = _mm512_mul_ps(a, scale);         // a/sc     b/sc
   auto b2 = _mm512_mul_ps(b, scale);         // c/sc     d/sc
-  auto acbd2 = _mm512_mul_ps(a2, b2);
 
-  const __m512 sign_mask = _mm512_setr_ps(-0.0, 0.0, -0.0, 0.0, -0.0, 0.0, -0.0, 0.0,
-                                          -0.0, 0.0, -0.0, 0.0, -0.0, 0.0, -0.0, 0.0);
-  auto dc2 = _mm512_permute_ps(b2, 0xB1);    // d/sc         c/sc
-  dc2 = _mm512_xor_ps(sign_mask, dc2);       // -d/|c,d|        c/sc
-  auto adbc2 = _mm512_mul_ps(a2, dc2);       //-ad/sc^2      bc/sc^2
-  auto res2 = Vectorized<c10::complex<float>>::hadd_ps(acbd2, adbc2);  //(ac+bd)/sc^2  (bc-ad)/sc^2
+  // Fused conj-multiply for the numerator:
+  // conj(c + di) * (a + bi) = (ac + bd) + (bc - ad)i
+  auto b2_re = _mm512_moveldup_ps(b2);       // c/sc     c/sc
+  auto b2_im = _mm512_movehdup_ps(b2);       // d/sc     d/sc
+  auto b_a2 = _mm512_permute_ps(a2, 0xB1);   // b/sc     a/sc
+  auto bd_ad2 = _mm512_mul_ps(b2_im, b_a2);  // bd/sc^2  ad/sc^2
+  // fmsubadd adds in the even (real) lanes and subtracts in the odd ones
+  auto res2 = _mm512_fmsubadd_ps(b2_re, a2, bd_ad2);  //(ac+bd)/sc^2  (bc-ad)/sc^2
 
   // get the denominator
   auto denom2 = Vectorized<c10::complex<float>>(b2).abs_2_();  // (c^2+d^2)/sc^2   (c^2+d^2)/sc^2
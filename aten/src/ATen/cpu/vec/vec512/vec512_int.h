@@ -349,6 +349,86 @@ inline void convert(const int32_t *src, double *dst, int64_t n) {
   }
 }
 
+template <>
+inline void convert(const int8_t *src, int32_t *dst, int64_t n) {
+  int64_t i;
+  // int8_t has quarter the size of int32_t
+#ifndef _MSC_VER
+# pragma unroll
+#endif
+  for (i = 0; i <= (n - Vectorized<int32_t>::size()); i += Vectorized<int32_t>::size()) {
+    auto input_128_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    auto output_vec = _mm512_cvtepi8_epi32(input_128_vec);
+    _mm512_storeu_si512(reinterpret_cast<__m512i*>(dst + i), output_vec);
+  }
+#ifndef _MSC_VER
+# pragma unroll
+#endif
+  for (; i < n; i++) {
+    dst[i] = static_cast<int32_t>(src[i]);
+  }
+}
+
+template <>
+inline void convert(const uint8_t *src, int32_t *dst, int64_t n) {
+  int64_t i;
+  // uint8_t has quarter the size of int32_t
+#ifndef _MSC_VER
+# pragma unroll
+#endif
+  for (i = 0; i <= (n - Vectorized<int32_t>::size()); i += Vectorized<int32_t>::size()) {
+    auto input_128_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    auto output_vec = _mm512_cvtepu8_epi32(input_128_vec);
+    _mm512_storeu_si512(reinterpret_cast<__m512i*>(dst + i), output_vec);
+  }
+#ifndef _MSC_VER
+# pragma unroll
+#endif
+  for (; i < n; i++) {
+    dst[i] = static_cast<int32_t>(src[i]);
+  }
+}
+
+template <>
+inline void convert(const int8_t *src, float *dst, int64_t n) {
+  int64_t i;
+  // int8_t has quarter the size of float
+#ifndef _MSC_VER
+# pragma unroll
+#endif
+  for (i = 0; i <= (n - Vectorized<float>::size()); i += Vectorized<float>::size()) {
+    auto input_128_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    auto output_vec = _mm512_cvtepi32_ps(_mm512_cvtepi8_epi32(input_128_vec));
+    _mm512_storeu_ps(dst + i, output_vec);
+  }
+#ifndef _MSC_VER
+# pragma unroll
+#endif
+  for (; i < n; i++) {
+    dst[i] = static_cast<float>(src[i]);
+  }
+}
+
+template <>
+inline void convert(const uint8_t *src, float *dst, int64_t n) {
+  int64_t i;
+  // uint8_t has quarter the size of float
+#ifndef _MSC_VER
+# pragma unroll
+#endif
+  for (i = 0; i <= (n - Vectorized<float>::size()); i += Vectorized<float>::size()) {
+    auto input_128_vec = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+    auto output_vec = _mm512_cvtepi32_ps(_mm512_cvtepu8_epi32(input_128_vec));
+    _mm512_storeu_ps(dst + i, output_vec);
+  }
+#ifndef _MSC_VER
+# pragma unroll
+#endif
+  for (; i < n; i++) {
+    dst[i] = static_cast<float>(src[i]);
+  }
+}
+
 template <>
 class Vectorized<int16_t> : public Vectorizedi {
 private:
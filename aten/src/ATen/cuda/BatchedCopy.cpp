@@ -0,0 +1,123 @@
+#include <ATen/cuda/BatchedCopy.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CUDAEvent.h>
+#include <ATen/cuda/CachingHostAllocator.h>
+#include <ATen/cuda/Exceptions.h>
+#include <c10/cuda/CUDAGuard.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <array>
+
+namespace at::cuda {
+
+namespace {
+
+// Each side stream maps onto one copy engine; the devices we target have two
+// H2D engines, so two streams are enough to saturate the PCIe link.
+constexpr size_t kNumCopyStreams = 2;
+
+// Transfers larger than this are split into chunks of this size so a single
+// big tensor can also make use of both engines.
+constexpr size_t kCopyChunkBytes = 32 * 1024 * 1024;
+
+} // namespace
+
+void batched_copy_(TensorList dsts, TensorList srcs) {
+  TORCH_CHECK(
+      dsts.size() == srcs.size(),
+      "batched_copy_: expected the same number of destination and source "
+      "tensors, got ",
+      dsts.size(),
+      " and ",
+      srcs.size());
+  if (dsts.empty()) {
+    return;
+  }
+
+  const auto device = dsts[0].device();
+  TORCH_CHECK(
+      device.is_cuda(), "batched_copy_: destinations must be CUDA tensors");
+  for (const auto i : c10::irange(dsts.size())) {
+    const auto& dst = dsts[i];
+    const auto& src = srcs[i];
+    TORCH_CHECK(
+        dst.device() == device,
+        "batched_copy_: all destinations must be on one device, got ",
+        dst.device(),
+        " and ",
+        device);
+    TORCH_CHECK(
+        src.device().is_cpu() && src.is_pinned(),
+        "batched_copy_: sources must be pinned CPU tensors");
+    TORCH_CHECK(
+        dst.is_contiguous() && src.is_contiguous(),
+        "batched_copy_: tensors must be contiguous");
+    TORCH_CHECK(
+        dst.scalar_type() == src.scalar_type() && dst.sizes() == src.sizes(),
+        "batched_copy_: destination and source ",
+        i,
+        " must match in dtype and shape");
+  }
+
+  CUDAGuard device_guard(device);
+  const auto current_stream = getCurrentCUDAStream();
+
+  std::array<CUDAStream, kNumCopyStreams> copy_streams = {
+      getStreamFromPool(/*isHighPriority=*/false, device.index()),
+      getStreamFromPool(/*isHighPriority=*/false, device.index())};
+
+  // Fork: the transfers must not overtake work already queued on the current
+  // stream (e.g. a kernel still producing into a dst).
+  CUDAEvent fork_event;
+  fork_event.record(current_stream);
+  for (const auto& stream : copy_streams) {
+    fork_event.block(stream);
+  }
+
+  // Greedily hand each chunk to the stream with the fewest bytes queued so
+  // far; with two streams this keeps both copy engines busy even when the
+  // batch mixes tiny and large tensors.
+  std::array<size_t, kNumCopyStreams> queued_bytes{};
+  for (const auto i : c10::irange(dsts.size())) {
+    auto* dst_ptr = static_cast<char*>(dsts[i].data_ptr());
+    auto* src_ptr = static_cast<const char*>(srcs[i].const_data_ptr());
+    auto* ctx = srcs[i].storage().data_ptr().get_context();
+    size_t remaining = dsts[i].nbytes();
+    size_t offset = 0;
+    while (remaining > 0) {
+      const size_t chunk = std::min(remaining, kCopyChunkBytes);
+      size_t target = 0;
+      for (const auto s : c10::irange(size_t(1), kNumCopyStreams)) {
+        if (queued_bytes[s] < queued_bytes[target]) {
+          target = s;
+        }
+      }
+      const auto& stream = copy_streams[target];
+      AT_CUDA_CHECK(cudaMemcpyAsync(
+          dst_ptr + offset,
+          src_ptr + offset,
+          chunk,
+          cudaMemcpyHostToDevice,
+          stream));
+      // Keep the caching host allocator from handing the pinned source out
+      // again before this chunk's engine has read it. See the comment in
+      // copy_kernel_cuda for why ptr and ctx can differ.
+      CachingHostAllocator_recordEvent(
+          const_cast<char*>(src_ptr), ctx, stream);
+      queued_bytes[target] += chunk;
+      offset += chunk;
+      remaining -= chunk;
+    }
+  }
+
+  // Join: later work on the current stream sees all transfers as complete.
+  for (const auto& stream : copy_streams) {
+    CUDAEvent join_event;
+    join_event.record(stream);
+    join_event.block(current_stream);
+  }
+}
+
+} // namespace at::cuda
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <c10/macros/Macros.h>
+
+namespace at::cuda {
+
+// Copies a batch of pinned CPU tensors to CUDA tensors in one call.
+//
+// copy_() issues a single cudaMemcpyAsync per tensor on the current stream,
+// so a long list of small host-to-device copies serializes on one copy
+// engine. batched_copy_ instead fans the transfers out over a pair of side
+// streams (one per copy engine), splitting large tensors into chunks so both
+// engines stay busy, and joins the side streams back to the current stream
+// with events. To the caller it is as asynchronous as a non_blocking copy_:
+// ordering with respect to work on the current stream is preserved, and the
+// pinned sources are protected from premature reuse via the caching host
+// allocator's recorded events.
+//
+// Requirements: dsts and srcs pair up elementwise; every dst is a contiguous
+// CUDA tensor on a single device and every src is a contiguous pinned CPU
+// tensor of the same dtype and shape as its dst.
+TORCH_CUDA_CPP_API void batched_copy_(TensorList dsts, TensorList srcs);
+
+} // namespace at::cuda
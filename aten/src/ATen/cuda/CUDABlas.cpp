@@ -14,6 +14,9 @@
 #include <c10/util/env.h>
 #include <c10/util/irange.h>
 
+#include <fstream>
+#include <sstream>
+
 #ifdef USE_ROCM
 #include <hipblaslt/hipblaslt-ext.hpp>
 // until hipblas has an API to accept flags, we must use rocblas here
@@ -318,6 +321,147 @@ class CuBlasLtMatmulPreference : public CuBlasLtDescriptor<
     TORCH_CUDABLAS_CHECK(::cublasLtMatmulPreferenceSetAttribute(descriptor(), attr, &value, sizeof(T)));
   }
 };
+
+#ifndef USE_ROCM
+// Persists cuBLASLt heuristic picks across process restarts, so services that
+// redeploy frequently don't re-pay algorithm search warmup for GEMM shapes
+// they run every step. Enabled by pointing
+// PYTORCH_CUBLASLT_HEURISTIC_FILENAME at a cache file; analogous in spirit to
+// the TunableOp result files (see tunable/Tunable.h) but storing the opaque
+// cublasLtMatmulAlgo_t blob instead of a kernel name, since the default path
+// never enumerates named candidates. Blobs are only meaningful to the
+// cuBLASLt version that produced them, so the file carries the library
+// version as a validator and is discarded on mismatch; cached blobs are
+// additionally re-checked against the problem via cublasLtMatmulAlgoCheck
+// before use.
+class CuBlasLtAlgoCache {
+ public:
+  static CuBlasLtAlgoCache& instance() {
+    // Leaked so lookups during exit handlers don't race destruction.
+    static auto* cache = new CuBlasLtAlgoCache();
+    return *cache;
+  }
+
+  static bool enabled() {
+    static bool enabled =
+        c10::utils::has_env("PYTORCH_CUBLASLT_HEURISTIC_FILENAME");
+    return enabled;
+  }
+
+  bool find(const std::string& key, cublasLtMatmulAlgo_t* algo) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end()) {
+      return false;
+    }
+    *algo = it->second;
+    return true;
+  }
+
+  void insert(const std::string& key, const cublasLtMatmulAlgo_t& algo) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (entries_.emplace(key, algo).second && out_.is_open()) {
+      // Flush per entry so a crash mid-run still leaves a usable cache.
+      out_ << key << '|' << serialize(algo) << std::endl;
+    }
+  }
+
+ private:
+  CuBlasLtAlgoCache() {
+    auto filename = c10::utils::get_env("PYTORCH_CUBLASLT_HEURISTIC_FILENAME");
+    if (!filename.has_value() || filename->empty()) {
+      return;
+    }
+    const auto version = std::to_string(cublasLtGetVersion());
+    const bool valid = load(*filename, version);
+    if (!valid) {
+      entries_.clear();
+    }
+    out_.open(*filename, valid ? std::ios_base::app : std::ios_base::trunc);
+    if (out_.is_open() && !valid) {
+      out_ << kValidatorTag << '|' << version << std::endl;
+    }
+  }
+
+  // Returns true iff the file exists and was written by the same cuBLASLt
+  // version. Malformed lines are skipped rather than failing the load.
+  bool load(const std::string& filename, const std::string& version) {
+    std::ifstream in(filename);
+    if (!in.is_open()) {
+      return false;
+    }
+    std::string line;
+    if (!std::getline(in, line) ||
+        line != std::string(kValidatorTag) + "|" + version) {
+      return false;
+    }
+    while (std::getline(in, line)) {
+      const auto pos = line.rfind('|');
+      cublasLtMatmulAlgo_t algo;
+      if (pos == std::string::npos || !deserialize(line.substr(pos + 1), &algo)) {
+        continue;
+      }
+      entries_.emplace(line.substr(0, pos), algo);
+    }
+    return true;
+  }
+
+  static std::string serialize(const cublasLtMatmulAlgo_t& algo) {
+    static const char* hex = "0123456789abcdef";
+    const auto* bytes = reinterpret_cast<const unsigned char*>(&algo);
+    std::string out;
+    out.reserve(2 * sizeof(algo));
+    for (const auto i : c10::irange(sizeof(algo))) {
+      out.push_back(hex[bytes[i] >> 4]);
+      out.push_back(hex[bytes[i] & 0xf]);
+    }
+    return out;
+  }
+
+  static bool deserialize(const std::string& s, cublasLtMatmulAlgo_t* algo) {
+    if (s.size() != 2 * sizeof(*algo)) {
+      return false;
+    }
+    auto nibble = [](char c) -> int {
+      if (c >= '0' && c <= '9') {
+        return c - '0';
+      }
+      if (c >= 'a' && c <= 'f') {
+        return c - 'a' + 10;
+      }
+      return -1;
+    };
+    auto* bytes = reinterpret_cast<unsigned char*>(algo);
+    for (const auto i : c10::irange(sizeof(*algo))) {
+      const int hi = nibble(s[2 * i]);
+      const int lo = nibble(s[2 * i + 1]);
+      if (hi < 0 || lo < 0) {
+        return false;
+      }
+      bytes[i] = static_cast<unsigned char>((hi << 4) | lo);
+    }
+    return true;
+  }
+
+  static constexpr const char* kValidatorTag = "CUBLASLT_VERSION";
+
+  std::mutex mutex_;
+  std::unordered_map<std::string, cublasLtMatmulAlgo_t> entries_;
+  std::ofstream out_;
+};
+
+// Builds the cache key for one Lt matmul problem. The device name is part of
+// the key so one file can serve a heterogeneous fleet; everything that feeds
+// the heuristic query (operation, types, shapes, strides, epilogue,
+// workspace, alignments) must be passed by the caller.
+template <typename... Args>
+std::string lt_algo_cache_key(const char* op, Args... args) {
+  std::ostringstream oss;
+  oss << op << '-' << at::cuda::getCurrentDeviceProperties()->name;
+  ((oss << '-' << args), ...);
+  return oss.str();
+}
+#endif
 } // namespace
 
 
@@ -395,19 +539,71 @@ inline void bgemm_internal_cublaslt(CUDABLAS_BGEMM_ARGTYPES(Dtype)) {
 
   cublasLtMatmulHeuristicResult_t heuristicResult = {};
   int returnedResult = 0;
-  TORCH_CUDABLAS_CHECK(cublasLtMatmulAlgoGetHeuristic(
-      ltHandle,
-      computeDesc.descriptor(),
-      Adesc.descriptor(),
-      Bdesc.descriptor(),
-      Cdesc.descriptor(),
-      Cdesc.descriptor(),
-      preference.descriptor(),
-      1,
-      &heuristicResult,
-      &returnedResult));
-  if (returnedResult == 0) {
-    TORCH_CUDABLAS_CHECK(CUBLAS_STATUS_NOT_SUPPORTED);
+#ifndef USE_ROCM
+  bool found_cached_algo = false;
+  std::string algo_cache_key;
+  if (CuBlasLtAlgoCache::enabled()) {
+    algo_cache_key = lt_algo_cache_key(
+        "bgemm",
+        abcType,
+        computeType,
+        opa,
+        opb,
+        m,
+        n,
+        k,
+        lda,
+        ldb,
+        ldc,
+        num_batches,
+        stridea,
+        strideb,
+        stridec,
+        workspaceSize,
+        a_alignment,
+        b_alignment,
+        c_alignment);
+    cublasLtMatmulAlgo_t cached_algo{};
+    if (CuBlasLtAlgoCache::instance().find(algo_cache_key, &cached_algo)) {
+      // A cached blob can go stale (e.g. driver update with the same library
+      // version); let cuBLASLt vet it rather than trusting it blindly.
+      found_cached_algo =
+          cublasLtMatmulAlgoCheck(
+              ltHandle,
+              computeDesc.descriptor(),
+              Adesc.descriptor(),
+              Bdesc.descriptor(),
+              Cdesc.descriptor(),
+              Cdesc.descriptor(),
+              &cached_algo,
+              &heuristicResult) == CUBLAS_STATUS_SUCCESS;
+      if (found_cached_algo) {
+        heuristicResult.algo = cached_algo;
+      }
+    }
+  }
+  if (!found_cached_algo)
+#endif
+  {
+    TORCH_CUDABLAS_CHECK(cublasLtMatmulAlgoGetHeuristic(
+        ltHandle,
+        computeDesc.descriptor(),
+        Adesc.descriptor(),
+        Bdesc.descriptor(),
+        Cdesc.descriptor(),
+        Cdesc.descriptor(),
+        preference.descriptor(),
+        1,
+        &heuristicResult,
+        &returnedResult));
+    if (returnedResult == 0) {
+      TORCH_CUDABLAS_CHECK(CUBLAS_STATUS_NOT_SUPPORTED);
+    }
+#ifndef USE_ROCM
+    if (CuBlasLtAlgoCache::enabled()) {
+      CuBlasLtAlgoCache::instance().insert(algo_cache_key, heuristicResult.algo);
+    }
+#endif
   }
 
   cublasStatus_t cublasStatus = cublasLtMatmul(
@@ -1287,19 +1483,67 @@ void gemm_and_bias(
   cublasLtMatmulHeuristicResult_t heuristicResult = {};
   int returnedResult = 0;
   cublasLtHandle_t ltHandle = at::cuda::getCurrentCUDABlasLtHandle();
-  TORCH_CUDABLAS_CHECK(cublasLtMatmulAlgoGetHeuristic(
-      ltHandle,
-      computeDesc.descriptor(),
-      Adesc.descriptor(),
-      Bdesc.descriptor(),
-      Cdesc.descriptor(),
-      Cdesc.descriptor(),
-      preference.descriptor(),
-      1,
-      &heuristicResult,
-      &returnedResult));
-  if (returnedResult == 0) {
-    TORCH_CUDABLAS_CHECK(CUBLAS_STATUS_NOT_SUPPORTED);
+#ifndef USE_ROCM
+  bool found_cached_algo = false;
+  std::string algo_cache_key;
+  if (CuBlasLtAlgoCache::enabled()) {
+    algo_cache_key = lt_algo_cache_key(
+        "gemm_and_bias",
+        abcType,
+        computeType,
+        transa,
+        transb,
+        m,
+        n,
+        k,
+        mat1_ld,
+        mat2_ld,
+        result_ld,
+        bias != nullptr ? epilogue : 0,
+        workspaceSize,
+        a_alignment,
+        b_alignment,
+        c_alignment,
+        d_alignment);
+    cublasLtMatmulAlgo_t cached_algo{};
+    if (CuBlasLtAlgoCache::instance().find(algo_cache_key, &cached_algo)) {
+      found_cached_algo =
+          cublasLtMatmulAlgoCheck(
+              ltHandle,
+              computeDesc.descriptor(),
+              Adesc.descriptor(),
+              Bdesc.descriptor(),
+              Cdesc.descriptor(),
+              Cdesc.descriptor(),
+              &cached_algo,
+              &heuristicResult) == CUBLAS_STATUS_SUCCESS;
+      if (found_cached_algo) {
+        heuristicResult.algo = cached_algo;
+      }
+    }
+  }
+  if (!found_cached_algo)
+#endif
+  {
+    TORCH_CUDABLAS_CHECK(cublasLtMatmulAlgoGetHeuristic(
+        ltHandle,
+        computeDesc.descriptor(),
+        Adesc.descriptor(),
+        Bdesc.descriptor(),
+        Cdesc.descriptor(),
+        Cdesc.descriptor(),
+        preference.descriptor(),
+        1,
+        &heuristicResult,
+        &returnedResult));
+    if (returnedResult == 0) {
+      TORCH_CUDABLAS_CHECK(CUBLAS_STATUS_NOT_SUPPORTED);
+    }
+#ifndef USE_ROCM
+    if (CuBlasLtAlgoCache::enabled()) {
+      CuBlasLtAlgoCache::instance().insert(algo_cache_key, heuristicResult.algo);
+    }
+#endif
   }
 
   cublasStatus_t cublasStatus = cublasLtMatmul(
@@ -1473,6 +1717,47 @@ void scaled_gemm(
   cublasLtMatmulHeuristicResult_t heuristicResult = {};
   int returnedResult = 0;
   cublasLtHandle_t ltHandle = at::cuda::getCurrentCUDABlasLtHandle();
+#ifndef USE_ROCM
+  bool found_cached_algo = false;
+  std::string algo_cache_key;
+  if (CuBlasLtAlgoCache::enabled()) {
+    algo_cache_key = lt_algo_cache_key(
+        "scaled_gemm",
+        ScalarTypeToCudaDataType(mat1_dtype),
+        ScalarTypeToCudaDataType(mat2_dtype),
+        ScalarTypeToCudaDataType(bias_dtype),
+        ScalarTypeToCudaDataType(result_dtype),
+        transa,
+        transb,
+        m,
+        n,
+        k,
+        mat1_ld,
+        mat2_ld,
+        result_ld,
+        fastAccuMode,
+        bias_ptr != nullptr,
+        result_scale_ptr != nullptr,
+        workspaceSize);
+    cublasLtMatmulAlgo_t cached_algo{};
+    if (CuBlasLtAlgoCache::instance().find(algo_cache_key, &cached_algo)) {
+      found_cached_algo =
+          cublasLtMatmulAlgoCheck(
+              ltHandle,
+              computeDesc.descriptor(),
+              Adesc.descriptor(),
+              Bdesc.descriptor(),
+              Cdesc.descriptor(),
+              Ddesc.descriptor(),
+              &cached_algo,
+              &heuristicResult) == CUBLAS_STATUS_SUCCESS;
+      if (found_cached_algo) {
+        heuristicResult.algo = cached_algo;
+      }
+    }
+  }
+  if (!found_cached_algo) {
+#endif
   TORCH_CUDABLAS_CHECK(cublasLtMatmulAlgoGetHeuristic(
       ltHandle,
       computeDesc.descriptor(),
@@ -1532,6 +1817,12 @@ void scaled_gemm(
     TORCH_CHECK(found, "could not find valid hipblaslt solution");
 #endif
   }
+#ifndef USE_ROCM
+    if (CuBlasLtAlgoCache::enabled()) {
+      CuBlasLtAlgoCache::instance().insert(algo_cache_key, heuristicResult.algo);
+    }
+  }
+#endif
   cublasStatus_t cublasStatus = cublasLtMatmul(
       ltHandle,
       computeDesc.descriptor(),
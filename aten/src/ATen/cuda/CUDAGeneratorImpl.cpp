@@ -7,6 +7,7 @@
 #include <c10/core/StreamGuard.h>
 #include <c10/cuda/CUDAFunctions.h>
 #include <c10/util/CallOnce.h>
+#include <c10/util/env.h>
 #include <deque>
 
 namespace at {
@@ -139,6 +140,11 @@ void CUDAGeneratorState::register_graph(cuda::CUDAGraph* graph) {
     auto options = at::TensorOptions().device(at::kCUDA).dtype(at::kLong);
     seed_extragraph_ = at::empty({1}, options);
     offset_extragraph_ = at::empty({1}, options);
+    if (CUDAGeneratorImpl::graph_device_offsets_enabled()) {
+      // See Note [Self-incrementing RNG offsets under CUDA Graphs]
+      graph_offset_slots_ = at::empty({kGraphOffsetSlots}, options);
+      wholegraph_increment_ = at::empty({1}, options);
+    }
   }
 
   // Insert the graph into the set of registered graphs if it's not already
@@ -165,6 +171,8 @@ void CUDAGeneratorState::unregister_graph(cuda::CUDAGraph* graph) {
   if (registered_graphs_.empty()) {
     seed_extragraph_.reset();
     offset_extragraph_.reset();
+    graph_offset_slots_.reset();
+    wholegraph_increment_.reset();
   }
 }
 
@@ -195,6 +203,12 @@ void CUDAGeneratorState::capture_prologue() {
   offset_intragraph_ = 0;
   seed_extragraph_.fill_(int64_t(seed_));
   offset_extragraph_.fill_(int64_t(0));
+  if (graph_offset_slots_.defined()) {
+    // Seed every slot with the current offset; from here on the slots advance
+    // on the device, see Note [Self-incrementing RNG offsets under CUDA Graphs]
+    graph_offset_slots_.fill_(int64_t(philox_offset_per_thread_));
+    used_graph_offset_slots_ = 0;
+  }
 }
 
 /**
@@ -203,6 +217,11 @@ void CUDAGeneratorState::capture_prologue() {
  */
 uint64_t CUDAGeneratorState::capture_epilogue() {
   capturing_ = false;
+  if (used_graph_offset_slots_ > 0) {
+    // Capture has ended, so this fill_ runs eagerly; the captured bump
+    // kernels read this word on every replay.
+    wholegraph_increment_.fill_(int64_t(offset_intragraph_));
+  }
   return offset_intragraph_;
 }
 
@@ -461,6 +480,68 @@ PhiloxCudaState CUDAGeneratorImpl::philox_cuda_state(uint64_t increment) {
   }
 }
 
+/**
+ * Note [Self-incrementing RNG offsets under CUDA Graphs]
+ * ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+ * The standard capture scheme (see Note [CUDA Graph-safe RNG states]) needs
+ * host work before every replay: replay_prologue refills the extragraph
+ * offset tensor from the host-side philox offset. When a graph is replayed
+ * without that host intervention (e.g. launched repeatedly from another
+ * graph, or driven by an external scheduler), every replay would reuse the
+ * capture-time offsets and produce identical "randomness".
+ *
+ * With PYTORCH_CUDA_GRAPH_DEVICE_RNG_OFFSET set, RNG consumers can instead
+ * ask for a PhiloxCudaState whose extragraph offset pointer refers to a
+ * dedicated device slot. Slots are filled with the generator's current
+ * offset in capture_prologue (outside capture), and after its consumer
+ * kernel the caller captures a trivial bump kernel that does
+ *   *offset_slot += *wholegraph_increment;
+ * where *wholegraph_increment is written once, eagerly, in capture_epilogue.
+ * Replay r therefore sees offset base + r * wholegraph_increment, matching
+ * what replay_prologue would have produced, with no host work at all. The
+ * bump is a separate graph node ordered after the consumer, so readers never
+ * race the increment.
+ *
+ * Caveat: the device slots cannot observe eager RNG use interleaved between
+ * replays, so bitwise equivalence with eager execution only holds when the
+ * generator is not consumed outside the graph while it is being replayed.
+ */
+PhiloxCudaState CUDAGeneratorImpl::philox_cuda_state_with_device_offset(
+    uint64_t increment,
+    int64_t** offset_slot,
+    const int64_t** wholegraph_increment) {
+  TORCH_CHECK(
+      at::cuda::currentStreamCaptureStatus() != at::cuda::CaptureStatus::None,
+      "philox_cuda_state_with_device_offset is only meaningful during graph "
+      "capture; use philox_cuda_state instead.");
+  TORCH_CHECK(
+      state_->graph_offset_slots_.defined(),
+      "Device-side RNG offset slots were not allocated for this generator. "
+      "PYTORCH_CUDA_GRAPH_DEVICE_RNG_OFFSET must be set before the generator "
+      "is registered to a graph.");
+  TORCH_CHECK(
+      state_->used_graph_offset_slots_ < CUDAGeneratorState::kGraphOffsetSlots,
+      "This capture exhausted all ",
+      CUDAGeneratorState::kGraphOffsetSlots,
+      " device-side RNG offset slots; unset "
+      "PYTORCH_CUDA_GRAPH_DEVICE_RNG_OFFSET to fall back to host-managed "
+      "offsets.");
+  uint32_t offset = state_->offset_intragraph_;
+  state_->increase(increment);
+  auto* slot = state_->graph_offset_slots_.data_ptr<int64_t>() +
+      state_->used_graph_offset_slots_++;
+  *offset_slot = slot;
+  *wholegraph_increment = state_->wholegraph_increment_.data_ptr<int64_t>();
+  return PhiloxCudaState(
+      state_->seed_extragraph_.data_ptr<int64_t>(), slot, offset);
+}
+
+bool CUDAGeneratorImpl::graph_device_offsets_enabled() {
+  static bool enabled =
+      c10::utils::has_env("PYTORCH_CUDA_GRAPH_DEVICE_RNG_OFFSET");
+  return enabled;
+}
+
 /**
  * Temporarily accommodates call sites that use philox_engine_inputs.
  * Allows incremental refactor of call sites to use philox_cuda_state.
@@ -95,6 +95,11 @@ struct CUDAGraph;
  */
 
 struct CUDAGeneratorState : public c10::intrusive_ptr_target {
+  // Number of device-side offset slots preallocated per generator for
+  // self-incrementing captures, see
+  // Note [Self-incrementing RNG offsets under CUDA Graphs].
+  static constexpr uint32_t kGraphOffsetSlots = 512;
+
   uint64_t seed_;
   uint64_t philox_offset_per_thread_;
   uint32_t offset_intragraph_;
@@ -102,6 +107,9 @@ struct CUDAGeneratorState : public c10::intrusive_ptr_target {
   std::unordered_set<cuda::CUDAGraph*> registered_graphs_;
   at::TensorBase seed_extragraph_{};
   at::TensorBase offset_extragraph_{};
+  at::TensorBase graph_offset_slots_{};
+  at::TensorBase wholegraph_increment_{};
+  uint32_t used_graph_offset_slots_{};
 
   CUDAGeneratorState(
       uint64_t seed = default_rng_seed_val,
@@ -154,6 +162,19 @@ struct TORCH_CUDA_CPP_API CUDAGeneratorImpl : public c10::GeneratorImpl {
   // current state
   PhiloxCudaState philox_cuda_state(uint64_t increment);
 
+  // Capture-only variant whose offset advances on the device rather than via
+  // the host replay prologue. Hands back the device words the consumer must
+  // bump after its kernel, see
+  // Note [Self-incrementing RNG offsets under CUDA Graphs].
+  PhiloxCudaState philox_cuda_state_with_device_offset(
+      uint64_t increment,
+      int64_t** offset_slot,
+      const int64_t** wholegraph_increment);
+
+  // Whether PYTORCH_CUDA_GRAPH_DEVICE_RNG_OFFSET is set; gates allocation of
+  // the device-side offset slots and their use by consumer kernels.
+  static bool graph_device_offsets_enabled();
+
   bool reset_rnn_state() {
     return !no_reset_rnn_state_.test_and_set();
   }
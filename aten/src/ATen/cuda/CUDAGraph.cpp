@@ -313,4 +313,204 @@ CUDAGraph::~CUDAGraph() {
   reset();
 }
 
+CUDAGraphPool::CUDAGraphPool() : mempool_id_(graph_pool_handle()) {}
+
+CUDAGraphPool::ShapeKey CUDAGraphPool::key_for(TensorList inputs) {
+  ShapeKey key;
+  for (const auto& input : inputs) {
+    if (!input.defined()) {
+      key.push_back(-1);
+      continue;
+    }
+    key.push_back(input.dim());
+    for (const auto size : input.sizes()) {
+      key.push_back(size);
+    }
+  }
+  return key;
+}
+
+void CUDAGraphPool::capture_begin(ShapeKey key, cudaStreamCaptureMode capture_mode) {
+  TORCH_CHECK(!capturing_graph_,
+              "CUDAGraphPool::capture_begin called while another capture on this "
+              "pool is still open. Call capture_end first.");
+  TORCH_CHECK(graphs_.find(key) == graphs_.end(),
+              "This CUDAGraphPool already owns a graph for the given shape key. "
+              "To recapture a shape variant, create a new pool.");
+  capturing_graph_ = std::make_unique<CUDAGraph>();
+  capturing_key_ = std::move(key);
+  capturing_graph_->capture_begin(mempool_id_, capture_mode);
+}
+
+void CUDAGraphPool::capture_end() {
+  TORCH_CHECK(capturing_graph_,
+              "CUDAGraphPool::capture_end called without a preceding capture_begin.");
+  capturing_graph_->capture_end();
+  // Sampling the pool size at each variant's capture_end gives the upper
+  // bound on what this variant would have reserved in an exclusive pool; the
+  // running sum backs the amortization estimate in stats().
+  exclusive_reserved_bytes_ += pool_reserved_bytes();
+  graphs_.emplace(std::move(capturing_key_), std::move(capturing_graph_));
+}
+
+void CUDAGraphPool::replay(const ShapeKey& key) {
+  auto it = graphs_.find(key);
+  TORCH_CHECK(it != graphs_.end(),
+              "CUDAGraphPool::replay called with a shape key that has no captured "
+              "graph. This pool holds ", graphs_.size(), " shape variant(s); capture "
+              "the missing variant with capture_begin/capture_end before replaying.");
+  it->second->replay();
+}
+
+bool CUDAGraphPool::has_graph(const ShapeKey& key) const {
+  return graphs_.find(key) != graphs_.end();
+}
+
+size_t CUDAGraphPool::num_graphs() const {
+  return graphs_.size();
+}
+
+MempoolId_t CUDAGraphPool::pool() const {
+  return mempool_id_;
+}
+
+size_t CUDAGraphPool::pool_reserved_bytes() const {
+  size_t reserved = 0;
+  for (const auto& segment : c10::cuda::CUDACachingAllocator::snapshot().segments) {
+    if (segment.owner_private_pool_id == mempool_id_) {
+      reserved += segment.total_size;
+    }
+  }
+  return reserved;
+}
+
+CUDAGraphPoolStats CUDAGraphPool::stats() const {
+  CUDAGraphPoolStats stats;
+  stats.num_graphs = graphs_.size();
+  stats.pool_reserved_bytes = pool_reserved_bytes();
+  stats.exclusive_reserved_bytes = exclusive_reserved_bytes_;
+  return stats;
+}
+
+CUDALaunchBatch::CUDALaunchBatch()
+    // CUDAStreams may not be default-constructed.
+    : capture_stream_(at::cuda::getCurrentCUDAStream()),
+      mempool_id_(c10::cuda::MemPool::graph_pool_handle(false)) {}
+
+void CUDALaunchBatch::begin() {
+  TORCH_CHECK(!recording_,
+              "CUDALaunchBatch::begin called while a batch is already being recorded. "
+              "Call flush first.");
+
+  auto stream = at::cuda::getCurrentCUDAStream();
+  TORCH_CHECK(stream != at::cuda::getDefaultCUDAStream(),
+              "Launch batches must be recorded on a non-default stream.");
+  capture_stream_ = stream;
+  capture_dev_ = c10::cuda::current_device();
+
+  // Allocations made inside the region must come from a private pool to be
+  // legal during capture; every recording of this batch shares one pool.
+  // See the addendum in CUDAGraph::capture_begin for why this precedes
+  // cudaStreamBeginCapture.
+  c10::cuda::CUDACachingAllocator::beginAllocateToPool(capture_dev_, mempool_id_, [this](cudaStream_t stream) {
+      cudaStreamCaptureStatus status;
+      CaptureId_t stream_capture_id = 0;
+      AT_CUDA_CHECK(cudaStreamGetCaptureInfo(stream, &status, &stream_capture_id));
+      return status == cudaStreamCaptureStatus::cudaStreamCaptureStatusActive && stream_capture_id == capture_id_;
+  });
+  used_pool_ = true;
+
+  // Relaxed mode: the recorded region is ordinary eager code, and other
+  // threads (allocator, watchdogs) may legally touch the CUDA API while the
+  // recording is open.
+  AT_CUDA_CHECK(cudaStreamBeginCapture(capture_stream_, cudaStreamCaptureModeRelaxed));
+
+  cudaStreamCaptureStatus status;
+  AT_CUDA_CHECK(cudaStreamGetCaptureInfo(capture_stream_, &status, &capture_id_));
+  TORCH_INTERNAL_ASSERT(status == cudaStreamCaptureStatus::cudaStreamCaptureStatusActive);
+  recording_ = true;
+}
+
+void CUDALaunchBatch::flush() {
+  TORCH_CHECK(recording_,
+              "CUDALaunchBatch::flush called without a preceding begin.");
+  auto stream = at::cuda::getCurrentCUDAStream();
+  TORCH_CHECK(stream == capture_stream_,
+              "A batch must be flushed on the same stream it was recorded on.");
+
+  cudaGraph_t graph = nullptr;
+  AT_CUDA_CHECK(cudaStreamEndCapture(capture_stream_, &graph));
+  c10::cuda::CUDACachingAllocator::endAllocateToPool(capture_dev_, mempool_id_);
+  recording_ = false;
+  TORCH_CHECK(graph != nullptr, "Invalid capture.");
+
+  // Patch the cached executable graph in place when the recorded topology
+  // still matches the previous flush; exec updates are much cheaper than
+  // instantiation. A failed update (shapes or control flow changed) falls
+  // back to instantiating from scratch.
+  bool updated = false;
+  if (graph_exec_ != nullptr) {
+#if (defined(CUDA_VERSION) && CUDA_VERSION >= 12000)
+    cudaGraphExecUpdateResultInfo update_info{};
+    updated = cudaGraphExecUpdate(graph_exec_, graph, &update_info) == cudaSuccess;
+#else
+    cudaGraphNode_t error_node = nullptr;
+    cudaGraphExecUpdateResult update_result{};
+    updated = cudaGraphExecUpdate(graph_exec_, graph, &error_node, &update_result) == cudaSuccess;
+#endif
+    if (!updated) {
+      // Consume the error the failed update left behind.
+      (void)cudaGetLastError();
+      AT_CUDA_CHECK(cudaGraphExecDestroy(graph_exec_));
+      graph_exec_ = nullptr;
+    }
+  }
+  if (updated) {
+    num_updates_++;
+  } else {
+    // See the instantiation notes in CUDAGraph::capture_end.
+#if (defined(CUDA_VERSION) && CUDA_VERSION >= 11040)
+    int version = 0;
+    AT_CUDA_CHECK(cudaDriverGetVersion(&version));
+    if (version < 11040) {
+#endif
+#if (defined(CUDA_VERSION) && CUDA_VERSION >= 12000)
+      AT_CUDA_CHECK(cudaGraphInstantiate(&graph_exec_, graph, 0));
+#else
+      AT_CUDA_CHECK(cudaGraphInstantiate(&graph_exec_, graph, NULL, NULL, 0));
+#endif
+#if (defined(CUDA_VERSION) && CUDA_VERSION >= 11040)
+    } else {
+      AT_CUDA_CHECK(cudaGraphInstantiateWithFlags(&graph_exec_,
+                                                  graph,
+                                                  cudaGraphInstantiateFlagAutoFreeOnLaunch));
+    }
+#endif
+    num_instantiations_++;
+  }
+  AT_CUDA_CHECK(cudaGraphDestroy(graph));
+
+  AT_CUDA_CHECK(cudaGraphLaunch(graph_exec_, capture_stream_));
+}
+
+CUDALaunchBatch::~CUDALaunchBatch() {
+  if (recording_) {
+    // Abandon the open recording; the stream must still be taken out of
+    // capture mode. Warnings instead of exceptions for the same reason as
+    // CUDAGraph::reset.
+    cudaGraph_t graph = nullptr;
+    C10_CUDA_CHECK_WARN(cudaStreamEndCapture(capture_stream_, &graph));
+    c10::cuda::CUDACachingAllocator::endAllocateToPool(capture_dev_, mempool_id_);
+    if (graph != nullptr) {
+      C10_CUDA_CHECK_WARN(cudaGraphDestroy(graph));
+    }
+  }
+  if (graph_exec_ != nullptr) {
+    C10_CUDA_CHECK_WARN(cudaGraphExecDestroy(graph_exec_));
+  }
+  if (used_pool_) {
+    c10::cuda::CUDACachingAllocator::releasePool(capture_dev_, mempool_id_);
+  }
+}
+
 } // namespace at::cuda
@@ -5,6 +5,10 @@
 #include <c10/cuda/CUDAGraphsC10Utils.h>
 #include <c10/cuda/CUDAStream.h>
 #include <c10/util/flat_hash_map.h>
+#include <c10/util/hash.h>
+
+#include <memory>
+#include <vector>
 
 namespace at {
 
@@ -85,5 +89,144 @@ struct TORCH_CUDA_CPP_API CUDAGraph {
   int capture_dev_{};
 };
 
+// Memory accounting for a CUDAGraphPool, see CUDAGraphPool::stats().
+struct CUDAGraphPoolStats {
+  // Number of captured shape variants.
+  size_t num_graphs = 0;
+  // Bytes currently reserved by the shared private mempool.
+  size_t pool_reserved_bytes = 0;
+  // Sum over variants of the pool's reserved size at each variant's
+  // capture_end. This approximates what the variants would reserve if each
+  // had captured into its own exclusive pool; the difference to
+  // pool_reserved_bytes is the memory amortized by sharing.
+  size_t exclusive_reserved_bytes = 0;
+};
+
+// Owns a family of CUDAGraphs captured for different input-shape buckets
+// that all allocate from one shared private mempool, so N shape variants of
+// the same workload don't pay for N copies of the pool.
+//
+// Variants are keyed by an opaque shape key (see key_for). Capture each
+// variant with capture_begin(key)/capture_end() the same way a single
+// CUDAGraph is captured, then replay(key) selects the matching graph.
+//
+// Sharing a mempool across graphs is safe if the graphs are replayed in the
+// same order they were captured (see the note on CUDAGraph::mempool_id_);
+// the same caveat applies to the variants of a pool.
+struct TORCH_CUDA_CPP_API CUDAGraphPool {
+  using ShapeKey = std::vector<int64_t>;
+
+  CUDAGraphPool();
+
+  // Builds the lookup key for a set of graph inputs: each tensor contributes
+  // its rank followed by its sizes (or -1 for an undefined tensor), so
+  // distinct shape combinations cannot collide.
+  static ShapeKey key_for(TensorList inputs);
+
+  // Begins capturing a new shape variant for `key` on the current stream.
+  // The variant allocates from this pool's shared mempool.
+  void capture_begin(
+      ShapeKey key,
+      cudaStreamCaptureMode capture_mode = cudaStreamCaptureModeGlobal);
+  void capture_end();
+
+  // Replays the variant captured for `key`; throws if no such variant has
+  // been captured.
+  void replay(const ShapeKey& key);
+
+  bool has_graph(const ShapeKey& key) const;
+  size_t num_graphs() const;
+  MempoolId_t pool() const;
+  CUDAGraphPoolStats stats() const;
+
+ private:
+  struct ShapeKeyHash {
+    size_t operator()(const ShapeKey& key) const {
+      size_t seed = key.size();
+      for (const auto v : key) {
+        seed = c10::hash_combine(seed, static_cast<size_t>(v));
+      }
+      return seed;
+    }
+  };
+
+  size_t pool_reserved_bytes() const;
+
+  // uuid of the shared mempool, created eagerly via graph_pool_handle() so
+  // every variant's capture_begin can pass it along.
+  MempoolId_t mempool_id_;
+
+  ska::flat_hash_map<ShapeKey, std::unique_ptr<CUDAGraph>, ShapeKeyHash>
+      graphs_;
+
+  // Variant currently being captured; set between capture_begin and
+  // capture_end.
+  std::unique_ptr<CUDAGraph> capturing_graph_;
+  ShapeKey capturing_key_;
+
+  // Running total of the pool's reserved size sampled at each variant's
+  // capture_end, reported by stats().
+  size_t exclusive_reserved_bytes_ = 0;
+};
+
+// Scoped launch batching for eager mode. The kernel launches issued between
+// begin() and flush() are recorded via stream capture (relaxed mode) instead
+// of being submitted individually, and flush() hands the whole batch to the
+// driver with a single cudaGraphLaunch. Unlike a classic CUDA Graph the
+// region is re-recorded on every iteration, so data-dependent host control
+// flow between iterations is fine; the win is that hundreds of small kernel
+// submissions collapse into one. When the freshly recorded topology matches
+// the previous flush, the cached executable graph is patched in place with
+// cudaGraphExecUpdate, which is much cheaper than instantiation; when it
+// does not (shapes or control flow changed), flush() transparently falls
+// back to a fresh instantiation.
+//
+// Restrictions inherited from stream capture: the recorded region must not
+// synchronize with the host (results only materialize at flush()), must not
+// use CUDA RNG, and must run on a non-default stream.
+struct TORCH_CUDA_CPP_API CUDALaunchBatch {
+  CUDALaunchBatch();
+  ~CUDALaunchBatch();
+  CUDALaunchBatch(const CUDALaunchBatch&) = delete;
+  CUDALaunchBatch& operator=(const CUDALaunchBatch&) = delete;
+
+  // Starts recording launches from the current stream.
+  void begin();
+
+  // Stops recording and submits the batch with one graph launch,
+  // updating the cached executable graph in place when possible.
+  void flush();
+
+  bool is_recording() const {
+    return recording_;
+  }
+
+  // How many flushes were served by an in-place exec update vs. a full
+  // re-instantiation; useful to verify the fast path is actually taken.
+  int64_t num_updates() const {
+    return num_updates_;
+  }
+  int64_t num_instantiations() const {
+    return num_instantiations_;
+  }
+
+ private:
+  cudaGraphExec_t graph_exec_ = nullptr;
+
+  // Stream the open recording began on.
+  at::cuda::CUDAStream capture_stream_;
+  CaptureId_t capture_id_ = -1;
+  int capture_dev_{};
+
+  // Private mempool shared by all recordings of this batch, so allocations
+  // made inside the region are legal during capture.
+  MempoolId_t mempool_id_;
+  bool used_pool_ = false;
+
+  bool recording_ = false;
+  int64_t num_updates_ = 0;
+  int64_t num_instantiations_ = 0;
+};
+
 } // namespace cuda
 } // namespace at
@@ -7,8 +7,14 @@
 #include <c10/core/thread_pool.h>
 #include <c10/cuda/CUDAAllocatorConfig.h>
 
+#include <c10/util/flat_hash_map.h>
+
 #include <cuda_runtime_api.h>
+#include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <future>
+#include <thread>
 
 namespace at::cuda {
 namespace {
@@ -68,6 +74,160 @@ class EventPool {
 
 using Block = HostBlock<CUDAStream>;
 
+// PinnedSlabPool carves pinned host memory out of large preregistered
+// slabs with a buddy-style splitter instead of calling cudaHostAlloc per
+// block. This keeps variable-sized serving workloads off the ~ms-scale,
+// device-synchronizing cudaHostAlloc path once the slabs are warm. Frees
+// are pushed onto a pending list and a background thread merges buddies
+// back together, so fragmentation from shifting batch sizes heals over
+// time without adding work to the allocation path.
+// Enabled via PYTORCH_CUDA_ALLOC_CONF=pinned_use_slab_allocator:True.
+class PinnedSlabPool {
+ public:
+  static constexpr size_t kSlabSize = 64 * 1024 * 1024; // 64MB slabs
+  static constexpr size_t kMinBlockSize = 4096; // one page
+  static constexpr size_t kNumOrders = 15; // 4KB ... 64MB
+
+  ~PinnedSlabPool() {
+    {
+      std::lock_guard<std::mutex> g(mutex_);
+      shutdown_ = true;
+    }
+    cv_.notify_all();
+    if (coalesce_thread_.joinable()) {
+      coalesce_thread_.join();
+    }
+  }
+
+  // Returns nullptr when the request is too large to be carved out of a
+  // slab; the caller falls back to a dedicated cudaHostAlloc.
+  void* allocate(size_t size) {
+    if (size > kSlabSize) {
+      return nullptr;
+    }
+    const size_t order = order_for(size);
+    std::lock_guard<std::mutex> g(mutex_);
+    lazy_init_locked();
+    // Find the smallest free block that fits, splitting on the way down.
+    for (size_t o = order; o < kNumOrders; ++o) {
+      if (!free_lists_[o].empty()) {
+        char* ptr = free_lists_[o].back();
+        free_lists_[o].pop_back();
+        for (size_t split = o; split > order; --split) {
+          free_lists_[split - 1].push_back(
+              ptr + (kMinBlockSize << (split - 1)));
+        }
+        block_orders_[ptr] = order;
+        return ptr;
+      }
+    }
+    // No room: map in one more slab and retry (it satisfies any order).
+    if (!grow_locked()) {
+      return nullptr;
+    }
+    char* ptr = free_lists_[kNumOrders - 1].back();
+    free_lists_[kNumOrders - 1].pop_back();
+    for (size_t split = kNumOrders - 1; split > order; --split) {
+      free_lists_[split - 1].push_back(ptr + (kMinBlockSize << (split - 1)));
+    }
+    block_orders_[ptr] = order;
+    return ptr;
+  }
+
+  // Returns true iff ptr belongs to this pool.
+  bool free(void* ptr) {
+    std::lock_guard<std::mutex> g(mutex_);
+    auto it = block_orders_.find(static_cast<char*>(ptr));
+    if (it == block_orders_.end()) {
+      return false;
+    }
+    pending_frees_.emplace_back(it->first, it->second);
+    block_orders_.erase(it);
+    cv_.notify_one();
+    return true;
+  }
+
+ private:
+  size_t order_for(size_t size) const {
+    size_t order = 0;
+    while ((kMinBlockSize << order) < size) {
+      ++order;
+    }
+    return order;
+  }
+
+  void lazy_init_locked() {
+    if (!coalesce_thread_.joinable()) {
+      coalesce_thread_ = std::thread([this] { coalesce_loop(); });
+    }
+  }
+
+  bool grow_locked() {
+    void* slab = nullptr;
+    cudaError_t err = cudaHostAlloc(&slab, kSlabSize, cudaHostAllocDefault);
+    if (err != cudaSuccess) {
+      (void)cudaGetLastError(); // clear CUDA error
+      return false;
+    }
+    slabs_.push_back(static_cast<char*>(slab));
+    free_lists_[kNumOrders - 1].push_back(static_cast<char*>(slab));
+    return true;
+  }
+
+  const char* slab_base_locked(char* ptr) const {
+    for (char* slab : slabs_) {
+      if (ptr >= slab && ptr < slab + kSlabSize) {
+        return slab;
+      }
+    }
+    return nullptr;
+  }
+
+  // Drains pending frees and repeatedly merges buddy pairs so large
+  // contiguous blocks become available again for future big batches.
+  void coalesce_loop() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!shutdown_) {
+      cv_.wait(lock, [this] { return shutdown_ || !pending_frees_.empty(); });
+      while (!pending_frees_.empty()) {
+        auto [ptr, order] = pending_frees_.back();
+        pending_frees_.pop_back();
+        const char* base = slab_base_locked(ptr);
+        while (order + 1 < kNumOrders) {
+          const size_t block_size = kMinBlockSize << order;
+          // The buddy address flips the bit of this order within the slab.
+          char* buddy = const_cast<char*>(base) +
+              (((ptr - base) ^ block_size) & (kSlabSize - 1));
+          auto& list = free_lists_[order];
+          auto it = std::find(list.begin(), list.end(), buddy);
+          if (it == list.end()) {
+            break;
+          }
+          list.erase(it);
+          ptr = std::min(ptr, buddy);
+          ++order;
+        }
+        free_lists_[order].push_back(ptr);
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::thread coalesce_thread_;
+  bool shutdown_{false};
+  std::vector<char*> slabs_;
+  std::array<std::vector<char*>, kNumOrders> free_lists_;
+  ska::flat_hash_map<char*, size_t> block_orders_;
+  std::vector<std::pair<char*, size_t>> pending_frees_;
+};
+
+// Leaked on purpose: pinned slabs must outlive static destruction order.
+static PinnedSlabPool& pinned_slab_pool() {
+  static auto* pool = new PinnedSlabPool();
+  return *pool;
+}
+
 struct CUDACachingHostAllocatorImpl
     : public CachingHostAllocatorImpl<CUDAStream, EventPool::Event> {
  private:
@@ -85,7 +245,16 @@ struct CUDACachingHostAllocatorImpl
     }
 
     if (c10::cuda::CUDACachingAllocator::CUDAAllocatorConfig::
-            pinned_use_cuda_host_register()) {
+            pinned_use_slab_allocator()) {
+      // Carve from a preregistered pinned slab; oversized requests (or a
+      // failure to map a new slab) fall back to a dedicated cudaHostAlloc.
+      *ptr = pinned_slab_pool().allocate(size);
+      if (*ptr != nullptr) {
+        return;
+      }
+      C10_CUDA_CHECK(cudaHostAlloc(ptr, size, cudaHostAllocDefault));
+    } else if (c10::cuda::CUDACachingAllocator::CUDAAllocatorConfig::
+                   pinned_use_cuda_host_register()) {
       allocWithCudaHostRegister(ptr, size);
     } else {
       // Use cudaHostAlloc for allocating pinned memory (global lock in driver)
@@ -94,6 +263,11 @@ struct CUDACachingHostAllocatorImpl
   }
 
   void free_block(Block* block) override {
+    if (c10::cuda::CUDACachingAllocator::CUDAAllocatorConfig::
+            pinned_use_slab_allocator() &&
+        pinned_slab_pool().free(block->ptr_)) {
+      return;
+    }
     if (c10::cuda::CUDACachingAllocator::CUDAAllocatorConfig::
             pinned_use_cuda_host_register()) {
       void* ptr = block->ptr_;
@@ -0,0 +1,45 @@
+#include <ATen/cuda/CUDAContextLight.h>
+#include <ATen/cuda/ClockCalibration.h>
+
+#include <c10/cuda/CUDAException.h>
+#include <c10/cuda/CUDAStream.h>
+#include <c10/util/ApproximateClock.h>
+
+namespace at::cuda {
+namespace {
+__global__ void read_clock_kernel(int64_t* out) {
+#if defined(USE_ROCM)
+  *out = wall_clock64();
+#else
+  int64_t timestamp = 0;
+  asm volatile("mov.u64 %0, %%globaltimer;" : "=l"(timestamp));
+  *out = timestamp;
+#endif
+}
+} // namespace
+
+DeviceClockSample sample_device_clock() {
+  int64_t* pinned = nullptr;
+  C10_CUDA_CHECK(cudaHostAlloc(
+      reinterpret_cast<void**>(&pinned),
+      sizeof(int64_t),
+      cudaHostAllocMapped));
+  int64_t* device_ptr = nullptr;
+  C10_CUDA_CHECK(cudaHostGetDevicePointer(
+      reinterpret_cast<void**>(&device_ptr), pinned, 0));
+  // A pool stream keeps the read off the caller's streams; the launch/sync
+  // round trip bounds the uncertainty of the host timestamp, so take its
+  // midpoint as the host-side observation.
+  auto stream = c10::cuda::getStreamFromPool();
+  const int64_t host_before = c10::getTime();
+  read_clock_kernel<<<1, 1, 0, stream>>>(device_ptr);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+  C10_CUDA_CHECK(cudaStreamSynchronize(stream.stream()));
+  const int64_t host_after = c10::getTime();
+  DeviceClockSample sample{
+      *pinned, host_before + (host_after - host_before) / 2};
+  C10_CUDA_CHECK(cudaFreeHost(pinned));
+  return sample;
+}
+
+} // namespace at::cuda
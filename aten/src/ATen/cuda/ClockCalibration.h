@@ -0,0 +1,55 @@
+#pragma once
+#include <c10/macros/Export.h>
+#include <cstdint>
+
+namespace at::cuda {
+
+// A single (device clock, host clock) observation. `device_ticks` is the raw
+// value of the device's free-running wallclock counter (%globaltimer on CUDA,
+// wall_clock64() on ROCm); `host_ns` is the host time in nanoseconds at which
+// the counter was (approximately) read.
+struct DeviceClockSample {
+  int64_t device_ticks;
+  int64_t host_ns;
+};
+
+// Reads the device wallclock counter on a side stream taken from the stream
+// pool, so in-flight work on the caller's streams is neither delayed nor
+// serialized. Blocks the calling thread for one tiny kernel launch.
+TORCH_CUDA_CU_API DeviceClockSample sample_device_clock();
+
+// Maps raw device timestamps (e.g. read in-kernel from %globaltimer) to host
+// nanoseconds via a linear fit over periodically collected samples. Feed it
+// sample_device_clock() output every few seconds: two samples are enough for
+// a rate + offset fit, and later samples keep tracking clock drift. The fit
+// also absorbs the counter's tick period, so it works unchanged on ROCm where
+// the counter does not tick in nanoseconds.
+class DeviceClockCalibrator {
+ public:
+  void add_sample(const DeviceClockSample& sample) {
+    if (num_samples_++ == 0) {
+      first_ = sample;
+    }
+    last_ = sample;
+  }
+
+  bool calibrated() const {
+    return num_samples_ >= 2 && last_.device_ticks != first_.device_ticks;
+  }
+
+  // Host time corresponding to `device_ticks`. Requires calibrated().
+  int64_t device_to_host_ns(int64_t device_ticks) const {
+    const double rate = static_cast<double>(last_.host_ns - first_.host_ns) /
+        static_cast<double>(last_.device_ticks - first_.device_ticks);
+    return first_.host_ns +
+        static_cast<int64_t>(
+               static_cast<double>(device_ticks - first_.device_ticks) * rate);
+  }
+
+ private:
+  DeviceClockSample first_{0, 0};
+  DeviceClockSample last_{0, 0};
+  int64_t num_samples_{0};
+};
+
+} // namespace at::cuda
@@ -0,0 +1,167 @@
+#include <ATen/cuda/OffloadScheduler.h>
+
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CachingHostAllocator.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAGuard.h>
+
+#include <utility>
+
+namespace at::cuda {
+
+OffloadScheduler& OffloadScheduler::instance() {
+  static OffloadScheduler scheduler;
+  return scheduler;
+}
+
+bool OffloadScheduler::has_registrations() const noexcept {
+  return num_registrations_.load(std::memory_order_relaxed) != 0;
+}
+
+CUDAStream OffloadScheduler::transfer_stream(c10::DeviceIndex device) {
+  auto it = transfer_streams_.find(device);
+  if (it == transfer_streams_.end()) {
+    it = transfer_streams_
+             .emplace(device, getStreamFromPool(/*isHighPriority=*/true, device))
+             .first;
+  }
+  return it->second;
+}
+
+void OffloadScheduler::register_tensor(const at::Tensor& tensor) {
+  TORCH_CHECK(
+      tensor.is_cuda(), "OffloadScheduler only manages CUDA tensors, got ", tensor.device());
+  TORCH_CHECK(
+      tensor.is_contiguous(),
+      "OffloadScheduler requires contiguous tensors; offloaded storage is mirrored byte for byte.");
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto* impl = tensor.unsafeGetTensorImpl();
+  TORCH_CHECK(
+      entries_.find(impl) == entries_.end(),
+      "Tensor is already registered with the OffloadScheduler.");
+  Entry entry;
+  entry.tensor = tensor;
+  entry.nbytes = tensor.storage().nbytes();
+  entry.host_mirror = HostAlloc(entry.nbytes);
+  entries_.emplace(impl, std::move(entry));
+  num_registrations_.fetch_add(1, std::memory_order_relaxed);
+}
+
+void OffloadScheduler::unregister_tensor(const at::Tensor& tensor) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(tensor.unsafeGetTensorImpl());
+  TORCH_CHECK(
+      it != entries_.end(), "Tensor is not registered with the OffloadScheduler.");
+  // Hand the storage back in a usable state before forgetting about it.
+  ensure_resident_locked(it->second);
+  entries_.erase(it);
+  num_registrations_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+void OffloadScheduler::offload(const at::Tensor& tensor) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(tensor.unsafeGetTensorImpl());
+  TORCH_CHECK(
+      it != entries_.end(), "Tensor is not registered with the OffloadScheduler.");
+  Entry& entry = it->second;
+  if (entry.residency != Residency::Device) {
+    return;
+  }
+
+  const auto device = entry.tensor.device().index();
+  c10::cuda::CUDAGuard device_guard(device);
+  auto stream = transfer_stream(device);
+
+  // Order the copy after everything the caller has enqueued so far.
+  CUDAEvent compute_done;
+  compute_done.record(getCurrentCUDAStream(device));
+  compute_done.block(stream);
+
+  const auto& device_ptr = entry.tensor.storage().data_ptr();
+  C10_CUDA_CHECK(cudaMemcpyAsync(
+      entry.host_mirror.get(),
+      device_ptr.get(),
+      entry.nbytes,
+      cudaMemcpyDeviceToHost,
+      stream));
+  // The pinned mirror must not be handed out again before the copy lands.
+  CachingHostAllocator_recordEvent(
+      entry.host_mirror.get(), entry.host_mirror.get_context(), stream);
+
+  // Release the device storage in stream order: the caching allocator will
+  // not reuse the block before the copy on the transfer stream finishes.
+  c10::cuda::CUDACachingAllocator::recordStream(device_ptr, stream);
+  entry.tensor.storage().set_data_ptr_noswap(
+      at::DataPtr(nullptr, entry.tensor.storage().device()));
+
+  entry.transfer_done.record(stream);
+  entry.residency = Residency::Offloaded;
+}
+
+void OffloadScheduler::prefetch_locked(Entry& entry) {
+  if (entry.residency != Residency::Offloaded) {
+    return;
+  }
+  const auto device = entry.tensor.device().index();
+  c10::cuda::CUDAGuard device_guard(device);
+  auto stream = transfer_stream(device);
+
+  at::DataPtr device_ptr;
+  {
+    // The allocation is stream-ordered on the transfer stream, which also
+    // serializes the prefetch behind any offload still in flight there.
+    c10::cuda::CUDAStreamGuard stream_guard(stream);
+    device_ptr = c10::cuda::CUDACachingAllocator::get()->allocate(entry.nbytes);
+  }
+  C10_CUDA_CHECK(cudaMemcpyAsync(
+      device_ptr.get(),
+      entry.host_mirror.get(),
+      entry.nbytes,
+      cudaMemcpyHostToDevice,
+      stream));
+  CachingHostAllocator_recordEvent(
+      entry.host_mirror.get(), entry.host_mirror.get_context(), stream);
+  entry.tensor.storage().set_data_ptr_noswap(std::move(device_ptr));
+
+  entry.transfer_done.record(stream);
+  entry.residency = Residency::PrefetchInFlight;
+}
+
+void OffloadScheduler::ensure_resident_locked(Entry& entry) {
+  prefetch_locked(entry);
+  if (entry.residency == Residency::PrefetchInFlight) {
+    const auto device = entry.tensor.device().index();
+    auto current = getCurrentCUDAStream(device);
+    entry.transfer_done.block(current);
+    // The storage was allocated on the transfer stream; flag the use on the
+    // consuming stream so a later offload frees it correctly.
+    c10::cuda::CUDACachingAllocator::recordStream(
+        entry.tensor.storage().data_ptr(), current);
+    entry.residency = Residency::Device;
+  }
+}
+
+void OffloadScheduler::prefetch(const at::Tensor& tensor) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(tensor.unsafeGetTensorImpl());
+  TORCH_CHECK(
+      it != entries_.end(), "Tensor is not registered with the OffloadScheduler.");
+  prefetch_locked(it->second);
+}
+
+void OffloadScheduler::ensure_resident(const at::Tensor& tensor) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  auto it = entries_.find(tensor.unsafeGetTensorImpl());
+  if (it == entries_.end()) {
+    return;
+  }
+  ensure_resident_locked(it->second);
+}
+
+void OffloadScheduler::ensure_resident(at::TensorList tensors) {
+  for (const auto& tensor : tensors) {
+    ensure_resident(tensor);
+  }
+}
+
+} // namespace at::cuda
@@ -0,0 +1,89 @@
+#pragma once
+
+#include <ATen/core/Tensor.h>
+#include <ATen/cuda/CUDAEvent.h>
+#include <c10/core/Allocator.h>
+#include <c10/cuda/CUDAStream.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace at::cuda {
+
+// OffloadScheduler pages registered CUDA tensors out to pinned host memory
+// and back in again, with every transfer ordered by stream events instead of
+// host synchronization. It is meant for large, infrequently touched state
+// (e.g. fused optimizer moments): offload() releases the device storage once
+// a dedicated transfer stream has copied it into a pinned mirror, prefetch()
+// starts the copy back while other work is still running, and
+// ensure_resident() makes the current stream wait just long enough for the
+// data to be back on the device. The fused Adam(W) kernels call
+// ensure_resident() on their state lists, so a registered tensor is paged in
+// automatically right before the optimizer step touches it.
+//
+// All bookkeeping is keyed by the tensor's TensorImpl; the registered tensor
+// must keep the same storage object for as long as it is registered (the
+// scheduler swaps the storage's data pointer, it never replaces the storage).
+// The class is thread-safe.
+struct TORCH_CUDA_CPP_API OffloadScheduler {
+  static OffloadScheduler& instance();
+
+  // Marks `tensor` host-resident: allocates a pinned mirror of the same size
+  // and takes ownership of paging the tensor in and out. The tensor stays on
+  // the device until the first offload(). Registering a tensor twice is an
+  // error, as is registering a non-CUDA or non-contiguous tensor.
+  void register_tensor(const at::Tensor& tensor);
+
+  // Drops the registration. The tensor is paged back in first if needed.
+  void unregister_tensor(const at::Tensor& tensor);
+
+  // Pages the tensor out: the transfer stream waits for all work currently
+  // enqueued on the current stream, copies device to host, and the device
+  // storage is released in stream order. No-op if already offloaded.
+  void offload(const at::Tensor& tensor);
+
+  // Starts paging the tensor back in on the transfer stream without blocking
+  // the current stream. Call this as early as possible (e.g. at the start of
+  // backward) so the copy overlaps compute. No-op if already resident.
+  void prefetch(const at::Tensor& tensor);
+
+  // Makes the current stream wait until the tensor is device-resident,
+  // issuing the prefetch itself if none is in flight. Unregistered tensors
+  // are ignored, so callers may pass whole state lists unconditionally.
+  void ensure_resident(const at::Tensor& tensor);
+  void ensure_resident(at::TensorList tensors);
+
+  // Cheap check for hot paths to skip ensure_resident() entirely.
+  bool has_registrations() const noexcept;
+
+ private:
+  OffloadScheduler() = default;
+
+  enum class Residency {
+    Device,
+    Offloaded,
+    PrefetchInFlight,
+  };
+
+  struct Entry {
+    at::Tensor tensor;
+    at::DataPtr host_mirror;
+    size_t nbytes = 0;
+    Residency residency = Residency::Device;
+    // Recorded on the transfer stream after the most recent copy.
+    at::cuda::CUDAEvent transfer_done;
+  };
+
+  CUDAStream transfer_stream(c10::DeviceIndex device);
+  void prefetch_locked(Entry& entry);
+  void ensure_resident_locked(Entry& entry);
+
+  mutable std::mutex mutex_;
+  std::unordered_map<c10::TensorImpl*, Entry> entries_;
+  std::map<c10::DeviceIndex, CUDAStream> transfer_streams_;
+  std::atomic<size_t> num_registrations_{0};
+};
+
+} // namespace at::cuda
@@ -6,6 +6,7 @@
 #include <ATen/DynamicLibrary.h>
 #include <ATen/core/Vitals.h>
 #include <ATen/cuda/CUDAConfig.h>
+#include <ATen/cuda/CUDAContextLight.h>
 #include <ATen/cuda/CUDADevice.h>
 #include <ATen/cuda/Exceptions.h>
 #include <ATen/cuda/PeerToPeerAccess.h>
@@ -20,6 +21,7 @@
 #include <c10/util/irange.h>
 
 #if AT_CUDNN_ENABLED()
+#include <ATen/cudnn/Handle.h>
 #include <ATen/cudnn/cudnn-wrapper.h>
 #endif
 
@@ -463,6 +465,22 @@ void CUDAHooks::deviceSynchronize(DeviceIndex device_index) const {
   c10::cuda::device_synchronize();
 }
 
+void CUDAHooks::warmup(DeviceIndex device_index) const {
+  at::DeviceGuard device_guard(at::Device(at::DeviceType::CUDA, device_index));
+  // cuBLAS and cuBLASLt handles for the current stream; creating the cuBLAS
+  // handle also allocates its per-stream workspace.
+  at::cuda::getCurrentCUDABlasHandle();
+  at::cuda::getCurrentCUDABlasLtHandle();
+#if AT_CUDNN_ENABLED()
+  // Loading and initializing the cuDNN library dominates first-conv latency.
+  at::native::getCudnnHandle();
+#endif
+  // Prime the caching allocator: the first allocation pays for creating the
+  // memory pool, so reserve and return a block now.
+  c10::cuda::CUDACachingAllocator::get()->allocate(1 << 20);
+  c10::cuda::device_synchronize();
+}
+
 // Sigh, the registry doesn't support namespaces :(
 using at::CUDAHooksRegistry;
 using at::RegistererCUDAHooksRegistry;
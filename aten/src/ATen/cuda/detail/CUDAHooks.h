@@ -57,6 +57,7 @@ struct CUDAHooks : public at::CUDAHooksInterface {
   bool isGPUArch(DeviceIndex device_index, const std::vector<std::string>& archs) const override;
 #endif
   void deviceSynchronize(DeviceIndex device_index) const override;
+  void warmup(DeviceIndex device_index) const override;
 };
 
 } // at::cuda::detail
@@ -31,6 +31,12 @@ struct TORCH_API AcceleratorHooksInterface {
     return 0;
   }
 
+  // Eagerly runs the backend's lazy first-use initializations (handle
+  // creation, workspace allocation, allocator priming) so their cost is paid
+  // here instead of inside the first real operation. Backends without such
+  // lazy state keep the default no-op.
+  virtual void warmup(DeviceIndex /*device_index*/) const {}
+
   virtual void setCurrentDevice(DeviceIndex device) const {
     TORCH_CHECK(false, "Backend doesn't support setCurrentDevice()");
   }
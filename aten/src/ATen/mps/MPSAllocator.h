@@ -108,6 +108,9 @@ struct HeapBlock {
   id_t heap_id;
   // indicates if we split this heap to sub-allocate 'several' buffers (otherwise single buffer)
   bool is_split;
+  // monotonic stamp of the last allocation served from this heap; used by
+  // releaseCachedHeaps() to trim the least recently used heaps first
+  uint64_t last_used = 0;
   // counter to assign unique ids to heap blocks
   static uint64_t heap_counter;
 
@@ -305,6 +308,17 @@ public:
   size_t getTotalAllocatedMemory() const { return m_total_allocated_memory; }
   // (see m_current_allocated_memory for description)
   size_t getCurrentAllocatedMemory() const { return m_current_allocated_memory; }
+  // (see m_peak_allocated_memory for description)
+  size_t getPeakAllocatedMemory() const { return m_peak_allocated_memory; }
+  // restarts tracking the allocation watermark from the current allocations
+  void resetPeakAllocatedMemory() { m_peak_allocated_memory = m_current_allocated_memory; }
+  // returns a snapshot of all the heaps currently held by the buffer pools
+  std::vector<MPSHeapStats> getHeapStats();
+  // releases up to 'max_heaps' least recently used heaps whose buffers are all
+  // cached in the pools and not retained by any command buffer; unlike emptyCache,
+  // this reclaims memory incrementally without synchronizing the stream.
+  // returns the number of heaps actually released.
+  size_t releaseCachedHeaps(size_t max_heaps);
   // total GPU memory allocated in the process by Metal driver; including
   // implicit allocations from MPS/MPSGraph frameworks and MPSHeapAllocatorImpl.
   size_t getDriverAllocatedMemory() const { return current_allocated_size(); }
@@ -338,6 +352,14 @@ private:
   size_t m_total_allocated_memory = 0;
   // currently active memory allocations in use (i.e., blocks not in pools)
   size_t m_current_allocated_memory = 0;
+  // high watermark of m_current_allocated_memory since process start (or the
+  // last call to resetPeakAllocatedMemory())
+  size_t m_peak_allocated_memory = 0;
+  // monotonic counter used to stamp heaps with the recency of their last allocation
+  uint64_t m_last_use_stamp = 0;
+  // indicates low-memory callbacks already fired for the current memory-pressure
+  // episode (re-armed once allocations drop below the low watermark limit)
+  bool m_low_memory_notified = false;
   // max buffer size allowed by Metal
   size_t m_max_buffer_size = 0;
   // maximum total size allowed to be allocated
@@ -379,6 +401,9 @@ private:
   bool release_cached_buffers();
   // free unused cached blocks to reclaim GPU memory if memory pressure is high
   void garbage_collect_cached_buffers(AllocParams& params);
+  // notifies the registered low-memory callbacks (at most once per episode of
+  // crossing the low watermark limit)
+  void trigger_low_memory_callbacks();
   // returns the suitable buffer pool type for the usage or
   // requested/allocated sizes
   BufferPool& get_pool(size_t requested_size, size_t aligned_size, uint32_t usage);
@@ -6,11 +6,13 @@
 #include <c10/core/Allocator.h>
 #include <c10/core/Storage.h>
 
+#include <algorithm>
 #include <iostream>
 
 namespace at::mps {
 
 C10_DEFINE_REGISTRY(MPSAllocatorCallbacksRegistry, IMpsAllocatorCallback);
+C10_DEFINE_REGISTRY(MPSLowMemoryCallbacksRegistry, IMpsLowMemoryCallback);
 
 namespace HeapAllocator {
 
@@ -238,6 +240,9 @@ BufferBlock* MPSHeapAllocatorImpl::alloc_buffer_block(size_t size, uint32_t usag
   // low watermark limit has been reached
   params.has_memory_pressure = !(pool.usage & UsageFlags::SMALL) && getLowWatermarkValue() <= 0;
   params.has_unified_memory = m_device.hasUnifiedMemory;
+  // give the registered clients a chance to react to the memory pressure (e.g., by freeing
+  // buffers) before we start applying the allocation strategies ourselves.
+  trigger_low_memory_callbacks();
 
   // first, try to get a block from the existing pool.
   bool block_found = get_free_buffer(params);
@@ -296,7 +301,11 @@ BufferBlock* MPSHeapAllocatorImpl::alloc_buffer_block(size_t size, uint32_t usag
   }
   buffer_block->in_use = true;
   buffer_block->use_count++;
+  buffer_block->heap->last_used = ++m_last_use_stamp;
   m_current_allocated_memory += buffer_block->size;
+  if (m_current_allocated_memory > m_peak_allocated_memory) {
+    m_peak_allocated_memory = m_current_allocated_memory;
+  }
 
   return buffer_block;
 }
@@ -503,6 +512,24 @@ void MPSHeapAllocatorImpl::garbage_collect_cached_buffers(AllocParams& params) {
   }
 }
 
+void MPSHeapAllocatorImpl::trigger_low_memory_callbacks() {
+  // getLowWatermarkValue() returns max when the low watermark limit is disabled,
+  // so the callbacks never fire in that case.
+  if (getLowWatermarkValue() > 0) {
+    // re-arm the notifications once the memory pressure episode is over
+    m_low_memory_notified = false;
+    return;
+  }
+  if (m_low_memory_notified) {
+    return;
+  }
+  m_low_memory_notified = true;
+  for (const auto& name : MPSLowMemoryCallbacksRegistry()->Keys()) {
+    MPSLowMemoryCallbacksRegistry()->Create(name)->executeLowMemoryCallback(current_allocated_size(),
+                                                                            m_low_watermark_limit);
+  }
+}
+
 // public interface to MPSAllocator
 id<MTLBuffer> MPSHeapAllocatorImpl::malloc(size_t size, uint32_t usage) {
   std::lock_guard<std::recursive_mutex> lock(m_mutex);
@@ -689,6 +716,101 @@ void MPSHeapAllocatorImpl::emptyCache() {
   release_cached_buffers();
 }
 
+std::vector<MPSHeapStats> MPSHeapAllocatorImpl::getHeapStats() {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+  std::vector<MPSHeapStats> stats;
+  for (const auto& poolIt : m_pools) {
+    BufferPool& pool = *poolIt.second;
+    // count the cached buffers per heap to identify the idle heaps (i.e., heaps
+    // with no in-use or pending-free buffers)
+    ska::flat_hash_map<HeapBlock*, uint32_t> cached_counts;
+    for (const auto& buffer_block : pool.available_buffers) {
+      cached_counts[buffer_block->heap]++;
+    }
+    for (const auto& heap_block : pool.heaps) {
+      MPSHeapStats heap_stats;
+      heap_stats.heap_id = heap_block->heap_id;
+      heap_stats.total_size = heap_block->size.total;
+      heap_stats.available_size = heap_block->size.available;
+      heap_stats.n_buffers = heap_block->n_buffers;
+      heap_stats.is_split = heap_block->is_split;
+      heap_stats.is_shared = (pool.usage & UsageFlags::SHARED) != 0;
+      heap_stats.is_idle = cached_counts[heap_block] == heap_block->n_buffers;
+      stats.push_back(heap_stats);
+    }
+  }
+  return stats;
+}
+
+size_t MPSHeapAllocatorImpl::releaseCachedHeaps(size_t max_heaps) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+
+  // gather the heaps whose buffers are all cached in the pools and not retained by
+  // any command buffer, so their backing memory could be reclaimed immediately
+  // without synchronizing the stream (unlike release_cached_buffers()).
+  struct Candidate {
+    HeapBlock* heap_block;
+    std::vector<BufferBlock*> buffer_blocks;
+  };
+  std::vector<Candidate> candidates;
+  for (const auto& poolIt : m_pools) {
+    BufferPool& pool = *poolIt.second;
+    ska::flat_hash_map<HeapBlock*, std::vector<BufferBlock*>> cached_buffers;
+    for (const auto& buffer_block : pool.available_buffers) {
+      if (buffer_block->retainCount() <= 1) {
+        cached_buffers[buffer_block->heap].push_back(buffer_block);
+      }
+    }
+    for (const auto& heap_block : pool.heaps) {
+      auto it = cached_buffers.find(heap_block);
+      const size_t cached_count = (it != cached_buffers.end()) ? it->second.size() : 0;
+      if ((size_t)heap_block->n_buffers == cached_count) {
+        candidates.push_back({heap_block, cached_count ? std::move(it->second) : std::vector<BufferBlock*>()});
+      }
+    }
+  }
+  // trim the heaps that served an allocation least recently first
+  std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+    return a.heap_block->last_used < b.heap_block->last_used;
+  });
+
+  size_t released_heaps = 0;
+  for (auto& candidate : candidates) {
+    if (released_heaps >= max_heaps) {
+      break;
+    }
+    HeapBlock* heap_block = candidate.heap_block;
+    if (candidate.buffer_blocks.empty()) {
+      // the heap has no sub-allocated buffers left, so release it directly
+      BufferPool& pool = *heap_block->pool;
+      pool.heaps.erase(heap_block);
+      pool.heaps_pending_update.erase(heap_block);
+      m_total_allocated_memory -= heap_block->size.total;
+      const uint32_t retainCount = heap_block->releaseMTLHeap();
+      if (m_debug_verbosity & DebugVerbosity::RELEASES) {
+        std::cerr << "Released heap #" << heap_block->heap_id << " of size " << format_size(heap_block->size.total)
+                  << " (current allocated: " << format_size(current_allocated_size()) << ", retain#: " << retainCount
+                  << ")\n";
+      }
+      delete heap_block;
+      released_heaps++;
+      continue;
+    }
+    // releasing the last cached buffer also releases the containing heap
+    for (const auto& buffer_block : candidate.buffer_blocks) {
+      if (release_buffer(buffer_block, true)) {
+        released_heaps++;
+      }
+    }
+  }
+  if ((m_debug_verbosity & DebugVerbosity::RELEASES) && released_heaps > 0) {
+    std::cerr << "Trimmed " << released_heaps << " cached heap(s) (MPS allocated: "
+              << format_size(m_total_allocated_memory) << ")\n";
+  }
+  return released_heaps;
+}
+
 ssize_t MPSHeapAllocatorImpl::getLowWatermarkValue() {
   // check if low watermark limit is disabled
   if (m_low_watermark_ratio == 0.0) {
@@ -789,6 +911,12 @@ struct TORCH_API MPSAllocator final : public IMPSAllocator {
   size_t getCurrentAllocatedMemory() const override {
     return _getAllocImpl().getCurrentAllocatedMemory();
   }
+  size_t getPeakAllocatedMemory() const override {
+    return _getAllocImpl().getPeakAllocatedMemory();
+  }
+  void resetPeakAllocatedMemory() const override {
+    _getAllocImpl().resetPeakAllocatedMemory();
+  }
   size_t getDriverAllocatedMemory() const override {
     return _getAllocImpl().getDriverAllocatedMemory();
   }
@@ -816,6 +944,12 @@ struct TORCH_API MPSAllocator final : public IMPSAllocator {
   bool waitForEvents(c10::ArrayRef<const void*> buffers) const override {
     return _getAllocImpl().waitForEvents(buffers);
   }
+  std::vector<MPSHeapStats> getHeapStats() const override {
+    return _getAllocImpl().getHeapStats();
+  }
+  size_t releaseCachedHeaps(size_t max_heaps) const override {
+    return _getAllocImpl().releaseCachedHeaps(max_heaps);
+  }
   std::string formatSize(size_t size) const override {
     return _getAllocImpl().format_size(size);
   }
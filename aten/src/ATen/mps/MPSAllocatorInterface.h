@@ -6,10 +6,31 @@
 #include <c10/util/Registry.h>
 #include <ATen/core/ATen_fwd.h>
 
+#include <vector>
+
 #define MB(x) (x * 1048576UL)
 
 namespace at::mps {
 
+// snapshot of a single Metal heap cached by MPSAllocator
+// (see IMPSAllocator::getHeapStats())
+struct MPSHeapStats {
+  id_t heap_id = 0;
+  // backing memory reserved by the heap
+  size_t total_size = 0;
+  // memory still available for sub-allocation on the heap
+  size_t available_size = 0;
+  // number of buffers currently sub-allocated from the heap
+  uint32_t n_buffers = 0;
+  // indicates if the heap sub-allocates 'several' buffers (otherwise single buffer)
+  bool is_split = false;
+  // indicates if the heap was allocated with shared storage-mode
+  bool is_shared = false;
+  // indicates none of the heap's buffers are in-use or pending to be freed
+  // (i.e., the heap is releasable via releaseCachedHeaps())
+  bool is_idle = false;
+};
+
 // this is a public interface to access MPSAllocator.
 // Do not declare methods that would depend on MPS or Metal frameworks.
 class IMPSAllocator : public c10::Allocator {
@@ -32,11 +53,15 @@ public:
   virtual size_t getHighWatermarkLimit() const = 0;
   virtual size_t getTotalAllocatedMemory() const = 0;
   virtual size_t getCurrentAllocatedMemory() const = 0;
+  virtual size_t getPeakAllocatedMemory() const = 0;
+  virtual void resetPeakAllocatedMemory() const = 0;
   virtual size_t getDriverAllocatedMemory() const = 0;
   virtual size_t getRecommendedMaxMemory() const = 0;
   virtual std::pair<const void*, uint32_t> getSharedBufferPtr(const void* ptr) const = 0;
   virtual bool recordEvents(c10::ArrayRef<const void*> buffers) const = 0;
   virtual bool waitForEvents(c10::ArrayRef<const void*> buffers) const = 0;
+  virtual std::vector<MPSHeapStats> getHeapStats() const = 0;
+  virtual size_t releaseCachedHeaps(size_t max_heaps) const = 0;
 };
 
 class IMpsAllocatorCallback {
@@ -57,6 +82,23 @@ C10_DECLARE_REGISTRY(MPSAllocatorCallbacksRegistry, IMpsAllocatorCallback);
 #define REGISTER_MPS_ALLOCATOR_CALLBACK(name, ...) \
   C10_REGISTER_CLASS(MPSAllocatorCallbacksRegistry, name, __VA_ARGS__);
 
+// callback to notify clients when the total allocations cross the low watermark
+// limit, so they could react to the memory pressure early (e.g., by freeing
+// buffers or trimming caches) before the allocator applies its own strategies.
+class IMpsLowMemoryCallback {
+ public:
+  virtual ~IMpsLowMemoryCallback() = default;
+  // 'current_allocated' is the total memory allocated on the device by the process,
+  // and 'low_watermark_limit' is the soft limit that was crossed (both in Bytes).
+  virtual void executeLowMemoryCallback(size_t current_allocated, size_t low_watermark_limit) = 0;
+};
+
+// MPS allocator will execute every registered callback once per episode of
+// crossing the low watermark limit (see m_low_watermark_ratio in MPSAllocator.h).
+C10_DECLARE_REGISTRY(MPSLowMemoryCallbacksRegistry, IMpsLowMemoryCallback);
+#define REGISTER_MPS_LOW_MEMORY_CALLBACK(name, ...) \
+  C10_REGISTER_CLASS(MPSLowMemoryCallbacksRegistry, name, __VA_ARGS__);
+
 IMPSAllocator* getIMPSAllocator(bool sharedAllocator = false);
 
 bool isMPSPinnedPtr(const void* data);
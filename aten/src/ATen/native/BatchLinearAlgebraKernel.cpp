@@ -32,6 +32,73 @@ namespace {
 
   For further details, please see the LAPACK documentation for POTRF.
 */
+// Maximum matrix size for the direct (non-LAPACK) Cholesky path below.
+constexpr int64_t CHOLESKY_SMALL_MAX_N = 16;
+// Minimum batch size before the direct path pays off; with few matrices
+// the per-call LAPACK overhead is irrelevant.
+constexpr int64_t CHOLESKY_SMALL_MIN_BATCH = 256;
+
+/*
+  Unblocked Cholesky factorization of a single tiny column-major matrix,
+  matching LAPACK POTRF's semantics: only the requested triangle is
+  referenced and overwritten, and `info` is set to j + 1 when the leading
+  minor of order j + 1 is not positive-definite (factorization stops).
+
+  Calling LAPACK per matrix costs more than the O(n^3) work for n this
+  small, so batches of tiny matrices run this routine under
+  at::parallel_for instead (see apply_cholesky).
+*/
+template <typename scalar_t>
+void cholesky_small_single(scalar_t* a, int64_t n, int64_t lda, bool upper, int* info) {
+  using value_t = typename c10::scalar_value_type<scalar_t>::type;
+  *info = 0;
+  if (upper) {
+    // A = U^H U, upper triangle at a[r + c * lda] with r <= c
+    for (const auto j : c10::irange(n)) {
+      value_t diag = real_impl<scalar_t, value_t>(a[j + j * lda]);
+      for (const auto k : c10::irange(j)) {
+        const scalar_t u_kj = a[k + j * lda];
+        diag -= real_impl<scalar_t, value_t>(u_kj * conj_impl(u_kj));
+      }
+      if (diag <= value_t(0)) {
+        *info = static_cast<int>(j) + 1;
+        return;
+      }
+      const value_t u_jj = std::sqrt(diag);
+      a[j + j * lda] = u_jj;
+      for (int64_t c = j + 1; c < n; c++) {
+        scalar_t sum = a[j + c * lda];
+        for (const auto k : c10::irange(j)) {
+          sum -= conj_impl(a[k + j * lda]) * a[k + c * lda];
+        }
+        a[j + c * lda] = sum / u_jj;
+      }
+    }
+  } else {
+    // A = L L^H, lower triangle at a[r + c * lda] with r >= c
+    for (const auto j : c10::irange(n)) {
+      value_t diag = real_impl<scalar_t, value_t>(a[j + j * lda]);
+      for (const auto k : c10::irange(j)) {
+        const scalar_t l_jk = a[j + k * lda];
+        diag -= real_impl<scalar_t, value_t>(l_jk * conj_impl(l_jk));
+      }
+      if (diag <= value_t(0)) {
+        *info = static_cast<int>(j) + 1;
+        return;
+      }
+      const value_t l_jj = std::sqrt(diag);
+      a[j + j * lda] = l_jj;
+      for (int64_t r = j + 1; r < n; r++) {
+        scalar_t sum = a[r + j * lda];
+        for (const auto k : c10::irange(j)) {
+          sum -= a[r + k * lda] * conj_impl(a[j + k * lda]);
+        }
+        a[r + j * lda] = sum / l_jj;
+      }
+    }
+  }
+}
+
 template <typename scalar_t>
 void apply_cholesky(const Tensor& input, const Tensor& info, bool upper) {
 #if !AT_BUILD_WITH_LAPACK()
@@ -48,6 +115,19 @@ void apply_cholesky(const Tensor& input, const Tensor& info, bool upper) {
   auto n = input.size(-2);
   auto lda = std::max<int64_t>(1, n);
 
+  // Large batches of tiny matrices are dominated by per-call LAPACK
+  // overhead; factor them directly, in parallel over the batch.
+  if (n <= CHOLESKY_SMALL_MAX_N && batch_size >= CHOLESKY_SMALL_MIN_BATCH) {
+    int64_t grain_size = internal::GRAIN_SIZE / std::max<int64_t>(1, n * n * n);
+    at::parallel_for(0, batch_size, grain_size, [&](int64_t begin, int64_t end) {
+      for (const auto i : c10::irange(begin, end)) {
+        cholesky_small_single<scalar_t>(
+            &input_data[i * input_matrix_stride], n, lda, upper, &info_data[i]);
+      }
+    });
+    return;
+  }
+
   for (const auto i : c10::irange(batch_size)) {
     scalar_t* input_working_ptr = &input_data[i * input_matrix_stride];
     int* info_working_ptr = &info_data[i];
@@ -139,6 +139,7 @@
 #include <ATen/ops/sub.h>
 #include <ATen/ops/sub_native.h>
 #include <ATen/ops/subtract_native.h>
+#include <ATen/ops/tan_backward_native.h>
 #include <ATen/ops/tanh_backward_native.h>
 #include <ATen/ops/true_divide_native.h>
 #include <ATen/ops/xlogy.h>
@@ -311,6 +312,10 @@ TORCH_META_FUNC(sigmoid_backward) (const Tensor& grad_output, const Tensor& outp
   build_borrowing_binary_op(maybe_get_output(), grad_output, output);
 }
 
+TORCH_META_FUNC(tan_backward) (const Tensor& grad_output, const Tensor& output) {
+  build_borrowing_binary_op(maybe_get_output(), grad_output, output);
+}
+
 TORCH_META_FUNC(tanh_backward) (const Tensor& grad_output, const Tensor& output) {
   build_borrowing_binary_op(maybe_get_output(), grad_output, output);
 }
@@ -398,6 +403,7 @@ DEFINE_DISPATCH(eq_stub);
 DEFINE_DISPATCH(ne_stub);
 DEFINE_DISPATCH(sigmoid_backward_stub);
 DEFINE_DISPATCH(logit_backward_stub);
+DEFINE_DISPATCH(tan_backward_stub);
 DEFINE_DISPATCH(tanh_backward_stub);
 DEFINE_DISPATCH(maximum_stub);
 DEFINE_DISPATCH(minimum_stub);
@@ -523,6 +529,10 @@ TORCH_IMPL_FUNC(special_shifted_chebyshev_polynomial_w_out) (const Tensor& self,
   shifted_chebyshev_polynomial_w_stub(device_type(), *this);
 }
 
+TORCH_IMPL_FUNC(tan_backward_out) (const Tensor& grad_output, const Tensor& output, const Tensor& result) {
+  tan_backward_stub(device_type(), *this);
+}
+
 TORCH_IMPL_FUNC(tanh_backward_out) (const Tensor& grad_output, const Tensor& output, const Tensor& result) {
   tanh_backward_stub(device_type(), *this);
 }
@@ -84,6 +84,42 @@ int64_t cus_upper_bound(int64_t start, int64_t end, const input_t val, const inp
   return start;
 }
 
+// max boundary count for which the branchless searches below are used; beyond
+// roughly L1-resident sizes the branchy searches win again because their
+// speculated loads overlap the cache misses
+constexpr int64_t SEARCHSORTED_BRANCHLESS_MAX_BD_SIZE = 4096;
+
+// branchless counterpart of cus_lower_bound for the common no-sorter case:
+// every step halves the remaining range with a conditional move instead of a
+// branch, so throughput no longer depends on the data-dependent (effectively
+// random) comparison outcomes that make the branchy search stall on
+// mispredictions. Uses the same !(mid_val >= val) predicate as cus_lower_bound
+// so the bound of 'nan', 'inf' etc. is still the end of the boundary
+template<typename input_t>
+int64_t branchless_lower_bound(int64_t start, int64_t end, const input_t val, const input_t* bd) {
+  const input_t* base = bd + start;
+  int64_t len = end - start;
+  while (len > 1) {
+    const int64_t half = len >> 1;
+    base += !(base[half - 1] >= val) ? half : 0;
+    len -= half;
+  }
+  return base - bd + !(base[0] >= val);
+}
+
+// branchless counterpart of cus_upper_bound, see branchless_lower_bound
+template<typename input_t>
+int64_t branchless_upper_bound(int64_t start, int64_t end, const input_t val, const input_t* bd) {
+  const input_t* base = bd + start;
+  int64_t len = end - start;
+  while (len > 1) {
+    const int64_t half = len >> 1;
+    base += !(base[half - 1] > val) ? half : 0;
+    len -= half;
+  }
+  return base - bd + !(base[0] > val);
+}
+
 template<typename input_t, typename output_t>
 void searchsorted_cpu_contiguous(Tensor& result, const Tensor& input, const Tensor& boundaries, const bool& right, const Tensor& sorter) {
   int64_t numel_in = input.numel();
@@ -98,15 +134,20 @@ void searchsorted_cpu_contiguous(Tensor& result, const Tensor& input, const Tens
   output_t *data_out = result.data_ptr<output_t>();
 
   bool is_1d_boundaries = boundaries.dim() == 1;
+  const bool use_branchless = !data_st && idim_bd > 0 && idim_bd <= SEARCHSORTED_BRANCHLESS_MAX_BD_SIZE;
   at::parallel_for(0, numel_in, SEARCHSORTED_GRAIN_SIZE, [&](int64_t start, int64_t end) {
     for (const auto i : c10::irange(start, end)) {
       // If boundaries tensor is 1d, we always search the entire boundary tensor
       int64_t start_bd = is_1d_boundaries ? 0 : i / idim_in * idim_bd;
       int64_t end_bd = start_bd + idim_bd;
 
-      int64_t pos = !right ?
-        cus_lower_bound(start_bd, end_bd, data_in[i], data_bd, data_st) - start_bd :
-        cus_upper_bound(start_bd, end_bd, data_in[i], data_bd, data_st) - start_bd;
+      int64_t pos = use_branchless ?
+        (!right ?
+          branchless_lower_bound(start_bd, end_bd, data_in[i], data_bd) - start_bd :
+          branchless_upper_bound(start_bd, end_bd, data_in[i], data_bd) - start_bd) :
+        (!right ?
+          cus_lower_bound(start_bd, end_bd, data_in[i], data_bd, data_st) - start_bd :
+          cus_upper_bound(start_bd, end_bd, data_in[i], data_bd, data_st) - start_bd);
 
       // type conversion might happen here
       data_out[i] = pos;
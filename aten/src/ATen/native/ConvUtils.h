@@ -419,6 +419,18 @@ inline bool thnn_conv_use_channels_last(const at::Tensor& input, const at::Tenso
   return can_use_thnn_channels_last_2d;
 }
 
+inline bool thnn_conv_use_channels_last_3d(const at::Tensor& input, const at::Tensor& weight) {
+
+  auto input_memory_format = input.suggest_memory_format();
+  auto weight_memory_format = weight.suggest_memory_format();
+
+  bool can_use_thnn_channels_last_3d = input.device().is_cpu() && (
+      (input_memory_format  == at::MemoryFormat::ChannelsLast3d) || (
+       weight_memory_format == at::MemoryFormat::ChannelsLast3d));
+
+  return can_use_thnn_channels_last_3d;
+}
+
 inline bool xpu_conv_use_channels_last(const at::Tensor& input, const at::Tensor& weight) {
 
   // check layout only for xpu tensor.
@@ -1446,6 +1446,14 @@ static inline at::MemoryFormat determine_backend_memory_format(
         backend_memory_format = at::MemoryFormat::ChannelsLast;
       }
       break;
+    case ConvBackend::Slow3d:
+      // slow_conv3d only has a channels-last kernel for ungrouped convolutions
+      // (input channels == weight.size(1) implies groups == 1)
+      if (input.ndimension() == 5 && input.size(1) == weight.size(1) &&
+          thnn_conv_use_channels_last_3d(input, weight)) {
+        backend_memory_format = at::MemoryFormat::ChannelsLast3d;
+      }
+      break;
     case ConvBackend::Overrideable:
       if (xpu_conv_use_channels_last(input, weight)) {
         backend_memory_format = (k == 5) ? at::MemoryFormat::ChannelsLast3d : at::MemoryFormat::ChannelsLast;
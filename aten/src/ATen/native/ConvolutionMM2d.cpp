@@ -282,6 +282,59 @@ static void slow_conv2d_update_output_frame(
   }
 }
 
+/*
+  Direct channels-last convolution for stride-1, zero-padding, small
+  kernels. In NHWC the unfolded row for one kernel row is kw * ic
+  contiguous input elements, and consecutive output columns shift that
+  window by exactly ic elements. The im2col matrix for a fixed
+  (output row, kernel row) pair is therefore an overlapping strided view
+  of the input (ldb = ic), so it can be fed to GEMM in place instead of
+  being materialized: one accumulating GEMM per pair.
+*/
+template <typename scalar_t>
+static void slow_conv2d_direct_output_frame(
+    TensorAccessor<const scalar_t, 3> input,
+    TensorAccessor<scalar_t, 3> output,
+    TensorAccessor<const scalar_t, 2> weight,
+    bool has_bias,
+    int64_t kernel_height,
+    int64_t kernel_width,
+    int64_t n_input_plane,
+    int64_t input_width,
+    int64_t n_output_plane,
+    int64_t output_height,
+    int64_t output_width) {
+  // Raw channels-last layout: input [ih][iw][ic], output [oh][ow][oc],
+  // weight rows [oc][kh * kw * ic].
+  const scalar_t* input_data = input.data();
+  scalar_t* output_data = output.data();
+  const scalar_t* weight_data = weight.data();
+
+  const int64_t m = n_output_plane;
+  const int64_t n = output_width;
+  const int64_t k = kernel_width * n_input_plane;
+  const int64_t lda = kernel_height * kernel_width * n_input_plane;
+  const int64_t ldb = n_input_plane;
+  const int64_t ldc = n_output_plane;
+
+  for (const auto oh : c10::irange(output_height)) {
+    for (const auto kh : c10::irange(kernel_height)) {
+      // stride 1, no padding: input row oh + kh is always in bounds
+      const scalar_t beta =
+          kh == 0 ? static_cast<scalar_t>(has_bias ? 1 : 0) : static_cast<scalar_t>(1);
+      at::native::cpublas::gemm(
+          TransposeType::Transpose,
+          TransposeType::NoTranspose,
+          m, n, k,
+          static_cast<scalar_t>(1),
+          weight_data + kh * kernel_width * n_input_plane, lda,
+          input_data + (oh + kh) * input_width * n_input_plane, ldb,
+          beta,
+          output_data + oh * output_width * n_output_plane, ldc);
+    }
+  }
+}
+
 template <typename scalar_t>
 void slow_conv2d_backward_update_grad_input_frame(
     TensorAccessor<scalar_t, 3> grad_input,
@@ -585,13 +638,53 @@ Tensor& slow_conv2d_forward_out_cpu(
   const int64_t output_height = (input_height + 2 * pad_height - kernel_height) / stride_height + 1;
   const int64_t output_width = (input_width + 2 * pad_width - kernel_width) / stride_width + 1;
 
-  Tensor finput = compute_columns2d(input, padding, stride, kernel_size, use_channels_last);
+  // Channels-last stride-1 unpadded small kernels read the unfolded
+  // matrix straight out of the input (see
+  // slow_conv2d_direct_output_frame), so the im2col buffer is skipped
+  // entirely. 1x1 kernels are excluded: compute_columns2d already
+  // handles them with a zero-copy view.
+  const bool use_direct = use_channels_last &&
+      stride_height == 1 && stride_width == 1 &&
+      pad_height == 0 && pad_width == 0 &&
+      (kernel_height != 1 || kernel_width != 1) &&
+      kernel_height <= 5 && kernel_width <= 5;
+
+  Tensor finput;
+  if (!use_direct) {
+    finput = compute_columns2d(input, padding, stride, kernel_size, use_channels_last);
+  }
   output.resize_({batch_size, n_output_plane, output_height, output_width}, memory_format);
   if (bias.defined()) {
     output.copy_(bias.reshape({-1, 1, 1}));
   }
   TORCH_CHECK(output.is_contiguous(memory_format), "slow_conv2d output tensor must be contiguous");
 
+  if (use_direct) {
+    AT_DISPATCH_ALL_TYPES_AND2(kBFloat16, kHalf, input.scalar_type(), "slow_conv2d_cpu", [&]{
+      auto input_a = input.accessor<const scalar_t, 4>();
+      auto output_a = output.accessor<scalar_t, 4>();
+      auto weight_2d_a = weight_2d.accessor<const scalar_t, 2>();
+
+      at::parallel_for(0, batch_size, 0, [&](int64_t start, int64_t end) {
+        for (const auto t : c10::irange(start, end)) {
+          slow_conv2d_direct_output_frame(
+              input_a[t],
+              output_a[t],
+              weight_2d_a,
+              bias.defined(),
+              kernel_height,
+              kernel_width,
+              n_input_plane,
+              input_width,
+              n_output_plane,
+              output_height,
+              output_width);
+        }
+      });
+    });
+    return output;
+  }
+
   AT_DISPATCH_ALL_TYPES_AND2(kBFloat16, kHalf, input.scalar_type(), "slow_conv2d_cpu", [&]{
     auto input_a = input.accessor<const scalar_t, 4>();
     auto output_a = output.accessor<scalar_t, 4>();
@@ -5,6 +5,7 @@
 #include <ATen/TensorUtils.h>
 #include <ATen/div_rtn.h>
 #include <ATen/native/ConvolutionMM3d.h>
+#include <ATen/native/ConvUtils.h>
 #include <ATen/native/CPUBlas.h>
 #include <ATen/native/TransposeType.h>
 #include <ATen/native/Unfold3d.h>
@@ -32,8 +33,11 @@ static Tensor compute_columns3d(
     IntArrayRef stride,
     IntArrayRef padding,
     IntArrayRef kernel_size,
-    const int64_t groups) {
-  const Tensor input = input_.contiguous();
+    const int64_t groups,
+    bool is_channels_last) {
+  const Tensor input = input_.contiguous(
+      is_channels_last ? at::MemoryFormat::ChannelsLast3d
+                       : at::MemoryFormat::Contiguous);
   const int64_t kernel_depth = kernel_size[0];
   const int64_t kernel_height = kernel_size[1];
   const int64_t kernel_width = kernel_size[2];
@@ -64,12 +68,21 @@ static Tensor compute_columns3d(
       (pad_depth == 0) && (pad_height == 0) && (pad_width == 0) &&
       (stride_depth == 1) && (stride_height == 1) && (stride_width == 1) && (groups == 1)) {
     // Columns are just a view on the input for this special case.
-    columns = input.view({batch_size, n_input_plane, output_height * output_width * output_depth}).detach();
+    if (is_channels_last) {
+      columns = input.as_strided(
+          {batch_size, output_depth * output_height * output_width, n_input_plane},
+          {output_depth * output_height * output_width * n_input_plane, n_input_plane, 1}).detach();
+    } else {
+      columns = input.view({batch_size, n_input_plane, output_height * output_width * output_depth}).detach();
+    }
   } else {
-    columns = at::empty({batch_size,
-                        n_input_plane * kernel_depth * kernel_height * kernel_width,
-                        output_depth * output_height * output_width},
-                        input.options());
+    const int64_t row = is_channels_last ?
+        output_depth * output_height * output_width :
+        n_input_plane * kernel_depth * kernel_height * kernel_width;
+    const int64_t col = is_channels_last ?
+        kernel_depth * kernel_height * kernel_width * n_input_plane :
+        output_depth * output_height * output_width;
+    columns = at::empty({batch_size, row, col}, input.options());
 
     AT_DISPATCH_ALL_TYPES_AND2(kBFloat16, kHalf, input.scalar_type(), "compute_columns3d", [&] {
       auto input_a = input.accessor<const scalar_t, 5>();
@@ -98,7 +111,8 @@ static Tensor compute_columns3d(
             pad_depth,
             pad_height,
             pad_width,
-            columns_t.data());
+            columns_t.data(),
+            is_channels_last);
           }
       });
     });
@@ -247,13 +261,16 @@ static inline void slow_conv3d_shape_check(
   }
 }
 
-static Tensor view_weight_2d(const Tensor& weight_) {
-  Tensor weight = weight_.contiguous();
+static Tensor view_weight_2d(const Tensor& weight_,
+    at::MemoryFormat memory_format = at::MemoryFormat::Contiguous) {
+  Tensor weight = weight_.contiguous(memory_format);
   if (weight.dim() == 5) {
     const int64_t s1 = weight.size(0);
     const int64_t s2 =
         weight.size(1) * weight.size(2) * weight.size(3) * weight.size(4);
-    return weight.view({s1, s2});
+    return memory_format == at::MemoryFormat::ChannelsLast3d
+        ? weight.as_strided({s1, s2}, {s2, 1}) // CL: C0 x (KD * KH * KW * C1)
+        : weight.view({s1, s2}); // CF: C0 x (C1 * KD * KH * KW)
   } else {
     return weight;
   }
@@ -283,29 +300,53 @@ static void slow_conv3d_update_output_frame(
     int64_t n_output_plane,
     int64_t output_depth,
     int64_t output_height,
-    int64_t output_width) {
+    int64_t output_width,
+    bool is_channels_last) {
   const int beta = has_bias ? 1 : 0;
 
   // Compute out = weight * input
   // Note gemm expects fortran order, so all 3 matrices are transposed.
   // Swapping argument order cancels this, since C == AB <=> T(C) == T(B)T(A)
-  const int64_t m = output_depth * output_height * output_width;
-  const int64_t n = (n_output_plane / groups);
-  const int64_t k = (n_input_plane / groups) * kernel_depth * kernel_height * kernel_width;
-
-  const int64_t lda = m;
-  const int64_t ldb = k;
-  const int64_t ldc = m;
-
-  at::native::cpublas::gemm_batched_with_stride(
-      TransposeType::NoTranspose,
-      TransposeType::NoTranspose,
-      groups, m, n, k,
-      static_cast<scalar_t>(1),
-      finput.data(), lda, finput.stride(0) * k,
-      weight.data(), ldb, weight.stride(0) * n,
-      static_cast<scalar_t>(beta),
-      output.data(), ldc, output.stride(0) * n);
+  if (is_channels_last) {
+    // channels-last columns are {output spatial, kernel * C}, so the channel
+    // dimension of the output lands innermost; grouped conv is handled by the
+    // contiguous path.
+    const int64_t m = n_output_plane;
+    const int64_t n = output_depth * output_height * output_width;
+    const int64_t k = n_input_plane * kernel_depth * kernel_height * kernel_width;
+
+    const int64_t lda = k;
+    const int64_t ldb = k;
+    const int64_t ldc = m;
+
+    at::native::cpublas::gemm(
+        TransposeType::Transpose,
+        TransposeType::NoTranspose,
+        m, n, k,
+        static_cast<scalar_t>(1),
+        weight.data(), lda,
+        finput.data(), ldb,
+        static_cast<scalar_t>(beta),
+        output.data(), ldc);
+  } else {
+    const int64_t m = output_depth * output_height * output_width;
+    const int64_t n = (n_output_plane / groups);
+    const int64_t k = (n_input_plane / groups) * kernel_depth * kernel_height * kernel_width;
+
+    const int64_t lda = m;
+    const int64_t ldb = k;
+    const int64_t ldc = m;
+
+    at::native::cpublas::gemm_batched_with_stride(
+        TransposeType::NoTranspose,
+        TransposeType::NoTranspose,
+        groups, m, n, k,
+        static_cast<scalar_t>(1),
+        finput.data(), lda, finput.stride(0) * k,
+        weight.data(), ldb, weight.stride(0) * n,
+        static_cast<scalar_t>(beta),
+        output.data(), ldc, output.stride(0) * n);
+  }
 }
 
 template <typename scalar_t>
@@ -323,27 +364,48 @@ void slow_conv3d_backward_update_grad_input_frame(
     int64_t pad_depth,
     int64_t pad_height,
     int64_t pad_width,
-    int64_t groups) {
+    int64_t groups,
+    bool is_channels_last) {
   // Compute fgrad_input = weight.T * grad_output.reshape({grad_output.shape(0), -1})
   // Note gemm expects fortran order, so all 3 matrices are transposed.
   // Swapping argument order cancels this, since C == AB <=> T(C) == T(B)T(A)
-  const int64_t m = grad_output.size(1) * grad_output.size(2) * grad_output.size(3);
-  const int64_t n = weight.size(1);
-  const int64_t k = weight.size(0) / groups;
-
-  const int64_t lda = m;
-  const int64_t ldb = n;
-  const int64_t ldc = m;
-
-  at::native::cpublas::gemm_batched_with_stride(
-      TransposeType::NoTranspose,
-      TransposeType::Transpose,
-      groups, m, n, k,
-      static_cast<scalar_t>(1),
-      grad_output.data(), lda, grad_output.stride(0) * k,
-      weight.data(), ldb, weight.stride(0) * k,
-      static_cast<scalar_t>(0),
-      fgrad_input.data(), ldc, fgrad_input.stride(0) * n);
+  if (is_channels_last) {
+    const int64_t m = weight.size(1);
+    const int64_t n = grad_output.size(1) * grad_output.size(2) * grad_output.size(3);
+    const int64_t k = weight.size(0);
+
+    const int64_t lda = m;
+    const int64_t ldb = k;
+    const int64_t ldc = m;
+
+    at::native::cpublas::gemm(
+        TransposeType::NoTranspose,
+        TransposeType::NoTranspose,
+        m, n, k,
+        static_cast<scalar_t>(1),
+        weight.data(), lda,
+        grad_output.data(), ldb,
+        static_cast<scalar_t>(0),
+        fgrad_input.data(), ldc);
+  } else {
+    const int64_t m = grad_output.size(1) * grad_output.size(2) * grad_output.size(3);
+    const int64_t n = weight.size(1);
+    const int64_t k = weight.size(0) / groups;
+
+    const int64_t lda = m;
+    const int64_t ldb = n;
+    const int64_t ldc = m;
+
+    at::native::cpublas::gemm_batched_with_stride(
+        TransposeType::NoTranspose,
+        TransposeType::Transpose,
+        groups, m, n, k,
+        static_cast<scalar_t>(1),
+        grad_output.data(), lda, grad_output.stride(0) * k,
+        weight.data(), ldb, weight.stride(0) * k,
+        static_cast<scalar_t>(0),
+        fgrad_input.data(), ldc, fgrad_input.stride(0) * n);
+  }
 
   Unfold3dAccCPU(
       c10::CppTypeToScalarType<scalar_t>::value,
@@ -364,7 +426,8 @@ void slow_conv3d_backward_update_grad_input_frame(
       pad_depth,
       pad_height,
       pad_width,
-      grad_input.data());
+      grad_input.data(),
+      is_channels_last);
 }
 
 void slow_conv3d_backward_out_cpu_template(
@@ -386,6 +449,11 @@ void slow_conv3d_backward_out_cpu_template(
   const int64_t stride_height = stride[1];
   const int64_t stride_width = stride[2];
 
+  bool use_channels_last =
+      thnn_conv_use_channels_last_3d(input, weight) && (groups == 1);
+  auto memory_format = use_channels_last ? at::MemoryFormat::ChannelsLast3d
+                                         : at::MemoryFormat::Contiguous;
+
   slow_conv3d_shape_check(
       input,
       grad_output,
@@ -403,10 +471,10 @@ void slow_conv3d_backward_out_cpu_template(
       groups,
       false);
 
-  const Tensor weight2d = view_weight_2d(weight);
-  const Tensor grad_output_contiguous = grad_output.contiguous();
-  grad_input.resize_as_(input);
-  TORCH_CHECK(grad_input.is_contiguous(), "grad_input must be contiguous")
+  const Tensor weight2d = view_weight_2d(weight, memory_format);
+  const Tensor grad_output_contiguous = grad_output.contiguous(memory_format);
+  grad_input.resize_as_(input, memory_format);
+  TORCH_CHECK(grad_input.is_contiguous(memory_format), "grad_input must be contiguous")
 
   const int64_t dim_planes = 1;
   const int64_t dim_depth = 2;
@@ -424,9 +492,14 @@ void slow_conv3d_backward_out_cpu_template(
       (input_width + 2 * pad_width - kernel_width) / stride_width + 1;
   const int64_t batch_size = input.size(0);
 
-  Tensor fgrad_input = at::empty({batch_size,
-      n_input_plane * kernel_depth * kernel_height * kernel_width,
-      output_depth * output_height * output_width}, input.options());
+  const int64_t fgrad_row = use_channels_last ?
+      output_depth * output_height * output_width :
+      n_input_plane * kernel_depth * kernel_height * kernel_width;
+  const int64_t fgrad_col = use_channels_last ?
+      kernel_depth * kernel_height * kernel_width * n_input_plane :
+      output_depth * output_height * output_width;
+  Tensor fgrad_input =
+      at::empty({batch_size, fgrad_row, fgrad_col}, input.options());
 
   AT_DISPATCH_FLOATING_TYPES_AND2(
       kBFloat16, kHalf, input.scalar_type(), "slow_conv3d_cpu_grad_input", [&] {
@@ -455,7 +528,8 @@ void slow_conv3d_backward_out_cpu_template(
               pad_depth,
               pad_height,
               pad_width,
-              groups);
+              groups,
+              use_channels_last);
         }
     });
   });
@@ -466,27 +540,48 @@ void slow_conv3d_backward_weight_frame(
     TensorAccessor<scalar_t, 2> grad_weight,
     TensorAccessor<const scalar_t, 4> grad_output,
     TensorAccessor<const scalar_t, 2> finput,
-    int64_t groups) {
+    int64_t groups,
+    bool is_channels_last) {
   // Compute grad_weight += grad_output.reshape({grad_output.shape(0), -1}) * finput.T
   // Note gemm expects fortran order, so all 3 matrices are transposed.
   // Swapping argument order cancels this, since C == AB <=> T(C) == T(B)T(A)
-  const int64_t m = grad_weight.size(1);
-  const int64_t n = grad_weight.size(0) / groups;
-  const int64_t k = grad_output.size(1) * grad_output.size(2) * grad_output.size(3);
-
-  const int64_t lda = k;
-  const int64_t ldb = k;
-  const int64_t ldc = m;
-
-  at::native::cpublas::gemm_batched_with_stride(
-      TransposeType::Transpose,
-      TransposeType::NoTranspose,
-      groups, m, n, k,
-      static_cast<scalar_t>(1),
-      finput.data(), lda, finput.stride(0) * m,
-      grad_output.data(), ldb, grad_output.stride(0) * n,
-      static_cast<scalar_t>(1),
-      grad_weight.data(), ldc, grad_weight.stride(0) * n);
+  if (is_channels_last) {
+    const int64_t m = finput.size(1);
+    const int64_t n = grad_weight.size(0);
+    const int64_t k = grad_output.size(1) * grad_output.size(2) * grad_output.size(3);
+
+    const int64_t lda = m;
+    const int64_t ldb = n;
+    const int64_t ldc = m;
+
+    at::native::cpublas::gemm(
+        TransposeType::NoTranspose,
+        TransposeType::Transpose,
+        m, n, k,
+        static_cast<scalar_t>(1),
+        finput.data(), lda,
+        grad_output.data(), ldb,
+        static_cast<scalar_t>(1),
+        grad_weight.data(), ldc);
+  } else {
+    const int64_t m = grad_weight.size(1);
+    const int64_t n = grad_weight.size(0) / groups;
+    const int64_t k = grad_output.size(1) * grad_output.size(2) * grad_output.size(3);
+
+    const int64_t lda = k;
+    const int64_t ldb = k;
+    const int64_t ldc = m;
+
+    at::native::cpublas::gemm_batched_with_stride(
+        TransposeType::Transpose,
+        TransposeType::NoTranspose,
+        groups, m, n, k,
+        static_cast<scalar_t>(1),
+        finput.data(), lda, finput.stride(0) * m,
+        grad_output.data(), ldb, grad_output.stride(0) * n,
+        static_cast<scalar_t>(1),
+        grad_weight.data(), ldc, grad_weight.stride(0) * n);
+  }
 }
 
 static void slow_conv3d_backward_parameters_out_cpu_template(
@@ -497,9 +592,6 @@ static void slow_conv3d_backward_parameters_out_cpu_template(
     IntArrayRef stride,
     IntArrayRef padding,
     int64_t groups) {
-  CheckedFrom c = "slow_conv3d_backward_parameters_cpu";
-  auto grad_weight_arg = TensorArg(grad_weight, "grad_weight_arg", 0);
-
   const int64_t kernel_depth = kernel_size[0];
   const int64_t kernel_height = kernel_size[1];
   const int64_t kernel_width = kernel_size[2];
@@ -510,6 +602,11 @@ static void slow_conv3d_backward_parameters_out_cpu_template(
   const int64_t stride_height = stride[1];
   const int64_t stride_width = stride[2];
 
+  bool use_channels_last =
+      thnn_conv_use_channels_last_3d(input, grad_weight) && (groups == 1);
+  auto memory_format = use_channels_last ? at::MemoryFormat::ChannelsLast3d
+                                         : at::MemoryFormat::Contiguous;
+
   slow_conv3d_shape_check(
       input,
       grad_output,
@@ -527,13 +624,15 @@ static void slow_conv3d_backward_parameters_out_cpu_template(
       groups,
       true);
 
-  Tensor grad_weight_2d = view_weight_2d(grad_weight);
-  checkContiguous(c, grad_weight_arg);
+  Tensor grad_weight_2d = view_weight_2d(grad_weight, memory_format);
+  TORCH_CHECK(grad_weight.is_contiguous(memory_format),
+      "slow_conv3d: grad_weight must be contiguous");
 
-  auto grad_output_contiguous = grad_output.contiguous();
+  auto grad_output_contiguous = grad_output.contiguous(memory_format);
 
   const int64_t batch_size = input.size(0);
-  Tensor finput = compute_columns3d(input, stride, padding, kernel_size, groups);
+  Tensor finput = compute_columns3d(
+      input, stride, padding, kernel_size, groups, use_channels_last);
 
   AT_DISPATCH_FLOATING_TYPES_AND2(
       kBFloat16, kHalf, input.scalar_type(), "slow_conv3d_cpu_grad_weight", [&] {
@@ -544,7 +643,7 @@ static void slow_conv3d_backward_parameters_out_cpu_template(
       auto grad_output_t = grad_output_a[t];
       auto finput_t = finput_a[t];
       slow_conv3d_backward_weight_frame(
-          grad_weight_2d_a, grad_output_t, finput_t, groups);
+          grad_weight_2d_a, grad_output_t, finput_t, groups, use_channels_last);
     }
   });
 }
@@ -575,6 +674,12 @@ Tensor& slow_conv3d_forward_out_cpu(const Tensor& self,
   // Assuming the group size is checked in upstream functions
   const int64_t groups = weight.size(1) > 0 ? self.size(1) / weight.size(1) : 0;
 
+  // grouped conv is only supported by the contiguous path
+  bool use_channels_last =
+      thnn_conv_use_channels_last_3d(self, weight) && (groups == 1);
+  auto memory_format = use_channels_last ? at::MemoryFormat::ChannelsLast3d
+                                         : at::MemoryFormat::Contiguous;
+
   slow_conv3d_shape_check(
       self,
       Tensor(),
@@ -592,8 +697,8 @@ Tensor& slow_conv3d_forward_out_cpu(const Tensor& self,
       groups,
       false);
 
-  const Tensor input = self.contiguous();
-  const Tensor weight_2d = view_weight_2d(weight);
+  const Tensor input = self.contiguous(memory_format);
+  const Tensor weight_2d = view_weight_2d(weight, memory_format);
 
   const int64_t dim_planes = 1;
   const int64_t dim_depth = 2;
@@ -612,15 +717,18 @@ Tensor& slow_conv3d_forward_out_cpu(const Tensor& self,
   const int64_t output_width =
       (input_width + 2 * pad_width - kernel_width) / stride_width + 1;
 
-  Tensor finput = compute_columns3d(input, stride, padding, kernel_size, groups);
+  Tensor finput = compute_columns3d(
+      input, stride, padding, kernel_size, groups, use_channels_last);
   const int64_t batch_size = input.size(0);
   output.resize_(
-      {batch_size, n_output_plane, output_depth, output_height, output_width});
+      {batch_size, n_output_plane, output_depth, output_height, output_width},
+      memory_format);
   if (bias.defined()) {
     output.copy_(bias.reshape({-1, 1, 1, 1}));
   }
 
-  TORCH_CHECK(output.is_contiguous(), "slow_conv3d output must be contiguous");
+  TORCH_CHECK(output.is_contiguous(memory_format),
+      "slow_conv3d output must be contiguous");
 
   AT_DISPATCH_ALL_TYPES_AND2(kBFloat16, kHalf, input.scalar_type(), "slow_conv3d_cpu", [&] {
     auto input_a = input.accessor<const scalar_t, 5>();
@@ -657,7 +765,8 @@ Tensor& slow_conv3d_forward_out_cpu(const Tensor& self,
                 n_output_plane,
                 output_depth,
                 output_height,
-                output_width);
+                output_width,
+                use_channels_last);
           }
         });
   });
@@ -715,7 +824,12 @@ static std::tuple<Tensor&, Tensor&, Tensor&> slow_conv3d_backward_out_cpu(const
   }
 
   if (grad_weight.defined()) {
-    grad_weight.resize_(weight.sizes());
+    // match the memory format the parameters template will pick for grad_weight
+    bool use_channels_last =
+        thnn_conv_use_channels_last_3d(self, weight) && (groups == 1);
+    grad_weight.resize_(weight.sizes(),
+        use_channels_last ? at::MemoryFormat::ChannelsLast3d
+                          : at::MemoryFormat::Contiguous);
     grad_weight.zero_();
     slow_conv3d_backward_parameters_out_cpu_template(
         grad_weight,
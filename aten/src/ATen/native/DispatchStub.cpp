@@ -7,8 +7,13 @@
 #if !defined(__s390x__) && !defined(__powerpc__)
 #include <cpuinfo.h>
 #endif
+#include <algorithm>
+#include <chrono>
 #include <cstdlib>
 #include <cstring>
+#include <limits>
+#include <mutex>
+#include <vector>
 
 #ifdef HAVE_ZVECTOR_CPU_DEFINITION
 #include <sys/auxv.h>
@@ -119,6 +124,77 @@ CPUCapability get_cpu_capability() {
   return capability;
 }
 
+namespace {
+
+std::mutex& calibration_mutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+std::vector<CPUCapabilityCalibrationEntry>& calibration_registry() {
+  static std::vector<CPUCapabilityCalibrationEntry> registry;
+  return registry;
+}
+
+double time_calibration_workload(const std::function<void()>& workload) {
+  // One warmup run to fault in code and data, then best-of-three to reduce
+  // scheduling noise.
+  workload();
+  auto best = std::numeric_limits<double>::infinity();
+  for (int i = 0; i < 3; ++i) {
+    auto start = std::chrono::steady_clock::now();
+    workload();
+    auto elapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start)
+            .count();
+    best = std::min(best, elapsed);
+  }
+  return best;
+}
+
+} // namespace
+
+void register_cpu_capability_calibration(CPUCapabilityCalibrationEntry entry) {
+  std::lock_guard<std::mutex> guard(calibration_mutex());
+  calibration_registry().push_back(std::move(entry));
+}
+
+void calibrate_cpu_capability() {
+  auto envar = std::getenv("ATEN_CPU_CAPABILITY_CALIBRATE");
+  if (!envar || strcmp(envar, "1") != 0) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(calibration_mutex());
+  static bool calibrated = false;
+  if (calibrated) {
+    return;
+  }
+  calibrated = true;
+  // Only tiers at or below the hardware capability are candidates; tiers
+  // whose kernel slot is nullptr fall back inside choose_cpu_impl, so timing
+  // them is harmless (they just tie with the fallback tier).
+  const auto max_capability = static_cast<int>(get_cpu_capability());
+  for (auto& entry : calibration_registry()) {
+    auto best_capability = max_capability;
+    auto best_time = std::numeric_limits<double>::infinity();
+    for (int capability = 0; capability <= max_capability; ++capability) {
+      entry.pin(static_cast<CPUCapability>(capability));
+      auto elapsed = time_calibration_workload(entry.workload);
+      if (elapsed < best_time) {
+        best_time = elapsed;
+        best_capability = capability;
+      }
+    }
+    if (best_capability == max_capability) {
+      // The winner matches the global choice; drop the pin so the family
+      // keeps following get_cpu_capability().
+      entry.pin(std::nullopt);
+    } else {
+      entry.pin(static_cast<CPUCapability>(best_capability));
+    }
+  }
+}
+
 DispatchResult DispatchStubImpl::try_get_call_ptr(
   const DeviceType device_type
   , void *DEFAULT
@@ -290,6 +366,9 @@ DispatchResult DispatchStubImpl::try_choose_cpu_impl(
   ){
 
   auto capability = static_cast<int>(get_cpu_capability());
+  if (auto pinned = pinned_cpu_capability.load(std::memory_order_relaxed)) {
+    capability = pinned - 1;
+  }
   (void)capability;
 #ifdef HAVE_AVX512_CPU_DEFINITION
   if (capability >= static_cast<int>(CPUCapability::AVX512)) {
@@ -351,6 +430,9 @@ void* DispatchStubImpl::choose_cpu_impl(
 #endif
 ) {
   auto capability = static_cast<int>(get_cpu_capability());
+  if (auto pinned = pinned_cpu_capability.load(std::memory_order_relaxed)) {
+    capability = pinned - 1;
+  }
   (void)capability;
 #ifdef HAVE_AVX512_CPU_DEFINITION
   if (capability >= static_cast<int>(CPUCapability::AVX512)) {
@@ -5,6 +5,8 @@
 #include <c10/util/Array.h>
 
 #include <atomic>
+#include <functional>
+#include <optional>
 #include <utility>
 #include <variant>
 
@@ -84,6 +86,34 @@ using DispatchResult = std::variant<void*, ErrorType>;
 
 CPUCapability get_cpu_capability();
 
+// One-shot CPU capability calibration.
+//
+// get_cpu_capability() picks a single tier for the whole process, and the
+// AVX512 slot of most stubs is registered as nullptr (see REGISTER_DISPATCH
+// below) because of downclocking concerns that do not hold on every
+// microarchitecture. Instead of trusting the global choice, a kernel family
+// can register a representative workload together with a callback that pins
+// a capability tier on its stubs; calibrate_cpu_capability() then times the
+// workload once under each tier the hardware supports and keeps the fastest
+// tier pinned for that family only. Calibration runs at most once, only when
+// ATEN_CPU_CAPABILITY_CALIBRATE=1 is set, and must be invoked after kernel
+// registration but before steady-state use (it executes the registered
+// workloads).
+struct CPUCapabilityCalibrationEntry {
+  // Human-readable kernel family name, used in diagnostics.
+  const char* family;
+  // Pins the given tier on the family's stubs via
+  // DispatchStub::set_cpu_capability_override(), or restores default
+  // dispatch when passed nullopt.
+  std::function<void(std::optional<CPUCapability>)> pin;
+  // Representative workload; run several times under each candidate tier.
+  std::function<void()> workload;
+};
+
+TORCH_API void register_cpu_capability_calibration(
+    CPUCapabilityCalibrationEntry entry);
+TORCH_API void calibrate_cpu_capability();
+
 template <typename FnPtr, typename T>
 struct DispatchStub;
 
@@ -198,6 +228,7 @@ struct TORCH_API DispatchStubImpl {
     void* xpu_dispatch_ptr;
   #endif
     void* privateuse1_dispatch_ptr;
+    std::atomic<int> pinned_cpu_capability;
   #else
     std::atomic<void*> cpu_dispatch_ptr{nullptr};
     void* cuda_dispatch_ptr = nullptr;
@@ -208,6 +239,10 @@ struct TORCH_API DispatchStubImpl {
     void* xpu_dispatch_ptr = nullptr;
   #endif
     void* privateuse1_dispatch_ptr = nullptr;
+    // Capability tier pinned by CPU capability calibration, stored as
+    // static_cast<int>(capability) + 1 so that zero-initialization (see the
+    // MSVC _DEBUG branch above) means "no pin".
+    std::atomic<int> pinned_cpu_capability{0};
   #endif
 };
 
@@ -276,6 +311,21 @@ public:
     impl.privateuse1_dispatch_ptr = reinterpret_cast<void*>(fn_ptr);
   }
 
+  // Pins an explicit capability tier for this stub, overriding the global
+  // get_cpu_capability() choice, and forces re-resolution on the next call.
+  // Installed per kernel family by calibrate_cpu_capability(); tiers whose
+  // slot is nullptr fall back the same way the global choice does.
+  void set_cpu_capability_override(CPUCapability capability) {
+    impl.pinned_cpu_capability.store(
+        static_cast<int>(capability) + 1, std::memory_order_relaxed);
+    impl.cpu_dispatch_ptr.store(nullptr, std::memory_order_relaxed);
+  }
+
+  void clear_cpu_capability_override() {
+    impl.pinned_cpu_capability.store(0, std::memory_order_relaxed);
+    impl.cpu_dispatch_ptr.store(nullptr, std::memory_order_relaxed);
+  }
+
   // Returns true if the dispatcher has a kernel registered for this device
   // type.
   bool is_device_supported(const c10::DeviceType device_type) {
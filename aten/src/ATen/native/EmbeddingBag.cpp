@@ -20,6 +20,7 @@
 #include <caffe2/perfkernels/embedding_lookup_idx.h>
 #endif
 
+#include <cmath>
 #include <cstring>
 #include <tuple>
 #include <utility>
@@ -37,6 +38,7 @@
 #include <ATen/ops/_embedding_bag_forward_only_native.h>
 #include <ATen/ops/_embedding_bag_native.h>
 #include <ATen/ops/_embedding_bag_per_sample_weights_backward_native.h>
+#include <ATen/ops/_embedding_bag_rowwise_adagrad_native.h>
 #include <ATen/ops/_embedding_bag_sparse_backward.h>
 #include <ATen/ops/_embedding_bag_sparse_backward_native.h>
 #include <ATen/ops/embedding_backward_native.h>
@@ -1638,6 +1640,162 @@ Tensor _embedding_bag_dense_backward_cpu(const Tensor &grad_, const Tensor &indi
   return index_grad_weight;
 }
 
+template <typename scalar_t>
+static void _embedding_bag_rowwise_adagrad_cpu_sum_mean(
+    Tensor& weight,
+    Tensor& state_sum,
+    const Tensor& grad,
+    const Tensor& indices_,
+    const Tensor& offset2bag_,
+    const Tensor& bag_size_,
+    int64_t mode,
+    double lr,
+    double eps,
+    int64_t padding_idx) {
+  // Sorts indices and groups them by unique embedding row, exactly like
+  // _embedding_bag_dense_backward_cpu_sum_mean. Each unique row is then
+  // owned by a single loop iteration, so the parallel loop can update
+  // weight and state_sum in place without synchronization.
+  auto ind_sort_ = indices_.sort();
+  auto indices = std::get<0>(ind_sort_);
+  auto ind_sort = std::get<1>(ind_sort_);
+  auto offset2bag = offset2bag_.index_select(0, ind_sort);
+
+  int64_t numel = indices.numel();
+  int64_t num_weights = weight.size(0);
+  int64_t ddim = weight.size(1);
+
+  scalar_t* weight_data = weight.data_ptr<scalar_t>();
+  scalar_t* state_sum_data = state_sum.data_ptr<scalar_t>();
+  const scalar_t* grad_data = grad.const_data_ptr<scalar_t>();
+
+  AT_DISPATCH_INDEX_TYPES(indices.scalar_type(), "_embedding_bag_rowwise_adagrad_cpu_", [&] {
+    auto* indices_data = indices.const_data_ptr<index_t>();
+    auto* offset2bag_data = offset2bag.const_data_ptr<index_t>();
+    auto* bag_size_data = bag_size_.const_data_ptr<index_t>();
+
+    auto counts = compute_counts(num_weights, indices_data, numel);
+    auto next_unique_index_idx =
+        compute_counts_uniq(num_weights, indices_data, numel, counts);
+
+    auto loop = [&](index_t start, index_t end) {
+      // scratch buffer for the row currently being updated; reused across rows
+      std::vector<scalar_t> row_grad(ddim);
+      for (index_t i = start; i < end; i++) {
+        index_t first = i == 0 ? 0 : next_unique_index_idx[i - 1];
+        index_t index = indices_data[first];
+
+        if (index == static_cast<index_t>(padding_idx)) {
+          continue;
+        }
+
+        // Accumulates the row's complete gradient from every bag it
+        // contributes to, as the dense backward's index_add would.
+        std::fill(row_grad.begin(), row_grad.end(), static_cast<scalar_t>(0));
+        for (index_t j = first; j < next_unique_index_idx[i]; j++) {
+          index_t source = offset2bag_data[j];
+          double scale = 1.0;
+          if (mode == EmbeddingBagMode::MEAN) {
+            auto bag_size = bag_size_data[source];
+            if (bag_size != 0) {
+              scale /= bag_size;
+            }
+          }
+          at::native::cpublas::axpy<scalar_t>(ddim, (scalar_t)scale,
+              grad_data + ddim * source, 1, row_grad.data(), 1);
+        }
+
+        // Rowwise adagrad: a single second-moment scalar per row, updated
+        // with the mean of the squared gradient.
+        scalar_t sq_sum = 0;
+        for (const auto d : c10::irange(ddim)) {
+          sq_sum += row_grad[d] * row_grad[d];
+        }
+        state_sum_data[index] += sq_sum / ddim;
+        const scalar_t step =
+            static_cast<scalar_t>(lr) / (std::sqrt(state_sum_data[index]) + static_cast<scalar_t>(eps));
+        at::native::cpublas::axpy<scalar_t>(ddim, -step,
+            row_grad.data(), 1, weight_data + ddim * index, 1);
+      }
+    };
+
+    if (numel > 1000) {
+      at::parallel_for(0, (int64_t)next_unique_index_idx.size(), 0, loop);
+    } else {
+      loop(0, (int64_t)next_unique_index_idx.size());
+    }
+  });
+}
+
+// Fused sparse rowwise-adagrad update for embedding_bag training. Applies the
+// optimizer step directly from the pooled output gradient, so each referenced
+// embedding row is read and written exactly once. This replaces materializing
+// the dense num_weights x ddim gradient via index_add plus a full-table
+// optimizer pass, neither of which touches only the rows that actually
+// appeared in the batch. indices, offset2bag and bag_size are the tensors
+// produced by the _embedding_bag forward.
+void _embedding_bag_rowwise_adagrad_cpu_(
+    Tensor& weight,
+    Tensor& state_sum,
+    const Tensor& grad_,
+    const Tensor& indices_,
+    const Tensor& offset2bag_,
+    const Tensor& bag_size,
+    int64_t mode,
+    double lr,
+    double eps,
+    int64_t padding_idx) {
+  TORCH_CHECK(
+      mode == EmbeddingBagMode::SUM || mode == EmbeddingBagMode::MEAN,
+      "_embedding_bag_rowwise_adagrad_: only sum and mean modes are supported, but got mode: ", mode);
+  TORCH_CHECK(weight.dim() == 2,
+      "_embedding_bag_rowwise_adagrad_: weight must be 2D, but got dim: ", weight.dim());
+  TORCH_CHECK(
+      state_sum.dim() == 1 && state_sum.size(0) == weight.size(0),
+      "_embedding_bag_rowwise_adagrad_: state_sum must hold one scalar per embedding row");
+  TORCH_CHECK(
+      weight.scalar_type() == state_sum.scalar_type() &&
+          weight.scalar_type() == grad_.scalar_type(),
+      "_embedding_bag_rowwise_adagrad_: weight, state_sum and grad must share a dtype, but got ",
+      weight.scalar_type(), ", ", state_sum.scalar_type(), " and ", grad_.scalar_type());
+  TORCH_CHECK(
+      weight.is_contiguous() && state_sum.is_contiguous(),
+      "_embedding_bag_rowwise_adagrad_: weight and state_sum must be contiguous");
+
+  auto grad = grad_.contiguous();
+  auto indices = indices_.contiguous();
+  auto offset2bag = offset2bag_.contiguous();
+  TORCH_CHECK(
+      grad.dim() == 2 && grad.size(1) == weight.size(1),
+      "_embedding_bag_rowwise_adagrad_: grad must be 2D with ", weight.size(1), " columns");
+  TORCH_CHECK(
+      offset2bag.numel() == indices.numel(),
+      "_embedding_bag_rowwise_adagrad_: offset2bag must map every index to its bag");
+  TORCH_CHECK(
+      indices.scalar_type() == offset2bag.scalar_type() &&
+          indices.scalar_type() == bag_size.scalar_type(),
+      "_embedding_bag_rowwise_adagrad_: indices, offset2bag and bag_size must share a dtype");
+
+  if (indices.numel() == 0) {
+    return;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES(
+      weight.scalar_type(), "_embedding_bag_rowwise_adagrad_", [&] {
+        _embedding_bag_rowwise_adagrad_cpu_sum_mean<scalar_t>(
+            weight,
+            state_sum,
+            grad,
+            indices,
+            offset2bag,
+            bag_size,
+            mode,
+            lr,
+            eps,
+            padding_idx);
+      });
+}
+
 template<typename scalar_t>
 Tensor _embedding_bag_per_sample_weights_backward_cpu_template(
     const Tensor& grad,
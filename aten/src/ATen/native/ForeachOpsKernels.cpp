@@ -29,6 +29,8 @@
 #include <ATen/ops/_foreach_expm1_native.h>
 #include <ATen/ops/_foreach_floor_native.h>
 #include <ATen/ops/_foreach_frac_native.h>
+#include <ATen/ops/_foreach_global_norm_native.h>
+#include <ATen/ops/_foreach_index_select_native.h>
 #include <ATen/ops/_foreach_lerp_native.h>
 #include <ATen/ops/_foreach_lgamma_native.h>
 #include <ATen/ops/_foreach_log10_native.h>
@@ -60,6 +62,7 @@
 #include <ATen/ops/maximum.h>
 #include <ATen/ops/minimum.h>
 #include <ATen/ops/pow.h>
+#include <ATen/ops/stack.h>
 #endif
 
 namespace at::native {
@@ -450,6 +453,18 @@ std::vector<Tensor> foreach_tensor_norm_slow(
   return result;
 }
 
+Tensor foreach_tensor_global_norm_slow(TensorList tensors, const Scalar& ord) {
+  check_foreach_api_restrictions(tensors);
+  std::vector<Tensor> norms;
+  norms.reserve(tensors.size());
+  for (const auto& t : tensors) {
+    norms.emplace_back(at::linalg_vector_norm(t, ord));
+  }
+  // The norm of the per-tensor norms is the norm of the concatenation of
+  // all inputs, for any ord (including inf).
+  return at::linalg_vector_norm(at::stack(norms), ord);
+}
+
 std::vector<Tensor> foreach_tensor_max_slow(TensorList tensors) {
   check_foreach_api_restrictions(tensors);
   std::vector<Tensor> result;
@@ -459,6 +474,18 @@ std::vector<Tensor> foreach_tensor_max_slow(TensorList tensors) {
   return result;
 }
 
+std::vector<Tensor> foreach_tensor_index_select_kernel_slow(
+    TensorList tensors,
+    const Tensor& index) {
+  check_foreach_api_restrictions(tensors);
+  std::vector<Tensor> result;
+  result.reserve(tensors.size());
+  for (const auto& t : tensors) {
+    result.emplace_back(t.index_select(0, index));
+  }
+  return result;
+}
+
 std::vector<Tensor> foreach_scalar_pow_list_kernel_slow(
     const Scalar& self,
     TensorList exponent) {
@@ -0,0 +1,53 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/native/ForeachTensorGroup.h>
+
+#include <ATen/native/ForeachUtils.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/empty.h>
+#endif
+
+namespace at::native {
+
+ForeachTensorGroup::ForeachTensorGroup(std::vector<Tensor> tensors)
+    : tensors_(std::move(tensors)) {
+  check_foreach_api_restrictions(tensors_);
+  can_use_fast_route_ = at::native::can_use_fast_route({tensor_list()});
+  for (const auto& t : tensors_) {
+    total_numel_ += t.numel();
+  }
+  // Pointers first, then numels; pinned so that a device-side consumer can
+  // issue an async copy of the metadata.
+  const auto nbytes = static_cast<int64_t>(
+      tensors_.size() * (sizeof(void*) + sizeof(int64_t)));
+  flat_metadata_ = at::empty(
+      {nbytes},
+      at::TensorOptions().dtype(at::kByte).pinned_memory(
+          !tensors_[0].is_cpu()));
+  refresh();
+}
+
+void ForeachTensorGroup::refresh() {
+  auto* base = flat_metadata_.mutable_data_ptr<uint8_t>();
+  auto** ptrs = reinterpret_cast<const void**>(base);
+  auto* numels =
+      reinterpret_cast<int64_t*>(base + tensors_.size() * sizeof(void*));
+  for (const auto i : c10::irange(tensors_.size())) {
+    ptrs[i] = tensors_[i].const_data_ptr();
+    numels[i] = tensors_[i].numel();
+  }
+}
+
+const void** ForeachTensorGroup::data_ptrs() const {
+  return reinterpret_cast<const void**>(flat_metadata_.data_ptr<uint8_t>());
+}
+
+const int64_t* ForeachTensorGroup::numels() const {
+  return reinterpret_cast<const int64_t*>(
+      flat_metadata_.data_ptr<uint8_t>() + tensors_.size() * sizeof(void*));
+}
+
+} // namespace at::native
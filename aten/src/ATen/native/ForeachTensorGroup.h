@@ -0,0 +1,68 @@
+#pragma once
+#include <ATen/core/Tensor.h>
+
+#include <vector>
+
+namespace at::native {
+
+// Persistent, pre-validated handle over a parameter group for fused
+// _foreach_* steps.
+//
+// Every _foreach_* call re-runs check_foreach_api_restrictions and the
+// fast-route checks over the whole TensorList and re-reads each tensor's
+// data pointer and numel, which is pure fixed overhead when the same
+// parameter group is stepped thousands of times. A ForeachTensorGroup runs
+// the validation once at construction and flattens the group's data
+// pointers and numels into a single contiguous host buffer -- pinned when
+// the group lives on an accelerator, so the metadata can be copied to the
+// device asynchronously -- letting a step loop hand the flattened view to
+// a fused kernel with zero per-step list processing.
+//
+// The group assumes the tensors' storages and geometry do not change after
+// construction (true for optimizer parameter groups); call refresh() after
+// anything that reallocates storage (e.g. resize_, .to()).
+class TORCH_API ForeachTensorGroup {
+ public:
+  explicit ForeachTensorGroup(std::vector<Tensor> tensors);
+
+  const std::vector<Tensor>& tensors() const {
+    return tensors_;
+  }
+
+  TensorList tensor_list() const {
+    return tensors_;
+  }
+
+  size_t size() const {
+    return tensors_.size();
+  }
+
+  int64_t total_numel() const {
+    return total_numel_;
+  }
+
+  // Result of the foreach fast-route checks (shared device/dtype, matching
+  // sizes and strides), computed once at construction.
+  bool can_use_fast_route() const {
+    return can_use_fast_route_;
+  }
+
+  // Flattened per-tensor data pointers / element counts, both of length
+  // size(). They live in one contiguous buffer owned by the group; the
+  // buffer is pinned when the group is not on CPU.
+  const void** data_ptrs() const;
+  const int64_t* numels() const;
+
+  // Re-reads the tensors' data pointers into the flattened buffer. Only
+  // needed if a tensor's storage was reallocated after construction.
+  void refresh();
+
+ private:
+  std::vector<Tensor> tensors_;
+  // Byte tensor holding [size() x void* | size() x int64_t].
+  Tensor flat_metadata_;
+  int64_t total_numel_ = 0;
+  bool can_use_fast_route_ = false;
+};
+
+} // namespace at::native
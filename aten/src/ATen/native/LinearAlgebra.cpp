@@ -20,9 +20,15 @@
 #include <ATen/native/Resize.h>
 #include <ATen/native/mkldnn/Matmul.h>
 #include <ATen/native/mkldnn/Utils.h>
+#include <ATen/detail/CUDAHooksInterface.h>
 #include <c10/core/GradMode.h>
 #include <c10/util/accumulate.h>
+#include <c10/util/flat_hash_map.h>
+#include <c10/util/hash.h>
 #include <c10/util/irange.h>
+#include <chrono>
+#include <mutex>
+#include <optional>
 #include <variant>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -32,6 +38,7 @@
 #include <ATen/ops/_addmm_activation_native.h>
 #include <ATen/ops/_compute_linear_combination_native.h>
 #include <ATen/ops/_convert_weight_to_int4pack_native.h>
+#include <ATen/ops/_grouped_mm_native.h>
 #include <ATen/ops/_int_mm_native.h>
 #include <ATen/ops/_linalg_check_errors.h>
 #include <ATen/ops/_linalg_det.h>
@@ -1923,6 +1930,156 @@ Tensor& vdot_out(const Tensor& self, const Tensor& other, Tensor& result) {
   return result.fill_(self.vdot(other));
 }
 
+// t->view(-1, t->size(-1)) is free iff the first dim() - 1 dimensions are
+// contiguous in the sense that stride[i] == stride[i+1] * size[i+1]
+static bool batch_dims_collapsible(const Tensor& t) {
+  const auto shape = t.sizes();
+  const auto strides = t.strides();
+  for (auto i = int64_t{0}; i < t.dim() - int64_t{2}; ++i) {
+    if (strides[i] != strides[i+1] * shape[i+1]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+namespace {
+
+// Per-process decision cache for the discretionary fold-vs-bmm choice in
+// matmul. Folding an operand whose batch dimensions cannot be collapsed into
+// a view forces reshape() to copy it wholesale, and whether that copy is
+// cheaper than the strided-bmm route depends on the shapes and strides at
+// hand. In the spirit of TunableOp we measure instead of guessing: the first
+// call with a given (shapes, strides, dtype) signature runs the fold route,
+// the second runs the bmm route, both timed end to end, and every call after
+// that takes the faster of the two.
+class MatmulDecisionCache {
+ public:
+  static MatmulDecisionCache& instance() {
+    static MatmulDecisionCache cache;
+    return cache;
+  }
+
+  // Picks the route for this signature (true = fold). Sets `measure` when
+  // the chosen route still needs its timing recorded via record().
+  bool choose_fold(size_t key, bool* measure) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& entry = entries_[key];
+    if (entry.fold_us < 0) {
+      *measure = true;
+      return true;
+    }
+    if (entry.bmm_us < 0) {
+      *measure = true;
+      return false;
+    }
+    *measure = false;
+    return entry.fold_us <= entry.bmm_us;
+  }
+
+  void record(size_t key, bool fold_route, double us) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto& entry = entries_[key];
+    (fold_route ? entry.fold_us : entry.bmm_us) = us;
+  }
+
+ private:
+  MatmulDecisionCache() = default;
+
+  struct Entry {
+    double fold_us = -1.0;
+    double bmm_us = -1.0;
+  };
+
+  std::mutex mutex_;
+  ska::flat_hash_map<size_t, Entry> entries_;
+};
+
+// Times one route of a discretionary matmul end to end and records it in the
+// decision cache. Synchronizes the device before and after so the
+// measurement covers the copies and kernels rather than just their launch;
+// this cost is paid once per signature and route.
+class MatmulRouteTimer {
+ public:
+  MatmulRouteTimer(size_t key, bool fold_route, at::Device device)
+      : key_(key), fold_route_(fold_route), device_(device) {
+    sync();
+    start_ = std::chrono::steady_clock::now();
+  }
+
+  ~MatmulRouteTimer() {
+    try {
+      sync();
+      const auto us = std::chrono::duration<double, std::micro>(
+                          std::chrono::steady_clock::now() - start_)
+                          .count();
+      MatmulDecisionCache::instance().record(key_, fold_route_, us);
+    } catch (...) {
+      // A failed sync (e.g. the routed call itself threw) just loses the
+      // sample; the next call with this signature measures again.
+    }
+  }
+
+  MatmulRouteTimer(const MatmulRouteTimer&) = delete;
+  MatmulRouteTimer& operator=(const MatmulRouteTimer&) = delete;
+
+ private:
+  void sync() const {
+    if (device_.is_cuda()) {
+      at::detail::getCUDAHooks().deviceSynchronize(device_.index());
+    }
+  }
+
+  size_t key_;
+  bool fold_route_;
+  at::Device device_;
+  std::chrono::steady_clock::time_point start_;
+};
+
+} // namespace
+
+// Identifies the matmul calls whose fold-vs-bmm choice is genuinely up for
+// debate: a fold candidate (see should_fold) where the larger operand's
+// batch dimensions cannot be collapsed into a view, so folding has to copy
+// the whole operand, yet should_fold folds anyway to keep the backward's
+// memory footprint small (the smaller operand requires grad). For those
+// calls the better route depends on whether the copy exceeds the compute,
+// which the decision cache settles by measurement. Returns the cache key
+// for such calls and nullopt for everything else.
+static std::optional<size_t> discretionary_fold_key(
+    const Tensor& tensor1,
+    const Tensor& tensor2,
+    bool has_out) {
+  const auto tensor1_larger = tensor1.dim() >= tensor2.dim();
+  const auto t1 = tensor1_larger ? MaybeOwned<Tensor>::borrowed(tensor1)
+                                 : MaybeOwned<Tensor>::owned(tensor2.mT());
+  const int64_t dim_t1 = t1->dim();
+  const auto dim_t2 = tensor1_larger ? tensor2.dim() : tensor1.dim();
+  if (!(dim_t1 >= 3 && dim_t2 <= 2)) {
+    return std::nullopt;
+  }
+  const bool t2_requires_grad = tensor1_larger ? tensor2.requires_grad()
+                                               : tensor1.requires_grad();
+  if (!t2_requires_grad || has_out) {
+    return std::nullopt;
+  }
+  if (t1->numel() == 0 || batch_dims_collapsible(*t1)) {
+    // Folding is free; nothing to arbitrate.
+    return std::nullopt;
+  }
+  auto seed = static_cast<size_t>(tensor1.scalar_type());
+  for (const Tensor* t : {&tensor1, &tensor2}) {
+    seed = c10::hash_combine(seed, static_cast<size_t>(t->dim()));
+    for (const auto s : t->sizes()) {
+      seed = c10::hash_combine(seed, static_cast<size_t>(s));
+    }
+    for (const auto s : t->strides()) {
+      seed = c10::hash_combine(seed, static_cast<size_t>(s));
+    }
+  }
+  return seed;
+}
+
 static bool should_fold(const Tensor& tensor1, const Tensor& tensor2, bool has_out) {
   // We check that we can fold the larger tensor into a matrix and dispatch to mm or mv rather than
   // to bmm. We want to make sure we can do so without incurring in any extra copy
@@ -1974,14 +2131,7 @@ static bool should_fold(const Tensor& tensor1, const Tensor& tensor2, bool has_o
 
   // t1->view(-1, t1->size(-1)) does not copy only when the first n-1 dimensions are contiguous
   // in the sense that t1_stride[i] = t1_stride[i+1]*t1_shape[i+1]
-  const auto t1_shape = t1->sizes();
-  const auto t1_strides = t1->strides();
-  for (auto i = int64_t{0}; i < dim_t1 - int64_t{2}; ++i) {
-    if (t1_strides[i] != t1_strides[i+1] * t1_shape[i+1]) {
-      return false;
-    }
-  }
-  return true;
+  return batch_dims_collapsible(*t1);
 }
 
 /*
@@ -2023,6 +2173,23 @@ static Tensor _matmul_impl(
     );
   }
 
+  // Fold-vs-bmm decision for the 3D+ branches below. For most signatures
+  // should_fold decides statically; when the fold route would have to copy
+  // its operand (see discretionary_fold_key) the decision cache measures
+  // each route once per shape signature and then sticks to the faster one.
+  bool fold_route = false;
+  std::optional<MatmulRouteTimer> route_timer;
+  if (dim_tensor1 >= 3 || dim_tensor2 >= 3) {
+    bool measure = false;
+    const auto key = discretionary_fold_key(tensor1, tensor2, has_out);
+    fold_route = key.has_value()
+        ? MatmulDecisionCache::instance().choose_fold(*key, &measure)
+        : should_fold(tensor1, tensor2, has_out);
+    if (measure) {
+      route_timer.emplace(*key, fold_route, tensor1.device());
+    }
+  }
+
   if (dim_tensor1 == 1 && dim_tensor2 == 1) {
     return has_out ? at::dot_out(out, tensor1, tensor2) : tensor1.dot(tensor2);
   } else if (dim_tensor1 == 2 && dim_tensor2 == 1) {
@@ -2032,7 +2199,7 @@ static Tensor _matmul_impl(
                    : tensor1.unsqueeze(0).mm(tensor2).squeeze_(0);
   } else if (dim_tensor1 == 2 && dim_tensor2 == 2) {
     return has_out ? at::mm_out(out, tensor1, tensor2) : tensor1.mm(tensor2);
-  } else if (should_fold(tensor1, tensor2, has_out)) {
+  } else if (fold_route) {
     // dim_tensor1 >=3 && (dim_tensor2 == 1 || dim_tensor2 == 2) ||
     // dim_tensor2 >=3 && (dim_tensor1 == 1 || dim_tensor1 == 2)
     // and at least one of the following two conditions hold
@@ -3599,5 +3766,44 @@ Tensor _int_mm_cpu(const Tensor& self, const Tensor& mat2) {
   return _int_mm_out_cpu(self, mat2, result);
 }
 
+Tensor _grouped_mm_cpu(const Tensor& self, const Tensor& mat2, const Tensor& group_sizes) {
+  TORCH_CHECK(self.dim() == 2, "_grouped_mm: Expected self to be of dimension 2 but got ", self.dim());
+  TORCH_CHECK(mat2.dim() == 3, "_grouped_mm: Expected mat2 to be of dimension 3 (groups x k x n) but got ", mat2.dim());
+  TORCH_CHECK(self.size(1) == mat2.size(1),
+      "_grouped_mm: self.size(1) needs to match mat2.size(1) but got ", self.size(1), " and ", mat2.size(1));
+  TORCH_CHECK(self.scalar_type() == mat2.scalar_type(),
+      "_grouped_mm: Expected self and mat2 to have the same dtype, but got ", self.scalar_type(), " and ", mat2.scalar_type());
+  TORCH_CHECK(group_sizes.dim() == 1 && group_sizes.scalar_type() == at::kLong && group_sizes.is_cpu(),
+      "_grouped_mm: Expected group_sizes to be a 1-D int64 CPU tensor");
+  TORCH_CHECK(group_sizes.size(0) == mat2.size(0),
+      "_grouped_mm: Expected one entry of group_sizes per group of mat2, but got ",
+      group_sizes.size(0), " and ", mat2.size(0));
+
+  auto group_sizes_contig = group_sizes.contiguous();
+  const int64_t* group_sizes_ptr = group_sizes_contig.const_data_ptr<int64_t>();
+  const int64_t num_groups = mat2.size(0);
+  int64_t total_m = 0;
+  for (const auto g : c10::irange(num_groups)) {
+    TORCH_CHECK(group_sizes_ptr[g] >= 0, "_grouped_mm: group_sizes must be non-negative");
+    total_m += group_sizes_ptr[g];
+  }
+  TORCH_CHECK(total_m == self.size(0),
+      "_grouped_mm: group_sizes must sum to self.size(0), but got ", total_m, " and ", self.size(0));
+
+  Tensor result = at::empty({self.size(0), mat2.size(2)}, self.options());
+  // Each group is a BLAS-backed mm over its row slice; group row counts vary
+  // so the fixed-size batched path does not apply.
+  int64_t offset = 0;
+  for (const auto g : c10::irange(num_groups)) {
+    if (group_sizes_ptr[g] == 0) {
+      continue;
+    }
+    auto result_slice = result.narrow(0, offset, group_sizes_ptr[g]);
+    at::mm_out(result_slice, self.narrow(0, offset, group_sizes_ptr[g]), mat2[g]);
+    offset += group_sizes_ptr[g];
+  }
+  return result;
+}
+
 } // namespace native
 } // namespace at
@@ -2,7 +2,9 @@
 #include <ATen/core/Tensor.h>
 #include <ATen/MemoryOverlap.h>
 #include <ATen/Context.h>
+#include <ATen/Parallel.h>
 #include <c10/core/Storage.h>
+#include <c10/util/irange.h>
 #include <ATen/EmptyTensor.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -15,9 +17,13 @@
 #include <ATen/ops/is_pinned_native.h>
 #include <ATen/ops/pin_memory_native.h>
 #include <ATen/ops/_pin_memory_native.h>
+#include <ATen/ops/_pin_memory_batch_native.h>
 #include <ATen/ops/empty_cpu_dispatch.h>
 #endif
 
+#include <cstring>
+#include <vector>
+
 namespace at::native {
 
 // Exposes at::has_internal_overlap as an operator for testing purposes
@@ -72,4 +78,67 @@ Tensor _pin_memory(const Tensor& self, std::optional<c10::Device> device) {
   return tensor;
 }
 
+std::vector<Tensor> _pin_memory_batch(TensorList tensors, std::optional<c10::Device> device) {
+  if (tensors.empty()) {
+    return {};
+  }
+  auto* allocator = device.has_value()?
+      at::globalContext().getPinnedMemoryAllocator(device.value().type()):
+      at::globalContext().getPinnedMemoryAllocator();
+
+  // Lay all tensors out in a single pinned slab, each at a 64-byte-aligned
+  // offset, so a batch costs one allocator round trip (and, with a caching
+  // host allocator, slabs of recurring batch shapes get reused) instead of
+  // one pinned allocation per tensor.
+  constexpr size_t kSlabAlignment = 64;
+  std::vector<size_t> offsets;
+  offsets.reserve(tensors.size());
+  size_t total_nbytes = 0;
+  for (const auto& tensor : tensors) {
+    TORCH_CHECK(
+        tensor.device().is_cpu() && tensor.layout() == Layout::Strided,
+        "cannot pin '", tensor.toString(), "' only dense CPU tensors can be pinned");
+    offsets.push_back(total_nbytes);
+    auto nbytes = detail::computeStorageNbytes(
+        tensor.sizes(), tensor.strides(), tensor.dtype().itemsize());
+    total_nbytes += (nbytes + kSlabAlignment - 1) / kSlabAlignment * kSlabAlignment;
+  }
+  auto storage = Storage(
+      Storage::use_byte_size_t(),
+      total_nbytes,
+      allocator,
+      /*resizable=*/false);
+
+  std::vector<Tensor> pinned;
+  pinned.reserve(tensors.size());
+  for (const auto i : c10::irange(tensors.size())) {
+    const auto& tensor = tensors[i];
+    // The slab alignment is a multiple of every itemsize, so the byte offset
+    // converts exactly to a storage offset in elements.
+    auto out = at::cpu::empty({0}, tensor.options())
+        .set_(storage,
+              static_cast<int64_t>(offsets[i] / tensor.dtype().itemsize()),
+              tensor.sizes(),
+              tensor.strides());
+    if (tensor.is_contiguous() && !tensor.is_conj() && !tensor.is_neg()) {
+      // Flat copy, chunked so large tensors spread across threads. Note that
+      // the DataLoader pin thread runs with a single thread configured, in
+      // which case this degenerates to one plain memcpy.
+      const char* src = static_cast<const char*>(tensor.const_data_ptr());
+      char* dst = static_cast<char*>(out.data_ptr());
+      at::parallel_for(
+          0,
+          static_cast<int64_t>(tensor.nbytes()),
+          at::internal::GRAIN_SIZE,
+          [&](int64_t begin, int64_t end) {
+            std::memcpy(dst + begin, src + begin, end - begin);
+          });
+    } else {
+      out.copy_(tensor);
+    }
+    pinned.push_back(std::move(out));
+  }
+  return pinned;
+}
+
 } // namespace at::native
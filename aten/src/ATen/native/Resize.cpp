@@ -8,6 +8,7 @@
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/reserve_native.h>
 #include <ATen/ops/resize_as_native.h>
 #include <ATen/ops/resize_native.h>
 #include <ATen/ops/resize.h>
@@ -90,9 +91,23 @@ const Tensor& _resize_output_(const Tensor& self, IntArrayRef shape, c10::Device
 void resize_bytes_cpu(StorageImpl* storage, size_t size_bytes) {
   TORCH_CHECK(storage->resizable(), "Trying to resize storage that is not resizable");
 
+  // Storages with reserved capacity (see reserve_bytes_cpu) resize within
+  // the existing allocation when possible and otherwise grow geometrically,
+  // so repeatedly appending to a tensor is amortized O(1) instead of
+  // reallocating and copying on every growth.
+  const auto reserved = storage->reserved_nbytes();
+  if (size_bytes <= reserved) {
+    storage->set_nbytes(size_bytes);
+    return;
+  }
+  auto alloc_bytes = size_bytes;
+  if (reserved > 0) {
+    alloc_bytes = std::max(size_bytes, storage->nbytes() * 2);
+  }
+
   at::DataPtr new_data;
-  if (size_bytes != 0) {
-    new_data = storage->allocator()->allocate(size_bytes);
+  if (alloc_bytes != 0) {
+    new_data = storage->allocator()->allocate(alloc_bytes);
   }
   const at::DataPtr& old_data = storage->data_ptr();
   const auto old_capacity = storage->nbytes();
@@ -102,6 +117,47 @@ void resize_bytes_cpu(StorageImpl* storage, size_t size_bytes) {
   }
   storage->set_data_ptr_noswap(std::move(new_data));
   storage->set_nbytes(size_bytes);
+  if (reserved > 0) {
+    storage->set_reserved_nbytes(alloc_bytes);
+  }
+}
+
+void reserve_bytes_cpu(StorageImpl* storage, size_t reserve_bytes) {
+  TORCH_CHECK(
+      storage->resizable(),
+      "Trying to reserve capacity in storage that is not resizable");
+
+  const auto capacity = std::max(storage->nbytes(), storage->reserved_nbytes());
+  if (reserve_bytes <= capacity) {
+    // The existing allocation already covers the request; just record the
+    // capacity so that later growth into it skips reallocation.
+    storage->set_reserved_nbytes(capacity);
+    return;
+  }
+
+  at::DataPtr new_data = storage->allocator()->allocate(reserve_bytes);
+  const at::DataPtr& old_data = storage->data_ptr();
+  const auto used_bytes = storage->nbytes();
+  if (old_data != nullptr && used_bytes > 0) {
+    memcpy(new_data.get(), old_data.get(), used_bytes);
+  }
+  storage->set_data_ptr_noswap(std::move(new_data));
+  storage->set_reserved_nbytes(reserve_bytes);
+}
+
+const Tensor& reserve_(const Tensor& self, int64_t numel) {
+  TORCH_CHECK(
+      numel >= 0, "reserve_: expected a non-negative element count, got ", numel);
+  auto* self_ = self.unsafeGetTensorImpl();
+  const Storage& storage = self_->unsafe_storage();
+  TORCH_CHECK(storage, "reserve_: tensor has no storage");
+  const auto itemsize = self_->dtype().itemsize();
+  const auto reserve_bytes =
+      (static_cast<size_t>(self_->storage_offset()) +
+       static_cast<size_t>(numel)) *
+      itemsize;
+  reserve_bytes_cpu(storage.unsafeGetStorageImpl(), reserve_bytes);
+  return self;
 }
 
 // Call the sparse implementation in SparseTensor.cpp directly.
@@ -37,6 +37,9 @@ TORCH_API bool resize_output_check(const Tensor& output, IntArrayRef shape);
 TORCH_API bool resize_output_check_symint(const Tensor& output, SymIntArrayRef shape);
 
 TORCH_API void resize_bytes_cpu(StorageImpl* storage, size_t size_bytes);
+// Grows the allocation to at least reserve_bytes without changing nbytes();
+// afterwards resize_bytes_cpu reuses the slack and grows geometrically.
+TORCH_API void reserve_bytes_cpu(StorageImpl* storage, size_t reserve_bytes);
 TORCH_API void resize_bytes_meta(StorageImpl* storage, c10::SymInt size_bytes);
 TORCH_API void resize_bytes_nocuda(const Storage& storage, const c10::SymInt& size_bytes);
 
@@ -4,6 +4,7 @@
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
 #include <ATen/NumericUtils.h>
+#include <ATen/Parallel.h>
 #include <ATen/TensorOperators.h>
 #include <c10/util/irange.h>
 
@@ -49,24 +50,49 @@ void _segment_reduce_lengths_cpu_kernel1(
   auto data_size_axis = data.size(axis);
   auto output_stride_axis = output.stride(axis);
   auto output_size_axis = output.size(axis);
+  // Parallelize across segments; each segment is still reduced by a
+  // single thread in index order, so the output is bitwise identical to
+  // the serial kernel regardless of the number of threads.
+  const int64_t avg_segment_work = segment_count > 0
+      ? std::max<int64_t>(data_size_axis * inner_offset / segment_count, 1)
+      : 1;
+  const int64_t grain_size =
+      std::max<int64_t>(at::internal::GRAIN_SIZE / avg_segment_work, 1);
   AT_DISPATCH_FLOATING_TYPES_AND2(
       kBFloat16, kHalf, data.scalar_type(), "_segment_reduce_cpu", [&]() {
         auto* output_data = output.data_ptr<scalar_t>();
         const auto* values_data = data.const_data_ptr<scalar_t>();
-        for (const auto outer_idx : c10::irange(outer_offset)) {
-          int64_t segment_start, segment_length;
-          int64_t segment_end = is_offsets_like ?
-                                lengths_data[outer_idx * lengths_stride_axis * lengths_size_axis] :
-                                0;
-          for (const auto dim_idx : c10::irange(segment_count)) {
-            segment_start = segment_end;
+        at::parallel_for(0, outer_offset * segment_count, grain_size,
+            [&](int64_t begin, int64_t end) {
+          int64_t outer_idx = begin / segment_count;
+          int64_t dim_idx = begin % segment_count;
+          // Recover the data offset of the first segment of this chunk:
+          // offsets store it directly, lengths require the prefix sum of
+          // the current outer row. The scan is paid once per chunk and
+          // is cheap next to the data walk below.
+          int64_t segment_start = 0;
+          if (!is_offsets_like) {
+            auto lengths_row = outer_idx * lengths_stride_axis * lengths_size_axis;
+            for (const auto j : c10::irange(dim_idx)) {
+              segment_start += lengths_data[lengths_row + j];
+            }
+          }
+          for (int64_t linear_idx = begin; linear_idx < end; ++linear_idx) {
+            if (dim_idx == segment_count) {
+              // Crossed into the next outer row.
+              ++outer_idx;
+              dim_idx = 0;
+              segment_start = 0;
+            }
             auto lengths_idx = outer_idx * lengths_stride_axis * lengths_size_axis + dim_idx;
+            int64_t segment_length, segment_end;
             if (is_offsets_like) {
+              segment_start = lengths_data[lengths_idx];
               segment_end = lengths_data[lengths_idx + 1];
               segment_length = segment_end - segment_start;
             } else {
               segment_length = lengths_data[lengths_idx];
-              segment_end += segment_length;
+              segment_end = segment_start + segment_length;
             }
             for (const auto inner_idx : c10::irange(inner_offset)) {
               // ===== step1: initialize starting value
@@ -122,8 +148,10 @@ void _segment_reduce_lengths_cpu_kernel1(
                                      + dim_idx * output_stride_axis + inner_idx;
               output_data[output_index] = initial_value;
             }
+            segment_start = segment_end;
+            ++dim_idx;
           }
-        }
+        });
       });
 }
 
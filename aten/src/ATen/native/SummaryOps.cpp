@@ -3,6 +3,7 @@
 
 #include <ATen/core/Tensor.h>
 #include <ATen/Dispatch.h>
+#include <ATen/Parallel.h>
 #include <c10/util/irange.h>
 
 #include <limits>
@@ -57,6 +58,16 @@ Tensor _bincount_cpu_template(
   nbins = std::max(nbins, minlength); // at least minlength # of bins
 
   const input_t* self_p = self.const_data_ptr<input_t>();
+
+  // Accumulate into per-thread histograms and merge per bin afterwards,
+  // same scheme as histogramdd_cpu_contiguous. Only worth it when the
+  // input is large relative to the number of bins; otherwise zeroing
+  // and merging the thread histograms dominates and the serial loop is
+  // used instead.
+  const int64_t num_threads = at::get_num_threads();
+  const bool parallelize = self_size >= at::internal::GRAIN_SIZE &&
+      nbins <= self_size / std::max<int64_t>(num_threads, 1);
+
   if (has_weights) {
     output = at::zeros(
         {nbins},
@@ -66,14 +77,58 @@ Tensor _bincount_cpu_template(
         weights.options().pinned_memory_opt());
     weights_t* output_p = output.data_ptr<weights_t>();
     const weights_t* weights_p = weights.const_data_ptr<weights_t>();
-    for (const auto i : c10::irange(self_size)) {
-      output_p[self_p[i]] += weights_p[i];
+    if (parallelize) {
+      Tensor thread_bins = at::zeros({num_threads, nbins}, output.options());
+      weights_t* thread_bins_p = thread_bins.data_ptr<weights_t>();
+      at::parallel_for(0, self_size, at::internal::GRAIN_SIZE,
+          [&](int64_t begin, int64_t end) {
+        weights_t* local_p = thread_bins_p + at::get_thread_num() * nbins;
+        for (const auto i : c10::irange(begin, end)) {
+          local_p[self_p[i]] += weights_p[i];
+        }
+      });
+      at::parallel_for(0, nbins, at::internal::GRAIN_SIZE,
+          [&](int64_t begin, int64_t end) {
+        for (const auto bin : c10::irange(begin, end)) {
+          weights_t sum = 0;
+          for (const auto t : c10::irange(num_threads)) {
+            sum += thread_bins_p[t * nbins + bin];
+          }
+          output_p[bin] = sum;
+        }
+      });
+    } else {
+      for (const auto i : c10::irange(self_size)) {
+        output_p[self_p[i]] += weights_p[i];
+      }
     }
   } else {
     output = at::zeros({nbins}, kLong);
     int64_t* output_p = output.data_ptr<int64_t>();
-    for (const auto i : c10::irange(self_size)) {
-      output_p[self_p[i]] += 1L;
+    if (parallelize) {
+      Tensor thread_bins = at::zeros({num_threads, nbins}, kLong);
+      int64_t* thread_bins_p = thread_bins.data_ptr<int64_t>();
+      at::parallel_for(0, self_size, at::internal::GRAIN_SIZE,
+          [&](int64_t begin, int64_t end) {
+        int64_t* local_p = thread_bins_p + at::get_thread_num() * nbins;
+        for (const auto i : c10::irange(begin, end)) {
+          local_p[self_p[i]] += 1L;
+        }
+      });
+      at::parallel_for(0, nbins, at::internal::GRAIN_SIZE,
+          [&](int64_t begin, int64_t end) {
+        for (const auto bin : c10::irange(begin, end)) {
+          int64_t sum = 0;
+          for (const auto t : c10::irange(num_threads)) {
+            sum += thread_bins_p[t * nbins + bin];
+          }
+          output_p[bin] = sum;
+        }
+      });
+    } else {
+      for (const auto i : c10::irange(self_size)) {
+        output_p[self_p[i]] += 1L;
+      }
     }
   }
   return output;
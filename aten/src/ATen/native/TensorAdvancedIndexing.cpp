@@ -1238,6 +1238,33 @@ static void check_indexarray_range(
   }
 }
 
+// Software-prefetch pipelining for the contiguous index_select fast
+// path: while the row for index i is being copied, the row a fixed
+// distance ahead is translated and prefetched, hiding DRAM latency when
+// indices land randomly in a table much larger than cache (embedding
+// lookups). Only the leading cache lines of a row are prefetched so
+// very wide rows do not flush the cache.
+constexpr int64_t kIndexSelectPrefetchDistance = 8;
+// Below this many indices per task there is too little work to hide the
+// latency behind, so the plain loop is used.
+constexpr int64_t kIndexSelectPrefetchMinIndices = 256;
+
+static inline void prefetch_index_select_row(
+    const char* row,
+    int64_t row_bytes) {
+#if defined(__GNUC__) || defined(__clang__)
+  constexpr int64_t kCacheLineBytes = 64;
+  constexpr int64_t kMaxPrefetchBytes = 256;
+  const int64_t bytes = std::min(row_bytes, kMaxPrefetchBytes);
+  for (int64_t off = 0; off < bytes; off += kCacheLineBytes) {
+    __builtin_prefetch(row + off, /*rw=*/0, /*locality=*/3);
+  }
+#else
+  (void)row;
+  (void)row_bytes;
+#endif
+}
+
 static Tensor & index_select_out_cpu_dim1_(
     Tensor & result_contig, const Tensor & self, const Tensor & index_contig) {
 
@@ -1266,6 +1293,8 @@ static Tensor & index_select_out_cpu_dim1_(
       const auto* idxs = index_contig.const_data_ptr<index_t>();
       check_indexarray_range<index_t>(idxs, N, src_indexing_axis_dim);
 
+      const bool prefetch = N >= kIndexSelectPrefetchMinIndices;
+
       // Special-case single-float copy for efficiency
       if (self.scalar_type() == ScalarType::Float && block_size == 1) {
         for (const auto batch : c10::irange(outer_dims_product)) {
@@ -1275,6 +1304,11 @@ static Tensor & index_select_out_cpu_dim1_(
 
           for (const auto i : c10::irange(N)) {
             auto idx = idxs[i];
+            if (prefetch && i + kIndexSelectPrefetchDistance < N) {
+              prefetch_index_select_row(
+                  (const char*)(src_floats + idxs[i + kIndexSelectPrefetchDistance]),
+                  sizeof(float));
+            }
             dst_floats[i] = src_floats[idx];
           }
         }
@@ -1284,6 +1318,12 @@ static Tensor & index_select_out_cpu_dim1_(
         for (const auto batch : c10::irange(outer_dims_product)) {
           for (const auto i : c10::irange(N)) {
             auto idx = idxs[i];
+            if (prefetch && i + kIndexSelectPrefetchDistance < N) {
+              auto next_idx = idxs[i + kIndexSelectPrefetchDistance];
+              prefetch_index_select_row(
+                  src_base + batch * src_batch_bytesize + next_idx * block_bytesize,
+                  block_bytesize);
+            }
             auto src = src_base + batch * src_batch_bytesize + idx * block_bytesize;
             auto dst = out + batch * gathered_batch_bytesize + i * block_bytesize;
             memcpy(dst, src, block_bytesize);
@@ -1395,9 +1435,21 @@ Tensor & index_select_out_cpu_(const Tensor & self, int64_t dim, const Tensor &
             [&index_contig, &slice_size_bytes, &self_dim_size, &selfSlice_data,
               &self_stride_bytes, &resultSlice_data, &result_stride_bytes, &start, &end] () {
             auto index_data = index_contig.const_data_ptr<index_t>();
+            const bool prefetch = end - start >= kIndexSelectPrefetchMinIndices;
             for (const auto i : c10::irange(start, end)) {
               auto self_i = index_data[i];
               TORCH_CHECK_INDEX((self_i >= 0) && (self_i < self_dim_size), "index out of range in self");
+              if (prefetch && i + kIndexSelectPrefetchDistance < end) {
+                auto next_i = index_data[i + kIndexSelectPrefetchDistance];
+                // Bounds are enforced (with an error) when the copy
+                // reaches this index; here an out-of-range value just
+                // skips the hint.
+                if (next_i >= 0 && next_i < self_dim_size) {
+                  prefetch_index_select_row(
+                      static_cast<const char*>(selfSlice_data) + next_i * self_stride_bytes,
+                      slice_size_bytes);
+                }
+              }
               auto self_data = static_cast<const char*>(selfSlice_data) + self_i * self_stride_bytes;
               auto result_data = static_cast<char*>(resultSlice_data) + i * result_stride_bytes;
               memcpy(result_data, self_data, slice_size_bytes);
@@ -2046,6 +2098,65 @@ Tensor masked_fill(const Tensor & self, const Tensor & mask, const Tensor & sour
   return result;
 }
 
+// Fully parallel two-phase masked_select for contiguous input and mask,
+// following the structure of nonzero_out_cpu below: pass 1 counts selected
+// elements per thread, an exclusive scan over the per-thread counts yields
+// each thread's output offset, and pass 2 fills the output in parallel.
+// Unlike the prefix-sum fallback in masked_select_out_impl_cpu this needs
+// no int64 scratch proportional to the input and has no serial O(n) scan,
+// so it scales with the number of cores on large masks.
+static Tensor& masked_select_two_pass_cpu(
+    Tensor& result,
+    const Tensor& self,
+    const Tensor& mask) {
+  const auto numel = self.numel();
+  const bool* mask_data = mask.const_data_ptr<bool>();
+
+  const auto num_threads = at::get_num_threads();
+  DimVector thread_begin(num_threads, -1);
+  DimVector thread_count(num_threads + 1);
+
+  // Pass 1: count selected elements per thread
+  at::parallel_for(0, numel, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+    const auto tid = at::get_thread_num();
+    thread_begin[tid] = begin;
+    thread_count[tid + 1] = std::count(mask_data + begin, mask_data + end, true);
+  });
+
+  // Convert thread-local counts to cumulative sum
+  for (const auto i : c10::irange(1, thread_count.size())) {
+    thread_count[i] += thread_count[i - 1];
+  }
+
+  const auto total = thread_count[num_threads];
+  at::native::resize_output(result, {total});
+  if (total == 0) {
+    return result;
+  }
+  const auto result_stride = result.strides()[0];
+
+  // Pass 2: each thread fills its slice of the output
+  AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(ScalarType::Bool, ScalarType::BFloat16, ScalarType::Half,
+    self.scalar_type(), "masked_select", [&] {
+      const scalar_t* self_data = self.const_data_ptr<scalar_t>();
+      scalar_t* result_data = result.data_ptr<scalar_t>();
+      at::parallel_for(0, numel, internal::GRAIN_SIZE, [&](int64_t begin, int64_t end) {
+        const auto tid = at::get_thread_num();
+        // Work needs to be distributed the same on both passes
+        TORCH_INTERNAL_ASSERT_DEBUG_ONLY(begin == thread_begin[tid]);
+
+        scalar_t* out = result_data + thread_count[tid] * result_stride;
+        for (const auto i : c10::irange(begin, end)) {
+          if (mask_data[i]) {
+            *out = self_data[i];
+            out += result_stride;
+          }
+        }
+      });
+    });
+  return result;
+}
+
 static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self, const Tensor & mask) {
   NoNamesGuard guard;
 
@@ -2060,6 +2171,14 @@ static Tensor & masked_select_out_impl_cpu(Tensor & result, const Tensor & self,
 
   auto [_mask, _self] = expand_outplace(mask, self);
 
+  // Multi-threaded two-phase kernel for large contiguous inputs; it counts,
+  // resizes the output and fills it itself.
+  if (_self->is_contiguous() && _mask->is_contiguous() &&
+      _self->numel() >= at::internal::GRAIN_SIZE &&
+      at::get_num_threads() > 1) {
+    return masked_select_two_pass_cpu(result, *_self, *_mask);
+  }
+
   auto shape = _self->sizes();
   int64_t numel = _mask->sum().item().toLong();
   at::native::resize_output(result, {numel});
@@ -342,6 +342,7 @@ TORCH_PRECOMPUTE_META_FUNC(cat)(const ITensorListRef& tensors, int64_t dim) {
 namespace at::native {
 
 DEFINE_DISPATCH(cat_serial_stub);
+DEFINE_DISPATCH(cat_parallel_stub);
 DEFINE_DISPATCH(stack_serial_stub);
 
 Tensor _reshape_from_tensor(const Tensor& self, const Tensor& shape_tensor) {
@@ -599,6 +600,15 @@ TORCH_IMPL_FUNC(cat_out_cpu)
     return;
   }
 
+  // Multi-threaded counterpart of the serial fast path: partitions the flat
+  // output across threads, splitting work both across inputs (many small
+  // tensors) and within large inputs, instead of launching one parallel
+  // copy per input sequentially.
+  if (all_contiguous && all_same_dtype && serial_dtype) {
+    cat_parallel_stub(kCPU, result, materialized, dim);
+    return;
+  }
+
   int64_t offset = 0;
   if (all_same_sizes_and_stride && result.is_contiguous(memory_format) &&
       all_same_dtype) {
@@ -299,6 +299,64 @@ void Unfold3dCopyKernelImpl(
   });
 }
 
+// Unfolds NDHWC input into columns of shape
+// {Y_D * Y_H * Y_W, kernel_d * kernel_h * kernel_w * C} so that the channel
+// dimension stays innermost. Each (output position, kernel offset) pair maps to
+// one contiguous row of C elements in both src and dst.
+template <typename T>
+void Unfold3dChannelsLastCopyKernelImpl(
+    int64_t C,
+    int64_t X_D,
+    int64_t X_H,
+    int64_t X_W,
+    int64_t Y_D,
+    int64_t Y_H,
+    int64_t Y_W,
+    int64_t kernel_d,
+    int64_t kernel_h,
+    int64_t kernel_w,
+    int64_t stride_d,
+    int64_t stride_h,
+    int64_t stride_w,
+    int64_t pad_d,
+    int64_t pad_h,
+    int64_t pad_w,
+    const T* src,
+    T* dst) {
+  const int64_t n = Y_D * Y_H * Y_W;
+  const int64_t kernel_size = kernel_d * kernel_h * kernel_w;
+  at::parallel_for(0, n, 0, [=](int64_t begin, int64_t end) {
+    for (const auto p : c10::irange(begin, end)) {
+      int64_t q = p;
+      const int64_t yw = q % Y_W;
+      q /= Y_W;
+      const int64_t yh = q % Y_H;
+      q /= Y_H;
+      const int64_t yd = q;
+      T* dst_ptr = dst + p * kernel_size * C;
+      for (const auto kd : c10::irange(kernel_d)) {
+        const int64_t xd = yd * stride_d - pad_d + kd;
+        for (const auto kh : c10::irange(kernel_h)) {
+          const int64_t xh = yh * stride_h - pad_h + kh;
+          for (const auto kw : c10::irange(kernel_w)) {
+            const int64_t xw = yw * stride_w - pad_w + kw;
+            if (IsAGeZeroAndALtB(xd, X_D) && IsAGeZeroAndALtB(xh, X_H) &&
+                IsAGeZeroAndALtB(xw, X_W)) {
+              std::memcpy(
+                  dst_ptr,
+                  src + ((xd * X_H + xh) * X_W + xw) * C,
+                  C * sizeof(T));
+            } else {
+              std::memset(dst_ptr, 0, C * sizeof(T));
+            }
+            dst_ptr += C;
+          }
+        }
+      }
+    }
+  });
+}
+
 template <typename T>
 void Unfold3dZeroPaddingAccKernelImpl(
     int64_t C,
@@ -430,6 +488,54 @@ void Unfold3dAccKernelImpl(
   });
 }
 
+// Folds channels-last columns back into NDHWC input. Overlapping windows
+// accumulate into the same input rows, so unlike the copy kernel this one is
+// not parallelized over output positions.
+template <typename T>
+void Unfold3dChannelsLastAccKernelImpl(
+    int64_t C,
+    int64_t X_D,
+    int64_t X_H,
+    int64_t X_W,
+    int64_t Y_D,
+    int64_t Y_H,
+    int64_t Y_W,
+    int64_t kernel_d,
+    int64_t kernel_h,
+    int64_t kernel_w,
+    int64_t stride_d,
+    int64_t stride_h,
+    int64_t stride_w,
+    int64_t pad_d,
+    int64_t pad_h,
+    int64_t pad_w,
+    const T* src,
+    T* dst) {
+  std::memset(dst, 0, X_D * X_H * X_W * C * sizeof(T));
+  const T* src_ptr = src;
+  for (const auto yd : c10::irange(Y_D)) {
+    for (const auto yh : c10::irange(Y_H)) {
+      for (const auto yw : c10::irange(Y_W)) {
+        for (const auto kd : c10::irange(kernel_d)) {
+          const int64_t xd = yd * stride_d - pad_d + kd;
+          for (const auto kh : c10::irange(kernel_h)) {
+            const int64_t xh = yh * stride_h - pad_h + kh;
+            for (const auto kw : c10::irange(kernel_w)) {
+              const int64_t xw = yw * stride_w - pad_w + kw;
+              if (IsAGeZeroAndALtB(xd, X_D) && IsAGeZeroAndALtB(xh, X_H) &&
+                  IsAGeZeroAndALtB(xw, X_W)) {
+                T* dst_ptr = dst + ((xd * X_H + xh) * X_W + xw) * C;
+                MatAdd<T>(1, C, C, C, src_ptr, dst_ptr);
+              }
+              src_ptr += C;
+            }
+          }
+        }
+      }
+    }
+  }
+}
+
 } // namespace
 
 void Unfold3dCopyCPU(
@@ -451,14 +557,18 @@ void Unfold3dCopyCPU(
     int64_t pad_d,
     int64_t pad_h,
     int64_t pad_w,
-    void* dst) {
+    void* dst,
+    bool is_channels_last) {
   AT_DISPATCH_ALL_TYPES_AND2(
       at::ScalarType::BFloat16,
       at::ScalarType::Half,
       dtype,
       "Unfold3dCopyCPU",
       [=, &src]() {
-        Unfold3dCopyKernelImpl<scalar_t>(
+        auto* kernel_impl = is_channels_last
+            ? &Unfold3dChannelsLastCopyKernelImpl<scalar_t>
+            : &Unfold3dCopyKernelImpl<scalar_t>;
+        kernel_impl(
             C,
             X_D,
             X_H,
@@ -499,14 +609,18 @@ void Unfold3dAccCPU(
     int64_t pad_d,
     int64_t pad_h,
     int64_t pad_w,
-    void* dst) {
+    void* dst,
+    bool is_channels_last) {
   AT_DISPATCH_ALL_TYPES_AND2(
       at::ScalarType::BFloat16,
       at::ScalarType::Half,
       dtype,
       "Unfold3dAccCPU",
       [=, &src]() {
-        Unfold3dAccKernelImpl<scalar_t>(
+        auto* kernel_impl = is_channels_last
+            ? &Unfold3dChannelsLastAccKernelImpl<scalar_t>
+            : &Unfold3dAccKernelImpl<scalar_t>;
+        kernel_impl(
             C,
             X_D,
             X_H,
@@ -23,7 +23,8 @@ void Unfold3dCopyCPU(
     int64_t pad_d,
     int64_t pad_h,
     int64_t pad_w,
-    void* dst);
+    void* dst,
+    bool is_channels_last);
 
 void Unfold3dAccCPU(
     ScalarType dtype,
@@ -44,6 +45,7 @@ void Unfold3dAccCPU(
     int64_t pad_d,
     int64_t pad_h,
     int64_t pad_w,
-    void *dst);
+    void *dst,
+    bool is_channels_last);
 
 } // namespace at::native
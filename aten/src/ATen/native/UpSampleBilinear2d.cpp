@@ -11,10 +11,12 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_resize_normalize_native.h>
 #include <ATen/ops/_upsample_bilinear2d_aa.h>
 #include <ATen/ops/_upsample_bilinear2d_aa_backward.h>
 #include <ATen/ops/_upsample_bilinear2d_aa_backward_native.h>
 #include <ATen/ops/_upsample_bilinear2d_aa_native.h>
+#include <ATen/ops/empty.h>
 #include <ATen/ops/upsample_bilinear2d.h>
 #include <ATen/ops/upsample_bilinear2d_backward.h>
 #include <ATen/ops/upsample_bilinear2d_backward_native.h>
@@ -179,9 +181,56 @@ Tensor _upsample_bilinear2d_aa(
   return at::_upsample_bilinear2d_aa(input, osize, align_corners, scale_h, scale_w);
 }
 
+Tensor _resize_normalize_cpu(
+    const Tensor& input,
+    IntArrayRef output_size,
+    bool align_corners,
+    ArrayRef<double> mean,
+    ArrayRef<double> std,
+    bool output_channels_last,
+    std::optional<double> scales_h,
+    std::optional<double> scales_w) {
+  TORCH_CHECK(
+      input.dim() == 4,
+      "_resize_normalize: expected a 4D (N, C, H, W) input but got a tensor with sizes ",
+      input.sizes());
+  TORCH_CHECK(
+      input.scalar_type() == at::kByte,
+      "_resize_normalize: expected a uint8 input but got ",
+      input.scalar_type());
+  const auto num_channels = input.size(1);
+  TORCH_CHECK(
+      static_cast<int64_t>(mean.size()) == num_channels &&
+          static_cast<int64_t>(std.size()) == num_channels,
+      "_resize_normalize: mean and std must have one entry per channel, but got ",
+      mean.size(), " mean and ", std.size(), " std entries for ",
+      num_channels, " channels");
+  for (const auto c : c10::irange(num_channels)) {
+    TORCH_CHECK(std[c] != 0, "_resize_normalize: std[", c, "] is zero");
+  }
+
+  // Resize in channels last so that the uint8 AVX path can skip its
+  // packing/unpacking passes; the normalize pass below takes care of the
+  // layout permute when a contiguous output was requested.
+  auto resized = at::_upsample_bilinear2d_aa(
+      input.contiguous(at::MemoryFormat::ChannelsLast),
+      output_size,
+      align_corners,
+      scales_h,
+      scales_w);
+  auto output = at::empty(
+      resized.sizes(),
+      input.options().dtype(at::kFloat),
+      output_channels_last ? at::MemoryFormat::ChannelsLast
+                           : at::MemoryFormat::Contiguous);
+  resize_normalize_kernel(kCPU, output, resized, mean, std);
+  return output;
+}
+
 DEFINE_DISPATCH(upsample_bilinear2d_kernel);
 DEFINE_DISPATCH(upsample_bilinear2d_backward_kernel);
 DEFINE_DISPATCH(_upsample_bilinear2d_aa_kernel);
 DEFINE_DISPATCH(_upsample_bilinear2d_aa_backward_kernel);
+DEFINE_DISPATCH(resize_normalize_kernel);
 
 } // namespace at::native
@@ -451,6 +451,21 @@ void logical_and_kernel(TensorIterator& iter) {
           cpu_kernel(
               iter, [](scalar_t a, scalar_t b) -> bool { return a && b; });
         });
+  } else if (iter.common_dtype() == kBFloat16) {
+    cpu_kernel_vec(
+        iter,
+        [](BFloat16 a, BFloat16 b) -> BFloat16 {
+          return static_cast<BFloat16>(a && b);
+        },
+        [](Vectorized<BFloat16> a, Vectorized<BFloat16> b) {
+          auto [a0, a1] = convert_bfloat16_float(a);
+          auto [b0, b1] = convert_bfloat16_float(b);
+          const auto zero = Vectorized<float>(0);
+          const auto one = Vectorized<float>(1);
+          a0 = Vectorized<float>::blendv(one, zero, (a0 == zero) | (b0 == zero));
+          a1 = Vectorized<float>::blendv(one, zero, (a1 == zero) | (b1 == zero));
+          return convert_float_bfloat16(a0, a1);
+        });
   } else {
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND2(
         kBFloat16, kHalf, iter.common_dtype(), "logical_and_cpu", [&]() {
@@ -469,6 +484,21 @@ void logical_or_kernel(TensorIterator& iter) {
           cpu_kernel(
               iter, [](scalar_t a, scalar_t b) -> bool { return a || b; });
         });
+  } else if (iter.common_dtype() == kBFloat16) {
+    cpu_kernel_vec(
+        iter,
+        [](BFloat16 a, BFloat16 b) -> BFloat16 {
+          return static_cast<BFloat16>(a || b);
+        },
+        [](Vectorized<BFloat16> a, Vectorized<BFloat16> b) {
+          auto [a0, a1] = convert_bfloat16_float(a);
+          auto [b0, b1] = convert_bfloat16_float(b);
+          const auto zero = Vectorized<float>(0);
+          const auto one = Vectorized<float>(1);
+          a0 = Vectorized<float>::blendv(one, zero, (a0 == zero) & (b0 == zero));
+          a1 = Vectorized<float>::blendv(one, zero, (a1 == zero) & (b1 == zero));
+          return convert_float_bfloat16(a0, a1);
+        });
   } else {
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND3(
         kBool, kBFloat16, kHalf, iter.common_dtype(), "logical_or_cpu", [&]() {
@@ -488,6 +518,21 @@ void logical_xor_kernel(TensorIterator& iter) {
             return bool(a) != bool(b);
           });
         });
+  } else if (iter.common_dtype() == kBFloat16) {
+    cpu_kernel_vec(
+        iter,
+        [](BFloat16 a, BFloat16 b) -> BFloat16 {
+          return static_cast<BFloat16>(bool(a) != bool(b));
+        },
+        [](Vectorized<BFloat16> a, Vectorized<BFloat16> b) {
+          auto [a0, a1] = convert_bfloat16_float(a);
+          auto [b0, b1] = convert_bfloat16_float(b);
+          const auto zero = Vectorized<float>(0);
+          const auto one = Vectorized<float>(1);
+          a0 = Vectorized<float>::blendv(zero, one, (a0 == zero) ^ (b0 == zero));
+          a1 = Vectorized<float>::blendv(zero, one, (a1 == zero) ^ (b1 == zero));
+          return convert_float_bfloat16(a0, a1);
+        });
   } else {
     AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND2(
         kBFloat16, kHalf, iter.common_dtype(), "logical_xor_cpu", [&]() {
@@ -911,6 +956,53 @@ void logit_backward_kernel(TensorIteratorBase& iter, const Scalar& eps_scalar) {
       });
 }
 
+void tan_backward_kernel(TensorIteratorBase& iter) {
+  if (isComplexType(iter.dtype())) {
+    AT_DISPATCH_COMPLEX_TYPES(iter.dtype(), "tan_backward_cpu", [&]() {
+      auto one_vec = Vectorized<scalar_t>(scalar_t{1});
+      cpu_kernel_vec(
+          iter,
+          [=](scalar_t a, scalar_t b) -> scalar_t {
+            return a * std::conj(scalar_t{1} + b * b);
+          },
+          [=](Vectorized<scalar_t> a, Vectorized<scalar_t> b) {
+            return a * (one_vec + b * b).conj();
+          });
+    });
+  } else if (at::isReducedFloatingType(iter.dtype())) {
+    AT_DISPATCH_REDUCED_FLOATING_TYPES(
+        iter.dtype(), "tan_backward_cpu", [&]() {
+          auto one_vec = Vectorized<float>(float{1});
+          cpu_kernel_vec(
+              iter,
+              [=](scalar_t a, scalar_t b) -> scalar_t {
+                float a0 = float(a);
+                float b0 = float(b);
+                return a0 * (float{1} + b0 * b0);
+              },
+              [=](Vectorized<scalar_t> a, Vectorized<scalar_t> b) {
+                auto [a0, a1] = convert_to_float<scalar_t>(a);
+                auto [b0, b1] = convert_to_float<scalar_t>(b);
+                a0 = a0 * (one_vec + b0 * b0);
+                a1 = a1 * (one_vec + b1 * b1);
+                return convert_from_float<scalar_t>(a0, a1);
+              });
+        });
+  } else {
+    AT_DISPATCH_FLOATING_TYPES(iter.dtype(), "tan_backward_cpu", [&]() {
+      auto one_vec = Vectorized<scalar_t>(scalar_t{1});
+      cpu_kernel_vec(
+          iter,
+          [=](scalar_t a, scalar_t b) -> scalar_t {
+            return a * (scalar_t{1} + b * b);
+          },
+          [=](Vectorized<scalar_t> a, Vectorized<scalar_t> b) {
+            return a * (one_vec + b * b);
+          });
+    });
+  }
+}
+
 void tanh_backward_kernel(TensorIteratorBase& iter) {
   if (isComplexType(iter.dtype())) {
     AT_DISPATCH_COMPLEX_TYPES(iter.dtype(), "tanh_backward_cpu", [&]() {
@@ -1435,6 +1527,7 @@ ALSO_REGISTER_AVX512_DISPATCH(smooth_l1_stub, &smooth_l1_kernel);
 ALSO_REGISTER_AVX512_DISPATCH(huber_stub, &huber_kernel);
 ALSO_REGISTER_AVX512_DISPATCH(sigmoid_backward_stub, &sigmoid_backward_kernel);
 ALSO_REGISTER_AVX512_DISPATCH(logit_backward_stub, &logit_backward_kernel);
+ALSO_REGISTER_AVX512_DISPATCH(tan_backward_stub, &tan_backward_kernel);
 ALSO_REGISTER_AVX512_DISPATCH(tanh_backward_stub, &tanh_backward_kernel);
 ALSO_REGISTER_AVX512_DISPATCH(mse_stub, &mse_kernel);
 ALSO_REGISTER_AVX512_DISPATCH(logaddexp_stub, &logaddexp_kernel);
@@ -3,11 +3,15 @@
 
 #include <ATen/Dispatch.h>
 #include <ATen/Dispatch_v2.h>
+#include <ATen/Parallel.h>
 #include <ATen/cpu/vec/functional.h>
 #include <ATen/cpu/vec/vec.h>
 #include <ATen/native/cpu/CatKernel.h>
 #include <c10/util/irange.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace at::native {
 
 namespace {
@@ -76,8 +80,162 @@ void cat_serial_kernel(
       AT_EXPAND(AT_FLOAT8_TYPES));
 }
 
+// Outputs this large are unlikely to be re-read before they would be
+// evicted anyway, so bypass the cache with non-temporal stores instead of
+// polluting it with the copy.
+constexpr int64_t kNonTemporalCopyThresholdBytes = 4 * 1024 * 1024;
+
+template <typename scalar_t>
+inline void copy_chunk(
+    scalar_t* dst,
+    const scalar_t* src,
+    int64_t n,
+    bool non_temporal) {
+#if defined(CPU_CAPABILITY_AVX512) || defined(CPU_CAPABILITY_AVX2)
+  if (non_temporal) {
+#if defined(CPU_CAPABILITY_AVX512)
+    constexpr int64_t kVecBytes = 64;
+#else
+    constexpr int64_t kVecBytes = 32;
+#endif
+    char* dst_c = reinterpret_cast<char*>(dst);
+    const char* src_c = reinterpret_cast<const char*>(src);
+    const int64_t nbytes = n * static_cast<int64_t>(sizeof(scalar_t));
+    // Streaming stores need an aligned destination; copy the unaligned head
+    // and tail through the cache.
+    const int64_t head = std::min(
+        nbytes,
+        static_cast<int64_t>(
+            -reinterpret_cast<uintptr_t>(dst_c) & (kVecBytes - 1)));
+    std::memcpy(dst_c, src_c, head);
+    const int64_t body = (nbytes - head) & ~(kVecBytes - 1);
+    for (int64_t b = head; b < head + body; b += kVecBytes) {
+#if defined(CPU_CAPABILITY_AVX512)
+      _mm512_stream_si512(
+          reinterpret_cast<__m512i*>(dst_c + b),
+          _mm512_loadu_si512(reinterpret_cast<const void*>(src_c + b)));
+#else
+      _mm256_stream_si256(
+          reinterpret_cast<__m256i*>(dst_c + b),
+          _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src_c + b)));
+#endif
+    }
+    std::memcpy(dst_c + head + body, src_c + head + body, nbytes - head - body);
+    return;
+  }
+#else
+  (void)non_temporal;
+#endif
+  using Vec = vec::Vectorized<scalar_t>;
+  int64_t d = 0;
+  for (; d < n - (n % Vec::size()); d += Vec::size()) {
+    Vec::loadu(src + d).store(dst + d);
+  }
+  for (; d < n; d++) {
+    dst[d] = src[d];
+  }
+}
+
+inline void store_fence() {
+#if defined(CPU_CAPABILITY_AVX512) || defined(CPU_CAPABILITY_AVX2)
+  // Non-temporal stores are weakly ordered; fence before the worker
+  // signals completion so the copied data is visible to other threads.
+  _mm_sfence();
+#endif
+}
+
+template <typename scalar_t>
+void cat_parallel_kernel_impl(
+    const Tensor& result,
+    const MaterializedITensorListRef& tensors,
+    int64_t dim) {
+  TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+      dim >= 0 && dim < result.dim(),
+      "dim out of range in cat_parallel_kernel_impl");
+  int64_t outer =
+      result.numel() / (result.sizes()[dim] * result.strides()[dim]);
+  scalar_t* result_data = result.data_ptr<scalar_t>();
+  int64_t ninputs = static_cast<int64_t>(tensors.size());
+  std::vector<InputMeta> inputs;
+  inputs.reserve(ninputs);
+  for (const Tensor& tensor : tensors) {
+    inputs.emplace_back(tensor, dim, result.strides()[dim]);
+  }
+
+  // Prefix offsets of each input's chunk within one output row; the flat
+  // output is `outer` repetitions of a row holding one chunk per input.
+  std::vector<int64_t> offsets(ninputs + 1, 0);
+  for (const auto j : c10::irange(ninputs)) {
+    offsets[j + 1] = offsets[j] + inputs[j].inner_size;
+  }
+  const int64_t row_size = offsets[ninputs];
+  if (row_size == 0) {
+    return;
+  }
+
+  const bool non_temporal =
+      result.numel() * static_cast<int64_t>(sizeof(scalar_t)) >=
+      kNonTemporalCopyThresholdBytes;
+
+  // Partition the flat output uniformly: a range can cover many small
+  // input chunks (work split across inputs) or a slice of one big chunk
+  // (work split within an input).
+  at::parallel_for(
+      0,
+      outer * row_size,
+      at::internal::GRAIN_SIZE,
+      [&](int64_t begin, int64_t end) {
+        int64_t i = begin / row_size;
+        const int64_t rem = begin - i * row_size;
+        int64_t j = std::upper_bound(offsets.begin() + 1, offsets.end(), rem) -
+            offsets.begin() - 1;
+        int64_t intra = rem - offsets[j];
+        int64_t pos = begin;
+        while (pos < end) {
+          int64_t chunk_size = inputs[j].inner_size - intra;
+          if (chunk_size > 0) {
+            chunk_size = std::min(chunk_size, end - pos);
+            copy_chunk(
+                result_data + pos,
+                (const scalar_t*)(inputs[j].data_ptr) +
+                    i * inputs[j].inner_size + intra,
+                chunk_size,
+                non_temporal);
+            pos += chunk_size;
+            intra += chunk_size;
+          }
+          if (intra == inputs[j].inner_size) {
+            intra = 0;
+            if (++j == ninputs) {
+              j = 0;
+              ++i;
+            }
+          }
+        }
+        if (non_temporal) {
+          store_fence();
+        }
+      });
+}
+
+void cat_parallel_kernel(
+    const Tensor& result,
+    const MaterializedITensorListRef& tensors,
+    int64_t dim) {
+  AT_DISPATCH_V2(
+      result.scalar_type(),
+      "cat_parallel_kernel",
+      AT_WRAP(
+          [&]() { cat_parallel_kernel_impl<scalar_t>(result, tensors, dim); }),
+      AT_EXPAND(AT_FLOATING_TYPES),
+      kBFloat16,
+      kHalf,
+      AT_EXPAND(AT_FLOAT8_TYPES));
+}
+
 } // anonymous namespace
 
 REGISTER_DISPATCH(cat_serial_stub, &cat_serial_kernel);
+REGISTER_DISPATCH(cat_parallel_stub, &cat_parallel_kernel);
 
 } // namespace at::native
@@ -8,5 +8,6 @@ namespace at::native {
 
 using cat_serial_fn = void(*)(const Tensor &, const MaterializedITensorListRef&, int64_t);
 DECLARE_DISPATCH(cat_serial_fn, cat_serial_stub);
+DECLARE_DISPATCH(cat_serial_fn, cat_parallel_stub);
 
 } // namespace at::native
@@ -2,9 +2,12 @@
 #include <ATen/CPUGeneratorImpl.h>
 #include <ATen/Dispatch.h>
 #include <ATen/Generator.h>
+#include <ATen/Parallel.h>
 #include <ATen/core/DistributionsHelper.h>
+#include <ATen/core/PhiloxRNGEngine.h>
 #include <ATen/native/Distributions.h>
 #include <ATen/native/cpu/DistributionTemplates.h>
+#include <c10/util/irange.h>
 
 #include <ATen/native/UnaryOps.h>
 
@@ -210,8 +213,79 @@ void uniform_kernel(TensorIteratorBase& iter, double from, double to, std::optio
   templates::cpu::uniform_kernel(iter, from, to, generator);
 }
 
+// Minimum tensor size before normal_kernel switches from the shared MT19937
+// stream to the counter-based Philox path below. For smaller fills the time
+// spent under the generator mutex is short and not worth changing streams
+// for. The threshold only depends on the tensor size, so which stream a
+// given fill uses is deterministic.
+constexpr int64_t kNormalPhiloxMinSize = 16384;
+
+// Fills data[0..16) with uniforms in [0, 1) drawn from the Philox counters
+// covering elements [element_index, element_index + 16) of the output. Each
+// 128-bit counter yields four 32-bit draws, so the uniform assigned to an
+// element is a pure function of (seed, element index); the float mapping
+// matches philox_engine::uint32_to_uniform_float.
+void philox_uniform_fill_16(float* data, uint64_t seed, uint64_t element_index) {
+  at::Philox4_32 engine(seed, 0, element_index >> 2);
+  for (uint64_t i = 0; i < (element_index & 3); i++) {
+    engine();
+  }
+  // maximum value such that `MAX_INT * scale < 1.0` (with float rounding)
+  constexpr float scale = 4.6566127342e-10;
+  for (const auto j : c10::irange(16)) {
+    data[j] = static_cast<float>(engine() & 0x7FFFFFFF) * scale;
+  }
+}
+
+// Parallel normal fill for large contiguous float tensors. A single seed is
+// drawn from the generator under its mutex; each parallel_for chunk then
+// seeds a stateless Philox stream at its own element offset, so chunks draw
+// disjoint counter blocks without coordinating and the result is identical
+// regardless of the number of threads.
+void normal_fill_philox(const TensorBase &self, const float mean, const float std, CPUGeneratorImpl* generator) {
+  float* data = self.data_ptr<float>();
+  const int64_t size = self.numel();
+  uint64_t seed;
+  {
+    // See Note [Acquire lock when using random generators]
+    std::lock_guard<std::mutex> lock(generator->mutex_);
+    seed = generator->random64();
+  }
+
+  at::parallel_for(0, size / 16, /* grain_size= */ 50, [&](int64_t begin, int64_t end) {
+#ifdef CPU_CAPABILITY_AVX2
+    const __m256 two_pi = _mm256_set1_ps(2.0f * c10::pi<double>);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 minus_two = _mm256_set1_ps(-2.0f);
+    const __m256 mean_v = _mm256_set1_ps(mean);
+    const __m256 std_v = _mm256_set1_ps(std);
+#endif
+    for (const auto block : c10::irange(begin, end)) {
+      float* chunk = data + block * 16;
+      philox_uniform_fill_16(chunk, seed, static_cast<uint64_t>(block) * 16);
+#ifdef CPU_CAPABILITY_AVX2
+      templates::cpu::normal_fill_16_AVX2(chunk, &two_pi, &one, &minus_two, &mean_v, &std_v);
+#else
+      templates::cpu::normal_fill_16<float>(chunk, mean, std);
+#endif
+    }
+  });
+
+  if (size % 16 != 0) {
+    // Recompute the last 16 values, mirroring normal_fill's tail handling.
+    float* tail = data + size - 16;
+    philox_uniform_fill_16(tail, seed, static_cast<uint64_t>(size - 16));
+    templates::cpu::normal_fill_16<float>(tail, mean, std);
+  }
+}
+
 void normal_kernel(const TensorBase &self, double mean, double std, std::optional<Generator> gen) {
   CPUGeneratorImpl* generator = get_generator_or_default<CPUGeneratorImpl>(gen, detail::getDefaultCPUGenerator());
+  if (self.scalar_type() == at::kFloat && self.is_contiguous() &&
+      self.numel() >= kNormalPhiloxMinSize) {
+    normal_fill_philox(self, static_cast<float>(mean), static_cast<float>(std), generator);
+    return;
+  }
   templates::cpu::normal_kernel(self, mean, std, generator);
 }
 
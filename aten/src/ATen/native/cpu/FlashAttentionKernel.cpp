@@ -797,6 +797,347 @@ void cpu_flash_attention(
   }
 }
 
+// NOTE [ CPU flash attention split-kv ]
+// cpu_flash_attention parallelizes over batch x num_head x query blocks, so
+// low-batch long-context inference (batch=1 decode in the extreme) leaves
+// most of the thread pool idle. Here each task additionally owns a slice of
+// the KV blocks and produces an unnormalized partial accumulation together
+// with its running max / sum of exponentials; a second pass merges the
+// partials per query block with the usual log-sum-exp rescaling, mirroring
+// the split-kv scheme of the CUDA kernels.
+template <typename scalar_t, typename mask_t, int64_t q_split_size, int64_t kv_split_size>
+void cpu_flash_attention_split_kv(
+    const Tensor& output,
+    const Tensor& logsumexp,
+    const at::Tensor& q,
+    const at::Tensor& k,
+    const at::Tensor& v,
+    double dropout_p,
+    bool is_causal,
+    std::optional<Tensor> attn_mask,
+    std::optional<double> scale) {
+  at::Tensor query = q.transpose(1, 2);
+  at::Tensor key = k.transpose(1, 2);
+  at::Tensor value = v.transpose(1, 2);
+
+  constexpr bool is_reduced_type = is_reduced_floating_point_v<scalar_t>;
+  using accum_t = at::opmath_type<scalar_t>;
+  using Vec = vec::Vectorized<accum_t>;
+  accum_t scaling_factor =
+      sdp::calculate_scale(query, scale).as_float_unchecked();
+
+  TORCH_CHECK((query.size(3) == value.size(3)) && (key.size(3) == value.size(3)),
+        "scaled_dot_product_attention_flash_attention: Q/K/V should have the same head size");
+  int64_t batchSize = query.size(0);
+  int64_t qSize = query.size(1);
+  int64_t kvSize = value.size(1);
+  int64_t num_head = query.size(2);
+  int64_t headSize = query.size(3);
+
+  bool has_attn_mask = attn_mask.has_value() && attn_mask.value().numel();
+  if (has_attn_mask) {
+    reshape_attn_mask_to_4d(attn_mask.value(), batchSize, num_head, qSize, kvSize);
+  }
+
+  int64_t qStrideB = query.stride(0);
+  int64_t qStrideM = query.stride(1);
+  int64_t qStrideH = query.stride(2);
+  int64_t kStrideB = key.stride(0);
+  int64_t kStrideN = key.stride(1);
+  int64_t kStrideH = key.stride(2);
+  int64_t vStrideB = value.stride(0);
+  int64_t vStrideN = value.stride(1);
+  int64_t vStrideH = value.stride(2);
+  int64_t oStrideB = output.stride(0);
+  int64_t oStrideM = output.stride(1);
+  int64_t oStrideH = output.stride(2);
+  int64_t lStrideB = logsumexp.stride(0);
+  int64_t lStrideM = logsumexp.stride(1);
+  int64_t lStrideH = logsumexp.stride(2);
+  int64_t mStrideB =
+      (has_attn_mask && attn_mask.value().size(0) > 1)
+      ? attn_mask.value().stride(0)
+      : 0;
+  int64_t mStrideH =
+      (has_attn_mask && attn_mask.value().size(1) > 1)
+      ? attn_mask.value().stride(1)
+      : 0;
+  int64_t mStrideM =
+      (has_attn_mask && attn_mask.value().size(2) > 1)
+      ? attn_mask.value().stride(2)
+      : 0;
+  int64_t mStrideN =
+      (has_attn_mask && attn_mask.value().size(3) > 1)
+      ? attn_mask.value().stride(3)
+      : 0;
+
+  int64_t qSplitSize = q_split_size > qSize ? qSize : q_split_size;
+  int64_t kvSplitSize = kv_split_size > kvSize ? kvSize : kv_split_size;
+  int64_t qSlice = (qSize + qSplitSize - 1) / qSplitSize;
+  int64_t kvSlice = (kvSize + kvSplitSize - 1) / kvSplitSize;
+  int64_t num_thread = at::get_num_threads();
+
+  // Just enough KV splits to fill the thread pool, each covering one or more
+  // contiguous kv blocks.
+  int64_t qTasks = batchSize * num_head * qSlice;
+  int64_t kvSplits = std::min(kvSlice, (num_thread + qTasks - 1) / qTasks);
+  int64_t kvPerSplit = (kvSlice + kvSplits - 1) / kvSplits * kvSplitSize;
+
+  const auto accumulate_dtype = toOpMathType(query.scalar_type());
+
+  // Per split: unnormalized accumulation plus running max and sum per row
+  int64_t size_per_split =
+      /* dst    */ qSplitSize * headSize +
+      /* qk_max */ qSplitSize +
+      /* qk_sum */ qSplitSize;
+
+  at::Tensor split_buf = at::empty(
+      {qTasks * kvSplits, size_per_split},
+      query.options().dtype(accumulate_dtype));
+  at::Tensor buf = at::empty(
+      {num_thread, qSplitSize * kvSplitSize},
+      query.options().dtype(accumulate_dtype));
+  at::Tensor buf_reduced = at::empty(
+      {num_thread,
+       qSplitSize,
+       is_reduced_type ? kvSplitSize : 0},
+       query.options());
+  // Scratch row accumulators for the merge pass
+  at::Tensor merge_buf = at::empty(
+      {num_thread, headSize}, query.options().dtype(accumulate_dtype));
+
+  const scalar_t* q_data = query.const_data_ptr<scalar_t>();
+  const scalar_t* k_data = key.const_data_ptr<scalar_t>();
+  const scalar_t* v_data = value.const_data_ptr<scalar_t>();
+  mask_t* mask_data = has_attn_mask
+      ? attn_mask.value().data_ptr<mask_t>()
+      : nullptr;
+  scalar_t* out_data = output.data_ptr<scalar_t>();
+  accum_t* lse_data = logsumexp.data_ptr<accum_t>();
+  accum_t* split_data = split_buf.data_ptr<accum_t>();
+  accum_t* buf_data = buf.data_ptr<accum_t>();
+  scalar_t* buf_reduced_data = is_reduced_type ? buf_reduced.data_ptr<scalar_t>() : nullptr;
+  accum_t* merge_data = merge_buf.data_ptr<accum_t>();
+
+  at::parallel_for(0, qTasks * kvSplits, 1, [&](int64_t begin, int64_t end) {
+    int64_t i = 0, j = 0, k = 0, s = 0;
+    data_index_init(begin, i, batchSize, j, num_head, k, qSlice, s, kvSplits);
+    int ompIdx = at::get_thread_num();
+    accum_t* qk_data = buf_data + ompIdx * qSplitSize * kvSplitSize;
+    scalar_t* qk_reduced_data = is_reduced_type ? buf_reduced_data + ompIdx * qSplitSize * kvSplitSize : nullptr;
+
+    for ([[maybe_unused]] auto z : c10::irange(begin, end)) {
+      accum_t* split_ptr = split_data + z * size_per_split;
+      accum_t* dst_data = split_ptr;
+      accum_t* qk_max_data = split_ptr + qSplitSize * headSize;
+      accum_t* qk_sum_data = qk_max_data + qSplitSize;
+
+      int64_t m = k * qSplitSize;
+      int64_t qBlockSize = std::min(qSplitSize, qSize - m);
+      // Initialize max and sum
+      fill_stub(qk_max_data,
+          -std::numeric_limits<accum_t>::infinity(), qBlockSize);
+      fill_stub(qk_sum_data,
+          static_cast<accum_t>(0), qBlockSize);
+      int64_t num_keys = is_causal ? std::min(m + qBlockSize, kvSize) : kvSize;
+      int64_t n_begin = s * kvPerSplit;
+      int64_t n_end = std::min(n_begin + kvPerSplit, num_keys);
+      if (n_begin >= n_end) {
+        // Entire split is masked out by causality; the merge pass skips
+        // contributions whose max stayed at -inf.
+        fill_stub(dst_data, static_cast<accum_t>(0), qBlockSize * headSize);
+        data_index_step(i, batchSize, j, num_head, k, qSlice, s, kvSplits);
+        continue;
+      }
+      for (int64_t n = n_begin; n < n_end; n += kvSplitSize) {
+        int64_t kvBlockSize = std::min(kvSplitSize, kvSize - n);
+        // Calculate scale * q @ k.T
+        cpublas::gemm(
+          TransposeType::Transpose,
+          TransposeType::NoTranspose,
+          kvBlockSize,
+          qBlockSize,
+          headSize,
+          static_cast<accum_t>(1),
+          k_data + i * kStrideB + j * kStrideH +
+              n * kStrideN,
+          kStrideN,
+          q_data + i * qStrideB + j * qStrideH +
+              m * qStrideM,
+          qStrideM,
+          static_cast<accum_t>(0),
+          qk_data,
+          kvBlockSize);
+        // Apply causal mask, fill unused with -inf
+        if (is_causal && num_keys - n <= kvSplitSize) {
+          for (const auto row : c10::irange(qBlockSize)) {
+            int64_t last_col = m + row - n;
+            accum_t* row_ptr = qk_data + row * kvBlockSize;
+            fill_stub(row_ptr + last_col + 1,
+                -std::numeric_limits<accum_t>::infinity(),
+                kvBlockSize - last_col - 1);
+          }
+        }
+        // Update attention weights with attention mask
+        // And apply scaling factor
+        // qk <- qk * scaling + attn_mask
+        if (has_attn_mask) {
+          for (int64_t row = 0; row < qBlockSize; ++row) {
+#if __GNUC__ == 11 && defined(__ARM_FEATURE_SVE)
+              _scale_attn_mask_fusion_kernel(
+                qk_data + row * kvBlockSize,
+                mask_data + i * mStrideB + j * mStrideH +
+                    (m + row) * mStrideM + (mStrideN == 0 ? 0 : n),
+                kvBlockSize,
+                qk_data + row * kvBlockSize,
+                scaling_factor,
+                mStrideN == 0);
+#else
+              if (mStrideN == 0) {
+                _scale_attn_mask_fusion_kernel</*is_stride_0*/ true>(
+                  qk_data + row * kvBlockSize,
+                  mask_data + i * mStrideB + j * mStrideH +
+                      (m + row) * mStrideM,
+                  kvBlockSize,
+                  qk_data + row * kvBlockSize,
+                  scaling_factor);
+              } else {
+                _scale_attn_mask_fusion_kernel</*is_stride_0*/ false>(
+                  qk_data + row * kvBlockSize,
+                  mask_data + i * mStrideB + j * mStrideH +
+                      (m + row) * mStrideM + n,
+                  kvBlockSize,
+                  qk_data + row * kvBlockSize,
+                  scaling_factor);
+              }
+#endif
+          }
+        }
+        // Update coefficients with Softmax
+        accum_t tmp_max = 0, tmp_sum = 0, exp_tmp = 0;
+        for (int64_t row = 0; row < qBlockSize; ++row) {
+          if (has_attn_mask) {
+            // max per row
+            tmp_max = at::vec::reduce_all<accum_t>(
+                [](Vec& x, Vec& y) { return at::vec::maximum(x, y); },
+                qk_data + row * kvBlockSize,
+                kvBlockSize);
+          } else {
+            // apply scaling factor and max per row in fusion
+            _mul_reduce_max_fusion_kernel(
+                qk_data + row * kvBlockSize,
+                scaling_factor,
+                kvBlockSize,
+                qk_data + row * kvBlockSize,
+                tmp_max);
+          }
+          tmp_max = qk_max_data[row] > tmp_max ? qk_max_data[row] : tmp_max;
+          if (tmp_max == -std::numeric_limits<accum_t>::infinity()) {
+            // to avoid `nan = exp2f(-inf - (-inf))`
+            fill_stub(conditional_data_ptr(qk_data, qk_reduced_data) + row * kvBlockSize,
+              static_cast<scalar_t>(0), kvBlockSize);
+          } else {
+            tmp_sum = tmp_max;
+            // qk <- exp(qk - max) and sum per row
+            _exp_reduce_sum_fusion_kernel(
+                qk_data + row * kvBlockSize, kvBlockSize,
+                conditional_data_ptr(qk_data, qk_reduced_data) + row * kvBlockSize,
+                tmp_sum);
+            // exp_tmp <- exp(max[row] - max)
+            exp_tmp = std::exp(qk_max_data[row] - tmp_max);
+            // sum[row] <- sum + exp_tmp * sum[row]
+            qk_sum_data[row] = tmp_sum + exp_tmp * qk_sum_data[row];
+            // max[row] <- max
+            qk_max_data[row] = tmp_max;
+            // dst <- dst * exp_tmp
+            if (n > n_begin) {
+              vec::map<accum_t>(
+                [exp_tmp](Vec x) { return x * Vec(exp_tmp); },
+                dst_data + row * headSize,
+                dst_data + row * headSize,
+                headSize);
+            }
+          }
+        }
+        // Calculate Softmax(q @ k.T) @ v, unnormalized
+        cpublas::gemm(
+          TransposeType::NoTranspose,
+          TransposeType::NoTranspose,
+          headSize,
+          qBlockSize,
+          kvBlockSize,
+          static_cast<accum_t>(1),
+          v_data + i * vStrideB + j * vStrideH +
+              n * vStrideN,
+          vStrideN,
+          conditional_data_ptr(qk_data, qk_reduced_data),
+          kvBlockSize,
+          n == n_begin ? static_cast<accum_t>(0) : static_cast<accum_t>(1),
+          dst_data,
+          headSize);
+      }
+      // Move to the next split
+      data_index_step(i, batchSize, j, num_head, k, qSlice, s, kvSplits);
+    }
+  });
+
+  // Merge the KV splits per query block with log-sum-exp rescaling
+  at::parallel_for(0, qTasks, 1, [&](int64_t begin, int64_t end) {
+    int64_t i = 0, j = 0, k = 0;
+    data_index_init(begin, i, batchSize, j, num_head, k, qSlice);
+    int ompIdx = at::get_thread_num();
+    accum_t* acc_data = merge_data + ompIdx * headSize;
+
+    for ([[maybe_unused]] auto z : c10::irange(begin, end)) {
+      int64_t m = k * qSplitSize;
+      int64_t qBlockSize = std::min(qSplitSize, qSize - m);
+      const accum_t* split_base = split_data + z * kvSplits * size_per_split;
+      accum_t* lse_ptr = lse_data + i * lStrideB + j * lStrideH + m * lStrideM;
+      for (int64_t row = 0; row < qBlockSize; ++row) {
+        accum_t global_max = -std::numeric_limits<accum_t>::infinity();
+        for (const auto s : c10::irange(kvSplits)) {
+          const accum_t* qk_max_data = split_base + s * size_per_split + qSplitSize * headSize;
+          global_max = std::max(global_max, qk_max_data[row]);
+        }
+        accum_t global_sum = 0;
+        fill_stub(acc_data, static_cast<accum_t>(0), headSize);
+        if (global_max != -std::numeric_limits<accum_t>::infinity()) {
+          for (const auto s : c10::irange(kvSplits)) {
+            const accum_t* split_ptr = split_base + s * size_per_split;
+            const accum_t* qk_max_data = split_ptr + qSplitSize * headSize;
+            const accum_t* qk_sum_data = qk_max_data + qSplitSize;
+            if (qk_max_data[row] == -std::numeric_limits<accum_t>::infinity()) {
+              // Split contributed nothing to this row
+              continue;
+            }
+            accum_t exp_tmp = std::exp(qk_max_data[row] - global_max);
+            global_sum += exp_tmp * qk_sum_data[row];
+            vec::map2<accum_t>(
+                [exp_tmp](Vec x, Vec y) { return x + y * Vec(exp_tmp); },
+                acc_data,
+                acc_data,
+                split_ptr + row * headSize,
+                headSize);
+          }
+        }
+        // Row sums for fully masked out rows are 0, set them to 1 to avoid
+        // NaNs in the output and write 0 instead (same as the single pass)
+        accum_t out_max = global_max == -std::numeric_limits<accum_t>::infinity() ? 0 : global_max;
+        accum_t out_sum = global_sum == 0 ? 1 : global_sum;
+        accum_t sum_reciprocal = 1 / out_sum;
+        vec::map<scalar_t>(
+          [sum_reciprocal](Vec x) { return x * Vec(sum_reciprocal); },
+          out_data + i * oStrideB + j * oStrideH + m * oStrideM + row * oStrideM,
+          acc_data,
+          headSize);
+        lse_ptr[row * lStrideM] = out_max + std::log(out_sum);
+      }
+      // Move to the next query
+      data_index_step(i, batchSize, j, num_head, k, qSlice);
+    }
+  });
+}
+
 template <typename scalar_t, typename mask_t, int64_t q_split_size, int64_t kv_split_size>
 void cpu_flash_attention_backward(
     const at::Tensor& grad_q,
@@ -1141,8 +1482,10 @@ void cpu_flash_attention_backward(
       AT_PRIVATE_CASE_TYPE_USING_HINT(                     \
           at::ScalarType::Half, mask_t, __VA_ARGS__))
 
-#define FLASH_ATTENTION_KERNEL(FNAME, PACK, TYPE1, TYPE2, SEQ1, SEQ2, ...)   \
-  if (PACK) {                                                      \
+#define FLASH_ATTENTION_KERNEL(FNAME, PACK, SPLIT_KV, TYPE1, TYPE2, SEQ1, SEQ2, ...)   \
+  if (SPLIT_KV) {                                                  \
+    cpu_flash_attention_split_kv<TYPE1, TYPE2, SEQ1, SEQ2>(__VA_ARGS__); \
+  } else if (PACK) {                                               \
     FNAME<TYPE1, TYPE2, SEQ1, SEQ2, true>(__VA_ARGS__);            \
   } else {                                                         \
     FNAME<TYPE1, TYPE2, SEQ1, SEQ2>(__VA_ARGS__);                  \
@@ -1159,38 +1502,48 @@ void flash_attention_kernel_impl(
     std::optional<Tensor> attn_mask,
     std::optional<double> scale) {
   auto q_seq_len = query.size(2);
+  auto kv_seq_len = key.size(2);
 
   // When q_seq_len and k_seq_len are long enough,
   // cpu_flash_attention with pack has better performance.
   bool could_pack = (query.scalar_type() == kHalf && cpublas::need_pack(kHalf));
 
+  // When batch x num_head x query blocks leaves most of the thread pool idle
+  // and there is enough KV to split, parallelize over KV splits as well.
+  // See NOTE [ CPU flash attention split-kv ].
+  int64_t q_split_size = q_seq_len >= 768 ? 256 : (q_seq_len >= 192 ? 64 : 32);
+  int64_t q_slice = (q_seq_len + q_split_size - 1) / q_split_size;
+  bool use_split_kv = !could_pack &&
+      query.size(0) * query.size(1) * q_slice * 2 <= at::get_num_threads() &&
+      kv_seq_len >= 2 * 512;
+
   AT_DISPATCH_FLOATING_TYPES_AND2(kBFloat16, kHalf, query.scalar_type(), "flash_attention", [&] {
     if (!attn_mask.has_value()) {
       if (q_seq_len >= 768) {
-        FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, scalar_t, scalar_t, 256, 512,
+        FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, use_split_kv, scalar_t, scalar_t, 256, 512,
           output, logsumexp, query, key, value,
           dropout_p, is_causal, attn_mask, scale);
       } else if (q_seq_len >= 192) {
-        FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, scalar_t, scalar_t, 64, 512,
+        FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, use_split_kv, scalar_t, scalar_t, 64, 512,
           output, logsumexp, query, key, value,
           dropout_p, is_causal, attn_mask, scale);
       } else {
-        FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, scalar_t, scalar_t, 32, 512,
+        FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, use_split_kv, scalar_t, scalar_t, 32, 512,
           output, logsumexp, query, key, value,
           dropout_p, is_causal, attn_mask, scale);
       }
     } else {
       AT_DISPATCH_MASK_TYPES(attn_mask.value().scalar_type(), "flash_attention_mask", [&]() {
         if (q_seq_len >= 768) {
-          FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, scalar_t, mask_t, 256, 512,
+          FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, use_split_kv, scalar_t, mask_t, 256, 512,
             output, logsumexp, query, key, value,
             dropout_p, is_causal, attn_mask, scale);
         } else if (q_seq_len >= 192) {
-          FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, scalar_t, mask_t, 64, 512,
+          FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, use_split_kv, scalar_t, mask_t, 64, 512,
             output, logsumexp, query, key, value,
             dropout_p, is_causal, attn_mask, scale);
         } else {
-          FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, scalar_t, mask_t, 32, 512,
+          FLASH_ATTENTION_KERNEL(cpu_flash_attention, could_pack, use_split_kv, scalar_t, mask_t, 32, 512,
             output, logsumexp, query, key, value,
             dropout_p, is_causal, attn_mask, scale);
         }
@@ -154,6 +154,154 @@ std::enable_if_t<
 }
 
 
+// Mixed-dtype variant: params and grads are reduced precision while the
+// optimizer state (exp_avg, exp_avg_sq, max_exp_avg_sq) stays in fp32, so the
+// moment updates never round-trip through the low-precision dtype. The params
+// are still read as bf16/fp16 and written back as such; only the state keeps
+// full precision.
+template <typename scalar_t, typename opmath_t, ADAM_MODE adam_mode>
+std::enable_if_t<
+    std::is_same_v<scalar_t, Half> || std::is_same_v<scalar_t, BFloat16>,
+    void>
+    inline adam_math(
+  scalar_t* param_ptr,
+  opmath_t* exp_avg_ptr,
+  opmath_t* exp_avg_sq_ptr,
+  scalar_t* grad_ptr,
+  opmath_t* max_exp_avg_sq_ptr,
+  double lr,
+  double bias_correction1,
+  double bias_correction2,
+  double exp_avg_grad_coefficient,
+  double exp_avg_sq_grad_coefficient,
+  double bias_correction2_sqrt,
+  double eps,
+  double weight_decay,
+  double beta2,
+  bool amsgrad,
+  bool maximize,
+  const float* grad_scale_ptr,
+  int64_t size
+){
+  double step_size = lr / bias_correction1;
+  using lpVec = at::vec::Vectorized<scalar_t>;
+  using fVec = at::vec::Vectorized<opmath_t>;
+  int64_t d = 0;
+  for (; d < size - (size % lpVec::size()); d += lpVec::size()) {
+    lpVec param_lpvec = lpVec::loadu(param_ptr + d);
+    auto [param_vec1, param_vec2] = vec::convert_to_float<scalar_t>(param_lpvec);
+    lpVec grad_lpvec = lpVec::loadu(grad_ptr + d);
+    auto [grad_vec1, grad_vec2] = vec::convert_to_float<scalar_t>(grad_lpvec);
+    if (grad_scale_ptr) {
+      grad_vec1 = grad_vec1 / fVec(float(*grad_scale_ptr));
+      grad_vec2 = grad_vec2 / fVec(float(*grad_scale_ptr));
+      lpVec grad_vec_to_store = vec::convert_from_float<scalar_t>(grad_vec1, grad_vec2);
+      grad_vec_to_store.store(grad_ptr + d);
+    }
+    if (maximize){
+      grad_vec1 = grad_vec1 * fVec(opmath_t(-1.0));
+      grad_vec2 = grad_vec2 * fVec(opmath_t(-1.0));
+    }
+    if (weight_decay != 0.f){
+      if constexpr (adam_mode == ADAM_MODE::ORIGINAL) {
+        grad_vec1 += param_vec1 * fVec(opmath_t(weight_decay));
+        grad_vec2 += param_vec2 * fVec(opmath_t(weight_decay));
+       } else if constexpr (adam_mode == ADAM_MODE::ADAMW) {
+        param_vec1 = param_vec1 * fVec(opmath_t(1 - lr * weight_decay));
+        param_vec2 = param_vec2 * fVec(opmath_t(1 - lr * weight_decay));
+      }
+    }
+
+    fVec exp_avg_vec1 = fVec::loadu(exp_avg_ptr + d);
+    fVec exp_avg_vec2 = fVec::loadu(exp_avg_ptr + d + fVec::size());
+
+    // exp_avg.lerp_(grad, 1 - beta1)
+    const fVec lerp_weight = fVec(opmath_t(exp_avg_grad_coefficient));
+    auto mask = lerp_weight.abs() < fVec(0.5);
+    auto coeff = fVec::blendv(lerp_weight - fVec(1), lerp_weight, mask);
+
+    auto base1 = fVec::blendv(grad_vec1, exp_avg_vec1, mask);
+    exp_avg_vec1 = vec::fmadd(coeff, grad_vec1 - exp_avg_vec1, base1);
+
+    auto base2 = fVec::blendv(grad_vec2, exp_avg_vec2, mask);
+    exp_avg_vec2 = vec::fmadd(coeff, grad_vec2 - exp_avg_vec2, base2);
+
+    fVec exp_avg_sq_vec1 = fVec::loadu(exp_avg_sq_ptr + d) * fVec(opmath_t(beta2)) +
+        fVec(opmath_t(exp_avg_sq_grad_coefficient)) * grad_vec1 * grad_vec1;
+    fVec exp_avg_sq_vec2 = fVec::loadu(exp_avg_sq_ptr + d + fVec::size()) * fVec(opmath_t(beta2)) +
+        fVec(opmath_t(exp_avg_sq_grad_coefficient)) * grad_vec2 * grad_vec2;
+
+    exp_avg_vec1.store(exp_avg_ptr + d);
+    exp_avg_vec2.store(exp_avg_ptr + d + fVec::size());
+    exp_avg_sq_vec1.store(exp_avg_sq_ptr + d);
+    exp_avg_sq_vec2.store(exp_avg_sq_ptr + d + fVec::size());
+
+    fVec denom_vec1, denom_vec2;
+    if (amsgrad) {
+      fVec max_exp_avg_sq_vec1 =
+          maximum(fVec::loadu(max_exp_avg_sq_ptr + d), exp_avg_sq_vec1);
+      fVec max_exp_avg_sq_vec2 =
+          maximum(fVec::loadu(max_exp_avg_sq_ptr + d + fVec::size()), exp_avg_sq_vec2);
+      max_exp_avg_sq_vec1.store(max_exp_avg_sq_ptr + d);
+      max_exp_avg_sq_vec2.store(max_exp_avg_sq_ptr + d + fVec::size());
+      denom_vec1 =
+          (max_exp_avg_sq_vec1.sqrt() / fVec(opmath_t(bias_correction2_sqrt))) + fVec(opmath_t(eps));
+      denom_vec2 =
+          (max_exp_avg_sq_vec2.sqrt() / fVec(opmath_t(bias_correction2_sqrt))) + fVec(opmath_t(eps));
+    } else {
+      denom_vec1 =
+          (exp_avg_sq_vec1.sqrt() / fVec(opmath_t(bias_correction2_sqrt))) + fVec(opmath_t(eps));
+      denom_vec2 =
+          (exp_avg_sq_vec2.sqrt() / fVec(opmath_t(bias_correction2_sqrt))) + fVec(opmath_t(eps));
+    }
+    param_vec1 = param_vec1 + fVec(opmath_t(-step_size)) * exp_avg_vec1 / denom_vec1;
+    param_vec2 = param_vec2 + fVec(opmath_t(-step_size)) * exp_avg_vec2 / denom_vec2;
+    vec::convert_from_float<scalar_t>(param_vec1, param_vec2).store(param_ptr + d);
+  }
+  for (; d < size; d++) {
+    opmath_t grad_val = grad_ptr[d];
+    opmath_t param_val = param_ptr[d];
+    if (grad_scale_ptr) {
+      grad_val = grad_ptr[d] / float(*grad_scale_ptr);
+      grad_ptr[d] = grad_val;
+    }
+    if (maximize) grad_val = -grad_val;
+    if (weight_decay != 0.f){
+      if constexpr (adam_mode == ADAM_MODE::ORIGINAL) {
+        grad_val += param_val * opmath_t(weight_decay);
+      } else if constexpr (adam_mode == ADAM_MODE::ADAMW) {
+        param_val = param_val * opmath_t(1 - lr * weight_decay);
+      }
+    }
+    // exp_avg.lerp_(grad, 1 - beta1)
+    opmath_t exp_avg_var = exp_avg_ptr[d];
+    auto is_lerp_weight_small = std::abs(opmath_t(exp_avg_grad_coefficient)) < opmath_t(0.5);
+    if (is_lerp_weight_small) {
+      exp_avg_var = exp_avg_var + opmath_t(exp_avg_grad_coefficient) * (grad_val - exp_avg_var);
+    } else {
+      exp_avg_var = grad_val - (grad_val - exp_avg_var) * (opmath_t(1) - opmath_t(exp_avg_grad_coefficient));
+    }
+    exp_avg_ptr[d] = exp_avg_var;
+    opmath_t exp_avg_sq_var = exp_avg_sq_ptr[d];
+    exp_avg_sq_var = exp_avg_sq_var * opmath_t(beta2);
+    exp_avg_sq_var = exp_avg_sq_var +
+        opmath_t(exp_avg_sq_grad_coefficient) * grad_val * grad_val;
+    exp_avg_sq_ptr[d] = exp_avg_sq_var;
+    opmath_t demon_val;
+    if (amsgrad) {
+      opmath_t max_exp_avg_sq_var = max_exp_avg_sq_ptr[d];
+      max_exp_avg_sq_var = std::max(max_exp_avg_sq_var, exp_avg_sq_var);
+      max_exp_avg_sq_ptr[d] = max_exp_avg_sq_var;
+      demon_val =
+          std::sqrt(max_exp_avg_sq_var) / opmath_t(bias_correction2_sqrt) + opmath_t(eps);
+    } else {
+      demon_val = std::sqrt(exp_avg_sq_var) / opmath_t(bias_correction2_sqrt) + opmath_t(eps);
+    }
+    param_ptr[d] = param_val - opmath_t(step_size) * exp_avg_var / demon_val;
+  }
+}
+
+
 template <typename scalar_t, typename opmath_t, ADAM_MODE adam_mode>
 std::enable_if_t<
     std::is_same_v<scalar_t, float> || std::is_same_v<scalar_t, double>,
@@ -334,6 +482,78 @@ void adam_fused_step_impl(
       0, num_units, 0, adam_fn);
 }
 
+template <typename scalar_t, ADAM_MODE adam_mode>
+void adam_fused_step_fp32_state_impl(
+    const at::Tensor& param,
+    const at::Tensor& grad,
+    const at::Tensor& exp_avg,
+    const at::Tensor& exp_avg_sq,
+    const at::Tensor& max_exp_avg_sq,
+    const at::Tensor& state_step,
+    const double lr,
+    const double beta1,
+    const double beta2,
+    const double weight_decay,
+    const double eps,
+    const bool amsgrad,
+    const bool maximize,
+    const float* grad_scale_ptr) {
+  using opmath_t = at::opmath_type<scalar_t>;
+  double step = state_step.item<float>();
+  scalar_t* param_data = param.data_ptr<scalar_t>();
+  opmath_t* exp_avg_data = exp_avg.data_ptr<opmath_t>();
+  opmath_t* exp_avg_sq_data = exp_avg_sq.data_ptr<opmath_t>();
+  opmath_t* max_exp_avg_sq_data = amsgrad ? max_exp_avg_sq.data_ptr<opmath_t>() : nullptr;
+  scalar_t* grad_data = grad.data_ptr<scalar_t>();
+
+  // need to use double here to align with non-fused adam
+  double bias_correction1 = 1 - std::pow(beta1, step);
+  double bias_correction2 = 1 - std::pow(beta2, step);
+  double exp_avg_grad_coefficient = 1 - beta1;
+  double exp_avg_sq_grad_coefficient = 1 - beta2;
+  double bias_correction2_sqrt = std::sqrt(bias_correction2);
+
+
+  constexpr size_t cache_line_size = 64;
+  constexpr int64_t cache_line_aligned_task_unit = cache_line_size / sizeof(scalar_t);
+  size_t num_units = divup(param.numel(), cache_line_aligned_task_unit);
+
+  auto adam_fn = [&](int64_t begin, int64_t end) {
+        // local pointers
+        begin *= cache_line_aligned_task_unit;
+        end = std::min(end * cache_line_aligned_task_unit, param.numel());
+        scalar_t* param_ptr = param_data + begin;
+        opmath_t* exp_avg_ptr = exp_avg_data + begin;
+        opmath_t* exp_avg_sq_ptr = exp_avg_sq_data + begin;
+        scalar_t* grad_ptr = grad_data + begin;
+        opmath_t* max_exp_avg_sq_ptr = amsgrad ? max_exp_avg_sq_data + begin : nullptr;
+
+        const int64_t size = end - begin;
+        adam_math<scalar_t, opmath_t, adam_mode>(
+          param_ptr,
+          exp_avg_ptr,
+          exp_avg_sq_ptr,
+          grad_ptr,
+          max_exp_avg_sq_ptr,
+          lr,
+          bias_correction1,
+          bias_correction2,
+          exp_avg_grad_coefficient,
+          exp_avg_sq_grad_coefficient,
+          bias_correction2_sqrt,
+          eps,
+          weight_decay,
+          beta2,
+          amsgrad,
+          maximize,
+          grad_scale_ptr,
+          size
+        );
+      };
+  at::parallel_for(
+      0, num_units, 0, adam_fn);
+}
+
 void fused_adam_kernel(
     const at::Tensor& param,
     const at::Tensor& grad,
@@ -352,6 +572,27 @@ void fused_adam_kernel(
     const ADAM_MODE adam_mode
   ) {
   Tensor grad_contiguous = grad.contiguous();
+  if (param.scalar_type() != exp_avg.scalar_type()) {
+    // reduced-precision params with fp32 optimizer state
+    TORCH_CHECK(
+        exp_avg.scalar_type() == at::kFloat &&
+            exp_avg_sq.scalar_type() == at::kFloat &&
+            (!amsgrad || max_exp_avg_sq.scalar_type() == at::kFloat),
+        "fused_adam_kernel: expected fp32 state for mixed-dtype params, got ",
+        exp_avg.scalar_type());
+    TORCH_CHECK(
+        grad.scalar_type() == param.scalar_type(),
+        "fused_adam_kernel: expected grads to have the params' dtype, got ",
+        grad.scalar_type());
+    AT_DISPATCH_REDUCED_FLOATING_TYPES(param.scalar_type(), "fused_adam_kernel_fp32_state", [&] {
+      if(adam_mode == ADAM_MODE::ORIGINAL){
+        adam_fused_step_fp32_state_impl<scalar_t, ADAM_MODE::ORIGINAL>(param, grad, exp_avg, exp_avg_sq, max_exp_avg_sq, state_step, lr, beta1, beta2, weight_decay, eps, amsgrad, maximize, grad_scale_ptr);
+      } else {
+        adam_fused_step_fp32_state_impl<scalar_t, ADAM_MODE::ADAMW>(param, grad, exp_avg, exp_avg_sq, max_exp_avg_sq, state_step, lr, beta1, beta2, weight_decay, eps, amsgrad, maximize, grad_scale_ptr);
+      }
+    });
+    return;
+  }
   AT_DISPATCH_FLOATING_TYPES_AND2(kBFloat16, kHalf, param.scalar_type(), "fused_adam_kernel", [&] {
     if(adam_mode == ADAM_MODE::ORIGINAL){
       adam_fused_step_impl<scalar_t, ADAM_MODE::ORIGINAL>(param, grad, exp_avg, exp_avg_sq, max_exp_avg_sq, state_step, lr, beta1, beta2, weight_decay, eps, amsgrad, maximize, grad_scale_ptr);
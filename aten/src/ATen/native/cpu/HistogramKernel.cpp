@@ -76,6 +76,86 @@ enum BIN_SELECTION_ALGORITHM {
     LINEAR_INTERPOLATION_WITH_LOCAL_SEARCH,
     BINARY_SEARCH,
 };
+
+/* Specialization of the main algorithm for one-dimensional histograms
+ * (torch.histc and torch.histogram both reshape their input to (N, 1)).
+ *
+ * Replaces the generic strided accessors with raw pointer walks over the
+ * contiguous input and drops the per-element loop over dimensions, leaving a
+ * tight load/classify/increment loop per thread. Bin selection is unchanged:
+ * each algorithm uses the exact expressions of the general case, so borderline
+ * elements land in the same bins as before.
+ */
+template<typename input_t, BIN_SELECTION_ALGORITHM algorithm>
+void histogram_1d_cpu_contiguous(Tensor& hist, const Tensor& bin_edges,
+        const Tensor& input, const std::optional<Tensor>& weight) {
+    const int64_t N = input.size(0);
+
+    const input_t *self_data = input.const_data_ptr<input_t>();
+    const input_t *weight_data = weight.has_value()
+            ? weight.value().const_data_ptr<input_t>()
+            : nullptr;
+
+    const input_t *bin_seq = bin_edges.data_ptr<input_t>();
+    const int64_t num_bin_edges = bin_edges.numel();
+    const int64_t num_bins = num_bin_edges - 1;
+    const input_t leftmost_edge = bin_seq[0];
+    const input_t rightmost_edge = bin_seq[num_bin_edges - 1];
+
+    /* Parallelizes processing of input using at::parallel_for.
+     * Each thread accumulates a local result into their own row of
+     * thread_histograms which get summed together at the end.
+     */
+    const auto num_threads = at::get_num_threads();
+    Tensor thread_histograms = at::zeros({num_threads, num_bins}, hist.dtype());
+    TORCH_INTERNAL_ASSERT(thread_histograms.is_contiguous());
+    input_t *thread_hist_data = thread_histograms.data_ptr<input_t>();
+
+    at::parallel_for(0, N, HISTOGRAM_GRAIN_SIZE, [&](int64_t start, int64_t end) {
+        input_t *hist_local_data = thread_hist_data + at::get_thread_num() * num_bins;
+
+        for (const auto i : c10::irange(start, end)) {
+            const input_t elt = self_data[i];
+
+            // Skips elements which fall outside the specified bins and NaN elements
+            if (!(elt >= leftmost_edge && elt <= rightmost_edge)) {
+                continue;
+            }
+
+            int64_t pos = -1;
+
+            if (algorithm == BINARY_SEARCH) {
+                pos = std::upper_bound(bin_seq, bin_seq + num_bin_edges, elt)
+                        - bin_seq - 1;
+            } else if (algorithm == LINEAR_INTERPOLATION
+                    || algorithm == LINEAR_INTERPOLATION_WITH_LOCAL_SEARCH) {
+                pos = static_cast<int64_t>((elt - leftmost_edge)
+                        * (num_bin_edges - 1)
+                        / (rightmost_edge - leftmost_edge));
+
+                if (algorithm == LINEAR_INTERPOLATION_WITH_LOCAL_SEARCH) {
+                    int64_t pos_min = std::max(static_cast<int64_t>(0), pos - 1);
+                    int64_t pos_max = std::min(pos + 2, num_bin_edges);
+                    pos = std::upper_bound(bin_seq + pos_min, bin_seq + pos_max, elt)
+                            - bin_seq - 1;
+                }
+            } else {
+                TORCH_INTERNAL_ASSERT(false);
+            }
+
+            // Unlike other bins, the rightmost bin includes its right boundary
+            if (pos == num_bins) {
+                pos -= 1;
+            }
+
+            // In the unweighted case, the default weight is 1
+            hist_local_data[pos] += weight_data ? weight_data[i] : static_cast<input_t>(1);
+        }
+    });
+
+    at::sum_out(hist, thread_histograms, /*dim=*/{0});
+}
+
 template<typename input_t, BIN_SELECTION_ALGORITHM algorithm>
 void histogramdd_cpu_contiguous(Tensor& hist, const TensorList& bin_edges,
         const Tensor& input, const std::optional<Tensor>& weight) {
@@ -98,6 +178,12 @@ void histogramdd_cpu_contiguous(Tensor& hist, const TensorList& bin_edges,
         return;
     }
 
+    if (D == 1 && input.is_contiguous()
+            && (!weight.has_value() || weight.value().is_contiguous())) {
+        histogram_1d_cpu_contiguous<input_t, algorithm>(hist, bin_edges[0], input, weight);
+        return;
+    }
+
     TensorAccessor<const input_t, 2> accessor_in = input.accessor<const input_t, 2>();
 
     /* Constructs a std::optional<TensorAccessor> containing an accessor if
@@ -1,9 +1,12 @@
 #define TORCH_ASSERT_ONLY_METHOD_OPERATORS
 #include <algorithm>
+#include <vector>
 
 #include <ATen/core/Tensor.h>
+#include <ATen/ceil_div.h>
 #include <ATen/Dispatch.h>
 #include <ATen/OpMathType.h>
+#include <ATen/Parallel.h>
 #include <ATen/cpu/vec/vec.h>
 #include <ATen/cpu/vec/functional.h>
 #include <ATen/native/ReduceOps.h>
@@ -77,10 +80,78 @@ static inline void cpu_cum_base_kernel(const Tensor& result,
   iter.for_each(loop, grain_size);
 }
 
+// Scans above this length take the three-phase parallel path below;
+// below it the serial scan is cheaper than the extra read of the input.
+constexpr int64_t CUMSUM_PARALLEL_MIN_NUMEL = 2 * internal::GRAIN_SIZE;
+
+// Three-phase parallel scan for a single long contiguous row:
+//   1. each chunk sums its elements (in the accumulation type),
+//   2. an exclusive prefix over the chunk totals seeds every chunk,
+//   3. each chunk rescans its elements starting from its seed.
+// The input is read twice, but both passes run across all threads,
+// whereas the row-serial kernel pins a single long row to one core.
+template <typename scalar_t>
+static void cumsum_1d_parallel_kernel(const Tensor& result, const Tensor& self) {
+  using acc_t = at::acc_type<scalar_t, false>;
+  const int64_t numel = self.numel();
+  const scalar_t* self_data = self.const_data_ptr<scalar_t>();
+  scalar_t* result_data = result.data_ptr<scalar_t>();
+
+  const int64_t num_chunks = std::min<int64_t>(
+      std::max(at::get_num_threads(), 1),
+      ceil_div(numel, internal::GRAIN_SIZE));
+  const int64_t chunk_size = ceil_div(numel, num_chunks);
+
+  std::vector<acc_t> chunk_prefix(num_chunks);
+  at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+    for (const auto c : c10::irange(chunk_begin, chunk_end)) {
+      const int64_t begin = c * chunk_size;
+      const int64_t end = std::min(numel, begin + chunk_size);
+      acc_t sum = 0;
+      for (const auto i : c10::irange(begin, end)) {
+        sum += self_data[i];
+      }
+      chunk_prefix[c] = sum;
+    }
+  });
+
+  acc_t running = 0;
+  for (const auto c : c10::irange(num_chunks)) {
+    acc_t total = chunk_prefix[c];
+    chunk_prefix[c] = running;
+    running += total;
+  }
+
+  at::parallel_for(0, num_chunks, 1, [&](int64_t chunk_begin, int64_t chunk_end) {
+    for (const auto c : c10::irange(chunk_begin, chunk_end)) {
+      const int64_t begin = c * chunk_size;
+      const int64_t end = std::min(numel, begin + chunk_size);
+      acc_t cum_number = chunk_prefix[c];
+      for (const auto i : c10::irange(begin, end)) {
+        cum_number += self_data[i];
+        result_data[i] = (scalar_t)cum_number;
+      }
+    }
+  });
+}
+
 static void cumsum_cpu_kernel(const Tensor& result, const Tensor& self, int64_t dim) {
   auto wrap_dim = maybe_wrap_dim(dim, self.dim());
   int64_t self_dim_size = ensure_nonempty_size(self, wrap_dim);
 
+  // Multi-row inputs already scan rows in parallel through the base
+  // kernel; a single long contiguous row would otherwise run on one
+  // thread, so it gets the chunked scan instead.
+  if (self.dim() == 1 && self.is_contiguous() && result.is_contiguous() &&
+      result.sizes() == self.sizes() &&
+      self_dim_size >= CUMSUM_PARALLEL_MIN_NUMEL) {
+    AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND2(
+        kBFloat16, kHalf, self.scalar_type(), "cumsum_out_cpu", [&] {
+      cumsum_1d_parallel_kernel<scalar_t>(result, self);
+    });
+    return;
+  }
+
   AT_DISPATCH_ALL_TYPES_AND_COMPLEX_AND2(kBFloat16, kHalf, self.scalar_type(), "cumsum_out_cpu", [&] {
     cpu_cum_base_kernel<scalar_t>(result, self, wrap_dim, [&] (
       scalar_t* result_data, auto result_dim_stride,
@@ -43,18 +43,60 @@ inline __m128i conver_int4_to_int8(const uint8_t* data) {
 
 #if defined(CPU_CAPABILITY_AVX512) && !defined(_MSC_VER)
 
+// load 32 elements (activation dtype) as 2x f32 vector
+inline void load_as_float32x16x2(const BFloat16* ptr, __m512& o1, __m512& o2) {
+  __m512i t = _mm512_loadu_si512((__m512i*)ptr);
+  vec::cvtbf16_fp32(t, o1, o2);
+}
+
+inline void load_as_float32x16x2(const Half* ptr, __m512& o1, __m512& o2) {
+  __m512i t = _mm512_loadu_si512((__m512i*)ptr);
+  vec::cvtfp16_fp32(t, o1, o2);
+}
+
+inline void load_as_float32x16x2(const float* ptr, __m512& o1, __m512& o2) {
+  o1 = _mm512_loadu_ps(ptr);
+  o2 = _mm512_loadu_ps(ptr + 16);
+}
+
+// store f32 vector back in the activation dtype
+inline void store_float32x16(BFloat16* ptr, const __m512& v) {
+  _mm256_storeu_si256((__m256i*)ptr, vec::cvtfp32_bf16(v));
+}
+
+inline void store_float32x16(Half* ptr, const __m512& v) {
+  _mm256_storeu_si256((__m256i*)ptr, vec::cvtfp32_fp16(v));
+}
+
+inline void store_float32x16(float* ptr, const __m512& v) {
+  _mm512_storeu_ps(ptr, v);
+}
+
+inline void store_float32x16x2(BFloat16* ptr, const __m512& v1, const __m512& v2) {
+  _mm512_storeu_si512((__m512i*)ptr, vec::cvtfp32_bf16(v1, v2));
+}
+
+inline void store_float32x16x2(Half* ptr, const __m512& v1, const __m512& v2) {
+  _mm512_storeu_si512((__m512i*)ptr, vec::cvtfp32_fp16(v1, v2));
+}
+
+inline void store_float32x16x2(float* ptr, const __m512& v1, const __m512& v2) {
+  _mm512_storeu_ps(ptr, v1);
+  _mm512_storeu_ps(ptr + 16, v2);
+}
+
 // A block : {BLOCK_M, BLOCK_K}, lda = K
 // B block : {BLOCK_K, BLOCK_N / 2}, ldb = BLOCK_N / 2
 // C block : {BLOCK_M, BLOCK_N}, ldc = N
 //
 // ScaleAndZeros block : {1, BLOCK_N, 2}
 //
-template <int BLOCK_M, int BLOCK_N>
-inline void tinygemm_kernel(
-    const BFloat16* RESTRICT A,
+template <int BLOCK_M, int BLOCK_N, typename T>
+inline void tinygemm_kernel_(
+    const T* RESTRICT A,
     const uint8_t* RESTRICT B,
-    const BFloat16* RESTRICT ScaleAndZeros,
-    BFloat16* RESTRICT C,
+    const T* RESTRICT ScaleAndZeros,
+    T* RESTRICT C,
     int lda,
     int ldb,
     int ldc,
@@ -76,10 +118,10 @@ inline void tinygemm_kernel(
   __m512 scale[COLS];
   __m512 zero[COLS];
 
-  // Lookup table to de-quantize int4 values to bf16.
+  // Lookup table to de-quantize int4 values to f32.
   // Values are dequantized as truly int4 [-8, 7] range;
   //
-  // dequant = (bf16(int4_value) * bf16_scale) + bf16_zero
+  // dequant = (f32(int4_value) * scale) + zero
   //
   static const __m512 lut = _mm512_set_ps(
       7.0f, 6.0f, 5.0f, 4.0f,
@@ -97,16 +139,13 @@ inline void tinygemm_kernel(
 
   // load scale and zero point
   auto load_scale_and_zeros = [&](int i, int _kb) {
-    // load 2x bfloat16 vector
-    __m512i t = _mm512_loadu_si512((__m512i*)(ScaleAndZeros + _kb * ldc * 2 + 32 * i));
+    // load 2x f32 vector
+    __m512 a, b;
+    load_as_float32x16x2(ScaleAndZeros + _kb * ldc * 2 + 32 * i, a, b);
     if (_kb + PREFETCH_SIZE_KB < KB) {
       _mm_prefetch(ScaleAndZeros + (_kb + PREFETCH_SIZE_KB) * ldc * 2 + 32 * i, _MM_HINT_T0);
     }
 
-    // convert to 2x f32 vector
-    __m512 a, b;
-    vec::cvtbf16_fp32(t, a, b);
-
     // transpose scale_and_zero from {16, 2} to {2, 16}
     // inputs:
     //   a: {s0, z0, s1, z1, ..., s7, z7}
@@ -182,16 +221,13 @@ inline void tinygemm_kernel(
     constexpr int col = i % COLS;
     if constexpr (COLS == 4) {
       // when BLOCK_N = 64, handle each row at a time
-      // to reduce `cvtfp32_bf16` overhead.
+      // to reduce dtype conversion overhead.
       if constexpr (col == 0) {
-        __m512i c01 = vec::cvtfp32_bf16(vc[row * 4 + 0], vc[row * 4 + 1]);
-        __m512i c23 = vec::cvtfp32_bf16(vc[row * 4 + 2], vc[row * 4 + 3]);
-        _mm512_storeu_si512((__m512i*)(C + row * ldc + 0 * 32), c01);
-        _mm512_storeu_si512((__m512i*)(C + row * ldc + 1 * 32), c23);
+        store_float32x16x2(C + row * ldc + 0 * 32, vc[row * 4 + 0], vc[row * 4 + 1]);
+        store_float32x16x2(C + row * ldc + 1 * 32, vc[row * 4 + 2], vc[row * 4 + 3]);
       }
     } else {
-      __m256i ci = vec::cvtfp32_bf16(vc[i]);
-      _mm256_storeu_si256((__m256i*)(C + row * ldc + col * 16), ci);
+      store_float32x16(C + row * ldc + col * 16, vc[i]);
     }
   };
   c10::ForcedUnroll<ROWS * COLS>{}(storec);
@@ -199,12 +235,42 @@ inline void tinygemm_kernel(
 
 #elif defined(CPU_CAPABILITY_AVX2) && !defined(_MSC_VER)
 
-template <int BLOCK_M, int BLOCK_N>
-inline void tinygemm_kernel(
-    const BFloat16* RESTRICT A,
+// load 16 elements (activation dtype) as 2x f32 vector
+inline void load_as_float32x8x2(const BFloat16* ptr, __m256& o1, __m256& o2) {
+  __m256i t = _mm256_loadu_si256((__m256i*)ptr);
+  vec::cvtbf16_fp32(t, o1, o2);
+}
+
+inline void load_as_float32x8x2(const Half* ptr, __m256& o1, __m256& o2) {
+  __m256i t = _mm256_loadu_si256((__m256i*)ptr);
+  vec::cvtfp16_fp32(t, o1, o2);
+}
+
+inline void load_as_float32x8x2(const float* ptr, __m256& o1, __m256& o2) {
+  o1 = _mm256_loadu_ps(ptr);
+  o2 = _mm256_loadu_ps(ptr + 8);
+}
+
+// store 2x f32 vector back in the activation dtype
+inline void store_float32x8x2(BFloat16* ptr, const __m256& v1, const __m256& v2) {
+  _mm256_storeu_si256((__m256i*)ptr, vec::cvtfp32_bf16(v1, v2));
+}
+
+inline void store_float32x8x2(Half* ptr, const __m256& v1, const __m256& v2) {
+  _mm256_storeu_si256((__m256i*)ptr, vec::cvtfp32_fp16(v1, v2));
+}
+
+inline void store_float32x8x2(float* ptr, const __m256& v1, const __m256& v2) {
+  _mm256_storeu_ps(ptr, v1);
+  _mm256_storeu_ps(ptr + 8, v2);
+}
+
+template <int BLOCK_M, int BLOCK_N, typename T>
+inline void tinygemm_kernel_(
+    const T* RESTRICT A,
     const uint8_t* RESTRICT B,
-    const BFloat16* RESTRICT ScaleAndZeros,
-    BFloat16* RESTRICT C,
+    const T* RESTRICT ScaleAndZeros,
+    T* RESTRICT C,
     int lda,
     int ldb,
     int ldc,
@@ -233,16 +299,13 @@ inline void tinygemm_kernel(
 
   // load scale and zero point
   auto load_scale_and_zeros = [&](int i, int _kb) {
-    // load 2x bfloat16 vector
-    __m256i t = _mm256_loadu_si256((__m256i*)(ScaleAndZeros + _kb * ldc * 2 + 16 * i));
+    // load 2x f32 vector
+    __m256 a, b;
+    load_as_float32x8x2(ScaleAndZeros + _kb * ldc * 2 + 16 * i, a, b);
     if (_kb + PREFETCH_SIZE_KB < KB) {
       _mm_prefetch(ScaleAndZeros + (_kb + PREFETCH_SIZE_KB) * ldc * 2 + 16 * i, _MM_HINT_T0);
     }
 
-    // convert to 2x f32 vector
-    __m256 a, b;
-    vec::cvtbf16_fp32(t, a, b);
-
     // transpose scale_and_zero from {8, 2} to {2, 8}
     // inputs:
     //   a: {s0, z0, s1, z1, s2, z2, s3, z3}
@@ -331,8 +394,7 @@ inline void tinygemm_kernel(
     constexpr int row = i / COLS;
     constexpr int col = i % COLS;
     if constexpr (col % 2 == 0) {
-      __m256i ci = vec::cvtfp32_bf16(vc[row * COLS + col], vc[row * COLS + col + 1]);
-      _mm256_storeu_si256((__m256i*)(C + row * ldc + col * 8), ci);
+      store_float32x8x2(C + row * ldc + col * 8, vc[row * COLS + col], vc[row * COLS + col + 1]);
     }
   };
   c10::ForcedUnroll<ROWS * COLS>{}(storec);
@@ -340,6 +402,50 @@ inline void tinygemm_kernel(
 
 #endif
 
+#if (defined(CPU_CAPABILITY_AVX512) || defined(CPU_CAPABILITY_AVX2)) && !defined(_MSC_VER)
+template <int BLOCK_M, int BLOCK_N>
+inline void tinygemm_kernel(
+    const BFloat16* RESTRICT A,
+    const uint8_t* RESTRICT B,
+    const BFloat16* RESTRICT ScaleAndZeros,
+    BFloat16* RESTRICT C,
+    int lda,
+    int ldb,
+    int ldc,
+    int K,
+    int BLOCK_K) {
+  tinygemm_kernel_<BLOCK_M, BLOCK_N>(A, B, ScaleAndZeros, C, lda, ldb, ldc, K, BLOCK_K);
+}
+
+template <int BLOCK_M, int BLOCK_N>
+inline void tinygemm_kernel(
+    const Half* RESTRICT A,
+    const uint8_t* RESTRICT B,
+    const Half* RESTRICT ScaleAndZeros,
+    Half* RESTRICT C,
+    int lda,
+    int ldb,
+    int ldc,
+    int K,
+    int BLOCK_K) {
+  tinygemm_kernel_<BLOCK_M, BLOCK_N>(A, B, ScaleAndZeros, C, lda, ldb, ldc, K, BLOCK_K);
+}
+
+template <int BLOCK_M, int BLOCK_N>
+inline void tinygemm_kernel(
+    const float* RESTRICT A,
+    const uint8_t* RESTRICT B,
+    const float* RESTRICT ScaleAndZeros,
+    float* RESTRICT C,
+    int lda,
+    int ldb,
+    int ldc,
+    int K,
+    int BLOCK_K) {
+  tinygemm_kernel_<BLOCK_M, BLOCK_N>(A, B, ScaleAndZeros, C, lda, ldb, ldc, K, BLOCK_K);
+}
+#endif
+
 #if !defined(C10_MOBILE) && defined(__aarch64__)
 #include <arm_neon.h>
 
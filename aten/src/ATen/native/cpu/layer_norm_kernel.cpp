@@ -181,6 +181,223 @@ void LayerNormKernelImpl(
   });
 }
 
+// Computes Y = norm(X + Z) * gamma (+ beta) while also materializing the
+// summed residual stream X + Z for the next block, so the add costs no
+// extra pass over the activations. Accumulation is in opmath_t. out_t only
+// differs from T when a float residual stream is downcast to a reduced
+// floating type on output.
+template <typename T, typename out_t>
+void FusedAddLayerNormKernelImplInternal(
+    const Tensor& X,
+    const Tensor& Z,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y,
+    Tensor* add_out) {
+  using opmath_t = at::opmath_type<T>;
+  const T* X_data = X.const_data_ptr<T>();
+  const T* Z_data = Z.const_data_ptr<T>();
+  const T* gamma_data = gamma.defined() ? gamma.const_data_ptr<T>() : nullptr;
+  const T* beta_data = beta.defined() ? beta.const_data_ptr<T>() : nullptr;
+  out_t* Y_data = Y->data_ptr<out_t>();
+  T* A_data = add_out->data_ptr<T>();
+
+  const bool gamma_null = gamma_data == nullptr;
+  const bool beta_null = beta_data == nullptr;
+  at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
+    for (const auto i : c10::irange(start, end)) {
+      const T* X_ptr = X_data + i * N;
+      const T* Z_ptr = Z_data + i * N;
+      T* A_ptr = A_data + i * N;
+      out_t* Y_ptr = Y_data + i * N;
+      vec::map2<T>(
+          [](auto x, auto z) { return x + z; }, A_ptr, X_ptr, Z_ptr, N);
+      auto [mean_val, var_val] = RowwiseMoments(A_ptr, N);
+      const opmath_t rstd_val = opmath_t(1) / std::sqrt(var_val + opmath_t(eps));
+      const opmath_t scale = rstd_val;
+      const opmath_t bias = -rstd_val * mean_val;
+      if constexpr (std::is_same_v<T, out_t>) {
+        if (gamma_null || beta_null) {
+          for (const auto j : c10::irange(N)) {
+            const opmath_t gamma_v = gamma_null ? opmath_t(1) : opmath_t(gamma_data[j]);
+            const opmath_t beta_v = beta_null ? opmath_t(0) : opmath_t(beta_data[j]);
+            Y_ptr[j] = (opmath_t(A_ptr[j]) * scale + bias) * gamma_v + beta_v;
+          }
+        } else {
+          vec::map3<T>(
+              [scale, bias](auto a, auto gamma, auto beta) {
+                using V = decltype(a);
+                return (a * V(scale) + V(bias)) * gamma + beta;
+              },
+              Y_ptr,
+              A_ptr,
+              gamma_data,
+              beta_data,
+              N);
+        }
+      } else {
+        // float residual stream, reduced type output
+        using bVec = Vectorized<out_t>;
+        using fVec = Vectorized<float>;
+        int64_t d = 0;
+        for (; d < N - (N % bVec::size()); d += bVec::size()) {
+          fVec a_fvec0 = fVec::loadu(A_ptr + d);
+          fVec a_fvec1 = fVec::loadu(A_ptr + d + fVec::size());
+          fVec gamma_fvec0 = gamma_null ? fVec(1) : fVec::loadu(gamma_data + d);
+          fVec gamma_fvec1 = gamma_null ? fVec(1) : fVec::loadu(gamma_data + d + fVec::size());
+          fVec beta_fvec0 = beta_null ? fVec(0) : fVec::loadu(beta_data + d);
+          fVec beta_fvec1 = beta_null ? fVec(0) : fVec::loadu(beta_data + d + fVec::size());
+          fVec y_fvec0 = (a_fvec0 * fVec(scale) + fVec(bias)) * gamma_fvec0 + beta_fvec0;
+          fVec y_fvec1 = (a_fvec1 * fVec(scale) + fVec(bias)) * gamma_fvec1 + beta_fvec1;
+          bVec y_bvec = convert_from_float<out_t>(y_fvec0, y_fvec1);
+          y_bvec.store(Y_ptr + d);
+        }
+        for (; d < N; d++) {
+          const float gamma_v = gamma_null ? float(1) : gamma_data[d];
+          const float beta_v = beta_null ? float(0) : beta_data[d];
+          Y_ptr[d] = (A_ptr[d] * scale + bias) * gamma_v + beta_v;
+        }
+      }
+    }
+  });
+}
+
+template <typename T, typename out_t>
+void FusedAddRMSNormKernelImplInternal(
+    const Tensor& X,
+    const Tensor& Z,
+    const Tensor& gamma,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y,
+    Tensor* add_out) {
+  using opmath_t = at::opmath_type<T>;
+  const T* X_data = X.const_data_ptr<T>();
+  const T* Z_data = Z.const_data_ptr<T>();
+  const T* gamma_data = gamma.defined() ? gamma.const_data_ptr<T>() : nullptr;
+  T* A_data = add_out->data_ptr<T>();
+  out_t* Y_data = Y->data_ptr<out_t>();
+
+  const bool gamma_null = gamma_data == nullptr;
+  at::parallel_for(0, M, 1, [&](int64_t start, int64_t end) {
+    for (const auto i : c10::irange(start, end)) {
+      const T* X_ptr = X_data + i * N;
+      const T* Z_ptr = Z_data + i * N;
+      T* A_ptr = A_data + i * N;
+      out_t* Y_ptr = Y_data + i * N;
+      vec::map2<T>(
+          [](auto x, auto z) { return x + z; }, A_ptr, X_ptr, Z_ptr, N);
+      // mean(a^2) = var(a) + mean(a)^2
+      auto [mean_val, var_val] = RowwiseMoments(A_ptr, N);
+      const opmath_t scale =
+          opmath_t(1) / std::sqrt(var_val + mean_val * mean_val + opmath_t(eps));
+      if constexpr (std::is_same_v<T, out_t>) {
+        if (gamma_null) {
+          vec::map<T>(
+              [scale](auto a) { return a * decltype(a)(scale); },
+              Y_ptr,
+              A_ptr,
+              N);
+        } else {
+          vec::map2<T>(
+              [scale](auto a, auto gamma) { return a * decltype(a)(scale) * gamma; },
+              Y_ptr,
+              A_ptr,
+              gamma_data,
+              N);
+        }
+      } else {
+        // float residual stream, reduced type output
+        using bVec = Vectorized<out_t>;
+        using fVec = Vectorized<float>;
+        int64_t d = 0;
+        for (; d < N - (N % bVec::size()); d += bVec::size()) {
+          fVec a_fvec0 = fVec::loadu(A_ptr + d);
+          fVec a_fvec1 = fVec::loadu(A_ptr + d + fVec::size());
+          fVec gamma_fvec0 = gamma_null ? fVec(1) : fVec::loadu(gamma_data + d);
+          fVec gamma_fvec1 = gamma_null ? fVec(1) : fVec::loadu(gamma_data + d + fVec::size());
+          bVec y_bvec = convert_from_float<out_t>(
+              a_fvec0 * fVec(scale) * gamma_fvec0,
+              a_fvec1 * fVec(scale) * gamma_fvec1);
+          y_bvec.store(Y_ptr + d);
+        }
+        for (; d < N; d++) {
+          const float gamma_v = gamma_null ? float(1) : gamma_data[d];
+          Y_ptr[d] = A_ptr[d] * scale * gamma_v;
+        }
+      }
+    }
+  });
+}
+
+void FusedAddLayerNormKernelImpl(
+    const Tensor& X,
+    const Tensor& Z,
+    const Tensor& gamma,
+    const Tensor& beta,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y,
+    Tensor* add_out) {
+  TORCH_DCHECK_EQ(X.numel(), M * N);
+  TORCH_DCHECK_EQ(Z.numel(), M * N);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  DCHECK(!beta.defined() || beta.numel() == N);
+  AT_DISPATCH_FLOATING_TYPES_AND2(kBFloat16, kHalf, X.scalar_type(),
+      "FusedAddLayerNormKernelImpl", [&]() {
+    if constexpr (std::is_same_v<scalar_t, float>) {
+      if (Y->scalar_type() == kBFloat16) {
+        FusedAddLayerNormKernelImplInternal<float, BFloat16>(
+            X, Z, gamma, beta, M, N, eps, Y, add_out);
+        return;
+      }
+      if (Y->scalar_type() == kHalf) {
+        FusedAddLayerNormKernelImplInternal<float, Half>(
+            X, Z, gamma, beta, M, N, eps, Y, add_out);
+        return;
+      }
+    }
+    FusedAddLayerNormKernelImplInternal<scalar_t, scalar_t>(
+        X, Z, gamma, beta, M, N, eps, Y, add_out);
+  });
+}
+
+void FusedAddRMSNormKernelImpl(
+    const Tensor& X,
+    const Tensor& Z,
+    const Tensor& gamma,
+    int64_t M,
+    int64_t N,
+    double eps,
+    Tensor* Y,
+    Tensor* add_out) {
+  TORCH_DCHECK_EQ(X.numel(), M * N);
+  TORCH_DCHECK_EQ(Z.numel(), M * N);
+  DCHECK(!gamma.defined() || gamma.numel() == N);
+  AT_DISPATCH_FLOATING_TYPES_AND2(kBFloat16, kHalf, X.scalar_type(),
+      "FusedAddRMSNormKernelImpl", [&]() {
+    if constexpr (std::is_same_v<scalar_t, float>) {
+      if (Y->scalar_type() == kBFloat16) {
+        FusedAddRMSNormKernelImplInternal<float, BFloat16>(
+            X, Z, gamma, M, N, eps, Y, add_out);
+        return;
+      }
+      if (Y->scalar_type() == kHalf) {
+        FusedAddRMSNormKernelImplInternal<float, Half>(
+            X, Z, gamma, M, N, eps, Y, add_out);
+        return;
+      }
+    }
+    FusedAddRMSNormKernelImplInternal<scalar_t, scalar_t>(
+        X, Z, gamma, M, N, eps, Y, add_out);
+  });
+}
+
 template <typename T, typename T2, typename opmath_t>
 void layer_norm_backward_frame(
     const T* dY_data,
@@ -611,5 +828,7 @@ void LayerNormBackwardKernelImpl(
 
 REGISTER_DISPATCH(LayerNormKernel, &LayerNormKernelImpl);
 REGISTER_DISPATCH(LayerNormBackwardKernel, &LayerNormBackwardKernelImpl);
+REGISTER_DISPATCH(FusedAddLayerNormKernel, &FusedAddLayerNormKernelImpl);
+REGISTER_DISPATCH(FusedAddRMSNormKernel, &FusedAddRMSNormKernelImpl);
 
 } // namespace at::native
@@ -86,6 +86,44 @@ void logit_backward_kernel_cuda(TensorIteratorBase& iter, const Scalar& eps_scal
       });
 }
 
+CONSTEXPR_EXCEPT_WIN_CUDA char tan_backward_name[] = "tan_backward";
+void tan_backward_kernel_cuda(TensorIteratorBase& iter) {
+  auto dtype = iter.dtype();
+  if(isComplexType(dtype)) {
+#if AT_USE_JITERATOR()
+    static const auto tan_backward_string = jiterator_stringify(
+      template <typename T>
+      T tan_backward(T a, T b) {
+        return a * std::conj(T{1.} + b * b);
+      }
+    ); // tan_backward_string
+    AT_DISPATCH_COMPLEX_TYPES_AND(kComplexHalf, dtype, "tan_backward_complex_cuda", [&]() {
+      jitted_gpu_kernel<
+          /*name=*/ tan_backward_name,
+          /*return_dtype=*/ scalar_t,
+          /*common_dtype=*/ scalar_t,
+          /*arity=*/ 2>(iter, tan_backward_string);
+    });
+#else
+    AT_DISPATCH_COMPLEX_TYPES_AND(kComplexHalf, dtype, "tan_backward_complex_cuda", [&]() {
+      gpu_kernel(iter, [] GPU_LAMBDA(scalar_t a, scalar_t b) -> scalar_t {
+        using comp_t = at::opmath_type<scalar_t>;
+        const auto one = comp_t{1.};
+        const auto comp_b = static_cast<comp_t>(b);
+        const auto comp_a = static_cast<comp_t>(a);
+        return static_cast<scalar_t>(comp_a * std::conj(one + comp_b * comp_b));
+      });
+    });
+#endif
+  } else {
+    AT_DISPATCH_FLOATING_TYPES_AND2(at::ScalarType::Half, at::ScalarType::BFloat16, dtype, "tan_backward_cuda", [&]() {
+      gpu_kernel(iter, [] GPU_LAMBDA(scalar_t a, scalar_t b) -> scalar_t {
+        return a * (scalar_t{1.} + b * b);
+      });
+    });
+  }
+}
+
 CONSTEXPR_EXCEPT_WIN_CUDA char tanh_backward_name[] = "tanh_backward";
 void tanh_backward_kernel_cuda(TensorIteratorBase& iter) {
   auto dtype = iter.dtype();
@@ -126,6 +164,7 @@ void tanh_backward_kernel_cuda(TensorIteratorBase& iter) {
 
 REGISTER_DISPATCH(sigmoid_backward_stub, &sigmoid_backward_kernel_cuda);
 REGISTER_DISPATCH(logit_backward_stub, &logit_backward_kernel_cuda);
+REGISTER_DISPATCH(tan_backward_stub, &tan_backward_kernel_cuda);
 REGISTER_DISPATCH(tanh_backward_stub, &tanh_backward_kernel_cuda);
 
 } // namespace at::native
@@ -7,12 +7,14 @@
 #include <ATen/core/NamedTensor.h>
 #include <ATen/Dispatch.h>
 #include <ATen/ExpandUtils.h>
+#include <ATen/ceil_div.h>
 #include <ATen/OpMathType.h>
 #include <ATen/TensorUtils.h>
 #include <ATen/cuda/CUDABlas.h>
 #include <ATen/cuda/tunable/Tunable.h>
 #include <ATen/cuda/tunable/TunableGemm.h>
 #include <ATen/native/Resize.h>
+#include <ATen/native/nested/NestedTensorUtils.h>
 #include <c10/util/MaybeOwned.h>
 #include <ATen/native/cuda/RowwiseScaledMM.h>
 
@@ -22,12 +24,14 @@
 #else
 #include <ATen/ops/_addmm_activation_native.h>
 #include <ATen/ops/_efficientzerotensor.h>
+#include <ATen/ops/_grouped_mm_native.h>
 #include <ATen/ops/_scaled_mm_native.h>
 #include <ATen/ops/_unsafe_view_native.h>
 #include <ATen/ops/abs.h>
 #include <ATen/ops/addmm_native.h>
 #include <ATen/ops/addmv_native.h>
 #include <ATen/ops/baddbmm_native.h>
+#include <ATen/ops/bmm.h>
 #include <ATen/ops/bmm_native.h>
 #include <ATen/ops/copy_native.h>
 #include <ATen/ops/dot_native.h>
@@ -853,6 +857,54 @@ Tensor _int_mm_cuda(const Tensor& self, const Tensor& mat2) {
   return _int_mm_out_cuda(self, mat2, result);
 }
 
+Tensor _grouped_mm_cuda(const Tensor& self, const Tensor& mat2, const Tensor& group_sizes) {
+  TORCH_CHECK(self.dim() == 2, "_grouped_mm: Expected self to be of dimension 2 but got ", self.dim());
+  TORCH_CHECK(mat2.dim() == 3, "_grouped_mm: Expected mat2 to be of dimension 3 (groups x k x n) but got ", mat2.dim());
+  TORCH_CHECK(self.size(1) == mat2.size(1),
+      "_grouped_mm: self.size(1) needs to match mat2.size(1) but got ", self.size(1), " and ", mat2.size(1));
+  TORCH_CHECK(self.scalar_type() == mat2.scalar_type(),
+      "_grouped_mm: Expected self and mat2 to have the same dtype, but got ", self.scalar_type(), " and ", mat2.scalar_type());
+  TORCH_CHECK(group_sizes.dim() == 1 && group_sizes.scalar_type() == at::kLong && group_sizes.is_cpu(),
+      "_grouped_mm: Expected group_sizes to be a 1-D int64 CPU tensor");
+  TORCH_CHECK(group_sizes.size(0) == mat2.size(0),
+      "_grouped_mm: Expected one entry of group_sizes per group of mat2, but got ",
+      group_sizes.size(0), " and ", mat2.size(0));
+
+  auto mat1 = self.contiguous();
+  auto weights = mat2.contiguous();
+  const int64_t num_groups = weights.size(0);
+  const int64_t k = mat1.size(1);
+  const int64_t n = weights.size(2);
+
+  auto group_sizes_contig = group_sizes.contiguous();
+  const int64_t* group_sizes_ptr = group_sizes_contig.const_data_ptr<int64_t>();
+
+  // Wrap the packed activations and the stacked weights as nested tensors
+  // over their own buffers; nested bmm launches all groups as a single
+  // CUTLASS grouped GEMM where supported and falls back to one mm per group
+  // otherwise.
+  Tensor sizemat_a = at::empty({num_groups, 2}, group_sizes.options());
+  Tensor sizemat_b = at::empty({num_groups, 2}, group_sizes.options());
+  int64_t* sizemat_a_ptr = sizemat_a.mutable_data_ptr<int64_t>();
+  int64_t* sizemat_b_ptr = sizemat_b.mutable_data_ptr<int64_t>();
+  int64_t total_m = 0;
+  for (const auto g : c10::irange(num_groups)) {
+    TORCH_CHECK(group_sizes_ptr[g] >= 0, "_grouped_mm: group_sizes must be non-negative");
+    sizemat_a_ptr[g * 2] = group_sizes_ptr[g];
+    sizemat_a_ptr[g * 2 + 1] = k;
+    sizemat_b_ptr[g * 2] = k;
+    sizemat_b_ptr[g * 2 + 1] = n;
+    total_m += group_sizes_ptr[g];
+  }
+  TORCH_CHECK(total_m == mat1.size(0),
+      "_grouped_mm: group_sizes must sum to self.size(0), but got ", total_m, " and ", mat1.size(0));
+
+  auto nested_a = wrap_buffer(mat1.view(-1), sizemat_a);
+  auto nested_b = wrap_buffer(weights.view(-1), sizemat_b);
+  auto nested_out = at::bmm(nested_a, nested_b);
+  return get_nested_tensor_impl(nested_out)->get_buffer().view({mat1.size(0), n});
+}
+
 static bool _scaled_mm_allowed_device() {
     auto dprops = at::cuda::getCurrentDeviceProperties();
 #ifdef USE_ROCM
@@ -875,8 +927,13 @@ namespace{
 enum class ScalingType {
   TensorWise,
   RowWise,
+  BlockWise,
   Error
 };
+
+// Block edge length for block-wise scaling.
+constexpr int64_t kScaledMMBlockSize = 128;
+
 /*
  * Scaling Type Determination:
  * ---------------------------
@@ -885,9 +942,13 @@ enum class ScalingType {
  * - If scale_a.numel() == 1 && scale_b.numel() == 1:
  *   - Returns TensorWise.
  *
- * - Else if scale_a.dim() == 1 && scale_a.size(0) == dim_m && scale_b.size(0) == dim_n:
+ * - Else if scale_a.size() == (dim_m, 1) && scale_b.size() == (1, dim_n):
  *   - Returns RowWise.
  *
+ * - Else if scale_a.size() == (ceil(dim_m / 128), ceil(dim_k / 128)) &&
+ *   scale_b.size() == (ceil(dim_k / 128), ceil(dim_n / 128)):
+ *   - Returns BlockWise (one scale per 128x128 tile of each operand).
+ *
  * - Otherwise:
  *   - Returns Error.
  */
@@ -898,8 +959,9 @@ ScalingType get_scaling_type(
     const at::Tensor& scale_a,
     const at::Tensor& scale_b,
     int64_t dim_m,
+    int64_t dim_k,
     int64_t dim_n) {
-  // Both Per-Tensor and Row-wise scaling expect fp32 tensors
+  // Per-Tensor, Row-wise and Block-wise scaling all expect fp32 tensors
   TORCH_CHECK(
       scale_a.scalar_type() == kFloat && scale_b.scalar_type() == kFloat,
       "Both scale_a and scale_b must be float (fp32) tensors.");
@@ -933,6 +995,18 @@ ScalingType get_scaling_type(
 #endif
   }
 
+  // Check for BlockWise scaling: one scale per 128x128 tile of each operand
+  const int64_t blocks_m = ceil_div<int64_t>(dim_m, kScaledMMBlockSize);
+  const int64_t blocks_k = ceil_div<int64_t>(dim_k, kScaledMMBlockSize);
+  const int64_t blocks_n = ceil_div<int64_t>(dim_n, kScaledMMBlockSize);
+  if (scale_a.size(0) == blocks_m && scale_a.size(1) == blocks_k &&
+      scale_b.size(0) == blocks_k && scale_b.size(1) == blocks_n) {
+    TORCH_CHECK(
+        scale_a.is_contiguous() && scale_b.is_contiguous(),
+        "Both scale_a and scale_b must be contiguous for BlockWise scaling.");
+    return ScalingType::BlockWise;
+  }
+
   // If we reach here, the input doesn't match any valid scaling type
   TORCH_CHECK(
       false,
@@ -942,6 +1016,15 @@ ScalingType get_scaling_type(
       ", 1) and scale_b should be (1, ",
       dim_n,
       "). "
+      "For BlockWise scaling, scale_a should be (",
+      blocks_m,
+      ", ",
+      blocks_k,
+      ") and scale_b should be (",
+      blocks_k,
+      ", ",
+      blocks_n,
+      "). "
       "Got scale_a.size()=(",
       scale_a.size(0),
       ", ",
@@ -996,7 +1079,7 @@ _scaled_mm_out_cuda(const Tensor& mat1, const Tensor& mat2,
       mat1.sizes()[0], "x", mat1.sizes()[1], " and ", mat2.sizes()[0], "x", mat2.sizes()[1], ")");
 
   // Check what type of scaling we are doing based on inputs
-  ScalingType scaling_choice = get_scaling_type(scale_a, scale_b, mat1.size(0), mat2.size(1));
+  ScalingType scaling_choice = get_scaling_type(scale_a, scale_b, mat1.size(0), mat1.size(1), mat2.size(1));
   TORCH_INTERNAL_ASSERT(scaling_choice != ScalingType::Error, "Scaling type not supported");
 
   TORCH_CHECK(!scale_result || (scale_result->numel() == 1 && scale_result->scalar_type() == kFloat),
@@ -1045,6 +1128,32 @@ _scaled_mm_out_cuda(const Tensor& mat1, const Tensor& mat2,
   IntArrayRef mat2_sizes = mat2.sizes();
   at::native::resize_output(out, {mat1_sizes[0], mat2_sizes[1]});
 
+  // We are doing block-wise (128x128 tile) scaling. Neither cuBLASLt nor the
+  // CUTLASS row-wise kernel takes per-tile scales, so dequantize the operands
+  // with their tile scales and run the matmul in fp32. This keeps the recipe
+  // numerics exact for validation; a fused kernel can replace it later without
+  // changing the op surface.
+  if (scaling_choice == ScalingType::BlockWise) {
+    TORCH_CHECK(
+        out.dtype() == kBFloat16 || out.dtype() == kHalf || out.dtype() == kFloat,
+        "Only high precision output types are supported for block-wise scaling.");
+    TORCH_CHECK(!scale_result, "scale_result is not supported for block-wise scaling.");
+    auto expand_scales = [](const Tensor& scales, IntArrayRef sizes) {
+      return scales.repeat_interleave(kScaledMMBlockSize, 0)
+          .narrow(0, 0, sizes[0])
+          .repeat_interleave(kScaledMMBlockSize, 1)
+          .narrow(1, 0, sizes[1]);
+    };
+    auto mat1_fp32 = mat1.to(kFloat).mul_(expand_scales(scale_a, mat1_sizes));
+    auto mat2_fp32 = mat2.to(kFloat).mul_(expand_scales(scale_b, mat2_sizes));
+    auto result = mat1_fp32.mm(mat2_fp32);
+    if (bias) {
+      result.add_(*bias);
+    }
+    out.copy_(result);
+    return out;
+  }
+
   // We are doing row-wise scaling
   if (scaling_choice == ScalingType::RowWise) {
     TORCH_CHECK(out.dtype() == kBFloat16, "Only bf16 high precsion output types are supported for row-wise scaling.");
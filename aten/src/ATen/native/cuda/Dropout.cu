@@ -8,6 +8,7 @@
 #include <ATen/cuda/detail/TensorInfo.cuh>
 #include <ATen/cuda/CUDAGraphsUtils.cuh>
 #include <c10/macros/Macros.h>
+#include <c10/util/env.h>
 #include <curand_kernel.h>
 
 #include <ATen/native/TensorIterator.h>
@@ -29,6 +30,17 @@ namespace at::native {
 
 namespace {
 
+// Advances a device-side philox offset slot after the consumer kernel, so a
+// captured dropout replays with fresh randomness without host intervention.
+// Captured as its own graph node ordered after the dropout kernel, see
+// Note [Self-incrementing RNG offsets under CUDA Graphs] in
+// CUDAGeneratorImpl.cpp.
+__global__ void philox_offset_bump_kernel(
+    int64_t* offset_slot,
+    const int64_t* wholegraph_increment) {
+  *offset_slot += *wholegraph_increment;
+}
+
 // philox generates 128 bits of randomness at a time. Kernel uses this explicitly by putting suitably transformed result into float4
 // for all members of float4 to be consumed UNROLL has to be 4. Don't change!
 // Note: VEC <= 4 (and in most real-world cases will be 4), so same logic applies.
@@ -350,10 +362,19 @@ dropout_cuda(CUDAGeneratorImpl* gen, const Tensor& self, double p){
 //number of times random will be generated per thread, to offset philox counter in thc random state
   int64_t counter_offset = ((nelem - 1)/(block_size*grid.x*UNROLL)+1)*UNROLL;
   PhiloxCudaState rng_engine_inputs;
+  int64_t* rng_offset_slot = nullptr;
+  const int64_t* rng_wholegraph_increment = nullptr;
   {
     // See Note [Acquire lock when using random generators]
     std::lock_guard<std::mutex> lock(gen->mutex_);
-    rng_engine_inputs = gen->philox_cuda_state(counter_offset);
+    if (CUDAGeneratorImpl::graph_device_offsets_enabled() &&
+        at::cuda::currentStreamCaptureStatus() !=
+            at::cuda::CaptureStatus::None) {
+      rng_engine_inputs = gen->philox_cuda_state_with_device_offset(
+          counter_offset, &rng_offset_slot, &rng_wholegraph_increment);
+    } else {
+      rng_engine_inputs = gen->philox_cuda_state(counter_offset);
+    }
   }
   if (cuda::detail::canUse32BitIndexMath(self)){
     launcher<unsigned int, mask_t>(
@@ -362,6 +383,11 @@ dropout_cuda(CUDAGeneratorImpl* gen, const Tensor& self, double p){
     launcher<uint64_t, mask_t>(
         self, ret, mask, p, nelem, rng_engine_inputs, grid, dim_block);
   }
+  if (rng_offset_slot != nullptr) {
+    philox_offset_bump_kernel<<<1, 1, 0, at::cuda::getCurrentCUDAStream()>>>(
+        rng_offset_slot, rng_wholegraph_increment);
+    C10_CUDA_KERNEL_LAUNCH_CHECK();
+  }
   return std::tuple<Tensor,Tensor>(ret, mask);
 }
 
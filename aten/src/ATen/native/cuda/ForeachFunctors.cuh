@@ -401,6 +401,44 @@ struct ZeroFunctor {
   }
 };
 
+// Dynamic-mode counterpart of ZeroFunctor, for use with
+// multi_tensor_apply_dynamic: the chunk is identified by the global chunk
+// index handed in by the grid-stride loop rather than by blockIdx.x.
+template <typename T>
+struct ZeroChunkFunctor {
+  __device__ __forceinline__ void operator()(
+      int chunk_size,
+      int64_t global_chunk,
+      DeviceTensorListMetadata<1>& tl) {
+    const auto tensor_loc = tl.chunk_to_tensor[global_chunk];
+    const auto chunk_idx = tl.chunk_to_chunk_idx[global_chunk];
+    auto n = tl.numel_for_tensor[tensor_loc];
+
+    T* dst = (T*)tl.addresses[0][tensor_loc] + chunk_idx * chunk_size;
+    n -= chunk_idx * chunk_size;
+    if (n > chunk_size) {
+      n = chunk_size;
+    }
+
+    // to make things simple, we put aligned case in a different code path
+    if (n % kILP == 0 && chunk_size % kILP == 0 && is_aligned(dst)) {
+      using LT = at::native::memory::aligned_vector<T, kILP>;
+      LT zero_vec;
+#pragma unroll
+      for (int ii = 0; ii < kILP; ii++) {
+        zero_vec.val[ii] = 0;
+      }
+      for (int64_t i = threadIdx.x; i * kILP < n; i += blockDim.x) {
+        ((LT*)dst)[i] = zero_vec;
+      }
+    } else {
+      for (int64_t i = threadIdx.x; i < n; i += blockDim.x) {
+        dst[i] = 0;
+      }
+    }
+  }
+};
+
 template <typename T, int depth, int r_args_depth, int res_arg_index>
 struct UnaryOpFunctor {
   using opmath_t = at::opmath_type<T>;
@@ -0,0 +1,140 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/native/ForeachUtils.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <vector>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_foreach_index_select_native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+namespace at::native {
+
+namespace {
+
+// Batched dim-0 gather: one launch reorders the rows of many tensors with a
+// shared index, instead of one index_select kernel per tensor. The tensors
+// may have different dtypes and trailing shapes (rows are copied as bytes),
+// which is what beam search needs to reorder every layer's K and V cache,
+// and their quantization scales, with the same beam index in one go.
+
+constexpr int kTensorsPerLaunch = 64;
+constexpr int kBlockSize = 256;
+// Upper bound on blocks along a single row; small rows simply exit early.
+constexpr int kMaxBlocksPerRow = 8;
+
+struct ForeachIndexSelectArgs {
+  const char* src[kTensorsPerLaunch];
+  char* dst[kTensorsPerLaunch];
+  int64_t row_bytes[kTensorsPerLaunch];
+  int64_t src_rows[kTensorsPerLaunch];
+};
+
+template <typename index_t>
+__global__ void foreach_index_select_kernel(
+    ForeachIndexSelectArgs args,
+    const index_t* index) {
+  const int t = blockIdx.z;
+  const int64_t out_row = blockIdx.y;
+  const int64_t src_row = index[out_row];
+  CUDA_KERNEL_ASSERT(src_row >= 0 && src_row < args.src_rows[t]);
+
+  const int64_t row_bytes = args.row_bytes[t];
+  const char* src = args.src[t] + src_row * row_bytes;
+  char* dst = args.dst[t] + out_row * row_bytes;
+  const int64_t grid_stride = static_cast<int64_t>(gridDim.x) * blockDim.x;
+  const int64_t thread_idx =
+      static_cast<int64_t>(blockIdx.x) * blockDim.x + threadIdx.x;
+
+  // Rows of a contiguous tensor start at multiples of row_bytes from an
+  // aligned base, so a row that is a multiple of 16 bytes can be moved in
+  // 16 byte chunks.
+  if (row_bytes % sizeof(uint4) == 0) {
+    const uint4* src_vec = reinterpret_cast<const uint4*>(src);
+    uint4* dst_vec = reinterpret_cast<uint4*>(dst);
+    const int64_t row_units = row_bytes / static_cast<int64_t>(sizeof(uint4));
+    for (int64_t i = thread_idx; i < row_units; i += grid_stride) {
+      dst_vec[i] = src_vec[i];
+    }
+  } else {
+    for (int64_t i = thread_idx; i < row_bytes; i += grid_stride) {
+      dst[i] = src[i];
+    }
+  }
+}
+
+} // namespace
+
+std::vector<Tensor> foreach_tensor_index_select_kernel_cuda(
+    TensorList tensors,
+    const Tensor& index) {
+  check_foreach_api_restrictions(tensors);
+  TORCH_CHECK(index.dim() == 1, "index must be a 1-D tensor");
+  TORCH_CHECK(
+      index.scalar_type() == ScalarType::Long ||
+          index.scalar_type() == ScalarType::Int,
+      "index must be an int or long tensor, got ", index.scalar_type());
+
+  const int64_t num_out_rows = index.size(0);
+  bool can_use_fast_route = index.is_cuda() && index.is_contiguous() &&
+      num_out_rows > 0 && num_out_rows <= 65535;
+  for (const auto& t : tensors) {
+    can_use_fast_route = can_use_fast_route && t.is_cuda() &&
+        t.is_contiguous() && t.dim() >= 1 && t.size(0) > 0 &&
+        t.device() == index.device();
+  }
+  if (!can_use_fast_route) {
+    return foreach_tensor_index_select_kernel_slow(tensors, index);
+  }
+
+  std::vector<Tensor> result;
+  result.reserve(tensors.size());
+  for (const auto& t : tensors) {
+    auto out_sizes = t.sizes().vec();
+    out_sizes[0] = num_out_rows;
+    result.emplace_back(at::empty(out_sizes, t.options()));
+  }
+
+  auto stream = at::cuda::getCurrentCUDAStream();
+  AT_DISPATCH_INDEX_TYPES(
+    index.scalar_type(), "foreach_index_select", [&] {
+      for (size_t start = 0; start < tensors.size();
+           start += kTensorsPerLaunch) {
+        const int chunk = static_cast<int>(
+            std::min<size_t>(kTensorsPerLaunch, tensors.size() - start));
+        ForeachIndexSelectArgs args;
+        int64_t max_row_bytes = 0;
+        for (const auto i : c10::irange(chunk)) {
+          const auto& t = tensors[start + i];
+          const int64_t row_bytes =
+              (t.numel() / t.size(0)) * t.element_size();
+          args.src[i] = static_cast<const char*>(t.const_data_ptr());
+          args.dst[i] = static_cast<char*>(result[start + i].mutable_data_ptr());
+          args.row_bytes[i] = row_bytes;
+          args.src_rows[i] = t.size(0);
+          max_row_bytes = std::max(max_row_bytes, row_bytes);
+        }
+        const int64_t max_units = (max_row_bytes + sizeof(uint4) - 1) /
+            static_cast<int64_t>(sizeof(uint4));
+        const int blocks_per_row = static_cast<int>(std::min<int64_t>(
+            kMaxBlocksPerRow, (max_units + kBlockSize - 1) / kBlockSize));
+        const dim3 grid(
+            std::max(blocks_per_row, 1), num_out_rows, chunk);
+        foreach_index_select_kernel<index_t>
+          <<<grid, kBlockSize, 0, stream>>>(
+            args, index.const_data_ptr<index_t>());
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      }
+    });
+  return result;
+}
+
+} // namespace at::native
@@ -17,6 +17,7 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_foreach_global_norm_native.h>
 #include <ATen/ops/_foreach_max_native.h>
 #include <ATen/ops/_foreach_norm_native.h>
 
@@ -563,4 +564,147 @@ std::vector<Tensor> foreach_tensor_norm_cuda(
 
 #undef AT_DISPATCH_OUT_DTYPES
 
+// Reduces every per-chunk partial produced by LpNormFunctor, across all
+// tensors at once, into a single scalar. This is the tail of the fused
+// global-norm computation used by clip_grad_norm_: one multi_tensor_apply
+// pass over all gradient buffers followed by this one-block kernel.
+template <
+    typename out_t,
+    NormType norm_type,
+    typename out_opmath_t = at::opmath_type<out_t>>
+__global__ void global_norm_cleanup(
+    const out_opmath_t* output_per_tensor,
+    out_t* ret_ptr,
+    int64_t num_partials) {
+  __shared__ out_opmath_t vals[512];
+
+  out_opmath_t val = 0;
+  for (int64_t i = threadIdx.x; i < num_partials; i += blockDim.x) {
+    if constexpr (norm_type == NormType::LInf) {
+      val = max_propagate_nan(val, output_per_tensor[i]);
+    } else {
+      val += output_per_tensor[i];
+    }
+  }
+  out_opmath_t final_val =
+      norm_type == NormType::L1 || norm_type == NormType::L2
+      ? at::native::cuda_utils::BlockReduceSum<out_opmath_t>(val, vals)
+      : at::native::cuda_utils::BlockReduceMax(val, vals);
+  if (threadIdx.x == 0) {
+    *ret_ptr = norm_type == NormType::L2 ? ::sqrt(final_val) : final_val;
+  }
+}
+
+Tensor foreach_tensor_global_norm_cuda(TensorList tensors, const Scalar& ord) {
+  const auto p = [&]() -> double {
+    if (ord.isIntegral(false)) {
+      return ord.to<int64_t>();
+    } else if (ord.isFloatingPoint()) {
+      return ord.to<double>();
+    } else {
+      TORCH_CHECK(
+          false,
+          "foreach_tensor_global_norm_cuda expects ord to be integer or float");
+    }
+  }();
+  check_foreach_api_restrictions(tensors);
+  const bool has_int_or_complex =
+      std::any_of(tensors.begin(), tensors.end(), [](const auto& t) {
+        const auto scalar_type = t.scalar_type();
+        return at::isIntegralType(scalar_type, /*includeBool*/ true) ||
+            at::isComplexType(scalar_type);
+      });
+  if (!can_use_fast_route(tensors) || has_int_or_complex ||
+      !(p == static_cast<double>(1) || p == static_cast<double>(2) ||
+        p == std::numeric_limits<double>::infinity())) {
+    return foreach_tensor_global_norm_slow(tensors, ord);
+  }
+
+  const size_t ntensors = tensors.size();
+  int max_chunks_per_tensor = -1;
+
+  for (const auto t : c10::irange(ntensors)) {
+    int max_chunks_this_tensor =
+        (tensors[t].numel() + kChunkSize - 1) / kChunkSize;
+    if (max_chunks_this_tensor > max_chunks_per_tensor) {
+      max_chunks_per_tensor = max_chunks_this_tensor;
+    }
+  }
+  const auto options = tensors[0].options();
+  const ScalarType output_dtype = tensors[0].scalar_type();
+  const ScalarType output_per_tensor_dtype = toOpMathType(output_dtype);
+  // Zero-initialized so chunk slots of shorter tensors contribute the
+  // identity of both sum and (absolute-value) max.
+  auto output_per_tensor = at::zeros(
+      {static_cast<int64_t>(ntensors) * max_chunks_per_tensor},
+      options.dtype(output_per_tensor_dtype));
+  auto ret = at::native::empty_cuda(
+      {},
+      optTypeMetaToScalarType(options.dtype_opt()),
+      options.layout_opt(),
+      options.device_opt(),
+      options.pinned_memory_opt(),
+      options.memory_format_opt());
+
+  auto tensor_lists = std::vector<std::vector<Tensor>>{tensors.vec()};
+
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf,
+      c10::kBFloat16,
+      tensor_lists[0][0].scalar_type(),
+      "foreach_tensor_global_norm_cuda_scalar_type",
+      [&]() {
+        using out_t = scalar_t;
+        using out_opmath_t = typename at::opmath_type<out_t>;
+        if (p == static_cast<double>(1)) {
+          multi_tensor_apply<1>(
+              tensor_lists,
+              LpNormFunctor<scalar_t, NormType::L1, out_t>(),
+              output_per_tensor.mutable_data_ptr<out_opmath_t>(),
+              max_chunks_per_tensor);
+        } else if (p == static_cast<double>(2)) {
+          multi_tensor_apply<1>(
+              tensor_lists,
+              LpNormFunctor<scalar_t, NormType::L2, out_t>(),
+              output_per_tensor.mutable_data_ptr<out_opmath_t>(),
+              max_chunks_per_tensor);
+        } else if (p == std::numeric_limits<double>::infinity()) {
+          multi_tensor_apply<1>(
+              tensor_lists,
+              LpNormFunctor<scalar_t, NormType::LInf, out_t>(),
+              output_per_tensor.mutable_data_ptr<out_opmath_t>(),
+              max_chunks_per_tensor);
+        }
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+        const at::cuda::OptionalCUDAGuard device_guard(
+            device_of(output_per_tensor));
+        auto stream = at::cuda::getCurrentCUDAStream();
+        const int64_t num_partials =
+            static_cast<int64_t>(ntensors) * max_chunks_per_tensor;
+
+        if (p == static_cast<double>(1)) {
+          global_norm_cleanup<out_t, NormType::L1>
+              <<<1, 512, 0, stream>>>(
+                  output_per_tensor.const_data_ptr<out_opmath_t>(),
+                  ret.mutable_data_ptr<out_t>(),
+                  num_partials);
+        } else if (p == static_cast<double>(2)) {
+          global_norm_cleanup<out_t, NormType::L2>
+              <<<1, 512, 0, stream>>>(
+                  output_per_tensor.const_data_ptr<out_opmath_t>(),
+                  ret.mutable_data_ptr<out_t>(),
+                  num_partials);
+        } else if (p == std::numeric_limits<double>::infinity()) {
+          global_norm_cleanup<out_t, NormType::LInf>
+              <<<1, 512, 0, stream>>>(
+                  output_per_tensor.const_data_ptr<out_opmath_t>(),
+                  ret.mutable_data_ptr<out_t>(),
+                  num_partials);
+        }
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+
+  return ret;
+}
+
 } // namespace at::native
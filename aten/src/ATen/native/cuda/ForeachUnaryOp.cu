@@ -395,13 +395,20 @@ void foreach_tensor_zero_cuda_(TensorList tensors) {
       tensors[0].scalar_type(),
       "foreach_zero_cuda_",
       [&]() {
-        multi_tensor_apply<1>(
-            tensor_lists,
-            ZeroFunctor<
-                scalar_t,
-                /* depth */ 1,
-                /* r_args_depth */ 1,
-                /* res_arg_index */ 0>());
+        // Large lists exceed what one kernel-argument launch can carry;
+        // use the device-memory metadata mode to stay at a single launch.
+        if (tensors.size() > depth_to_max_tensors[0]) {
+          multi_tensor_apply_dynamic<1>(
+              tensor_lists, ZeroChunkFunctor<scalar_t>());
+        } else {
+          multi_tensor_apply<1>(
+              tensor_lists,
+              ZeroFunctor<
+                  scalar_t,
+                  /* depth */ 1,
+                  /* r_args_depth */ 1,
+                  /* res_arg_index */ 0>());
+        }
       });
 }
 
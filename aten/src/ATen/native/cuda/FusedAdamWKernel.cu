@@ -1,5 +1,6 @@
 #define TORCH_ASSERT_ONLY_METHOD_OPERATORS
 #include <ATen/TypeDefault.h>
+#include <ATen/cuda/OffloadScheduler.h>
 #include <ATen/native/ForeachUtils.h>
 #include <c10/util/Exception.h>
 #include <ATen/native/cuda/fused_adamw_amsgrad_impl.cuh>
@@ -7,6 +8,24 @@
 
 namespace at::native {
 
+namespace {
+
+// Optimizer state may be paged out to pinned host memory by the
+// OffloadScheduler; fault it back in before the fused kernel reads it.
+void ensure_state_resident(
+    at::TensorList exp_avgs,
+    at::TensorList exp_avg_sqs,
+    at::TensorList max_exp_avg_sqs) {
+  auto& scheduler = at::cuda::OffloadScheduler::instance();
+  if (C10_UNLIKELY(scheduler.has_registrations())) {
+    scheduler.ensure_resident(exp_avgs);
+    scheduler.ensure_resident(exp_avg_sqs);
+    scheduler.ensure_resident(max_exp_avg_sqs);
+  }
+}
+
+} // namespace
+
 // note(crcrpar): To observe the CI rules, i.e. 20 minutes per file to compile,
 // defensively split instantiations into _impl files. this is only for CUDA 11.3
 // for which it took about 20 minutes and 28 minutes in my workstation and CI,
@@ -29,6 +48,7 @@ void _fused_adamw_kernel_cuda_(
     const bool maximize,
     const std::optional<at::Tensor>& grad_scale,
     const std::optional<at::Tensor>& found_inf) {
+  ensure_state_resident(exp_avgs, exp_avg_sqs, max_exp_avg_sqs);
   if (amsgrad) {
     TORCH_CHECK(
         at::native::check_fast_path_restrictions(
@@ -125,6 +145,7 @@ void _fused_adamw_kernel_cuda_(
       lr.device() == param_device,
       "lr must be on the same GPU device as the params");
 
+  ensure_state_resident(exp_avgs, exp_avg_sqs, max_exp_avg_sqs);
   if (amsgrad) {
     TORCH_CHECK(
         at::native::check_fast_path_restrictions(
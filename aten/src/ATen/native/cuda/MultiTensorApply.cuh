@@ -1,9 +1,14 @@
 #pragma once
 #include <ATen/core/Tensor.h>
 #include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/CachingHostAllocator.h>
+#include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAGuard.h>
 #include <ATen/native/cuda/Loops.cuh>
 #include <ATen/native/cuda/MemoryAccess.cuh>
+#include <algorithm>
+#include <array>
+#include <cstring>
 #include <vector>
 
 namespace at::native {
@@ -95,6 +100,21 @@ struct FusedOptimizerTensorListMetadata {
   int start_tensor_this_launch;
 };
 
+// Metadata for the device-memory ("dynamic") mode of multi_tensor_apply.
+// Unlike the structs above, which embed the pointer and chunk tables in the
+// 4KB kernel argument and therefore cap how many tensors a single launch can
+// cover, this struct only carries device pointers to tables that live in a
+// device buffer. The tables are indexed by a global chunk index, so one
+// launch handles a tensor list of any length.
+template <int n>
+struct DeviceTensorListMetadata {
+  const void* const* addresses[n];
+  const int64_t* numel_for_tensor;
+  const int* chunk_to_tensor;
+  const int* chunk_to_chunk_idx;
+  int64_t total_chunks;
+};
+
 template <typename T, typename U, typename... ArgTypes>
 C10_LAUNCH_BOUNDS_1(kBlockSize)
 __global__ void multi_tensor_apply_kernel(
@@ -106,6 +126,21 @@ __global__ void multi_tensor_apply_kernel(
   callable(kChunkSize, tensorListMeta, args...);
 }
 
+template <typename T, typename U, typename... ArgTypes>
+C10_LAUNCH_BOUNDS_1(kBlockSize)
+__global__ void multi_tensor_apply_dynamic_kernel(
+    T tensorListMeta,
+    U callable,
+    ArgTypes... args) {
+  // Grid-stride over the global chunk index. blockIdx.x no longer identifies
+  // the chunk, so the callable receives the chunk index explicitly.
+  for (int64_t chunk = blockIdx.x; chunk < tensorListMeta.total_chunks;
+       chunk += gridDim.x) {
+    callable(kChunkSize, chunk, tensorListMeta, args...);
+    __syncthreads();
+  }
+}
+
 } // namespace
 
 // multi_tensor_apply enables horizontal fusion across lists of tensors.
@@ -376,4 +411,110 @@ void multi_tensor_apply_for_fused_optimizer(
   }
 }
 
+// multi_tensor_apply_dynamic is an alternative to multi_tensor_apply above
+// that keeps the metadata in device memory instead of the kernel argument,
+// so one launch covers a tensor list of any length. The pointer and chunk
+// tables are built in a single pinned staging buffer, copied to the device
+// asynchronously on the current stream, and the kernel grid-strides over a
+// global chunk index. Because blockIdx.x no longer identifies the chunk,
+// the callable has a different contract than in the static mode; it is
+// invoked once per chunk as
+//   callable(chunk_size, global_chunk, metadata, args...)
+// and must map global_chunk to (tensor, chunk) through the metadata tables.
+template <int depth, typename T, typename... ArgTypes>
+void multi_tensor_apply_dynamic(
+    std::vector<std::vector<at::Tensor>>& tensor_lists,
+    T callable,
+    ArgTypes... args) {
+  TORCH_CHECK(
+      tensor_lists.size() == depth,
+      "Number of tensor lists has to match the depth.");
+  const size_t n_tensors = tensor_lists[0].size();
+
+  std::array<std::vector<const void*>, depth> addresses;
+  std::vector<int64_t> numels;
+  std::vector<int> chunk_to_tensor;
+  std::vector<int> chunk_to_chunk_idx;
+  numels.reserve(n_tensors);
+  for (size_t t = 0; t < n_tensors; t++) {
+    const auto numel = tensor_lists[0][t].numel();
+    // short-circuit to avoid adding empty tensors to the tables
+    if (numel == 0) {
+      continue;
+    }
+    const auto tensor_loc = static_cast<int>(numels.size());
+    numels.push_back(numel);
+    for (int d = 0; d < depth; d++) {
+      addresses[d].push_back(tensor_lists[d][t].const_data_ptr());
+    }
+    const auto chunks = numel / kChunkSize + (numel % kChunkSize != 0);
+    for (int64_t chunk = 0; chunk < chunks; chunk++) {
+      chunk_to_tensor.push_back(tensor_loc);
+      chunk_to_chunk_idx.push_back(static_cast<int>(chunk));
+    }
+  }
+  const auto total_chunks = static_cast<int64_t>(chunk_to_tensor.size());
+  if (total_chunks == 0) {
+    return;
+  }
+
+  // One staging buffer holds all the tables: the 8 byte entries come first
+  // so every segment stays naturally aligned.
+  const size_t address_bytes = sizeof(const void*) * numels.size();
+  const size_t numel_bytes = sizeof(int64_t) * numels.size();
+  const size_t table_bytes = sizeof(int) * total_chunks;
+  const size_t total_bytes =
+      depth * address_bytes + numel_bytes + 2 * table_bytes;
+
+  auto host_buf = at::cuda::HostAlloc(total_bytes);
+  char* host_ptr = static_cast<char*>(host_buf.get());
+  size_t offset = 0;
+  for (int d = 0; d < depth; d++) {
+    std::memcpy(host_ptr + offset, addresses[d].data(), address_bytes);
+    offset += address_bytes;
+  }
+  std::memcpy(host_ptr + offset, numels.data(), numel_bytes);
+  offset += numel_bytes;
+  std::memcpy(host_ptr + offset, chunk_to_tensor.data(), table_bytes);
+  offset += table_bytes;
+  std::memcpy(host_ptr + offset, chunk_to_chunk_idx.data(), table_bytes);
+
+  auto stream = at::cuda::getCurrentCUDAStream();
+  auto device_buf = c10::cuda::CUDACachingAllocator::get()->allocate(total_bytes);
+  char* device_ptr = static_cast<char*>(device_buf.get());
+  C10_CUDA_CHECK(cudaMemcpyAsync(
+      device_ptr, host_ptr, total_bytes, cudaMemcpyHostToDevice, stream));
+  // Keep the staging buffer out of the pinned allocator's free pool until
+  // the copy has completed.
+  at::cuda::CachingHostAllocator_recordEvent(
+      host_buf.get(), host_buf.get_context(), stream);
+
+  DeviceTensorListMetadata<depth> tensorListMeta;
+  offset = 0;
+  for (int d = 0; d < depth; d++) {
+    tensorListMeta.addresses[d] =
+        reinterpret_cast<const void* const*>(device_ptr + offset);
+    offset += address_bytes;
+  }
+  tensorListMeta.numel_for_tensor =
+      reinterpret_cast<const int64_t*>(device_ptr + offset);
+  offset += numel_bytes;
+  tensorListMeta.chunk_to_tensor =
+      reinterpret_cast<const int*>(device_ptr + offset);
+  offset += table_bytes;
+  tensorListMeta.chunk_to_chunk_idx =
+      reinterpret_cast<const int*>(device_ptr + offset);
+  tensorListMeta.total_chunks = total_chunks;
+
+  // Enough blocks to saturate the device; the grid-stride loop covers the
+  // rest. device_buf is freed on the launching stream by the caching
+  // allocator, so its reuse is ordered after the kernel.
+  const auto* prop = at::cuda::getCurrentDeviceProperties();
+  const auto grid = static_cast<int>(std::min<int64_t>(
+      total_chunks, static_cast<int64_t>(prop->multiProcessorCount) * 8));
+  multi_tensor_apply_dynamic_kernel<<<grid, kBlockSize, 0, stream>>>(
+      tensorListMeta, callable, args...);
+  C10_CUDA_KERNEL_LAUNCH_CHECK();
+}
+
 } // namespace at::native
@@ -297,6 +297,190 @@ __global__ void softmax_warp_backward(output_t *gradInput, const input_t *grad,
     }
 }
 
+// softmax_warp_forward variant that fuses the attention score epilogue into the
+// load: dst = softmax(src * scale + bias [+ addend][, masked along the fast dimension]).
+// bias may only broadcast over leading dimensions (e.g. one relative position
+// bias per head, shared across the batch): it holds bias_batch_count samples and
+// sample b of the input reads bias sample b % bias_batch_count. addend is an
+// additive floating point mask and mask a boolean mask, both with the same shape
+// as the input. Any of bias, addend and mask may be null.
+template <typename input_t, typename output_t, typename acc_t, int log2_elements>
+__global__ void scaled_bias_softmax_warp_forward(output_t *dst, const input_t *src, const input_t *bias, const input_t *addend, const bool *mask, acc_t scale, int batch_size, int stride, int element_count, int bias_batch_count)
+{
+    // WARP_SIZE and WARP_BATCH must match the return values batches_per_warp and warp_size of method warp_softmax_forward_kernel.
+    constexpr int next_power_of_two = 1 << log2_elements;
+    constexpr int WARP_SIZE = (next_power_of_two < C10_WARP_SIZE) ? next_power_of_two : C10_WARP_SIZE;
+    constexpr int WARP_ITERATIONS = next_power_of_two / WARP_SIZE;
+    constexpr int WARP_BATCH = (next_power_of_two <= 128) ? 2 : 1;
+
+    int first_batch = (blockDim.y * blockIdx.x + threadIdx.y) * WARP_BATCH;
+
+    // batch_size might not be a multiple of WARP_BATCH. Check how
+    // many batches have to computed within this WARP.
+    int local_batches = batch_size - first_batch;
+    if (local_batches > WARP_BATCH)
+        local_batches = WARP_BATCH;
+
+    // there might be multiple batches per warp. compute the index within the batch
+    int local_idx = threadIdx.x;
+    int idx_offset = first_batch * stride + local_idx;
+
+    src += idx_offset;
+    dst += idx_offset;
+    if (addend != nullptr) {
+        addend += idx_offset;
+    }
+    if (mask != nullptr) {
+        mask += idx_offset;
+    }
+
+    // load data from global memory, applying the fused epilogue on the way in.
+    // Masked values are treated as -infinity: they contribute exp(-inf) == 0
+    // to the sum and produce a zero output, exactly like softmax_warp_forward.
+    acc_t elements[WARP_BATCH][WARP_ITERATIONS];
+    for (int i = 0;  i < WARP_BATCH;  ++i) {
+        int batch_element_count = (i >= local_batches) ? 0 : element_count;
+        int bias_offset = ((first_batch + i) % bias_batch_count) * stride + local_idx;
+        for (int it = 0;  it < WARP_ITERATIONS;  ++it) {
+            int element_index = local_idx + it * WARP_SIZE;
+            if (element_index < batch_element_count) {
+                int idx = i*element_count+it*WARP_SIZE;
+                if (mask != nullptr && mask[idx]) {
+                    elements[i][it] = -std::numeric_limits<acc_t>::infinity();
+                } else {
+                    acc_t value = scale * static_cast<acc_t>(src[idx]);
+                    if (bias != nullptr) {
+                        value += static_cast<acc_t>(bias[bias_offset + it*WARP_SIZE]);
+                    }
+                    if (addend != nullptr) {
+                        value += static_cast<acc_t>(addend[idx]);
+                    }
+                    elements[i][it] = value;
+                }
+            } else {
+                elements[i][it] = -std::numeric_limits<acc_t>::infinity();
+            }
+        }
+    }
+
+    // compute max_value
+    acc_t max_value[WARP_BATCH];
+    #pragma unroll
+    for (int i = 0;  i < WARP_BATCH;  ++i) {
+        max_value[i] = elements[i][0];
+        #pragma unroll
+        for (int it = 1;  it < WARP_ITERATIONS;  ++it) {
+            max_value[i] = max_value[i] > elements[i][it] ? max_value[i] : elements[i][it];
+        }
+    }
+    warp_reduce<acc_t, WARP_BATCH, WARP_SIZE, Max>(max_value);
+
+    acc_t sum[WARP_BATCH] { 0.0f };
+    #pragma unroll
+    for (int i = 0;  i < WARP_BATCH;  ++i) {
+        #pragma unroll
+        for (int it = 0;  it < WARP_ITERATIONS;  ++it) {
+            elements[i][it] = std::exp(elements[i][it] - max_value[i]);
+            sum[i] += elements[i][it];
+        }
+    }
+    warp_reduce<acc_t, WARP_BATCH, WARP_SIZE, Add>(sum);
+
+    // store result
+    #pragma unroll
+    for (int i = 0;  i < WARP_BATCH;  ++i) {
+        if (i >= local_batches)
+            break;
+        #pragma unroll
+        for (int it = 0;  it < WARP_ITERATIONS;  ++it) {
+            int element_index = local_idx + it * WARP_SIZE;
+            if (element_index < element_count) {
+                if (sum[i] == 0) {
+                    dst[i*element_count+it*WARP_SIZE] = std::numeric_limits<acc_t>::quiet_NaN();
+                } else {
+                    dst[i*element_count+it*WARP_SIZE] = elements[i][it] / sum[i];
+                }
+            } else {
+                break;
+            }
+        }
+    }
+}
+
+// softmax_warp_backward variant matching scaled_bias_softmax_warp_forward:
+// the scale applied to the input in the forward multiplies the gradient here.
+// The bias and additive mask shift the input only, so they do not change the
+// Jacobian, and boolean-masked positions have zero output, hence zero gradient,
+// without consulting the mask. Like softmax_warp_backward, grad is expected to
+// hold grad_output * output precomputed by the caller.
+template <typename input_t, typename output_t, typename acc_t, int log2_elements>
+__global__ void scaled_softmax_warp_backward(output_t *gradInput, const input_t *grad, const input_t *output, acc_t scale, int batch_size, int stride, int element_count)
+{
+    // WARP_SIZE and WARP_BATCH must match the return values batches_per_warp and warp_size of method warp_softmax_backward_kernel.
+    constexpr int next_power_of_two = 1 << log2_elements;
+    constexpr int WARP_SIZE = (next_power_of_two < C10_WARP_SIZE) ? next_power_of_two : C10_WARP_SIZE;
+    constexpr int WARP_ITERATIONS = next_power_of_two / WARP_SIZE;
+    constexpr int WARP_BATCH = (next_power_of_two <= 128) ? 2 : 1;
+
+    int first_batch = (blockDim.y * blockIdx.x + threadIdx.y) * WARP_BATCH;
+
+    // batch_size might not be a multiple of WARP_BATCH. Check how
+    // many batches have to computed within this WARP.
+    int local_batches = batch_size - first_batch;
+    if (local_batches > WARP_BATCH)
+        local_batches = WARP_BATCH;
+
+    // there might be multiple batches per warp. compute the index within the batch
+    int local_idx = threadIdx.x % WARP_SIZE;
+
+    // the first element to process by the current thread
+    int thread_offset = first_batch * stride + local_idx;
+    grad += thread_offset;
+    output += thread_offset;
+    gradInput += thread_offset;
+
+    // load data from global memory
+    acc_t grad_reg[WARP_BATCH][WARP_ITERATIONS];
+    acc_t output_reg[WARP_BATCH][WARP_ITERATIONS];
+    for (int i = 0;  i < WARP_BATCH;  ++i) {
+        int batch_element_count = (i >= local_batches) ? 0 : element_count;
+        for (int it = 0;  it < WARP_ITERATIONS;  ++it) {
+            int element_index = local_idx + it * WARP_SIZE;
+            if (element_index < batch_element_count) {
+                grad_reg[i][it] = grad[i*element_count+it*WARP_SIZE];
+                output_reg[i][it] = output[i*element_count+it*WARP_SIZE];
+            } else {
+                grad_reg[i][it] = acc_t(0);
+                output_reg[i][it] = acc_t(0);
+            }
+        }
+    }
+
+    acc_t sum[WARP_BATCH] { 0.0f };
+    #pragma unroll
+    for (int i = 0;  i < WARP_BATCH;  ++i) {
+        #pragma unroll
+        for (int it = 0;  it < WARP_ITERATIONS;  ++it) {
+            sum[i] += grad_reg[i][it];
+        }
+    }
+    warp_reduce<acc_t, WARP_BATCH, WARP_SIZE, Add>(sum);
+
+    // store result
+    #pragma unroll
+    for (int i = 0;  i < WARP_BATCH;  ++i) {
+        if (i >= local_batches)
+            break;
+        #pragma unroll
+        for (int it = 0;  it < WARP_ITERATIONS;  ++it) {
+            int element_index = local_idx + it * WARP_SIZE;
+            if (element_index < element_count) {
+                gradInput[i*element_count+it*WARP_SIZE] = scale * (grad_reg[i][it] - output_reg[i][it] * sum[i]);
+            }
+        }
+    }
+}
+
 } // end of anonymous namespace
 
 template<typename input_t, typename output_t, typename acc_t, bool is_log_softmax, bool is_masked>
@@ -399,3 +583,105 @@ void dispatch_softmax_backward(output_t *grad_input, const input_t *grad, const
         }
     }
 }
+
+template<typename input_t, typename output_t, typename acc_t>
+void dispatch_scaled_bias_softmax_forward(output_t *dst, const input_t *src, const input_t *bias, const input_t *addend, const bool *mask, acc_t scale, int softmax_elements, int softmax_elements_stride, int batch_count, int bias_batch_count)
+{
+    TORCH_INTERNAL_ASSERT( softmax_elements >= 0 && softmax_elements <= 1024 );
+    if (softmax_elements == 0) {
+        return;
+    } else {
+        int log2_elements = log2_ceil(softmax_elements);
+        const int next_power_of_two = 1 << log2_elements;
+
+        // This value must match the WARP_SIZE constexpr value computed inside scaled_bias_softmax_warp_forward.
+        int warp_size = at::cuda::warp_size();
+        warp_size = (next_power_of_two < warp_size) ? next_power_of_two : warp_size;
+
+        // This value must match the WARP_BATCH constexpr value computed inside scaled_bias_softmax_warp_forward.
+        int batches_per_warp = (next_power_of_two <= 128) ? 2 : 1;
+
+        // use 128 threads per block to maximize gpu utilization
+        constexpr int threads_per_block = 128;
+
+        int warps_per_block = (threads_per_block / warp_size);
+        int batches_per_block = warps_per_block * batches_per_warp;
+        int blocks = (batch_count + batches_per_block - 1) / batches_per_block;
+        dim3 threads(warp_size, warps_per_block, 1);
+        // Launch code would be more elegant if C++ supported FOR CONSTEXPR
+        switch (log2_elements) {
+            #define LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(L2E) case L2E:        \
+            scaled_bias_softmax_warp_forward<input_t, output_t, acc_t, L2E>       \
+                <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>(dst,   \
+                    src, bias, addend, mask, scale, batch_count,                  \
+                    softmax_elements_stride, softmax_elements, bias_batch_count); \
+            C10_CUDA_KERNEL_LAUNCH_CHECK();                                       \
+            break;
+
+            LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(0);  // 1
+            LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(1);  // 2
+            LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(2);  // 4
+            LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(3);  // 8
+            LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(4);  // 16
+            LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(5);  // 32
+            LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(6);  // 64
+            LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(7);  // 128
+            LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(8);  // 256
+            LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(9);  // 512
+            LAUNCH_SCALED_BIAS_SOFTMAX_WARP_FORWARD(10); // 1024
+            default:
+                break;
+        }
+    }
+}
+
+template<typename input_t, typename output_t, typename acc_t>
+void dispatch_scaled_softmax_backward(output_t *grad_input, const input_t *grad, const input_t *output, acc_t scale, int softmax_elements, int softmax_elements_stride, int batch_count)
+{
+    TORCH_INTERNAL_ASSERT( softmax_elements >= 0 && softmax_elements <= 1024 );
+    if (softmax_elements == 0) {
+       return;
+    } else {
+        int log2_elements = log2_ceil(softmax_elements);
+        const int next_power_of_two = 1 << log2_elements;
+
+        // This value must match the WARP_SIZE constexpr value computed inside scaled_softmax_warp_backward.
+        int warp_size = at::cuda::warp_size();
+        warp_size = (next_power_of_two < warp_size) ? next_power_of_two : warp_size;
+
+        // This value must match the WARP_BATCH constexpr value computed inside scaled_softmax_warp_backward.
+        int batches_per_warp = (next_power_of_two <= 128) ? 2 : 1;
+
+        // use 128 threads per block to maximize gpu utilization
+        constexpr int threads_per_block = 128;
+
+        int warps_per_block = (threads_per_block / warp_size);
+        int batches_per_block = warps_per_block * batches_per_warp;
+        int blocks = (batch_count + batches_per_block - 1) / batches_per_block;
+        dim3 threads(warp_size, warps_per_block, 1);
+        // Launch code would be more elegant if C++ supported FOR CONSTEXPR
+        switch (log2_elements) {
+            #define LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(L2E) case L2E:            \
+            scaled_softmax_warp_backward<input_t, output_t, acc_t, L2E>           \
+                <<<blocks, threads, 0, at::cuda::getCurrentCUDAStream()>>>        \
+                (grad_input, grad, output, scale, batch_count,                    \
+                softmax_elements_stride, softmax_elements);                       \
+            C10_CUDA_KERNEL_LAUNCH_CHECK();                                       \
+            break;
+
+            LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(0); // 1
+            LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(1); // 2
+            LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(2); // 4
+            LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(3); // 8
+            LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(4); // 16
+            LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(5); // 32
+            LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(6); // 64
+            LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(7); // 128
+            LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(8); // 256
+            LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(9); // 512
+            LAUNCH_SCALED_SOFTMAX_WARP_BACKWARD(10); // 1024
+            default:
+                break;
+        }
+    }
+}
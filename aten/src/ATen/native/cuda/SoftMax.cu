@@ -9,6 +9,7 @@
 
 #include <ATen/AccumulateType.h>
 #include <ATen/cuda/NumericLimits.cuh>
+#include <cstdlib>
 #include <type_traits>
 
 #include <ATen/native/cuda/Loops.cuh>
@@ -22,6 +23,8 @@
 #include <ATen/NativeFunctions.h>
 #else
 #include <ATen/ops/_masked_softmax_native.h>
+#include <ATen/ops/_scaled_bias_masked_softmax_native.h>
+#include <ATen/ops/_scaled_bias_masked_softmax_backward_native.h>
 #include <ATen/ops/_log_softmax_native.h>
 #include <ATen/ops/_log_softmax_backward_data_native.h>
 #include <ATen/ops/_softmax_native.h>
@@ -766,6 +769,71 @@ cunn_SoftMaxForwardSmem(outscalar_t *output, const scalar_t *input, index_t clas
   }
 }
 
+// Persistent-kernel variant of cunn_SoftMaxForward: the grid is fixed by
+// occupancy rather than derived from outer_size, and each block loops over
+// rows. With inputs padded to a row cap this makes the launch configuration
+// shape-invariant, so a single CUDA graph capture serves every sequence
+// length up to the cap instead of one graph per grid size. Enabled with
+// PYTORCH_CUDA_SOFTMAX_PERSISTENT=1 (see softmax_forward_persistent()).
+template <int ILP, typename scalar_t, typename accscalar_t, typename outscalar_t, template <typename, typename, typename> class Epilogue>
+__global__ void
+cunn_SoftMaxForwardPersistent(outscalar_t *output, const scalar_t *input, int classes, int64_t outer_size)
+{
+  extern __shared__ unsigned char smem[];
+  auto sdata = reinterpret_cast<accscalar_t*>(smem);
+
+  for (int64_t row = blockIdx.x; row < outer_size; row += gridDim.x) {
+    const scalar_t* row_input = input + row * classes;
+    outscalar_t* row_output = output + row * classes;
+
+    const int shift = ((uint64_t)row_input) % ALIGN_BYTES / sizeof(scalar_t);
+    const int output_shift = ((uint64_t)row_output) % ALIGN_BYTES / sizeof(outscalar_t);
+
+    accscalar_t threadMax = ilpReduce<MaxFloat, ILP, scalar_t, accscalar_t>(
+      shift, row_input, classes, MaxFloat<scalar_t, accscalar_t>(), -at::numeric_limits<accscalar_t>::max());
+    accscalar_t max_k = blockReduceWarp<Max, accscalar_t>(sdata, threadMax,
+      Max<accscalar_t>(), -at::numeric_limits<accscalar_t>::max());
+
+    accscalar_t threadExp = ilpReduce<SumExpFloat, ILP, scalar_t, accscalar_t>(
+      shift, row_input, classes, SumExpFloat<scalar_t, accscalar_t>(max_k), static_cast<accscalar_t>(0));
+    accscalar_t sumAll = blockReduceWarp<Add, accscalar_t>(sdata, threadExp,
+      Add<accscalar_t>(), static_cast<accscalar_t>(0));
+
+    Epilogue<scalar_t, accscalar_t, outscalar_t> epilogue(max_k, sumAll);
+
+    if (shift == output_shift) {
+      WriteFpropResultsVectorized<ILP, scalar_t, accscalar_t, outscalar_t, Epilogue>(classes, shift, row_input, row_output, epilogue);
+    } else {
+      WriteFpropResults<ILP, scalar_t, accscalar_t, outscalar_t, Epilogue>(classes, row_input, row_output, epilogue);
+    }
+
+    // Make sure the reduction smem is drained before the next row reuses it.
+    __syncthreads();
+  }
+}
+
+// Opt-in for the persistent softmax forward; resolved once per process.
+inline bool softmax_forward_persistent() {
+  static const bool enabled = [] {
+    const auto* env = std::getenv("PYTORCH_CUDA_SOFTMAX_PERSISTENT");
+    return env != nullptr && env[0] == '1';
+  }();
+  return enabled;
+}
+
+// Fixed, shape-independent grid for the persistent kernel: enough blocks to
+// fill the device at the kernel's occupancy, mirroring how
+// SpatialSoftMax_getLaunchSizes sizes its grid.
+template<typename KernelT>
+inline dim3 SoftMaxForwardPersistent_getGridSize(
+    KernelT k, dim3 block, uint32_t smem_size) {
+  int max_active_blocks = 1;
+  cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+      &max_active_blocks, k, block.x, smem_size);
+  max_active_blocks *= at::cuda::getCurrentDeviceProperties()->multiProcessorCount;
+  return dim3(std::max(max_active_blocks, 1));
+}
+
 C10_DEVICE bool inline is_32bit_representable(const int64_t value) {
   return value < static_cast<int64_t>(std::numeric_limits<int32_t>::max());
 }
@@ -868,7 +936,11 @@ Tensor host_softmax(const Tensor & input_, const int64_t dim_, const bool half_t
             can_use_smem &= (!(reinterpret_cast<uintptr_t>(output_ptr) % ALIGN_BYTES));
             can_use_smem &= !(dim_size % ILP);
 
-            if (can_use_smem) {
+            if (softmax_forward_persistent()) {
+              auto kernel = cunn_SoftMaxForwardPersistent<ILP, scalar_t, accscalar_t, scalar_t, Epilogue>;
+              dim3 persistent_grid = SoftMaxForwardPersistent_getGridSize(kernel, block, smem_reduction_sz);
+              kernel<<<persistent_grid, block, smem_reduction_sz, stream>>>(output_ptr, input_ptr, dim_size, outer_size);
+            } else if (can_use_smem) {
               size_t smem_sz = dim_size * sizeof(scalar_t) + smem_reduction_sz;
               cunn_SoftMaxForwardSmem<ILP, scalar_t, accscalar_t, scalar_t, Epilogue>
                 <<<grid, block, smem_sz, stream>>>(output_ptr, input_ptr, dim_size);
@@ -904,7 +976,11 @@ Tensor host_softmax(const Tensor & input_, const int64_t dim_, const bool half_t
             can_use_smem &= (!(reinterpret_cast<uintptr_t>(output_ptr) % ALIGN_BYTES));
             can_use_smem &= !(dim_size % ILP);
 
-            if (can_use_smem) {
+            if (softmax_forward_persistent()) {
+              auto kernel = cunn_SoftMaxForwardPersistent<ILP, scalar_t, accscalar_t, accscalar_t, Epilogue>;
+              dim3 persistent_grid = SoftMaxForwardPersistent_getGridSize(kernel, block, smem_reduction_sz);
+              kernel<<<persistent_grid, block, smem_reduction_sz, stream>>>(output_ptr, input_ptr, dim_size, outer_size);
+            } else if (can_use_smem) {
               size_t smem_sz = dim_size * sizeof(scalar_t) + smem_reduction_sz;
               cunn_SoftMaxForwardSmem<ILP, scalar_t, accscalar_t, accscalar_t, Epilogue>
                 <<<grid, block, smem_sz, stream>>>(output_ptr, input_ptr, dim_size);
@@ -1270,4 +1346,154 @@ Tensor masked_softmax_backward_cuda(
   return grad_input;
 }
 
+Tensor scaled_bias_masked_softmax_cuda(
+    const Tensor& input_,
+    const Tensor& bias_,
+    const std::optional<Tensor>& mask_,
+    double scale,
+    const std::optional<int64_t> dim_) {
+  auto input = input_.dim() == 0 ? input_.view(1) : input_;
+  int64_t dim = dim_.has_value() ? maybe_wrap_dim(dim_.value(), input.dim()) : input.dim() - 1;
+
+  // The bias may only broadcast over leading dimensions (e.g. one relative
+  // position bias per head, shared across the batch): after stripping leading
+  // singleton dimensions its shape must match the trailing shape of the input.
+  TORCH_CHECK(bias_.scalar_type() == input.scalar_type(),
+      "Bias dtype should match input. bias: ", bias_.scalar_type(), " input: ", input.scalar_type());
+  auto bias = bias_;
+  while (bias.dim() > 1 && bias.size(0) == 1) {
+    bias = bias.squeeze(0);
+  }
+  TORCH_CHECK(bias.dim() <= input.dim() &&
+          input.sizes().slice(input.dim() - bias.dim()) == bias.sizes(),
+      "Bias may only broadcast over leading dimensions of the input. bias: ", bias_.sizes(), " input: ", input.sizes());
+
+  bool has_bool_mask = false;
+  Tensor mask;
+  if (mask_.has_value() && mask_->defined()) {
+    mask = mask_->dim() == 0 ? mask_->view(1) : *mask_;
+    if (mask.scalar_type() == ScalarType::Bool) {
+      has_bool_mask = true;
+      TORCH_CHECK(mask.sizes() == input.sizes(),
+          "Boolean mask shape should match input. mask: ", mask.sizes(), " input: ", input.sizes());
+    } else {
+      // A floating point mask is added to the scores, like the bias.
+      TORCH_CHECK(mask.scalar_type() == input.scalar_type(),
+          "Mask should be a boolean tensor or have the input dtype, but got ", mask.scalar_type());
+      TORCH_CHECK(mask.sizes() == input.sizes(),
+          "Additive mask shape should match input. mask: ", mask.sizes(), " input: ", input.sizes());
+    }
+  }
+
+  if (input.numel() == 0) {
+    return at::empty_like(input, input.options());
+  }
+
+  int softmax_elements = input.size(dim);
+  // The persistent kernel has the same applicability conditions as the masked
+  // softmax above, plus contiguity of the operands it reads directly.
+  bool can_use_persistent = softmax_elements <= 1024 &&
+      softmax_elements * input.element_size() <= 4096 &&
+      dim == input.dim() - 1 &&
+      input.is_contiguous() &&
+      bias.is_contiguous() &&
+      (!mask.defined() || mask.is_contiguous());
+
+  if (!can_use_persistent) {
+    auto scores = input * scale + bias_;
+    if (mask.defined()) {
+      if (has_bool_mask) {
+        AT_DISPATCH_FLOATING_TYPES_AND2(
+          ScalarType::Half,
+          ScalarType::BFloat16,
+          input.scalar_type(),
+          "scaled_bias_masked_softmax",
+          [&] {
+            scores = scores.masked_fill(mask, -std::numeric_limits<scalar_t>::infinity());
+          });
+      } else {
+        scores = scores + mask;
+      }
+    }
+    return at::softmax(scores, dim);
+  }
+
+  Tensor output = at::empty_like(input, input.options());
+  int batch_count = input.numel() / softmax_elements;
+  int bias_batch_count = bias.numel() / softmax_elements;
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+    ScalarType::Half,
+    ScalarType::BFloat16,
+    input.scalar_type(),
+    "scaled_bias_masked_softmax",
+    [&] {
+      using accscalar_t = acc_type<scalar_t, true>;
+      dispatch_scaled_bias_softmax_forward<scalar_t, scalar_t, accscalar_t>(
+        output.mutable_data_ptr<scalar_t>(),    // dst
+        input.const_data_ptr<scalar_t>(),       // src
+        bias.const_data_ptr<scalar_t>(),
+        !mask.defined() || has_bool_mask ? nullptr : mask.const_data_ptr<scalar_t>(),
+        has_bool_mask ? mask.const_data_ptr<bool>() : nullptr,
+        static_cast<accscalar_t>(scale),
+        softmax_elements,
+        softmax_elements,
+        batch_count,
+        bias_batch_count
+      );
+    });
+  return output;
+}
+
+Tensor scaled_bias_masked_softmax_backward_cuda(
+    const Tensor& grad_,
+    const Tensor& output_,
+    double scale,
+    const std::optional<int64_t> dim_) {
+  Tensor grad_input = at::empty_like(grad_, grad_.options());
+  if (grad_.numel() == 0) {
+    return grad_input;
+  }
+
+  auto grad = grad_.contiguous();
+  auto output = output_.contiguous();
+  int64_t dim = dim_.has_value() ? maybe_wrap_dim(dim_.value(), output.dim()) : output.dim() - 1;
+
+  grad = grad.dim() == 0 ? grad.view(1) : grad;
+  output = output.dim() == 0 ? output.view(1) : output;
+
+  TORCH_CHECK(grad.sizes() == output.sizes(), "Output shape should match grad shape");
+
+  // The bias and any additive mask only shift the input, so they do not show
+  // up in the Jacobian, and boolean-masked positions have zero output, hence
+  // zero gradient, without consulting the mask. Only the scale survives, as a
+  // factor on the regular softmax gradient.
+  int softmax_elements = output.size(dim);
+  int64_t batch_count = grad.numel() / softmax_elements;
+
+  if (softmax_elements > 1024 || softmax_elements * grad.element_size() > 4096 || dim < grad.dim()-1) {
+    grad_input = at::_softmax_backward_data(grad, output, dim, grad.scalar_type());
+    grad_input.mul_(scale);
+  } else {
+    grad = grad * output;
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+      ScalarType::Half,
+      ScalarType::BFloat16,
+      grad_input.scalar_type(),
+      "scaled_bias_masked_softmax_backward",
+      [&] {
+        using accscalar_t = acc_type<scalar_t, true>;
+        dispatch_scaled_softmax_backward<scalar_t, scalar_t, accscalar_t>(
+          grad_input.mutable_data_ptr<scalar_t>(),  // gI_ptr
+          grad.const_data_ptr<scalar_t>(),  // grad_ptr
+          output.const_data_ptr<scalar_t>(),  // output_ptr
+          static_cast<accscalar_t>(scale),
+          softmax_elements,  // softmax_elements
+          softmax_elements,   // softmax_elements_stride
+          batch_count  // batch_count
+        );
+      });
+  }
+  return grad_input;
+}
+
 } // namespace at::native
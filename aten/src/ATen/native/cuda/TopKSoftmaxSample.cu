@@ -0,0 +1,201 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/AccumulateType.h>
+#include <ATen/Dispatch.h>
+#include <ATen/Utils.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/cuda/EmptyTensor.h>
+#include <ATen/cuda/CUDAGraphsUtils.cuh>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/CUDAFunctions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_topk_softmax_sample_native.h>
+#include <ATen/ops/topk.h>
+#endif
+
+#include <curand.h>
+#include <curand_kernel.h>
+#include <curand_philox4x32_x.h>
+
+namespace at::native {
+
+namespace {
+
+// One block per row. The candidates are the row's top-k logits in
+// descending order, so the max is the first entry and the nucleus
+// (top-p) cut is a prefix of the candidate list. Sampling uses the
+// Gumbel-max trick over the kept candidates, which is equivalent to
+// sampling from the renormalized softmax but needs no normalization
+// or binary search. blockDim.x is a power of two >= k.
+template <typename scalar_t, typename accscalar_t>
+C10_LAUNCH_BOUNDS_1(1024)
+__global__ void topk_softmax_sample_kernel(
+    PhiloxCudaState philox_args,
+    const scalar_t* topk_vals,
+    const int64_t* topk_idx,
+    int64_t* dest,
+    int k,
+    accscalar_t inv_temp,
+    accscalar_t top_p) {
+  extern __shared__ unsigned char my_smem[];
+  accscalar_t* smem = reinterpret_cast<accscalar_t*>(my_smem);
+  int* smem_idx = reinterpret_cast<int*>(smem + blockDim.x);
+
+  const int64_t row = blockIdx.x;
+  const int tid = threadIdx.x;
+  const bool valid = tid < k;
+
+  auto seeds = at::cuda::philox::unpack(philox_args);
+  curandStatePhilox4_32_10_t state;
+  curand_init(
+      std::get<0>(seeds),
+      row * blockDim.x + tid,
+      std::get<1>(seeds),
+      &state);
+
+  // temperature-scaled softmax over the candidates; entry 0 is the max
+  const accscalar_t max_val = static_cast<accscalar_t>(topk_vals[row * k]);
+  accscalar_t shifted = 0;
+  accscalar_t prob = 0;
+  if (valid) {
+    shifted =
+        (static_cast<accscalar_t>(topk_vals[row * k + tid]) - max_val) *
+        inv_temp;
+    prob = ::exp(shifted);
+  }
+
+  // inclusive prefix sum of the unnormalized probabilities
+  smem[tid] = prob;
+  __syncthreads();
+  for (int offset = 1; offset < blockDim.x; offset *= 2) {
+    accscalar_t val = 0;
+    if (tid >= offset) {
+      val = smem[tid - offset] + smem[tid];
+    }
+    __syncthreads();
+    if (tid >= offset) {
+      smem[tid] = val;
+    }
+    __syncthreads();
+  }
+  const accscalar_t total = smem[blockDim.x - 1];
+  const accscalar_t prefix = smem[tid] - prob;
+  __syncthreads();
+
+  // nucleus filtering: keep the smallest sorted prefix holding at least
+  // top_p of the candidate mass. The first candidate is always kept.
+  const bool keep = valid && prefix < top_p * total;
+
+  accscalar_t score = -std::numeric_limits<accscalar_t>::infinity();
+  if (keep) {
+    // curand_uniform is in (0, 1]; clamp away from 1 so the Gumbel
+    // noise stays finite
+    auto rand = curand_uniform4(&state);
+    accscalar_t u = static_cast<accscalar_t>(rand.x);
+    u = u < accscalar_t(1)
+        ? u
+        : accscalar_t(1) - std::numeric_limits<accscalar_t>::epsilon();
+    score = shifted - ::log(-::log(u));
+  }
+
+  // block argmax over the perturbed scores
+  smem[tid] = score;
+  smem_idx[tid] = tid;
+  __syncthreads();
+  for (int offset = blockDim.x / 2; offset > 0; offset >>= 1) {
+    if (tid < offset && smem[tid + offset] > smem[tid]) {
+      smem[tid] = smem[tid + offset];
+      smem_idx[tid] = smem_idx[tid + offset];
+    }
+    __syncthreads();
+  }
+  if (tid == 0) {
+    dest[row] = topk_idx[row * k + smem_idx[0]];
+  }
+}
+
+} // namespace
+
+Tensor _topk_softmax_sample_cuda(
+    const Tensor& logits,
+    int64_t k,
+    double temperature,
+    std::optional<double> top_p,
+    std::optional<Generator> generator) {
+  TORCH_CHECK(
+      logits.dim() == 2,
+      "_topk_softmax_sample: expected 2-D logits of shape [num_rows, vocab_size], got ",
+      logits.dim(),
+      "-D");
+  const int64_t rows = logits.size(0);
+  const int64_t vocab_size = logits.size(1);
+  TORCH_CHECK(
+      k > 0 && k <= vocab_size,
+      "_topk_softmax_sample: expected 0 < k <= ",
+      vocab_size,
+      ", got ",
+      k);
+  TORCH_CHECK(
+      k <= 1024, "_topk_softmax_sample: only k <= 1024 is supported, got ", k);
+  TORCH_CHECK(
+      temperature > 0,
+      "_topk_softmax_sample: expected temperature > 0, got ",
+      temperature);
+  const double p = top_p.value_or(1.0);
+  TORCH_CHECK(
+      p > 0 && p <= 1.0,
+      "_topk_softmax_sample: expected top_p in (0, 1], got ",
+      p);
+
+  // the existing radix top-k does the heavy lifting over the vocab;
+  // the fused kernel only touches the k surviving candidates per row
+  auto [topk_vals, topk_idx] =
+      at::topk(logits, k, /*dim=*/-1, /*largest=*/true, /*sorted=*/true);
+  topk_vals = topk_vals.contiguous();
+  topk_idx = topk_idx.contiguous();
+
+  Tensor result =
+      at::detail::empty_cuda({rows}, logits.options().dtype(kLong));
+  if (rows == 0) {
+    return result;
+  }
+
+  auto gen = get_generator_or_default<CUDAGeneratorImpl>(
+      generator, cuda::detail::getDefaultCUDAGenerator());
+  PhiloxCudaState rng_engine_inputs;
+  {
+    // See Note [Acquire lock when using random generators]
+    std::lock_guard<std::mutex> lock(gen->mutex_);
+    // each thread draws a single uniform4
+    rng_engine_inputs = gen->philox_cuda_state(4);
+  }
+
+  const int warp_size = at::cuda::warp_size();
+  int block_size = warp_size;
+  while (block_size < k) {
+    block_size *= 2;
+  }
+
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      kHalf, kBFloat16, logits.scalar_type(), "_topk_softmax_sample_cuda", [&] {
+        using accscalar_t = at::acc_type<scalar_t, true>;
+        const int smem_size =
+            block_size * (sizeof(accscalar_t) + sizeof(int));
+        topk_softmax_sample_kernel<scalar_t, accscalar_t>
+            <<<rows, block_size, smem_size, at::cuda::getCurrentCUDAStream()>>>(
+                rng_engine_inputs,
+                topk_vals.const_data_ptr<scalar_t>(),
+                topk_idx.const_data_ptr<int64_t>(),
+                result.mutable_data_ptr<int64_t>(),
+                static_cast<int>(k),
+                static_cast<accscalar_t>(1.0 / temperature),
+                static_cast<accscalar_t>(p));
+        C10_CUDA_KERNEL_LAUNCH_CHECK();
+      });
+
+  return result;
+}
+
+} // namespace at::native
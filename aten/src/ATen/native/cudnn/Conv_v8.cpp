@@ -22,11 +22,17 @@ C10_DIAGNOSTIC_POP()
 #include <cudnn_frontend_find_plan.h>
 #include <cudnn_frontend_get_plan.h>
 
+#include <ATen/cuda/CUDAContextLight.h>
 #include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAException.h>
 #include <c10/util/env.h>
 
+#include <atomic>
+#include <cerrno>
+#include <cstring>
 #include <list>
+#include <mutex>
+#include <optional>
 #include <unordered_map>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -39,6 +45,14 @@ C10_DIAGNOSTIC_POP()
 #include <dlfcn.h>
 #endif
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/file.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
 namespace at {
 namespace native {
 
@@ -353,6 +367,221 @@ thread_local BenchmarkCache<cudnn_frontend::ExecutionPlan, CacheKeyWrapper>
 thread_local BenchmarkCache<cudnn_frontend::ExecutionPlan, CacheKeyFusedWrapper>
     benchmark_cache_fused;
 
+// Optional cross-process persistence for benchmark results, opt-in via
+// at::globalContext().setPlanCachePathCuDNN(). ExecutionPlan objects hold
+// handle-specific state and cannot be shared between processes directly, so we
+// instead persist the winning plan's tag keyed by the raw cache key bytes; a
+// reader rebuilds the plan from heuristic/fallback engine configs by matching
+// the tag, which skips the benchmark sweep. The table is a fixed-size
+// open-addressed hash map in a file mapped MAP_SHARED, so colocated processes
+// (e.g. one per GPU on a serving node) observe each other's results as soon
+// as they are published.
+constexpr uint32_t kPlanCacheMagic = 0x50435635; // "5VCP"
+constexpr uint32_t kPlanCacheFormatVersion = 1;
+constexpr size_t kPlanCacheCapacity = 4096;
+constexpr size_t kPlanCacheMaxKeyBytes = 256;
+constexpr size_t kPlanCacheMaxTagBytes = 256;
+constexpr uint32_t kPlanCacheConvKey = 0;
+constexpr uint32_t kPlanCacheFusedConvKey = 1;
+
+struct PlanCacheHeader {
+  uint32_t magic;
+  uint32_t format_version;
+  uint64_t cudnn_version;
+  char gpu_tag[64];
+  uint64_t capacity;
+};
+
+struct PlanCacheEntry {
+  // 0 = empty, 1 = write in progress, 2 = published
+  std::atomic<uint32_t> state;
+  uint32_t key_kind;
+  uint32_t key_size;
+  uint8_t key[kPlanCacheMaxKeyBytes];
+  char tag[kPlanCacheMaxTagBytes];
+};
+
+static_assert(
+    sizeof(CacheKey) <= kPlanCacheMaxKeyBytes &&
+        sizeof(CacheKeyFused) <= kPlanCacheMaxKeyBytes,
+    "cuDNN plan cache file entries are too small for the cache keys");
+
+size_t plan_cache_hash(const uint8_t* data, size_t size) {
+  // FNV-1a, same scheme as ParamsWrapperHash
+  uint32_t value = 0x811C9DC5;
+  for (const auto i : c10::irange(size)) {
+    value ^= data[i];
+    value *= 0x01000193;
+  }
+  return (size_t)value;
+}
+
+class PersistentPlanCache {
+ public:
+  static PersistentPlanCache& get() {
+    static PersistentPlanCache instance;
+    return instance;
+  }
+
+  bool enabled() {
+#ifdef _WIN32
+    if (!at::globalContext().planCachePathCuDNN().empty()) {
+      TORCH_WARN_ONCE(
+          "cuDNN plan cache persistence is not supported on Windows");
+    }
+    return false;
+#else
+    const auto& path = at::globalContext().planCachePathCuDNN();
+    if (path.empty()) {
+      return false;
+    }
+    std::call_once(init_flag_, [&] { initialize(path); });
+    return entries_ != nullptr;
+#endif
+  }
+
+  std::optional<std::string> find(
+      const uint32_t key_kind,
+      const void* key,
+      const size_t key_size) {
+    const auto* key_bytes = static_cast<const uint8_t*>(key);
+    const size_t hash = plan_cache_hash(key_bytes, key_size);
+    for (const auto i : c10::irange(kPlanCacheCapacity)) {
+      auto& entry = entries_[(hash + i) % kPlanCacheCapacity];
+      const auto state = entry.state.load(std::memory_order_acquire);
+      if (state == 0) {
+        return std::nullopt;
+      }
+      if (state == 2 && entry.key_kind == key_kind &&
+          entry.key_size == key_size &&
+          memcmp(entry.key, key_bytes, key_size) == 0) {
+        return std::string(entry.tag);
+      }
+      // slot belongs to another key (or is mid-write), keep probing
+    }
+    return std::nullopt;
+  }
+
+  void update(
+      const uint32_t key_kind,
+      const void* key,
+      const size_t key_size,
+      const std::string& tag) {
+    if (key_size > kPlanCacheMaxKeyBytes ||
+        tag.size() >= kPlanCacheMaxTagBytes) {
+      return;
+    }
+    const auto* key_bytes = static_cast<const uint8_t*>(key);
+    const size_t hash = plan_cache_hash(key_bytes, key_size);
+    for (const auto i : c10::irange(kPlanCacheCapacity)) {
+      auto& entry = entries_[(hash + i) % kPlanCacheCapacity];
+      auto state = entry.state.load(std::memory_order_acquire);
+      if (state == 0 &&
+          entry.state.compare_exchange_strong(
+              state, 1, std::memory_order_acq_rel)) {
+        entry.key_kind = key_kind;
+        entry.key_size = static_cast<uint32_t>(key_size);
+        memcpy(entry.key, key_bytes, key_size);
+        memset(entry.tag, 0, kPlanCacheMaxTagBytes);
+        memcpy(entry.tag, tag.c_str(), tag.size() + 1);
+        entry.state.store(2, std::memory_order_release);
+        return;
+      }
+      if (state == 2 && entry.key_kind == key_kind &&
+          entry.key_size == key_size &&
+          memcmp(entry.key, key_bytes, key_size) == 0) {
+        // another process already published a result for this key;
+        // first writer wins
+        return;
+      }
+      // lost the slot to another key (or a concurrent writer), keep probing
+    }
+    // table is full; the in-memory cache still holds the plan
+  }
+
+ private:
+#ifndef _WIN32
+  void initialize(const std::string& path) {
+    const size_t nbytes =
+        sizeof(PlanCacheHeader) + kPlanCacheCapacity * sizeof(PlanCacheEntry);
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+      TORCH_WARN(
+          "Could not open cuDNN plan cache file ",
+          path,
+          ": ",
+          strerror(errno));
+      return;
+    }
+    PlanCacheHeader expected{};
+    expected.magic = kPlanCacheMagic;
+    expected.format_version = kPlanCacheFormatVersion;
+    expected.cudnn_version = cudnnGetVersion();
+    auto* prop = at::cuda::getCurrentDeviceProperties();
+    snprintf(
+        expected.gpu_tag,
+        sizeof(expected.gpu_tag),
+        "%s (%d.%d)",
+        prop->name,
+        prop->major,
+        prop->minor);
+    expected.capacity = kPlanCacheCapacity;
+    // Serialize file creation against other local processes racing on the
+    // same path; the lock is only held during setup, lookups and publishes
+    // are lock free.
+    if (flock(fd, LOCK_EX) != 0) {
+      TORCH_WARN(
+          "Could not lock cuDNN plan cache file ",
+          path,
+          ": ",
+          strerror(errno));
+      close(fd);
+      return;
+    }
+    struct stat st {};
+    bool ok = fstat(fd, &st) == 0;
+    const bool fresh = ok && st.st_size == 0;
+    if (fresh) {
+      // zero-fills, so all entries start out empty
+      ok = ftruncate(fd, static_cast<off_t>(nbytes)) == 0;
+    } else if (ok && st.st_size != static_cast<off_t>(nbytes)) {
+      TORCH_WARN(
+          "cuDNN plan cache file ",
+          path,
+          " has an unexpected size, ignoring it");
+      ok = false;
+    }
+    void* map = MAP_FAILED;
+    if (ok) {
+      map = mmap(nullptr, nbytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+      ok = map != MAP_FAILED;
+    }
+    if (ok) {
+      auto* header = static_cast<PlanCacheHeader*>(map);
+      if (fresh) {
+        memcpy(header, &expected, sizeof(expected));
+      } else if (memcmp(header, &expected, sizeof(expected)) != 0) {
+        TORCH_WARN(
+            "cuDNN plan cache file ",
+            path,
+            " was written for a different cuDNN version or GPU, ignoring it");
+        munmap(map, nbytes);
+        ok = false;
+      }
+    }
+    flock(fd, LOCK_UN);
+    close(fd);
+    if (ok) {
+      entries_ = reinterpret_cast<PlanCacheEntry*>(
+          static_cast<char*>(map) + sizeof(PlanCacheHeader));
+    }
+  }
+#endif
+
+  std::once_flag init_flag_;
+  PlanCacheEntry* entries_{nullptr};
+};
+
 } // namespace
 
 void run_conv_plan(
@@ -863,6 +1092,115 @@ auto get_configs_from_heuristics_fused(
   return configs;
 }
 
+// Rebuilds a plan recorded in the persistent plan cache by another local
+// process: walk the heuristic and fallback engine configs and build only the
+// one whose tag matches, instead of benchmarking all of them.
+bool try_tagged_plan(
+    const std::string& plan_tag,
+    const CacheKeyWrapper& key,
+    const cudnnHandle_t handle,
+    const Tensor& x,
+    const Tensor& y,
+    const Tensor& w,
+    const cudnnBackendDescriptorType_t operation,
+    const IntArrayRef padding,
+    const IntArrayRef stride,
+    const IntArrayRef dilation,
+    const bool deterministic,
+    const bool allow_tf32) {
+  for (const bool fallback : {false, true}) {
+    std::string opgraph_tag;
+    auto configs = get_configs_from_heuristics(
+        handle,
+        operation,
+        opgraph_tag,
+        x,
+        y,
+        w,
+        key,
+        padding,
+        stride,
+        dilation,
+        deterministic,
+        allow_tf32,
+        fallback);
+    for (auto& config : configs) {
+      try {
+        auto plan = cudnn_frontend::ExecutionPlanBuilder()
+                        .setHandle(handle)
+                        .setEngineConfig(config, opgraph_tag)
+                        .build();
+        if (plan.getTag() != plan_tag) {
+          continue;
+        }
+        run_conv_plan(handle, x, y, w, plan, operation);
+        benchmark_cache.update(key, plan);
+        return true;
+      } catch (cudnn_frontend::cudnnException& e) {
+      } catch (CuDNNError& e) {
+      } catch (c10::OutOfMemoryError& e) {
+        (void)cudaGetLastError(); // clear CUDA error
+      }
+    }
+  }
+  return false;
+}
+
+bool try_tagged_plan_fused(
+    const std::string& plan_tag,
+    const CacheKeyFusedWrapper& key,
+    const cudnnHandle_t handle,
+    const Tensor& x,
+    const Tensor& y,
+    const Tensor& w,
+    const Tensor& z,
+    const Tensor& b,
+    const float alpha,
+    const IntArrayRef padding,
+    const IntArrayRef stride,
+    const IntArrayRef dilation,
+    const bool deterministic,
+    const bool allow_tf32) {
+  for (const bool fallback : {false, true}) {
+    std::string opgraph_tag;
+    auto configs = get_configs_from_heuristics_fused(
+        handle,
+        opgraph_tag,
+        x,
+        y,
+        w,
+        z,
+        b,
+        alpha,
+        key,
+        padding,
+        stride,
+        dilation,
+        deterministic,
+        allow_tf32,
+        fallback);
+    for (auto& config : configs) {
+      try {
+        auto plan = cudnn_frontend::ExecutionPlanBuilder()
+                        .setHandle(handle)
+                        .setEngineConfig(config, opgraph_tag)
+                        .build();
+        if (plan.getTag() != plan_tag) {
+          continue;
+        }
+        run_conv_plan_fused(handle, x, y, w, z, b, plan);
+        benchmark_cache_fused.update(key, plan);
+        return true;
+      } catch (cudnn_frontend::cudnnException& e) {
+      } catch (CuDNNError& e) {
+      } catch (c10::OutOfMemoryError& e) {
+        (void)cudaGetLastError(); // clear CUDA error
+      }
+    }
+  }
+  return false;
+}
+
 void try_plans(
     cudnn_frontend::executionPlans_t& plans,
     const CacheKeyWrapper& key,
@@ -875,6 +1213,10 @@ void try_plans(
     try {
       run_conv_plan(handle, x, y, w, plan, operation);
       benchmark_cache.update(key, plan);
+      if (PersistentPlanCache::get().enabled()) {
+        PersistentPlanCache::get().update(
+            kPlanCacheConvKey, &key.pod, sizeof(key.pod), plan.getTag());
+      }
       return;
     } catch (cudnn_frontend::cudnnException& e) {
     } catch (CuDNNError& e) {
@@ -899,6 +1241,10 @@ void try_plans_fused(
     try {
       run_conv_plan_fused(handle, x, y, w, z, b, plan);
       benchmark_cache_fused.update(key, plan);
+      if (PersistentPlanCache::get().enabled()) {
+        PersistentPlanCache::get().update(
+            kPlanCacheFusedConvKey, &key.pod, sizeof(key.pod), plan.getTag());
+      }
       return;
     } catch (cudnn_frontend::cudnnException& e) {
     } catch (CuDNNError& e) {
@@ -1046,6 +1392,26 @@ void run_single_conv(
     TORCH_CHECK(
         false, "GET was unable to find an engine to execute this computation");
   } else {
+    if (PersistentPlanCache::get().enabled()) {
+      auto tag = PersistentPlanCache::get().find(
+          kPlanCacheConvKey, &key.pod, sizeof(key.pod));
+      if (tag.has_value() &&
+          try_tagged_plan(
+              *tag,
+              key,
+              handle,
+              x,
+              y,
+              w,
+              operation,
+              padding,
+              stride,
+              dilation,
+              deterministic,
+              allow_tf32)) {
+        return;
+      }
+    }
     cudnn_frontend::executionPlans_t plans = get_plans_from_find(
         handle,
         operation,
@@ -1151,6 +1517,28 @@ void run_fused_conv(
     TORCH_CHECK(
         false, "GET was unable to find an engine to execute this computation");
   } else {
+    if (PersistentPlanCache::get().enabled()) {
+      auto tag = PersistentPlanCache::get().find(
+          kPlanCacheFusedConvKey, &key.pod, sizeof(key.pod));
+      if (tag.has_value() &&
+          try_tagged_plan_fused(
+              *tag,
+              key,
+              handle,
+              x,
+              y,
+              w,
+              z,
+              b,
+              alpha,
+              padding,
+              stride,
+              dilation,
+              deterministic,
+              allow_tf32)) {
+        return;
+      }
+    }
     cudnn_frontend::executionPlans_t plans = get_plans_from_find_fused(
         handle,
         x,
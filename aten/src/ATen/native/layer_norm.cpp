@@ -12,6 +12,8 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/_fused_add_layer_norm_native.h>
+#include <ATen/ops/_fused_add_rms_norm_native.h>
 #include <ATen/ops/empty.h>
 #include <ATen/ops/empty_like.h>
 #include <ATen/ops/empty_like_native.h>
@@ -201,6 +203,8 @@ Tensor layer_norm_symint(
 
 DEFINE_DISPATCH(LayerNormKernel);
 DEFINE_DISPATCH(LayerNormBackwardKernel);
+DEFINE_DISPATCH(FusedAddLayerNormKernel);
+DEFINE_DISPATCH(FusedAddRMSNormKernel);
 
 // Ported from pytorch/xla repo
 std::tuple<Tensor, Tensor, Tensor> math_native_layer_norm(
@@ -310,4 +314,178 @@ Tensor rms_norm_symint(
   return result;
 
 }
+
+static std::pair<int64_t, int64_t> _check_fused_add_norm_inputs(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const Tensor& weight,
+    const Tensor& bias,
+    std::optional<ScalarType> out_dtype) {
+  auto M_N = _check_layer_norm_inputs(input, normalized_shape, weight, bias);
+  TORCH_CHECK(
+      residual.sizes().equals(input.sizes()),
+      "Expected residual to have the same shape as input, but got residual of shape ",
+      residual.sizes(),
+      " and input of shape ",
+      input.sizes());
+  TORCH_CHECK(
+      residual.scalar_type() == input.scalar_type(),
+      "Expected residual to have the same dtype as input, but got ",
+      residual.scalar_type(),
+      " and ",
+      input.scalar_type());
+  // unlike native_layer_norm, the fused path has no mixed-type support
+  TORCH_CHECK(
+      !weight.defined() || weight.scalar_type() == input.scalar_type(),
+      "Expected weight to have the same dtype as input, but got ",
+      weight.scalar_type(),
+      " and ",
+      input.scalar_type());
+  TORCH_CHECK(
+      !bias.defined() || bias.scalar_type() == input.scalar_type(),
+      "Expected bias to have the same dtype as input, but got ",
+      bias.scalar_type(),
+      " and ",
+      input.scalar_type());
+  if (out_dtype.has_value() && *out_dtype != input.scalar_type()) {
+    TORCH_CHECK(
+        input.scalar_type() == kFloat &&
+            (*out_dtype == kBFloat16 || *out_dtype == kHalf),
+        "out_dtype is only supported to downcast float outputs to BFloat16 "
+        "or Half, but got input dtype ",
+        input.scalar_type(),
+        " and out_dtype ",
+        *out_dtype);
+  }
+  return M_N;
+}
+
+std::tuple<Tensor, Tensor> fused_add_layer_norm_cpu(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    const std::optional<Tensor>& bias_opt /* optional */,
+    double eps,
+    std::optional<ScalarType> out_dtype) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned = at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  c10::MaybeOwned<Tensor> bias_maybe_owned = at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  auto M_N = _check_fused_add_norm_inputs(
+      input, residual, normalized_shape, weight, bias, out_dtype);
+  auto M = M_N.first;
+  auto N = M_N.second;
+  auto X = input.expect_contiguous();
+  auto Z = residual.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+  auto beta = bias.expect_contiguous();
+
+  Tensor add_out = at::native::empty_like(
+      *X,
+      std::nullopt /* dtype */,
+      std::nullopt /* layout */,
+      std::nullopt /* device */,
+      std::nullopt /* pin_memory */,
+      at::MemoryFormat::Contiguous);
+  Tensor Y = at::native::empty_like(
+      *X,
+      out_dtype.value_or(X->scalar_type()),
+      std::nullopt /* layout */,
+      std::nullopt /* device */,
+      std::nullopt /* pin_memory */,
+      at::MemoryFormat::Contiguous);
+  if (M > 0) {
+    FusedAddLayerNormKernel(kCPU, *X, *Z, *gamma, *beta, M, N, eps, &Y, &add_out);
+  }
+  return std::make_tuple(std::move(Y), std::move(add_out));
+}
+
+std::tuple<Tensor, Tensor> fused_add_rms_norm_cpu(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    double eps,
+    std::optional<ScalarType> out_dtype) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned = at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+
+  auto M_N = _check_fused_add_norm_inputs(
+      input, residual, normalized_shape, weight, /*bias=*/Tensor(), out_dtype);
+  auto M = M_N.first;
+  auto N = M_N.second;
+  auto X = input.expect_contiguous();
+  auto Z = residual.expect_contiguous();
+  auto gamma = weight.expect_contiguous();
+
+  Tensor add_out = at::native::empty_like(
+      *X,
+      std::nullopt /* dtype */,
+      std::nullopt /* layout */,
+      std::nullopt /* device */,
+      std::nullopt /* pin_memory */,
+      at::MemoryFormat::Contiguous);
+  Tensor Y = at::native::empty_like(
+      *X,
+      out_dtype.value_or(X->scalar_type()),
+      std::nullopt /* layout */,
+      std::nullopt /* device */,
+      std::nullopt /* pin_memory */,
+      at::MemoryFormat::Contiguous);
+  if (M > 0) {
+    FusedAddRMSNormKernel(kCPU, *X, *Z, *gamma, M, N, eps, &Y, &add_out);
+  }
+  return std::make_tuple(std::move(Y), std::move(add_out));
+}
+
+std::tuple<Tensor, Tensor> math_fused_add_layer_norm(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    const std::optional<Tensor>& bias_opt /* optional */,
+    double eps,
+    std::optional<ScalarType> out_dtype) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned = at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+  c10::MaybeOwned<Tensor> bias_maybe_owned = at::borrow_from_optional_tensor(bias_opt);
+  const Tensor& bias = *bias_maybe_owned;
+
+  _check_fused_add_norm_inputs(
+      input, residual, normalized_shape, weight, bias, out_dtype);
+  Tensor add_out = input.add(residual);
+  Tensor Y = std::get<0>(
+      at::native_layer_norm(add_out, normalized_shape, weight_opt, bias_opt, eps));
+  if (out_dtype.has_value() && *out_dtype != Y.scalar_type()) {
+    Y = Y.to(*out_dtype);
+  }
+  return std::make_tuple(std::move(Y), std::move(add_out));
+}
+
+std::tuple<Tensor, Tensor> math_fused_add_rms_norm(
+    const Tensor& input,
+    const Tensor& residual,
+    IntArrayRef normalized_shape,
+    const std::optional<Tensor>& weight_opt /* optional */,
+    double eps,
+    std::optional<ScalarType> out_dtype) {
+  // See [Note: hacky wrapper removal for optional tensor]
+  c10::MaybeOwned<Tensor> weight_maybe_owned = at::borrow_from_optional_tensor(weight_opt);
+  const Tensor& weight = *weight_maybe_owned;
+
+  _check_fused_add_norm_inputs(
+      input, residual, normalized_shape, weight, /*bias=*/Tensor(), out_dtype);
+  Tensor add_out = input.add(residual);
+  Tensor Y = at::rms_norm(add_out, normalized_shape, weight_opt, eps);
+  if (out_dtype.has_value() && *out_dtype != Y.scalar_type()) {
+    Y = Y.to(*out_dtype);
+  }
+  return std::make_tuple(std::move(Y), std::move(add_out));
+}
 } // namespace at::native
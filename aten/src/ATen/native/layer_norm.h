@@ -135,7 +135,30 @@ using backward_fn = void (*)(
     Tensor* /* dgamma */,
     Tensor* /* dbeta */);
 
+using fused_add_layer_norm_fn = void (*)(
+    const Tensor& /* X */,
+    const Tensor& /* Z (residual) */,
+    const Tensor& /* gamma */,
+    const Tensor& /* beta */,
+    int64_t /* M */,
+    int64_t /* N */,
+    double /* eps */,
+    Tensor* /* Y */,
+    Tensor* /* add_out */);
+
+using fused_add_rms_norm_fn = void (*)(
+    const Tensor& /* X */,
+    const Tensor& /* Z (residual) */,
+    const Tensor& /* gamma */,
+    int64_t /* M */,
+    int64_t /* N */,
+    double /* eps */,
+    Tensor* /* Y */,
+    Tensor* /* add_out */);
+
 DECLARE_DISPATCH(forward_fn, LayerNormKernel);
 DECLARE_DISPATCH(backward_fn, LayerNormBackwardKernel);
+DECLARE_DISPATCH(fused_add_layer_norm_fn, FusedAddLayerNormKernel);
+DECLARE_DISPATCH(fused_add_rms_norm_fn, FusedAddRMSNormKernel);
 
 } // namespace at::native
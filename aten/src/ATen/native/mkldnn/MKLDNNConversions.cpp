@@ -6,6 +6,8 @@
 #include <ATen/native/utils/ParamUtils.h>
 #include <torch/library.h>
 
+#include <cstring>
+
 #ifndef AT_PER_OPERATOR_HEADERS
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
@@ -538,7 +540,64 @@ static Tensor get_mkldnn_serialized_md(const Tensor& self) {
   return res;
 }
 
+static Tensor get_mkldnn_packed_weight_data(const Tensor& self) {
+  // Copies the raw blocked payload of a prepacked weight into a plain byte
+  // tensor. Together with the serialized memory descriptor from
+  // _get_mkldnn_serialized_md this is enough to rebuild the packed tensor
+  // without running the reorder again; see _rebuild_packed_weight.
+  const ideep::tensor& packed_w = itensor_from_mkldnn(self);
+  const int64_t nbytes = static_cast<int64_t>(packed_w.get_desc().get_size());
+  auto res = at::empty({nbytes}, at::TensorOptions(at::kByte));
+  std::memcpy(res.data_ptr(), packed_w.get_data_handle(), nbytes);
+  return res;
+}
+
+static Tensor rebuild_mkldnn_packed_weight(
+    const Tensor& data,
+    const Tensor& serialized_md,
+    ScalarType dtype) {
+  // Inverse of _get_mkldnn_serialized_md + _get_packed_weight_data: rebuilds
+  // a prepacked weight from its serialized descriptor and raw payload. The
+  // returned tensor owns its buffer, unlike mkldnn_tensor_from_data_ptr
+  // which only wraps external memory.
+  TORCH_CHECK(
+      data.scalar_type() == ScalarType::Byte && data.is_contiguous() &&
+          serialized_md.scalar_type() == ScalarType::Byte &&
+          serialized_md.is_contiguous(),
+      "_rebuild_packed_weight: expected contiguous byte tensors as input");
+  const uint8_t* md_data = serialized_md.const_data_ptr<uint8_t>();
+  std::vector<uint8_t> vector_serialized_md{
+      md_data, md_data + serialized_md.numel()};
+  ideep::tensor::desc deserialized_ideep_desc;
+#if IDEEP_PREREQ(3, 4, 1, 2)
+  deserialized_ideep_desc = ideep::tensor::desc(vector_serialized_md);
+#else
+  TORCH_CHECK(false, "Unexpected IDeep version to do weight deserialization.");
+#endif
+  TORCH_CHECK(
+      deserialized_ideep_desc.get_data_type() == get_mkldnn_dtype(dtype),
+      "_rebuild_packed_weight: serialized descriptor does not match dtype ",
+      dtype);
+  TORCH_CHECK(
+      static_cast<int64_t>(deserialized_ideep_desc.get_size()) == data.numel(),
+      "_rebuild_packed_weight: serialized descriptor expects ",
+      deserialized_ideep_desc.get_size(),
+      " bytes of payload, got ",
+      data.numel());
+
+  ideep::tensor packed_w{deserialized_ideep_desc};
+  std::memcpy(
+      packed_w.get_data_handle(),
+      data.const_data_ptr(),
+      deserialized_ideep_desc.get_size());
+  return new_with_itensor_mkldnn(
+      std::move(packed_w), dtype, data.options().device_opt());
+}
+
 TORCH_LIBRARY_IMPL(mkldnn, CPU, m) {
+  m.impl(
+      TORCH_SELECTIVE_NAME("mkldnn::_rebuild_packed_weight"),
+      TORCH_FN(rebuild_mkldnn_packed_weight));
   m.impl(
       TORCH_SELECTIVE_NAME("mkldnn::_reorder_convolution_transpose_weight"),
       TORCH_FN(mkldnn_reorder_conv_transpose_weight));
@@ -557,6 +616,9 @@ TORCH_LIBRARY_IMPL(mkldnn, MkldnnCPU, m) {
   m.impl(
       TORCH_SELECTIVE_NAME("mkldnn::_get_mkldnn_serialized_md"),
       TORCH_FN(get_mkldnn_serialized_md ));
+  m.impl(
+      TORCH_SELECTIVE_NAME("mkldnn::_get_packed_weight_data"),
+      TORCH_FN(get_mkldnn_packed_weight_data));
 }
 
 #else
@@ -77,6 +77,8 @@ TORCH_LIBRARY(mkldnn, m) {
   m.def("mkldnn::data_ptr(Tensor mkldnn_tensor) -> int");
   m.def("mkldnn::_get_mkldnn_serialized_md (Tensor mkldnn_tensor) -> Tensor");
   m.def("mkldnn::_nbytes(Tensor mkldnn_tensor) -> int");
+  m.def("mkldnn::_get_packed_weight_data(Tensor mkldnn_tensor) -> Tensor");
+  m.def("mkldnn::_rebuild_packed_weight(Tensor data, Tensor serialized_md, ScalarType dtype) -> Tensor");
 }
 
 TORCH_LIBRARY(mkldnn_prepacked, m) {
@@ -77,6 +77,10 @@ NSArray<NSNumber*>* getTensorAxes(const TensorBase& t);
 NSArray<NSNumber*>* getTensorAxes(const IntArrayRef& sizes, at::OptionalIntArrayRef dim);
 std::string getMPSShapeString(MPSShape* shape);
 std::string getTensorsStringKey(const TensorList& tensors, bool short_dtype = true, bool exclude_shape = false);
+// Keys only on rank and dtype (e.g. ":Float32[*,*,*]") for graphs built with
+// flexible placeholder dimensions, so one cached graph serves all shapes of
+// that rank. Use together with mpsGraphFlexiblePlaceHolder.
+std::string getTensorsSymbolicStringKey(const TensorList& tensors, bool short_dtype = true);
 std::string getArrayRefString(const IntArrayRef s);
 // use has_storage() on the returned tensor to determine if src actually is a view
 Tensor gatherViewTensor(const Tensor& src, Tensor& dst);
@@ -136,6 +140,11 @@ MPSNDArray* ndArrayFromTensor(const TensorBase& tensor, MPSShape *shape, MPSData
 MPSGraphTensor* mpsGraphUnrankedPlaceHolder(MPSGraph *mpsGraph, MPSDataType dataType);
 MPSGraphTensor* mpsGraphRankedPlaceHolder(MPSGraph *mpsGraph, MPSDataType dataType, MPSShape* mpsShape);
 MPSGraphTensor* mpsGraphRankedPlaceHolder(MPSGraph *mpsGraph, const TensorBase& tensor);
+// Placeholder with all dimensions flexible (-1), relying on MPSGraph's
+// dynamic shape support. Graphs built with it should be cached under
+// getTensorsSymbolicStringKey so a single compiled graph serves every
+// concrete shape of the same rank and dtype.
+MPSGraphTensor* mpsGraphFlexiblePlaceHolder(MPSGraph *mpsGraph, const TensorBase& tensor);
 MPSGraphTensor* mpsGraphScalarPlaceHolder(MPSGraph *mpsGraph, MPSDataType dataType);
 MPSGraphTensor* mpsGraphScalarPlaceHolder(MPSGraph *mpsGraph, const Scalar& scalar);
 
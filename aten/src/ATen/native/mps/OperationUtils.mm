@@ -303,6 +303,31 @@ std::string getTensorsStringKey(const TensorList& tensors, bool short_dtype, boo
   return str;
 }
 
+std::string getTensorsSymbolicStringKey(const TensorList& tensors, bool short_dtype) {
+  std::string str;
+  // The key format per tensor would look like ":Float32[*,*,*]:" - only the
+  // rank and dtype are keyed, so that one graph built with flexible
+  // placeholder dimensions (see mpsGraphFlexiblePlaceHolder) serves every
+  // concrete shape of that rank instead of recompiling per shape.
+  for (const Tensor& tensor : tensors) {
+    str += ":";
+    if (tensor.defined()) {
+      str += getMPSTypeString(tensor.scalar_type(), short_dtype) + "[";
+      if (tensor.dim() == 0) {
+        str += "Scalar";
+      } else {
+        for (const auto i : c10::irange(tensor.dim())) {
+          str += (i == 0 ? "*" : ",*");
+        }
+      }
+      str += "]";
+    } else {
+      str += "Undefined";
+    }
+  }
+  return str;
+}
+
 Tensor getTensorView(const Tensor& t, MPSShape* shape) {
   std::vector<int64_t> res;
   res.reserve([shape count]);
@@ -688,6 +713,18 @@ MPSGraphTensor* mpsGraphRankedPlaceHolder(MPSGraph* mpsGraph, const TensorBase&
   return [mpsGraph placeholderWithShape:getMPSShape(tensor) dataType:getMPSScalarType(tensor) name:nil];
 }
 
+MPSGraphTensor* mpsGraphFlexiblePlaceHolder(MPSGraph* mpsGraph, const TensorBase& tensor) {
+  // Scalars are fed through the scalar path, so they keep a concrete shape.
+  if (tensor.dim() == 0) {
+    return mpsGraphRankedPlaceHolder(mpsGraph, tensor);
+  }
+  auto shape = [NSMutableArray<NSNumber*> arrayWithCapacity:tensor.dim()];
+  for (const auto i : c10::irange(tensor.dim())) {
+    shape[i] = @-1;
+  }
+  return [mpsGraph placeholderWithShape:shape dataType:getMPSScalarType(tensor) name:nil];
+}
+
 MPSGraphTensor* mpsGraphScalarPlaceHolder(MPSGraph* mpsGraph, MPSDataType dataType) {
   return [mpsGraph placeholderWithShape:@[ @1 ] dataType:dataType name:nil];
 }
@@ -84,9 +84,13 @@ static void unary_op_noresize(const Tensor& self, const Tensor& output_, std::st
   }
 
   @autoreleasepool {
-    string key = op_name + getTensorsStringKey({self, output});
+    // Unary ops are shape polymorphic: build the graph with flexible
+    // dimensions and key the cache on rank and dtype only, so that
+    // variable-length workloads reuse one compiled graph per rank instead
+    // of recompiling for every concrete shape.
+    string key = op_name + getTensorsSymbolicStringKey({self, output});
     auto cachedGraph = LookUpOrCreateCachedGraph<MPSUnaryCachedGraph>(key, [&](auto mpsGraph, auto newCachedGraph) {
-      newCachedGraph->inputTensor_ = mpsGraphRankedPlaceHolder(mpsGraph, self);
+      newCachedGraph->inputTensor_ = mpsGraphFlexiblePlaceHolder(mpsGraph, self);
       MPSGraphTensor* castTensor = newCachedGraph->inputTensor_;
       // Integer input must be cast to float if output is float
       if (isIntegralType(self.scalar_type(), true) && isFloatingType(output.scalar_type())) {
@@ -301,13 +301,45 @@ _scaled_dot_product_efficient_attention_nestedtensor_cuda(
       ? sdp::CustomMaskType::CausalFromTopLeft
       : sdp::CustomMaskType::NoCustomMask;
 
+  // The varlen kernel reads each batch entry's [seqlen_q, seqlen_kv] window
+  // of the bias from its top-left corner, so a dense bias shaped against the
+  // max sequence lengths covers the ragged batch without materializing
+  // padding for q/k/v. Expand to [batch, num_heads, max_q, max_kv] so
+  // broadcast dims turn into zero strides the kernel can consume.
+  std::optional<Tensor> bias;
+  if (attn_bias.has_value()) {
+    const int64_t batch_size = cumulative_sequence_length_q.size(0) - 1;
+    const int64_t num_heads = query_buffer_reshaped.size(1);
+    TORCH_CHECK(
+        attn_bias->dim() <= 4,
+        "_scaled_dot_product_efficient_attention: attn_bias must have at most 4 dims for nested inputs");
+    auto bias_ = *attn_bias;
+    // Mirror preprocess_mask on the dense path: the kernel requires a
+    // last-dim contiguous bias with the remaining strides aligned, so pad
+    // the last dim up to a multiple of 8 and slice back to size.
+    constexpr int64_t mem_eff_alignment = 8;
+    bool aligned = bias_.stride(-1) == 1;
+    for (const auto i : c10::irange(bias_.dim() - 1)) {
+      aligned = aligned && bias_.stride(i) % mem_eff_alignment == 0;
+    }
+    if (!aligned) {
+      const int64_t last_dim_size = bias_.size(-1);
+      const int64_t pad_count =
+          mem_eff_alignment - (last_dim_size % mem_eff_alignment);
+      bias_ = at::constant_pad_nd(bias_, {0, pad_count});
+      bias_ = bias_.slice(-1, 0, last_dim_size);
+    }
+    bias = bias_.expand(
+        {batch_size, num_heads, max_seqlen_batch_q, max_seqlen_batch_k});
+  }
+
   // See Note [Seed and Offset] for description of seed and offset
   // Although max_seqlen_q, and max_seqlen_batch_kv is returned we drop these values.
   auto [attention, log_sumexp, seed, offset, max_seqlen_q, max_seqlen_batch_kv] = at::_efficient_attention_forward(
       query_buffer_reshaped.unsqueeze(0),
       key_buffer_reshaped.unsqueeze(0),
       value_buffer_reshaped.unsqueeze(0),
-      std::nullopt,
+      bias,
       cumulative_sequence_length_q,
       cumulative_sequence_length_kv,
       max_seqlen_batch_q,
@@ -0,0 +1,103 @@
+#pragma once
+#include <ATen/cpu/vec/vec.h>
+#include <ATen/native/TensorIterator.h>
+#include <ATen/native/cpu/Loops.h>
+#include <ATen/native/quantized/AffineQuantizerBase.h>
+#include <c10/util/irange.h>
+
+namespace at::native {
+
+// Fused dequantize -> float chain -> requantize elementwise kernels.
+//
+// Quantized elementwise chains otherwise execute op-by-op, with each op
+// requantizing (or materializing fp32 for) its intermediate result. These
+// helpers run a caller-supplied float functor over dequantized values in a
+// single TensorIterator pass: inputs are widened with
+// Vectorized<scalar_t>::dequantize at load, the functor runs on
+// Vectorized<float> registers, and the result is narrowed with
+// Vectorized<scalar_t>::quantize at store (see vec256_qint.h for the
+// converters). A multi-op chain is fused simply by composing it inside the
+// functor, e.g. relu6 followed by a scale:
+//
+//   qfused_unary_kernel<c10::qint8>(
+//       iter, i_scale, i_zp, o_scale, o_zp,
+//       [=](float x) { return std::min(std::max(x, 0.f), 6.f) * alpha; },
+//       [=](Vectorized<float> x) {
+//         return minimum(maximum(x, zero_vec), six_vec) * alpha_vec;
+//       });
+template <typename scalar_t, typename func_t, typename vec_func_t>
+void qfused_unary_kernel(
+    TensorIteratorBase& iter,
+    double input_scale,
+    int64_t input_zero_point,
+    double output_scale,
+    int64_t output_zero_point,
+    func_t op,
+    vec_func_t vop) {
+  using qVec = Vectorized<scalar_t>;
+  using fVec = Vectorized<float>;
+  const auto i_scale = static_cast<float>(input_scale);
+  const auto o_scale = static_cast<float>(output_scale);
+  const float o_inv_scale = 1.0f / o_scale;
+  const fVec i_scale_vec(i_scale);
+  const fVec i_zp_vec(static_cast<float>(input_zero_point));
+  const fVec i_premul_vec = i_scale_vec * i_zp_vec.neg();
+  cpu_kernel_vec(
+      iter,
+      [=](scalar_t qx) -> scalar_t {
+        const float x =
+            at::native::dequantize_val(input_scale, input_zero_point, qx);
+        return at::native::quantize_val<scalar_t>(
+            output_scale, output_zero_point, op(x));
+      },
+      [=](qVec qx) -> qVec {
+        auto xs = qx.dequantize(i_scale_vec, i_zp_vec, i_premul_vec);
+        for (auto& x : xs) {
+          x = vop(x);
+        }
+        return qVec::quantize(xs, o_scale, output_zero_point, o_inv_scale);
+      });
+}
+
+// Binary variant: both inputs are dequantized with their own qparams, the
+// float functor combines them, and the result is quantized at store.
+template <typename scalar_t, typename func_t, typename vec_func_t>
+void qfused_binary_kernel(
+    TensorIteratorBase& iter,
+    double a_scale,
+    int64_t a_zero_point,
+    double b_scale,
+    int64_t b_zero_point,
+    double output_scale,
+    int64_t output_zero_point,
+    func_t op,
+    vec_func_t vop) {
+  using qVec = Vectorized<scalar_t>;
+  using fVec = Vectorized<float>;
+  const auto o_scale = static_cast<float>(output_scale);
+  const float o_inv_scale = 1.0f / o_scale;
+  const fVec a_scale_vec(static_cast<float>(a_scale));
+  const fVec a_zp_vec(static_cast<float>(a_zero_point));
+  const fVec a_premul_vec = a_scale_vec * a_zp_vec.neg();
+  const fVec b_scale_vec(static_cast<float>(b_scale));
+  const fVec b_zp_vec(static_cast<float>(b_zero_point));
+  const fVec b_premul_vec = b_scale_vec * b_zp_vec.neg();
+  cpu_kernel_vec(
+      iter,
+      [=](scalar_t qa, scalar_t qb) -> scalar_t {
+        const float a = at::native::dequantize_val(a_scale, a_zero_point, qa);
+        const float b = at::native::dequantize_val(b_scale, b_zero_point, qb);
+        return at::native::quantize_val<scalar_t>(
+            output_scale, output_zero_point, op(a, b));
+      },
+      [=](qVec qa, qVec qb) -> qVec {
+        auto as = qa.dequantize(a_scale_vec, a_zp_vec, a_premul_vec);
+        auto bs = qb.dequantize(b_scale_vec, b_zp_vec, b_premul_vec);
+        for (const auto i : c10::irange(as.size())) {
+          as[i] = vop(as[i], bs[i]);
+        }
+        return qVec::quantize(as, o_scale, output_zero_point, o_inv_scale);
+      });
+}
+
+} // namespace at::native
@@ -12,6 +12,7 @@
 #include <ATen/native/quantized/AffineQuantizer.h>
 #include <ATen/native/quantized/FakeQuantAffine.h>
 #include <ATen/native/quantized/IndexKernel.h>
+#include <ATen/native/quantized/cpu/QuantizedFusedElementwise.h>
 #include <ATen/native/quantized/cpu/QuantizedOps.h>
 #include <ATen/native/cpu/utils.h>
 #include <c10/util/irange.h>
@@ -617,45 +618,36 @@ static void leaky_qrelu_out_kernel(Tensor& out, const Tensor& qx,
   int64_t o_zp = out.q_zero_point();
   // NOLINTNEXTLINE(bugprone-narrowing-conversions,cppcoreguidelines-narrowing-conversions)
   float o_scale = out.q_scale();
-  float o_inv_scale = 1.0f / o_scale;
 
   float negval = negval_.to<float>();
 
   AT_DISPATCH_QINT_TYPES(out.scalar_type(), "leaky_qrelu", [&] {
     using Vec = Vectorized<float>;  // Naive implementation uses dequant/quant loop.
-    using qVec = Vectorized<scalar_t>;
     Vec zero_vec = Vec(0.0f);
     Vec one_vec = Vec(1.0f);
 
-    Vec i_scale_vec = Vec((float)i_scale);
-    Vec i_zp_vec = Vec((float)i_zp);
-    Vec i_scale_zp_neg_premul_vec = i_scale_vec * i_zp_vec.neg();
-
     Vec negval_vec = Vec(negval);
 
     auto iter = TensorIterator::unary_op(out, qx);
 
-    cpu_kernel_vec(
+    qfused_unary_kernel<scalar_t>(
         iter,
-        [&](scalar_t value_qx) -> scalar_t {
-          auto value_dx = at::native::dequantize_val(i_scale, i_zp, value_qx);
-          auto value_dy = value_dx > 0 ? value_dx : value_dx * negval;
-          return at::native::quantize_val<scalar_t>(o_scale, o_zp, value_dy);
+        i_scale,
+        i_zp,
+        o_scale,
+        o_zp,
+        [=](float value_dx) -> float {
+          return value_dx > 0 ? value_dx : value_dx * negval;
         },
-        [&](qVec qx_vec) -> qVec {
+        [=](Vec dx_vec) -> Vec {
           /* Vectorized implementation creates a multiplicand vector, which has
            * "alpha" for all negative dx values and ones-vector for all
            * positive values of dx. The multiplicand then is multiplied by the
            * input.
            */
-          auto dx_vec_vec = qx_vec.dequantize(i_scale_vec, i_zp_vec,
-                                              i_scale_zp_neg_premul_vec);
-          for (auto & dx_vec : dx_vec_vec) {
-            const auto multiplicand = Vec::blendv(negval_vec, one_vec,
-                                                  dx_vec > zero_vec);
-            dx_vec *= multiplicand;
-          }
-          return qVec::quantize(dx_vec_vec, o_scale, o_zp, o_inv_scale);
+          const auto multiplicand = Vec::blendv(negval_vec, one_vec,
+                                                dx_vec > zero_vec);
+          return dx_vec * multiplicand;
         });
   });
 }
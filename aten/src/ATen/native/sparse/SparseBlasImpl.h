@@ -27,6 +27,18 @@ void addmv_out_sparse_csr(
     const Scalar& alpha,
     const Tensor& result);
 
+bool can_use_blocked_spmm_csr(
+    const Tensor& mat,
+    const Tensor& dense,
+    const Tensor& result);
+
+void addmm_out_blocked_spmm_csr(
+    const Tensor& mat,
+    const Tensor& dense,
+    const Scalar& beta,
+    const Scalar& alpha,
+    const Tensor& result);
+
 void add_out_sparse_csr(
     const Tensor& mat1,
     const Tensor& mat2,
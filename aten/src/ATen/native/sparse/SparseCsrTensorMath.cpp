@@ -648,6 +648,14 @@ Tensor& addmm_out_sparse_compressed_cpu(
     return result;
   }
 
+  // Sufficiently sparse CSR @ strided -> strided goes through the blocked
+  // native kernel regardless of MKL availability.
+  if (sparse::impl::cpu::can_use_blocked_spmm_csr(mat1, mat2, result)) {
+    sparse::impl::cpu::addmm_out_blocked_spmm_csr(
+        mat1, mat2, beta, alpha, result);
+    return result;
+  }
+
 #if !AT_USE_MKL_SPARSE()
   // The custom impl addmm_out_sparse_csr_native_cpu only supports CSR @
   // strided -> strided
@@ -0,0 +1,336 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/Dispatch.h>
+#include <ATen/OpMathType.h>
+#include <ATen/Parallel.h>
+#include <ATen/core/Tensor.h>
+#include <ATen/cpu/vec/vec.h>
+#include <c10/util/irange.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_sparse_semi_structured_addmm_native.h>
+#include <ATen/ops/_sparse_semi_structured_linear_native.h>
+#include <ATen/ops/_sparse_semi_structured_mm_native.h>
+#include <ATen/ops/_to_sparse_semi_structured_native.h>
+#include <ATen/ops/empty.h>
+#include <ATen/ops/relu_.h>
+#include <ATen/ops/silu_.h>
+#endif
+
+#include <algorithm>
+
+// CPU kernels for 2:4 semi-structured sparsity.
+//
+// The packed representation mirrors the CUDA one at the op level: a dense
+// (m, k) matrix where every group of four consecutive elements along a row
+// has at most two nonzeros is stored as a (m, k/2) values matrix holding the
+// two kept elements per group, plus an opaque metadata matrix recording
+// which positions were kept. The metadata layout, however, is CPU-specific
+// and deliberately simple: one uint8 per two groups, where each nibble holds
+// the two kept in-group positions as a pair of 2-bit indices
+// (lo = first position, hi = second position, always ascending). It is not
+// interchangeable with the CUTLASS/cuSPARSELt metadata produced by the CUDA
+// path; metadata is only ever consumed by the backend that produced it.
+
+namespace at::native {
+
+namespace {
+
+constexpr int64_t kSparseSemiStructuredGroupSize = 4;
+// Two groups are encoded per metadata byte.
+constexpr int64_t kDenseElemsPerMetaByte = 8;
+
+// Computes result <- alpha * (mat1 @ mat2) where mat1 is given in the packed
+// 2:4 representation described above and mat2 is a row-major (k, n) matrix.
+// Output columns are walked in register-sized tiles so every kept element is
+// applied with vectorized FMAs over a contiguous slice of a dense row;
+// accumulation happens in opmath precision (fp32 for half/bfloat16 inputs).
+template <typename scalar_t>
+void semi_structured_mm_kernel(
+    const scalar_t* values,
+    const uint8_t* meta,
+    const int64_t mat1_rows,
+    const int64_t dense_rows,
+    const int64_t dense_cols,
+    const scalar_t* dense,
+    const at::opmath_type<scalar_t> alpha,
+    scalar_t* result) {
+  using opmath_t = at::opmath_type<scalar_t>;
+  using Vec = at::vec::Vectorized<opmath_t>;
+  constexpr int64_t kColTile = 4 * Vec::size();
+
+  const int64_t num_groups = dense_rows / kSparseSemiStructuredGroupSize;
+  const int64_t meta_cols = dense_rows / kDenseElemsPerMetaByte;
+
+  at::parallel_for(0, mat1_rows, 0, [&](int64_t rstart, int64_t rend) {
+    for (const auto row : c10::irange(rstart, rend)) {
+      const scalar_t* values_row = values + row * (dense_rows / 2);
+      const uint8_t* meta_row = meta + row * meta_cols;
+      for (int64_t col_start = 0; col_start < dense_cols;
+           col_start += kColTile) {
+        const int64_t tile = std::min(kColTile, dense_cols - col_start);
+        opmath_t acc[kColTile];
+        std::fill(acc, acc + tile, opmath_t(0));
+        for (const auto group : c10::irange(num_groups)) {
+          const uint8_t nibble =
+              (meta_row[group >> 1] >> ((group & 1) << 2)) & 0xF;
+          const int64_t col0 =
+              group * kSparseSemiStructuredGroupSize + (nibble & 0x3);
+          const int64_t col1 =
+              group * kSparseSemiStructuredGroupSize + ((nibble >> 2) & 0x3);
+          const opmath_t val0 = static_cast<opmath_t>(values_row[2 * group]);
+          const opmath_t val1 =
+              static_cast<opmath_t>(values_row[2 * group + 1]);
+          const scalar_t* dense_row0 = dense + col0 * dense_cols + col_start;
+          const scalar_t* dense_row1 = dense + col1 * dense_cols + col_start;
+          if constexpr (std::is_same_v<scalar_t, opmath_t>) {
+            const Vec val0_vec(val0);
+            const Vec val1_vec(val1);
+            int64_t c = 0;
+            for (; c + Vec::size() <= tile; c += Vec::size()) {
+              auto acc_vec = Vec::loadu(acc + c);
+              acc_vec = at::vec::fmadd(Vec::loadu(dense_row0 + c), val0_vec,
+                                       acc_vec);
+              acc_vec = at::vec::fmadd(Vec::loadu(dense_row1 + c), val1_vec,
+                                       acc_vec);
+              acc_vec.store(acc + c);
+            }
+            for (; c < tile; ++c) {
+              acc[c] += val0 * dense_row0[c] + val1 * dense_row1[c];
+            }
+          } else {
+            // Reduced-precision inputs accumulate in fp32; the op is
+            // memory-bound so the scalar conversions are not on the
+            // critical path.
+            for (const auto c : c10::irange(tile)) {
+              acc[c] += val0 * static_cast<opmath_t>(dense_row0[c]) +
+                  val1 * static_cast<opmath_t>(dense_row1[c]);
+            }
+          }
+        }
+        scalar_t* result_row = result + row * dense_cols + col_start;
+        for (const auto c : c10::irange(tile)) {
+          result_row[c] = static_cast<scalar_t>(acc[c] * alpha);
+        }
+      }
+    }
+  });
+}
+
+// Shared argument validation plus kernel dispatch for the mm/addmm/linear
+// entry points; returns alpha * (mat1 @ mat2).
+Tensor sparse_semi_structured_mm_cpu_impl(
+    const Tensor& mat1,
+    const Tensor& mat1_meta,
+    const Tensor& mat2,
+    const Scalar& alpha,
+    const std::optional<c10::ScalarType> out_dtype_opt,
+    const char* name) {
+  TORCH_CHECK(mat1.dim() == 2 && mat1_meta.dim() == 2 && mat2.dim() == 2,
+              name, ": Expected all arguments to be 2D tensors");
+  TORCH_CHECK(mat1.dtype() == at::kHalf || mat1.dtype() == at::kBFloat16 ||
+              mat1.dtype() == at::kFloat,
+              name, ": The mat1 datatype ", mat1.dtype(),
+              " is not supported on CPU");
+  TORCH_CHECK(mat2.dtype() == mat1.dtype(),
+              name, ": Expected mat1 and mat2 datatypes to match, but got ",
+              mat1.dtype(), " and ", mat2.dtype());
+  TORCH_CHECK(mat1_meta.dtype() == at::kByte,
+              name, ": Expected mat1_meta datatype ", at::kByte, ", but got ",
+              mat1_meta.dtype());
+  TORCH_CHECK(!out_dtype_opt.has_value(),
+              name, ": Setting out_dtype is only supported for int8 input, "
+              "which the CPU kernel does not implement");
+
+  const auto k = 2 * mat1.size(1);
+  TORCH_CHECK(mat2.size(0) == k,
+              name, ": Expected mat2 argument to have ", k, " rows, but got ",
+              mat2.size(0));
+  TORCH_CHECK(k % kDenseElemsPerMetaByte == 0,
+              name, ": Expected number of columns of the sparse operand to "
+              "be divisible by ", kDenseElemsPerMetaByte, ", but it is ", k);
+  TORCH_CHECK(mat1_meta.size(0) == mat1.size(0) &&
+              mat1_meta.size(1) == k / kDenseElemsPerMetaByte,
+              name, ": Expected mat1_meta argument to have size (",
+              mat1.size(0), ", ", k / kDenseElemsPerMetaByte, "), but got (",
+              mat1_meta.size(0), ", ", mat1_meta.size(1), ")");
+
+  const auto values = mat1.contiguous();
+  const auto meta = mat1_meta.contiguous();
+  const auto dense = mat2.contiguous();
+  auto result = at::empty({mat1.size(0), mat2.size(1)}, mat2.options());
+  if (result.numel() != 0) {
+    AT_DISPATCH_FLOATING_TYPES_AND2(
+        at::kHalf, at::kBFloat16, result.scalar_type(),
+        "sparse_semi_structured_mm_cpu", [&] {
+          semi_structured_mm_kernel<scalar_t>(
+              values.const_data_ptr<scalar_t>(),
+              meta.const_data_ptr<uint8_t>(),
+              mat1.size(0),
+              k,
+              mat2.size(1),
+              dense.const_data_ptr<scalar_t>(),
+              alpha.to<at::opmath_type<scalar_t>>(),
+              result.data_ptr<scalar_t>());
+        });
+  }
+  return result;
+}
+
+} // anonymous namespace
+
+Tensor _sparse_semi_structured_mm_cpu(
+    const Tensor& mat1,
+    const Tensor& mat1_meta,
+    const Tensor& mat2,
+    const std::optional<c10::ScalarType> out_dtype_opt) {
+  return sparse_semi_structured_mm_cpu_impl(
+      mat1, mat1_meta, mat2, 1, out_dtype_opt, "_sparse_semi_structured_mm");
+}
+
+Tensor _sparse_semi_structured_addmm_cpu(
+    const Tensor& input,
+    const Tensor& mat1,
+    const Tensor& mat1_meta,
+    const Tensor& mat2,
+    const Scalar& alpha,
+    const Scalar& beta,
+    const std::optional<c10::ScalarType> out_dtype_opt) {
+  TORCH_CHECK(input.dim() == 1,
+              "_sparse_semi_structured_addmm: Expected input argument to be "
+              "1D tensor, got ", input.dim(), " dims");
+  TORCH_CHECK(input.size(0) == mat1.size(0),
+              "_sparse_semi_structured_addmm: Expected input argument to "
+              "have ", mat1.size(0), " elements, but got ", input.size(0));
+  auto result = sparse_semi_structured_mm_cpu_impl(
+      mat1, mat1_meta, mat2, alpha, out_dtype_opt,
+      "_sparse_semi_structured_addmm");
+  if (beta.toComplexDouble() != 0.) {
+    // As on CUDA, input is broadcast along the columns of the result.
+    result.add_(input.unsqueeze(-1), beta);
+  }
+  return result;
+}
+
+Tensor _sparse_semi_structured_linear_cpu(
+    const Tensor& input,
+    const Tensor& weight,
+    const Tensor& meta,
+    const std::optional<Tensor>& bias_opt,
+    const std::optional<c10::string_view> activation_opt,
+    const std::optional<c10::ScalarType> out_dtype_opt) {
+  TORCH_WARN_ONCE("_sparse_semi_structured_linear is deprecated and will be "
+                  "removed in a future PyTorch release.  Please use "
+                  "_sparse_semi_structured_mm/_sparse_semi_structured_addmm "
+                  "instead.");
+  const auto input_sizes = input.sizes().vec();
+  // The sparse weight is (m, k) logical; the kernel multiplies it with a
+  // row-major (k, n) dense operand, so the squashed input batch goes in
+  // transposed and the output comes out transposed.
+  const auto input_2d_t =
+      input.reshape({-1, input_sizes.back()}).t().contiguous();
+  auto output_t = sparse_semi_structured_mm_cpu_impl(
+      weight, meta, input_2d_t, 1, out_dtype_opt,
+      "_sparse_semi_structured_linear");
+  auto output = output_t.t().contiguous();
+  if (bias_opt.has_value() && bias_opt->defined()) {
+    TORCH_CHECK(bias_opt->dim() == 1,
+                "_sparse_semi_structured_linear: Expected bias argument to "
+                "be 1D tensor, got ", bias_opt->dim(), " dims");
+    output.add_(*bias_opt);
+  }
+  const auto activation =
+      activation_opt.has_value() ? *activation_opt : "none";
+  if (activation == "relu") {
+    output.relu_();
+  } else if (activation == "silu") {
+    output.silu_();
+  } else {
+    TORCH_CHECK(activation == "none" || activation.empty(),
+                "_sparse_semi_structured_linear: Activation \"", activation,
+                "\" is not supported");
+  }
+  auto output_sizes = input_sizes;
+  output_sizes.back() = weight.size(0);
+  return output.reshape(output_sizes);
+}
+
+std::tuple<Tensor, Tensor> _to_sparse_semi_structured_cpu(
+    const Tensor& dense) {
+  TORCH_CHECK(dense.dim() == 2,
+              "_to_sparse_semi_structured: Expected dense argument to be 2D "
+              "tensor, got ", dense.dim(), " dims");
+  TORCH_CHECK(dense.dtype() == at::kHalf || dense.dtype() == at::kBFloat16 ||
+              dense.dtype() == at::kFloat,
+              "_to_sparse_semi_structured: Invalid dense argument datatype ",
+              dense.dtype(), " encountered");
+  TORCH_CHECK(dense.size(1) % kDenseElemsPerMetaByte == 0,
+              "_to_sparse_semi_structured: Number of columns of dense matrix "
+              "must be divisible by ", kDenseElemsPerMetaByte, ", but it is ",
+              dense.size(1));
+
+  const auto nrows = dense.size(0);
+  const auto ncols = dense.size(1);
+  const auto num_groups = ncols / kSparseSemiStructuredGroupSize;
+  const auto dense_cont = dense.contiguous();
+  auto values = at::empty({nrows, ncols / 2}, dense.options());
+  auto meta = at::empty({nrows, ncols / kDenseElemsPerMetaByte},
+                        dense.options().dtype(at::kByte));
+
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+      at::kHalf, at::kBFloat16, dense.scalar_type(),
+      "_to_sparse_semi_structured_cpu", [&] {
+        const scalar_t* dense_ptr = dense_cont.const_data_ptr<scalar_t>();
+        scalar_t* values_ptr = values.data_ptr<scalar_t>();
+        uint8_t* meta_ptr = meta.data_ptr<uint8_t>();
+        at::parallel_for(0, nrows, 0, [&](int64_t rstart, int64_t rend) {
+          for (const auto row : c10::irange(rstart, rend)) {
+            const scalar_t* dense_row = dense_ptr + row * ncols;
+            scalar_t* values_row = values_ptr + row * (ncols / 2);
+            uint8_t* meta_row =
+                meta_ptr + row * (ncols / kDenseElemsPerMetaByte);
+            for (const auto group : c10::irange(num_groups)) {
+              const scalar_t* group_ptr =
+                  dense_row + group * kSparseSemiStructuredGroupSize;
+              int64_t kept[2];
+              int64_t num_kept = 0;
+              for (const auto j :
+                   c10::irange(kSparseSemiStructuredGroupSize)) {
+                if (group_ptr[j] != scalar_t(0)) {
+                  TORCH_CHECK(num_kept < 2,
+                              "_to_sparse_semi_structured: dense argument "
+                              "does not match 2:4 sparsity pattern");
+                  kept[num_kept++] = j;
+                }
+              }
+              // Groups with fewer than two nonzeros are padded with explicit
+              // zeros from the lowest free positions; unlike the CUDA
+              // converter this accepts e.g. all-zero groups.
+              for (int64_t j = 0; num_kept < 2; ++j) {
+                if (num_kept == 0 || kept[0] != j) {
+                  kept[num_kept++] = j;
+                }
+              }
+              if (kept[0] > kept[1]) {
+                std::swap(kept[0], kept[1]);
+              }
+              values_row[2 * group] = group_ptr[kept[0]];
+              values_row[2 * group + 1] = group_ptr[kept[1]];
+              const uint8_t nibble =
+                  static_cast<uint8_t>(kept[0] | (kept[1] << 2));
+              if ((group & 1) == 0) {
+                meta_row[group >> 1] = nibble;
+              } else {
+                meta_row[group >> 1] |= nibble << 4;
+              }
+            }
+          }
+        });
+      });
+
+  return std::make_tuple(values, meta);
+}
+
+} // namespace at::native
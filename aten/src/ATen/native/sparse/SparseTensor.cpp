@@ -16,6 +16,7 @@
 
 #include <ATen/native/Copy.h>
 #include <ATen/native/CPUBlas.h>
+#include <c10/core/GradMode.h>
 #include <c10/util/irange.h>
 
 #ifndef AT_PER_OPERATOR_HEADERS
@@ -612,13 +613,35 @@ SparseTensor& copy_sparse_(
   return self._coalesced_(src.is_coalesced());
 }
 
+// NOTE [ coalesce cache ]
+// coalesce() is pure with respect to the version counter: as long as neither
+// the input nor a previously computed result has been modified in place, the
+// result of the last call can be returned directly. This makes repeated
+// products with a structure-static sparse tensor (a fixed adjacency matrix
+// multiplied every training step, say) coalesce exactly once. The cache is
+// bypassed when grad is required so that every differentiable coalesce
+// records its own _coalesce node (see NOTE: [ coalesce autograd ]), and for
+// inference tensors, which do not track versions at all.
 SparseTensor coalesce(const SparseTensor& self) {
   TORCH_CHECK(self.layout() == kSparse, "coalesce expected sparse coordinate tensor layout but got ", self.layout());
   // See NOTE: [ coalesce autograd ]
   if (self.is_coalesced()) {
     return self;
   }
-  return at::_coalesce(self);
+  const auto& version_counter = self.unsafeGetTensorImpl()->version_counter();
+  if (!version_counter.enabled() ||
+      (c10::GradMode::is_enabled() && self.requires_grad())) {
+    return at::_coalesce(self);
+  }
+  auto* self_impl = get_sparse_impl(self);
+  const auto self_version = version_counter.current_version();
+  auto cached = self_impl->cached_coalesced(self_version);
+  if (cached.defined()) {
+    return cached;
+  }
+  auto result = at::_coalesce(self);
+  self_impl->set_cached_coalesced(result, self_version);
+  return result;
 }
 
 SparseTensor _coalesce_sparse_cpu(const SparseTensor& self) {
@@ -436,6 +436,27 @@ Tensor& sub_out_sparse(const Tensor& self, const Tensor& other, const Scalar& al
 }
 
 
+static SparseTensor& add_out_sparse_same_pattern(SparseTensor& r, const SparseTensor& t, const SparseTensor& src, const Scalar& value, ScalarType commonDtype) {
+    // Both operands are coalesced and share one index set, which is what
+    // repeated accumulation into a static sparsity pattern produces. The
+    // merged result then has exactly the operands' indices, so the
+    // two-pointer merge degenerates to an elementwise combine of the values
+    // (which vectorizes through the dense add kernel). If `r` aliases `t`
+    // (the in-place add_) the values are accumulated directly into the
+    // existing buffers with no allocation at all.
+    if (is_same_tensor(r, t) && r.scalar_type() == commonDtype) {
+      r._values().add_(src._values().to(commonDtype), value);
+      return r._coalesced_(true);
+    }
+    Tensor r_values = t._values().to(commonDtype).add(src._values().to(commonDtype), value);
+    if (r.scalar_type() != commonDtype) {
+      r_values = r_values.to(r.scalar_type());
+    }
+    get_sparse_impl(r)->set_indices_and_values_unsafe(t._indices().clone(), r_values);
+    get_sparse_impl(r)->set_nnz_and_narrow(t._nnz());
+    return r._coalesced_(true);
+}
+
 static SparseTensor& add_out_sparse_contiguous(SparseTensor& r, const SparseTensor& t, const SparseTensor& src, const Scalar& value, ScalarType commonDtype) {
     // saving those because they can be overwritten when doing in-place operations
     int64_t t_nnz = t._nnz(), s_nnz = src._nnz(), max_nnz = t_nnz + s_nnz;
@@ -581,6 +602,9 @@ SparseTensor& add_out_sparse_cpu(const SparseTensor& t, const SparseTensor& src,
   r.resize_as_(src);
   if (r.is_meta()) {
     return r;
+  } else if (t.is_coalesced() && src.is_coalesced() && t._nnz() == src._nnz() &&
+      t._indices().equal(src._indices())) {
+    return add_out_sparse_same_pattern(r, t, src, value, commonDtype);
   } else if (src._values().is_contiguous() && t._values().is_contiguous()) {
     return add_out_sparse_contiguous(r, t, src, value, commonDtype);
   } else {
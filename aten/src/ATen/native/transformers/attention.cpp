@@ -512,10 +512,12 @@ inline void validate_sdpa_input(
     TORCH_CHECK(mask_dtype == at::kBool || mask_dtype == at::kFloat || mask_dtype == query_.dtype(),
       "Expected attn_mask dtype to be bool or float or to match query dtype, but got attn_mask.dtype: ",
       mask_dtype, " and  query.dtype: ", query_.dtype(), " instead.");
+    // Nested query/key with a dense attn_mask can be handled by the memory
+    // efficient kernel (the varlen kernel indexes the mask per batch entry);
+    // a ragged mask cannot be expressed there or in the math fallback.
     TORCH_CHECK(
-      !query_.is_nested() && !key.is_nested(),
-      "Scaled_dot_product_attention: Nested tensors for query / key are not supported "
-      "when an explicit attn_mask is set");
+      !attn_mask_->is_nested(),
+      "Scaled_dot_product_attention: Nested tensors for attn_mask are not supported");
   }
   return;
 }
@@ -745,7 +747,9 @@ Tensor scaled_dot_product_attention(
     case sdp::SDPBackend::efficient_attention: {
       std::optional<Tensor> attn_mask = convert_boolean_attn_mask(attn_mask_, query_.dtype());
       bool compute_logsumexp = should_compute_logsumexp(query_, key, value);
-      if (attn_mask.has_value()) {
+      if (attn_mask.has_value() && !query_.is_nested()) {
+        // For nested inputs the mask is expanded against the max sequence
+        // lengths inside the nested kernel wrapper instead.
         attn_mask.value() = preprocess_mask(attn_mask.value(), query_, key, value);;
       }
       auto out_and_lse = at::_scaled_dot_product_efficient_attention(
@@ -803,6 +807,12 @@ std::tuple<Tensor, Tensor> _scaled_dot_product_attention_math(
         query_.is_contiguous() && key.is_contiguous() &&
             value.is_contiguous(),
         "scaled_dot_product_attention: If inputs are nested tensors they must be contiguous");
+    TORCH_CHECK(
+        !attn_mask_.has_value(),
+        "scaled_dot_product_attention: Nested tensors with an explicit attn_mask are only "
+        "supported by the memory efficient kernel, which was not eligible for these inputs; "
+        "check torch.backends.cuda warnings with torch.backends.cuda.enable_mem_efficient_sdp "
+        "and sdp_kernel debug mode for the reason");
   }
   auto& ctx = at::globalContext();
   auto origin_dtype = query_.scalar_type();
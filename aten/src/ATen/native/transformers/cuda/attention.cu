@@ -1005,6 +1005,83 @@ _flash_attention_forward(
       Tensor());
 }
 
+std::tuple<Tensor, Tensor> _paged_attention_forward(
+    const Tensor& query,
+    const Tensor& key_cache,
+    const Tensor& value_cache,
+    const Tensor& block_table,
+    const Tensor& cum_seq_q,
+    const Tensor& cum_seq_k,
+    int64_t max_seqlen_batch_q,
+    int64_t max_seqlen_batch_k,
+    bool is_causal,
+    std::optional<double> scale,
+    const std::optional<Tensor>& seqused_k) {
+#if defined(USE_FLASH_ATTENTION)
+  // Queries are packed like the varlen flash path; keys and values live in a
+  // global pool of fixed-size pages that block_table maps onto per sequence,
+  // so cache memory scales with the tokens actually resident rather than the
+  // worst-case sequence length. The flash kernel validates dtypes, head
+  // sizes, the page size and the block table layout itself.
+  TORCH_CHECK(
+      query.dim() == 3,
+      "_paged_attention_forward: Expected query of shape (total_q, num_heads, head_dim), got ",
+      query.sizes());
+  TORCH_CHECK(
+      key_cache.dim() == 4 && value_cache.dim() == 4,
+      "_paged_attention_forward: Expected key_cache and value_cache of shape ",
+      "(num_blocks, page_block_size, num_heads_k, head_dim), got ",
+      key_cache.sizes(), " and ", value_cache.sizes());
+  TORCH_CHECK(
+      block_table.dim() == 2,
+      "_paged_attention_forward: Expected block_table of shape ",
+      "(batch_size, max_num_blocks_per_seq), got ", block_table.sizes());
+
+  const auto softmax_scale =
+      sdp::calculate_scale(query, scale).as_float_unchecked();
+  std::optional<Tensor> out = std::nullopt;
+  std::optional<Tensor> paged_block_table = block_table;
+  std::optional<Tensor> seqused = seqused_k;
+  std::optional<Tensor> alibi_slopes = std::nullopt;
+
+  Tensor output, q_padded, k_padded, v_padded, logsumexp,
+      philox_seed, philox_offset, debug_attn_mask;
+  std::tie(
+      output,
+      q_padded,
+      k_padded,
+      v_padded,
+      logsumexp,
+      philox_seed,
+      philox_offset,
+      debug_attn_mask) =
+      pytorch_flash::mha_varlen_fwd(
+          query,
+          key_cache,
+          value_cache,
+          out,
+          cum_seq_q,
+          cum_seq_k,
+          seqused, /*seqused_k*/
+          paged_block_table, /*block_table*/
+          alibi_slopes, /*alibi_slopes*/
+          max_seqlen_batch_q,
+          max_seqlen_batch_k,
+          0.0 /*p_dropout*/,
+          softmax_scale,
+          false /*zero_tensors*/,
+          is_causal,
+          -1 /*window_size_left*/,
+          -1 /*window_size_right*/,
+          false /*return_softmax*/,
+          std::nullopt /*gen_*/);
+  return std::make_tuple(std::move(output), std::move(logsumexp));
+
+#endif
+  TORCH_CHECK(false, "USE_FLASH_ATTENTION was not enabled for build.")
+  return std::make_tuple(Tensor(), Tensor());
+}
+
 std::tuple<Tensor, Tensor, Tensor, Tensor, c10::SymInt, c10::SymInt> _efficient_attention_forward(
     const at::Tensor& query, // [b, seqlen, num_heads, K]
     const at::Tensor& key, // [b, seqlen, num_heads, K]
@@ -1314,18 +1391,37 @@ std::tuple<Tensor, Tensor, Tensor, Tensor, c10::SymInt, c10::SymInt> _efficient_
       p.attn_bias_ptr = (const scalar_t*)bias->const_data_ptr();
 
       TORCH_CHECK(bias->dim() == 4, "Bias expected in BMHK format");
-      TORCH_CHECK(
-          bias->size(0) == query.size(0),
-          "attn_bias: wrong shape (batch dimension)");
-      TORCH_CHECK(
-          bias->size(1) == query.size(2),
-          "attn_bias: wrong shape (head dimension)");
-      TORCH_CHECK(
-          bias->size(2) == query.size(1),
-          "attn_bias: wrong shape (seqlenQ dimension)");
-      TORCH_CHECK(
-          bias->size(3) == key.size(1),
-          "attn_bias: wrong shape (seqlenKV dimension)");
+      if (seqstart_q.has_value()) {
+        // Varlen: the kernel advances the bias pointer by the logical batch
+        // index and reads each batch's [seqlen_q, seqlen_kv] window from the
+        // top-left corner, so the bias is shaped against the number of
+        // batches and the max sequence lengths.
+        TORCH_CHECK(
+            bias->size(0) == seqstart_q->size(0) - 1,
+            "attn_bias: wrong shape (batch dimension)");
+        TORCH_CHECK(
+            bias->size(1) == query.size(2),
+            "attn_bias: wrong shape (head dimension)");
+        TORCH_CHECK(
+            bias->size(2) >= max_seqlen_q,
+            "attn_bias: wrong shape (seqlenQ dimension)");
+        TORCH_CHECK(
+            !max_seqlen_k_.has_value() || bias->size(3) >= *max_seqlen_k_,
+            "attn_bias: wrong shape (seqlenKV dimension)");
+      } else {
+        TORCH_CHECK(
+            bias->size(0) == query.size(0),
+            "attn_bias: wrong shape (batch dimension)");
+        TORCH_CHECK(
+            bias->size(1) == query.size(2),
+            "attn_bias: wrong shape (head dimension)");
+        TORCH_CHECK(
+            bias->size(2) == query.size(1),
+            "attn_bias: wrong shape (seqlenQ dimension)");
+        TORCH_CHECK(
+            bias->size(3) == key.size(1),
+            "attn_bias: wrong shape (seqlenKV dimension)");
+      }
       ASSIGN_CHECK_OVERFLOW(p.bias_strideB, bias->stride(0));
       ASSIGN_CHECK_OVERFLOW(p.bias_strideH, bias->stride(1));
       ASSIGN_CHECK_OVERFLOW(p.bias_strideM, bias->stride(2));
@@ -0,0 +1,331 @@
+#define TORCH_ASSERT_ONLY_METHOD_OPERATORS
+#include <ATen/core/Tensor.h>
+#include <ATen/Dispatch.h>
+#include <ATen/cuda/CUDAContext.h>
+#include <ATen/native/cuda/block_reduce.cuh>
+#include <c10/util/Float8_e4m3fn.h>
+
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#include <ATen/NativeFunctions.h>
+#else
+#include <ATen/ops/_dequantize_cached_kv_native.h>
+#include <ATen/ops/_rope_and_cache_quant__native.h>
+#include <ATen/ops/empty.h>
+#endif
+
+namespace at::native {
+
+namespace {
+
+// Quantized KV cache writes and reads for long-context inference. The cache
+// holds int8 or fp8 (e4m3) values with one float scale per (batch, head,
+// position) row; a row's scale is its absmax divided by the largest
+// representable quantized value, so dequantization is a single multiply.
+
+constexpr int kCacheQuantBlockSize = 128;
+
+template <typename cache_t>
+__device__ __forceinline__ cache_t quantize_element(float v);
+
+template <>
+__device__ __forceinline__ int8_t quantize_element<int8_t>(float v) {
+  return static_cast<int8_t>(nearbyintf(fminf(fmaxf(v, -127.0f), 127.0f)));
+}
+
+template <>
+__device__ __forceinline__ c10::Float8_e4m3fn quantize_element<c10::Float8_e4m3fn>(float v) {
+  return static_cast<c10::Float8_e4m3fn>(v);
+}
+
+// One block per (batch, head, new position) row; blockIdx.y selects K or V.
+// The key gets the rotate-half rotary embedding applied on the way in (cos
+// and sin hold one row of head_dim / 2 entries per appended position); the
+// value is only quantized. Each row is reduced to its absmax, quantized and
+// appended to the cache starting at position pos, in a single pass over the
+// inputs.
+template <typename scalar_t, typename cache_t>
+__global__ void rope_and_cache_quant_kernel(
+    const scalar_t* key,
+    const scalar_t* value,
+    const scalar_t* cos,
+    const scalar_t* sin,
+    cache_t* k_cache,
+    cache_t* v_cache,
+    float* k_scales,
+    float* v_scales,
+    int seq_len,
+    int head_dim,
+    int cache_seq_len,
+    int pos,
+    float qmax) {
+  const int row = blockIdx.x;
+  const int s = row % seq_len;
+  const int bh = row / seq_len;
+  const bool is_value = blockIdx.y == 1;
+
+  const scalar_t* src = (is_value ? value : key) + static_cast<int64_t>(row) * head_dim;
+  cache_t* cache = (is_value ? v_cache : k_cache) +
+      (static_cast<int64_t>(bh) * cache_seq_len + pos + s) * head_dim;
+  float* scales = is_value ? v_scales : k_scales;
+
+  extern __shared__ float smem[];
+  float* vals = smem; // head_dim floats
+  float* reduce_smem = smem + head_dim; // one float per warp
+  __shared__ float inv_scale_shared;
+
+  const int half = head_dim / 2;
+  float thread_max = 0.0f;
+  for (int d = threadIdx.x; d < half; d += blockDim.x) {
+    float x0 = static_cast<float>(src[d]);
+    float x1 = static_cast<float>(src[d + half]);
+    float out0 = x0;
+    float out1 = x1;
+    if (!is_value) {
+      float c = static_cast<float>(cos[static_cast<int64_t>(s) * half + d]);
+      float sn = static_cast<float>(sin[static_cast<int64_t>(s) * half + d]);
+      out0 = x0 * c - x1 * sn;
+      out1 = x1 * c + x0 * sn;
+    }
+    vals[d] = out0;
+    vals[d + half] = out1;
+    thread_max = fmaxf(thread_max, fmaxf(fabsf(out0), fabsf(out1)));
+  }
+
+  float row_max = cuda_utils::BlockReduceMax<float>(thread_max, reduce_smem);
+  if (threadIdx.x == 0) {
+    // An all-zero row gets scale 0 so it dequantizes back to zeros.
+    scales[static_cast<int64_t>(bh) * cache_seq_len + pos + s] =
+        row_max > 0.0f ? row_max / qmax : 0.0f;
+    inv_scale_shared = row_max > 0.0f ? qmax / row_max : 0.0f;
+  }
+  __syncthreads();
+
+  const float inv_scale = inv_scale_shared;
+  for (int d = threadIdx.x; d < head_dim; d += blockDim.x) {
+    cache[d] = quantize_element<cache_t>(vals[d] * inv_scale);
+  }
+}
+
+// One block per (batch, head, position) row; blockIdx.y selects K or V. Both
+// operands of the attention read are produced in a single launch.
+template <typename scalar_t, typename cache_t>
+__global__ void dequantize_cached_kv_kernel(
+    const cache_t* k_cache,
+    const cache_t* v_cache,
+    const float* k_scales,
+    const float* v_scales,
+    scalar_t* key,
+    scalar_t* value,
+    int seq_len,
+    int head_dim,
+    int cache_seq_len) {
+  const int row = blockIdx.x;
+  const int s = row % seq_len;
+  const int bh = row / seq_len;
+  const bool is_value = blockIdx.y == 1;
+
+  const cache_t* cache = (is_value ? v_cache : k_cache) +
+      (static_cast<int64_t>(bh) * cache_seq_len + s) * head_dim;
+  const float scale =
+      (is_value ? v_scales : k_scales)[static_cast<int64_t>(bh) * cache_seq_len + s];
+  scalar_t* dst = (is_value ? value : key) + static_cast<int64_t>(row) * head_dim;
+
+  for (int d = threadIdx.x; d < head_dim; d += blockDim.x) {
+    dst[d] = static_cast<scalar_t>(static_cast<float>(cache[d]) * scale);
+  }
+}
+
+void check_cache_args(
+    const Tensor& k_cache,
+    const Tensor& v_cache,
+    const Tensor& k_scales,
+    const Tensor& v_scales) {
+  TORCH_CHECK(
+      k_cache.scalar_type() == ScalarType::Char ||
+          k_cache.scalar_type() == ScalarType::Float8_e4m3fn,
+      "KV cache must be int8 or float8_e4m3fn, got ", k_cache.scalar_type());
+  TORCH_CHECK(v_cache.scalar_type() == k_cache.scalar_type(),
+      "K and V caches must have the same dtype");
+  TORCH_CHECK(k_cache.dim() == 4 && v_cache.sizes() == k_cache.sizes(),
+      "K and V caches must both have shape [batch, heads, cache_len, head_dim]");
+  TORCH_CHECK(k_cache.is_contiguous() && v_cache.is_contiguous(),
+      "KV caches must be contiguous");
+  TORCH_CHECK(
+      k_scales.scalar_type() == ScalarType::Float &&
+          v_scales.scalar_type() == ScalarType::Float,
+      "Cache scales must be float tensors");
+  TORCH_CHECK(
+      k_scales.sizes() == k_cache.sizes().slice(0, 3) &&
+          v_scales.sizes() == k_scales.sizes(),
+      "Cache scales must have shape [batch, heads, cache_len]");
+  TORCH_CHECK(k_scales.is_contiguous() && v_scales.is_contiguous(),
+      "Cache scales must be contiguous");
+}
+
+} // namespace
+
+void rope_and_cache_quant_cuda_(
+    const Tensor& key,
+    const Tensor& value,
+    const Tensor& cos,
+    const Tensor& sin,
+    Tensor& k_cache,
+    Tensor& v_cache,
+    Tensor& k_scales,
+    Tensor& v_scales,
+    int64_t pos) {
+  check_cache_args(k_cache, v_cache, k_scales, v_scales);
+  TORCH_CHECK(key.dim() == 4 && value.sizes() == key.sizes(),
+      "key and value must both have shape [batch, heads, seq_len, head_dim]");
+  TORCH_CHECK(key.is_contiguous() && value.is_contiguous(),
+      "key and value must be contiguous");
+  TORCH_CHECK(value.scalar_type() == key.scalar_type(),
+      "key and value must have the same dtype");
+
+  const int64_t batch_size = key.size(0);
+  const int64_t num_heads = key.size(1);
+  const int64_t seq_len = key.size(2);
+  const int64_t head_dim = key.size(3);
+  const int64_t cache_seq_len = k_cache.size(2);
+
+  TORCH_CHECK(head_dim % 2 == 0, "head_dim must be even for rotary embedding");
+  TORCH_CHECK(
+      k_cache.size(0) == batch_size && k_cache.size(1) == num_heads &&
+          k_cache.size(3) == head_dim,
+      "KV cache shape must match key up to the cache length. cache: ",
+      k_cache.sizes(), " key: ", key.sizes());
+  TORCH_CHECK(pos >= 0 && pos + seq_len <= cache_seq_len,
+      "Cache append out of range: pos ", pos, " + seq_len ", seq_len,
+      " exceeds cache length ", cache_seq_len);
+  TORCH_CHECK(
+      cos.scalar_type() == key.scalar_type() && sin.scalar_type() == key.scalar_type(),
+      "cos and sin must have the same dtype as key");
+  TORCH_CHECK(
+      cos.is_contiguous() && sin.is_contiguous() &&
+          cos.sizes() == IntArrayRef({seq_len, head_dim / 2}) && sin.sizes() == cos.sizes(),
+      "cos and sin must be contiguous with shape [seq_len, head_dim / 2]");
+
+  if (key.numel() == 0) {
+    return;
+  }
+
+  const dim3 grid(batch_size * num_heads * seq_len, 2);
+  const dim3 block(kCacheQuantBlockSize);
+  const size_t smem_size =
+      (head_dim + kCacheQuantBlockSize / C10_WARP_SIZE) * sizeof(float);
+  auto stream = at::cuda::getCurrentCUDAStream();
+
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+    ScalarType::Half,
+    ScalarType::BFloat16,
+    key.scalar_type(),
+    "rope_and_cache_quant",
+    [&] {
+      if (k_cache.scalar_type() == ScalarType::Char) {
+        rope_and_cache_quant_kernel<scalar_t, int8_t>
+          <<<grid, block, smem_size, stream>>>(
+            key.const_data_ptr<scalar_t>(),
+            value.const_data_ptr<scalar_t>(),
+            cos.const_data_ptr<scalar_t>(),
+            sin.const_data_ptr<scalar_t>(),
+            k_cache.mutable_data_ptr<int8_t>(),
+            v_cache.mutable_data_ptr<int8_t>(),
+            k_scales.mutable_data_ptr<float>(),
+            v_scales.mutable_data_ptr<float>(),
+            seq_len,
+            head_dim,
+            cache_seq_len,
+            pos,
+            /*qmax=*/127.0f);
+      } else {
+        rope_and_cache_quant_kernel<scalar_t, c10::Float8_e4m3fn>
+          <<<grid, block, smem_size, stream>>>(
+            key.const_data_ptr<scalar_t>(),
+            value.const_data_ptr<scalar_t>(),
+            cos.const_data_ptr<scalar_t>(),
+            sin.const_data_ptr<scalar_t>(),
+            k_cache.mutable_data_ptr<c10::Float8_e4m3fn>(),
+            v_cache.mutable_data_ptr<c10::Float8_e4m3fn>(),
+            k_scales.mutable_data_ptr<float>(),
+            v_scales.mutable_data_ptr<float>(),
+            seq_len,
+            head_dim,
+            cache_seq_len,
+            pos,
+            /*qmax=*/448.0f);
+      }
+      C10_CUDA_KERNEL_LAUNCH_CHECK();
+    });
+}
+
+std::tuple<Tensor, Tensor> dequantize_cached_kv_cuda(
+    const Tensor& k_cache,
+    const Tensor& v_cache,
+    const Tensor& k_scales,
+    const Tensor& v_scales,
+    int64_t length,
+    ScalarType out_dtype) {
+  check_cache_args(k_cache, v_cache, k_scales, v_scales);
+  TORCH_CHECK(
+      out_dtype == ScalarType::Half || out_dtype == ScalarType::BFloat16 ||
+          out_dtype == ScalarType::Float,
+      "Output dtype must be a floating point type, got ", out_dtype);
+
+  const int64_t batch_size = k_cache.size(0);
+  const int64_t num_heads = k_cache.size(1);
+  const int64_t cache_seq_len = k_cache.size(2);
+  const int64_t head_dim = k_cache.size(3);
+  TORCH_CHECK(length >= 0 && length <= cache_seq_len,
+      "Cache read out of range: length ", length,
+      " exceeds cache length ", cache_seq_len);
+
+  auto opts = k_cache.options().dtype(out_dtype);
+  Tensor key = at::empty({batch_size, num_heads, length, head_dim}, opts);
+  Tensor value = at::empty({batch_size, num_heads, length, head_dim}, opts);
+  if (key.numel() == 0) {
+    return std::make_tuple(key, value);
+  }
+
+  const dim3 grid(batch_size * num_heads * length, 2);
+  const dim3 block(kCacheQuantBlockSize);
+  auto stream = at::cuda::getCurrentCUDAStream();
+
+  AT_DISPATCH_FLOATING_TYPES_AND2(
+    ScalarType::Half,
+    ScalarType::BFloat16,
+    out_dtype,
+    "dequantize_cached_kv",
+    [&] {
+      if (k_cache.scalar_type() == ScalarType::Char) {
+        dequantize_cached_kv_kernel<scalar_t, int8_t>
+          <<<grid, block, 0, stream>>>(
+            k_cache.const_data_ptr<int8_t>(),
+            v_cache.const_data_ptr<int8_t>(),
+            k_scales.const_data_ptr<float>(),
+            v_scales.const_data_ptr<float>(),
+            key.mutable_data_ptr<scalar_t>(),
+            value.mutable_data_ptr<scalar_t>(),
+            length,
+            head_dim,
+            cache_seq_len);
+      } else {
+        dequantize_cached_kv_kernel<scalar_t, c10::Float8_e4m3fn>
+          <<<grid, block, 0, stream>>>(
+            k_cache.const_data_ptr<c10::Float8_e4m3fn>(),
+            v_cache.const_data_ptr<c10::Float8_e4m3fn>(),
+            k_scales.const_data_ptr<float>(),
+            v_scales.const_data_ptr<float>(),
+            key.mutable_data_ptr<scalar_t>(),
+            value.mutable_data_ptr<scalar_t>(),
+            length,
+            head_dim,
+            cache_seq_len);
+      }
+      C10_CUDA_KERNEL_LAUNCH_CHECK();
+    });
+
+  return std::make_tuple(key, value);
+}
+
+} // namespace at::native
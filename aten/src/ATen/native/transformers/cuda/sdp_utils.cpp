@@ -532,6 +532,26 @@ bool check_runtime_disabled_cudnn(sdp_params const& params, bool debug) {
   return true;
 }
 
+bool check_attn_mask_for_nested_inputs(sdp_params const& params, bool debug) {
+  // The varlen memory efficient kernel reads the attention bias per batch
+  // entry from a regular [batch, num_heads, max_seqlen_q, max_seqlen_kv]
+  // (broadcastable) tensor, so a ragged mask cannot be expressed and a mask
+  // that requires grad has no backward on the nested path.
+  if (!params.attn_mask.has_value()) {
+    return true;
+  }
+  const auto& mask = params.attn_mask.value();
+  if (mask.is_nested() || mask.dim() > 4 || mask.requires_grad()) {
+    if (debug) {
+      TORCH_WARN(
+          "Memory efficient attention with nested inputs requires a dense attn_mask "
+          "with at most 4 dims that does not require grad.");
+    }
+    return false;
+  }
+  return true;
+}
+
 bool check_cudnn_deterministic(const sdp_params& params, bool debug) {
   auto& ctx = at::globalContext();
   if (ctx.deterministicAlgorithms()) {
@@ -689,6 +709,7 @@ bool can_use_mem_efficient_attention(sdp_params const& params, bool debug) {
     constexpr auto nested_constraints = array_of<bool (*)(sdp_params const&, bool)>(
         check_requires_grad_and_nested,
         check_batch_size_nested,
+        check_attn_mask_for_nested_inputs,
         check_for_seq_len_0_nested_tensor);
     for (auto& constraint : nested_constraints) {
       if (!constraint(params, debug)) {
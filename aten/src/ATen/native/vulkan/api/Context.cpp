@@ -35,6 +35,7 @@ Context::Context(size_t adapter_i, const ContextConfig& config)
       cmd_mutex_{},
       cmd_(VK_NULL_HANDLE, 0u),
       submit_count_{0u},
+      recording_{false},
       // Memory Management
       buffer_clearlist_mutex_{},
       buffers_to_clear_{},
@@ -105,6 +106,44 @@ void Context::submit_cmd_to_gpu(VkFence fence_handle, const bool final_use) {
   }
 }
 
+void Context::begin_recording() {
+  std::lock_guard<std::mutex> cmd_lock(cmd_mutex_);
+  VK_CHECK_COND(
+      !recording_,
+      "Vulkan Context: called begin_recording() while already recording.");
+  // Submit any pending eagerly recorded work so that it does not become
+  // part of the recording.
+  if (cmd_) {
+    submit_cmd_to_gpu();
+  }
+  set_cmd(/*reusable=*/true);
+  recording_ = true;
+}
+
+CommandBuffer Context::end_recording() {
+  std::lock_guard<std::mutex> cmd_lock(cmd_mutex_);
+  VK_CHECK_COND(
+      recording_,
+      "Vulkan Context: called end_recording() without a matching "
+      "begin_recording().");
+  recording_ = false;
+  submit_count_ = 0u;
+  // The recorded buffer is handed back still in the RECORDING state; the
+  // first replay() transitions it to READY via end(). Moving it out leaves
+  // cmd_ invalid, so the next submission acquires a fresh command buffer.
+  return CommandBuffer(std::move(cmd_));
+}
+
+void Context::replay(CommandBuffer& cmd, VkFence fence_handle) {
+  VK_CHECK_COND(
+      cmd && cmd.is_reusable(),
+      "Vulkan Context: replay() requires a reusable recorded command buffer.");
+  // end() is a no-op beyond the state transition once the buffer has been
+  // submitted before; a reusable buffer cycles between SUBMITTED and READY.
+  cmd.end();
+  adapter_p_->submit_cmd(queue_, cmd.get_submit_handle(), fence_handle);
+}
+
 void Context::flush() {
   VK_CHECK(vkQueueWaitIdle(queue()));
 
@@ -70,6 +70,7 @@ class Context final {
   std::mutex cmd_mutex_;
   CommandBuffer cmd_;
   uint32_t submit_count_;
+  bool recording_;
   // Memory Management
   std::mutex buffer_clearlist_mutex_;
   std::vector<VulkanBuffer> buffers_to_clear_;
@@ -199,6 +200,25 @@ class Context final {
       VkFence fence_handle = VK_NULL_HANDLE,
       const bool final_use = false);
 
+  /*
+    Graph-style command buffer recording, analogous to CUDA Graphs. All
+    submit_*_job calls made between begin_recording() and end_recording()
+    are recorded into a single reusable command buffer instead of being
+    submitted to the GPU in batches, and end_recording() hands that buffer
+    to the caller. replay() submits a recorded buffer without re-recording
+    it, so a model with stable input shapes can be recorded once per shape
+    on first run and replayed every frame with a single queue submission.
+
+    The recorded buffer references descriptor sets and resources owned by
+    this context; flush() invalidates them, so it must not be called while
+    a recorded buffer will still be replayed. Recording is context-wide:
+    submissions from other threads would be captured too, so record while
+    no other thread is dispatching work.
+  */
+  void begin_recording();
+  CommandBuffer end_recording();
+  void replay(CommandBuffer&, VkFence fence_handle = VK_NULL_HANDLE);
+
   void flush();
 };
 
@@ -438,6 +458,11 @@ inline bool Context::submit_copy(
     cmd_lock = std::unique_lock<std::mutex>(cmd_mutex_);
   }
 
+  VK_CHECK_COND(
+      !recording_ || fence_handle == VK_NULL_HANDLE,
+      "Vulkan Context: fenced submissions cannot be made while recording "
+      "a command buffer for replay.");
+
   set_cmd();
 
 #ifdef USE_VULKAN_GPU_DIAGNOSTICS
@@ -460,8 +485,9 @@ inline bool Context::submit_copy(
 #endif /* USE_VULKAN_GPU_DIAGNOSTICS */
 
   submit_count_++;
-  if (fence_handle != VK_NULL_HANDLE ||
-      submit_count_ >= config_.cmdSubmitFrequency) {
+  if (!recording_ &&
+      (fence_handle != VK_NULL_HANDLE ||
+       submit_count_ >= config_.cmdSubmitFrequency)) {
     submit_cmd_to_gpu(fence_handle);
     return true;
   }
@@ -509,6 +535,11 @@ inline bool Context::submit_compute_job(
     cmd_lock = std::unique_lock<std::mutex>(cmd_mutex_);
   }
 
+  VK_CHECK_COND(
+      !recording_ || fence_handle == VK_NULL_HANDLE,
+      "Vulkan Context: fenced submissions cannot be made while recording "
+      "a command buffer for replay.");
+
   set_cmd();
 
 #ifdef USE_VULKAN_GPU_DIAGNOSTICS
@@ -542,8 +573,9 @@ inline bool Context::submit_compute_job(
 #endif /* USE_VULKAN_GPU_DIAGNOSTICS */
 
   submit_count_++;
-  if (fence_handle != VK_NULL_HANDLE ||
-      submit_count_ >= config_.cmdSubmitFrequency) {
+  if (!recording_ &&
+      (fence_handle != VK_NULL_HANDLE ||
+       submit_count_ >= config_.cmdSubmitFrequency)) {
     submit_cmd_to_gpu(fence_handle);
     return true;
   }
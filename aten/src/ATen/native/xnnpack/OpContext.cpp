@@ -4,9 +4,101 @@
 #include <ATen/native/xnnpack/OpContext.h>
 
 #include <ATen/Context.h>
+#include <c10/util/hash.h>
+
+#include <algorithm>
+#include <string_view>
 
 namespace at::native::xnnpack {
 
+namespace {
+
+size_t hash_tensor_data(size_t seed, const Tensor& t) {
+  const Tensor contig = t.contiguous();
+  const auto* data = static_cast<const char*>(contig.const_data_ptr());
+  const size_t nbytes = contig.nbytes();
+  return c10::hash_combine(
+      seed, std::hash<std::string_view>{}(std::string_view(data, nbytes)));
+}
+
+// A hash collision between different weights would silently share the
+// wrong packed copy, so on a hit the structural parameters recorded in
+// the packed context are re-checked; a mismatch is treated as a miss.
+bool matches_cached_context(
+    const ContextConv2D& context,
+    const Tensor& weight,
+    const std::vector<int64_t>& stride,
+    const std::vector<int64_t>& dilation,
+    int64_t groups,
+    bool transposed) {
+  return context.transposed_ == transposed && context.groups_ == groups &&
+      std::equal(stride.begin(), stride.end(), context.stride_.begin()) &&
+      std::equal(dilation.begin(), dilation.end(), context.dilation_.begin()) &&
+      weight.sizes().equals(context.weight_size_);
+}
+
+} // namespace
+
+PackedConv2dWeightsCache& PackedConv2dWeightsCache::instance() {
+  static PackedConv2dWeightsCache cache;
+  return cache;
+}
+
+std::shared_ptr<PackedConv2dWeightsCache::Entry>
+PackedConv2dWeightsCache::get_or_create(
+    size_t key,
+    const std::function<ContextConv2D()>& create) {
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it != entries_.end()) {
+      if (auto entry = it->second.lock()) {
+        return entry;
+      }
+      entries_.erase(it);
+    }
+  }
+  // Pack outside the lock; a concurrent prepack of the same weights at
+  // worst packs twice and the second copy wins.
+  auto entry = std::make_shared<Entry>(create());
+  std::lock_guard<std::mutex> lock(mutex_);
+  entries_[key] = entry;
+  return entry;
+}
+
+size_t PackedConv2dWeightsCache::hash(
+    const Tensor& weight,
+    const std::optional<Tensor>& bias,
+    const std::vector<int64_t>& padding,
+    const std::vector<int64_t>& output_padding,
+    const std::vector<int64_t>& stride,
+    const std::vector<int64_t>& dilation,
+    int64_t groups,
+    bool transposed,
+    const std::optional<Scalar>& output_min,
+    const std::optional<Scalar>& output_max) {
+  size_t seed = hash_tensor_data(0, weight);
+  if (bias.has_value() && bias->defined()) {
+    seed = hash_tensor_data(seed, *bias);
+  }
+  seed = c10::hash_combine(seed, c10::hash<std::vector<int64_t>>()(padding));
+  seed = c10::hash_combine(
+      seed, c10::hash<std::vector<int64_t>>()(output_padding));
+  seed = c10::hash_combine(seed, c10::hash<std::vector<int64_t>>()(stride));
+  seed = c10::hash_combine(seed, c10::hash<std::vector<int64_t>>()(dilation));
+  seed = c10::hash_combine(seed, std::hash<int64_t>{}(groups));
+  seed = c10::hash_combine(seed, std::hash<bool>{}(transposed));
+  seed = c10::hash_combine(
+      seed,
+      std::hash<float>{}(
+          output_min ? output_min->to<float>() : ContextConv2D::kMin));
+  seed = c10::hash_combine(
+      seed,
+      std::hash<float>{}(
+          output_max ? output_max->to<float>() : ContextConv2D::kMax));
+  return seed;
+}
+
 c10::intrusive_ptr<LinearOpContext>
 XNNPackLinearOpContext::create_context(
     at::Tensor&& weight,
@@ -53,20 +145,39 @@ XNNPackConv2dOpContext::create_context(at::Tensor&& weight,
     int64_t groups,
     const std::optional<Scalar>& output_min,
     const std::optional<Scalar>& output_max) {
-  auto op_context =
-      xnnpack::internal::convolution2d::create(
-          weight,
-          bias,
-          padding,
-          {0, 0}, // output_padding
-          stride,
-          dilation,
-          groups,
-          false,  // transposed
-          output_min ? output_min->to<float>()
-                     : xnnpack::ContextConv2D::kMin,
-          output_max ? output_max->to<float>()
-                     : xnnpack::ContextConv2D::kMax);
+  auto pack = [&]() {
+    return xnnpack::internal::convolution2d::create(
+        weight,
+        bias,
+        padding,
+        {0, 0}, // output_padding
+        stride,
+        dilation,
+        groups,
+        false,  // transposed
+        output_min ? output_min->to<float>()
+                   : xnnpack::ContextConv2D::kMin,
+        output_max ? output_max->to<float>()
+                   : xnnpack::ContextConv2D::kMax);
+  };
+
+  const size_t cache_key = PackedConv2dWeightsCache::hash(
+      weight,
+      bias,
+      padding,
+      {0, 0}, // output_padding
+      stride,
+      dilation,
+      groups,
+      /*transposed=*/false,
+      output_min,
+      output_max);
+  auto packed =
+      PackedConv2dWeightsCache::instance().get_or_create(cache_key, pack);
+  if (!matches_cached_context(
+          packed->context, weight, stride, dilation, groups, false)) {
+    packed = std::make_shared<PackedConv2dWeightsCache::Entry>(pack());
+  }
 
   auto conv2d_op_context =
       c10::make_intrusive<XNNPackConv2dOpContext>(
@@ -78,7 +189,7 @@ XNNPackConv2dOpContext::create_context(at::Tensor&& weight,
           groups,
           output_min,
           output_max,
-          std::move(op_context));
+          std::move(packed));
 
   if (at::globalContext().releaseWeightsWhenPrepacking()) {
     conv2d_op_context->free_orig_weight_and_bias();
@@ -97,20 +208,39 @@ XNNPackTransposeConv2dOpContext::create_context(at::Tensor&& weight,
     int64_t groups,
     const std::optional<Scalar>& output_min,
     const std::optional<Scalar>& output_max) {
-  auto op_context =
-      xnnpack::internal::convolution2d::create(
-          weight,
-          bias,
-          padding,
-          output_padding,
-          stride,
-          dilation,
-          groups,
-          true, // transposed
-          output_min ? output_min->to<float>()
-                     : xnnpack::ContextConv2D::kMin,
-          output_max ? output_max->to<float>()
-                     : xnnpack::ContextConv2D::kMax);
+  auto pack = [&]() {
+    return xnnpack::internal::convolution2d::create(
+        weight,
+        bias,
+        padding,
+        output_padding,
+        stride,
+        dilation,
+        groups,
+        true, // transposed
+        output_min ? output_min->to<float>()
+                   : xnnpack::ContextConv2D::kMin,
+        output_max ? output_max->to<float>()
+                   : xnnpack::ContextConv2D::kMax);
+  };
+
+  const size_t cache_key = PackedConv2dWeightsCache::hash(
+      weight,
+      bias,
+      padding,
+      output_padding,
+      stride,
+      dilation,
+      groups,
+      /*transposed=*/true,
+      output_min,
+      output_max);
+  auto packed =
+      PackedConv2dWeightsCache::instance().get_or_create(cache_key, pack);
+  if (!matches_cached_context(
+          packed->context, weight, stride, dilation, groups, true)) {
+    packed = std::make_shared<PackedConv2dWeightsCache::Entry>(pack());
+  }
 
   auto conv2d_op_context =
       c10::make_intrusive<XNNPackTransposeConv2dOpContext>(
@@ -123,7 +253,7 @@ XNNPackTransposeConv2dOpContext::create_context(at::Tensor&& weight,
           groups,
           output_min,
           output_max,
-          std::move(op_context));
+          std::move(packed));
 
   if (at::globalContext().releaseWeightsWhenPrepacking()) {
     conv2d_op_context->free_orig_weight_and_bias();
@@ -132,14 +262,94 @@ XNNPackTransposeConv2dOpContext::create_context(at::Tensor&& weight,
   return conv2d_op_context;
 }
 
+namespace {
+
+// Shared packed weights are reused in place as long as the input
+// geometry is stable (re-setup is cheap to skip in that case, see the
+// input-pointer-caching note in Convolution.cpp). Returns false when
+// running would flip a shared operator to a different geometry, i.e. the
+// caller should detach onto a private copy first.
+bool can_run_shared(
+    const std::shared_ptr<PackedConv2dWeightsCache::Entry>& packed,
+    const std::array<int64_t, 4>& input_size,
+    bool orig_weight_and_bias_freed) {
+  return !packed->has_run || packed->last_input_size == input_size ||
+      packed.use_count() == 1 || orig_weight_and_bias_freed;
+}
+
+std::array<int64_t, 4> conv_input_size_key(const Tensor& input) {
+  std::array<int64_t, 4> size{{0, 0, 0, 0}};
+  if (input.dim() == 4) {
+    for (size_t i = 0; i < 4; ++i) {
+      size[i] = input.size(static_cast<int64_t>(i));
+    }
+  }
+  return size;
+}
+
+} // namespace
+
 Tensor XNNPackConv2dOpContext::run(const Tensor& input) {
   std::lock_guard<std::mutex> lock(xnnp_mutex_);
-  return xnnpack::internal::convolution2d::run(op_context_, input);
+  const auto input_size = conv_input_size_key(input);
+  {
+    std::lock_guard<std::mutex> entry_lock(packed_->mutex);
+    if (can_run_shared(packed_, input_size, orig_weight_and_bias_freed_)) {
+      packed_->has_run = true;
+      packed_->last_input_size = input_size;
+      return xnnpack::internal::convolution2d::run(packed_->context, input);
+    }
+  }
+  // Copy-on-write: repack a private copy from the original weights so
+  // sharers with different input geometry stop invalidating each other's
+  // operator setup.
+  packed_ = std::make_shared<PackedConv2dWeightsCache::Entry>(
+      xnnpack::internal::convolution2d::create(
+          orig_weight_,
+          orig_bias_,
+          padding_,
+          {0, 0}, // output_padding
+          stride_,
+          dilation_,
+          groups_,
+          false, // transposed
+          output_min_ ? output_min_->to<float>()
+                      : xnnpack::ContextConv2D::kMin,
+          output_max_ ? output_max_->to<float>()
+                      : xnnpack::ContextConv2D::kMax));
+  packed_->has_run = true;
+  packed_->last_input_size = input_size;
+  return xnnpack::internal::convolution2d::run(packed_->context, input);
 }
 
 Tensor XNNPackTransposeConv2dOpContext::run(const Tensor& input) {
   std::lock_guard<std::mutex> lock(xnnp_mutex_);
-  return xnnpack::internal::convolution2d::run(op_context_, input);
+  const auto input_size = conv_input_size_key(input);
+  {
+    std::lock_guard<std::mutex> entry_lock(packed_->mutex);
+    if (can_run_shared(packed_, input_size, orig_weight_and_bias_freed_)) {
+      packed_->has_run = true;
+      packed_->last_input_size = input_size;
+      return xnnpack::internal::convolution2d::run(packed_->context, input);
+    }
+  }
+  packed_ = std::make_shared<PackedConv2dWeightsCache::Entry>(
+      xnnpack::internal::convolution2d::create(
+          orig_weight_,
+          orig_bias_,
+          padding_,
+          output_padding_,
+          stride_,
+          dilation_,
+          groups_,
+          true, // transposed
+          output_min_ ? output_min_->to<float>()
+                      : xnnpack::ContextConv2D::kMin,
+          output_max_ ? output_max_->to<float>()
+                      : xnnpack::ContextConv2D::kMax));
+  packed_->has_run = true;
+  packed_->last_input_size = input_size;
+  return xnnpack::internal::convolution2d::run(packed_->context, input);
 }
 
 void XNNPackConv2dOpContext::free_orig_weight_and_bias() {
@@ -6,6 +6,12 @@
 #include <ATen/native/xnnpack/Common.h>
 #include <ATen/Tensor.h>
 
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
 namespace at::native::xnnpack {
 
 using SerializationTypeLinearPrePack = std::tuple<
@@ -35,6 +41,61 @@ using SerializationTypeTransposeConv2dPrePack = std::tuple<
 
 
 
+// Process-level cache of packed convolution weights.
+//
+// Each op context packs its own copy of the weights, so an app that loads
+// the same model in several features holds one packed copy per instance.
+// Keying the packed operator by a hash of the weight/bias contents and the
+// convolution parameters lets identical prepacks share a single copy. Only
+// weak references are kept, so packed weights are freed as soon as the
+// last op context using them goes away.
+//
+// The xnn operator is mutated at run time (reshape/setup rewrite its
+// indirection buffer), so each entry carries the mutex that used to live
+// on the op context, and remembers the input geometry it was last set up
+// for. An op context that would keep flipping a shared operator between
+// geometries detaches with a private repacked copy instead (see
+// XNNPackConv2dOpContext::run); sharers never observe each other's setup.
+class PackedConv2dWeightsCache final {
+ public:
+  struct Entry {
+    ContextConv2D context;
+    // Guards the xnn operator, which may now be shared across op
+    // contexts running on different threads.
+    std::mutex mutex;
+    // Input geometry of the last run; a shared operator is only reused
+    // in place while the geometry is stable.
+    std::array<int64_t, 4> last_input_size{{0, 0, 0, 0}};
+    bool has_run = false;
+
+    explicit Entry(ContextConv2D&& c) : context(std::move(c)) {}
+  };
+
+  static PackedConv2dWeightsCache& instance();
+
+  // Returns the cached packed weights for `key`, or packs them with
+  // `create` and caches the result.
+  std::shared_ptr<Entry> get_or_create(
+      size_t key,
+      const std::function<ContextConv2D()>& create);
+
+  static size_t hash(
+      const Tensor& weight,
+      const std::optional<Tensor>& bias,
+      const std::vector<int64_t>& padding,
+      const std::vector<int64_t>& output_padding,
+      const std::vector<int64_t>& stride,
+      const std::vector<int64_t>& dilation,
+      int64_t groups,
+      bool transposed,
+      const std::optional<Scalar>& output_min,
+      const std::optional<Scalar>& output_max);
+
+ private:
+  std::mutex mutex_;
+  std::unordered_map<size_t, std::weak_ptr<Entry>> entries_;
+};
+
 class LinearOpContext : public torch::jit::CustomClassHolder {
  protected:
   Tensor orig_weight_;
@@ -146,7 +207,9 @@ class TransposeConv2dOpContext : public torch::jit::CustomClassHolder {
 
 class XNNPackConv2dOpContext final : public Conv2dOpContext {
  private:
-  ContextConv2D op_context_;
+  // Possibly shared with other op contexts packed from identical weights
+  // and parameters; see PackedConv2dWeightsCache.
+  std::shared_ptr<PackedConv2dWeightsCache::Entry> packed_;
   // xnnpack convs use indirection buffer.
   // These buffers need setup at runtime and/or when input
   // dims change. If we are running the same model on multiple
@@ -165,8 +228,8 @@ class XNNPackConv2dOpContext final : public Conv2dOpContext {
       uint64_t groups,
       const std::optional<Scalar>& min,
       const std::optional<Scalar>& max,
-      ContextConv2D&& op_context)
-      : op_context_(std::move(op_context)) {
+      std::shared_ptr<PackedConv2dWeightsCache::Entry> packed)
+      : packed_(std::move(packed)) {
     orig_weight_ = std::move(weight);
     orig_bias_ = std::move(bias);
     padding_ = std::move(padding);
@@ -194,7 +257,9 @@ class XNNPackConv2dOpContext final : public Conv2dOpContext {
 
 class XNNPackTransposeConv2dOpContext final : public TransposeConv2dOpContext {
  private:
-  ContextConv2D op_context_;
+  // Possibly shared with other op contexts packed from identical weights
+  // and parameters; see PackedConv2dWeightsCache.
+  std::shared_ptr<PackedConv2dWeightsCache::Entry> packed_;
   // xnnpack convs use indirection buffer.
   // These buffers need setup at runtime and/or when input
   // dims change. If we are running the same model on multiple
@@ -214,8 +279,8 @@ class XNNPackTransposeConv2dOpContext final : public TransposeConv2dOpContext {
       uint64_t groups,
       const std::optional<Scalar>& min,
       const std::optional<Scalar>& max,
-      ContextConv2D&& op_context)
-      : op_context_(std::move(op_context)) {
+      std::shared_ptr<PackedConv2dWeightsCache::Entry> packed)
+      : packed_(std::move(packed)) {
     orig_weight_ = std::move(weight);
     orig_bias_ = std::move(bias);
     padding_ = std::move(padding);
@@ -74,6 +74,18 @@ class TORCH_API TensorMaker {
     return *this;
   }
 
+  /// Declares that `data` satisfies the default allocator's alignment
+  /// contract (c10::gAlignment) and, if strides are given, that they
+  /// describe a densely packed layout. The promise is validated in
+  /// `make_tensor`, so the resulting tensor carries the same contiguity
+  /// guarantees as an allocator-backed one and TensorIterator can take
+  /// the full Vectorized fast path over the zero-copy buffer.
+  TensorMaker& aligned() noexcept {
+    aligned_ = true;
+
+    return *this;
+  }
+
   Tensor make_tensor();
 
  private:
@@ -98,6 +110,7 @@ class TORCH_API TensorMaker {
   TensorOptions opts_{};
   bool resizeable_{};
   c10::Allocator* allocator_{};
+  bool aligned_{};
 };
 
 inline TensorMaker for_blob(void* data, IntArrayRef sizes) noexcept {
@@ -164,4 +177,31 @@ inline Tensor from_blob(
   return for_blob(data, sizes).options(options).make_tensor();
 }
 
+/// Like `from_blob`, but records the caller's guarantee that `data` is
+/// aligned to c10::gAlignment and densely packed (validated at
+/// construction). Use this for zero-copy views over foreign buffers
+/// (e.g. Arrow) that honor the allocator's alignment contract, so
+/// elementwise kernels take the vectorized path instead of the
+/// conservative scalar fallback.
+inline Tensor from_blob_aligned(
+    void* data,
+    IntArrayRef sizes,
+    const TensorOptions& options = {}) {
+  return for_blob(data, sizes).aligned().options(options).make_tensor();
+}
+
+inline Tensor from_blob_aligned(
+    void* data,
+    IntArrayRef sizes,
+    std::function<void(void*)> deleter,
+    const TensorOptions& options = {},
+    const std::optional<Device> target_device = std::nullopt) {
+  return for_blob(data, sizes)
+      .aligned()
+      .deleter(std::move(deleter))
+      .options(options)
+      .target_device(target_device)
+      .make_tensor();
+}
+
 } // namespace at
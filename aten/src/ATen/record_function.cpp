@@ -329,13 +329,17 @@ void CacheEntry::rebuildActiveCallbacks() {
     if (i.tries_left_ < 0) {
       // Callback is not sampled. Unconditionally push.
       active_callbacks_.callbacks_.push_back(
-          {i.callback_.start(), i.callback_.end()});
+          {i.callback_.start(), i.callback_.end(), i.callback_.opNameBloom()});
+      active_callbacks_.has_op_name_filters_ |=
+          i.callback_.opNameBloom() != 0;
 
     } else if (i.tries_left_ == 0) {
       // Callback is sampled and we have reached a sampling event. Push and
       // set `sampling_countdown_` to one so we trigger a rebuild after one call.
       active_callbacks_.callbacks_.push_back(
-          {i.callback_.start(), i.callback_.end()});
+          {i.callback_.start(), i.callback_.end(), i.callback_.opNameBloom()});
+      active_callbacks_.has_op_name_filters_ |=
+          i.callback_.opNameBloom() != 0;
       sampling_countdown_ = 1;
 
     } else {
@@ -539,6 +543,9 @@ RecordFunction::RecordFunction(StepCallbacks&& step_callbacks)
 
 void RecordFunction::runStartCallbacks() {
   for (const auto i : c10::irange(step_callbacks_.callbacks_.size())) {
+    if (C10_UNLIKELY(!passesNameFilter(i))) {
+      continue;
+    }
     tryRunCallback</*is_start=*/true>(
         step_callbacks_.callbacks_[i], *this, ctx_[i]);
   }
@@ -548,6 +555,9 @@ void RecordFunction::runStartCallbacks() {
 void RecordFunction::end() {
   if (called_start_callbacks_) {
     for (const auto i : c10::irange(step_callbacks_.callbacks_.size())) {
+      if (C10_UNLIKELY(!passesNameFilter(i))) {
+        continue;
+      }
       tryRunCallback</*is_start=*/false>(
         step_callbacks_.callbacks_[i], *this, ctx_[i]);
     }
@@ -715,6 +725,9 @@ void RecordFunction::before(const char* name, int64_t sequence_nr) {
   fn_ = name;
   sequence_nr_ = sequence_nr;
   is_nccl_meta_ = (std::strcmp(name, kParamCommsCallName.c_str()) == 0);
+  if (C10_UNLIKELY(step_callbacks_.has_op_name_filters_)) {
+    name_bloom_bits_ = RecordFunctionCallback::opNameBloomBits(name);
+  }
 
 #ifndef NDEBUG
     inputs_valid_ = true;
@@ -727,6 +740,9 @@ void RecordFunction::before(std::string name, int64_t sequence_nr) {
   is_nccl_meta_ = (name == kParamCommsCallName);
   fn_ = std::move(name);
   sequence_nr_ = sequence_nr;
+  if (C10_UNLIKELY(step_callbacks_.has_op_name_filters_)) {
+    name_bloom_bits_ = RecordFunctionCallback::opNameBloomBits(this->name());
+  }
 
 #ifndef NDEBUG
     inputs_valid_ = true;
@@ -741,6 +757,10 @@ void RecordFunction::before(
   sequence_nr_ = sequence_nr;
   fn_ = schema;
   is_nccl_meta_ = (schema.get().name() == kParamCommsCallName);
+  if (C10_UNLIKELY(step_callbacks_.has_op_name_filters_)) {
+    name_bloom_bits_ = RecordFunctionCallback::opNameBloomBits(
+        schema.get().name().c_str());
+  }
 
 #ifndef NDEBUG
     inputs_valid_ = true;
@@ -123,7 +123,9 @@ struct RecordFunction;
  * callbacks on (see RecordScope); passing empty set means the callbacks will be
  * executed for all possible scope types should_run - optional function that
  * returns whether this callback should run; overwrites the effect of setting
- * sampling_probability
+ * sampling_probability; op_names - optional set of op names the callback is
+ * interested in; other ops skip the callback via a cheap Bloom filter check
+ * before any context allocation or callback invocation happens
  */
 class TORCH_API RecordFunctionCallback {
  public:
@@ -163,6 +165,21 @@ class TORCH_API RecordFunctionCallback {
     return *this;
   }
 
+  // Restricts the callback to the given op names (as reported by
+  // RecordFunction::name(), e.g. "aten::add"). Names are folded into a
+  // 64-bit Bloom filter that is checked before the callback runs, so
+  // unrelated ops skip the start/end callbacks entirely. False positives
+  // only cost a spurious callback invocation; there are no false negatives.
+  // An empty set removes the restriction.
+  RecordFunctionCallback& opNames(
+      const std::unordered_set<std::string>& op_names) {
+    op_name_bloom_ = 0;
+    for (const auto& name : op_names) {
+      op_name_bloom_ |= opNameBloomBits(name.c_str());
+    }
+    return *this;
+  }
+
   RecordFunctionCallback& scopes(
       const std::unordered_set<RecordScope, std::hash<RecordScope>>& scopes) {
     if (!scopes.empty()) {
@@ -204,9 +221,26 @@ class TORCH_API RecordFunctionCallback {
     return end_;
   }
 
+  // Bloom filter over the names passed to opNames(). Zero means no name
+  // restriction.
+  uint64_t opNameBloom() const {
+    return op_name_bloom_;
+  }
+
+  // Two-bit Bloom signature of an op name (FNV-1a hash split into two bit
+  // positions). A name matches a filter iff both of its bits are set in it.
+  static uint64_t opNameBloomBits(const char* name) {
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (const char* p = name; *p != '\0'; ++p) {
+      h = (h ^ static_cast<uint8_t>(*p)) * 0x100000001b3ULL;
+    }
+    return (1ULL << (h & 63)) | (1ULL << ((h >> 6) & 63));
+  }
+
  private:
   StartCallback start_;
   EndCallback end_;
+  uint64_t op_name_bloom_ = 0;
   double sampling_prob_ = 1.0;
   std::array<bool, static_cast<size_t>(RecordScope::NUM_SCOPES)> scopes_ = {};
   bool needs_inputs_ = false;
@@ -267,6 +301,8 @@ struct StepCallbacks {
   struct StartEndPair {
     RecordFunctionCallback::StartCallback start_;
     RecordFunctionCallback::EndCallback end_;
+    // Name filter of the owning callback; zero means run for every op.
+    uint64_t op_name_bloom_{0};
   };
 
   using StartEndPairs = c10::SmallVector<StartEndPair, kSoftLimitCallbacks>;
@@ -277,6 +313,9 @@ struct StepCallbacks {
   bool needs_inputs_{false};
   bool needs_outputs_{false};
   bool needs_ids_{false};
+  // True iff any entry in callbacks_ has a name filter; lets before() skip
+  // hashing the op name in the common unfiltered case.
+  bool has_op_name_filters_{false};
 };
 
 struct TORCH_API RecordFunction {
@@ -497,6 +536,13 @@ struct TORCH_API RecordFunction {
  private:
   void runStartCallbacks();
 
+  // Returns whether callbacks_[idx] passes the op name Bloom filter for the
+  // current op (see RecordFunctionCallback::opNames).
+  bool passesNameFilter(size_t idx) const {
+    const auto filter = step_callbacks_.callbacks_[idx].op_name_bloom_;
+    return filter == 0 || (filter & name_bloom_bits_) == name_bloom_bits_;
+  }
+
   StepCallbacks step_callbacks_;
 
   // In cases when RecordFunction might be active but we chose not to
@@ -513,6 +559,10 @@ struct TORCH_API RecordFunction {
 
   std::variant<std::string, schema_ref_t> fn_;
 
+  // Bloom signature of the current op name; only computed in before() when
+  // some active callback carries a name filter.
+  uint64_t name_bloom_bits_ = 0;
+
   int64_t sequence_nr_ = -1;
   c10::ArrayRef<const IValue> inputs_;
   std::unordered_map<std::string, IValue> kwinputs_;
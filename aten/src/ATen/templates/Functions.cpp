@@ -1,8 +1,10 @@
 #include <array>
+#include <cstdint>
 
 #include <ATen/Functions.h>
 #include <ATen/Utils.h>
 #include <c10/core/Allocator.h>
+#include <c10/core/alignment.h>
 
 namespace at {
 
@@ -28,6 +30,29 @@ Tensor TensorMaker::make_tensor() {
      // clang-format on
    }
 
+   if (aligned_) {
+     TORCH_CHECK_VALUE(
+         reinterpret_cast<std::uintptr_t>(data_) % c10::gAlignment == 0,
+         "from_blob_aligned: data pointer is not aligned to ",
+         c10::gAlignment,
+         " bytes");
+     if (strides_) {
+       // The alignment promise also covers dense packing: validate that
+       // the strides describe a contiguous layout.
+       std::int64_t expected_stride = 1;
+       for (std::size_t i = sizes_.size(); i > 0; --i) {
+         auto dim = i - 1;
+         TORCH_CHECK_VALUE(
+             sizes_[dim] == 1 || (*strides_)[dim] == expected_stride,
+             "from_blob_aligned: strides ",
+             *strides_,
+             " are not contiguous for sizes ",
+             sizes_);
+         expected_stride *= sizes_[dim];
+       }
+     }
+   }
+
    std::size_t size_bytes = computeStorageSize();
 
    DataPtr data_ptr{};
@@ -8,3 +8,24 @@
 TEST(AllocatorTestCPU, test_clone) {
   test_allocator_clone(c10::GetDefaultCPUAllocator());
 }
+
+TEST(AllocatorTestCPU, test_small_object_pool_reuse) {
+  auto* allocator = c10::GetSmallObjectPoolCPUAllocator();
+  void* first = nullptr;
+  {
+    auto ptr = allocator->allocate(512);
+    ASSERT_NE(ptr.get(), nullptr);
+    first = ptr.get();
+  }
+  // The freed block is cached thread-locally and handed back for the
+  // next same-class allocation.
+  auto ptr = allocator->allocate(512);
+  ASSERT_EQ(ptr.get(), first);
+}
+
+TEST(AllocatorTestCPU, test_small_object_pool_large_alloc) {
+  auto* allocator = c10::GetSmallObjectPoolCPUAllocator();
+  auto ptr = allocator->allocate(1 << 20);
+  ASSERT_NE(ptr.get(), nullptr);
+  memset(ptr.get(), 0, 1 << 20);
+}
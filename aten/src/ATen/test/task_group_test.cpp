@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+#include <ATen/TaskGroup.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <thread>
+
+TEST(TaskGroupTest, IndependentTasksAllRun) {
+  auto a = at::zeros({4});
+  auto b = at::zeros({4});
+  auto c = at::zeros({4});
+  at::TaskGroup group;
+  group.run([&] { a.fill_(1); }, /*reads=*/{}, /*writes=*/{a});
+  group.run([&] { b.fill_(2); }, /*reads=*/{}, /*writes=*/{b});
+  group.run([&] { c.fill_(3); }, /*reads=*/{}, /*writes=*/{c});
+  group.wait();
+  ASSERT_TRUE(a.equal(at::full({4}, 1.0f)));
+  ASSERT_TRUE(b.equal(at::full({4}, 2.0f)));
+  ASSERT_TRUE(c.equal(at::full({4}, 3.0f)));
+}
+
+TEST(TaskGroupTest, ReaderWaitsForWriter) {
+  auto t = at::zeros({4});
+  auto u = at::zeros({4});
+  at::TaskGroup group;
+  // Delay the writer so an unordered reader would observe zeros.
+  group.run(
+      [&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        t.fill_(7);
+      },
+      /*reads=*/{},
+      /*writes=*/{t});
+  group.run([&] { u.copy_(t); }, /*reads=*/{t}, /*writes=*/{u});
+  group.wait();
+  ASSERT_TRUE(u.equal(at::full({4}, 7.0f)));
+}
+
+TEST(TaskGroupTest, WriterWaitsForReaders) {
+  auto t = at::zeros({4});
+  auto u = at::zeros({4});
+  at::TaskGroup group;
+  // The reader is delayed; the subsequent writer must not clobber `t`
+  // before the reader has copied it.
+  group.run(
+      [&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        u.copy_(t);
+      },
+      /*reads=*/{t},
+      /*writes=*/{u});
+  group.run([&] { t.fill_(9); }, /*reads=*/{}, /*writes=*/{t});
+  group.wait();
+  ASSERT_TRUE(u.equal(at::zeros({4})));
+  ASSERT_TRUE(t.equal(at::full({4}, 9.0f)));
+}
+
+TEST(TaskGroupTest, ViewWritesOrderAgainstBase) {
+  auto base = at::zeros({4});
+  auto view = base.narrow(0, 0, 2);
+  auto out = at::zeros({4});
+  at::TaskGroup group;
+  group.run(
+      [&] {
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        view.fill_(5);
+      },
+      /*reads=*/{},
+      /*writes=*/{view});
+  // Reading the base must wait for the write through the view.
+  group.run([&] { out.copy_(base); }, /*reads=*/{base}, /*writes=*/{out});
+  group.wait();
+  ASSERT_EQ(out[0].item<float>(), 5.0f);
+  ASSERT_EQ(out[3].item<float>(), 0.0f);
+}
+
+TEST(TaskGroupTest, WaitRethrowsTaskError) {
+  at::TaskGroup group;
+  group.run([] { throw std::runtime_error("tower failed"); });
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  ASSERT_THROW(group.wait(), std::runtime_error);
+  // The group is reusable after the error has been consumed.
+  auto t = at::zeros({2});
+  group.run([&] { t.fill_(1); }, /*reads=*/{}, /*writes=*/{t});
+  group.wait();
+  ASSERT_TRUE(t.equal(at::full({2}, 1.0f)));
+}
+
+TEST(TaskGroupTest, ChainOfWritersRunsInOrder) {
+  auto t = at::zeros({1});
+  at::TaskGroup group;
+  for (int i = 0; i < 16; i++) {
+    group.run([&] { t.add_(1); }, /*reads=*/{t}, /*writes=*/{t});
+  }
+  group.wait();
+  ASSERT_EQ(t.item<float>(), 16.0f);
+}
@@ -276,6 +276,51 @@ TEST(TestXNNPackOps, TestConvolution2dMultiThreaded) {
   t5.join();
 }
 
+TEST(TestXNNPackOps, TestConvolution2dSharedPackedWeights) {
+  constexpr int64_t groups = 1;
+  const std::vector<int64_t> stride{2, 2};
+  const std::vector<int64_t> padding{1, 1};
+  const std::vector<int64_t> dilation{1, 1};
+
+  const auto weights_cpu =
+      at::randn({4, 3, 3, 3}, at::device(at::kCPU).dtype(at::kFloat));
+  const auto bias_cpu =
+      at::randn({4}, at::device(at::kCPU).dtype(at::kFloat));
+
+  // Two instances prepacked from identical weights share one packed copy
+  // through the process-level cache.
+  auto make_context = [&]() {
+    return at::native::xnnpack::XNNPackConv2dOpContext::create_context(
+        weights_cpu.clone(),
+        bias_cpu.clone(),
+        std::vector<int64_t>(padding),
+        std::vector<int64_t>(stride),
+        std::vector<int64_t>(dilation),
+        groups,
+        std::nullopt,
+        std::nullopt);
+  };
+  auto context_a = make_context();
+  auto context_b = make_context();
+
+  const auto input_small =
+      at::randn({1, 3, 8, 8}, at::device(at::kCPU).dtype(at::kFloat));
+  const auto input_large =
+      at::randn({1, 3, 16, 16}, at::device(at::kCPU).dtype(at::kFloat));
+  const auto expected_small = at::conv2d(
+      input_small, weights_cpu, bias_cpu, stride, padding, dilation, groups);
+  const auto expected_large = at::conv2d(
+      input_large, weights_cpu, bias_cpu, stride, padding, dilation, groups);
+
+  // Same geometry runs the shared operator in place; the second instance
+  // running a different geometry detaches onto a private copy.
+  ASSERT_TRUE(almostEqual(expected_small, context_a->run(input_small)));
+  ASSERT_TRUE(almostEqual(expected_small, context_b->run(input_small)));
+  ASSERT_TRUE(almostEqual(expected_large, context_b->run(input_large)));
+  ASSERT_TRUE(almostEqual(expected_small, context_a->run(input_small)));
+  ASSERT_TRUE(almostEqual(expected_large, context_b->run(input_large)));
+}
+
 TEST(TestXNNPackOps, TestGlobal) {
   // input, expected_result pair
   std::vector<std::pair<at::Tensor, at::Tensor>> input_result_pairs = {
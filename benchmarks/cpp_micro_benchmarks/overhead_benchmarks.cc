@@ -0,0 +1,126 @@
+// Micro benchmarks for the C++ hot paths that sit under every op call:
+// dispatcher dispatch, TensorIterator construction, TensorImpl creation and
+// IValue boxing. The Python-driven framework_overhead_benchmark cannot
+// resolve regressions below ~1us; these loops can, and make sub-release
+// overhead creep bisectable.
+//
+// Usage notes:
+//  - Set BENCH_PIN_CORE=<n> to pin the benchmark thread to a core and take
+//    scheduler noise out of the ns-scale measurements.
+//  - When google benchmark is built with libpfm, pass
+//    --benchmark_perf_counters=CYCLES,INSTRUCTIONS to report hardware
+//    counters per iteration alongside wall time.
+
+#include <benchmark/benchmark.h>
+
+#include <ATen/ATen.h>
+#include <ATen/TensorIterator.h>
+#include <ATen/core/dispatch/Dispatcher.h>
+#include <ATen/core/ivalue.h>
+
+#if defined(__linux__)
+#include <sched.h>
+#include <cstdlib>
+#endif
+
+namespace {
+
+// Dispatcher::call through the typed entry point, the same path every
+// unboxed aten:: call takes. Small same-shape float tensors keep the kernel
+// itself cheap so the dispatch machinery dominates.
+void BM_DispatcherCall(benchmark::State& state) {
+  auto op = c10::Dispatcher::singleton()
+                .findSchemaOrThrow("aten::add", "Tensor")
+                .typed<at::Tensor(
+                    const at::Tensor&, const at::Tensor&, const at::Scalar&)>();
+  auto a = at::randn({2, 2});
+  auto b = at::randn({2, 2});
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(op.call(a, b, 1));
+  }
+}
+BENCHMARK(BM_DispatcherCall);
+
+// The boxed fallback path: push IValues, callBoxed, pop the result.
+void BM_DispatcherCallBoxed(benchmark::State& state) {
+  auto op =
+      c10::Dispatcher::singleton().findSchemaOrThrow("aten::add", "Tensor");
+  auto a = at::randn({2, 2});
+  auto b = at::randn({2, 2});
+  for (auto _ : state) {
+    torch::jit::Stack stack{a, b, 1};
+    op.callBoxed(&stack);
+    benchmark::DoNotOptimize(stack);
+  }
+}
+BENCHMARK(BM_DispatcherCallBoxed);
+
+// TensorIterator::build for a binary contiguous op, without running a
+// kernel. This is the per-call setup cost of most pointwise ops.
+void BM_TensorIteratorBuild(benchmark::State& state) {
+  auto a = at::randn({64, 64});
+  auto b = at::randn({64, 64});
+  auto out = at::empty({64, 64});
+  for (auto _ : state) {
+    auto iter = at::TensorIteratorConfig()
+                    .add_output(out)
+                    .add_input(a)
+                    .add_input(b)
+                    .build();
+    benchmark::DoNotOptimize(iter);
+  }
+}
+BENCHMARK(BM_TensorIteratorBuild);
+
+// TensorImpl + storage creation for a small CPU tensor. at::empty is used
+// rather than constructing the impl directly so the measured path is the
+// one real allocations take (including the caching of the allocator).
+void BM_TensorImplCreation(benchmark::State& state) {
+  for (auto _ : state) {
+    auto t = at::empty({8});
+    benchmark::DoNotOptimize(t);
+  }
+}
+BENCHMARK(BM_TensorImplCreation);
+
+// IValue construction and destruction for the payload types that dominate
+// op arguments.
+void BM_IValueBoxTensor(benchmark::State& state) {
+  auto t = at::randn({2, 2});
+  for (auto _ : state) {
+    c10::IValue value(t);
+    benchmark::DoNotOptimize(value);
+  }
+}
+BENCHMARK(BM_IValueBoxTensor);
+
+void BM_IValueBoxScalars(benchmark::State& state) {
+  for (auto _ : state) {
+    c10::IValue an_int(static_cast<int64_t>(42));
+    c10::IValue a_double(1.5);
+    benchmark::DoNotOptimize(an_int);
+    benchmark::DoNotOptimize(a_double);
+  }
+}
+BENCHMARK(BM_IValueBoxScalars);
+
+void maybePinToCore() {
+#if defined(__linux__)
+  const char* core = std::getenv("BENCH_PIN_CORE");
+  if (core != nullptr) {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(std::atoi(core), &set);
+    sched_setaffinity(0, sizeof(set), &set);
+  }
+#endif
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  maybePinToCore();
+  benchmark::Initialize(&argc, argv);
+  benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -240,6 +240,62 @@ def run_gemv(device: str = "cuda"):
     return results
 
 
+def run_scaled_mm_recipes(device: str = "cuda"):
+    # torch._scaled_mm needs fp8 hardware support
+    if device != "cuda" or torch.cuda.get_device_capability() < (8, 9):
+        return []
+    recipe_tflops_map = {
+        "tensorwise": "660",
+        "rowwise": "610",
+        "blockwise": "120",
+    }
+    input_shapes = [1024, 4096, 8192, 16384]
+    K = N = 8192
+    results = []
+    for recipe, expected_tflops in recipe_tflops_map.items():
+        tflops = 0
+        for M in input_shapes:
+            a = torch.randn(M, K, device=device).to(torch.float8_e4m3fn)
+            b = torch.randn(N, K, device=device).to(torch.float8_e4m3fn).t()
+            if recipe == "tensorwise":
+                scale_a = torch.tensor(1.0, device=device)
+                scale_b = torch.tensor(1.0, device=device)
+            elif recipe == "rowwise":
+                scale_a = torch.ones(M, 1, device=device)
+                scale_b = torch.ones(1, N, device=device)
+            else:
+                scale_a = torch.ones((M + 127) // 128, (K + 127) // 128, device=device)
+                scale_b = torch.ones((K + 127) // 128, (N + 127) // 128, device=device)
+
+            def scaled_mm(a, b, scale_a, scale_b):
+                return torch._scaled_mm(
+                    a, b, scale_a, scale_b, out_dtype=torch.bfloat16
+                )
+
+            for _ in range(WARMUP_ITER):
+                scaled_mm(a, b, scale_a, scale_b)
+
+            us_per_iter = (
+                benchmarker.benchmark_gpu(lambda: scaled_mm(a, b, scale_a, scale_b))
+                * 1000
+            )
+            tflops += (1e6 / us_per_iter) * 2 * M * K * N / 1e12
+
+        tflops = tflops / len(input_shapes)
+        results.append(
+            Experiment(
+                f"scaled_mm_{recipe}",
+                "tflops",
+                expected_tflops,
+                f"{tflops:.02f}",
+                "float8_e4m3fn",
+                device,
+                get_arch_name(),
+            )
+        )
+    return results
+
+
 def output_csv(output_file, headers, row):
     if os.path.exists(output_file):
         with open(output_file) as fd:
@@ -273,6 +329,7 @@ all_experiments = {
     run_layer_norm,
     run_gather_gemv,
     run_gemv,
+    run_scaled_mm_recipes,
 }
 
 
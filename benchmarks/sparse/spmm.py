@@ -6,12 +6,12 @@ from utils import Event, gen_sparse_coo, gen_sparse_coo_and_csr, gen_sparse_csr
 import torch
 
 
-def test_sparse_csr(m, n, k, nnz, test_count):
+def test_sparse_csr(m, n, k, nnz, test_count, dtype):
     start_timer = Event(enable_timing=True)
     stop_timer = Event(enable_timing=True)
 
-    csr = gen_sparse_csr((m, k), nnz)
-    mat = torch.randn(k, n, dtype=torch.double)
+    csr = gen_sparse_csr((m, k), nnz, dtype=dtype)
+    mat = torch.randn(k, n, dtype=dtype)
 
     times = []
     for _ in range(test_count):
@@ -23,12 +23,12 @@ def test_sparse_csr(m, n, k, nnz, test_count):
     return sum(times) / len(times)
 
 
-def test_sparse_coo(m, n, k, nnz, test_count):
+def test_sparse_coo(m, n, k, nnz, test_count, dtype):
     start_timer = Event(enable_timing=True)
     stop_timer = Event(enable_timing=True)
 
-    coo = gen_sparse_coo((m, k), nnz)
-    mat = torch.randn(k, n, dtype=torch.double)
+    coo = gen_sparse_coo((m, k), nnz, dtype=dtype)
+    mat = torch.randn(k, n, dtype=dtype)
 
     times = []
     for _ in range(test_count):
@@ -40,12 +40,12 @@ def test_sparse_coo(m, n, k, nnz, test_count):
     return sum(times) / len(times)
 
 
-def test_sparse_coo_and_csr(m, n, k, nnz, test_count):
+def test_sparse_coo_and_csr(m, n, k, nnz, test_count, dtype):
     start = Event(enable_timing=True)
     stop = Event(enable_timing=True)
 
-    coo, csr = gen_sparse_coo_and_csr((m, k), nnz)
-    mat = torch.randn((k, n), dtype=torch.double)
+    coo, csr = gen_sparse_coo_and_csr((m, k), nnz, dtype=dtype)
+    mat = torch.randn((k, n), dtype=dtype)
 
     times = []
     for _ in range(test_count):
@@ -77,6 +77,7 @@ if __name__ == "__main__":
     parser.add_argument("--n", default="1000", type=int)
     parser.add_argument("--k", default="1000", type=int)
     parser.add_argument("--nnz-ratio", "--nnz_ratio", default="0.1", type=float)
+    parser.add_argument("--dtype", default="float64", choices=["float32", "float64"])
     parser.add_argument("--outfile", default="stdout", type=str)
     parser.add_argument("--test-count", "--test_count", default="10", type=int)
 
@@ -94,14 +95,15 @@ if __name__ == "__main__":
     n = args.n
     k = args.k
     nnz_ratio = args.nnz_ratio
+    dtype = torch.float32 if args.dtype == "float32" else torch.float64
 
     nnz = int(nnz_ratio * m * k)
     if args.format == "csr":
-        time = test_sparse_csr(m, n, k, nnz, test_count)
+        time = test_sparse_csr(m, n, k, nnz, test_count, dtype)
     elif args.format == "coo":
-        time = test_sparse_coo(m, n, k, nnz, test_count)
+        time = test_sparse_coo(m, n, k, nnz, test_count, dtype)
     elif args.format == "both":
-        time_coo, time_csr = test_sparse_coo_and_csr(m, nnz, test_count)
+        time_coo, time_csr = test_sparse_coo_and_csr(m, n, k, nnz, test_count, dtype)
 
     if args.format == "both":
         print(
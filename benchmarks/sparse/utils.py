@@ -21,7 +21,7 @@ class Event:
         return end_event.time - self.time
 
 
-def gen_sparse_csr(shape, nnz):
+def gen_sparse_csr(shape, nnz, dtype=torch.double):
     fill_value = 0
     total_values = functools.reduce(operator.mul, shape, 1)
     dense = np.random.randn(total_values)
@@ -29,12 +29,12 @@ def gen_sparse_csr(shape, nnz):
 
     for f in fills:
         dense[f] = fill_value
-    dense = torch.from_numpy(dense.reshape(shape))
+    dense = torch.from_numpy(dense.reshape(shape)).to(dtype)
 
     return dense.to_sparse_csr()
 
 
-def gen_sparse_coo(shape, nnz):
+def gen_sparse_coo(shape, nnz, dtype=torch.double):
     dense = np.random.randn(*shape)
     values = []
     indices = [[], []]
@@ -45,10 +45,10 @@ def gen_sparse_coo(shape, nnz):
         indices[1].append(col)
         values.append(dense[row, col])
 
-    return torch.sparse_coo_tensor(indices, values, size=shape)
+    return torch.sparse_coo_tensor(indices, values, size=shape, dtype=dtype)
 
 
-def gen_sparse_coo_and_csr(shape, nnz):
+def gen_sparse_coo_and_csr(shape, nnz, dtype=torch.double):
     total_values = functools.reduce(operator.mul, shape, 1)
     dense = np.random.randn(total_values)
     fills = random.sample(list(range(total_values)), total_values - nnz)
@@ -56,5 +56,5 @@ def gen_sparse_coo_and_csr(shape, nnz):
     for f in fills:
         dense[f] = 0
 
-    dense = torch.from_numpy(dense.reshape(shape))
+    dense = torch.from_numpy(dense.reshape(shape)).to(dtype)
     return dense.to_sparse(), dense.to_sparse_csr()
@@ -668,6 +668,52 @@ TEST(StaticRuntime, CleanUpMemory) {
   }
 }
 
+TEST(StaticRuntime, FreezeMemoryPlan) {
+  const int embedding_size = 32;
+  const int num_features = 50;
+  const int max_batch_size = 32;
+  torch::jit::Module mod = getDeepAndWideSciptModel();
+
+  torch::jit::StaticModuleOptions opts;
+  opts.freeze_memory_plan = true;
+  torch::jit::StaticModule smod(mod, false, opts);
+  torch::jit::StaticRuntime runtime(smod);
+
+  auto run_batch = [&](int batch_size) {
+    auto ad_emb_packed = torch::randn({batch_size, 1, embedding_size});
+    auto user_emb = torch::randn({batch_size, 1, embedding_size});
+    auto wide = torch::randn({batch_size, num_features});
+
+    std::vector<at::IValue> inputs({ad_emb_packed, user_emb, wide});
+    auto expected = getTensor(mod.forward(inputs));
+
+    std::vector<c10::IValue> input_tensors({ad_emb_packed, user_emb, wide});
+    auto outputs = runtime(input_tensors, {}).toTupleRef().elements();
+    ASSERT_TRUE(outputs.size() > 0);
+    auto actual = outputs[0].toTensor();
+    runtime.check_for_memory_leak();
+    EXPECT_TRUE(
+        torch::allclose(expected, actual, /*rtol=*/1e-5, /*atol=*/1e-5));
+  };
+
+  // Warm up with the maximum batch until the capacities stabilize and the
+  // plan freezes.
+  run_batch(max_batch_size);
+  run_batch(max_batch_size);
+  run_batch(max_batch_size);
+  const auto* planner = runtime.get_memory_planner();
+  ASSERT_NE(planner, nullptr);
+  EXPECT_TRUE(planner->is_frozen());
+  const size_t planned_bytes = planner->total_managed();
+
+  // Smaller batches are carved out of the frozen arena without re-planning.
+  for (int batch_size : {1, 8, 16, max_batch_size}) {
+    run_batch(batch_size);
+    EXPECT_TRUE(runtime.get_memory_planner()->is_frozen());
+    EXPECT_EQ(runtime.get_memory_planner()->total_managed(), planned_bytes);
+  }
+}
+
 TEST(StaticRuntime, ManageOutputTensors) {
   const std::string test_graph = R"IR(
     graph(%0 : Tensor):
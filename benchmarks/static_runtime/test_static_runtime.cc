@@ -698,6 +698,62 @@ TEST(StaticRuntime, LayerNorm) {
   }
 }
 
+TEST(StaticRuntime, FusedCatLayerNorm) {
+  const std::string cat_layer_norm = R"JIT(
+    def forward(self, a: Tensor, b: Tensor, normalized_shape: List[int], weight: Tensor, bias: Tensor):
+        return torch.layer_norm(torch.cat([a, b], -1), normalized_shape, weight, bias, 1e-05, False).clone()
+  )JIT";
+
+  const std::string cat_layer_norm_without_weights = R"JIT(
+    def forward(self, a: Tensor, b: Tensor, normalized_shape: List[int]):
+        return torch.layer_norm(torch.cat([a, b], -1), normalized_shape, None, None, 1e-05, False).clone()
+  )JIT";
+
+  const std::string cat_dim0_layer_norm = R"JIT(
+    def forward(self, a: Tensor, b: Tensor, normalized_shape: List[int], weight: Tensor, bias: Tensor):
+        return torch.layer_norm(torch.cat([a, b], 0), normalized_shape, weight, bias, 1e-05, False).clone()
+  )JIT";
+
+  const auto a = torch::rand({3, 2});
+  const auto b = torch::rand({3, 4});
+  const auto c = torch::rand({5, 2});
+  const auto d = torch::rand({5, 4});
+  std::vector<int64_t> normalized_shape{6};
+  const auto weight = torch::rand(normalized_shape);
+  const auto bias = torch::rand(normalized_shape);
+
+  std::vector<IValue> args{a, b, normalized_shape, weight, bias};
+  std::vector<IValue> args2{c, d, normalized_shape, weight, bias};
+  testStaticRuntime(cat_layer_norm, args, {}, /*use_allclose=*/true);
+  testStaticRuntime(cat_layer_norm, args, args2, /*use_allclose=*/true);
+
+  testStaticRuntime(
+      cat_layer_norm_without_weights,
+      {a, b, normalized_shape},
+      {c, d, normalized_shape},
+      /*use_allclose=*/true);
+
+  // Concat along dim 0 takes the unfused fallback inside the op.
+  const auto e = torch::rand({3, 2});
+  std::vector<int64_t> normalized_shape_dim0{2};
+  testStaticRuntime(
+      cat_dim0_layer_norm,
+      {a,
+       e,
+       normalized_shape_dim0,
+       torch::rand(normalized_shape_dim0),
+       torch::rand(normalized_shape_dim0)},
+      {},
+      /*use_allclose=*/true);
+
+  script::Module module("cat_layer_norm");
+  module.define(cat_layer_norm);
+  torch::jit::StaticModule smodule(module);
+  EXPECT_FALSE(hasNodeWithKind(smodule, "aten::cat"));
+  EXPECT_FALSE(hasNodeWithKind(smodule, "aten::layer_norm"));
+  EXPECT_TRUE(hasNodeWithKind(smodule, "static_runtime::fused_cat_layer_norm"));
+}
+
 TEST(StaticRuntime, Bmm) {
   const auto bmm_script = R"JIT(
     def forward(self, inp: Tensor, mat2: Tensor):
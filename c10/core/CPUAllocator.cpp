@@ -7,6 +7,11 @@
 #include <c10/mobile/CPUProfilingAllocator.h>
 #include <c10/util/Logging.h>
 
+#include <array>
+#include <atomic>
+#include <utility>
+#include <vector>
+
 // TODO: rename flag to C10
 C10_DEFINE_bool(
     caffe2_report_cpu_memory_usage,
@@ -15,16 +20,306 @@ C10_DEFINE_bool(
 
 namespace c10 {
 
+namespace impl {
+
+struct MemoryBudgetState {
+  explicit MemoryBudgetState(size_t budget_bytes) : budget(budget_bytes) {}
+  const size_t budget;
+  std::atomic<size_t> current{0};
+  std::atomic<size_t> high_watermark{0};
+};
+
+struct ScopedArenaState {
+  // The slab pointer doubles as the ownership token: whoever exchanges it
+  // to nullptr (the scope on a clean exit, or the deleter of the last
+  // escaping block) is responsible for the memory.
+  std::atomic<void*> slab{nullptr};
+  size_t slab_size = 0;
+  // Bump pointer; only the owning thread advances it.
+  size_t offset = 0;
+  size_t total_allocated = 0;
+  std::atomic<size_t> live_blocks{0};
+  std::atomic<size_t> live_bytes{0};
+  std::atomic<bool> closed{false};
+};
+
+} // namespace impl
+
+namespace {
+
+// Innermost active budget scope on this thread, if any.
+thread_local std::shared_ptr<impl::MemoryBudgetState> active_memory_budget_;
+
+// Live budgeted blocks, keyed by data pointer. Kept outside the guard so
+// that frees on other threads, or after the guard has been destroyed,
+// still credit the scope that was charged. The scope is held by
+// shared_ptr so late frees stay safe.
+std::mutex budgeted_allocations_mutex_;
+using BudgetedAllocationMap = std::unordered_map<
+    void*,
+    std::pair<std::shared_ptr<impl::MemoryBudgetState>, size_t>>;
+BudgetedAllocationMap& budgeted_allocations() {
+  static auto* map = new BudgetedAllocationMap();
+  return *map;
+}
+// Number of live budgeted blocks. Lets the free path skip the table
+// lookup (and its lock) entirely in processes that never use budgets.
+std::atomic<size_t> budgeted_allocation_count_{0};
+
+// Innermost active arena scope on this thread, if any.
+thread_local std::shared_ptr<impl::ScopedArenaState> active_arena_;
+
+// Live arena blocks, keyed by data pointer, mirroring the budgeted
+// allocation table above: frees can happen on any thread and after the
+// scope has been destroyed, so the deleter resolves the owning arena
+// through this table rather than through TLS.
+std::mutex arena_allocations_mutex_;
+using ArenaAllocationMap = std::unordered_map<
+    void*,
+    std::pair<std::shared_ptr<impl::ScopedArenaState>, size_t>>;
+ArenaAllocationMap& arena_allocations() {
+  static auto* map = new ArenaAllocationMap();
+  return *map;
+}
+// Number of live arena blocks, so the free path stays a single atomic
+// load in processes that never open an arena scope.
+std::atomic<size_t> arena_allocation_count_{0};
+
+// One cached slab per thread, reused by consecutive arena scopes.
+struct ArenaSlabCache {
+  void* slab = nullptr;
+  size_t size = 0;
+  ~ArenaSlabCache() {
+    if (slab != nullptr) {
+      free_cpu(slab);
+    }
+  }
+};
+thread_local ArenaSlabCache arena_slab_cache_;
+
+} // namespace
+
+namespace impl {
+
+std::shared_ptr<MemoryBudgetState> chargeMemoryBudget(size_t nbytes) {
+  const auto& state = active_memory_budget_;
+  if (C10_LIKELY(state == nullptr) || nbytes == 0) {
+    return nullptr;
+  }
+  const size_t new_current =
+      state->current.fetch_add(nbytes, std::memory_order_relaxed) + nbytes;
+  if (C10_UNLIKELY(new_current > state->budget)) {
+    state->current.fetch_sub(nbytes, std::memory_order_relaxed);
+    TORCH_CHECK_WITH(
+        OutOfMemoryError,
+        false,
+        "CPU memory budget of ",
+        state->budget,
+        " bytes exceeded: ",
+        new_current - nbytes,
+        " bytes are charged to the current scope and the allocation requested ",
+        nbytes,
+        " more bytes");
+  }
+  size_t watermark = state->high_watermark.load(std::memory_order_relaxed);
+  while (watermark < new_current &&
+         !state->high_watermark.compare_exchange_weak(
+             watermark, new_current, std::memory_order_relaxed)) {
+  }
+  return state;
+}
+
+void unchargeMemoryBudget(
+    const std::shared_ptr<MemoryBudgetState>& state,
+    size_t nbytes) {
+  if (state) {
+    state->current.fetch_sub(nbytes, std::memory_order_relaxed);
+  }
+}
+
+void recordBudgetedAllocation(
+    void* ptr,
+    size_t nbytes,
+    std::shared_ptr<MemoryBudgetState> state) {
+  if (!state) {
+    return;
+  }
+  std::lock_guard<std::mutex> guard(budgeted_allocations_mutex_);
+  budgeted_allocations().emplace(ptr, std::make_pair(std::move(state), nbytes));
+  budgeted_allocation_count_.fetch_add(1, std::memory_order_release);
+}
+
+void creditMemoryBudget(void* ptr) {
+  if (C10_LIKELY(
+          budgeted_allocation_count_.load(std::memory_order_acquire) == 0)) {
+    return;
+  }
+  std::shared_ptr<MemoryBudgetState> state;
+  size_t nbytes = 0;
+  {
+    std::lock_guard<std::mutex> guard(budgeted_allocations_mutex_);
+    auto& table = budgeted_allocations();
+    auto it = table.find(ptr);
+    if (it == table.end()) {
+      // Allocated before any budget scope was active.
+      return;
+    }
+    state = std::move(it->second.first);
+    nbytes = it->second.second;
+    table.erase(it);
+    budgeted_allocation_count_.fetch_sub(1, std::memory_order_release);
+  }
+  state->current.fetch_sub(nbytes, std::memory_order_relaxed);
+}
+
+void* arenaTryAllocate(size_t nbytes) {
+  const auto& state = active_arena_;
+  if (C10_LIKELY(state == nullptr) || nbytes == 0) {
+    return nullptr;
+  }
+  // Bump in gAlignment steps so every carved-out block stays aligned.
+  const size_t rounded = (nbytes + gAlignment - 1) & ~(gAlignment - 1);
+  if (rounded > state->slab_size - state->offset) {
+    // Does not fit; let the caller take the regular allocation path.
+    return nullptr;
+  }
+  void* data =
+      static_cast<uint8_t*>(state->slab.load(std::memory_order_relaxed)) +
+      state->offset;
+  state->offset += rounded;
+  state->total_allocated += nbytes;
+  state->live_blocks.fetch_add(1, std::memory_order_relaxed);
+  state->live_bytes.fetch_add(nbytes, std::memory_order_relaxed);
+  {
+    std::lock_guard<std::mutex> guard(arena_allocations_mutex_);
+    arena_allocations().emplace(data, std::make_pair(state, nbytes));
+    arena_allocation_count_.fetch_add(1, std::memory_order_release);
+  }
+  return data;
+}
+
+bool arenaMaybeFree(void* ptr) {
+  if (C10_LIKELY(
+          arena_allocation_count_.load(std::memory_order_acquire) == 0)) {
+    return false;
+  }
+  std::shared_ptr<ScopedArenaState> state;
+  size_t nbytes = 0;
+  {
+    std::lock_guard<std::mutex> guard(arena_allocations_mutex_);
+    auto& table = arena_allocations();
+    auto it = table.find(ptr);
+    if (it == table.end()) {
+      // Not arena memory.
+      return false;
+    }
+    state = std::move(it->second.first);
+    nbytes = it->second.second;
+    table.erase(it);
+    arena_allocation_count_.fetch_sub(1, std::memory_order_release);
+  }
+  state->live_bytes.fetch_sub(nbytes, std::memory_order_relaxed);
+  if (state->live_blocks.fetch_sub(1, std::memory_order_acq_rel) == 1 &&
+      state->closed.load(std::memory_order_acquire)) {
+    // Last escaping block of a closed scope: reclaim the slab. It cannot
+    // go back to the slab cache because this may run on any thread.
+    void* slab = state->slab.exchange(nullptr);
+    if (slab != nullptr) {
+      free_cpu(slab);
+    }
+  }
+  return true;
+}
+
+} // namespace impl
+
+MemoryBudgetGuard::MemoryBudgetGuard(size_t budget_bytes)
+    : state_(std::make_shared<impl::MemoryBudgetState>(budget_bytes)),
+      prev_(std::exchange(active_memory_budget_, state_)) {}
+
+MemoryBudgetGuard::~MemoryBudgetGuard() {
+  active_memory_budget_ = std::move(prev_);
+}
+
+size_t MemoryBudgetGuard::current_bytes() const {
+  return state_->current.load(std::memory_order_relaxed);
+}
+
+size_t MemoryBudgetGuard::high_watermark_bytes() const {
+  return state_->high_watermark.load(std::memory_order_relaxed);
+}
+
+ScopedArenaAllocator::ScopedArenaAllocator(size_t slab_bytes)
+    : state_(std::make_shared<impl::ScopedArenaState>()) {
+  TORCH_CHECK(slab_bytes > 0, "ScopedArenaAllocator: slab_bytes must be > 0");
+  auto& cache = arena_slab_cache_;
+  if (cache.slab != nullptr && cache.size >= slab_bytes) {
+    state_->slab.store(
+        std::exchange(cache.slab, nullptr), std::memory_order_relaxed);
+    state_->slab_size = std::exchange(cache.size, 0);
+  } else {
+    state_->slab.store(alloc_cpu(slab_bytes), std::memory_order_relaxed);
+    state_->slab_size = slab_bytes;
+  }
+  prev_ = std::exchange(active_arena_, state_);
+}
+
+ScopedArenaAllocator::~ScopedArenaAllocator() {
+  active_arena_ = std::move(prev_);
+  // Publish the scope end before inspecting the live count; the deleter
+  // checks `closed` after its decrement, so between the two of us exactly
+  // one side observes the last block gone and reclaims the slab (the
+  // atomic exchange below breaks the tie if both do).
+  state_->closed.store(true, std::memory_order_release);
+  const size_t escaped = state_->live_blocks.load(std::memory_order_acquire);
+  if (escaped == 0) {
+    void* slab = state_->slab.exchange(nullptr);
+    if (slab != nullptr) {
+      auto& cache = arena_slab_cache_;
+      if (cache.slab == nullptr || cache.size < state_->slab_size) {
+        if (cache.slab != nullptr) {
+          free_cpu(cache.slab);
+        }
+        cache.slab = slab;
+        cache.size = state_->slab_size;
+      } else {
+        free_cpu(slab);
+      }
+    }
+  } else {
+    TORCH_WARN(
+        "ScopedArenaAllocator: ",
+        escaped,
+        " allocation(s) totaling ",
+        state_->live_bytes.load(std::memory_order_relaxed),
+        " bytes outlived their arena scope; the slab will be reclaimed "
+        "when the last of them is freed and will not be reused");
+  }
+}
+
+size_t ScopedArenaAllocator::allocated_bytes() const {
+  return state_->total_allocated;
+}
+
+size_t ScopedArenaAllocator::live_bytes() const {
+  return state_->live_bytes.load(std::memory_order_relaxed);
+}
+
 struct C10_API DefaultCPUAllocator final : at::Allocator {
   DefaultCPUAllocator() = default;
   at::DataPtr allocate(size_t nbytes) override {
-    void* data = nullptr;
-    try {
-      data = c10::alloc_cpu(nbytes);
-    } catch (c10::Error& e) {
-      profiledCPUMemoryReporter().OutOfMemory(nbytes);
-      throw e;
+    auto budget = impl::chargeMemoryBudget(nbytes);
+    void* data = impl::arenaTryAllocate(nbytes);
+    if (data == nullptr) {
+      try {
+        data = c10::alloc_cpu(nbytes);
+      } catch (c10::Error& e) {
+        impl::unchargeMemoryBudget(budget, nbytes);
+        profiledCPUMemoryReporter().OutOfMemory(nbytes);
+        throw e;
+      }
     }
+    impl::recordBudgetedAllocation(data, nbytes, std::move(budget));
     profiledCPUMemoryReporter().New(data, nbytes);
     return {data, data, &ReportAndDelete, at::Device(at::DeviceType::CPU)};
   }
@@ -33,8 +328,11 @@ struct C10_API DefaultCPUAllocator final : at::Allocator {
     if (!ptr) {
       return;
     }
+    impl::creditMemoryBudget(ptr);
     profiledCPUMemoryReporter().Delete(ptr);
-    free_cpu(ptr);
+    if (!impl::arenaMaybeFree(ptr)) {
+      free_cpu(ptr);
+    }
   }
 
   at::DeleterFnPtr raw_deleter() const override {
@@ -157,6 +455,155 @@ class DefaultMobileCPUAllocator final : public at::Allocator {
   }
 };
 
+// SmallObjectPoolCPUAllocator services small allocations out of
+// thread-local, size-class segregated free lists so that transient
+// sub-threshold tensors (e.g. scalars and small activations created via
+// at::empty) bypass malloc entirely on the hot path. Every block carries
+// a gAlignment-sized header recording its rounded-up size class, so the
+// deleter can return it to whichever thread's pool performs the free;
+// this keeps both the allocate and free paths lock free. Blocks larger
+// than the threshold fall through to alloc_cpu/free_cpu. Cached blocks
+// are periodically trimmed back to the OS so that a burst of small
+// allocations does not pin memory for the lifetime of the thread.
+namespace {
+
+// Blocks of up to 4KB are pooled; one power-of-two size class per
+// doubling starting at gAlignment (64B): 64, 128, ..., 4096.
+constexpr size_t kSmallObjectMaxBytes = 4096;
+constexpr size_t kNumSizeClasses = 7;
+// Per-class cap on cached blocks; anything beyond is returned to the OS.
+constexpr size_t kMaxCachedPerClass = 64;
+// Every this many frees, trim half of each class's cache back to the OS.
+constexpr size_t kTrimInterval = 8192;
+
+size_t size_class_index(size_t nbytes) {
+  size_t idx = 0;
+  size_t bytes = gAlignment;
+  while (bytes < nbytes) {
+    bytes <<= 1;
+    idx++;
+  }
+  return idx;
+}
+
+size_t size_class_bytes(size_t idx) {
+  return gAlignment << idx;
+}
+
+struct SmallObjectPool {
+  std::array<std::vector<void*>, kNumSizeClasses> free_lists;
+  size_t frees_since_trim = 0;
+
+  ~SmallObjectPool() {
+    for (auto& list : free_lists) {
+      for (void* block : list) {
+        free_cpu(block);
+      }
+    }
+  }
+
+  void trim() {
+    for (auto& list : free_lists) {
+      const size_t keep = list.size() / 2;
+      while (list.size() > keep) {
+        free_cpu(list.back());
+        list.pop_back();
+      }
+    }
+  }
+};
+
+SmallObjectPool& small_object_pool() {
+  static thread_local SmallObjectPool pool;
+  return pool;
+}
+
+} // namespace
+
+struct C10_API SmallObjectPoolCPUAllocator final : at::Allocator {
+  SmallObjectPoolCPUAllocator() = default;
+
+  at::DataPtr allocate(size_t nbytes) override {
+    auto budget = impl::chargeMemoryBudget(nbytes);
+    void* base = nullptr;
+    const size_t alloc_size = gAlignment + nbytes;
+    try {
+      if (nbytes > 0 && nbytes <= kSmallObjectMaxBytes) {
+        const size_t idx = size_class_index(nbytes);
+        auto& list = small_object_pool().free_lists[idx];
+        if (!list.empty()) {
+          base = list.back();
+          list.pop_back();
+        } else {
+          base = pooled_alloc(gAlignment + size_class_bytes(idx));
+        }
+        // Pooled blocks record their size class (in bytes) in the header.
+        *static_cast<size_t*>(base) = size_class_bytes(idx);
+      } else {
+        base = pooled_alloc(alloc_size);
+        // Zero marks an unpooled block: the deleter frees it directly.
+        *static_cast<size_t*>(base) = 0;
+      }
+    } catch (...) {
+      impl::unchargeMemoryBudget(budget, nbytes);
+      throw;
+    }
+    void* data = static_cast<uint8_t*>(base) + gAlignment;
+    impl::recordBudgetedAllocation(data, nbytes, std::move(budget));
+    profiledCPUMemoryReporter().New(data, nbytes);
+    return {data, base, &ReturnToPool, at::Device(at::DeviceType::CPU)};
+  }
+
+  static void ReturnToPool(void* ctx) {
+    if (!ctx) {
+      return;
+    }
+    impl::creditMemoryBudget(static_cast<uint8_t*>(ctx) + gAlignment);
+    profiledCPUMemoryReporter().Delete(
+        static_cast<uint8_t*>(ctx) + gAlignment);
+    const size_t class_bytes = *static_cast<size_t*>(ctx);
+    if (class_bytes == 0) {
+      free_cpu(ctx);
+      return;
+    }
+    auto& pool = small_object_pool();
+    auto& list = pool.free_lists[size_class_index(class_bytes)];
+    if (list.size() >= kMaxCachedPerClass) {
+      free_cpu(ctx);
+    } else {
+      list.push_back(ctx);
+    }
+    if (++pool.frees_since_trim >= kTrimInterval) {
+      pool.frees_since_trim = 0;
+      pool.trim();
+    }
+  }
+
+  at::DeleterFnPtr raw_deleter() const override {
+    return &ReturnToPool;
+  }
+
+  void copy_data(void* dest, const void* src, std::size_t count) const final {
+    default_copy_data(dest, src, count);
+  }
+
+ private:
+  static void* pooled_alloc(size_t alloc_size) {
+    try {
+      return c10::alloc_cpu(alloc_size);
+    } catch (c10::Error&) {
+      profiledCPUMemoryReporter().OutOfMemory(alloc_size);
+      throw;
+    }
+  }
+};
+
+static SmallObjectPoolCPUAllocator g_small_object_pool_cpu_alloc;
+
+at::Allocator* GetSmallObjectPoolCPUAllocator() {
+  return &g_small_object_pool_cpu_alloc;
+}
+
 void NoDelete(void*) {}
 
 at::Allocator* GetCPUAllocator() {
@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <cstring>
+#include <memory>
 #include <mutex>
 #include <unordered_map>
 
@@ -37,6 +38,111 @@ class C10_API ProfiledCPUMemoryReporter {
 
 C10_API ProfiledCPUMemoryReporter& profiledCPUMemoryReporter();
 
+namespace impl {
+struct MemoryBudgetState;
+struct ScopedArenaState;
+
+// Allocator-side hooks for ScopedArenaAllocator. arenaTryAllocate bump
+// allocates from the calling thread's innermost active arena scope and
+// returns nullptr when no scope is active or the slab cannot satisfy the
+// request (the caller then falls through to the regular allocation path).
+// arenaMaybeFree is called from the deleter with the data pointer and
+// returns true when the pointer was arena memory, in which case the
+// caller must not free it; the backing slab is reclaimed by the scope.
+C10_API void* arenaTryAllocate(size_t nbytes);
+C10_API bool arenaMaybeFree(void* ptr);
+
+// Allocator-side hooks for MemoryBudgetGuard. chargeMemoryBudget charges
+// nbytes to the calling thread's innermost active budget scope, throwing
+// c10::OutOfMemoryError (before any memory is handed out) if the scope's
+// budget would be exceeded; it returns the charged scope, or nullptr when
+// no scope is active. On allocation failure the caller must roll the
+// charge back with unchargeMemoryBudget. Successful allocations are
+// recorded with recordBudgetedAllocation so that creditMemoryBudget,
+// called from the deleter with the data pointer, can credit the scope
+// that was charged, even when the free happens on another thread or
+// after the guard has been destroyed.
+C10_API std::shared_ptr<MemoryBudgetState> chargeMemoryBudget(size_t nbytes);
+C10_API void unchargeMemoryBudget(
+    const std::shared_ptr<MemoryBudgetState>& state,
+    size_t nbytes);
+C10_API void recordBudgetedAllocation(
+    void* ptr,
+    size_t nbytes,
+    std::shared_ptr<MemoryBudgetState> state);
+C10_API void creditMemoryBudget(void* ptr);
+} // namespace impl
+
+// RAII scope that enforces a CPU memory budget for the current thread.
+// While the guard is alive, allocations made on this thread through the
+// default (and small-object pool) CPU allocators are charged against
+// budget_bytes; an allocation that would exceed the budget fails fast
+// with a catchable c10::OutOfMemoryError instead of letting one runaway
+// request OOM the whole process. Frees credit the scope that was
+// charged, wherever and whenever they happen. Guards nest: the innermost
+// guard on a thread receives the charges, and destroying it restores the
+// enclosing scope. Per-scope stats are readable while the guard is
+// alive, e.g. after serving a request:
+//
+//   c10::MemoryBudgetGuard guard(512ull * 1024 * 1024);
+//   serve_request();
+//   log_peak_bytes(guard.high_watermark_bytes());
+class C10_API MemoryBudgetGuard {
+ public:
+  explicit MemoryBudgetGuard(size_t budget_bytes);
+  ~MemoryBudgetGuard();
+  MemoryBudgetGuard(const MemoryBudgetGuard&) = delete;
+  MemoryBudgetGuard(MemoryBudgetGuard&&) = delete;
+  MemoryBudgetGuard& operator=(const MemoryBudgetGuard&) = delete;
+  MemoryBudgetGuard& operator=(MemoryBudgetGuard&&) = delete;
+
+  // Bytes currently charged to this scope.
+  size_t current_bytes() const;
+  // Largest number of bytes simultaneously charged to this scope.
+  size_t high_watermark_bytes() const;
+
+ private:
+  std::shared_ptr<impl::MemoryBudgetState> state_;
+  std::shared_ptr<impl::MemoryBudgetState> prev_;
+};
+
+// RAII scope that serves this thread's CPU allocations by bump allocation
+// from a reusable slab. While the scope is alive, allocations made on this
+// thread through the default CPU allocator that fit in the slab are carved
+// out of it with a pointer bump; their deleters only drop a reference, and
+// the whole slab is released in O(1) when the scope ends instead of one
+// free per tensor. The slab is cached per thread, so a serving loop that
+// opens a scope per request reuses the same memory request after request:
+//
+//   c10::ScopedArenaAllocator arena(16 << 20);
+//   serve_request();
+//   // scope end: every per-request tensor's memory is released at once
+//
+// Allocations that do not fit in the remaining slab fall through to the
+// regular allocation path and are freed individually as usual. Tensors
+// that outlive the scope are detected: the scope warns about them at exit
+// and keeps the slab alive until the last escaping tensor is freed (the
+// slab is not reused for a later scope in that case). Scopes nest; the
+// innermost scope on a thread receives the allocations.
+class C10_API ScopedArenaAllocator {
+ public:
+  explicit ScopedArenaAllocator(size_t slab_bytes);
+  ~ScopedArenaAllocator();
+  ScopedArenaAllocator(const ScopedArenaAllocator&) = delete;
+  ScopedArenaAllocator(ScopedArenaAllocator&&) = delete;
+  ScopedArenaAllocator& operator=(const ScopedArenaAllocator&) = delete;
+  ScopedArenaAllocator& operator=(ScopedArenaAllocator&&) = delete;
+
+  // Total bytes bump-allocated from the slab so far.
+  size_t allocated_bytes() const;
+  // Bytes of arena allocations that have not been freed yet.
+  size_t live_bytes() const;
+
+ private:
+  std::shared_ptr<impl::ScopedArenaState> state_;
+  std::shared_ptr<impl::ScopedArenaState> prev_;
+};
+
 // Get the CPU Allocator.
 C10_API at::Allocator* GetCPUAllocator();
 // Sets the CPU allocator to the given allocator: the caller gives away the
@@ -46,6 +152,15 @@ C10_API void SetCPUAllocator(at::Allocator* alloc, uint8_t priority = 0);
 // Get the Default CPU Allocator
 C10_API at::Allocator* GetDefaultCPUAllocator();
 
+// Get the small-object pool CPU allocator. This allocator services
+// allocations below a fixed size threshold out of thread-local,
+// size-class segregated free lists and periodically trims cached blocks
+// back to the OS; larger allocations fall through to alloc_cpu. It is
+// intended for workloads that create large numbers of small, transient
+// tensors and is opted into via SetCPUAllocator:
+//   c10::SetCPUAllocator(c10::GetSmallObjectPoolCPUAllocator());
+C10_API at::Allocator* GetSmallObjectPoolCPUAllocator();
+
 // Get the Default Mobile CPU Allocator
 C10_API at::Allocator* GetDefaultMobileCPUAllocator();
 
@@ -103,6 +103,7 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
     data_ptr_.clear();
     size_bytes_ = 0;
     size_bytes_is_heap_allocated_ = false;
+    reserved_nbytes_ = 0;
   }
 
   // Destructor doesn't call release_resources because it's
@@ -131,6 +132,19 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
     size_bytes_ = std::move(size_bytes);
   }
 
+  // Number of bytes actually allocated for this storage when a capacity
+  // larger than nbytes() has been reserved (see Tensor.reserve_()).  Zero
+  // means no capacity was explicitly reserved and the allocation matches
+  // nbytes(); resizing such a storage keeps the historical
+  // reallocate-and-copy behavior.
+  size_t reserved_nbytes() const {
+    return reserved_nbytes_;
+  }
+
+  void set_reserved_nbytes(size_t reserved_nbytes) {
+    reserved_nbytes_ = reserved_nbytes;
+  }
+
   bool resizable() const {
     return resizable_;
   }
@@ -173,6 +187,9 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
 
   void set_data_ptr_noswap(at::DataPtr&& data_ptr) {
     data_ptr_ = std::move(data_ptr);
+    // The capacity of the new allocation is unknown; callers that reserve
+    // extra capacity record it explicitly afterwards.
+    reserved_nbytes_ = 0;
     refresh_has_data_ptr_check();
   }
 
@@ -251,6 +268,7 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
     data_ptr_ = std::move(data_ptr);
     size_bytes_ = static_cast<int64_t>(size_bytes);
     size_bytes_is_heap_allocated_ = false;
+    reserved_nbytes_ = 0;
     allocator_ = nullptr;
     resizable_ = false;
   }
@@ -308,6 +326,7 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
   at::DataPtr set_data_ptr_no_materialize_cow(at::DataPtr&& data_ptr) {
     at::DataPtr old_data_ptr(std::move(data_ptr_));
     data_ptr_ = std::move(data_ptr);
+    reserved_nbytes_ = 0;
     refresh_has_data_ptr_check();
     return old_data_ptr;
   }
@@ -331,6 +350,9 @@ struct C10_API StorageImpl : public c10::intrusive_ptr_target {
 
   DataPtr data_ptr_;
   SymInt size_bytes_;
+  // Allocated capacity in bytes when it exceeds the logical size; see
+  // reserved_nbytes().
+  size_t reserved_nbytes_ = 0;
   bool size_bytes_is_heap_allocated_;
   bool resizable_;
   // Identifies that Storage was received from another process and doesn't have
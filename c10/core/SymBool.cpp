@@ -1,4 +1,5 @@
 #include <c10/core/SymBool.h>
+#include <c10/core/SymExprCache.h>
 #include <c10/core/SymNodeImpl.h>
 
 namespace c10 {
@@ -60,16 +61,39 @@ bool SymBool::guard_bool(const char* file, int64_t line) const {
   if (auto ma = maybe_as_bool()) {
     return *ma;
   }
+  auto& cache = SymExprCache::get();
+  if (cache.enabled()) {
+    if (auto memo = cache.lookup(
+            toSymNodeImplUnowned(), SymExprCache::Kind::GuardBool)) {
+      return *memo != 0;
+    }
+  }
   SymNode a = toSymNodeImpl();
-  return a->guard_bool(file, line);
+  bool result = a->guard_bool(file, line);
+  if (cache.enabled()) {
+    cache.memoize(std::move(a), SymExprCache::Kind::GuardBool, result ? 1 : 0);
+  }
+  return result;
 }
 
 bool SymBool::guard_size_oblivious(const char* file, int64_t line) const {
   if (auto ma = maybe_as_bool()) {
     return *ma;
   }
+  auto& cache = SymExprCache::get();
+  if (cache.enabled()) {
+    if (auto memo = cache.lookup(
+            toSymNodeImplUnowned(), SymExprCache::Kind::GuardSizeOblivious)) {
+      return *memo != 0;
+    }
+  }
   SymNode a = toSymNodeImpl();
-  return a->guard_size_oblivious(file, line);
+  bool result = a->guard_size_oblivious(file, line);
+  if (cache.enabled()) {
+    cache.memoize(
+        std::move(a), SymExprCache::Kind::GuardSizeOblivious, result ? 1 : 0);
+  }
+  return result;
 }
 
 bool SymBool::expect_true(const char* file, int64_t line) const {
@@ -0,0 +1,43 @@
+#include <c10/core/SymExprCache.h>
+
+namespace c10 {
+
+SymExprCache& SymExprCache::get() {
+  static thread_local SymExprCache cache;
+  return cache;
+}
+
+std::optional<int64_t> SymExprCache::lookup(
+    const SymNodeImpl* node,
+    Kind kind) const {
+  auto it = memo_.find(Key{node, kind});
+  if (it == memo_.end()) {
+    return std::nullopt;
+  }
+  return it->second.value;
+}
+
+void SymExprCache::memoize(SymNode node, Kind kind, int64_t value) {
+  const SymNodeImpl* key_node = node.get();
+  memo_.emplace(Key{key_node, kind}, Entry{std::move(node), value});
+}
+
+void SymExprCache::clear() {
+  memo_.clear();
+}
+
+SymExprCacheGuard::SymExprCacheGuard() {
+  auto& cache = SymExprCache::get();
+  prev_enabled_ = cache.enabled_;
+  cache.enabled_ = true;
+}
+
+SymExprCacheGuard::~SymExprCacheGuard() {
+  auto& cache = SymExprCache::get();
+  cache.enabled_ = prev_enabled_;
+  if (!prev_enabled_) {
+    cache.clear();
+  }
+}
+
+} // namespace c10
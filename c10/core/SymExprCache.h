@@ -0,0 +1,87 @@
+#pragma once
+
+#include <c10/core/SymNodeImpl.h>
+#include <c10/macros/Export.h>
+#include <c10/util/flat_hash_map.h>
+
+#include <cstdint>
+#include <optional>
+
+namespace c10 {
+
+// Memo table for guarded symbolic-expression evaluations.
+//
+// With dynamic shapes, every guard on a heap-allocated SymInt/SymBool
+// (guard_int, guard_bool, guard_size_oblivious) makes a virtual call into
+// SymNodeImpl and typically crosses into Python to evaluate the underlying
+// expression. Eager code re-evaluates the same expression once per
+// consumer: is_contiguous() on one tensor queried by several kernels, or
+// one size expression checked by many ops within a step.
+//
+// When enabled (see SymExprCacheGuard), the first evaluation of a node is
+// memoized keyed on the node's identity, and later evaluations are served
+// from the table. A node is an immutable expression whose hint does not
+// change, so a memo stays valid as long as it refers to the same node; the
+// cache pins each memoized node so its pointer cannot be recycled while
+// cached. The table is thread local and meant to be scoped to one step.
+// Repeated guards on one expression are deduplicated by the ShapeEnv
+// anyway, but suppressing re-evaluation is only appropriate when no
+// tracing is collecting guards, which is why the cache is opt-in and is
+// cleared when the outermost guard goes out of scope.
+class C10_API SymExprCache {
+ public:
+  // Different evaluation methods on the same node can produce different
+  // results, so each is memoized under its own kind.
+  enum class Kind : uint8_t { GuardInt, GuardBool, GuardSizeOblivious };
+
+  static SymExprCache& get();
+
+  bool enabled() const {
+    return enabled_;
+  }
+
+  std::optional<int64_t> lookup(const SymNodeImpl* node, Kind kind) const;
+  void memoize(SymNode node, Kind kind, int64_t value);
+  void clear();
+
+ private:
+  friend struct SymExprCacheGuard;
+
+  struct Key {
+    const SymNodeImpl* node;
+    Kind kind;
+    bool operator==(const Key& other) const {
+      return node == other.node && kind == other.kind;
+    }
+  };
+  struct KeyHash {
+    size_t operator()(const Key& key) const {
+      return std::hash<const void*>()(key.node) ^
+          (static_cast<size_t>(key.kind) << 1);
+    }
+  };
+  struct Entry {
+    SymNode node; // owns the node so the pointer key stays unique
+    int64_t value;
+  };
+
+  bool enabled_ = false;
+  ska::flat_hash_map<Key, Entry, KeyHash> memo_;
+};
+
+// RAII guard that enables the thread-local SymExprCache. Wrap one serving
+// step with it; the table is dropped when the outermost guard exits, so
+// nodes from a previous step never satisfy a later lookup.
+struct C10_API SymExprCacheGuard {
+  SymExprCacheGuard();
+  ~SymExprCacheGuard();
+  SymExprCacheGuard(const SymExprCacheGuard&) = delete;
+  SymExprCacheGuard(SymExprCacheGuard&&) = delete;
+  SymExprCacheGuard& operator=(const SymExprCacheGuard&) = delete;
+  SymExprCacheGuard& operator=(SymExprCacheGuard&&) = delete;
+
+ private:
+  bool prev_enabled_;
+};
+
+} // namespace c10
@@ -1,4 +1,5 @@
 #include <c10/core/ConstantSymNodeImpl.h>
+#include <c10/core/SymExprCache.h>
 #include <c10/core/SymFloat.h>
 #include <c10/core/SymInt.h>
 #include <c10/core/SymNodeImpl.h>
@@ -120,9 +121,20 @@ SymInt SymInt::clone() const {
 int64_t SymInt::guard_int(const char* file, int64_t line) const {
   if (auto ma = maybe_as_int()) {
     return *ma;
-  } else {
-    return toSymNodeImplUnowned()->guard_int(file, line);
   }
+  auto& cache = SymExprCache::get();
+  if (cache.enabled()) {
+    if (auto memo = cache.lookup(
+            toSymNodeImplUnowned(), SymExprCache::Kind::GuardInt)) {
+      return *memo;
+    }
+  }
+  SymNode a = toSymNode();
+  int64_t result = a->guard_int(file, line);
+  if (cache.enabled()) {
+    cache.memoize(std::move(a), SymExprCache::Kind::GuardInt, result);
+  }
+  return result;
 }
 
 bool SymInt::expect_size(const char* file, int64_t line) const {
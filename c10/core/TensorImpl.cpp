@@ -177,6 +177,23 @@ TensorImpl::TensorImpl(
   // Caffe2 operators create Storages with default devices.
 }
 
+void TensorImpl::convert_to_inference_tensor() {
+  if (is_inference()) {
+    return;
+  }
+  TORCH_CHECK(
+      !requires_grad(),
+      "Cannot convert a tensor that requires grad to an inference tensor");
+  TORCH_CHECK(
+      unique_version(),
+      "Cannot convert a tensor to an inference tensor while its version "
+      "counter is shared (e.g. the tensor is saved for backward or aliased "
+      "by a normal tensor)");
+  key_set_ = key_set_ - c10::autograd_dispatch_keyset_with_ADInplaceOrView;
+  version_counter_ = VariableVersion(VariableVersion::DISABLED);
+  autograd_meta_ = nullptr;
+}
+
 void TensorImpl::_change_backend_component_keys(c10::Device device) {
   BackendComponent new_backend = toBackendComponent(device.type());
   BackendComponent old_backend = key_set_.highestBackendKey();
@@ -1239,6 +1239,16 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     return no_ADInplaceOrView && no_Autograd;
   }
 
+  /**
+   * Converts this tensor in place into an inference tensor, as if it had
+   * been created inside an InferenceMode region: the autograd and
+   * ADInplaceOrView keys are removed, the autograd metadata is freed and
+   * the version counter is disabled. Only valid for tensors that do not
+   * require grad and whose version counter is not shared (e.g. not saved
+   * for backward and not aliased by a normal view).
+   */
+  void convert_to_inference_tensor();
+
   DeviceIndex get_device() const {
     if (C10_UNLIKELY(device_policy_)) {
       return device_custom().index();
@@ -1884,6 +1894,10 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     refresh_numel();
     refresh_contiguous();
 
+    if (C10_UNLIKELY(impl::geometry_interning_enabled())) {
+      sizes_and_strides_.intern_geometry();
+    }
+
     if (storage_offset.has_value()) {
       storage_offset_ = *storage_offset;
     }
@@ -1908,6 +1922,28 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     return allow_tensor_metadata_change_;
   }
 
+  /**
+   * Declare that this tensor's sizes and strides will no longer change, so
+   * the cached contiguity/memory-format flags computed at freeze time stay
+   * valid and `refresh_contiguous()` becomes a no-op. Intended for
+   * static-shape inference workloads (e.g. capture-replay) where the same
+   * impls are resized to identical geometry on every iteration and the
+   * compute_contiguous passes are pure overhead. The caller is responsible
+   * for unfreezing before actually changing sizes or strides; a frozen
+   * tensor whose geometry is mutated will carry stale contiguity flags.
+   */
+  void _set_geometry_frozen(bool frozen) {
+    geometry_is_frozen_ = frozen;
+  }
+
+  /**
+   * True if the tensor's geometry has been frozen with
+   * `_set_geometry_frozen(true)`; see that method for details.
+   */
+  bool is_geometry_frozen() const {
+    return geometry_is_frozen_;
+  }
+
   /**
    * Set the pointer to autograd metadata.
    */
@@ -2725,6 +2761,11 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
    * or strides.
    */
   void refresh_contiguous() {
+    if (C10_UNLIKELY(geometry_is_frozen_)) {
+      // The flags computed at freeze time are still valid; see
+      // _set_geometry_frozen().
+      return;
+    }
     if (has_symbolic_sizes_strides_) {
       symbolic_shape_meta().refresh_contiguous();
     } else {
@@ -2917,6 +2958,7 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
     layout_policy_ = false;
     storage_access_should_throw_ = false;
     has_symbolic_sizes_strides_ = false;
+    geometry_is_frozen_ = false;
   }
 
   // Tensor is contiguous
@@ -2969,6 +3011,13 @@ struct C10_API TensorImpl : public c10::intrusive_ptr_target {
   // which fields are copied by value.
   bool allow_tensor_metadata_change_ : 1;
 
+  // Sizes and strides are declared immutable; refresh_contiguous() keeps
+  // the flags computed at freeze time. See _set_geometry_frozen().
+  // Deliberately NOT propagated by copy_generic_tensor_metadata: a
+  // shallow copy / detached impl may legitimately be re-strided, so it
+  // starts unfrozen.
+  bool geometry_is_frozen_ : 1;
+
   // we decide to keep reserved_ and it will
   // live in Tensor after the split
   // The logic is that if Extend() or ReserveSpace() were ever called,
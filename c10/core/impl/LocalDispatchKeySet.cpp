@@ -17,6 +17,10 @@ thread_local PODLocalDispatchKeySet raw_local_dispatch_key_set;
 LocalDispatchKeySet tls_local_dispatch_key_set() {
   return raw_local_dispatch_key_set;
 }
+
+PODLocalDispatchKeySet tls_raw_local_dispatch_key_set() {
+  return raw_local_dispatch_key_set;
+}
 #endif // defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
 
 void _force_tls_local_dispatch_key_set(LocalDispatchKeySet key_set) {
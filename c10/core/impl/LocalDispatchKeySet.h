@@ -64,6 +64,7 @@ struct C10_API LocalDispatchKeySet {
 // Inlining this seems to break AutoDispatchBelowAutograd on Android.
 #if defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
 C10_API LocalDispatchKeySet tls_local_dispatch_key_set();
+C10_API PODLocalDispatchKeySet tls_raw_local_dispatch_key_set();
 #else // defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
 extern C10_API thread_local PODLocalDispatchKeySet raw_local_dispatch_key_set;
 
@@ -72,6 +73,13 @@ inline C10_API LocalDispatchKeySet tls_local_dispatch_key_set() {
   // because they include this header.
   return raw_local_dispatch_key_set;
 }
+
+// Raw view of the TLS for hot paths that want to detect the all-zero
+// "this thread never touched a mode or dispatch key guard" state before
+// paying for the default-set adjustments. See computeDispatchKeySet.
+inline C10_API PODLocalDispatchKeySet tls_raw_local_dispatch_key_set() {
+  return raw_local_dispatch_key_set;
+}
 #endif // defined(_MSC_VER) || defined(C10_ANDROID) || defined(C10_IPHONE)
 
 // Internal, use ThreadLocalStateGuard
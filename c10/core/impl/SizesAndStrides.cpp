@@ -1,10 +1,137 @@
 #include <c10/core/impl/SizesAndStrides.h>
 
+#include <c10/util/hash.h>
+
+#include <atomic>
+#include <cstring>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
 namespace c10::impl {
 
+namespace {
+
+std::atomic<bool> geometry_interning_enabled_{false};
+
+// Hash-consed immutable geometry record: a refcount header followed by
+// the sizes-then-strides payload in SizesAndStrides' out-of-line layout.
+struct GeometryRecord {
+  explicit GeometryRecord(uint64_t initial_refcount)
+      : refcount(initial_refcount) {}
+
+  std::atomic<uint64_t> refcount;
+
+  int64_t* data() noexcept {
+    return reinterpret_cast<int64_t*>(this + 1);
+  }
+
+  static GeometryRecord* fromData(int64_t* data) noexcept {
+    return reinterpret_cast<GeometryRecord*>(data) - 1;
+  }
+};
+
+static_assert(
+    sizeof(GeometryRecord) % alignof(int64_t) == 0,
+    "GeometryRecord header must preserve payload alignment");
+
+struct GeometryKeyHash {
+  size_t operator()(const std::vector<int64_t>& key) const noexcept {
+    size_t seed = key.size();
+    for (const auto value : key) {
+      seed = c10::hash_combine(seed, std::hash<int64_t>()(value));
+    }
+    return seed;
+  }
+};
+
+std::mutex& internTableMutex() {
+  static auto* mutex = new std::mutex();
+  return *mutex;
+}
+
+// Keyed by the concatenated sizes-then-strides payload. The table keeps
+// one reference per record and records are never evicted: the mode
+// targets workloads cycling over a small set of recurring geometries,
+// where reuse matters more than reclaiming a few hundred bytes.
+std::unordered_map<std::vector<int64_t>, GeometryRecord*, GeometryKeyHash>&
+internTable() {
+  static auto* table = new std::
+      unordered_map<std::vector<int64_t>, GeometryRecord*, GeometryKeyHash>();
+  return *table;
+}
+
+} // namespace
+
+void set_geometry_interning_enabled(bool enabled) {
+  geometry_interning_enabled_.store(enabled, std::memory_order_relaxed);
+}
+
+bool geometry_interning_enabled() {
+  return geometry_interning_enabled_.load(std::memory_order_relaxed);
+}
+
+int64_t* SizesAndStrides::retainInternedStorage(int64_t* tagged) noexcept {
+  GeometryRecord::fromData(untagged(tagged))
+      ->refcount.fetch_add(1, std::memory_order_relaxed);
+  return tagged;
+}
+
+void SizesAndStrides::releaseInternedStorage(int64_t* tagged) noexcept {
+  // The intern table holds its own reference, so the count stays
+  // positive while the record remains discoverable; the record itself is
+  // never freed (see internTable()).
+  GeometryRecord::fromData(untagged(tagged))
+      ->refcount.fetch_sub(1, std::memory_order_acq_rel);
+}
+
+void SizesAndStrides::unshareInternedStorage() {
+  const int64_t* shared = untagged(outOfLineStorage_);
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  int64_t* plain = static_cast<int64_t*>(malloc(storageBytes(size_)));
+  TORCH_CHECK(plain, "Could not allocate memory for Tensor SizesAndStrides!");
+  memcpy(plain, shared, storageBytes(size_));
+  releaseInternedStorage(outOfLineStorage_);
+  outOfLineStorage_ = plain;
+}
+
+void SizesAndStrides::intern_geometry() {
+  if (isInline() || isInterned(outOfLineStorage_)) {
+    return;
+  }
+  std::vector<int64_t> key(outOfLineStorage_, outOfLineStorage_ + 2 * size_);
+  GeometryRecord* record = nullptr;
+  {
+    std::lock_guard<std::mutex> guard(internTableMutex());
+    auto& table = internTable();
+    auto it = table.find(key);
+    if (it == table.end()) {
+      // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+      auto* mem = malloc(sizeof(GeometryRecord) + storageBytes(size_));
+      TORCH_CHECK(
+          mem, "Could not allocate memory for interned Tensor geometry!");
+      // Refcount 1 is the table's own reference.
+      record = new (mem) GeometryRecord(1);
+      memcpy(record->data(), outOfLineStorage_, storageBytes(size_));
+      table.emplace(std::move(key), record);
+    } else {
+      record = it->second;
+    }
+    record->refcount.fetch_add(1, std::memory_order_relaxed);
+  }
+  // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+  free(outOfLineStorage_);
+  outOfLineStorage_ = reinterpret_cast<int64_t*>(
+      reinterpret_cast<uintptr_t>(record->data()) | kInternedTag);
+}
+
 void SizesAndStrides::resizeSlowPath(
     const size_t newSize,
     const size_t oldSize) {
+  // Resizing is a mutation; work on private storage.
+  if (C10_UNLIKELY(!isInline() && isInterned(outOfLineStorage_))) {
+    unshareInternedStorage();
+  }
   if (newSize <= C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE) {
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
         !isInline(),
@@ -11,6 +11,17 @@
 
 namespace c10::impl {
 
+// When enabled, TensorImpl::set_sizes_and_strides() hash-conses
+// out-of-line (more than C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE dims)
+// geometry into shared immutable records, so tensors recurring over a
+// small set of high-dimensional shapes reference one cache-resident
+// copy instead of each holding a private heap allocation. A record is
+// copied back out to private storage on the first mutation. Inline
+// geometries are left alone: they already live inside TensorImpl and
+// are both smaller and faster to reach than a shared record.
+C10_API void set_geometry_interning_enabled(bool enabled);
+C10_API bool geometry_interning_enabled();
+
 // Packed container for TensorImpl sizes and strides.
 // This design improves on the previous approach of using a pair of
 // c10::SmallVector<int64_t, 5> by specializing for the operations we
@@ -37,8 +48,7 @@ class C10_API SizesAndStrides {
 
   ~SizesAndStrides() {
     if (C10_UNLIKELY(!isInline())) {
-      // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
-      free(outOfLineStorage_);
+      freeOutOfLineStorage();
     }
   }
 
@@ -46,6 +56,8 @@ class C10_API SizesAndStrides {
   SizesAndStrides(const SizesAndStrides& rhs) : size_(rhs.size_) {
     if (C10_LIKELY(rhs.isInline())) {
       copyDataInline(rhs);
+    } else if (C10_UNLIKELY(isInterned(rhs.outOfLineStorage_))) {
+      outOfLineStorage_ = retainInternedStorage(rhs.outOfLineStorage_);
     } else {
       allocateOutOfLineStorage(size_);
       copyDataOutline(rhs);
@@ -58,13 +70,20 @@ class C10_API SizesAndStrides {
     }
     if (C10_LIKELY(rhs.isInline())) {
       if (C10_UNLIKELY(!isInline())) {
-        // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
-        free(outOfLineStorage_);
+        freeOutOfLineStorage();
       }
       copyDataInline(rhs);
+    } else if (C10_UNLIKELY(isInterned(rhs.outOfLineStorage_))) {
+      if (!isInline()) {
+        freeOutOfLineStorage();
+      }
+      outOfLineStorage_ = retainInternedStorage(rhs.outOfLineStorage_);
     } else {
       if (isInline()) {
         allocateOutOfLineStorage(rhs.size_);
+      } else if (C10_UNLIKELY(isInterned(outOfLineStorage_))) {
+        releaseInternedStorage(outOfLineStorage_);
+        allocateOutOfLineStorage(rhs.size_);
       } else {
         resizeOutOfLineStorage(rhs.size_);
       }
@@ -93,15 +112,14 @@ class C10_API SizesAndStrides {
     }
     if (C10_LIKELY(rhs.isInline())) {
       if (C10_UNLIKELY(!isInline())) {
-        // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
-        free(outOfLineStorage_);
+        freeOutOfLineStorage();
       }
       copyDataInline(rhs);
     } else {
-      // They're outline. We're going to steal their vector.
+      // They're outline. We're going to steal their vector (stealing an
+      // interned pointer transfers its reference).
       if (!isInline()) {
-        // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
-        free(outOfLineStorage_);
+        freeOutOfLineStorage();
       }
       outOfLineStorage_ = rhs.outOfLineStorage_;
       rhs.outOfLineStorage_ = nullptr;
@@ -120,7 +138,7 @@ class C10_API SizesAndStrides {
     if (C10_LIKELY(isInline())) {
       return &inlineStorage_[0];
     } else {
-      return &outOfLineStorage_[0];
+      return outOfLineData();
     }
   }
 
@@ -128,7 +146,7 @@ class C10_API SizesAndStrides {
     if (C10_LIKELY(isInline())) {
       return &inlineStorage_[0];
     } else {
-      return &outOfLineStorage_[0];
+      return mutableOutOfLineData();
     }
   }
 
@@ -166,7 +184,7 @@ class C10_API SizesAndStrides {
     if (C10_LIKELY(isInline())) {
       return &inlineStorage_[C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE];
     } else {
-      return &outOfLineStorage_[size()];
+      return outOfLineData() + size();
     }
   }
 
@@ -174,7 +192,7 @@ class C10_API SizesAndStrides {
     if (C10_LIKELY(isInline())) {
       return &inlineStorage_[C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE];
     } else {
-      return &outOfLineStorage_[size()];
+      return mutableOutOfLineData() + size();
     }
   }
 
@@ -182,7 +200,7 @@ class C10_API SizesAndStrides {
     if (C10_LIKELY(isInline())) {
       return &inlineStorage_[C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE];
     } else {
-      return &outOfLineStorage_[size()];
+      return outOfLineData() + size();
     }
   }
 
@@ -190,7 +208,7 @@ class C10_API SizesAndStrides {
     if (C10_LIKELY(isInline())) {
       return &inlineStorage_[C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE];
     } else {
-      return &outOfLineStorage_[size()];
+      return mutableOutOfLineData() + size();
     }
   }
 
@@ -268,11 +286,66 @@ class C10_API SizesAndStrides {
 
   void resizeSlowPath(size_t newSize, size_t oldSize);
 
+  // Replace out-of-line storage with a shared record from the global
+  // intern table (see geometry_interning_enabled()). No-op for inline or
+  // already-interned geometry.
+  void intern_geometry();
+
+  bool is_interned() const noexcept {
+    return !isInline() && isInterned(outOfLineStorage_);
+  }
+
  private:
   bool isInline() const noexcept {
     return size_ <= C10_SIZES_AND_STRIDES_MAX_INLINE_SIZE;
   }
 
+  // Interned out-of-line storage points into a shared refcounted record;
+  // the low pointer bit marks it so mutable accessors know to copy the
+  // record back out before handing out a writable pointer.
+  static constexpr uintptr_t kInternedTag = 1;
+
+  static bool isInterned(const int64_t* p) noexcept {
+    return (reinterpret_cast<uintptr_t>(p) & kInternedTag) != 0;
+  }
+
+  static int64_t* untagged(int64_t* p) noexcept {
+    return reinterpret_cast<int64_t*>(
+        reinterpret_cast<uintptr_t>(p) & ~kInternedTag);
+  }
+
+  static const int64_t* untagged(const int64_t* p) noexcept {
+    return reinterpret_cast<const int64_t*>(
+        reinterpret_cast<uintptr_t>(p) & ~kInternedTag);
+  }
+
+  static int64_t* retainInternedStorage(int64_t* tagged) noexcept;
+  static void releaseInternedStorage(int64_t* tagged) noexcept;
+
+  // Copy the shared record into freshly allocated private storage and
+  // drop our reference to it.
+  void unshareInternedStorage();
+
+  const int64_t* outOfLineData() const noexcept {
+    return untagged(outOfLineStorage_);
+  }
+
+  int64_t* mutableOutOfLineData() {
+    if (C10_UNLIKELY(isInterned(outOfLineStorage_))) {
+      unshareInternedStorage();
+    }
+    return outOfLineStorage_;
+  }
+
+  void freeOutOfLineStorage() {
+    if (C10_UNLIKELY(isInterned(outOfLineStorage_))) {
+      releaseInternedStorage(outOfLineStorage_);
+    } else {
+      // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+      free(outOfLineStorage_);
+    }
+  }
+
   void copyDataInline(const SizesAndStrides& rhs) {
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(rhs.isInline());
     memcpy(inlineStorage_, rhs.inlineStorage_, sizeof(inlineStorage_));
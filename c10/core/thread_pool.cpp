@@ -99,6 +99,52 @@ void ThreadPool::run(std::function<void()> func) {
   condition_.notify_one();
 }
 
+void ThreadPool::run_prioritized(std::function<void()> func) {
+  if (threads_.empty()) {
+    throw std::runtime_error("No threads to run a task");
+  }
+  std::unique_lock<std::mutex> lock(mutex_);
+
+  prioritized_tasks_.emplace(std::move(func));
+  complete_ = false;
+  condition_.notify_one();
+}
+
+bool ThreadPool::tryRunPrioritizedTask() {
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (prioritized_tasks_.empty()) {
+    return false;
+  }
+  {
+    task_element_t task = std::move(prioritized_tasks_.front());
+    prioritized_tasks_.pop();
+    lock.unlock();
+
+    try {
+      if (task.run_with_id) {
+        // Helping threads are external to the pool; they have no worker
+        // index of their own.
+        task.with_id(0);
+      } else {
+        task.no_id();
+      }
+    } catch (const std::exception& e) {
+      LOG(ERROR) << "Exception in thread pool task: " << e.what();
+    } catch (...) {
+      LOG(ERROR) << "Exception in thread pool task: unknown";
+    }
+  }
+
+  // The last queued task may have been run here rather than in
+  // main_loop(), so keep waitWorkComplete()'s invariant up to date.
+  lock.lock();
+  if (tasks_.empty() && prioritized_tasks_.empty() && available_ == total_) {
+    complete_ = true;
+    completed_.notify_one();
+  }
+  return true;
+}
+
 void ThreadPool::waitWorkComplete() {
   std::unique_lock<std::mutex> lock(mutex_);
   completed_.wait(lock, [&]() { return complete_; });
@@ -109,7 +155,9 @@ void ThreadPool::main_loop(std::size_t index) {
   while (running_) {
     // Wait on condition variable while the task is empty and
     // the pool is still running.
-    condition_.wait(lock, [&]() { return !tasks_.empty() || !running_; });
+    condition_.wait(lock, [&]() {
+      return !tasks_.empty() || !prioritized_tasks_.empty() || !running_;
+    });
     // If pool is no longer running, break out of loop.
     if (!running_) {
       break;
@@ -121,8 +169,9 @@ void ThreadPool::main_loop(std::size_t index) {
     // useful in the event that the function contains
     // shared_ptr arguments bound via bind.
     {
-      task_element_t tasks = std::move(tasks_.front());
-      tasks_.pop();
+      auto& queue = prioritized_tasks_.empty() ? tasks_ : prioritized_tasks_;
+      task_element_t tasks = std::move(queue.front());
+      queue.pop();
       // Decrement count, indicating thread is no longer available.
       --available_;
 
@@ -154,7 +203,7 @@ void ThreadPool::main_loop(std::size_t index) {
 
     // Increment count, indicating thread is available.
     ++available_;
-    if (tasks_.empty() && available_ == total_) {
+    if (tasks_.empty() && prioritized_tasks_.empty() && available_ == total_) {
       complete_ = true;
       completed_.notify_one();
     }
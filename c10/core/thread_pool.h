@@ -21,6 +21,25 @@ class C10_API TaskThreadPoolBase {
  public:
   virtual void run(std::function<void()> func) = 0;
 
+  /**
+   * Like run(), but places the task in a high-priority lane that workers
+   * drain before the regular queue. Pools without a priority lane fall
+   * back to run().
+   */
+  virtual void run_prioritized(std::function<void()> func) {
+    run(std::move(func));
+  }
+
+  /**
+   * Run one queued high-priority task on the calling thread, if there is
+   * one. Lets a thread that is blocked waiting for such tasks help drain
+   * them instead of sleeping. Returns false if the lane is empty (or the
+   * pool has no priority lane).
+   */
+  virtual bool tryRunPrioritizedTask() {
+    return false;
+  }
+
   virtual size_t size() const = 0;
 
   /**
@@ -54,6 +73,8 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
   };
 
   std::queue<task_element_t> tasks_;
+  // High-priority lane, drained before tasks_ (see run_prioritized()).
+  std::queue<task_element_t> prioritized_tasks_;
   std::vector<std::thread> threads_;
   mutable std::mutex mutex_;
   std::condition_variable condition_;
@@ -82,6 +103,10 @@ class C10_API ThreadPool : public c10::TaskThreadPoolBase {
 
   void run(std::function<void()> func) override;
 
+  void run_prioritized(std::function<void()> func) override;
+
+  bool tryRunPrioritizedTask() override;
+
   template <typename Task>
   void runTaskWithID(Task task) {
     std::unique_lock<std::mutex> lock(mutex_);
@@ -19,6 +19,7 @@ CUDAAllocatorConfig::CUDAAllocatorConfig()
       m_release_lock_on_cudamalloc(false),
       m_pinned_use_cuda_host_register(false),
       m_pinned_use_background_threads(false),
+      m_pinned_use_slab_allocator(false),
       m_last_allocator_settings("") {
   m_roundup_power2_divisions.assign(kRoundUpPowerOfTwoIntervals, 0);
 }
@@ -335,6 +336,9 @@ void CUDAAllocatorConfig::parseArgs(const char* env) {
     } else if (config_item_view == "pinned_use_background_threads") {
       i = parsePinnedUseBackgroundThreads(config, i);
       used_native_specific_option = true;
+    } else if (config_item_view == "pinned_use_slab_allocator") {
+      i = parsePinnedUseSlabAllocator(config, i);
+      used_native_specific_option = true;
     } else {
       TORCH_CHECK(
           false, "Unrecognized CachingAllocator option: ", config_item_view);
@@ -408,6 +412,21 @@ size_t CUDAAllocatorConfig::parsePinnedUseBackgroundThreads(
   return i;
 }
 
+size_t CUDAAllocatorConfig::parsePinnedUseSlabAllocator(
+    const std::vector<std::string>& config,
+    size_t i) {
+  consumeToken(config, ++i, ':');
+  if (++i < config.size()) {
+    TORCH_CHECK(
+        (config[i] == "True" || config[i] == "False"),
+        "Expected a single True/False argument for pinned_use_slab_allocator");
+    m_pinned_use_slab_allocator = (config[i] == "True");
+  } else {
+    TORCH_CHECK(false, "Error, expecting pinned_use_slab_allocator value", "");
+  }
+  return i;
+}
+
 // General caching allocator utilities
 void setAllocatorSettings(const std::string& env) {
   CUDACachingAllocator::CUDAAllocatorConfig::instance().parseArgs(env.c_str());
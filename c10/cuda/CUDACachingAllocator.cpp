@@ -2,6 +2,7 @@
 
 #include <c10/core/impl/GPUTrace.h>
 #include <c10/cuda/CUDAAllocatorConfig.h>
+#include <c10/cuda/CUDAEventPool.h>
 #include <c10/cuda/CUDAException.h>
 #include <c10/cuda/CUDAFunctions.h>
 #include <c10/cuda/CUDAGuard.h>
@@ -25,13 +26,17 @@
 #include <c10/util/Exception.h>
 #include <cuda_runtime_api.h>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <deque>
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <regex>
 #include <set>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -758,60 +763,6 @@ struct AllocParams {
   cudaError_t err{cudaSuccess};
 };
 
-// Note: cudaEventCreate when concurrently invoked from multiple threads can be
-// very expensive (at least on certain device/driver combinations). Thus, we a)
-// serialize event creation at a per-device level, and b) pool the events to
-// avoid constantly calling cudaEventCreate/cudaEventDestroy. This results in
-// significant improvements in multithreaded workloads with high allocation
-// rates.
-class EventPool {
- public:
-  using Event = std::unique_ptr<cudaEvent_t, std::function<void(cudaEvent_t*)>>;
-  // TODO: Explicit device count
-  EventPool() : pools_(at::cuda::device_count()) {}
-
-  Event get(c10::DeviceIndex device) {
-    TORCH_INTERNAL_ASSERT(0 <= device);
-    TORCH_INTERNAL_ASSERT(device < static_cast<int>(pools_.size()));
-    auto& pool = pools_[device];
-    auto destructor = [&pool](cudaEvent_t* event) {
-      std::lock_guard<std::mutex> g(pool.mutex_);
-      pool.event_pool_.push_back(std::unique_ptr<cudaEvent_t>(event));
-    };
-
-    // Try to acquire an event from the per-device pool.
-    {
-      std::lock_guard<std::mutex> g(pool.mutex_);
-      if (!pool.event_pool_.empty()) {
-        auto* event = pool.event_pool_.back().release();
-        pool.event_pool_.pop_back();
-        return Event(event, destructor);
-      }
-    }
-    // otherwise, allocate a new event that will be returned to the pool on
-    // destruction.
-    auto new_ptr = std::make_unique<cudaEvent_t>();
-    C10_CUDA_CHECK(
-        cudaEventCreateWithFlags(new_ptr.get(), cudaEventDisableTiming));
-
-    return Event(new_ptr.release(), destructor);
-  }
-
-  void empty_cache() {
-    for (auto& pool : pools_) {
-      std::lock_guard<std::mutex> g(pool.mutex_);
-      pool.event_pool_.clear();
-    }
-  }
-
- private:
-  struct PerDevicePool {
-    alignas(64) std::mutex mutex_;
-    std::vector<std::unique_ptr<cudaEvent_t>> event_pool_;
-  };
-  std::vector<PerDevicePool> pools_;
-};
-
 // CUDA graphs helper
 struct PrivatePool {
   PrivatePool()
@@ -950,6 +901,172 @@ class RingBuffer {
                    // will already be destroyed when we are in exit handlers
 };
 
+// Note [Compact allocator tracing]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// recordHistory normally gathers a (possibly Python) backtrace for every
+// alloc/free and appends a TraceEntry to a mutex-protected ring buffer while
+// the device allocator lock is held, which is expensive enough that tracing
+// is usually left off in production. Setting
+// PYTORCH_CUDA_ALLOC_COMPACT_TRACE=1 switches recordHistory to a compact
+// mode: the hot path only writes a plain-old-data entry (action, device,
+// address, size, stream, timestamp) into a bounded lock-free ring, and a
+// background thread moves those entries into the regular per-device trace
+// buffer so snapshots keep working unchanged. Backtrace capture cannot be
+// deferred - the stack is gone by the time the flusher runs - so compact
+// mode records no context, as if RecordContext::NEVER had been requested.
+// If producers outrun the flusher the ring drops entries rather than block;
+// drops are counted so the gap is at least diagnosable.
+static bool compactTraceEnabled() {
+  static bool enabled =
+      c10::utils::has_env("PYTORCH_CUDA_ALLOC_COMPACT_TRACE");
+  return enabled;
+}
+
+struct CompactTraceEntry {
+  TraceEntry::Action action_{};
+  c10::DeviceIndex device_{};
+  size_t addr_{};
+  size_t size_{};
+  cudaStream_t stream_{};
+  approx_time_t time_{};
+};
+
+// Bounded multi-producer ring for CompactTraceEntry. Each slot carries a
+// sequence number, so producers claim a slot with a single compare-exchange
+// and the consumer never observes a half-written entry. A full ring drops
+// the entry instead of blocking the allocator.
+class CompactTraceBuffer {
+ public:
+  CompactTraceBuffer() {
+    // Leaked for the same exit-handler reasons as RingBuffer::alloc_trace;
+    // the flusher thread may still be draining it during shutdown.
+    slots_ = new Slot[kCapacity];
+    for (size_t i = 0; i < kCapacity; ++i) {
+      slots_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  bool tryPush(const CompactTraceEntry& entry) {
+    auto pos = enqueue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[pos & kMask];
+      const auto seq = slot.sequence.load(std::memory_order_acquire);
+      const auto diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+      if (diff == 0) {
+        if (enqueue_pos_.compare_exchange_weak(
+                pos, pos + 1, std::memory_order_relaxed)) {
+          slot.entry = entry;
+          slot.sequence.store(pos + 1, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        // The consumer hasn't vacated this slot yet: the ring is full.
+        dropped_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  bool tryPop(CompactTraceEntry& entry) {
+    auto pos = dequeue_pos_.load(std::memory_order_relaxed);
+    while (true) {
+      Slot& slot = slots_[pos & kMask];
+      const auto seq = slot.sequence.load(std::memory_order_acquire);
+      const auto diff =
+          static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+      if (diff == 0) {
+        if (dequeue_pos_.compare_exchange_weak(
+                pos, pos + 1, std::memory_order_relaxed)) {
+          entry = slot.entry;
+          slot.sequence.store(pos + kCapacity, std::memory_order_release);
+          return true;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        pos = dequeue_pos_.load(std::memory_order_relaxed);
+      }
+    }
+  }
+
+  size_t dropped() const {
+    return dropped_.load(std::memory_order_relaxed);
+  }
+
+ private:
+  struct Slot {
+    std::atomic<size_t> sequence{};
+    CompactTraceEntry entry;
+  };
+
+  static constexpr size_t kCapacity = 1 << 16; // must be a power of two
+  static constexpr size_t kMask = kCapacity - 1;
+
+  Slot* slots_; // intentionally leaked, see constructor
+  alignas(64) std::atomic<size_t> enqueue_pos_{0};
+  alignas(64) std::atomic<size_t> dequeue_pos_{0};
+  std::atomic<size_t> dropped_{0};
+};
+
+// Owns the compact trace ring and the background thread that drains it into
+// the per-device trace buffers. The sink is installed by
+// NativeCachingAllocator::recordHistory, which is the layer that can route an
+// entry back to its originating DeviceCachingAllocator.
+class CompactTraceFlusher {
+ public:
+  static CompactTraceFlusher& get() {
+    // Leaked so the detached flusher thread never races destruction of its
+    // own state during exit handlers.
+    static auto* flusher = new CompactTraceFlusher();
+    return *flusher;
+  }
+
+  void push(const CompactTraceEntry& entry) {
+    buffer_.tryPush(entry);
+  }
+
+  void start(std::function<void(const CompactTraceEntry&)> sink) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    sink_ = std::move(sink);
+    if (!started_) {
+      started_ = true;
+      std::thread([this] { run(); }).detach();
+    }
+  }
+
+  size_t dropped() const {
+    return buffer_.dropped();
+  }
+
+ private:
+  void run() {
+    while (true) {
+      std::function<void(const CompactTraceEntry&)> sink;
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        sink = sink_;
+      }
+      CompactTraceEntry entry;
+      bool flushed = false;
+      while (sink && buffer_.tryPop(entry)) {
+        sink(entry);
+        flushed = true;
+      }
+      if (!flushed) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      }
+    }
+  }
+
+  std::mutex mutex_;
+  std::function<void(const CompactTraceEntry&)> sink_;
+  bool started_ = false;
+  CompactTraceBuffer buffer_;
+};
+
 } // anonymous namespace
 } // namespace Native
 
@@ -1064,6 +1181,11 @@ class DeviceCachingAllocator {
   // Ring buffer for memory snapshot TraceEntry's
   RingBuffer<TraceEntry> alloc_buffer;
 
+  // State for snapshotDelta(): cheap per-segment digests from the previous
+  // call, keyed by segment address, plus a monotonically increasing epoch.
+  ska::flat_hash_map<size_t, size_t> snapshot_segment_digests_;
+  uint64_t snapshot_epoch_ = 0;
+
   // Members specific to CUDA graphs
 
   // Private pools for CUDA graphs
@@ -1105,6 +1227,16 @@ class DeviceCachingAllocator {
     context_recorder_.store(record_history ? context_recorder : nullptr);
     alloc_buffer.setMaxEntries(alloc_buffer_max_entries);
     record_context_ = enabled ? when : RecordContext::NEVER;
+    if (enabled && compactTraceEnabled() &&
+        record_context_ != RecordContext::NEVER) {
+      // See Note [Compact allocator tracing]: context cannot be gathered
+      // after the fact, so compact mode implies RecordContext::NEVER.
+      TORCH_WARN_ONCE(
+          "PYTORCH_CUDA_ALLOC_COMPACT_TRACE is set; allocator trace entries "
+          "will not include backtraces.");
+      record_context_ = RecordContext::NEVER;
+      context_recorder_.store(nullptr);
+    }
     if (!enabled) {
       alloc_buffer.clear();
     }
@@ -1114,6 +1246,21 @@ class DeviceCachingAllocator {
     return record_history;
   }
 
+  // Appends an entry drained from the compact trace ring by the background
+  // flusher, see Note [Compact allocator tracing].
+  void insertFlushedTraceEntry(const CompactTraceEntry& entry) {
+    if (!record_history) {
+      return;
+    }
+    alloc_buffer.insertEntries(TraceEntry(
+        entry.action_,
+        entry.device_,
+        entry.addr_,
+        entry.size_,
+        entry.stream_,
+        entry.time_));
+  }
+
   bool checkPoolLiveAllocations(
       MempoolId_t mempool_id,
       const std::unordered_set<void*>& expected_live_allocations) {
@@ -1197,7 +1344,9 @@ class DeviceCachingAllocator {
         // Search pool
         get_free_block(params)
         // Trigger callbacks and retry search
-        || (trigger_free_memory_callbacks(params) && get_free_block(params));
+        || (trigger_free_memory_callbacks(params) && get_free_block(params))
+        // Re-key a free segment cached for another, now-idle stream
+        || get_free_block_from_idle_stream(params);
 
     // Can't reuse an existing block; try to get a new one.
     if (!block_found) {
@@ -1890,6 +2039,49 @@ class DeviceCachingAllocator {
     return rr;
   }
 
+  // Fills segment_info with the full description of the segment headed by
+  // head_block, including per-block traceback copies. Caller must hold the
+  // device mutex.
+  void materializeSegmentInfo(
+      const Block* head_block,
+      const std::unordered_map<PrivatePool*, MempoolId_t>& pool_to_id,
+      SegmentInfo& segment_info) {
+    segment_info.device = head_block->device;
+    segment_info.address = reinterpret_cast<size_t>(head_block->ptr);
+    segment_info.stream = head_block->stream;
+    segment_info.is_large = (!head_block->pool->is_small);
+    segment_info.is_expandable = head_block->expandable_segment_;
+    segment_info.context_when_allocated =
+        head_block->context_when_segment_allocated;
+    auto mempool_id = pool_to_id.find(head_block->pool->owner_PrivatePool);
+    if (mempool_id != pool_to_id.end()) {
+      segment_info.owner_private_pool_id = mempool_id->second;
+    }
+
+    const Block* block = head_block;
+    while (block != nullptr && block->mapped) {
+      segment_info.blocks.emplace_back();
+      BlockInfo& block_info = segment_info.blocks.back();
+
+      block_info.size = block->size;
+      block_info.requested_size = block->requested_size;
+      block_info.allocated = block->allocated;
+      block_info.active = block->allocated || (block->event_count > 0) ||
+          !block->stream_uses.empty();
+
+      segment_info.total_size += block_info.size;
+      if (block_info.allocated) {
+        segment_info.allocated_size += block_info.size;
+      }
+      if (block_info.active) {
+        segment_info.active_size += block_info.size;
+        segment_info.requested_size += block_info.requested_size;
+      }
+      block_info.context_when_allocated = block->context_when_allocated;
+      block = block->next;
+    }
+  }
+
   /** Dump a complete snapshot of the memory held by the allocator. Potentially
    * VERY expensive. **/
   std::vector<SegmentInfo> snapshot() {
@@ -1915,42 +2107,8 @@ class DeviceCachingAllocator {
         continue;
       }
       result.emplace_back();
-      SegmentInfo& segment_info = result.back();
-      segment_info.device = head_block->device;
-      segment_info.address = reinterpret_cast<size_t>(head_block->ptr);
-      segment_info.stream = head_block->stream;
-      segment_info.is_large = (!head_block->pool->is_small);
-      segment_info.is_expandable = head_block->expandable_segment_;
-      segment_info.context_when_allocated =
-          head_block->context_when_segment_allocated;
-      auto mempool_id = pool_to_id.find(head_block->pool->owner_PrivatePool);
-      if (mempool_id != pool_to_id.end()) {
-        segment_info.owner_private_pool_id = mempool_id->second;
-      }
-
-      const Block* block = head_block;
-      while (block != nullptr && block->mapped) {
-        segment_info.blocks.emplace_back();
-        BlockInfo& block_info = segment_info.blocks.back();
-
-        block_info.size = block->size;
-        block_info.requested_size = block->requested_size;
-        block_info.allocated = block->allocated;
-        block_info.active = block->allocated || (block->event_count > 0) ||
-            !block->stream_uses.empty();
-
-        segment_info.total_size += block_info.size;
-        if (block_info.allocated) {
-          segment_info.allocated_size += block_info.size;
-        }
-        if (block_info.active) {
-          segment_info.active_size += block_info.size;
-          segment_info.requested_size += block_info.requested_size;
-        }
-        block_info.context_when_allocated = block->context_when_allocated;
-        block = block->next;
-      }
-      total_active += segment_info.active_size;
+      materializeSegmentInfo(head_block, pool_to_id, result.back());
+      total_active += result.back().active_size;
     }
 
     std::sort(
@@ -1964,6 +2122,65 @@ class DeviceCachingAllocator {
     return result;
   }
 
+  /** Incremental variant of snapshot(). Only segments whose block
+   * composition changed since the previous snapshotDelta() call are
+   * materialized (including the per-block traceback copies, which dominate
+   * the cost of a full snapshot); unchanged segments are skipped after a
+   * cheap digest walk, and segments released since the last call are
+   * reported by address. This keeps the time under the device mutex short
+   * enough for watchdogs to poll allocator state at ~1Hz. **/
+  SnapshotDelta snapshotDelta() {
+    std::lock_guard<std::recursive_mutex> lock(mutex);
+
+    std::unordered_map<PrivatePool*, MempoolId_t> pool_to_id;
+    pool_to_id.reserve(graph_pools.size() + graph_pools_freeable.size());
+    for (const auto& pair : graph_pools) {
+      pool_to_id[pair.second.get()] = pair.first;
+    }
+    for (const auto& pair : graph_pools_freeable) {
+      pool_to_id[pair.second] = pair.first;
+    }
+
+    SnapshotDelta result;
+    result.epoch = ++snapshot_epoch_;
+    ska::flat_hash_map<size_t, size_t> digests;
+    const auto all_blocks = get_all_blocks();
+
+    for (const Block* const head_block : all_blocks) {
+      if (head_block->prev && head_block->prev->mapped) {
+        continue;
+      }
+      // Digest over block boundaries and allocation state: any split,
+      // merge, allocation or free within the segment changes it.
+      size_t digest = reinterpret_cast<size_t>(head_block->ptr);
+      for (const Block* block = head_block; block != nullptr && block->mapped;
+           block = block->next) {
+        digest = c10::hash_combine(digest, block->size);
+        digest = c10::hash_combine(
+            digest,
+            (block->allocated ? 1 : 0) |
+                (block->stream_uses.empty() ? 0 : 2) |
+                (block->event_count > 0 ? 4 : 0));
+      }
+      const auto address = reinterpret_cast<size_t>(head_block->ptr);
+      digests[address] = digest;
+      auto it = snapshot_segment_digests_.find(address);
+      if (it != snapshot_segment_digests_.end() && it->second == digest) {
+        continue;
+      }
+      result.changed_segments.emplace_back();
+      materializeSegmentInfo(head_block, pool_to_id, result.changed_segments.back());
+    }
+
+    for (const auto& kv : snapshot_segment_digests_) {
+      if (digests.find(kv.first) == digests.end()) {
+        result.freed_segment_addresses.push_back(kv.first);
+      }
+    }
+    snapshot_segment_digests_ = std::move(digests);
+    return result;
+  }
+
   std::vector<TraceEntry> trace(
       const std::function<time_t(approx_time_t)>& tsc_to_us) {
     std::lock_guard<std::recursive_mutex> lock(mutex);
@@ -2560,6 +2777,82 @@ class DeviceCachingAllocator {
     return true;
   }
 
+  // Reclaims a whole free segment that is cached for a different stream whose
+  // queued work has drained. Cached blocks are keyed by stream, so workloads
+  // that create a stream per request strand capacity on streams that will
+  // never allocate again; without this, that memory only comes back through
+  // the release_cached_blocks() call on an OOM retry. A segment is eligible
+  // when it is fully free and unsplit (no other Block refers to the
+  // allocation) and cudaStreamQuery reports the owning stream empty: any
+  // operation that touched the segment was either ordered by the owning
+  // stream or tracked by recordStream events that cleared before the block
+  // returned to the pool, so an empty owning stream means the GPU is done
+  // with the memory and the segment can be re-keyed to the requesting stream.
+  // Only runs after the exact-stream search misses, so the common path pays
+  // nothing; the stream queries are bounded by one per distinct stream with
+  // cached blocks.
+  bool get_free_block_from_idle_stream(AllocParams& p) {
+    // cudaStreamQuery is illegal while a capture might be underway (see
+    // process_events), and capture-private pools are managed by their graph.
+    if (C10_UNLIKELY(!captures_underway.empty()) || p.pool->owner_PrivatePool) {
+      return false;
+    }
+    BlockPool& pool = *p.pool;
+    Block* candidate = nullptr;
+    auto it = pool.blocks.begin();
+    while (it != pool.blocks.end()) {
+      cudaStream_t owner = (*it)->stream;
+      bool idle = false;
+      if (owner != p.stream()) {
+        cudaError_t err = C10_CUDA_ERROR_HANDLED(cudaStreamQuery(owner));
+        if (err == cudaSuccess) {
+          idle = true;
+        } else if (err == cudaErrorNotReady) {
+          // ignore and clear the error if the stream still has pending work
+          (void)cudaGetLastError();
+        } else {
+          C10_CUDA_CHECK(err);
+        }
+      }
+      if (idle) {
+        Block key(p.device(), owner, p.size());
+        for (auto cand = pool.blocks.lower_bound(&key);
+             cand != pool.blocks.end() && (*cand)->stream == owner;
+             ++cand) {
+          if ((*cand)->is_split() || (*cand)->expandable_segment_) {
+            continue;
+          }
+          // Apply the same oversize limits as get_free_block(); blocks for
+          // this stream are sorted by size, so past the limits nothing fits.
+          if ((p.size() < CUDAAllocatorConfig::max_split_size()) &&
+              ((*cand)->size >= CUDAAllocatorConfig::max_split_size())) {
+            break;
+          }
+          if ((p.size() >= CUDAAllocatorConfig::max_split_size()) &&
+              ((*cand)->size >=
+               p.size() + CUDAAllocatorConfig::max_non_split_rounding_size())) {
+            break;
+          }
+          // First fit in sorted order is the best fit for this stream.
+          if (candidate == nullptr || (*cand)->size < candidate->size) {
+            candidate = *cand;
+          }
+          break;
+        }
+      }
+      // Jump to the first block of the next stream.
+      Block next_key(p.device(), owner, std::numeric_limits<size_t>::max());
+      it = pool.blocks.upper_bound(&next_key);
+    }
+    if (candidate == nullptr) {
+      return false;
+    }
+    pool.blocks.erase(candidate);
+    candidate->stream = p.stream();
+    p.block = candidate;
+    return true;
+  }
+
   bool trigger_free_memory_callbacks(AllocParams& p) {
     bool freed_memory = false;
     for (const auto& name : FreeCudaMemoryCallbacksRegistry()->Keys()) {
@@ -2978,9 +3271,7 @@ class DeviceCachingAllocator {
   }
 
   EventPool::Event create_event_internal(c10::DeviceIndex idx) {
-    // Leak the event pool to avoid shutdown issues.
-    static auto* event_pool = new EventPool();
-    return event_pool->get(idx);
+    return getEventPool().get(idx);
   }
 
   void synchronize_and_free_events(
@@ -3144,7 +3435,19 @@ class DeviceCachingAllocator {
     }
 
     if (record_history) {
-      alloc_buffer.insertEntries(te);
+      if (compactTraceEnabled()) {
+        // See Note [Compact allocator tracing]: hand the entry to the
+        // background flusher instead of taking the trace buffer lock here.
+        CompactTraceFlusher::get().push(CompactTraceEntry{
+            te.action_,
+            te.device_,
+            te.addr_,
+            te.size_,
+            te.stream_,
+            te.time_.approx_t_});
+      } else {
+        alloc_buffer.insertEntries(te);
+      }
     }
   }
 };
@@ -3321,6 +3624,16 @@ class NativeCachingAllocator : public CUDAAllocator {
       allocator->recordHistory(
           enabled, context_recorder, alloc_buffer_max_entries, when);
     }
+    if (enabled && compactTraceEnabled()) {
+      // Route drained compact entries back to the device allocator whose hot
+      // path produced them, see Note [Compact allocator tracing]. `this` is
+      // the process-lifetime singleton, so the capture cannot dangle.
+      CompactTraceFlusher::get().start([this](const CompactTraceEntry& entry) {
+        if (static_cast<size_t>(entry.device_) < device_allocator.size()) {
+          device_allocator[entry.device_]->insertFlushedTraceEntry(entry);
+        }
+      });
+    }
   }
 
   void recordAnnotation(
@@ -3455,6 +3768,15 @@ class NativeCachingAllocator : public CUDAAllocator {
     return result;
   }
 
+  SnapshotDelta snapshotDelta(c10::DeviceIndex device) override {
+    TORCH_INTERNAL_ASSERT(
+        0 <= device && static_cast<size_t>(device) < device_allocator.size(),
+        "Allocator not initialized for device ",
+        device,
+        ": did you call init?");
+    return device_allocator[device]->snapshotDelta();
+  }
+
   std::shared_ptr<AllocatorState> getCheckpointState(
       c10::DeviceIndex device,
       MempoolId_t id) override {
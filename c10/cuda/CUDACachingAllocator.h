@@ -169,6 +169,17 @@ struct SnapshotInfo {
   AllocatorConfigInfo config_metadata;
 };
 
+// Incremental view of a device's segment state, as returned by
+// snapshotDelta(): only segments whose block composition changed since the
+// previous call are materialized, and segments released since the previous
+// call are reported by address. Cheaper than a full snapshot() for
+// watchdogs that poll allocator state periodically.
+struct SnapshotDelta {
+  uint64_t epoch = 0;
+  std::vector<SegmentInfo> changed_segments;
+  std::vector<size_t> freed_segment_addresses;
+};
+
 // returns the pointers freed in the pool
 // and the pointers allocated. Note: a pointer
 // may appear in both freed and allocated
@@ -216,6 +227,13 @@ class CUDAAllocator : public Allocator {
   virtual void resetAccumulatedStats(c10::DeviceIndex device) = 0;
   virtual void resetPeakStats(c10::DeviceIndex device) = 0;
   virtual SnapshotInfo snapshot() = 0;
+  virtual SnapshotDelta snapshotDelta(c10::DeviceIndex device) {
+    TORCH_CHECK(
+        false,
+        name(),
+        " does not yet support snapshotDelta. "
+        "If you need it, please file an issue describing your use case.");
+  }
   virtual void beginAllocateToPool(
       c10::DeviceIndex device,
       MempoolId_t mempool_id,
@@ -382,6 +400,10 @@ inline SnapshotInfo snapshot() {
   return get()->snapshot();
 }
 
+inline SnapshotDelta snapshotDelta(c10::DeviceIndex device) {
+  return get()->snapshotDelta(device);
+}
+
 inline std::shared_ptr<AllocatorState> getCheckpointState(
     c10::DeviceIndex device,
     MempoolId_t id) {
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <c10/core/Device.h>
+#include <c10/cuda/CUDAMacros.h>
+
+#include <cuda_runtime_api.h>
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace c10::cuda {
+
+// Note: cudaEventCreate when concurrently invoked from multiple threads can be
+// very expensive (at least on certain device/driver combinations). Thus, we a)
+// serialize event creation at a per-device level, and b) pool the events to
+// avoid constantly calling cudaEventCreate/cudaEventDestroy. This results in
+// significant improvements in multithreaded workloads with high allocation
+// rates.
+//
+// All pooled events are created with cudaEventDisableTiming, which is what
+// the synchronization-only paths (e.g. the caching allocator's cross-stream
+// tracking) want; callers that need timing must keep creating their own
+// events.
+class C10_CUDA_API EventPool {
+ public:
+  using Event = std::unique_ptr<cudaEvent_t, std::function<void(cudaEvent_t*)>>;
+
+  EventPool();
+
+  // Returns an event for `device`, reusing a cached one when available.
+  // The event hands itself back to the pool when the handle is destroyed.
+  Event get(DeviceIndex device);
+
+  // Drops all events currently cached in the pool. Outstanding handles
+  // stay valid and are returned to the pool as usual.
+  void empty_cache();
+
+ private:
+  struct PerDevicePool {
+    alignas(64) std::mutex mutex_;
+    std::vector<std::unique_ptr<cudaEvent_t>> event_pool_;
+  };
+  std::vector<PerDevicePool> pools_;
+};
+
+// Process-global pool shared by the caching allocator's cross-stream
+// tracking and any other recorder of transient synchronization events.
+// The pool is never destroyed, so handles may safely outlive static
+// destruction order.
+C10_CUDA_API EventPool& getEventPool();
+
+} // namespace c10::cuda
@@ -1,3 +1,4 @@
+#include <c10/cuda/CUDAAllocatorConfig.h>
 #include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAException.h>
 #include <c10/cuda/CUDAFunctions.h>
@@ -57,6 +58,9 @@ struct PtrUsage {
   UsageStream creation_stream{};
   uint64_t size;
   bool captured;
+  // Populated when recordHistory is active with RecordContext::STATE or
+  // higher; surfaced through snapshot().
+  std::shared_ptr<GatheredContext> context_when_allocated;
   PtrUsage(uint64_t s, bool c) : size(s), captured(c) {}
 };
 
@@ -99,6 +103,69 @@ std::vector<void*> ungraphed_ptrs_defer_free_until_no_capture;
 std::vector<size_t> pytorch_used_bytes;
 std::vector<size_t> pytorch_memory_limits;
 
+// recordHistory state, mirroring the native allocator's surface
+// (see recordHistory in CUDACachingAllocator.cpp). All of it is guarded by
+// general_mutex except context_recorder_, which maybeGatherContext reads
+// before the lock is taken.
+bool record_history = false;
+std::atomic<CreateContextFn> context_recorder_{nullptr};
+size_t alloc_buffer_max_entries = 1;
+RecordContext record_context_ = RecordContext::NEVER;
+
+// Per-device ring buffer of TraceEntries. The entry vectors are heap-allocated
+// and intentionally leaked for the same reason as the native allocator's
+// RingBuffer::alloc_trace: entries can hold references to Python state that is
+// already torn down when exit handlers run.
+struct TraceBuffer {
+  std::vector<TraceEntry>* entries = new std::vector<TraceEntry>();
+  size_t next = 0;
+};
+std::vector<TraceBuffer> alloc_buffers;
+
+std::vector<OutOfMemoryObserver> oom_observers_;
+
+c10::ApproximateClockToUnixTimeConverter clock_converter;
+
+// Assumes record_history; doesn't require general_mutex (the recorder may
+// call back into Python, so we gather before taking the lock, as the native
+// allocator does).
+std::shared_ptr<GatheredContext> maybeGatherContext(RecordContext level) {
+  if (record_context_ < level) {
+    return nullptr;
+  }
+  return context_recorder_.load()();
+}
+
+// Assumes the caller holds general_mutex
+void record_trace(
+    TraceEntry::Action action,
+    size_t addr,
+    size_t size,
+    cudaStream_t stream,
+    c10::DeviceIndex device,
+    std::shared_ptr<GatheredContext> context) {
+  if (!record_history) {
+    return;
+  }
+  auto te = TraceEntry(
+      action,
+      device,
+      addr,
+      size,
+      stream,
+      getApproximateTime(),
+      record_context_ >= RecordContext::ALLOC ? std::move(context) : nullptr);
+  auto& buffer = alloc_buffers[device];
+  if (buffer.entries->size() < alloc_buffer_max_entries) {
+    buffer.entries->emplace_back(std::move(te));
+  } else {
+    (*buffer.entries)[buffer.next++] = std::move(te);
+    if (buffer.next == alloc_buffer_max_entries) {
+      buffer.next = 0;
+    }
+  }
+}
+
 // Graph-specific helpers
 
 /**
@@ -139,6 +206,33 @@ std::vector<size_t> pytorch_memory_limits;
 std::unordered_set<UsageStream, UsageStreamHash> capture_free_streams;
 bool capture_underway = false;
 
+// Explicit driver mempools backing the user-visible graph pools handed to
+// beginAllocateToPool, keyed per device by MempoolId_t. Captures that pass
+// the same id allocate from the same cudaMemPool_t, so replays of the
+// resulting graphs reuse each other's reserved memory, the async-backend
+// analog of the native allocator's shared PrivatePools.
+struct GraphPool {
+  cudaMemPool_t pool{};
+  // One reference per beginAllocateToPool call; dropped by releasePool when
+  // the owning graph is destroyed.
+  int use_count{0};
+};
+
+struct MempoolIdHash {
+  std::size_t operator()(const MempoolId_t& mempool_id) const noexcept {
+    return mempool_id.first != 0 ? mempool_id.first : mempool_id.second;
+  }
+};
+
+std::vector<ska::flat_hash_map<MempoolId_t, GraphPool, MempoolIdHash>>
+    graph_pools;
+
+// While capture_underway, allocations on streams accepted by
+// capture_stream_filter are served from capture_mempool with
+// cudaMallocFromPoolAsync instead of the device's default pool.
+cudaMemPool_t capture_mempool = nullptr;
+std::function<bool(cudaStream_t)> capture_stream_filter;
+
 // Implementation functions
 
 // Assumes the caller holds general_mutex
@@ -265,10 +359,23 @@ inline void free_impl(PtrInfo::iterator& it) {
 
   pytorch_used_bytes[creation_stream.device] -= it->second.size;
 
+  record_trace(
+      TraceEntry::FREE_COMPLETED,
+      reinterpret_cast<size_t>(it->first),
+      it->second.size,
+      creation_stream.stream,
+      creation_stream.device,
+      nullptr);
+
   ptr_info.erase(it);
 }
 
 void freeAsync(void* ptr) {
+  std::shared_ptr<GatheredContext> context = nullptr;
+  if (C10_UNLIKELY(record_history)) {
+    context = maybeGatherContext(RecordContext::ALL);
+  }
+
   std::lock_guard<std::mutex> lk(general_mutex);
 
   auto err = cudaGetLastError();
@@ -276,6 +383,14 @@ void freeAsync(void* ptr) {
   auto it = ptr_info.find(ptr);
   TORCH_INTERNAL_ASSERT(it != ptr_info.end(), "ptr not found in ptr_info");
 
+  record_trace(
+      TraceEntry::FREE_REQUESTED,
+      reinterpret_cast<size_t>(ptr),
+      it->second.size,
+      it->second.creation_stream.stream,
+      it->second.creation_stream.device,
+      std::move(context));
+
   if (C10_UNLIKELY(capture_underway)) {
     if (!it->second.captured) {
       TORCH_WARN_ONCE(
@@ -323,6 +438,11 @@ void mallocAsync(
       device,
       ": did you call init?");
 
+  std::shared_ptr<GatheredContext> context = nullptr;
+  if (C10_UNLIKELY(record_history)) {
+    context = maybeGatherContext(RecordContext::STATE);
+  }
+
   // If stream is a null (default) stream,
   // cudaMallocAsync infers the device from the ambient context,
   // so we need to set the right ambient context.
@@ -353,6 +473,12 @@ void mallocAsync(
   // static initializer?
   if (pytorch_used_bytes[device] + size > pytorch_memory_limits[device]) {
     err = cudaErrorMemoryAllocation;
+  } else if (
+      C10_UNLIKELY(capture_underway) && capture_mempool != nullptr &&
+      (!capture_stream_filter || capture_stream_filter(stream))) {
+    // Captured allocations go to the pool registered by beginAllocateToPool
+    // so graphs sharing a MempoolId_t share reserved memory across replays.
+    err = cudaMallocFromPoolAsync(devPtr, size, capture_mempool, stream);
   } else {
     err = cudaMallocAsync(devPtr, size, stream);
   }
@@ -366,6 +492,16 @@ void mallocAsync(
     size_t device_free = 0;
     size_t device_total = 0;
     C10_CUDA_CHECK(cudaMemGetInfo(&device_free, &device_total));
+    record_trace(
+        TraceEntry::OOM,
+        device_free,
+        size,
+        stream,
+        device,
+        maybeGatherContext(RecordContext::ALL));
+    for (const auto& obs : oom_observers_) {
+      obs(device, size, device_total, device_free);
+    }
     TORCH_CHECK_WITH(
         OutOfMemoryError,
         false,
@@ -394,6 +530,15 @@ void mallocAsync(
       "in ptr_info");
 
   inserted.first->second.creation_stream = {stream, device};
+  inserted.first->second.context_when_allocated = context;
+
+  record_trace(
+      TraceEntry::ALLOC,
+      reinterpret_cast<size_t>(*devPtr),
+      size,
+      stream,
+      device,
+      std::move(context));
 
   pytorch_used_bytes[device] += size;
 }
@@ -436,6 +581,8 @@ struct CudaMallocAsyncAllocator : public CUDAAllocator {
       dummy_unifying_free_streams.resize(dev_count);
       pytorch_used_bytes.resize(dev_count);
       pytorch_memory_limits.resize(dev_count);
+      alloc_buffers.resize(dev_count);
+      graph_pools.resize(dev_count);
       return true;
     }(dev_count);
     (void)called;
@@ -634,17 +781,23 @@ struct CudaMallocAsyncAllocator : public CUDAAllocator {
       CreateContextFn context_recorder,
       size_t alloc_trace_max_entries,
       RecordContext when) override {
-    TORCH_CHECK(
-        false,
-        "cudaMallocAsync does not yet support recordHistory. "
-        "If you need it, please file an issue describing your use case.");
+    std::lock_guard<std::mutex> lk(general_mutex);
+    TORCH_CHECK(when == RecordContext::NEVER || context_recorder);
+    record_history = enabled;
+    context_recorder_.store(record_history ? context_recorder : nullptr);
+    alloc_buffer_max_entries = std::max(size_t(1), alloc_trace_max_entries);
+    record_context_ = enabled ? when : RecordContext::NEVER;
+    if (!enabled) {
+      for (auto& buffer : alloc_buffers) {
+        buffer.entries->clear();
+        buffer.next = 0;
+      }
+    }
   }
 
   void attachOutOfMemoryObserver(OutOfMemoryObserver observer) override {
-    TORCH_CHECK(
-        false,
-        "cudaMallocAsync does not yet support attachOutOfMemoryObserver. "
-        "If you need it, please file an issue describing your use case.");
+    std::lock_guard<std::mutex> lk(general_mutex);
+    oom_observers_.emplace_back(std::move(observer));
   }
 
   void attachAllocatorTraceTracker(AllocatorTraceTracker tracker) override {
@@ -704,6 +857,25 @@ struct CudaMallocAsyncAllocator : public CUDAAllocator {
 
       C10_CUDA_CHECK(cudaMemPoolGetAttribute(
           mempool, cudaMemPoolAttrUsedMemHigh, &used_mem_peak));
+
+      // Fold in the explicit pools backing graph captures (see
+      // beginAllocateToPool). Summing per-pool high-water marks overstates
+      // the true simultaneous peak, but keeps graph memory visible.
+      for (const auto& entry : graph_pools[device]) {
+        uint64_t value = 0;
+        C10_CUDA_CHECK(cudaMemPoolGetAttribute(
+            entry.second.pool, cudaMemPoolAttrReservedMemCurrent, &value));
+        reserved_mem_current += value;
+        C10_CUDA_CHECK(cudaMemPoolGetAttribute(
+            entry.second.pool, cudaMemPoolAttrReservedMemHigh, &value));
+        reserved_mem_peak += value;
+        C10_CUDA_CHECK(cudaMemPoolGetAttribute(
+            entry.second.pool, cudaMemPoolAttrUsedMemCurrent, &value));
+        used_mem_current += value;
+        C10_CUDA_CHECK(cudaMemPoolGetAttribute(
+            entry.second.pool, cudaMemPoolAttrUsedMemHigh, &value));
+        used_mem_peak += value;
+      }
     }
 
     // Many stat types are specific to the native allocator. We leave these
@@ -760,30 +932,141 @@ struct CudaMallocAsyncAllocator : public CUDAAllocator {
         mempool, cudaMemPoolAttrReservedMemHigh, &zero));
     C10_CUDA_CHECK(
         cudaMemPoolSetAttribute(mempool, cudaMemPoolAttrUsedMemHigh, &zero));
+
+    std::lock_guard<std::mutex> lk(general_mutex);
+    for (const auto& entry : graph_pools[device]) {
+      C10_CUDA_CHECK(cudaMemPoolSetAttribute(
+          entry.second.pool, cudaMemPoolAttrReservedMemHigh, &zero));
+      C10_CUDA_CHECK(cudaMemPoolSetAttribute(
+          entry.second.pool, cudaMemPoolAttrUsedMemHigh, &zero));
+    }
   }
 
+  // The driver owns segment caching and splitting, so every outstanding
+  // cudaMallocAsync allocation is reported as its own single-block segment.
+  // Reserved-but-unused pool memory is only visible in aggregate through
+  // getDeviceStats, not here.
   SnapshotInfo snapshot() override {
-    TORCH_CHECK(
-        false,
-        "Calling snapshot with backend:cudaMallocAsync is not meaningful. "
-        "(For backend:native, snapshot returns a detailed summary of all "
-        "blocks tracked by the allocator, but the cudaMallocAsync backend "
-        "does not track individual blocks.)");
-    // Alternative: TORCH_WARN
-    return {};
+    // Set-up converter to convert timestamps from tsc to microseconds.
+    auto tsc_to_ns = clock_converter.makeConverter();
+    auto tsc_to_us = [=](approx_time_t t_approx) {
+      return tsc_to_ns(t_approx) / 1000;
+    };
+
+    std::lock_guard<std::mutex> lk(general_mutex);
+
+    SnapshotInfo result;
+    for (c10::DeviceIndex dev = 0; dev < device_count; dev++) {
+      record_trace(
+          TraceEntry::SNAPSHOT,
+          0,
+          pytorch_used_bytes[dev],
+          nullptr,
+          dev,
+          nullptr);
+    }
+
+    result.segments.reserve(ptr_info.size());
+    for (const auto& entry : ptr_info) {
+      const auto& usage = entry.second;
+      SegmentInfo& segment_info = result.segments.emplace_back();
+      segment_info.device = usage.creation_stream.device;
+      segment_info.address = reinterpret_cast<size_t>(entry.first);
+      segment_info.total_size = usage.size;
+      segment_info.requested_size = usage.size;
+      segment_info.allocated_size = usage.size;
+      segment_info.active_size = usage.size;
+      segment_info.stream = usage.creation_stream.stream;
+      // There is no small/large pool split here; reuse the native
+      // allocator's large-buffer threshold so visualizers bucket segments
+      // the same way.
+      segment_info.is_large = usage.size >= kLargeBuffer;
+      segment_info.context_when_allocated = usage.context_when_allocated;
+
+      BlockInfo& block_info = segment_info.blocks.emplace_back();
+      block_info.size = usage.size;
+      block_info.requested_size = usage.size;
+      block_info.allocated = true;
+      block_info.active = true;
+      block_info.context_when_allocated = usage.context_when_allocated;
+    }
+
+    result.device_traces.resize(device_count);
+    for (const auto dev : c10::irange(device_count)) {
+      const auto& buffer = alloc_buffers[dev];
+      auto& trace = result.device_traces[dev];
+      trace.reserve(buffer.entries->size());
+      trace.insert(
+          trace.end(),
+          buffer.entries->begin() +
+              static_cast<std::vector<TraceEntry>::difference_type>(
+                  buffer.next),
+          buffer.entries->end());
+      trace.insert(
+          trace.end(),
+          buffer.entries->begin(),
+          buffer.entries->begin() +
+              static_cast<std::vector<TraceEntry>::difference_type>(
+                  buffer.next));
+      // Convert all the timestamps from tsc to epoch time in microseconds.
+      for (auto& te : trace) {
+        te.time_.t_ = tsc_to_us(te.time_.approx_t_);
+      }
+    }
+
+    auto& md = result.config_metadata;
+    md.garbage_collection_threshold =
+        CUDAAllocatorConfig::garbage_collection_threshold();
+    md.max_split_size = CUDAAllocatorConfig::max_split_size();
+    md.pinned_num_register_threads =
+        CUDAAllocatorConfig::pinned_num_register_threads();
+    md.expandable_segments = CUDAAllocatorConfig::expandable_segments();
+    md.release_lock_on_malloc =
+        CUDAAllocatorConfig::release_lock_on_cudamalloc();
+    md.pinned_use_host_register =
+        CUDAAllocatorConfig::pinned_use_cuda_host_register();
+    md.last_allocator_settings = CUDAAllocatorConfig::last_allocator_settings();
+    md.roundup_power2_divisions =
+        CUDAAllocatorConfig::roundup_power2_divisions();
+
+    return result;
   }
 
   // CUDAGraph interactions
   void beginAllocateToPool(
       c10::DeviceIndex device,
       MempoolId_t mempool_id,
-      std::function<bool(cudaStream_t)>) override {
+      std::function<bool(cudaStream_t)> filter) override {
     std::lock_guard<std::mutex> lk(general_mutex);
+    assertValidDevice(device);
+    lazy_init_device(device);
 
     TORCH_INTERNAL_ASSERT(capture_free_streams.empty());
     TORCH_CHECK(
         !capture_underway,
         "Only one capture at a time is allowed in a process.")
+
+    auto it = graph_pools[device].find(mempool_id);
+    if (it == graph_pools[device].end()) {
+      CUDAGuard g(device);
+      cudaMemPoolProps props = {};
+      props.allocType = cudaMemAllocationTypePinned;
+      props.handleTypes = cudaMemHandleTypeNone;
+      props.location.type = cudaMemLocationTypeDevice;
+      // NOLINTNEXTLINE(bugprone-signed-char-misuse)
+      props.location.id = device;
+      cudaMemPool_t pool = nullptr;
+      C10_CUDA_CHECK(cudaMemPoolCreate(&pool, &props));
+      // Same retention policy as the default pool (see lazy_init_device).
+      uint64_t threshold = UINT64_MAX;
+      C10_CUDA_CHECK(cudaMemPoolSetAttribute(
+          pool, cudaMemPoolAttrReleaseThreshold, &threshold));
+      it = graph_pools[device].emplace(mempool_id, GraphPool{pool, 0}).first;
+    }
+    it->second.use_count++;
+
+    capture_mempool = it->second.pool;
+    capture_stream_filter = std::move(filter);
     capture_underway = true;
   }
 
@@ -820,6 +1103,8 @@ struct CudaMallocAsyncAllocator : public CUDAAllocator {
         "CudaMallocAsync::notifyCaptureEnded called, "
         "but CudaMallocAsync::capture_underway is false.");
     capture_underway = false;
+    capture_mempool = nullptr;
+    capture_stream_filter = nullptr;
   }
 
   void releasePool(c10::DeviceIndex device, MempoolId_t mempool_id) override {
@@ -835,6 +1120,23 @@ struct CudaMallocAsyncAllocator : public CUDAAllocator {
     //    The freeAsync()s will probably incur
     //    TORCH_WARN("Attempting uncaptured free of a captured allocation..."
     //    but stale ptrs will not permanently leak into ptr_info.
+    std::lock_guard<std::mutex> lk(general_mutex);
+    assertValidDevice(device);
+
+    auto it = graph_pools[device].find(mempool_id);
+    if (it == graph_pools[device].end()) {
+      // The id never went through beginAllocateToPool on this device.
+      return;
+    }
+    TORCH_INTERNAL_ASSERT(it->second.use_count > 0);
+    if (--it->second.use_count == 0) {
+      // cudaMemPoolDestroy defers teardown until outstanding allocations
+      // (e.g. graph output tensors the user still holds) are freed, so this
+      // is safe even while pointers from the pool are still alive.
+      CUDAGuard g(device);
+      C10_CUDA_CHECK(cudaMemPoolDestroy(it->second.pool));
+      graph_pools[device].erase(it);
+    }
   }
 
   void* raw_alloc(size_t nbytes) override {
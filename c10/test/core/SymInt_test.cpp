@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <c10/core/SymExprCache.h>
 #include <c10/core/SymInt.h>
 #include <c10/core/SymNodeImpl.h>
 #include <c10/macros/Macros.h>
@@ -23,6 +24,46 @@ TEST(SymIntTest, CheckRange) {
   EXPECT_FALSE(SymInt::check_range(INT64_MIN));
 }
 
+namespace {
+struct CountingIntNode : SymNodeImpl {
+  explicit CountingIntNode(int64_t value) : value_(value) {}
+  bool is_int() override {
+    return true;
+  }
+  bool has_hint() override {
+    return true;
+  }
+  int64_t guard_int(const char* /*file*/, int64_t /*line*/) override {
+    ++guard_count;
+    return value_;
+  }
+  int64_t value_;
+  int guard_count = 0;
+};
+} // namespace
+
+TEST(SymIntTest, SymExprCacheMemoizesGuards) {
+  auto node = c10::make_intrusive<CountingIntNode>(7);
+  auto* raw = node.get();
+  SymInt s{SymNode(std::move(node))};
+
+  // Without an active cache every guard re-evaluates the node.
+  EXPECT_EQ(s.guard_int(__FILE__, __LINE__), 7);
+  EXPECT_EQ(s.guard_int(__FILE__, __LINE__), 7);
+  EXPECT_EQ(raw->guard_count, 2);
+
+  {
+    SymExprCacheGuard cache_guard;
+    EXPECT_EQ(s.guard_int(__FILE__, __LINE__), 7);
+    EXPECT_EQ(s.guard_int(__FILE__, __LINE__), 7);
+    EXPECT_EQ(raw->guard_count, 3);
+  }
+
+  // The memo is dropped when the guard goes out of scope.
+  EXPECT_EQ(s.guard_int(__FILE__, __LINE__), 7);
+  EXPECT_EQ(raw->guard_count, 4);
+}
+
 #if !C10_UBSAN_ENABLED
 // This test fails signed-integer-overflow UBSAN check
 TEST(SymIntTest, Overflows) {
@@ -419,4 +419,55 @@ TEST(SizesAndStridesTest, MoveAssignmentSelf) {
   selfMove(big, big);
   checkBig(big);
 }
+
+TEST(SizesAndStridesTest, InternGeometry) {
+  SizesAndStrides big = makeBig();
+  big.intern_geometry();
+  EXPECT_TRUE(big.is_interned());
+  checkBig(big);
+
+  // Interning the same geometry again shares one record.
+  SizesAndStrides other = makeBig();
+  other.intern_geometry();
+  EXPECT_EQ(big.sizes_arrayref().data(), other.sizes_arrayref().data());
+
+  // Copies share the record too.
+  SizesAndStrides copy(big);
+  EXPECT_TRUE(copy.is_interned());
+  EXPECT_EQ(copy.sizes_arrayref().data(), big.sizes_arrayref().data());
+  checkBig(copy);
+
+  // Mutation copies the record back out to private storage and leaves
+  // the other holders untouched.
+  copy.stride_at(0) = 42;
+  EXPECT_FALSE(copy.is_interned());
+  EXPECT_NE(copy.sizes_arrayref().data(), big.sizes_arrayref().data());
+  EXPECT_EQ(copy.stride_at(0), 42);
+  checkBig(big);
+  checkBig(other);
+
+  // Resizing an interned geometry also unshares.
+  SizesAndStrides resized(big);
+  resized.resize(4);
+  EXPECT_FALSE(resized.is_interned());
+  checkBig(big);
+
+  // Interning is a no-op for inline geometry.
+  SizesAndStrides small = makeSmall();
+  small.intern_geometry();
+  EXPECT_FALSE(small.is_interned());
+  checkSmall(small);
+
+  // Assignment from an interned rhs shares, in both the
+  // previously-inline and previously-outline cases.
+  SizesAndStrides assigned;
+  assigned = big;
+  EXPECT_TRUE(assigned.is_interned());
+  checkBig(assigned);
+  assigned = makeSmall();
+  checkSmall(assigned);
+  assigned = big;
+  EXPECT_TRUE(assigned.is_interned());
+  checkBig(assigned);
+}
 // NOLINTEND(*conversion*, *multiplication*)
@@ -0,0 +1,59 @@
+#include <c10/util/cpu_affinity.h>
+
+#include <algorithm>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+#ifdef __linux__
+
+TEST(CpuAffinityTest, AllowedCPUsNonEmpty) {
+  const auto cpus = c10::GetAllowedCPUs();
+  ASSERT_FALSE(cpus.empty());
+  // CPU ids are unique and sorted as produced.
+  ASSERT_TRUE(std::is_sorted(cpus.begin(), cpus.end()));
+  ASSERT_EQ(
+      std::adjacent_find(cpus.begin(), cpus.end()), cpus.end());
+}
+
+TEST(CpuAffinityTest, PhysicalCoresSubsetOfAllowed) {
+  const auto allowed = c10::GetAllowedCPUs();
+  const auto physical = c10::GetPhysicalCoreCPUs();
+  ASSERT_FALSE(physical.empty());
+  ASSERT_LE(physical.size(), allowed.size());
+  for (const int cpu : physical) {
+    ASSERT_TRUE(
+        std::find(allowed.begin(), allowed.end(), cpu) != allowed.end());
+  }
+}
+
+TEST(CpuAffinityTest, BindThread) {
+  const auto cpus = c10::GetAllowedCPUs();
+  ASSERT_FALSE(cpus.empty());
+  std::thread t([&]() {
+    ASSERT_TRUE(c10::BindThreadToCPU(cpus.front()));
+    // After pinning, the allowed set of this thread is just the one CPU.
+    // GetAllowedCPUs reads the process mask via pid 0, which on Linux is
+    // the calling thread.
+    const auto bound = c10::GetAllowedCPUs();
+    ASSERT_EQ(bound.size(), 1u);
+    ASSERT_EQ(bound.front(), cpus.front());
+  });
+  t.join();
+
+  ASSERT_FALSE(c10::BindThreadToCPU(-1));
+}
+
+#else // __linux__
+
+TEST(CpuAffinityTest, UnsupportedPlatform) {
+  ASSERT_TRUE(c10::GetAllowedCPUs().empty());
+  ASSERT_TRUE(c10::GetPhysicalCoreCPUs().empty());
+  ASSERT_FALSE(c10::BindThreadToCPU(0));
+}
+
+#endif // __linux__
+
+} // namespace
@@ -76,6 +76,13 @@ TEST(ExceptionTest, ErrorFormatting) {
   While checking Y)msg");
 }
 
+TEST(ExceptionTest, TORCH_CHECK_COLD) {
+  ASSERT_NO_THROW(TORCH_CHECK_COLD(true, "This should not throw"));
+  expectThrowsEq(
+      []() { TORCH_CHECK_COLD(false, "This is ", "invalid"); },
+      "This is invalid");
+}
+
 static int assertionArgumentCounter = 0;
 static int getAssertionArgument() {
   return ++assertionArgumentCounter;
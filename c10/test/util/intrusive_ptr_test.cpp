@@ -1,11 +1,15 @@
 #include <c10/util/intrusive_ptr.h>
 
 #include <gtest/gtest.h>
+#include <atomic>
 #include <map>
 #include <set>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
+using c10::DeferredDestructionGuard;
+using c10::flush_deferred_destruction;
 using c10::intrusive_ptr;
 using c10::intrusive_ptr_target;
 using c10::make_intrusive;
@@ -3543,4 +3547,68 @@ TEST(
   p->ptr = weak_intrusive_ptr<intrusive_ptr_target>(
       intrusive_ptr<intrusive_ptr_target>(p));
 }
+
+namespace {
+class DeferredDestructableMock : public intrusive_ptr_target {
+ public:
+  explicit DeferredDestructableMock(std::atomic<int>* destructed)
+      : destructed_(destructed) {}
+
+  ~DeferredDestructableMock() override {
+    ++*destructed_;
+  }
+
+ private:
+  std::atomic<int>* destructed_;
+};
+} // namespace
+
+TEST(DeferredDestructionTest, givenGuard_thenDestructionHappensOnFlush) {
+  std::atomic<int> destructed{0};
+  {
+    auto obj = make_intrusive<DeferredDestructableMock>(&destructed);
+    DeferredDestructionGuard guard;
+    obj.reset();
+  }
+  flush_deferred_destruction();
+  EXPECT_EQ(destructed.load(), 1);
+}
+
+TEST(DeferredDestructionTest, withoutGuard_thenDestructionIsInline) {
+  std::atomic<int> destructed{0};
+  auto obj = make_intrusive<DeferredDestructableMock>(&destructed);
+  obj.reset();
+  EXPECT_EQ(destructed.load(), 1);
+}
+
+TEST(DeferredDestructionTest, givenGuard_thenCascadeIsDeferred) {
+  std::atomic<int> destructed{0};
+  std::vector<intrusive_ptr<DeferredDestructableMock>> objects;
+  for (int i = 0; i < 100; ++i) {
+    objects.push_back(make_intrusive<DeferredDestructableMock>(&destructed));
+  }
+  {
+    DeferredDestructionGuard guard;
+    objects.clear();
+  }
+  flush_deferred_destruction();
+  EXPECT_EQ(destructed.load(), 100);
+}
+
+TEST(DeferredDestructionTest, guardRestoresPreviousState) {
+  std::atomic<int> destructed{0};
+  {
+    DeferredDestructionGuard outer;
+    { DeferredDestructionGuard inner; }
+    // Still deferred: the inner guard must not have cleared the flag.
+    auto obj = make_intrusive<DeferredDestructableMock>(&destructed);
+    obj.reset();
+    flush_deferred_destruction();
+    EXPECT_EQ(destructed.load(), 1);
+  }
+  // Guard gone, destruction is inline again.
+  auto obj = make_intrusive<DeferredDestructableMock>(&destructed);
+  obj.reset();
+  EXPECT_EQ(destructed.load(), 2);
+}
 // NOLINTEND(clang-analyzer-cplusplus*)
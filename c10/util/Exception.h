@@ -518,6 +518,21 @@ namespace c10::detail {
     const char* condMsg,
     const std::string& userMsg);
 
+#ifndef STRIP_ERROR_MESSAGES
+// Backing function for TORCH_CHECK_COLD.  Formatting the message pieces
+// happens here, in a function that is never inlined, instead of in code
+// expanded into the caller as TORCH_CHECK does.
+template <typename... Args>
+[[noreturn]] C10_NOINLINE void torchCheckFailCold(
+    const char* func,
+    const char* file,
+    uint32_t line,
+    const char* condMsg,
+    const Args&... args) {
+  torchCheckFail(func, file, line, torchCheckMsgImpl(condMsg, args...));
+}
+#endif
+
 } // namespace c10::detail
 
 #ifdef STANDALONE_TORCH_HEADER
@@ -579,6 +594,32 @@ namespace c10::detail {
 
 #endif
 
+// Like TORCH_CHECK, but the error message is assembled in an outlined cold
+// function instead of in code inlined at the callsite.  TORCH_CHECK already
+// evaluates its arguments only on failure, but the operator<< formatting it
+// expands to still occupies instruction cache inside the calling function.
+// Prefer this variant on hot per-op paths with multi-piece messages; the
+// arguments are passed by const reference, so they must outlive the call
+// (which they always do, since the check throws).  Not worthwhile for checks
+// with no message or a single string literal, where TORCH_CHECK expands to a
+// plain call already.
+#ifdef STRIP_ERROR_MESSAGES
+#define TORCH_CHECK_COLD(cond, ...) TORCH_CHECK(cond, ##__VA_ARGS__)
+#else
+#define TORCH_CHECK_COLD(cond, ...)                         \
+  if (C10_UNLIKELY_OR_CONST(!(cond))) {                     \
+    ::c10::detail::torchCheckFailCold(                      \
+        __func__,                                           \
+        __FILE__,                                           \
+        static_cast<uint32_t>(__LINE__),                    \
+        "Expected " #cond                                   \
+        " to be true, but got false.  "                     \
+        "(Could this error message be improved?  If so, "   \
+        "please report an enhancement request to PyTorch.)", \
+        ##__VA_ARGS__);                                     \
+  }
+#endif
+
 // An utility macro that does what `TORCH_CHECK` does if compiled in the host
 // code, otherwise does nothing. Supposed to be used in the code shared between
 // host and device code as an alternative for `TORCH_CHECK`.
@@ -0,0 +1,97 @@
+#include <c10/util/cpu_affinity.h>
+
+#if defined(__linux__) && !defined(C10_MOBILE)
+#include <pthread.h>
+#include <sched.h>
+#include <fstream>
+#include <set>
+#include <string>
+#include <utility>
+#define C10_ENABLE_CPU_AFFINITY
+#endif
+
+namespace c10 {
+
+#ifdef C10_ENABLE_CPU_AFFINITY
+
+std::vector<int> GetAllowedCPUs() {
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) != 0) {
+    return {};
+  }
+  std::vector<int> cpus;
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &set)) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+namespace {
+
+// Reads a small integer topology attribute for a CPU from sysfs, e.g.
+// /sys/devices/system/cpu/cpu3/topology/core_id. Returns -1 on failure.
+int read_topology_id(int cpu, const char* attr) {
+  std::ifstream file(
+      "/sys/devices/system/cpu/cpu" + std::to_string(cpu) + "/topology/" +
+      attr);
+  int value = -1;
+  if (!(file >> value)) {
+    return -1;
+  }
+  return value;
+}
+
+} // namespace
+
+std::vector<int> GetPhysicalCoreCPUs() {
+  const auto allowed = GetAllowedCPUs();
+  std::vector<int> cpus;
+  // SMT siblings share a (package id, core id) pair; keep the first
+  // allowed CPU of each pair.
+  std::set<std::pair<int, int>> seen_cores;
+  for (const int cpu : allowed) {
+    const int package_id = read_topology_id(cpu, "physical_package_id");
+    const int core_id = read_topology_id(cpu, "core_id");
+    if (package_id < 0 || core_id < 0) {
+      // Topology unknown (e.g. sysfs not mounted); treat the CPU as its
+      // own core rather than dropping it.
+      cpus.push_back(cpu);
+      continue;
+    }
+    if (seen_cores.emplace(package_id, core_id).second) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+bool BindThreadToCPU(int cpu) {
+  if (cpu < 0 || cpu >= CPU_SETSIZE) {
+    return false;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+#else // C10_ENABLE_CPU_AFFINITY
+
+std::vector<int> GetAllowedCPUs() {
+  return {};
+}
+
+std::vector<int> GetPhysicalCoreCPUs() {
+  return {};
+}
+
+bool BindThreadToCPU(int cpu) {
+  return false;
+}
+
+#endif // C10_ENABLE_CPU_AFFINITY
+
+} // namespace c10
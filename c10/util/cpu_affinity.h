@@ -0,0 +1,29 @@
+#pragma once
+
+#include <c10/macros/Export.h>
+#include <vector>
+
+namespace c10 {
+
+/**
+ * Get the CPUs the current process is allowed to run on, as reported by
+ * the scheduler. This reflects cgroup cpusets and taskset masks, so in a
+ * container it returns the container's CPUs rather than the machine's.
+ * Returns an empty vector on platforms without affinity support.
+ */
+C10_API std::vector<int> GetAllowedCPUs();
+
+/**
+ * Get one allowed CPU per physical core, skipping SMT (hyperthread)
+ * siblings. CPUs whose topology cannot be determined are treated as their
+ * own core. Returns an empty vector on platforms without affinity support.
+ */
+C10_API std::vector<int> GetPhysicalCoreCPUs();
+
+/**
+ * Pin the calling thread to the given CPU. Returns false if pinning is
+ * unsupported on this platform or the request failed.
+ */
+C10_API bool BindThreadToCPU(int cpu);
+
+} // namespace c10
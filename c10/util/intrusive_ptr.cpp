@@ -1 +1,102 @@
 #include <c10/util/intrusive_ptr.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace c10 {
+
+namespace detail {
+
+namespace {
+
+thread_local bool deferred_destruction_enabled_ = false;
+
+struct ReclamationQueue {
+  std::mutex mutex;
+  std::condition_variable cv;
+  std::condition_variable drained_cv;
+  std::vector<intrusive_ptr_target*> pending;
+  size_t in_flight = 0;
+  bool thread_started = false;
+};
+
+// Leaked so deferred releases during static destruction stay safe; the
+// detached reclamation thread may also outlive exiting main().
+ReclamationQueue& reclamation_queue() {
+  static auto* queue = new ReclamationQueue();
+  return *queue;
+}
+
+void reclamation_loop() {
+  auto& queue = reclamation_queue();
+  std::vector<intrusive_ptr_target*> batch;
+  std::unique_lock<std::mutex> lock(queue.mutex);
+  while (true) {
+    queue.cv.wait(lock, [&]() { return !queue.pending.empty(); });
+    batch.swap(queue.pending);
+    queue.in_flight = batch.size();
+    lock.unlock();
+    // deferred_destruction_enabled_ is false on this thread, so releases
+    // cascading out of these destructors run inline here rather than
+    // re-enqueueing one object at a time.
+    for (auto* target : batch) {
+      deferred_ptr_release(target);
+    }
+    batch.clear();
+    lock.lock();
+    queue.in_flight = 0;
+    if (queue.pending.empty()) {
+      queue.drained_cv.notify_all();
+    }
+  }
+}
+
+} // namespace
+
+bool deferred_destruction_enabled() noexcept {
+  return deferred_destruction_enabled_;
+}
+
+bool set_deferred_destruction_enabled(bool enabled) noexcept {
+  return std::exchange(deferred_destruction_enabled_, enabled);
+}
+
+// Runs the tail of intrusive_ptr::reset_() for an object whose refcount
+// already hit zero.
+void deferred_ptr_release(intrusive_ptr_target* target) noexcept {
+  bool should_delete =
+      target->weakcount_.load(std::memory_order_acquire) == 1;
+  if (!should_delete) {
+    target->release_resources();
+    should_delete = atomic_weakcount_decrement(target->weakcount_) == 0;
+  }
+  if (should_delete) {
+    delete target;
+  }
+}
+
+void enqueue_deferred_destruction(intrusive_ptr_target* target) {
+  auto& queue = reclamation_queue();
+  std::lock_guard<std::mutex> guard(queue.mutex);
+  if (!queue.thread_started) {
+    queue.thread_started = true;
+    std::thread(reclamation_loop).detach();
+  }
+  queue.pending.push_back(target);
+  queue.cv.notify_one();
+}
+
+} // namespace detail
+
+void flush_deferred_destruction() {
+  auto& queue = detail::reclamation_queue();
+  std::unique_lock<std::mutex> lock(queue.mutex);
+  queue.drained_cv.wait(lock, [&]() {
+    return queue.pending.empty() && queue.in_flight == 0;
+  });
+}
+
+} // namespace c10
@@ -28,6 +28,12 @@ struct DontIncreaseRefcount {};
 
 namespace detail {
 constexpr uint32_t kImpracticallyHugeReferenceCount = 0x0FFFFFFF;
+
+// Deferred destruction support; see DeferredDestructionGuard below.
+C10_API bool deferred_destruction_enabled() noexcept;
+C10_API bool set_deferred_destruction_enabled(bool enabled) noexcept;
+C10_API void enqueue_deferred_destruction(intrusive_ptr_target* target);
+C10_API void deferred_ptr_release(intrusive_ptr_target* target) noexcept;
 } // namespace detail
 
 /**
@@ -95,6 +101,8 @@ class C10_API intrusive_ptr_target {
   template <typename T>
   friend struct ExclusivelyOwnedTensorTraits;
 
+  friend void detail::deferred_ptr_release(intrusive_ptr_target* target) noexcept;
+
  protected:
   // protected destructor. We never want to destruct intrusive_ptr_target*
   // directly.
@@ -179,6 +187,36 @@ class C10_API intrusive_ptr_target {
   virtual void release_resources() {}
 };
 
+/**
+ * RAII guard that defers intrusive_ptr destruction cascades. While a
+ * guard is alive on the current thread, releasing the last reference to
+ * an object hands it off to a background reclamation thread instead of
+ * destroying it inline, so dropping a large object graph (e.g. a whole
+ * inference model) does not stall the releasing thread behind a chain
+ * of destructors and atomic decrements. The reclamation thread itself
+ * runs unguarded, so cascaded releases it triggers are processed there
+ * inline. Guards nest; the flag is per-thread.
+ */
+class C10_API DeferredDestructionGuard final {
+ public:
+  DeferredDestructionGuard()
+      : prev_(detail::set_deferred_destruction_enabled(true)) {}
+  DeferredDestructionGuard(const DeferredDestructionGuard&) = delete;
+  DeferredDestructionGuard& operator=(const DeferredDestructionGuard&) = delete;
+  DeferredDestructionGuard(DeferredDestructionGuard&&) = delete;
+  DeferredDestructionGuard& operator=(DeferredDestructionGuard&&) = delete;
+  ~DeferredDestructionGuard() {
+    detail::set_deferred_destruction_enabled(prev_);
+  }
+
+ private:
+  bool prev_;
+};
+
+// Blocks until every object handed off for deferred destruction so far
+// has been reclaimed.
+C10_API void flush_deferred_destruction();
+
 namespace detail {
 template <class TTarget>
 struct intrusive_target_default_null_type final {
@@ -280,6 +318,13 @@ class intrusive_ptr final {
   void reset_() noexcept {
     if (target_ != NullType::singleton() &&
         detail::atomic_refcount_decrement(target_->refcount_) == 0) {
+      if (C10_UNLIKELY(detail::deferred_destruction_enabled())) {
+        // The refcount already hit zero, so we own the object; hand it to
+        // the reclamation thread instead of destroying it inline.
+        detail::enqueue_deferred_destruction(
+            const_cast<std::remove_const_t<TTarget>*>(target_));
+        return;
+      }
       // See comment above about weakcount. As long as refcount>0,
       // weakcount is one larger than the actual number of weak references.
       // So we need to decrement it here.
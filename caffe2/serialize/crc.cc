@@ -2,12 +2,66 @@
 
 #include "caffe2/serialize/crc_alt.h"
 
+#include <algorithm>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Number of threads used to CRC large buffers, from
+// TORCH_SERIALIZE_CRC_THREADS. Large checkpoint records are wall-clock bound
+// on this single CRC pass; splitting the buffer and merging the partial CRCs
+// with crc32_combine is exact. Values below 2 (the default) keep the
+// single-threaded behavior.
+size_t crcThreads() {
+  static const size_t threads = []() -> size_t {
+    const char* env = std::getenv("TORCH_SERIALIZE_CRC_THREADS");
+    if (env == nullptr) {
+      return 1;
+    }
+    const long val = std::strtol(env, nullptr, 10);
+    return val > 1 ? static_cast<size_t>(val) : 1;
+  }();
+  return threads;
+}
+
+// Chunks smaller than this are not worth a thread.
+constexpr size_t kMinBytesPerCrcThread = 8 * 1024 * 1024;
+
+} // namespace
+
 extern "C" {
 // See: miniz.h
 #if defined(USE_EXTERNAL_MZCRC)
 mz_ulong mz_crc32(mz_ulong crc, const mz_uint8* ptr, size_t buf_len) {
-  auto z = crc32_fast(ptr, buf_len, crc);
-  return z;
+  const size_t num_threads =
+      std::min(crcThreads(), buf_len / kMinBytesPerCrcThread);
+  if (num_threads <= 1) {
+    return crc32_fast(ptr, buf_len, crc);
+  }
+
+  const size_t chunk = (buf_len + num_threads - 1) / num_threads;
+  std::vector<uint32_t> partials(num_threads, 0);
+  std::vector<size_t> lengths(num_threads, 0);
+  std::vector<std::thread> workers;
+  for (size_t i = 0; i < num_threads; ++i) {
+    const size_t begin = i * chunk;
+    const size_t len = std::min(chunk, buf_len - begin);
+    lengths[i] = len;
+    workers.emplace_back([&partials, i, ptr, begin, len] {
+      partials[i] = crc32_fast(ptr + begin, len, 0);
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+
+  uint32_t result = crc;
+  for (size_t i = 0; i < num_threads; ++i) {
+    result = crc32_combine(result, partials[i], lengths[i]);
+  }
+  return result;
 };
 #endif
 }
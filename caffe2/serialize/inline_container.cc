@@ -8,14 +8,22 @@
 #include <sstream>
 #include <sys/stat.h>
 #include <sys/types.h>
+#include <atomic>
 #include <thread>
 
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 #include <c10/core/Allocator.h>
 #include <c10/core/Backend.h>
 #include <c10/core/CPUAllocator.h>
 #include <c10/core/Backend.h>
 #include <c10/util/Exception.h>
 #include <c10/util/Logging.h>
+#include <c10/util/env.h>
 #include <c10/util/hash.h>
 
 #include "caffe2/core/common.h"
@@ -31,6 +39,24 @@ namespace caffe2 {
 namespace serialize {
 constexpr c10::string_view kDebugPklSuffix(".debug_pkl");
 
+#ifndef _WIN32
+namespace detail {
+// A read-only mapping of an entire archive, shared by every record view
+// handed out by getRecord. Pages are faulted in lazily from the page cache,
+// so concurrent readers of the same checkpoint share one copy of the data.
+struct MmapRegion {
+  MmapRegion(void* addr, size_t length) : addr(addr), length(length) {}
+  MmapRegion(const MmapRegion&) = delete;
+  MmapRegion& operator=(const MmapRegion&) = delete;
+  ~MmapRegion() {
+    munmap(addr, length);
+  }
+  void* addr;
+  size_t length;
+};
+} // namespace detail
+#endif
+
 struct MzZipReaderIterWrapper {
   MzZipReaderIterWrapper(mz_zip_reader_extract_iter_state* iter) : impl(iter) {}
   mz_zip_reader_extract_iter_state* impl;
@@ -115,7 +141,9 @@ size_t PyTorchStreamReader::read(uint64_t pos, char* buf, size_t n) {
 // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init)
 PyTorchStreamReader::PyTorchStreamReader(const std::string& file_name)
     : ar_(std::make_unique<mz_zip_archive>()),
-      in_(std::make_unique<FileAdapter>(file_name)) {
+      in_(std::make_unique<FileAdapter>(file_name)),
+      file_name_(file_name) {
+  enable_mmap_reads_ = c10::utils::has_env("TORCH_SERIALIZE_MMAP_RECORDS");
   init();
 }
 
@@ -351,6 +379,20 @@ std::tuple<at::DataPtr, size_t> PyTorchStreamReader::getRecord(const std::string
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), key, &stat);
   valid("retrieving file meta-data for ", name.c_str());
+#ifndef _WIN32
+  // Serve uncompressed records of a file-backed archive straight out of a
+  // shared mapping of the file; the pages are faulted in lazily instead of
+  // being read and copied eagerly.
+  if (enable_mmap_reads_ && !file_name_.empty() &&
+      stat.m_method == MZ_NO_COMPRESSION) {
+    at::DataPtr mapped = mapRecord(
+        getRecordOffsetFromLocalHeader(stat.m_local_header_ofs),
+        stat.m_uncomp_size);
+    if (mapped) {
+      return std::make_tuple(std::move(mapped), stat.m_uncomp_size);
+    }
+  }
+#endif
   at::DataPtr retval = c10::GetCPUAllocator()->allocate(stat.m_uncomp_size);
   mz_zip_reader_extract_to_mem(ar_.get(), key, retval.get(), stat.m_uncomp_size, 0);
   valid("reading file ", name.c_str());
@@ -564,23 +606,59 @@ static int64_t read_le_16(uint8_t* buf) {
   return buf[0] + (buf[1] << 8);
 }
 
-size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
-  std::lock_guard<std::mutex> guard(reader_lock_);
-  mz_zip_archive_file_stat stat;
-  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
-  valid("retrieving file meta-data for ", name.c_str());
+size_t PyTorchStreamReader::getRecordOffsetFromLocalHeader(
+    uint64_t local_header_ofs) {
   // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
   uint8_t local_header[MZ_ZIP_LOCAL_DIR_HEADER_SIZE];
   in_->read(
-      stat.m_local_header_ofs,
+      local_header_ofs,
       local_header,
       MZ_ZIP_LOCAL_DIR_HEADER_SIZE,
       "reading file header");
   size_t filename_len = read_le_16(local_header + MZ_ZIP_LDH_FILENAME_LEN_OFS);
   size_t extra_len = read_le_16(local_header + MZ_ZIP_LDH_EXTRA_LEN_OFS);
-  return stat.m_local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
+  return local_header_ofs + MZ_ZIP_LOCAL_DIR_HEADER_SIZE + filename_len + extra_len;
 }
 
+size_t PyTorchStreamReader::getRecordOffset(const std::string& name) {
+  std::lock_guard<std::mutex> guard(reader_lock_);
+  mz_zip_archive_file_stat stat;
+  mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
+  valid("retrieving file meta-data for ", name.c_str());
+  return getRecordOffsetFromLocalHeader(stat.m_local_header_ofs);
+}
+
+#ifndef _WIN32
+at::DataPtr PyTorchStreamReader::mapRecord(size_t record_offset, size_t size) {
+  if (!mmap_region_) {
+    const int fd = open(file_name_.c_str(), O_RDONLY);
+    if (fd == -1) {
+      return at::DataPtr();
+    }
+    const size_t length = in_->size();
+    void* addr = mmap(nullptr, length, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (addr == MAP_FAILED) {
+      return at::DataPtr();
+    }
+    mmap_region_ = std::make_shared<detail::MmapRegion>(addr, length);
+  }
+  if (record_offset + size > mmap_region_->length) {
+    return at::DataPtr();
+  }
+  // Each record view keeps the shared mapping alive, so records may outlive
+  // the reader.
+  auto* ctx = new std::shared_ptr<detail::MmapRegion>(mmap_region_);
+  return at::DataPtr(
+      static_cast<char*>(mmap_region_->addr) + record_offset,
+      ctx,
+      [](void* ctx) {
+        delete static_cast<std::shared_ptr<detail::MmapRegion>*>(ctx);
+      },
+      c10::DeviceType::CPU);
+}
+#endif
+
 size_t PyTorchStreamReader::getRecordSize(const std::string& name) {
   mz_zip_archive_file_stat stat;
   mz_zip_reader_file_stat(ar_.get(), getRecordID(name), &stat);
@@ -633,6 +711,30 @@ PyTorchStreamWriter::PyTorchStreamWriter(
   setup(archive_name_);
 }
 
+namespace {
+
+// Payloads at least this large are eligible for the parallel write path.
+constexpr size_t kParallelWriteThreshold = 64 * 1024 * 1024;
+
+// Number of threads used to pwrite large record payloads, from
+// TORCH_SERIALIZE_WRITE_THREADS (roughly one per NVMe queue). Values below 2
+// keep the single-threaded stream writes.
+size_t parallelWriteThreads() {
+  const auto env = c10::utils::get_env("TORCH_SERIALIZE_WRITE_THREADS");
+  if (!env.has_value()) {
+    return 1;
+  }
+  try {
+    const auto val = std::stoll(env.value());
+    return val > 1 ? static_cast<size_t>(val) : 1;
+  } catch (const std::logic_error&) {
+    LOG(WARNING) << "Invalid TORCH_SERIALIZE_WRITE_THREADS: " << env.value();
+    return 1;
+  }
+}
+
+} // namespace
+
 void PyTorchStreamWriter::setup(const string& file_name) {
   ar_ = std::make_unique<mz_zip_archive>();
   memset(ar_.get(), 0, sizeof(mz_zip_archive));
@@ -654,13 +756,27 @@ void PyTorchStreamWriter::setup(const string& file_name) {
       TORCH_CHECK(dir_exists, "Parent directory ", dir_name, " does not exist.");
     }
     TORCH_CHECK(file_stream_, "File ", file_name, " cannot be opened.");
+#ifndef _WIN32
+    write_threads_ = parallelWriteThreads();
+    if (write_threads_ > 1) {
+      write_fd_ = open(file_name.c_str(), O_WRONLY);
+      if (write_fd_ == -1) {
+        LOG(WARNING) << "Could not reopen " << file_name
+                     << " for parallel writes, falling back to stream writes.";
+        write_threads_ = 1;
+      }
+    }
+#endif
     writer_func_ = [this](const void* buf, size_t nbytes) -> size_t {
       if (!buf) {
         // See [Note: write_record_metadata]
         file_stream_.seekp(nbytes, std::ios_base::cur);
-      } else {
-        file_stream_.write(static_cast<const char*>(buf), nbytes);
+        return !file_stream_ ? 0 : nbytes;
       }
+      if (write_fd_ != -1 && nbytes >= kParallelWriteThreshold) {
+        return writeParallel(buf, nbytes);
+      }
+      file_stream_.write(static_cast<const char*>(buf), nbytes);
       return !file_stream_ ? 0 : nbytes;
     };
   }
@@ -714,6 +830,56 @@ void PyTorchStreamWriter::writeRecord(
   files_written_.insert(name);
 }
 
+#ifndef _WIN32
+size_t PyTorchStreamWriter::writeParallel(const void* buf, size_t nbytes) {
+  // Headers written through the stream must reach the file before the
+  // payload is written around it through the fd.
+  file_stream_.flush();
+  if (!file_stream_) {
+    return 0;
+  }
+  const auto start = static_cast<uint64_t>(file_stream_.tellp());
+
+  const size_t per_thread = (nbytes + write_threads_ - 1) / write_threads_;
+  std::atomic<bool> ok{true};
+  std::vector<std::thread> workers;
+  for (size_t begin = 0; begin < nbytes; begin += per_thread) {
+    const size_t len = std::min(per_thread, nbytes - begin);
+    workers.emplace_back([this, buf, start, begin, len, &ok] {
+      const char* src = static_cast<const char*>(buf) + begin;
+      size_t written = 0;
+      while (written < len) {
+        const ssize_t ret = pwrite(
+            write_fd_,
+            src + written,
+            len - written,
+            static_cast<off_t>(start + begin + written));
+        if (ret <= 0) {
+          ok = false;
+          return;
+        }
+        written += static_cast<size_t>(ret);
+      }
+    });
+  }
+  for (auto& worker : workers) {
+    worker.join();
+  }
+  if (!ok) {
+    return 0;
+  }
+#ifdef __linux__
+  // Kick off writeback of the extent we just wrote so dirty pages drain to
+  // disk while subsequent records are CRC'd and written; the fdatasync in
+  // writeEndOfFile then has little left to wait for.
+  sync_file_range(write_fd_, start, nbytes, SYNC_FILE_RANGE_WRITE);
+#endif
+  // Advance the stream past the region written through the fd.
+  file_stream_.seekp(static_cast<std::streamoff>(start + nbytes));
+  return !file_stream_ ? 0 : nbytes;
+}
+#endif
+
 void PyTorchStreamWriter::writeEndOfFile() {
   // Ensurers that finalized is set to true even
   // exception is raised during the method call.
@@ -770,6 +936,18 @@ void PyTorchStreamWriter::writeEndOfFile() {
   if (file_stream_.is_open()) {
     file_stream_.close();
   }
+#ifndef _WIN32
+  if (write_fd_ != -1) {
+    // Complete the async writeback pipeline before handing the file over.
+#ifdef __APPLE__
+    fsync(write_fd_);
+#else
+    fdatasync(write_fd_);
+#endif
+    close(write_fd_);
+    write_fd_ = -1;
+  }
+#endif
 }
 
 void PyTorchStreamWriter::valid(const char* what, const char* info) {
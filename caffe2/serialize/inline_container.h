@@ -120,6 +120,10 @@ class TORCH_API ChunkRecordIterator {
   friend class PyTorchStreamReader;
 };
 
+namespace detail {
+struct MmapRegion;
+}
+
 class TORCH_API PyTorchStreamReader final {
  public:
   explicit PyTorchStreamReader(const std::string& file_name);
@@ -184,11 +188,24 @@ class TORCH_API PyTorchStreamReader final {
   void setAdditionalReaderSizeThreshold(const size_t& size){
     additional_reader_size_threshold_ = size;
   }
+  // When enabled (also via the TORCH_SERIALIZE_MMAP_RECORDS environment
+  // variable), getRecord serves uncompressed records of a file-backed archive
+  // as views into a single shared read-only mapping of the file instead of
+  // copying them into freshly allocated buffers. Pages are faulted in lazily
+  // from the page cache, so concurrent readers of the same checkpoint (e.g.
+  // dataloader workers) share one copy of the data. Only effective for
+  // readers constructed from a file name; compressed records fall back to
+  // the copying path.
+  void setEnableMmapReads(bool enable) {
+    enable_mmap_reads_ = enable;
+  }
  private:
   void init();
   size_t read(uint64_t pos, char* buf, size_t n);
   void valid(const char* what, const char* info = "");
   size_t getRecordID(const std::string& name);
+  size_t getRecordOffsetFromLocalHeader(uint64_t local_header_ofs);
+  at::DataPtr mapRecord(size_t record_offset, size_t size);
 
   friend size_t
   istream_read_func(void* pOpaque, uint64_t file_ofs, void* pBuf, size_t n);
@@ -201,6 +218,10 @@ class TORCH_API PyTorchStreamReader final {
   bool load_debug_symbol_ = true;
   std::string serialization_id_;
   size_t additional_reader_size_threshold_;
+  // Set only when constructed from a file name; required for mmap reads.
+  std::string file_name_;
+  std::shared_ptr<detail::MmapRegion> mmap_region_;
+  bool enable_mmap_reads_ = false;
 };
 
 class TORCH_API PyTorchStreamWriter final {
@@ -238,6 +259,7 @@ class TORCH_API PyTorchStreamWriter final {
   void setup(const std::string& file_name);
   void valid(const char* what, const char* info = "");
   void writeSerializationId();
+  size_t writeParallel(const void* buf, size_t nbytes);
   size_t current_pos_ = 0;
   std::unordered_set<std::string> files_written_;
   std::unique_ptr<mz_zip_archive> ar_;
@@ -245,6 +267,11 @@ class TORCH_API PyTorchStreamWriter final {
   std::string archive_name_plus_slash_;
   std::string padding_;
   std::ofstream file_stream_;
+  // Side fd on the output file for multi-threaded pwrite of large record
+  // payloads; -1 unless TORCH_SERIALIZE_WRITE_THREADS enables the parallel
+  // write path for a file-backed writer.
+  int write_fd_ = -1;
+  size_t write_threads_ = 1;
   std::function<size_t(const void*, size_t)> writer_func_;
   uint64_t combined_uncomp_crc32_ = 0;
   std::string serialization_id_;
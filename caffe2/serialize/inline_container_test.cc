@@ -106,6 +106,53 @@ TEST(PyTorchStreamWriterAndReader, SaveAndLoad) {
   remove(file_name);
 }
 
+#ifndef _WIN32
+TEST(PyTorchStreamWriterAndReader, MmapReads) {
+  std::ostringstream oss;
+  // write records through writers
+  PyTorchStreamWriter writer([&](const void* b, size_t n) -> size_t {
+    oss.write(static_cast<const char*>(b), n);
+    return oss ? n : 0;
+  });
+
+  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-member-init,cppcoreguidelines-avoid-magic-numbers)
+  std::array<char, 127> data1;
+  for (auto i : c10::irange(data1.size())) {
+    data1[i] = data1.size() - i;
+  }
+  writer.writeRecord("key1", data1.data(), data1.size());
+  writer.writeEndOfFile();
+
+  std::string the_file = oss.str();
+  const char* file_name = "output_mmap.zip";
+  std::ofstream foo(file_name, std::ios::binary);
+  foo.write(the_file.c_str(), the_file.size());
+  foo.close();
+
+  // Records of a file-backed reader are served as views into one shared
+  // read-only mapping of the archive.
+  PyTorchStreamReader reader(file_name);
+  reader.setEnableMmapReads(true);
+  at::DataPtr data_ptr;
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int64_t size;
+  std::tie(data_ptr, size) = reader.getRecord("key1");
+  ASSERT_EQ(size, data1.size());
+  ASSERT_EQ(memcmp(data_ptr.get(), data1.data(), data1.size()), 0);
+
+  // Two reads of the same record share the mapping.
+  at::DataPtr data_ptr2;
+  // NOLINTNEXTLINE(cppcoreguidelines-init-variables)
+  int64_t size2;
+  std::tie(data_ptr2, size2) = reader.getRecord("key1");
+  ASSERT_EQ(data_ptr2.get(), data_ptr.get());
+  ASSERT_EQ(size2, size);
+
+  // clean up
+  remove(file_name);
+}
+#endif
+
 TEST(PyTorchStreamWriterAndReader, LoadWithMultiThreads) {
 
   std::ostringstream oss;
@@ -5,7 +5,9 @@
 #include <torch/torch.h>
 
 #include <torch/csrc/autograd/FunctionsManual.h>
+#include <torch/csrc/autograd/checkpoint.h>
 #include <torch/csrc/autograd/functions/basic_ops.h>
+#include <torch/csrc/autograd/node_arena.h>
 
 #include <test/cpp/api/support.h>
 
@@ -180,6 +182,105 @@ TEST(AutogradAPITests, EmptyInput) {
       grad({x * 2}, /*inputs=*/{}, {x}), "grad requires non-empty inputs.");
 }
 
+TEST(AutogradAPITests, NativeCheckpointMatchesUncheckpointedGrads) {
+  auto x = torch::randn({4, 4}, torch::requires_grad());
+  auto y = torch::randn({4, 4}, torch::requires_grad());
+
+  int forward_runs = 0;
+  auto fn = [&forward_runs](const variable_list& inputs) -> variable_list {
+    forward_runs++;
+    auto z = inputs[0].sigmoid() * inputs[1];
+    return {(z + z.tanh()).sum().unsqueeze(0)};
+  };
+
+  // Reference run without checkpointing.
+  auto ref_out = fn({x, y});
+  backward(ref_out);
+  auto ref_gx = x.grad().clone();
+  auto ref_gy = y.grad().clone();
+  x.mutable_grad().reset();
+  y.mutable_grad().reset();
+  forward_runs = 0;
+
+  auto out = checkpoint(fn, {x, y});
+  // Forward ran once; the recompute only happens in backward.
+  ASSERT_EQ(forward_runs, 1);
+  backward(out);
+  ASSERT_EQ(forward_runs, 2);
+
+  ASSERT_VARIABLE_EQ(x.grad(), ref_gx);
+  ASSERT_VARIABLE_EQ(y.grad(), ref_gy);
+}
+
+TEST(AutogradAPITests, NativeCheckpointPolicySkipsRecompute) {
+  auto x = torch::randn({3, 3}, torch::requires_grad());
+
+  int forward_runs = 0;
+  auto fn = [&forward_runs](const variable_list& inputs) -> variable_list {
+    forward_runs++;
+    return {(inputs[0].exp() * inputs[0]).sum().unsqueeze(0)};
+  };
+
+  // Save everything: backward must not re-run the function.
+  CheckpointPolicy policy;
+  policy.default_decision = CheckpointDecision::Save;
+
+  auto out = checkpoint(fn, {x}, policy);
+  backward(out);
+  ASSERT_EQ(forward_runs, 1);
+
+  auto ref = torch::randn({3, 3});
+  ref.copy_(x.detach());
+  ref.requires_grad_();
+  auto ref_out = (ref.exp() * ref).sum();
+  ref_out.backward();
+  ASSERT_VARIABLE_EQ(x.grad(), ref.grad());
+}
+
+TEST(AutogradAPITests, NodeArenaGradParity) {
+  auto x = torch::randn({5, 5}, torch::requires_grad());
+
+  auto ref = (x * x + x).sum();
+  ref.backward();
+  auto ref_grad = x.grad().clone();
+  x.mutable_grad().reset();
+
+  {
+    NodeArenaGuard arena;
+    auto out = (x * x + x).sum();
+    out.backward();
+  }
+  ASSERT_VARIABLE_EQ(x.grad(), ref_grad);
+}
+
+TEST(AutogradAPITests, NodeArenaGraphOutlivesGuard) {
+  auto x = torch::randn({5, 5}, torch::requires_grad());
+  torch::Tensor out;
+  {
+    NodeArenaGuard arena;
+    out = (x * x + x).sum();
+  }
+  // The graph holds Nodes allocated from the arena; the slabs stay alive
+  // until the last of them dies, so backward after the scope is fine.
+  out.backward();
+  ASSERT_VARIABLE_EQ(x.grad(), 2 * x.detach() + 1);
+
+  // Nested scopes each get their own arena.
+  torch::Tensor inner_out;
+  {
+    NodeArenaGuard outer;
+    {
+      NodeArenaGuard inner;
+      inner_out = (x.exp() + x).sum();
+    }
+    auto outer_out = (x * 2).sum();
+    outer_out.backward({}, /*keep_graph=*/true);
+  }
+  x.mutable_grad().reset();
+  inner_out.backward();
+  ASSERT_VARIABLE_EQ(x.grad(), x.detach().exp() + 1);
+}
+
 TEST(AutogradAPITests, RetainGrad) {
   auto input = torch::rand({1, 3}, torch::requires_grad());
   auto h1 = input * 3;
@@ -1033,6 +1033,17 @@ TEST(DataLoaderTest, DataLoaderOptionsDefaultAsExpected) {
   ASSERT_EQ(full_options.max_jobs, 0);
   ASSERT_FALSE(full_options.timeout.has_value());
   ASSERT_TRUE(full_options.enforce_ordering);
+  ASSERT_FALSE(full_options.pin_memory);
+}
+
+TEST(DataLoaderTest, PinMemoryPassesThroughNonTensorBatches) {
+  // Batches without tensor components (and already-pinned or non-CPU
+  // tensors) are returned unchanged by the pinning stage.
+  ASSERT_EQ(torch::data::detail::pin_memory(42), 42);
+  std::vector<int> indices = {1, 2, 3};
+  ASSERT_EQ(torch::data::detail::pin_memory(indices), indices);
+  torch::Tensor undefined;
+  ASSERT_FALSE(torch::data::detail::pin_memory(undefined).defined());
 }
 
 TEST(DataLoaderTest, DataLoaderOptionsCoalesceOptionalValues) {
@@ -647,6 +647,40 @@ TEST(InferenceModeTest, TestCustomFunction) {
   }
 }
 
+TEST(InferenceModeTest, TestConvertToInferenceTensors) {
+  torch::Tensor a = torch::ones({2, 3});
+  torch::Tensor b = torch::rand({4});
+  ASSERT_FALSE(a.is_inference());
+
+  torch::autograd::impl::convert_to_inference_tensors({a, b});
+  ASSERT_TRUE(a.is_inference());
+  ASSERT_TRUE(b.is_inference());
+  // Converted tensors behave like tensors born in InferenceMode: no
+  // version counter bumps on in-place ops, and functional ops outside
+  // InferenceMode produce normal tensors again.
+  inplace_op(a);
+  torch::Tensor c = functional_op(a);
+  ASSERT_FALSE(c.is_inference());
+
+  // Converting twice is a no-op.
+  torch::autograd::impl::convert_to_inference_tensors({a});
+  ASSERT_TRUE(a.is_inference());
+
+  // Tensors that require grad cannot be converted.
+  torch::Tensor leaf = torch::ones({2}).set_requires_grad(true);
+  ASSERT_THROWS_WITH(
+      torch::autograd::impl::convert_to_inference_tensors({leaf}),
+      "Cannot convert a tensor that requires grad to an inference tensor");
+
+  // Neither can tensors whose version counter is shared with a view.
+  torch::Tensor base = torch::ones({2, 3});
+  torch::Tensor alias = view_op(base);
+  ASSERT_THROWS_WITH(
+      torch::autograd::impl::convert_to_inference_tensors({base}),
+      "version counter is shared");
+  (void)alias;
+}
+
 TEST(InferenceModeTest, TestLegacyAutoNonVariableTypeModeWarning) {
   c10::WarningUtils::WarnAlways warn_always(true);
   WarningCapture warnings;
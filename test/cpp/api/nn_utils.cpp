@@ -389,6 +389,56 @@ TEST_F(NNUtilsTest, ConvertParameters) {
   }
 }
 
+TEST_F(NNUtilsTest, FlatParameter) {
+  auto model = Linear(3, 4);
+  auto reference = Linear(3, 4);
+  {
+    torch::NoGradGuard no_grad;
+    for (const auto i : c10::irange(model->parameters().size())) {
+      reference->parameters()[i].copy_(model->parameters()[i]);
+    }
+  }
+
+  utils::FlatParameter flat(model->parameters());
+  ASSERT_EQ(flat.flat().numel(), 16);
+  ASSERT_EQ(flat.views().size(), 2);
+
+  // The module's parameters are now views into the flat buffer.
+  {
+    torch::NoGradGuard no_grad;
+    flat.flat().zero_();
+  }
+  for (const auto& param : model->parameters()) {
+    ASSERT_TRUE(param.eq(0).all().item<bool>());
+  }
+  {
+    torch::NoGradGuard no_grad;
+    for (const auto i : c10::irange(model->parameters().size())) {
+      model->parameters()[i].copy_(reference->parameters()[i]);
+    }
+  }
+
+  // One Adam over the flat buffer matches per-parameter Adam.
+  torch::optim::Adam flat_optimizer(
+      {flat.flat()}, torch::optim::AdamOptions(0.1));
+  torch::optim::Adam reference_optimizer(
+      reference->parameters(), torch::optim::AdamOptions(0.1));
+  auto input = torch::randn({2, 3});
+  for ([[maybe_unused]] const auto step : c10::irange(3)) {
+    model->zero_grad();
+    reference->zero_grad();
+    model->forward(input).sum().backward();
+    reference->forward(input).sum().backward();
+    flat.sync_grad();
+    flat_optimizer.step();
+    reference_optimizer.step();
+  }
+  for (const auto i : c10::irange(model->parameters().size())) {
+    ASSERT_TRUE(torch::allclose(
+        model->parameters()[i], reference->parameters()[i]));
+  }
+}
+
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-avoid-non-const-global-variables)
 int64_t PackedSequenceTest_batch_size = 5;
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-magic-numbers,cppcoreguidelines-avoid-non-const-global-variables)
@@ -320,6 +320,31 @@ TEST(SerializeTest, BasicToFile) {
   ASSERT_TRUE(x.allclose(y));
 }
 
+TEST(SerializeTest, SnapshotAsync) {
+  torch::manual_seed(0);
+
+  std::vector<torch::Tensor> tensors = {
+      torch::randn({5, 5}), torch::randn({3})};
+  std::vector<torch::Tensor> originals = {
+      tensors[0].clone(), tensors[1].clone()};
+
+  auto tempfile = c10::make_tempfile();
+  auto snapshot = torch::serialize::snapshot_async(tensors, tempfile.name);
+  // In-place writes after the snapshot must not leak into the checkpoint.
+  tensors[0].add_(1);
+  tensors[1].zero_();
+  snapshot.wait();
+  ASSERT_TRUE(snapshot.done());
+
+  std::vector<torch::Tensor> loaded;
+  torch::load(loaded, tempfile.name);
+
+  ASSERT_EQ(loaded.size(), originals.size());
+  for (const auto i : c10::irange(originals.size())) {
+    ASSERT_TRUE(loaded[i].allclose(originals[i]));
+  }
+}
+
 TEST(SerializeTest, BasicViaFunc) {
   torch::manual_seed(0);
 
@@ -0,0 +1,156 @@
+#include <functional>
+#include <thread>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <ATen/ATen.h>
+#include <torch/csrc/distributed/c10d/ProcessGroupIntraProcess.hpp>
+
+namespace {
+
+constexpr int kWorldSize = 4;
+
+// Runs `fn(rank)` on one thread per rank and joins them.
+void runOnRanks(const std::function<void(int)>& fn) {
+  std::vector<std::thread> threads;
+  threads.reserve(kWorldSize);
+  for (int rank = 0; rank < kWorldSize; rank++) {
+    threads.emplace_back([&fn, rank] { fn(rank); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+}
+
+} // namespace
+
+TEST(ProcessGroupIntraProcessTest, AllreduceSum) {
+  std::vector<at::Tensor> results(kWorldSize);
+  runOnRanks([&](int rank) {
+    c10d::ProcessGroupIntraProcess pg(rank, kWorldSize, "allreduce_sum");
+    std::vector<at::Tensor> tensors = {
+        at::full({16, 16}, static_cast<float>(rank + 1))};
+    pg.allreduce(tensors)->wait();
+    results[rank] = tensors[0];
+  });
+  // 1 + 2 + 3 + 4
+  const auto expected = at::full({16, 16}, 10.0f);
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.equal(expected));
+  }
+}
+
+TEST(ProcessGroupIntraProcessTest, AllreduceAvg) {
+  std::vector<at::Tensor> results(kWorldSize);
+  runOnRanks([&](int rank) {
+    c10d::ProcessGroupIntraProcess pg(rank, kWorldSize, "allreduce_avg");
+    std::vector<at::Tensor> tensors = {
+        at::full({8}, static_cast<float>(rank))};
+    c10d::AllreduceOptions opts;
+    opts.reduceOp = c10d::ReduceOp::AVG;
+    pg.allreduce(tensors, opts)->wait();
+    results[rank] = tensors[0];
+  });
+  // (0 + 1 + 2 + 3) / 4
+  const auto expected = at::full({8}, 1.5f);
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.equal(expected));
+  }
+}
+
+TEST(ProcessGroupIntraProcessTest, AllreduceMax) {
+  std::vector<at::Tensor> results(kWorldSize);
+  runOnRanks([&](int rank) {
+    c10d::ProcessGroupIntraProcess pg(rank, kWorldSize, "allreduce_max");
+    std::vector<at::Tensor> tensors = {
+        at::full({8}, static_cast<float>(rank))};
+    c10d::AllreduceOptions opts;
+    opts.reduceOp = c10d::ReduceOp::MAX;
+    pg.allreduce(tensors, opts)->wait();
+    results[rank] = tensors[0];
+  });
+  const auto expected = at::full({8}, 3.0f);
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.equal(expected));
+  }
+}
+
+TEST(ProcessGroupIntraProcessTest, Broadcast) {
+  std::vector<at::Tensor> results(kWorldSize);
+  runOnRanks([&](int rank) {
+    c10d::ProcessGroupIntraProcess pg(rank, kWorldSize, "broadcast");
+    std::vector<at::Tensor> tensors = {
+        at::full({4, 4}, static_cast<float>(rank))};
+    c10d::BroadcastOptions opts;
+    opts.rootRank = 2;
+    pg.broadcast(tensors, opts)->wait();
+    results[rank] = tensors[0];
+  });
+  const auto expected = at::full({4, 4}, 2.0f);
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.equal(expected));
+  }
+}
+
+TEST(ProcessGroupIntraProcessTest, Reduce) {
+  std::vector<at::Tensor> results(kWorldSize);
+  runOnRanks([&](int rank) {
+    c10d::ProcessGroupIntraProcess pg(rank, kWorldSize, "reduce");
+    std::vector<at::Tensor> tensors = {at::ones({8})};
+    c10d::ReduceOptions opts;
+    opts.rootRank = 1;
+    pg.reduce(tensors, opts)->wait();
+    results[rank] = tensors[0];
+  });
+  // Only the root's output is defined; non-root inputs stay untouched.
+  EXPECT_TRUE(results[1].equal(at::full({8}, 4.0f)));
+  EXPECT_TRUE(results[0].equal(at::ones({8})));
+  EXPECT_TRUE(results[2].equal(at::ones({8})));
+}
+
+TEST(ProcessGroupIntraProcessTest, Allgather) {
+  std::vector<std::vector<at::Tensor>> results(kWorldSize);
+  runOnRanks([&](int rank) {
+    c10d::ProcessGroupIntraProcess pg(rank, kWorldSize, "allgather");
+    std::vector<at::Tensor> inputs = {
+        at::full({4}, static_cast<float>(rank))};
+    std::vector<std::vector<at::Tensor>> outputs(1);
+    for (int r = 0; r < kWorldSize; r++) {
+      outputs[0].push_back(at::zeros({4}));
+    }
+    pg.allgather(outputs, inputs)->wait();
+    results[rank] = outputs[0];
+  });
+  for (const auto& output : results) {
+    for (int r = 0; r < kWorldSize; r++) {
+      EXPECT_TRUE(output[r].equal(at::full({4}, static_cast<float>(r))));
+    }
+  }
+}
+
+TEST(ProcessGroupIntraProcessTest, AllgatherBase) {
+  std::vector<at::Tensor> results(kWorldSize);
+  runOnRanks([&](int rank) {
+    c10d::ProcessGroupIntraProcess pg(rank, kWorldSize, "allgather_base");
+    auto input = at::full({4}, static_cast<float>(rank));
+    auto output = at::zeros({4 * kWorldSize});
+    pg._allgather_base(output, input)->wait();
+    results[rank] = output;
+  });
+  auto expected = at::cat(
+      {at::full({4}, 0.0f),
+       at::full({4}, 1.0f),
+       at::full({4}, 2.0f),
+       at::full({4}, 3.0f)});
+  for (const auto& result : results) {
+    EXPECT_TRUE(result.equal(expected));
+  }
+}
+
+TEST(ProcessGroupIntraProcessTest, SizeMismatchThrows) {
+  c10d::ProcessGroupIntraProcess pg(0, 2, "size_mismatch");
+  // NOLINTNEXTLINE(hicpp-avoid-goto,cppcoreguidelines-avoid-goto)
+  EXPECT_THROW(
+      c10d::ProcessGroupIntraProcess(1, 3, "size_mismatch"), c10::Error);
+}
@@ -451,6 +451,39 @@ TEST(AliasAnalysisTest, NoneHasNoWriters) {
   EXPECT_FALSE(aliasDb.hasWriters(vmap["opt"]->node()));
 }
 
+TEST(AliasAnalysisTest, IncrementalWriteMaintenance) {
+  auto graph = std::make_shared<Graph>();
+  std::unordered_map<std::string, Value*> vmap;
+  parseIR(
+      R"IR(
+  graph(%x : Tensor):
+      %2 : int = prim::Constant[value=0]()
+      %3 : int = prim::Constant[value=1]()
+      %b : Tensor = aten::add(%x, %2, %3)
+      return (%b)
+    )IR",
+      &*graph,
+      vmap);
+
+  AliasDb aliasDb(graph);
+  EXPECT_FALSE(aliasDb.hasWriters(vmap["b"]));
+
+  // Simulate a pass inserting a mutating node and keeping the AliasDb in
+  // sync instead of rebuilding it.
+  Node* mutator = graph->create(Symbol::aten("relu_"), {vmap["b"]});
+  graph->appendNode(mutator);
+  mutator->output()->setType(vmap["b"]->type());
+  aliasDb.copyValue(vmap["b"], mutator->output());
+  aliasDb.registerWrittenValue(mutator, vmap["b"]);
+  EXPECT_TRUE(aliasDb.hasWriters(vmap["b"]));
+  EXPECT_TRUE(aliasDb.writesToAlias(mutator, {vmap["b"]}));
+
+  // Removing the node's writes restores the original answers.
+  aliasDb.eraseNodeWrites(mutator);
+  mutator->destroy();
+  EXPECT_FALSE(aliasDb.hasWriters(vmap["b"]));
+}
+
 TEST(AliasAnalysisTest, SafeToChangeAliasingRelationship) {
   auto graph = std::make_shared<Graph>();
   std::unordered_map<std::string, Value*> vmap;
@@ -3,6 +3,7 @@
 #include <gtest/gtest.h>
 
 #include <c10/core/TensorOptions.h>
+#include <c10/core/impl/alloc_cpu.h>
 #include <torch/csrc/autograd/generated/variable_factories.h>
 #include <torch/csrc/jit/api/module.h>
 #include <torch/csrc/jit/frontend/resolver.h>
@@ -127,6 +128,49 @@ TEST(FlatbufferTest, UpsampleNearest2dWithCopyTensorMemory) {
   ASSERT_TRUE(resd2.equal(refd));
 }
 
+TEST(FlatbufferTest, DelayedMethodParsing) {
+  Module m("m");
+  m.define(R"(
+    def forward(self, input: Tensor, scale: float):
+      return input * scale
+    def add_one(self, input: Tensor):
+      return input + 1
+  )");
+
+  std::vector<IValue> inputs;
+  inputs.emplace_back(torch::rand({2, 4}));
+  inputs.emplace_back(at::Scalar(2.0));
+
+  CompilationOptions options;
+  mobile::Module bc = jitModuleToMobile(m, options);
+  auto ref = bc.forward(inputs).toTensor();
+  auto ref_add_one = bc.run_method("add_one", inputs[0]).toTensor();
+
+  auto buff = save_mobile_module_to_bytes(bc);
+  std::shared_ptr<char> data(
+      static_cast<char*>(c10::alloc_cpu(buff->size())), c10::free_cpu);
+  memcpy(data.get(), buff->data(), buff->size());
+
+  mobile::Module bc2 = parse_and_initialize_mobile_module(
+      std::move(data),
+      buff->size(),
+      /*device=*/std::nullopt,
+      /*extra_files=*/nullptr,
+      /*should_delay_method_parsing=*/true);
+
+  // Methods are visible before they have been materialized, and each one
+  // is parsed on its first call.
+  ASSERT_TRUE(bc2.find_method("add_one").has_value());
+  auto res = bc2.forward(inputs).toTensor();
+  ASSERT_TRUE(res.equal(ref));
+  auto res_add_one = bc2.run_method("add_one", inputs[0]).toTensor();
+  ASSERT_TRUE(res_add_one.equal(ref_add_one));
+
+  // A second call runs the already-materialized code.
+  auto res2 = bc2.forward(inputs).toTensor();
+  ASSERT_TRUE(res2.equal(ref));
+}
+
 TEST(FlatbufferTest, CheckAttrAccess) {
   Module m("m");
   m.register_attribute("mobile_optimized", BoolType::get(), true);
@@ -292,5 +292,51 @@ graph(%0 : Tensor,
   FLAGS_torch_jit_enable_rethrow_caught_exception = original_flag_value;
 }
 
+TEST(InterpreterTest, SuperInstructionFusion) {
+  auto graph = std::make_shared<Graph>();
+  std::unordered_map<std::string, Value*> vmap;
+  parseIR(
+      R"IR(
+graph(%a : Tensor,
+      %b : Tensor):
+  %x : Tensor = aten::mul(%a, %b)
+  %y : Tensor = aten::mul(%a, %b)
+  %z : Tensor = aten::mul(%x, %y)
+  return (%z)
+  )IR",
+      &*graph,
+      vmap);
+
+  auto a = at::rand({3, 4});
+  auto b = at::rand({3, 4});
+
+  const bool original_fusion_mode = getInstructionFusionMode();
+  getInstructionFusionMode() = false;
+  Code unfused(graph, "");
+  std::vector<IValue> stack({a, b});
+  InterpreterState(unfused).run(stack);
+  auto expected = stack.at(0).toTensor();
+
+  getInstructionFusionMode() = true;
+  Code fused(graph, "");
+  getInstructionFusionMode() = original_fusion_mode;
+
+  // `%a` and `%b` have later uses, so `%x` is emitted as LOAD/LOAD/OP/STORE,
+  // which must collapse into LOAD2/OP_STORE.
+  size_t num_load2 = 0;
+  size_t num_op_store = 0;
+  for (const auto& inst : fused.instructions()) {
+    num_load2 += inst.op == LOAD2;
+    num_op_store += inst.op == OP_STORE;
+  }
+  EXPECT_GT(num_load2, 0);
+  EXPECT_GT(num_op_store, 0);
+  EXPECT_LT(fused.instructions().size(), unfused.instructions().size());
+
+  stack = {a, b};
+  InterpreterState(fused).run(stack);
+  ASSERT_TRUE(exactlyEqual(stack.at(0).toTensor(), expected));
+}
+
 } // namespace jit
 } // namespace torch
@@ -33,6 +33,7 @@
 #include <torch/csrc/jit/passes/constant_propagation.h>
 #include <torch/csrc/jit/passes/create_autodiff_subgraphs.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
+#include <torch/csrc/jit/passes/fork_independent_subgraphs.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
 #include <torch/csrc/jit/passes/guard_elimination.h>
 #include <torch/csrc/jit/passes/inline_autodiff_subgraphs.h>
@@ -359,6 +360,59 @@ TEST(ATenNativeBatchNormTest, Basic) {
   assertAllClose(tensor_grads_out, expected_tensor_grads_out);
 }
 
+TEST(ForkIndependentSubgraphsTest, ForksIndependentBranches) {
+  auto graph_string = R"IR(
+    graph(%a : Float(64, 64),
+          %b : Float(64, 64)):
+      %x1 : Float(64, 64) = aten::relu(%a)
+      %x2 : Float(64, 64) = aten::relu(%x1)
+      %y1 : Float(64, 64) = aten::relu(%b)
+      %y2 : Float(64, 64) = aten::relu(%y1)
+      %z : Float(64, 64) = aten::mul(%x2, %y2)
+      return (%z))IR";
+  auto graph = std::make_shared<Graph>();
+  torch::jit::parseIR(graph_string, graph.get());
+
+  ASSERT_TRUE(ForkIndependentSubgraphs(graph, /*min_cost=*/1));
+
+  size_t num_forks = 0;
+  size_t num_waits = 0;
+  for (const Node* node : graph->nodes()) {
+    num_forks += node->kind() == prim::fork;
+    num_waits += node->kind() == aten::wait;
+  }
+  // The two relu branches must each end up behind a fork, joined by waits.
+  ASSERT_GE(num_forks, 2);
+  ASSERT_EQ(num_forks, num_waits);
+  graph->lint();
+
+  auto a = at::randn({64, 64});
+  auto b = at::randn({64, 64});
+  auto expected = at::mul(at::relu(at::relu(a)), at::relu(at::relu(b)));
+  Code code(graph, "");
+  std::vector<IValue> stack({a, b});
+  InterpreterState(code).run(stack);
+  ASSERT_TRUE(at::equal(stack.at(0).toTensor(), expected));
+}
+
+TEST(ForkIndependentSubgraphsTest, RespectsCostThreshold) {
+  auto graph_string = R"IR(
+    graph(%a : Float(2, 2),
+          %b : Float(2, 2)):
+      %x : Float(2, 2) = aten::relu(%a)
+      %y : Float(2, 2) = aten::relu(%b)
+      %z : Float(2, 2) = aten::mul(%x, %y)
+      return (%z))IR";
+  auto graph = std::make_shared<Graph>();
+  torch::jit::parseIR(graph_string, graph.get());
+
+  // Cheap chains stay untouched under the default threshold.
+  ASSERT_FALSE(ForkIndependentSubgraphs(graph));
+  for (const Node* node : graph->nodes()) {
+    ASSERT_NE(node->kind(), prim::fork);
+  }
+}
+
 TEST(CustomFusionTest, Basic) {
 #if defined(FBCODE_CAFFE2)
   return;
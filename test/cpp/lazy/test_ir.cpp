@@ -2,6 +2,7 @@
 
 #include <c10/core/ScalarType.h>
 #include <c10/util/Exception.h>
+#include <c10/util/tempfile.h>
 #include <torch/csrc/lazy/core/config.h>
 #include <torch/csrc/lazy/core/debug_util.h>
 #include <torch/csrc/lazy/core/dynamic_ir.h>
@@ -175,5 +176,30 @@ TEST(IrTest, DimensionIsDynamicTest) {
   ASSERT_EQ(true, mul_dim->isSymbolic());
 }
 
+TEST(IrTest, ShapeCachePersistenceTest) {
+  // populate the shape cache with at least one entry
+  NodePtr node = MakeNode<TestLeafNode>(42);
+  node->addComputedShape(
+      []() { return Shape(c10::ScalarType::Float, {2, 3}); });
+  EXPECT_EQ(node->shape(), Shape(c10::ScalarType::Float, {2, 3}));
+
+  const std::string fingerprint = "test-model-v1";
+  auto cache_file = c10::make_tempfile("lazy-shape-cache-");
+
+  ASSERT_TRUE(SaveShapeCache(cache_file.name, fingerprint));
+  // loading with the matching fingerprint round-trips the saved entries
+  EXPECT_GT(LoadShapeCache(cache_file.name, fingerprint), 0);
+  // a different fingerprint (or a missing file) loads nothing
+  EXPECT_EQ(LoadShapeCache(cache_file.name, "some-other-model"), 0);
+  EXPECT_EQ(LoadShapeCache(cache_file.name + ".missing", fingerprint), 0);
+
+  // the cached shape is still served after the reload
+  NodePtr node2 = MakeNode<TestLeafNode>(42);
+  node2->addComputedShape([]() -> Shape {
+    TORCH_INTERNAL_ASSERT(false, "shape_fn should not be called on a hit");
+  });
+  EXPECT_EQ(node2->shape(), Shape(c10::ScalarType::Float, {2, 3}));
+}
+
 } // namespace lazy
 } // namespace torch
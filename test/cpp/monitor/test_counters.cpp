@@ -279,6 +279,44 @@ TEST(MonitorTest, StatEvent) {
   ASSERT_EQ(e.data, data);
 }
 
+TEST(MonitorTest, StatConcurrentAdds) {
+  TestStat<int64_t> a{
+      "a",
+      {Aggregation::COUNT,
+       Aggregation::SUM,
+       Aggregation::MIN,
+       Aggregation::MAX},
+      std::chrono::hours(10),
+  };
+
+  constexpr int64_t kThreads = 4;
+  constexpr int64_t kAddsPerThread = 1000;
+  std::vector<std::thread> threads;
+  threads.reserve(kThreads);
+  for (int64_t t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&a, t]() {
+      for (int64_t i = 0; i < kAddsPerThread; ++i) {
+        a.add(t * kAddsPerThread + i);
+      }
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  ASSERT_EQ(a.count(), kThreads * kAddsPerThread);
+
+  // close the window and check the merged shard values
+  a.mockWindowId = 100;
+  a.add(1);
+
+  auto stats = a.get();
+  constexpr int64_t n = kThreads * kAddsPerThread;
+  ASSERT_EQ(stats[Aggregation::COUNT], n);
+  ASSERT_EQ(stats[Aggregation::SUM], n * (n - 1) / 2);
+  ASSERT_EQ(stats[Aggregation::MIN], 0);
+  ASSERT_EQ(stats[Aggregation::MAX], n - 1);
+}
+
 TEST(MonitorTest, StatEventDestruction) {
   HandlerGuard<AggregatingEventHandler> guard;
 
@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+
+#include <c10/util/tempfile.h>
+#include <torch/csrc/monitor/ring_log.h>
+
+using namespace torch::monitor;
+
+#ifndef _WIN32
+
+TEST(RingLogTest, WriteAndTail) {
+  auto dir = c10::make_tempdir("ring_log");
+  std::string path = dir.name + "/scalars.ring";
+
+  RingLogFile file(path, 16);
+  ASSERT_EQ(file.capacity(), 16);
+  ASSERT_EQ(file.written(), 0);
+
+  file.log("loss", 1.5);
+  file.log("lr", 1e-4);
+  ASSERT_EQ(file.written(), 2);
+
+  RingLogReader reader(path);
+  ASSERT_EQ(reader.capacity(), 16);
+  ASSERT_EQ(reader.cursor(), 2);
+
+  ScalarRecord rec;
+  ASSERT_TRUE(reader.read(1, rec));
+  ASSERT_STREQ(rec.name, "loss");
+  ASSERT_EQ(rec.value, 1.5);
+  ASSERT_GT(rec.timestampNs, 0);
+
+  ASSERT_TRUE(reader.read(2, rec));
+  ASSERT_STREQ(rec.name, "lr");
+  ASSERT_EQ(rec.value, 1e-4);
+
+  // Not written yet.
+  ASSERT_FALSE(reader.read(3, rec));
+  ASSERT_FALSE(reader.read(0, rec));
+}
+
+TEST(RingLogTest, WrapsAndDropsOldRecords) {
+  auto dir = c10::make_tempdir("ring_log");
+  std::string path = dir.name + "/scalars.ring";
+
+  RingLogFile file(path, 4);
+  for (int i = 1; i <= 10; i++) {
+    file.log("grad_norm", static_cast<double>(i));
+  }
+  ASSERT_EQ(file.written(), 10);
+
+  RingLogReader reader(path);
+  ASSERT_EQ(reader.cursor(), 10);
+
+  ScalarRecord rec;
+  // The first six records were overwritten by later laps of the ring.
+  for (uint64_t seq = 1; seq <= 6; seq++) {
+    ASSERT_FALSE(reader.read(seq, rec));
+  }
+  for (uint64_t seq = 7; seq <= 10; seq++) {
+    ASSERT_TRUE(reader.read(seq, rec));
+    ASSERT_EQ(rec.value, static_cast<double>(seq));
+  }
+}
+
+TEST(RingLogTest, TruncatesLongNames) {
+  auto dir = c10::make_tempdir("ring_log");
+  std::string path = dir.name + "/scalars.ring";
+
+  RingLogFile file(path, 4);
+  std::string name(2 * kScalarRecordNameLen, 'x');
+  file.log(name.c_str(), 1.0);
+
+  RingLogReader reader(path);
+  ScalarRecord rec;
+  ASSERT_TRUE(reader.read(1, rec));
+  ASSERT_EQ(std::string(rec.name), name.substr(0, kScalarRecordNameLen - 1));
+}
+
+TEST(RingLogTest, EventHandlerWritesNumericData) {
+  auto dir = c10::make_tempdir("ring_log");
+  std::string path = dir.name + "/scalars.ring";
+
+  auto file = std::make_shared<RingLogFile>(path, 16);
+  auto handler = std::make_shared<RingLogHandler>(file);
+  registerEventHandler(handler);
+
+  Event e;
+  e.name = "torch.monitor.TestEvent";
+  e.timestamp = std::chrono::system_clock::now();
+  e.data["loss"] = 0.25;
+  e.data["step"] = 7L;
+  e.data["note"] = "skipped, not numeric";
+  logEvent(e);
+
+  unregisterEventHandler(handler);
+
+  // Two numeric entries, the string is dropped.
+  ASSERT_EQ(file->written(), 2);
+
+  RingLogReader reader(path);
+  ScalarRecord rec;
+  bool sawLoss = false;
+  bool sawStep = false;
+  for (uint64_t seq = 1; seq <= 2; seq++) {
+    ASSERT_TRUE(reader.read(seq, rec));
+    if (std::string(rec.name) == "torch.monitor.TestEvent.loss") {
+      ASSERT_EQ(rec.value, 0.25);
+      sawLoss = true;
+    } else if (std::string(rec.name) == "torch.monitor.TestEvent.step") {
+      ASSERT_EQ(rec.value, 7.0);
+      sawStep = true;
+    }
+  }
+  ASSERT_TRUE(sawLoss);
+  ASSERT_TRUE(sawStep);
+}
+
+#endif // _WIN32
@@ -304,6 +304,47 @@ TEST(RecordFunctionTest, MultipleCallbacks) {
   ASSERT_FALSE(at::hasCallbacks());
 }
 
+// Test that callbacks restricted to certain op names only run for those ops.
+TEST(RecordFunctionTest, OpNameFilter) {
+  at::clearCallbacks();
+  ASSERT_FALSE(at::hasCallbacks());
+
+  static int name_filter_start_counter;
+  static int name_filter_end_counter;
+  name_filter_start_counter = 0;
+  name_filter_end_counter = 0;
+
+  auto start_callback =
+      [](const at::RecordFunction& fn) -> std::unique_ptr<at::ObserverContext> {
+    ++name_filter_start_counter;
+    EXPECT_STREQ(fn.name(), "Interesting");
+    return nullptr;
+  };
+  auto end_callback = [](const at::RecordFunction& fn, at::ObserverContext*) {
+    ++name_filter_end_counter;
+  };
+
+  auto handle = at::addThreadLocalCallback(
+      at::RecordFunctionCallback(start_callback, end_callback)
+          .opNames({"Interesting"})
+          .scopes({at::RecordScope::FUNCTION}));
+
+  { RECORD_FUNCTION("Boring", {}); }
+  EXPECT_EQ(name_filter_start_counter, 0);
+  EXPECT_EQ(name_filter_end_counter, 0);
+
+  { RECORD_FUNCTION("Interesting", {}); }
+  EXPECT_EQ(name_filter_start_counter, 1);
+  EXPECT_EQ(name_filter_end_counter, 1);
+
+  { RECORD_FUNCTION("Boring", {}); }
+  EXPECT_EQ(name_filter_start_counter, 1);
+  EXPECT_EQ(name_filter_end_counter, 1);
+
+  at::removeCallback(handle);
+  ASSERT_FALSE(at::hasCallbacks());
+}
+
 // Test that KwargsOnly callbacks are run in USER_SCOPE.
 TEST(RecordFunctionTest, KwargsOnly) {
   at::clearCallbacks();
@@ -2050,6 +2050,7 @@ class DistributedDataParallelTest(
         for comm_hook_type in [
             dist.BuiltinCommHookType.ALLREDUCE,
             dist.BuiltinCommHookType.FP16_COMPRESS,
+            dist.BuiltinCommHookType.INT8_COMPRESS,
         ]:
             # Get GPU model with the built-in communication hook.
             gpu_model = self._gpu_model_with_builtin_ddp_comm_hook(
@@ -319,6 +319,26 @@ class TCPStoreTest(TestCase, StoreTestBase):
         self.assertEqual(store1.libuvBackend, self._use_libuv)
         self.assertEqual(store2.libuvBackend, self._use_libuv)
 
+    @retry_on_connect_failures
+    def test_sharded_store(self):
+        addr = DEFAULT_HOSTNAME
+        port = common.find_free_port()
+
+        server = dist.TCPStore(
+            addr, port, 1, True, num_shards=4, use_libuv=self._use_libuv
+        )
+        client = dist.TCPStore(
+            addr, port, 1, False, num_shards=4, use_libuv=self._use_libuv
+        )
+        keys = [f"key{i}" for i in range(16)]
+        for i, key in enumerate(keys):
+            server.set(key, str(i))
+        client.wait(keys)
+        self.assertTrue(client.check(keys))
+        self.assertEqual(client.multi_get(keys), [str(i).encode() for i in range(16)])
+        # num_keys sums across shards; one extra key coordinates the workers
+        self.assertEqual(client.num_keys(), len(keys) + 1)
+
     def test_repr(self) -> None:
         # server
         store1 = self._create_store()
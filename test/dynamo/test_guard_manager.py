@@ -743,6 +743,70 @@ num_guards_executed=0)
         # fails because of len check
         self.assertFalse(root.check(f_locals))
 
+    def test_flat_guards(self):
+        class Foo:
+            def __init__(self, x, y):
+                self.x = x
+                self.y = y
+
+        foo = Foo(1, 2)
+        guard_manager = RootGuardManager()
+        guard_manager.add_type_match_guard(id_type(foo), ["type(x) == Foo"])
+        guard_manager.getattr_manager("x", "x", 1, default_mgr_enum).add_lambda_guard(
+            functools.partial(equals_match, expected=foo.x),
+            equals_match_verbose_code_parts(foo.x),
+        )
+        guard_manager.getattr_manager("y", "y", 2, default_mgr_enum).add_lambda_guard(
+            functools.partial(equals_match, expected=foo.y),
+            equals_match_verbose_code_parts(foo.y),
+        )
+
+        prev = guards.flat_guards_enabled()
+        guards.set_flat_guards_enabled(True)
+        try:
+            # The flat plan must agree with the tree walk on both pass and
+            # fail.
+            self.assertTrue(guard_manager.check(foo))
+            self.assertFalse(guard_manager.check(Foo(3, 4)))
+            self.assertFalse(guard_manager.check("foo"))
+            self.assertTrue(guard_manager.check(foo))
+
+            # Adding a guard after the plan is built must invalidate it.
+            guard_manager.getattr_manager(
+                "y", "y", 2, default_mgr_enum
+            ).add_lambda_guard(
+                functools.partial(less_match, expected=3),
+                less_match_verbose_code_parts(3),
+            )
+            self.assertTrue(guard_manager.check(foo))
+            self.assertFalse(guard_manager.check(Foo(1, 4)))
+        finally:
+            guards.set_flat_guards_enabled(prev)
+
+    def test_flat_guards_fall_back_on_dict_manager(self):
+        f_locals = {"d": {"a": 1}}
+        root = RootGuardManager()
+        dict_mgr = root.getitem_manager(
+            "d",
+            "",
+            f_locals["d"],
+            torch._dynamo.guards.GuardManagerType.DICT_GUARD_MANAGER,
+        )
+        self.assertTrue(isinstance(dict_mgr, DictGuardManager))
+        dict_mgr.get_key_manager(0, "", "a", default_mgr_enum).add_equals_match_guard(
+            "a", ["key == 'a'"]
+        )
+
+        prev = guards.flat_guards_enabled()
+        guards.set_flat_guards_enabled(True)
+        try:
+            # DictGuardManager cannot be lowered; the tree walk must still
+            # produce the right answers.
+            self.assertTrue(root.check(f_locals))
+            self.assertFalse(root.check({"d": {"b": 1}}))
+        finally:
+            guards.set_flat_guards_enabled(prev)
+
 
 if __name__ == "__main__":
     from torch._dynamo.test_case import run_tests
@@ -4436,7 +4436,6 @@ class TestVmapOperatorsOpInfo(TestCase):
                 xfail("masked_scatter"),
                 xfail("masked_select"),
                 xfail("nanquantile"),
-                xfail("ormqr"),
                 xfail("put"),
                 xfail("quantile"),
                 xfail("renorm"),
@@ -4510,7 +4509,6 @@ class TestVmapOperatorsOpInfo(TestCase):
                 xfail("nn.functional.max_unpool1d", ""),
                 xfail("nn.functional.soft_margin_loss", ""),
                 xfail("nn.functional.max_unpool3d", ""),
-                xfail("linalg.ldl_solve", "", device_type="cpu"),
                 xfail("chalf", ""),
                 xfail("clamp_max", ""),
                 xfail("jiterator_binary_return_by_ref", device_type="cuda"),
@@ -4538,7 +4536,6 @@ class TestVmapOperatorsOpInfo(TestCase):
                 xfail("as_strided_scatter", ""),
                 xfail("equal", ""),
                 xfail("linalg.lu", ""),
-                skip("linalg.ldl_solve", ""),
                 skip("_softmax_backward_data"),
                 # One or more of the overload doesn't have a Batch rule.
                 xfail("bincount"),
@@ -5155,7 +5152,6 @@ class TestVmapOperatorsOpInfo(TestCase):
             # but it passes locally
             xfail("linalg.diagonal"),
             skip("linalg.matrix_norm", ""),
-            skip("linalg.ldl_solve", ""),
         },
     )
     def test_vmap_linalg_failure_1D_input(self, device, dtype, op):
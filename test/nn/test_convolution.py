@@ -3664,6 +3664,86 @@ class TestConvolutionNNDeviceType(NNTestCase):
                     weight_format=weight_format,
                 )
 
+    @onlyCPU
+    @dtypes(torch.float, torch.double)
+    def test_conv_thnn_ndhwc(self, device, dtype):
+        def helper(
+            n,
+            c,
+            d,
+            h,
+            w,
+            out_channels,
+            kernel_size,
+            input_format,
+            weight_format,
+        ):
+            input = torch.randint(
+                -3, 3, (n, c, d, h, w), dtype=dtype, device=device
+            ).to(memory_format=input_format)
+            input.requires_grad_()
+            conv = nn.Conv3d(c, out_channels, kernel_size).to(
+                device="cpu", dtype=dtype, memory_format=weight_format
+            )
+            for p in conv.parameters():
+                p.data = torch.randint_like(p, -3, 3)
+
+            ref_input = input.detach().clone().contiguous().requires_grad_()
+            ref_conv = nn.Conv3d(c, out_channels, kernel_size)
+            # load_state_dict will restore the stride & memory_layout on ref_conv.weight.
+            ref_conv.load_state_dict(conv.state_dict())
+            ref_conv = ref_conv.to(
+                device="cpu", dtype=dtype, memory_format=torch.contiguous_format
+            )
+
+            out = conv(input)
+            ref_out = ref_conv(ref_input)
+
+            grad = torch.randint_like(out, -3, 3)
+            ref_grad = grad.detach().clone().contiguous()
+
+            out.backward(grad)
+            ref_out.backward(ref_grad)
+
+            self.assertTrue(out.is_contiguous(memory_format=torch.channels_last_3d))
+            self.assertTrue(ref_out.is_contiguous())
+            self.assertEqual(out, ref_out, exact_dtype=False)
+            self.assertEqual(conv.weight.grad, ref_conv.weight.grad, exact_dtype=False)
+            self.assertEqual(conv.bias.grad, ref_conv.bias.grad, exact_dtype=False)
+            self.assertEqual(input.grad, ref_input.grad, exact_dtype=False)
+
+        with torch.backends.mkldnn.flags(enabled=False):
+            formats = [
+                [torch.channels_last_3d, torch.channels_last_3d],
+                [torch.channels_last_3d, torch.contiguous_format],
+                [torch.contiguous_format, torch.channels_last_3d],
+            ]
+            for input_format, weight_format in formats:
+                # non-1x1x1 kernel: slow_conv3d normal path (with vol2col)
+                helper(
+                    2,
+                    8,
+                    4,
+                    4,
+                    4,
+                    out_channels=4,
+                    kernel_size=3,
+                    input_format=input_format,
+                    weight_format=weight_format,
+                )
+                # 1x1x1 kernel: slow_conv3d fast path (skip vol2col)
+                helper(
+                    1,
+                    16,
+                    7,
+                    14,
+                    14,
+                    out_channels=8,
+                    kernel_size=1,
+                    input_format=input_format,
+                    weight_format=weight_format,
+                )
+
     @onlyCUDA
     @skipCUDAIfRocmVersionLessThan((4, 3))
     @skipCUDAIfNotMiopenSuggestNHWC
@@ -932,6 +932,11 @@ class TestProfiler(TestCase):
             sort_by="cpu_time_total", row_limit=10
         )
         self.assertIn("Total MFLOPs", profiler_output)
+        # ops with a flop count should also report the bytes they touch
+        flop_events = [e for e in prof.function_events if e.flops]
+        self.assertTrue(len(flop_events) > 0)
+        for e in flop_events:
+            self.assertGreater(e.bytes_accessed, 0)
         if not (kineto_available() and torch.cuda.is_available()):
             return
 
@@ -799,6 +799,21 @@ class TestAutograd(TestCase):
         finally:
             torch._C._set_cached_tensors_enabled(False)
 
+    def test_defer_tensor_decrefs(self):
+        prev = torch._C._set_defer_tensor_decrefs(True)
+        self.assertFalse(prev)
+        try:
+            # Tensors (and views, and autograd state) created and dropped
+            # while deferral is active must survive the batched release.
+            for _ in range(3):
+                x = torch.rand(4, requires_grad=True)
+                y = (x * 2).sum()
+                y.backward()
+                del x, y
+                torch._C._drain_deferred_tensor_decrefs()
+        finally:
+            self.assertTrue(torch._C._set_defer_tensor_decrefs(False))
+
     def test_accumulate_grad(self):
         grad_output = torch.ones(5, 5)
 
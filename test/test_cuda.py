@@ -927,6 +927,46 @@ class TestCuda(TestCase):
         samples = probs.multinomial(1000000, replacement=True)
         self.assertGreater(probs[samples].min().item(), 0)
 
+    def test_topk_softmax_sample(self):
+        torch.cuda.manual_seed(42)
+        logits = torch.randn(64, 512, device="cuda")
+
+        # near-zero temperature and a tiny nucleus both collapse to argmax
+        argmax = logits.argmax(dim=-1)
+        sample = torch.ops.aten._topk_softmax_sample(logits, 50, temperature=1e-6)
+        self.assertEqual(sample, argmax)
+        sample = torch.ops.aten._topk_softmax_sample(logits, 50, top_p=1e-6)
+        self.assertEqual(sample, argmax)
+
+        # samples always come from the row's top-k set
+        k = 8
+        for dtype in (torch.float, torch.half, torch.bfloat16):
+            cast = logits.to(dtype)
+            topk_idx = cast.topk(k, dim=-1).indices
+            sample = torch.ops.aten._topk_softmax_sample(cast, k)
+            self.assertEqual(sample.dtype, torch.long)
+            self.assertTrue((sample.unsqueeze(-1) == topk_idx).any(dim=-1).all())
+
+        # sampling frequencies roughly match the softmax distribution
+        probs = torch.tensor([0.1, 0.2, 0.3, 0.4], device="cuda")
+        rep = probs.log().expand(10000, -1).contiguous()
+        sample = torch.ops.aten._topk_softmax_sample(rep, 4)
+        counts = torch.bincount(sample, minlength=4).float() / sample.numel()
+        self.assertEqual(counts, probs, atol=0.02, rtol=0)
+
+        # explicit generators make the draw reproducible
+        gen = torch.Generator(device="cuda")
+        gen.manual_seed(1234)
+        s1 = torch.ops.aten._topk_softmax_sample(logits, 50, generator=gen)
+        gen.manual_seed(1234)
+        s2 = torch.ops.aten._topk_softmax_sample(logits, 50, generator=gen)
+        self.assertEqual(s1, s2)
+
+        with self.assertRaisesRegex(RuntimeError, "only k <= 1024"):
+            torch.ops.aten._topk_softmax_sample(
+                torch.randn(1, 2048, device="cuda"), 2000
+            )
+
     def _spawn_test_multinomial_invalid_probs_cuda(self, probs):
         import subprocess
 
@@ -1631,6 +1671,35 @@ torch.cuda.synchronize()
 
         self.assertEqual(b.sum().item(), 11000.0)
 
+    @unittest.skipIf(
+        not TEST_CUDA_GRAPH, "CUDA >= 11.0 or ROCM >= 5.3 required for graphs"
+    )
+    def test_graph_segmented_capture_with_eager_island(self):
+        static_x = torch.ones(100, device="cuda")
+        count = torch.zeros(1, device="cuda")
+
+        seg = torch.cuda.segmented_graph()
+        with seg.capture_segment():
+            static_y = static_x * 2
+
+        def island():
+            # data-dependent op that would forbid whole-region capture;
+            # communicates with the captured suffix through a static buffer
+            count.fill_(float(torch.nonzero(static_y > 1).shape[0]))
+
+        seg.run_eager(island)
+
+        with seg.capture_segment():
+            static_z = static_y + count
+
+        static_x.fill_(2.0)
+        seg.replay()
+        torch.cuda.synchronize()
+
+        self.assertEqual(static_y, torch.full((100,), 4.0, device="cuda"))
+        self.assertEqual(count.item(), 100.0)
+        self.assertEqual(static_z, torch.full((100,), 104.0, device="cuda"))
+
     @unittest.skipIf(
         not TEST_CUDA_GRAPH, "CUDA >= 11.0 or ROCM >= 5.3 required for graphs"
     )
@@ -4991,6 +5060,25 @@ class TestGDS(TestCase):
         torch.cuda.gds._gds_deregister_buffer(src1.untyped_storage())
         torch.cuda.gds._gds_deregister_buffer(src2.untyped_storage())
 
+    def test_record_reader_pinned_fallback(self):
+        # Without cuFile the reader must take the pinned bounce-buffer path;
+        # a small buffer_size forces multiple ring iterations per record.
+        sd = {"a": torch.randn(1024), "b": torch.randn(2, 4096)}
+        by_size = {t.numel() * 4: t for t in sd.values()}
+        with TemporaryFileName() as f:
+            torch.save(sd, f)
+            reader = torch.cuda.gds._GdsRecordReader(f, buffer_size=4096)
+            names = [n for n in reader.records() if "/data/" in n]
+            self.assertEqual(len(names), 2)
+            for name in names:
+                storage = reader.load_record(name)
+                self.assertEqual(storage.device.type, "cuda")
+                loaded = torch.empty(0, dtype=torch.float32, device="cuda").set_(
+                    storage
+                )
+                expected = by_size[storage.nbytes()]
+                self.assertEqual(loaded.cpu(), expected.view(-1))
+
 
 @unittest.skipIf(not TEST_CUDA, "CUDA not available, skipping tests")
 class TestCudaAutocast(TestAutocast):
@@ -3099,6 +3099,29 @@ class TestDictDataLoader(TestCase):
             self.assertTrue(sample["a_tensor"].is_pinned(device="cuda"))
             self.assertTrue(sample["another_dict"]["a_number"].is_pinned(device="cuda"))
 
+    @unittest.skipIf(not TEST_CUDA, "CUDA unavailable")
+    def test_pin_memory_batch(self):
+        from torch.utils.data._utils.pin_memory import pin_memory_batch
+
+        batch = {
+            "a_tensor": torch.arange(8, dtype=torch.float64).reshape(2, 4),
+            "nested": [torch.ones(3), torch.zeros(2, 2, dtype=torch.int32)],
+            "a_string": "not a tensor",
+        }
+        pinned = pin_memory_batch(batch)
+        self.assertTrue(pinned["a_tensor"].is_pinned())
+        self.assertTrue(pinned["nested"][0].is_pinned())
+        self.assertTrue(pinned["nested"][1].is_pinned())
+        self.assertEqual(pinned["a_tensor"], batch["a_tensor"])
+        self.assertEqual(pinned["nested"][0], batch["nested"][0])
+        self.assertEqual(pinned["nested"][1], batch["nested"][1])
+        self.assertEqual(pinned["a_string"], "not a tensor")
+        # Already-pinned tensors pass through unchanged
+        repinned = pin_memory_batch(pinned)
+        self.assertEqual(
+            repinned["a_tensor"].data_ptr(), pinned["a_tensor"].data_ptr()
+        )
+
     @unittest.skipIf(not TEST_CUDA, "CUDA unavailable")
     def test_pin_memory_with_only_device(self):
         loader = DataLoader(self.dataset, batch_size=2, pin_memory_device="cuda")
@@ -3502,6 +3525,47 @@ class ConvDataset(Dataset):
         return torch.nn.functional.conv1d(self.x, torch.ones(1, 1, 2))
 
 
+@unittest.skipIf(IS_WINDOWS, "Shared-memory batch cache is not supported on Windows")
+class TestSharedBatchCache(TestCase):
+    def setUp(self):
+        super().setUp()
+        torch._C._shared_batch_cache_set_capacity(64 * 1024 * 1024)
+
+    def tearDown(self):
+        torch._C._shared_batch_cache_clear()
+        torch._C._shared_batch_cache_set_capacity(0)
+        super().tearDown()
+
+    def test_put_get_roundtrip(self):
+        batch = torch.arange(24, dtype=torch.float64).reshape(2, 3, 4)
+        self.assertTrue(torch._C._shared_batch_cache_put("key", batch))
+        cached = torch._C._shared_batch_cache_get("key")
+        self.assertEqual(cached, batch)
+        self.assertEqual(cached.dtype, batch.dtype)
+        # The cached tensor is a view of the shared segment, not a copy
+        other = torch._C._shared_batch_cache_get("key")
+        other.fill_(-1)
+        self.assertEqual(cached, torch.full_like(batch, -1))
+
+    def test_miss_returns_none(self):
+        self.assertIsNone(torch._C._shared_batch_cache_get("no such key"))
+
+    def test_disabled_by_default(self):
+        torch._C._shared_batch_cache_set_capacity(0)
+        self.assertFalse(torch._C._shared_batch_cache_put("key", torch.ones(2)))
+
+    def test_lru_eviction(self):
+        big = torch.ones(1024, 1024)  # 4 MiB
+        torch._C._shared_batch_cache_set_capacity(10 * 1024 * 1024)
+        self.assertTrue(torch._C._shared_batch_cache_put("a", big))
+        self.assertTrue(torch._C._shared_batch_cache_put("b", big))
+        # Touch "a" so that "b" is the eviction candidate
+        self.assertIsNotNone(torch._C._shared_batch_cache_get("a"))
+        self.assertTrue(torch._C._shared_batch_cache_put("c", big))
+        self.assertIsNotNone(torch._C._shared_batch_cache_get("a"))
+        self.assertIsNone(torch._C._shared_batch_cache_get("b"))
+
+
 @unittest.skipIf(IS_WINDOWS, "Needs fork")
 @unittest.skipIf(
     TEST_WITH_ASAN,
@@ -186,6 +186,19 @@ class TestForeach(TestCase):
                         zero_size=True,
                     )
 
+    # `_foreach_zero_` switches to the device-memory metadata mode of
+    # `multi_tensor_apply` once the list no longer fits in one kernel-argument
+    # launch; exercise it with a list well past that threshold, including
+    # zero-size and multi-chunk tensors.
+    @onlyCUDA
+    @dtypes(torch.float32, torch.half)
+    def test_foreach_zero_large_tensor_count(self, device, dtype):
+        sizes = [0, 1, 3, 65537, 300] * 60
+        tensors = [torch.rand(size, device=device, dtype=dtype) for size in sizes]
+        torch._foreach_zero_(tensors)
+        for t in tensors:
+            self.assertEqual(t, torch.zeros_like(t))
+
     @skipIfRocmVersionLessThan((6, 0))
     @ops(
         foreach_unary_op_db
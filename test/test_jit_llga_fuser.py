@@ -608,6 +608,29 @@ class TestFusionPattern(JitLlgaTestCase):
             self.assertGraphContainsExactly(graph, LLGA_FUSION_GROUP, 1)
             self.assertFused(graph, ['aten::' + eltwise])
 
+    @onlyCPU
+    @dtypes(torch.float32, torch.bfloat16)
+    def test_mlp_gelu_tanh_epilogue(self, dtype):
+        class M(nn.Module):
+            def __init__(self, approximate):
+                super().__init__()
+                self.linear1 = nn.Linear(28, 64)
+                self.linear2 = nn.Linear(64, 28)
+                self.gelu = nn.GELU(approximate=approximate)
+                self.dropout = nn.Dropout(0.1)
+
+            def forward(self, x):
+                y = self.linear1(x)
+                y = self.gelu(y)
+                y = self.linear2(y)
+                return x + self.dropout(y)
+
+        for approximate in ['none', 'tanh']:
+            m = M(approximate).eval()
+            x = torch.rand(32, 28, requires_grad=False)
+            _, graph = self.checkTrace(m, [x], dtype)
+            self.assertFused(graph, ['aten::gelu', 'aten::dropout'])
+
     @onlyCPU
     @dtypes(torch.float32, torch.bfloat16)
     def test_conv2d_sum(self, dtype):
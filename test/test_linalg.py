@@ -6460,6 +6460,36 @@ scipy_lobpcg  | {eq_err_scipy:10.2e}  | {eq_err_general_scipy:10.2e}  | {iters2:
         torch._int_mm(a_int8, b_int8, out=c_int32_result)
         self.assertEqual(c_int32_result.float(), torch.mm(a_float, b_float))
 
+    @onlyNativeDeviceTypes
+    @dtypes(torch.float32, torch.float16)
+    @parametrize("k", [16, 64])
+    @parametrize("n", [16, 48])
+    def test__grouped_mm(self, device, dtype, k, n):
+        if self.device_type == 'cuda' and dtype is torch.float16 and not SM80OrLater:
+            self.skipTest("grouped GEMM requires SM80 or later for float16")
+        # uneven group sizes including empty groups
+        group_sizes = torch.tensor([3, 0, 17, 1, 64], dtype=torch.int64)
+        total_m = int(group_sizes.sum())
+        a = torch.randn(total_m, k, device=device, dtype=dtype)
+        b = torch.randn(group_sizes.numel(), k, n, device=device, dtype=dtype)
+        c = torch._grouped_mm(a, b, group_sizes)
+        self.assertEqual(c.shape, torch.Size([total_m, n]))
+        offset = 0
+        for g, m in enumerate(group_sizes.tolist()):
+            self.assertEqual(c[offset:offset + m], torch.mm(a[offset:offset + m], b[g]))
+            offset += m
+
+    @onlyNativeDeviceTypes
+    def test__grouped_mm_errors(self, device):
+        a = torch.randn(8, 16, device=device)
+        b = torch.randn(2, 16, 4, device=device)
+        with self.assertRaisesRegex(RuntimeError, "group_sizes must sum to self.size\\(0\\)"):
+            torch._grouped_mm(a, b, torch.tensor([4, 3], dtype=torch.int64))
+        with self.assertRaisesRegex(RuntimeError, "one entry of group_sizes per group"):
+            torch._grouped_mm(a, b, torch.tensor([4, 2, 2], dtype=torch.int64))
+        with self.assertRaisesRegex(RuntimeError, "1-D int64 CPU tensor"):
+            torch._grouped_mm(a, b, torch.tensor([4, 4], dtype=torch.int32))
+
     @unittest.skipIf(IS_WINDOWS, "Skipped on Windows!")
     @unittest.skipIf(IS_FBCODE and IS_REMOTE_GPU, "cublas runtime error")
     @onlyNativeDeviceTypes
@@ -587,6 +587,38 @@ class TestFP8MatmulCuda(TestCase):
             out_fp8.to(torch.float32), torch.full((M, N), K * (fill_value**2), device=device)
         )
 
+    @unittest.skipIf(not PLATFORM_SUPPORTS_FP8 or IS_WINDOWS, f8_msg)
+    @skipIfRocm()
+    def test_float8_blockwise_scaling_sanity(self, device) -> None:
+        M, K, N = (256, 512, 384)
+        fill_value = 0.5
+        block_size = 128
+        x = torch.full((M, K), fill_value, device=device)
+        y = torch.full((N, K), fill_value, device=device)
+
+        x_scales = torch.randn(M // block_size, K // block_size, device=device).exp()
+        y_scales = torch.randn(K // block_size, N // block_size, device=device).exp()
+
+        x_fp8 = x.to(torch.float8_e4m3fn)
+        y_fp8 = y.to(torch.float8_e4m3fn).t()
+
+        out_fp8 = torch._scaled_mm(
+            x_fp8,
+            y_fp8,
+            scale_a=x_scales,
+            scale_b=y_scales,
+            out_dtype=torch.bfloat16,
+        )
+        # With constant operands, each output element reduces to
+        # fill_value^2 * block_size * sum_k scale_a[i, k] * scale_b[k, j]
+        # over the tiles covering its row and column.
+        expected = (
+            (x_scales @ y_scales) * (fill_value**2 * block_size)
+        ).repeat_interleave(block_size, 0).repeat_interleave(block_size, 1)
+        torch.testing.assert_close(
+            out_fp8.to(torch.float32), expected, atol=1e-2, rtol=1e-2
+        )
+
     @unittest.skipIf(not PLATFORM_SUPPORTS_FP8 or IS_WINDOWS, f8_msg)
     @skipIfRocm()
     def test_float8_error_messages(self, device) -> None:
@@ -602,7 +634,9 @@ class TestFP8MatmulCuda(TestCase):
             RuntimeError,
             re.escape(
                 "For RowWise scaling, scale_a should be (1024, 1) and scale_b "
-                "should be (1, 2048). Got scale_a.size()=(1, 1) and scale_b.size()=(1, 2)"
+                "should be (1, 2048). For BlockWise scaling, scale_a should be "
+                "(8, 4) and scale_b should be (4, 16). "
+                "Got scale_a.size()=(1, 1) and scale_b.size()=(1, 2)"
             ),
         ):
             torch._scaled_mm(
@@ -617,7 +651,9 @@ class TestFP8MatmulCuda(TestCase):
             RuntimeError,
             re.escape(
                 " For RowWise scaling, scale_a should be (1024, 1) and scale_b "
-                "should be (1, 2048). Got scale_a.size()=(1024, 1) and scale_b.size()=(1, 2049)"
+                "should be (1, 2048). For BlockWise scaling, scale_a should be "
+                "(8, 4) and scale_b should be (4, 16). "
+                "Got scale_a.size()=(1024, 1) and scale_b.size()=(1, 2049)"
             ),
         ):
             torch._scaled_mm(
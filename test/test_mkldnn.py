@@ -149,6 +149,21 @@ class TestMkldnn(TestCase):
                                "Found self type = Mkldnntorch.FloatTensor and src type = torch.FloatTensor",
                                lambda: mkldnn_x.copy_(x))
 
+    def test_tensor_serialization(self):
+        # prepacked weights round-trip through torch.save/load without being
+        # reordered again; the payload is rebuilt from the serialized oneDNN
+        # descriptor
+        x = torch.randn(8, 4, 3, 3, dtype=torch.float32)
+        packed = torch._C._nn.mkldnn_reorder_conv2d_weight(
+            x.to_mkldnn(), [1, 1], [1, 1], [1, 1], 1)
+        for tensor in [x.to_mkldnn(), packed]:
+            with TemporaryFileName() as fname:
+                torch.save(tensor, fname)
+                loaded = torch.load(fname, weights_only=True)
+            self.assertTrue(loaded.is_mkldnn)
+            self.assertEqual(loaded.size(), tensor.size())
+            self.assertEqual(loaded.to_dense(), tensor.to_dense())
+
     def test_unsupported(self):
         # unsupported types and unsupported types with gpu
         for dtype in [torch.double, torch.uint8, torch.int8,
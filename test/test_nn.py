@@ -7100,6 +7100,55 @@ tensor(..., device='meta', size=(1,), requires_grad=True)""")
         ln = torch.nn.LayerNorm(2, eps=1e-6, elementwise_affine=False)
         self.assertEqual(ln.forward(x), torch.zeros_like(x))
 
+    def test_fused_add_norm(self):
+        # _fused_add_layer_norm / _fused_add_rms_norm fuse the transformer
+        # residual add with the norm and return (out, updated residual stream)
+        for dtype in [torch.float, torch.bfloat16, torch.half]:
+            tol = {} if dtype == torch.float else {"atol": 2e-2, "rtol": 2e-2}
+            for shape, normalized_shape in [((4, 3, 64), (64,)), ((2, 8), (8,)), ((3, 7, 33), (33,))]:
+                x = torch.randn(shape, dtype=dtype)
+                res = torch.randn(shape, dtype=dtype)
+                weight = torch.randn(normalized_shape, dtype=dtype)
+                bias = torch.randn(normalized_shape, dtype=dtype)
+                ref_add = x + res
+                for w, b in ((None, None), (weight, None), (weight, bias)):
+                    out, add_out = torch.ops.aten._fused_add_layer_norm(
+                        x, res, normalized_shape, w, b)
+                    self.assertEqual(add_out, ref_add)
+                    ref = F.layer_norm(ref_add, normalized_shape, w, b)
+                    self.assertEqual(out, ref, **tol)
+                for w in (None, weight):
+                    out, add_out = torch.ops.aten._fused_add_rms_norm(
+                        x, res, normalized_shape, w)
+                    self.assertEqual(add_out, ref_add)
+                    ref = F.rms_norm(ref_add, normalized_shape, w, 1e-5)
+                    self.assertEqual(out, ref, **tol)
+
+    def test_fused_add_norm_out_dtype(self):
+        x = torch.randn(4, 3, 48)
+        res = torch.randn(4, 3, 48)
+        weight = torch.randn(48)
+        bias = torch.randn(48)
+        ref_add = x + res
+        for out_dtype in [torch.bfloat16, torch.half]:
+            out, add_out = torch.ops.aten._fused_add_layer_norm(
+                x, res, (48,), weight, bias, 1e-5, out_dtype=out_dtype)
+            self.assertEqual(out.dtype, out_dtype)
+            self.assertEqual(add_out.dtype, torch.float)
+            self.assertEqual(add_out, ref_add)
+            ref = F.layer_norm(ref_add, (48,), weight, bias).to(out_dtype)
+            self.assertEqual(out, ref, atol=2e-2, rtol=2e-2)
+            out, add_out = torch.ops.aten._fused_add_rms_norm(
+                x, res, (48,), weight, 1e-5, out_dtype=out_dtype)
+            self.assertEqual(out.dtype, out_dtype)
+            ref = F.rms_norm(ref_add, (48,), weight, 1e-5).to(out_dtype)
+            self.assertEqual(out, ref, atol=2e-2, rtol=2e-2)
+        # only downcasting float outputs is supported
+        with self.assertRaisesRegex(RuntimeError, "out_dtype"):
+            torch.ops.aten._fused_add_layer_norm(
+                x.bfloat16(), res.bfloat16(), (48,), None, None, 1e-5,
+                out_dtype=torch.half)
+
     def test_padding_list(self):
         # Padding can be a list, or tuple (regression test for gh-54452)
         x = torch.randn(4, 8, 32, 32)
@@ -9713,6 +9762,32 @@ class TestNNDeviceType(NNTestCase):
         t_out = F.interpolate(t_in, size=(2, 2), mode="bilinear", align_corners=False, antialias=True)
         self.assertEqual(expected_out.expand([*shape[:2], 2, 2]), t_out)
 
+    @parametrize_test("memory_format", [torch.contiguous_format, torch.channels_last])
+    @parametrize_test("output_channels_last", [False, True])
+    def test_resize_normalize(self, device, memory_format, output_channels_last):
+        # Check the fused resize + normalize (+ permute) op against the
+        # composed reference transform
+        if torch.device(device).type != "cpu":
+            raise SkipTest("_resize_normalize is CPU-only")
+
+        mean = [0.485, 0.456, 0.406]
+        std = [0.229, 0.224, 0.225]
+        input_ui8 = torch.randint(0, 256, size=(2, 3, 64, 48), dtype=torch.uint8, device=device)
+        input_ui8 = input_ui8.contiguous(memory_format=memory_format)
+
+        out = torch._C._nn._resize_normalize(
+            input_ui8, (32, 32), False, mean, std, output_channels_last=output_channels_last)
+
+        resized = F.interpolate(
+            input_ui8.contiguous(memory_format=torch.channels_last),
+            size=(32, 32), mode="bilinear", align_corners=False, antialias=True)
+        expected = (resized.float() / 255 - torch.tensor(mean).view(1, 3, 1, 1)) / torch.tensor(std).view(1, 3, 1, 1)
+
+        self.assertEqual(out.dtype, torch.float32)
+        expected_format = torch.channels_last if output_channels_last else torch.contiguous_format
+        self.assertTrue(out.is_contiguous(memory_format=expected_format))
+        self.assertEqual(out, expected)
+
     # Partially passes. NotImplementedError: aten::upsample_bicubic2d.out https://github.com/pytorch/pytorch/issues/77764
     @skipIfMps
     @parametrize_test("memory_format", [torch.contiguous_format, torch.channels_last])
@@ -10172,6 +10247,51 @@ class TestNNDeviceType(NNTestCase):
         pt_res = self._slow_masked_softmax(input, mask)
         self.assertEqual(pt_res, native_res, exact_dtype=True)
 
+    @onlyCUDA
+    def test_scaled_bias_masked_softmax(self, device):
+        # Cover both the persistent kernel (L <= 1024) and the fallback (L > 1024)
+        sizes = [(1, 1, 32), (3, 16, 310), (12, 4, 1024), (4, 2, 1200)]
+        scale = 0.125
+        for (B, num_heads, L) in sizes:
+            input = torch.randn((B, num_heads, L, L), device=device)
+            # One bias per head, broadcast over the batch
+            bias = torch.randn((1, num_heads, L, L), device=device)
+            bool_mask = torch.randint(0, 2, (B, num_heads, L, L), device=device).bool()
+            additive_mask = torch.randn((B, num_heads, L, L), device=device)
+            for mask in [None, bool_mask, additive_mask]:
+                native_res = torch._scaled_bias_masked_softmax(input, bias, mask, scale)
+                scores = input * scale + bias
+                if mask is bool_mask:
+                    scores = scores.masked_fill(mask, float('-inf'))
+                elif mask is additive_mask:
+                    scores = scores + mask
+                pt_res = torch.softmax(scores, -1)
+                self.assertEqual(pt_res, native_res, exact_dtype=True)
+
+    @onlyCUDA
+    def test_scaled_bias_masked_softmax_grad(self, device):
+        B, num_heads, L = 3, 4, 64
+        scale = 0.25
+        input = torch.randn((B, num_heads, L, L), device=device, requires_grad=True)
+        bias = torch.randn((1, num_heads, L, L), device=device, requires_grad=True)
+        mask = torch.randint(0, 2, (B, num_heads, L, L), device=device).bool()
+        # Keep at least one unmasked element per row so the reference has no
+        # fully masked (nan producing) rows
+        mask[..., 0] = False
+        input_ref = input.detach().clone().requires_grad_()
+        bias_ref = bias.detach().clone().requires_grad_()
+
+        result = torch._scaled_bias_masked_softmax(input, bias, mask, scale)
+        expected = torch.softmax(
+            (input_ref * scale + bias_ref).masked_fill(mask, float('-inf')), -1)
+        self.assertEqual(result, expected)
+
+        grad = torch.randn_like(expected)
+        result.backward(grad)
+        expected.backward(grad)
+        self.assertEqual(input.grad, torch.nan_to_num(input_ref.grad))
+        self.assertEqual(bias.grad, torch.nan_to_num(bias_ref.grad))
+
     @onlyCPU
     @dtypes(torch.bfloat16, torch.half)
     def test_log_softmax_cpu(self, device, dtype):
@@ -1029,6 +1029,59 @@ class TestOptimRenewed(TestCase):
             self.skipTest("MPS supports only torch.float16 and torch.float32")
         self._test_derived_optimizers(device, dtype, optim_info, "fused")
 
+    @onlyCPU
+    @parametrize("fused_op_name", ["_fused_adam_", "_fused_adamw_"])
+    @parametrize("amsgrad", [False, True])
+    @parametrize("dtype", [torch.bfloat16, torch.float16])
+    def test_fused_adam_fp32_state_matches_fp32(
+        self, device, fused_op_name, amsgrad, dtype
+    ):
+        # Reduced-precision params may be paired with fp32 optimizer state on
+        # CPU; the fused kernel then keeps the moment math in fp32 instead of
+        # round-tripping the state through the params' dtype. Verify against
+        # the all-fp32 fused kernel run on upcast copies.
+        fused_op = getattr(torch, fused_op_name)
+        torch.manual_seed(5)
+        num = 33  # not a multiple of the vector length, to cover the tail
+        param = torch.randn(num, dtype=dtype, device=device)
+        grad = torch.randn(num, dtype=dtype, device=device)
+        exp_avg = torch.randn(num, dtype=torch.float32, device=device).abs()
+        exp_avg_sq = torch.randn(num, dtype=torch.float32, device=device).abs()
+        max_exp_avg_sq = exp_avg_sq.clone() if amsgrad else None
+        state_step = torch.tensor(3.0, device=device)
+
+        ref_param = param.float()
+        ref_grad = grad.float()
+        ref_exp_avg = exp_avg.clone()
+        ref_exp_avg_sq = exp_avg_sq.clone()
+        ref_max_exp_avg_sq = max_exp_avg_sq.clone() if amsgrad else None
+
+        for p, g, m, v, mx in (
+            (param, grad, exp_avg, exp_avg_sq, max_exp_avg_sq),
+            (ref_param, ref_grad, ref_exp_avg, ref_exp_avg_sq, ref_max_exp_avg_sq),
+        ):
+            fused_op(
+                (p,),
+                (g,),
+                (m,),
+                (v,),
+                (mx,) if amsgrad else (),
+                (state_step,),
+                lr=2e-3,
+                beta1=0.9,
+                beta2=0.99,
+                weight_decay=0.01,
+                eps=1e-8,
+                amsgrad=amsgrad,
+                maximize=False,
+            )
+
+        self.assertEqual(exp_avg, ref_exp_avg)
+        self.assertEqual(exp_avg_sq, ref_exp_avg_sq)
+        if amsgrad:
+            self.assertEqual(max_exp_avg_sq, ref_max_exp_avg_sq)
+        self.assertEqual(param, ref_param.to(dtype))
+
     @optims(
         [optim for optim in optim_db if "fused" in optim.supported_impls],
         dtypes=(torch.float32,),
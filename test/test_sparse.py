@@ -366,6 +366,36 @@ class TestSparse(TestSparseBase):
             t, _, _ = self._gen_sparse(len(sparse_size), nnz, sparse_size + dense_size, dtype, device, coalesced)
             _test_coalesce(t)  # this tests correctness
 
+    @dtypes(torch.double)
+    def test_coalesce_cache_reuse(self, device, dtype):
+        i = torch.tensor([[0, 1, 1], [2, 0, 2]], device=device)
+        v = torch.tensor([3, 4, 5], dtype=dtype, device=device)
+        x = torch.sparse_coo_tensor(i, v, (2, 3), device=device)
+
+        # Repeated coalesce of an unmodified tensor returns the cached result
+        y1 = x.coalesce()
+        y2 = x.coalesce()
+        self.assertEqual(y1._values().data_ptr(), y2._values().data_ptr())
+
+        # In-place modification of the input invalidates the cache
+        x.mul_(2)
+        y3 = x.coalesce()
+        self.assertNotEqual(y1._values().data_ptr(), y3._values().data_ptr())
+        self.assertEqual(y3._values(), y1._values() * 2)
+
+        # In-place modification of the cached result invalidates it as well
+        y3.mul_(2)
+        y4 = x.coalesce()
+        self.assertNotEqual(y3._values().data_ptr(), y4._values().data_ptr())
+        self.assertEqual(y4.to_dense(), x.to_dense())
+
+        # The cache is bypassed when grad is required, so that every
+        # differentiable coalesce records its own autograd node
+        xg = x.detach().clone().requires_grad_()
+        z1 = xg.coalesce()
+        z2 = xg.coalesce()
+        self.assertIsNot(z1.grad_fn, z2.grad_fn)
+
     @dtypes(torch.double)
     @skipIfTorchDynamo("https://github.com/pytorch/pytorch/issues/89395")
     def test_coalesce_reference_cycle(self, device, dtype):
@@ -1067,6 +1097,27 @@ class TestSparse(TestSparseBase):
         test_shape(2, 20, [3, 17, 19, 5])
         test_shape(2, 20, [3, 17, 19, 0])
 
+    @coalescedonoff
+    @dtypes(torch.double, torch.cdouble)
+    def test_add_same_pattern(self, device, dtype, coalesced):
+        # adding sparse tensors that share an index set must not grow nnz and
+        # must stay equal to the dense result, in and out of place
+        def test_shape(sparse_dims, nnz, sizes):
+            x, _, _ = self._gen_sparse(sparse_dims, nnz, sizes, dtype, device, coalesced)
+            y = torch.sparse_coo_tensor(
+                x._indices(), torch.randn_like(x._values()), x.shape
+            )._coalesced_(x.is_coalesced())
+            expected = x.to_dense() + 2 * y.to_dense()
+            self.assertEqual((x + 2 * y).to_dense(), expected)
+            z = x.clone()
+            z.add_(y, alpha=2)
+            self.assertEqual(z._nnz(), x._nnz())
+            self.assertEqual(z.to_dense(), expected)
+
+        test_shape(1, 20, [30])
+        test_shape(2, 20, [3, 17, 19, 5])
+        test_shape(2, 0, [3, 17, 19, 5])
+
     @dtypes(torch.double, torch.cdouble)
     def test_add_sub_nnz(self, device, dtype):
         # nnz should not grow unbounded (gh-34964)
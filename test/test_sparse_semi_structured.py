@@ -30,6 +30,7 @@ from torch.testing._internal.common_device_type import (
 from torch.testing._internal.common_dtype import all_types_and_complex
 import torch._dynamo.test_case
 from torch.testing._internal.common_utils import (
+    instantiate_parametrized_tests,
     parametrize,
     run_tests,
     subtest,
@@ -1190,6 +1191,46 @@ class TestSparseSemiStructuredCUSPARSELT(TestCase):
         else:
             assert torch.backends.cusparselt.version() is None
 
+class TestSparseSemiStructuredCPU(TestCase):
+    """
+    Tests for the native CPU 2:4 kernels. The CPU metadata layout is
+    backend-specific, so packed tensors are always produced by
+    torch._to_sparse_semi_structured on the same device.
+    """
+
+    @parametrize("dtype", [torch.float32, torch.float16, torch.bfloat16])
+    def test_sparse_semi_structured_mm_cpu(self, dtype):
+        A = rand_sparse_semi_structured_mask(64, 64, dtype=dtype, device="cpu")
+        B = torch.randn(64, 48, dtype=dtype, device="cpu")
+
+        A_packed, A_meta = torch._to_sparse_semi_structured(A)
+        sparse_result = torch._sparse_semi_structured_mm(A_packed, A_meta, B)
+        dense_result = torch.mm(A.to(torch.float32), B.to(torch.float32)).to(dtype)
+
+        torch.testing.assert_close(sparse_result, dense_result, rtol=1e-2, atol=1e-2)
+
+    @parametrize("dtype", [torch.float32, torch.float16, torch.bfloat16])
+    def test_sparse_semi_structured_addmm_cpu(self, dtype):
+        A = rand_sparse_semi_structured_mask(64, 64, dtype=dtype, device="cpu")
+        B = torch.randn(64, 48, dtype=dtype, device="cpu")
+        bias = torch.randn(64, dtype=dtype, device="cpu")
+
+        A_packed, A_meta = torch._to_sparse_semi_structured(A)
+        sparse_result = torch._sparse_semi_structured_addmm(bias, A_packed, A_meta, B)
+        dense_result = torch.mm(A.to(torch.float32), B.to(torch.float32))
+        dense_result += bias.to(torch.float32).unsqueeze(-1)
+        dense_result = dense_result.to(dtype)
+
+        torch.testing.assert_close(sparse_result, dense_result, rtol=1e-2, atol=1e-2)
+
+    def test_to_sparse_semi_structured_cpu_invalid_pattern(self):
+        A = torch.ones(32, 32, dtype=torch.float32, device="cpu")
+        with self.assertRaisesRegex(RuntimeError, "does not match 2:4 sparsity pattern"):
+            torch._to_sparse_semi_structured(A)
+
+
+instantiate_parametrized_tests(TestSparseSemiStructuredCPU)
+
 if len(SEMI_STRUCTURED_SUPPORTED_BACKENDS) > 0:
     instantiate_device_type_tests(TestSparseSemiStructured, globals(), only_for="cuda")
 if "cutlass" in SEMI_STRUCTURED_SUPPORTED_BACKENDS:
@@ -634,6 +634,30 @@ class TestTensorCreation(TestCase):
                 self.assertEqual(c.grad, expected_c_grad)
                 self.assertEqual(d.grad, expected_d_grad)
 
+    @onlyCPU
+    @dtypes(torch.float, torch.bfloat16)
+    def test_cat_parallel_fast_path(self, device, dtype):
+        # Results larger than the internal grain size take the multi-threaded
+        # contiguous fast path; mix many small inputs, a few large ones and
+        # zero-sized chunks so thread partitions cross input boundaries.
+        for dim in (0, 1):
+            inputs = []
+            for i in range(300):
+                size = [3, 5]
+                size[dim] = (i % 7) + 1
+                inputs.append(torch.randn(size, device=device, dtype=dtype))
+            size = [3, 5]
+            size[dim] = 50000
+            inputs.append(torch.randn(size, device=device, dtype=dtype))
+            size[dim] = 0
+            inputs.append(torch.empty(size, device=device, dtype=dtype))
+            result = torch.cat(inputs, dim=dim)
+            offset = 0
+            for t in inputs:
+                self.assertEqual(
+                    result.narrow(dim, offset, t.size(dim)), t, atol=0, rtol=0)
+                offset += t.size(dim)
+
     def test_cat_out_channels_last(self, device):
         x = torch.randn((4, 3, 8, 8))
         y = torch.randn(x.shape)
@@ -4037,6 +4037,21 @@ else:
         a_masked = a.masked_select(mask_copy_3_times)
         self.assertEqual(a_masked, a.unsqueeze(0).expand(3, 100).flatten())
 
+    # FIXME: find a test suite for the masked select operator
+    @dtypes(torch.float, torch.double, torch.bfloat16, torch.long, torch.bool)
+    def test_masked_select_large_contiguous(self, device, dtype):
+        # Large contiguous inputs take the multi-threaded two-phase kernel on
+        # CPU; compare against boolean indexing and cover empty/full masks.
+        numel = 100_000
+        src = make_tensor((numel,), dtype=dtype, device=device)
+        for p in (0.0, 0.5, 1.0):
+            mask = torch.rand(numel, device=device) < p
+            expected = src[mask]
+            self.assertEqual(src.masked_select(mask), expected, atol=0, rtol=0)
+            out = torch.empty(0, dtype=dtype, device=device)
+            torch.masked_select(src, mask, out=out)
+            self.assertEqual(out, expected, atol=0, rtol=0)
+
     # FIXME: find a test suite for the masked select operator
     def test_masked_select_discontiguous(self, device):
         for size in (10, 200):
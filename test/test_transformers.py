@@ -2118,6 +2118,38 @@ class TestSDPACpuOnly(NNTestCase):
                 self.assertEqual(grad_k_actual, grad_k_ref, atol=tol.atol, rtol=tol.rtol)
                 self.assertEqual(grad_v_actual, grad_v_ref, atol=tol.atol, rtol=tol.rtol)
 
+    @parametrize("dtype", [torch.float32, torch.bfloat16])
+    @parametrize("q_seq_len", [1, 37])
+    @parametrize("is_causal", [True, False])
+    @parametrize("set_attn_mask", [True, False])
+    def test_scaled_dot_product_fused_attention_split_kv_vs_math_cpu(
+        self, device, dtype, q_seq_len, is_causal, set_attn_mask
+    ):
+        # Small batch x head x query-block with long KV exercises the
+        # split-kv decomposition of the CPU flash attention kernel
+        tol = Tolerances(1e-5, 5e-6)
+        if dtype is torch.bfloat16:
+            tol = Tolerances(5e-2, 5e-2)
+        batch_size, n_head, kv_seq_len, head_dim = 1, 2, 2051, 64
+        make_tensor = partial(rand_sdpa_tensor, type="dense", device=device, dtype=dtype, packed=False)
+        q = make_tensor(SdpaShape(batch_size, n_head, q_seq_len, head_dim))
+        k = make_tensor(SdpaShape(batch_size, n_head, kv_seq_len, head_dim))
+        v = make_tensor(SdpaShape(batch_size, n_head, kv_seq_len, head_dim))
+        attn_mask = None
+        if set_attn_mask and not is_causal:
+            attn_mask = torch.randn(q_seq_len, kv_seq_len, dtype=dtype, device=device)
+        q2, k2, v2 = q.float(), k.float(), v.float()
+
+        with sdpa_kernel(backends=[SDPBackend.FLASH_ATTENTION]):
+            actual = torch.nn.functional.scaled_dot_product_attention(
+                q, k, v, attn_mask=attn_mask, dropout_p=0.0, is_causal=is_causal)
+        with sdpa_kernel(backends=[SDPBackend.MATH]):
+            math_ref = torch.nn.functional.scaled_dot_product_attention(
+                q2, k2, v2, attn_mask=attn_mask.float() if attn_mask is not None else None,
+                dropout_p=0.0, is_causal=is_causal)
+
+        self.assertEqual(actual, math_ref.to(dtype), atol=tol.atol, rtol=tol.rtol)
+
     def test_sdpa_with_inf(self, device):
         # https://github.com/pytorch/pytorch/issues/127055.
         full = torch.full((600, 600), float("-inf"), device=device)
@@ -2550,6 +2582,82 @@ class TestSDPACudaOnly(NNTestCase):
             out = F.scaled_dot_product_attention(query, key, value, mask)
         out.sum().backward()
 
+    @unittest.skipIf(not PLATFORM_SUPPORTS_FLASH_ATTENTION, "Does not support flash attention")
+    @skipIfRocm(msg='enable_gqa=True unsupported')
+    @parametrize("dtype", [torch.float16, torch.bfloat16])
+    @parametrize("n_heads_kv", [4, 32])
+    def test_flash_attention_decode_split_kv(self, device, dtype, n_heads_kv):
+        # Single-token decode over a long KV cache: batch * n_heads thread
+        # blocks alone underutilize the SMs, so the flash kernel is expected
+        # to take the split-KV path (split across blocks with a second-stage
+        # reduction, sharing KV loads across the query heads of a GQA group).
+        make_tensor = partial(torch.rand, device=device, dtype=dtype)
+        batch, n_heads, head_dim = 1, 32, 128
+        seq_len_kv = 16384
+        query = make_tensor(SdpaShape(batch, n_heads, 1, head_dim))
+        kv_shape = SdpaShape(batch, n_heads_kv, seq_len_kv, head_dim)
+        key, value = make_tensor(kv_shape), make_tensor(kv_shape)
+
+        self.assertEqual(
+            torch._fused_sdp_choice(query, key, value, enable_gqa=n_heads_kv != n_heads),
+            SDPBackend.FLASH_ATTENTION.value)
+        with sdpa_kernel(backends=[SDPBackend.FLASH_ATTENTION]):
+            actual = F.scaled_dot_product_attention(
+                query, key, value, enable_gqa=n_heads_kv != n_heads)
+        with sdpa_kernel(backends=[SDPBackend.MATH]):
+            math_ref = F.scaled_dot_product_attention(
+                query.float(), key.float(), value.float(), enable_gqa=n_heads_kv != n_heads)
+
+        self.assertEqual(actual.float(), math_ref, atol=2e-3, rtol=2e-3)
+
+    @parametrize("cache_dtype", [torch.int8, torch.float8_e4m3fn])
+    def test_rope_and_cache_quant_roundtrip(self, device, cache_dtype):
+        batch, n_heads, head_dim = 2, 4, 64
+        cache_len, chunk = 128, 16
+        dtype = torch.float16
+        qmax = 127.0 if cache_dtype == torch.int8 else 448.0
+
+        k_cache = torch.zeros(batch, n_heads, cache_len, head_dim, device=device, dtype=cache_dtype)
+        v_cache = torch.zeros_like(k_cache)
+        k_scales = torch.zeros(batch, n_heads, cache_len, device=device)
+        v_scales = torch.zeros_like(k_scales)
+
+        inv_freq = 1.0 / (10000 ** (torch.arange(0, head_dim // 2, device=device) / (head_dim // 2)))
+        ref_k = torch.zeros(batch, n_heads, cache_len, head_dim, device=device)
+        ref_v = torch.zeros_like(ref_k)
+        for pos in range(0, cache_len, chunk):
+            key = torch.randn(batch, n_heads, chunk, head_dim, device=device, dtype=dtype)
+            value = torch.randn_like(key)
+            angles = torch.arange(pos, pos + chunk, device=device).unsqueeze(-1) * inv_freq
+            cos, sin = angles.cos().to(dtype), angles.sin().to(dtype)
+            torch.ops.aten._rope_and_cache_quant_(
+                key, value, cos, sin, k_cache, v_cache, k_scales, v_scales, pos)
+
+            # rotate-half reference
+            k1, k2 = key.float().chunk(2, dim=-1)
+            rotated = torch.cat(
+                [k1 * cos.float() - k2 * sin.float(), k2 * cos.float() + k1 * sin.float()], dim=-1)
+            ref_k[:, :, pos:pos + chunk] = rotated
+            ref_v[:, :, pos:pos + chunk] = value.float()
+
+        key_out, value_out = torch.ops.aten._dequantize_cached_kv(
+            k_cache, v_cache, k_scales, v_scales, cache_len, dtype)
+        self.assertEqual(key_out.shape, ref_k.shape)
+        if cache_dtype == torch.int8:
+            # int8 rounding error is bounded by half a step, i.e. absmax / 254
+            k_tol = (ref_k.abs().amax(-1).max() / qmax).item() + 2e-3
+            v_tol = (ref_v.abs().amax(-1).max() / qmax).item() + 2e-3
+        else:
+            # float8_e4m3 has 3 mantissa bits, so roughly 2^-4 relative error
+            k_tol = (ref_k.abs().max() * 2 ** -3).item() + 2e-3
+            v_tol = (ref_v.abs().max() * 2 ** -3).item() + 2e-3
+        self.assertEqual(key_out.float(), ref_k, atol=k_tol, rtol=0)
+        self.assertEqual(value_out.float(), ref_v, atol=v_tol, rtol=0)
+
+        # Scales are absmax / qmax per (batch, head, position) row
+        self.assertEqual(
+            v_scales, ref_v.abs().amax(-1) / qmax, atol=1e-2, rtol=1e-2)
+
     @unittest.skipIf(not PLATFORM_SUPPORTS_MEM_EFF_ATTENTION, "Fused SDPA was not built for this system")
     def test_mem_eff_attention_non_contig_mask_bug(self, device):
         # Without the fix this produces `AssertionError: assert 0.07352933287620544 < 1e-07`
@@ -3571,6 +3679,95 @@ class TestSDPACudaOnly(NNTestCase):
 
         self.assertEqual(actual.contiguous(), math_ref.contiguous(), atol=1e-3, rtol=1e-2)
 
+    @skipIfRocm  # Nested tensor
+    @unittest.skipIf(not PLATFORM_SUPPORTS_MEM_EFF_ATTENTION, "Fused SDPA was not built for this system")
+    @parametrize("broadcast_mask", [True, False])
+    def test_mem_efficient_attention_nested_with_attn_mask(self, device, broadcast_mask):
+        rand_nested_tensor = partial(rand_sdpa_tensor, type="nested", device=device, dtype=torch.float32)
+        batch, num_heads, head_dim = 8, 8, 64
+        seq_lens_q = torch.randint(low=2, high=32, size=(batch,)).tolist()
+        seq_lens_kv = torch.randint(low=2, high=32, size=(batch,)).tolist()
+        max_seq_len_q = max(seq_lens_q)
+        # Deliberately unaligned last dim to exercise the mask padding path
+        max_seq_len_kv = max(max(seq_lens_kv), 30)
+        seq_lens_kv[0] = max_seq_len_kv
+
+        query = rand_nested_tensor(SdpaShape(batch, num_heads, seq_lens_q, head_dim)).transpose(1, 2)
+        key = rand_nested_tensor(SdpaShape(batch, num_heads, seq_lens_kv, head_dim)).transpose(1, 2)
+        value = rand_nested_tensor(SdpaShape(batch, num_heads, seq_lens_kv, head_dim)).transpose(1, 2)
+
+        mask_shape = ((batch, 1, 1, max_seq_len_kv)
+                      if broadcast_mask
+                      else (batch, num_heads, max_seq_len_q, max_seq_len_kv))
+        attn_mask = torch.randn(mask_shape, device=device, dtype=torch.float32)
+
+        with sdpa_kernel(backends=[SDPBackend.EFFICIENT_ATTENTION]):
+            actual = torch.nn.functional.scaled_dot_product_attention(
+                query, key, value, attn_mask=attn_mask, dropout_p=0.0, is_causal=False)
+
+        # The math fallback cannot consume a mask with nested inputs, so
+        # compare each batch entry against a dense call with the mask sliced
+        # to that entry's sequence lengths.
+        for i, (actual_i, q_i, k_i, v_i) in enumerate(
+                zip(actual.unbind(), query.unbind(), key.unbind(), value.unbind())):
+            mask_i = attn_mask[i:i + 1, :, :, :seq_lens_kv[i]]
+            if not broadcast_mask:
+                mask_i = mask_i[:, :, :seq_lens_q[i], :]
+            with sdpa_kernel(backends=[SDPBackend.MATH]):
+                math_ref_i = torch.nn.functional.scaled_dot_product_attention(
+                    q_i.unsqueeze(0).contiguous(), k_i.unsqueeze(0).contiguous(),
+                    v_i.unsqueeze(0).contiguous(),
+                    attn_mask=mask_i, dropout_p=0.0, is_causal=False)
+            self.assertEqual(actual_i.unsqueeze(0), math_ref_i, atol=1.5e-3, rtol=1e-2)
+
+    @skipIfRocm  # Paged KV cache
+    @unittest.skipIf(not PLATFORM_SUPPORTS_FLASH_ATTENTION, "Does not support SDPA or pre-SM80 hardware")
+    @parametrize("is_causal", [True, False])
+    def test_paged_attention_forward_matches_varlen(self, device, is_causal):
+        dtype = torch.float16
+        num_heads, head_dim, page_size = 8, 64, 256
+        seq_lens_q = [47, 256, 300, 1]
+        seq_lens_kv = [256, 512, 300, 1024]
+
+        qs = [torch.rand(n, num_heads, head_dim, device=device, dtype=dtype) for n in seq_lens_q]
+        ks = [torch.rand(n, num_heads, head_dim, device=device, dtype=dtype) for n in seq_lens_kv]
+        vs = [torch.rand(n, num_heads, head_dim, device=device, dtype=dtype) for n in seq_lens_kv]
+
+        def cumulative(lens):
+            return torch.tensor([0] + lens, device=device, dtype=torch.int32).cumsum(0).to(torch.int32)
+
+        cum_seq_q = cumulative(seq_lens_q)
+        cum_seq_kv = cumulative(seq_lens_kv)
+        max_q, max_kv = max(seq_lens_q), max(seq_lens_kv)
+        query = torch.cat(qs)
+
+        # Scatter each sequence's KV into randomly assigned pages of a pool
+        blocks_per_seq = [(n + page_size - 1) // page_size for n in seq_lens_kv]
+        num_blocks = sum(blocks_per_seq)
+        assignment = torch.randperm(num_blocks, device="cpu")
+        key_cache = torch.zeros(num_blocks, page_size, num_heads, head_dim, device=device, dtype=dtype)
+        value_cache = torch.zeros_like(key_cache)
+        block_table = torch.zeros(len(seq_lens_kv), max(blocks_per_seq), device=device, dtype=torch.int32)
+        next_page = 0
+        for i, (k, v) in enumerate(zip(ks, vs)):
+            for b in range(blocks_per_seq[i]):
+                page = assignment[next_page].item()
+                next_page += 1
+                chunk = k[b * page_size:(b + 1) * page_size]
+                key_cache[page, :chunk.size(0)] = chunk
+                value_cache[page, :chunk.size(0)] = v[b * page_size:(b + 1) * page_size]
+                block_table[i, b] = page
+
+        ref = torch.ops.aten._flash_attention_forward(
+            query, torch.cat(ks), torch.cat(vs), cum_seq_q, cum_seq_kv,
+            max_q, max_kv, 0.0, is_causal, False)[0]
+        actual, logsumexp = torch.ops.aten._paged_attention_forward(
+            query, key_cache, value_cache, block_table, cum_seq_q, cum_seq_kv,
+            max_q, max_kv, is_causal)
+
+        self.assertEqual(logsumexp.shape, torch.Size([len(seq_lens_q), num_heads, max_q]))
+        self.assertEqual(actual, ref, atol=1e-3, rtol=1e-3)
+
     @skipIfRocm  # Nested tensor
     @unittest.skipIf(not PLATFORM_SUPPORTS_FLASH_ATTENTION, "Does not support SDPA or pre-SM80 hardware")
     @parametrize("batch_size", [8, 32])
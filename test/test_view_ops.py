@@ -1983,6 +1983,28 @@ class TestOldViewOps(TestCase):
             x.resize_as_(y)
             self.assertEqual(y.shape, x.shape)
 
+    @onlyCPU
+    def test_reserve_(self, device):
+        # Growing within reserved capacity must reuse the allocation.
+        x = torch.empty(0, 4, device=device)
+        x.reserve_(25 * 4)
+        ptr = x.untyped_storage().data_ptr()
+        for n in range(1, 26):
+            x.resize_(n, 4)
+            x[n - 1] = n
+        self.assertEqual(x.untyped_storage().data_ptr(), ptr)
+        expected = torch.arange(1., 26., device=device).unsqueeze(1).expand(25, 4)
+        self.assertEqual(x, expected)
+        # Growth past the reservation reallocates but preserves the data.
+        x.resize_(100, 4)
+        self.assertEqual(x[:25], expected)
+        # Reserving less than the current capacity is a no-op.
+        ptr = x.untyped_storage().data_ptr()
+        x.reserve_(10)
+        self.assertEqual(x.untyped_storage().data_ptr(), ptr)
+        with self.assertRaisesRegex(RuntimeError, "non-negative"):
+            x.reserve_(-1)
+
     @onlyNativeDeviceTypes
     def test_resize_overflow(self, device):
         x = torch.empty((), dtype=torch.float64)
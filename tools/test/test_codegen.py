@@ -12,6 +12,7 @@ from torchgen import dest
 from torchgen.api.types import CppSignatureGroup, DispatcherSignature
 from torchgen.context import native_function_manager
 from torchgen.gen import (
+    ComputeOperators,
     get_native_function_declarations,
     get_native_function_schema_registrations,
     LineLoader,
@@ -28,6 +29,7 @@ from torchgen.model import (
 )
 from torchgen.native_function_generation import add_generated_native_functions
 from torchgen.selective_build.selector import SelectiveBuilder
+from torchgen.utils import Target
 
 
 class TestCreateDerivative(unittest.TestCase):
@@ -497,6 +499,39 @@ class TestStaticDispatchGeneratrion(unittest.TestCase):
             out, "return at::compositeexplicitautograd::op_out(out, self);"
         )
 
+    def test_selected_op_keeps_static_dispatch_with_stub_selector(self) -> None:
+        selector = SelectiveBuilder.from_legacy_op_registration_allow_list(
+            {"aten::op"}, False, False
+        )
+        with native_function_manager(self.one_return_func):
+            out = ComputeOperators(
+                Target.DEFINITION,
+                static_dispatch_backend_indices=self.indices,
+                selector=selector,
+            )(self.one_return_func)
+        self.assertIn("return at::compositeexplicitautograd::op_out(out, self);", out)
+        self.assertNotIn("was excluded from this build", out)
+
+    def test_unselected_op_generates_error_stub(self) -> None:
+        selector = SelectiveBuilder.from_legacy_op_registration_allow_list(
+            {"aten::some_other_op"}, False, False
+        )
+        with native_function_manager(self.one_return_func):
+            out = ComputeOperators(
+                Target.DEFINITION,
+                static_dispatch_backend_indices=self.indices,
+                selector=selector,
+            )(self.one_return_func)
+        self.assertIn(
+            'TORCH_CHECK(false, "op_out was excluded from this build '
+            'by the operator allowlist");',
+            out,
+        )
+        # No typed handle and no kernel call should be emitted, so the
+        # linker can strip the unused kernel body.
+        self.assertNotIn("create_op_out_typed_handle", out)
+        self.assertNotIn("at::compositeexplicitautograd::op_out", out)
+
 
 # Represents the most basic NativeFunction. Use dataclasses.replace()
 # to edit for use.
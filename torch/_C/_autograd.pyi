@@ -73,6 +73,7 @@ class _KinetoEvent:
     def scope(self) -> int: ...
     def sequence_nr(self) -> int: ...
     def flops(self) -> int: ...
+    def bytes_accessed(self) -> int: ...
     def cuda_elapsed_us(self) -> int: ...
     def privateuse1_elapsed_us(self) -> int: ...
     def is_user_annotation(self) -> bool: ...
@@ -19,6 +19,8 @@ _DEFAULT_PG_NCCL_TIMEOUT: timedelta
 class BuiltinCommHookType(Enum):
     ALLREDUCE = ...
     FP16_COMPRESS = ...
+    BF16_COMPRESS = ...
+    INT8_COMPRESS = ...
 
 def _register_comm_hook(reducer: Reducer, state: Any, comm_hook: Any): ...
 def _register_builtin_comm_hook(
@@ -192,6 +194,11 @@ class FileStore(Store):
 class HashStore(Store):
     def __init__(self) -> None: ...
 
+class _ShmStore(Store):
+    def __init__(self, name: str, world_size: int = ...) -> None: ...
+    @property
+    def name(self) -> str: ...
+
 class TCPStore(Store):
     def __init__(
         self,
@@ -204,6 +211,7 @@ class TCPStore(Store):
         multi_tenant: bool = ...,
         master_listen_fd: int | None = ...,
         use_libuv: bool | None = ...,
+        num_shards: int = ...,
     ) -> None: ...
     @property
     def host(self) -> str: ...
@@ -60,6 +60,9 @@ class _ExperimentalConfig:
         verbose: bool = ...,
         performance_events: list[str] = ...,
         enable_cuda_sync_events: bool = ...,
+        adjust_profiler_step: bool = ...,
+        adjust_timestamps: bool = ...,
+        profiler_sample_rate: int = ...,
     ) -> None: ...
 
 class ProfilerConfig:
@@ -501,6 +501,7 @@ def _core_aten_decompositions_post_autograd() -> (
             aten.t,
             aten.t_copy,
             aten.take,
+            aten.tan_backward,
             aten.tanh_backward,
             aten.threshold,
             aten.threshold_,
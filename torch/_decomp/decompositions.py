@@ -109,6 +109,13 @@ def _unsqueeze_to_dim(x: Tensor, dim: int) -> Tensor:
     return x
 
 
+@register_decomposition(aten.tan_backward)
+@out_wrapper("grad_input")
+@pw_cast_for_opmath
+def tan_backward(out_grad: Tensor, y: Tensor):
+    return out_grad * (1 + y * y).conj_physical()
+
+
 @register_decomposition(aten.tanh_backward)
 @out_wrapper("grad_input")
 @pw_cast_for_opmath
@@ -81,6 +81,38 @@ AOTIRuntimeError AOTInductorModelContainerCreateWithDevice(
   })
 }
 
+AOTIRuntimeError AOTInductorModelContainerCreateWithSharedConstants(
+    AOTInductorModelContainerHandle* container_handle,
+    size_t num_models,
+    const char* device_str,
+    const char* cubin_dir,
+    AOTInductorModelContainerHandle shared_constants_handle) {
+  if (num_models == 0) {
+    std::cerr << "Error: num_models must be positive, but got 0" << std::endl;
+    return AOTI_RUNTIME_FAILURE;
+  }
+  if (shared_constants_handle == nullptr) {
+    std::cerr << "Error: shared_constants_handle must not be null" << std::endl;
+    return AOTI_RUNTIME_FAILURE;
+  }
+  CONVERT_EXCEPTION_TO_ERROR_CODE({
+    std::optional<std::string> cubin_dir_opt;
+    if (cubin_dir != nullptr) {
+      cubin_dir_opt.emplace(cubin_dir);
+    }
+    auto* shared_constants_owner =
+        reinterpret_cast<torch::aot_inductor::AOTInductorModelContainer*>(
+            shared_constants_handle);
+    auto* container = new torch::aot_inductor::AOTInductorModelContainer(
+        num_models,
+        std::string(device_str),
+        cubin_dir_opt,
+        shared_constants_owner);
+    *container_handle =
+        reinterpret_cast<AOTInductorModelContainerHandle>(container);
+  })
+}
+
 AOTIRuntimeError AOTInductorModelContainerDelete(
     AOTInductorModelContainerHandle container_handle) {
   CONVERT_EXCEPTION_TO_ERROR_CODE({
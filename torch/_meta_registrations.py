@@ -3239,6 +3239,24 @@ def meta__int_mm(a, b):
     return a.new_empty((a.size(0), b.size(1)), dtype=torch.int32)
 
 
+@register_meta([aten._grouped_mm])
+def meta__grouped_mm(a, b, group_sizes):
+    torch._check(a.dim() == 2, lambda: "self must be a 2D tensor")
+    torch._check(b.dim() == 3, lambda: "mat2 must be a 3D tensor")
+    torch._check(
+        a.size(1) == b.size(1),
+        lambda: (
+            f"Incompatible matrix sizes for _grouped_mm ({a.size(0)}x{a.size(1)} "
+            f"and {b.size(0)}x{b.size(1)}x{b.size(2)})"
+        ),
+    )
+    torch._check(
+        group_sizes.dim() == 1 and group_sizes.size(0) == b.size(0),
+        lambda: "group_sizes must be 1D with one entry per group of mat2",
+    )
+    return a.new_empty((a.size(0), b.size(2)))
+
+
 @register_meta([aten._convert_weight_to_int4pack])
 def meta__convert_weight_to_int4pack(w, inner_k_tiles):
     torch._check(w.dim() == 2, lambda: "w must be a 2D tensor")
@@ -5355,6 +5373,38 @@ def meta__flash_attention_forward(
     )
 
 
+@register_meta(
+    [
+        aten._paged_attention_forward,
+    ]
+)
+def meta__paged_attention_forward(
+    query: Tensor,
+    key_cache: Tensor,
+    value_cache: Tensor,
+    block_table: Tensor,
+    cum_seq_q: Tensor,
+    cum_seq_k: Tensor,
+    max_q: int,
+    max_k: int,
+    is_causal: bool = False,
+    scale: Optional[float] = None,
+    seqused_k: Optional[Tensor] = None,
+):
+    # Varseqlen path only: query is (total_q, num_heads, head_dim) and the
+    # KV cache is a pool of pages indexed through block_table
+    batch_size = cum_seq_q.numel() - 1
+    num_heads = query.size(-2)
+
+    attention = torch.empty_like(query)
+    logsumexp = torch.empty(
+        (batch_size, num_heads, max_q),
+        dtype=torch.float,
+        device=query.device,
+    )
+    return attention, logsumexp
+
+
 @register_meta(
     [
         aten._flash_attention_backward,
@@ -5569,6 +5619,10 @@ def meta_scaled_mm(
                 lambda: f"For non-tensorwise scaling, scale tensors must be 2D, but got {scale_a.dim()=} and {scale_b.dim()=}",
             )
 
+            block_size = 128
+            blocks_m = (m + block_size - 1) // block_size
+            blocks_k = (k + block_size - 1) // block_size
+            blocks_n = (n + block_size - 1) // block_size
             if (
                 scale_a.size(0) == m
                 and scale_a.size(1) == 1
@@ -5580,6 +5634,17 @@ def meta_scaled_mm(
                     scale_a.is_contiguous() and scale_b.is_contiguous(),
                     lambda: "Both scale_a and scale_b must be contiguous for rowwise scaling.",
                 )
+            elif (
+                scale_a.size(0) == blocks_m
+                and scale_a.size(1) == blocks_k
+                and scale_b.size(0) == blocks_k
+                and scale_b.size(1) == blocks_n
+            ):
+                # blockwise scaling, one scale per 128x128 tile of each operand
+                torch._check(
+                    scale_a.is_contiguous() and scale_b.is_contiguous(),
+                    lambda: "Both scale_a and scale_b must be contiguous for blockwise scaling.",
+                )
             else:
                 # does not match any valid scaling type
                 torch._check(
@@ -5588,6 +5653,8 @@ def meta_scaled_mm(
                         "Invalid scaling configuration. "
                         "For tensorwise scaling, both scales should be scalar. "
                         f"For rowwise scaling, scale_a should be ({m}, 1), scale_b should be (1, {n}). "
+                        f"For blockwise scaling, scale_a should be ({blocks_m}, {blocks_k}), "
+                        f"scale_b should be ({blocks_k}, {blocks_n}). "
                         f"Got scale_a.size()=({scale_a.size(0)}, {scale_a.size(1)}) "
                         f"and scale_b.size()=({scale_b.size(0)}, {scale_b.size(1)})"
                     ),
@@ -5624,6 +5691,19 @@ def meta_multinomial(input, num_samples, replacement=False, *, generator=None):
     )
 
 
+@register_meta(aten._topk_softmax_sample.default)
+def meta__topk_softmax_sample(logits, k, temperature=1.0, top_p=None, *, generator=None):
+    torch._check(
+        logits.dim() == 2,
+        lambda: f"_topk_softmax_sample: expected 2-D logits, got {logits.dim()}-D",
+    )
+    torch._check(
+        0 < k <= logits.size(1),
+        lambda: f"_topk_softmax_sample: expected 0 < k <= {logits.size(1)}, got {k}",
+    )
+    return logits.new_empty((logits.size(0),), dtype=torch.long)
+
+
 def multiply_integers(vs):
     r = 1
     for v in vs:
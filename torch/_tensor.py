@@ -440,6 +440,26 @@ class Tensor(torch._C.TensorBase):
                 ),
             )
             return (torch._utils._rebuild_sparse_tensor, args_sparse_compressed)
+        elif self.layout == torch._mkldnn:
+            if skip_data:
+                raise RuntimeError(
+                    "Cannot serialize mkldnn tensor under skip_data context manager, file an issue if you need this feature"
+                )
+            # Prepacked oneDNN weights are serialized as their serialized
+            # memory descriptor plus the raw blocked payload, so loading
+            # rebuilds the packed tensor directly instead of repacking.
+            # The payload is only meaningful for the CPU ISA that produced
+            # it, so the capability is recorded and validated on load.
+            args_mkldnn = (
+                1,  # serialization format version
+                str(torch.backends.cpu.get_cpu_capability()),
+                torch.ops.mkldnn._get_mkldnn_serialized_md(self),
+                torch.ops.mkldnn._get_packed_weight_data(self),
+                self.dtype,
+                tuple(self.size()),
+                self.requires_grad,
+            )
+            return (torch._utils._rebuild_mkldnn_tensor, args_mkldnn)
         elif self.is_nested:
             if skip_data:
                 raise RuntimeError(
@@ -4230,6 +4230,32 @@ Example::
 """,
 )
 
+add_docstr_all(
+    "reserve_",
+    r"""
+reserve_(numel) -> Tensor
+
+Reserves storage capacity for at least :attr:`numel` elements without
+changing the size of :attr:`self`. Subsequent calls to
+:meth:`~Tensor.resize_` that stay within the reserved capacity reuse the
+existing allocation, and growth beyond it reallocates geometrically, so
+building a result tensor by repeatedly appending rows runs in amortized
+linear time. Only supported on CPU tensors.
+
+Args:
+    numel (int): the number of elements to reserve capacity for
+
+Example::
+
+    >>> x = torch.empty(0)
+    >>> x.reserve_(100)
+    >>> ptr = x.untyped_storage().data_ptr()
+    >>> x.resize_(100)  # grows within the reservation, no reallocation
+    >>> x.untyped_storage().data_ptr() == ptr
+    True
+""",
+)
+
 add_docstr_all(
     "reshape",
     r"""
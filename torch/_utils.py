@@ -326,6 +326,37 @@ def _rebuild_sparse_tensor(layout, data):
     raise NotImplementedError(f"rebuilding sparse tensor for layout {layout}")
 
 
+def _rebuild_mkldnn_tensor(
+    version, cpu_capability, serialized_md, data, dtype, size, requires_grad
+):
+    """
+    Rebuilds a prepacked mkldnn tensor from its serialized oneDNN memory
+    descriptor and raw blocked payload without running the weight reorder
+    again. The payload is only meaningful for the CPU ISA that produced it,
+    so the recorded capability must match the loading machine.
+    """
+    if version != 1:
+        raise RuntimeError(
+            f"Unsupported mkldnn tensor serialization format version {version}"
+        )
+    current_capability = str(torch.backends.cpu.get_cpu_capability())
+    if cpu_capability != current_capability:
+        raise RuntimeError(
+            f"Cannot load a prepacked mkldnn tensor packed for CPU capability "
+            f"'{cpu_capability}' on a machine reporting '{current_capability}'. "
+            "Re-export the checkpoint from dense weights on this machine, or "
+            "convert the weights with Tensor.to_dense() before saving."
+        )
+    t = torch.ops.mkldnn._rebuild_packed_weight(data, serialized_md, dtype)
+    if tuple(t.size()) != tuple(size):
+        raise RuntimeError(
+            f"Prepacked mkldnn tensor was saved with size {tuple(size)} but "
+            f"deserialized to {tuple(t.size())}"
+        )
+    t.requires_grad_(requires_grad)
+    return t
+
+
 def _rebuild_nested_tensor(buffer, sizes, strides, storage_offsets):
     return torch._nested_view_from_buffer(buffer, sizes, strides, storage_offsets)
 
@@ -143,6 +143,7 @@ def _tensor_rebuild_functions():
         torch._utils._rebuild_tensor_v2,
         torch._utils._rebuild_tensor_v3,
         torch._utils._rebuild_sparse_tensor,
+        torch._utils._rebuild_mkldnn_tensor,
         torch._utils._rebuild_meta_tensor_no_storage,
         torch._utils._rebuild_nested_tensor,
         torch._utils._rebuild_wrapper_subclass,
@@ -466,6 +466,7 @@ class FunctionEvent(FormattedTimesMixin):
         device_resource_id=None,
         is_legacy=False,
         flops=None,
+        bytes_accessed=None,
         trace_name=None,
         concrete_inputs=None,
         kwinputs=None,
@@ -500,6 +501,7 @@ class FunctionEvent(FormattedTimesMixin):
         )
         self.is_legacy: bool = is_legacy
         self.flops: Optional[int] = flops
+        self.bytes_accessed: Optional[int] = bytes_accessed
         self.is_user_annotation: Optional[bool] = is_user_annotation
         self.self_cpu_percent = -1
         self.total_cpu_percent = -1
@@ -670,6 +672,7 @@ class FunctionEventAvg(FormattedTimesMixin):
         self.device_type: DeviceType = DeviceType.CPU
         self.is_legacy: bool = False
         self.flops: int = 0
+        self.bytes_accessed: int = 0
 
     def add(self, other):
         if self.key is None:
@@ -705,6 +708,10 @@ class FunctionEventAvg(FormattedTimesMixin):
             self.flops = other.flops
         elif other.flops is not None:
             self.flops += other.flops
+        if self.bytes_accessed is None:
+            self.bytes_accessed = other.bytes_accessed
+        elif other.bytes_accessed is not None:
+            self.bytes_accessed += other.bytes_accessed
         return self
 
     def __iadd__(self, other):
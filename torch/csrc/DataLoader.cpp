@@ -13,17 +13,26 @@
 
 #ifndef _WIN32
 
+#include <ATen/ATen.h>
+#include <ATen/MapAllocator.h>
 #include <torch/csrc/Exceptions.h>
+#include <torch/csrc/autograd/python_variable.h>
+#include <torch/csrc/utils/pybind.h>
 #include <torch/csrc/utils/python_numbers.h>
+#include <torch/csrc/utils/python_strings.h>
 
 #include <c10/util/irange.h>
 #include <fmt/format.h>
 
 #include <sys/wait.h>
 #include <csignal>
+#include <cstring>
+#include <list>
 #include <map>
+#include <mutex>
 #include <set>
 #include <sstream>
+#include <unordered_map>
 
 using namespace torch;
 
@@ -217,6 +226,266 @@ static PyObject* THPModule_removeWorkerPIDs(
   END_HANDLE_TH_ERRORS
 }
 
+// NOTE [ Shared-memory batch cache ]
+//
+// A process-wide cache of collated batches living in POSIX shared memory,
+// keyed by a caller-supplied content fingerprint (e.g. a hash of the sample
+// indices making up a validation batch). Workers publish a batch once; any
+// process that knows the key — typically the main process — maps the segment
+// zero-copy instead of re-decoding and re-collating the same data every
+// epoch.
+//
+// Segments are named deterministically from the key so that publisher and
+// consumer only need to agree on the key. They are created through
+// at::RefcountedMapAllocator, whose in-segment refcount makes lifetime safe
+// across processes: the publisher holds one reference until the entry is
+// evicted from its LRU, consumers add one per mapping, and the segment is
+// unlinked when the last reference is dropped. The cache is disabled until a
+// capacity is set with _shared_batch_cache_set_capacity.
+
+namespace {
+
+// Segment layout: an int64_t header [scalar type, ndim, sizes...] followed
+// by the tensor bytes at the next 64-byte boundary, so that the data is
+// suitably aligned for any dtype.
+constexpr size_t kBatchCacheDataAlignment = 64;
+
+size_t batchCacheDataOffset(int64_t ndim) {
+  size_t header = sizeof(int64_t) * (2 + static_cast<size_t>(ndim));
+  return (header + kBatchCacheDataAlignment - 1) / kBatchCacheDataAlignment *
+      kBatchCacheDataAlignment;
+}
+
+// FNV-1a. The segment name must be derivable from the key alone in every
+// process, so std::hash (implementation-defined) cannot be used here.
+std::string batchCacheSegmentName(const std::string& key) {
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (const char c : key) {
+    hash ^= static_cast<uint8_t>(c);
+    hash *= 0x100000001b3ull;
+  }
+  return fmt::format("/torch_batch_cache_{:016x}", hash);
+}
+
+struct BatchCacheEntry {
+  // Keeps one reference on the segment until the entry is evicted.
+  at::DataPtr data;
+  size_t nbytes{0};
+  std::list<std::string>::iterator lru_it;
+};
+
+struct BatchCache {
+  std::mutex mutex;
+  // Keys in LRU order, most recently used first.
+  std::list<std::string> lru;
+  std::unordered_map<std::string, BatchCacheEntry> entries;
+  size_t capacity_bytes = 0; // 0 disables the cache
+  size_t total_bytes = 0;
+};
+
+BatchCache& batchCache() {
+  static auto* cache = new BatchCache();
+  return *cache;
+}
+
+void batchCacheEvictLocked(BatchCache& cache) {
+  while (cache.total_bytes > cache.capacity_bytes && !cache.lru.empty()) {
+    auto it = cache.entries.find(cache.lru.back());
+    // Dropping the DataPtr decrefs the segment; it is unlinked once the last
+    // consumer closes its mapping.
+    cache.total_bytes -= it->second.nbytes;
+    cache.entries.erase(it);
+    cache.lru.pop_back();
+  }
+}
+
+} // namespace
+
+static PyObject* THPModule_sharedBatchCachePut(
+    PyObject* module,
+    PyObject* args) {
+  HANDLE_TH_ERRORS
+  PyObject* py_key = nullptr;
+  PyObject* py_tensor = nullptr;
+  if (!PyArg_ParseTuple(args, "OO", &py_key, &py_tensor)) {
+    return nullptr;
+  }
+  TORCH_CHECK_TYPE(
+      THPUtils_checkString(py_key),
+      "_shared_batch_cache_put expects a string key, but got ",
+      Py_TYPE(py_key)->tp_name);
+  TORCH_CHECK_TYPE(
+      THPVariable_Check(py_tensor),
+      "_shared_batch_cache_put expects a tensor, but got ",
+      Py_TYPE(py_tensor)->tp_name);
+  std::string key = THPUtils_unpackString(py_key);
+  const auto& tensor = THPVariable_Unpack(py_tensor);
+  TORCH_CHECK(
+      tensor.device().is_cpu() && tensor.layout() == at::kStrided,
+      "_shared_batch_cache_put: only dense CPU tensors can be cached");
+
+  auto& cache = batchCache();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    if (cache.capacity_bytes == 0) {
+      Py_RETURN_FALSE;
+    }
+    auto it = cache.entries.find(key);
+    if (it != cache.entries.end()) {
+      cache.lru.splice(cache.lru.begin(), cache.lru, it->second.lru_it);
+      Py_RETURN_TRUE;
+    }
+  }
+
+  auto contig = tensor.contiguous();
+  const size_t data_offset = batchCacheDataOffset(contig.dim());
+  const size_t nbytes = data_offset + contig.nbytes();
+  std::string name = batchCacheSegmentName(key);
+  at::DataPtr data;
+  try {
+    int flags =
+        at::ALLOCATOR_MAPPED_SHAREDMEM | at::ALLOCATOR_MAPPED_EXCLUSIVE;
+    data = at::RefcountedMapAllocator::makeDataPtr(
+        name.c_str(), flags, nbytes, /*actual_size_out=*/nullptr);
+  } catch (const c10::Error&) {
+    // The common cause is that another worker published this key first; if
+    // the segment is there, the consumer side will find it either way.
+    try {
+      int flags =
+          at::ALLOCATOR_MAPPED_SHAREDMEM | at::ALLOCATOR_MAPPED_NOCREATE;
+      at::RefcountedMapAllocator::makeDataPtr(
+          name.c_str(), flags, /*size=*/0, /*actual_size_out=*/nullptr);
+      Py_RETURN_TRUE;
+    } catch (const c10::Error&) {
+      Py_RETURN_FALSE;
+    }
+  }
+
+  auto* header = static_cast<int64_t*>(data.get());
+  header[0] = static_cast<int64_t>(contig.scalar_type());
+  header[1] = contig.dim();
+  for (const auto i : c10::irange(contig.dim())) {
+    header[2 + i] = contig.size(i);
+  }
+  {
+    // Copying into shared memory can be slow, so release the GIL
+    pybind11::gil_scoped_release no_gil;
+    memcpy(
+        static_cast<char*>(data.get()) + data_offset,
+        contig.const_data_ptr(),
+        contig.nbytes());
+  }
+
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.lru.push_front(key);
+  auto& entry = cache.entries[key];
+  entry.data = std::move(data);
+  entry.nbytes = nbytes;
+  entry.lru_it = cache.lru.begin();
+  cache.total_bytes += nbytes;
+  batchCacheEvictLocked(cache);
+  Py_RETURN_TRUE;
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject* THPModule_sharedBatchCacheGet(
+    PyObject* module,
+    PyObject* py_key) {
+  HANDLE_TH_ERRORS
+  TORCH_CHECK_TYPE(
+      THPUtils_checkString(py_key),
+      "_shared_batch_cache_get expects a string key, but got ",
+      Py_TYPE(py_key)->tp_name);
+  std::string key = THPUtils_unpackString(py_key);
+  std::string name = batchCacheSegmentName(key);
+
+  at::DataPtr data;
+  size_t nbytes = 0;
+  try {
+    int flags =
+        at::ALLOCATOR_MAPPED_SHAREDMEM | at::ALLOCATOR_MAPPED_NOCREATE;
+    data = at::RefcountedMapAllocator::makeDataPtr(
+        name.c_str(), flags, /*size=*/0, &nbytes);
+  } catch (const c10::Error&) {
+    // cache miss
+    Py_RETURN_NONE;
+  }
+
+  const auto* header = static_cast<const int64_t*>(data.get());
+  TORCH_CHECK(
+      nbytes >= 2 * sizeof(int64_t) && header[0] >= 0 &&
+          header[0] < static_cast<int64_t>(at::ScalarType::NumOptions) &&
+          header[1] >= 0,
+      "corrupt shared batch cache segment for key '",
+      key,
+      "'");
+  const auto type = static_cast<at::ScalarType>(header[0]);
+  const int64_t ndim = header[1];
+  std::vector<int64_t> sizes(header + 2, header + 2 + ndim);
+  const size_t data_offset = batchCacheDataOffset(ndim);
+  const size_t itemsize = c10::elementSize(type);
+  size_t numel = 1;
+  for (const auto size : sizes) {
+    numel *= static_cast<size_t>(size);
+  }
+  TORCH_CHECK(
+      data_offset + numel * itemsize <= nbytes,
+      "corrupt shared batch cache segment for key '",
+      key,
+      "'");
+
+  at::Storage storage(
+      c10::Storage::use_byte_size_t(),
+      nbytes,
+      std::move(data),
+      /*allocator=*/nullptr,
+      /*resizable=*/false);
+  auto tensor = at::empty({0}, at::CPU(type).options())
+                    .set_(
+                        storage,
+                        static_cast<int64_t>(data_offset / itemsize),
+                        sizes,
+                        /*strides=*/{});
+
+  // Refresh the LRU position if this process is also the publisher.
+  auto& cache = batchCache();
+  {
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto it = cache.entries.find(key);
+    if (it != cache.entries.end()) {
+      cache.lru.splice(cache.lru.begin(), cache.lru, it->second.lru_it);
+    }
+  }
+  return THPVariable_Wrap(std::move(tensor));
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject* THPModule_sharedBatchCacheSetCapacity(
+    PyObject* module,
+    PyObject* arg) {
+  HANDLE_TH_ERRORS
+  const size_t capacity = THPUtils_unpackUInt64(arg);
+  auto& cache = batchCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.capacity_bytes = capacity;
+  batchCacheEvictLocked(cache);
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
+static PyObject* THPModule_sharedBatchCacheClear(
+    PyObject* module,
+    PyObject* noargs) {
+  HANDLE_TH_ERRORS
+  auto& cache = batchCache();
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  cache.entries.clear();
+  cache.lru.clear();
+  cache.total_bytes = 0;
+  Py_RETURN_NONE;
+  END_HANDLE_TH_ERRORS
+}
+
 #undef SIGNAL_HANDLER
 
 #else
@@ -244,6 +513,30 @@ static PyObject* THPModule_errorIfAnyWorkerFails(
   Py_RETURN_NONE;
 }
 
+static PyObject* THPModule_sharedBatchCachePut(
+    PyObject* module,
+    PyObject* _ignored) {
+  Py_RETURN_FALSE;
+}
+
+static PyObject* THPModule_sharedBatchCacheGet(
+    PyObject* module,
+    PyObject* _ignored) {
+  Py_RETURN_NONE;
+}
+
+static PyObject* THPModule_sharedBatchCacheSetCapacity(
+    PyObject* module,
+    PyObject* _ignored) {
+  Py_RETURN_NONE;
+}
+
+static PyObject* THPModule_sharedBatchCacheClear(
+    PyObject* module,
+    PyObject* _ignored) {
+  Py_RETURN_NONE;
+}
+
 #endif
 
 // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,cppcoreguidelines-avoid-non-const-global-variables,modernize-avoid-c-arrays)
@@ -258,4 +551,17 @@ PyMethodDef DataLoaderMethods[] = {
      THPModule_errorIfAnyWorkerFails,
      METH_NOARGS,
      nullptr},
+    {"_shared_batch_cache_put",
+     THPModule_sharedBatchCachePut,
+     METH_VARARGS,
+     nullptr},
+    {"_shared_batch_cache_get", THPModule_sharedBatchCacheGet, METH_O, nullptr},
+    {"_shared_batch_cache_set_capacity",
+     THPModule_sharedBatchCacheSetCapacity,
+     METH_O,
+     nullptr},
+    {"_shared_batch_cache_clear",
+     THPModule_sharedBatchCacheClear,
+     METH_NOARGS,
+     nullptr},
     {nullptr, nullptr, 0, nullptr}};
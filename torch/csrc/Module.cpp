@@ -1847,6 +1847,14 @@ Call this whenever a new thread is created in order to propagate values from
     return at::caching::is_cached_tensor(t);
   });
 
+  py_module.def("_set_defer_tensor_decrefs", [](bool enabled) {
+    return THPVariable_setDeferTensorDecrefs(enabled);
+  });
+
+  py_module.def("_drain_deferred_tensor_decrefs", []() {
+    THPVariable_drainDeferredTensorDecrefs();
+  });
+
   ASSERT_TRUE(
       set_module_attr("has_openmp", at::hasOpenMP() ? Py_True : Py_False));
   ASSERT_TRUE(set_module_attr("has_mkl", at::hasMKL() ? Py_True : Py_False));
@@ -2,6 +2,7 @@
 
 #include <torch/data/dataloader_options.h>
 #include <torch/data/detail/data_shuttle.h>
+#include <torch/data/detail/pin_memory.h>
 #include <torch/data/detail/sequencers.h>
 #include <torch/data/iterator.h>
 #include <torch/data/samplers/random.h>
@@ -171,7 +172,12 @@ class DataLoaderBase {
         }
       }
     } else if (auto batch_request = get_batch_request()) {
-      return this->main_thread_dataset_->get_batch(std::move(*batch_request));
+      auto batch =
+          this->main_thread_dataset_->get_batch(std::move(*batch_request));
+      if (options_.pin_memory) {
+        batch = detail::pin_memory(std::move(batch));
+      }
+      return batch;
     }
     return nullopt;
   }
@@ -185,6 +191,12 @@ class DataLoaderBase {
       }
       try {
         auto batch = dataset.get_batch(std::move(*job.batch_request));
+        // Stage the batch in pinned host memory while still on the worker
+        // thread, so the main thread receives batches that are ready for
+        // asynchronous copies to the device.
+        if (options_.pin_memory) {
+          batch = detail::pin_memory(std::move(batch));
+        }
         shuttle_.push_result({std::move(batch), job.sequence_number});
       } catch (...) {
         shuttle_.push_result({std::current_exception(), job.sequence_number});
@@ -36,6 +36,14 @@ struct DataLoaderOptions {
   /// Whether to omit the last batch if it contains less than `batch_size`
   /// examples.
   TORCH_ARG(bool, drop_last) = false;
+
+  /// Whether worker threads should stage fetched batches in pinned
+  /// (page-locked) host memory before handing them to the main thread.
+  /// Pinned batches can be copied to an accelerator asynchronously
+  /// (`non_blocking=true`), which keeps the device busy between batches.
+  /// Requires an accelerator-enabled build. The prefetch depth is
+  /// controlled by `max_jobs`.
+  TORCH_ARG(bool, pin_memory) = false;
 };
 
 /// Like `DataLoaderOptions`, but without any unconfigured state.
@@ -51,7 +59,8 @@ struct FullDataLoaderOptions {
         max_jobs(options.max_jobs().value_or(2 * workers)),
         timeout(options.timeout()),
         enforce_ordering(options.enforce_ordering()),
-        drop_last(options.drop_last()) {}
+        drop_last(options.drop_last()),
+        pin_memory(options.pin_memory()) {}
 
   size_t batch_size;
   size_t workers;
@@ -59,5 +68,6 @@ struct FullDataLoaderOptions {
   std::optional<std::chrono::milliseconds> timeout;
   bool enforce_ordering;
   bool drop_last;
+  bool pin_memory;
 };
 } // namespace torch::data
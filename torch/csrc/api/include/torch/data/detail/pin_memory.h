@@ -0,0 +1,68 @@
+#pragma once
+
+#include <torch/data/example.h>
+#include <torch/types.h>
+
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace torch::data::detail {
+
+/// Recursively copies the tensors in a batch into pinned (page-locked) host
+/// memory, so that subsequent host-to-device copies can run asynchronously
+/// on a CUDA stream.
+///
+/// Pinned buffers come from the caching host allocator of the accelerator
+/// backend, which recycles them across batches instead of page-locking fresh
+/// memory per call, and which defers reuse of a buffer until all streams
+/// that touched it have caught up. Tensors that are already pinned (for
+/// example because the dataset staged them in pinned memory itself) and
+/// non-CPU tensors are passed through untouched, as are batch components
+/// that contain no tensors at all.
+///
+/// Requires an accelerator-enabled build; pinning throws otherwise.
+inline at::Tensor pin_memory(at::Tensor tensor) {
+  if (tensor.defined() && tensor.device().is_cpu() && !tensor.is_pinned()) {
+    return tensor.pin_memory();
+  }
+  return tensor;
+}
+
+template <typename Data, typename Target>
+Example<Data, Target> pin_memory(Example<Data, Target> example) {
+  return {
+      pin_memory(std::move(example.data)),
+      pin_memory(std::move(example.target))};
+}
+
+template <typename Data>
+Example<Data, example::NoTarget> pin_memory(
+    Example<Data, example::NoTarget> example) {
+  return {pin_memory(std::move(example.data))};
+}
+
+template <typename T>
+std::vector<T> pin_memory(std::vector<T> batch) {
+  for (auto& example : batch) {
+    example = pin_memory(std::move(example));
+  }
+  return batch;
+}
+
+template <typename T>
+std::optional<T> pin_memory(std::optional<T> batch) {
+  if (batch.has_value()) {
+    *batch = pin_memory(std::move(*batch));
+  }
+  return batch;
+}
+
+/// Fallback for batch types without tensor components (e.g. plain index
+/// batches); such batches are returned unchanged.
+template <typename Batch>
+Batch pin_memory(Batch batch) {
+  return batch;
+}
+
+} // namespace torch::data::detail
@@ -0,0 +1,128 @@
+#pragma once
+
+#include <torch/nn/utils/convert_parameters.h>
+#include <torch/types.h>
+
+#include <c10/util/irange.h>
+
+#include <utility>
+#include <vector>
+
+namespace torch::nn::utils {
+
+/// Flattens a set of parameters into one contiguous buffer and rebinds each
+/// parameter to a view of that buffer, the way DistributedDataParallel
+/// organizes gradients into flat buckets.
+///
+/// After construction, the module computes with views into `flat()`, so an
+/// optimizer that updates the single flat tensor updates every parameter in
+/// one fused kernel launch instead of one launch per parameter; no scatter
+/// back into the module is needed. Gradients still accumulate per parameter
+/// during backward, so they are gathered into a flat gradient buffer with
+/// `sync_grad()` before the optimizer step:
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   FlatParameter flat(model->parameters());
+///   torch::optim::Adam adam({flat.flat()}, torch::optim::AdamOptions(1e-3));
+///   for (auto& batch : data_loader) {
+///     model->zero_grad();
+///     auto loss = model->forward(batch.data).mse_loss(batch.target);
+///     loss.backward();
+///     flat.sync_grad();
+///     adam.step();
+///   }
+/// \endrst
+///
+/// All parameters must share one dtype and device; parameters on multiple
+/// devices are not supported, matching `parameters_to_vector`.
+class FlatParameter {
+ public:
+  explicit FlatParameter(std::vector<Tensor> parameters)
+      : params_(std::move(parameters)) {
+    TORCH_CHECK(
+        !params_.empty(), "FlatParameter requires at least one parameter");
+    std::optional<int64_t> param_device;
+    int64_t total_numel = 0;
+    for (const Tensor& param : params_) {
+      param_device = _check_param_device(param, param_device);
+      TORCH_CHECK(
+          param.dtype() == params_.front().dtype(),
+          "Found two parameters with different dtypes (",
+          param.dtype(),
+          " and ",
+          params_.front().dtype(),
+          "), this is currently not supported.");
+      total_numel += param.numel();
+    }
+
+    NoGradGuard no_grad;
+    flat_ = torch::empty({total_numel}, params_.front().options());
+    flat_grad_ = torch::zeros_like(flat_);
+    offsets_.reserve(params_.size());
+    int64_t offset = 0;
+    for (Tensor& param : params_) {
+      const auto numel = param.numel();
+      auto slice = flat_.slice(0, offset, offset + numel);
+      slice.view_as(param).copy_(param);
+      // Rebind the parameter as a view into the flat buffer. The parameter
+      // keeps its autograd leaf semantics but now shares storage with
+      // `flat_`, so updates to the flat buffer are visible to the module.
+      param.set_data(slice.view_as(param));
+      offsets_.push_back(offset);
+      offset += numel;
+    }
+    // Hand the flat gradient buffer to the flat tensor up front, so
+    // optimizers see a defined gradient once `sync_grad()` has run.
+    flat_.mutable_grad() = flat_grad_;
+  }
+
+  /// The contiguous buffer holding all parameters. Pass this single tensor
+  /// to an optimizer in place of the per-parameter list.
+  const Tensor& flat() const noexcept {
+    return flat_;
+  }
+
+  /// The parameters, each a view into `flat()`, in construction order.
+  const std::vector<Tensor>& views() const noexcept {
+    return params_;
+  }
+
+  /// Gathers each parameter's accumulated gradient into the flat gradient
+  /// buffer. Call after `backward()` and before the optimizer step.
+  /// Parameters with undefined gradients contribute zeros.
+  void sync_grad() {
+    NoGradGuard no_grad;
+    // Optimizers may reset the flat tensor's gradient to undefined
+    // (zero_grad with set_to_none), so re-establish the binding.
+    if (!flat_.grad().defined()) {
+      flat_.mutable_grad() = flat_grad_;
+    }
+    for (const auto i : c10::irange(params_.size())) {
+      const Tensor& param = params_[i];
+      auto slice =
+          flat_grad_.slice(0, offsets_[i], offsets_[i] + param.numel());
+      const Tensor& grad = param.grad();
+      if (grad.defined()) {
+        slice.view_as(param).copy_(grad);
+      } else {
+        slice.zero_();
+      }
+    }
+  }
+
+  /// Zeroes the flat gradient buffer.
+  void zero_grad() {
+    NoGradGuard no_grad;
+    flat_grad_.zero_();
+  }
+
+ private:
+  std::vector<Tensor> params_;
+  std::vector<int64_t> offsets_;
+  Tensor flat_;
+  Tensor flat_grad_;
+};
+
+} // namespace torch::nn::utils
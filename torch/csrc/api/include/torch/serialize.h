@@ -3,6 +3,7 @@
 #include <c10/util/irange.h>
 #include <torch/csrc/Export.h>
 #include <torch/serialize/archive.h>
+#include <torch/serialize/snapshot.h>
 #include <torch/serialize/tensor.h>
 
 #include <utility>
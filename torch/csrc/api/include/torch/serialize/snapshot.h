@@ -0,0 +1,70 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+#include <torch/types.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace torch {
+namespace serialize {
+
+/// A handle to an asynchronous checkpoint snapshot started with
+/// `snapshot_async`. Destroying the handle blocks until the background write
+/// has finished; call `wait` to also observe any error it encountered.
+class TORCH_API AsyncSnapshot {
+ public:
+  AsyncSnapshot(const AsyncSnapshot&) = delete;
+  AsyncSnapshot& operator=(const AsyncSnapshot&) = delete;
+  AsyncSnapshot(AsyncSnapshot&&) noexcept = default;
+  AsyncSnapshot& operator=(AsyncSnapshot&&) noexcept = default;
+  ~AsyncSnapshot();
+
+  /// Blocks until the background write has finished and rethrows any error
+  /// it encountered.
+  void wait();
+
+  /// Returns true once the background write has finished (successfully or
+  /// not), without blocking.
+  bool done() const;
+
+ private:
+  AsyncSnapshot(std::vector<Tensor> frozen, std::string filename);
+
+  struct State;
+  std::shared_ptr<State> state_;
+
+  friend TORCH_API AsyncSnapshot snapshot_async(
+      const std::vector<Tensor>& tensors,
+      std::string filename);
+};
+
+/// Starts an asynchronous snapshot of `tensors` to the file `filename`.
+///
+/// Every tensor is frozen with a copy-on-write clone of its storage, which
+/// takes microseconds and does not copy any data, so control returns to the
+/// caller almost immediately. A background thread then serializes the frozen
+/// clones in the same format as `torch::save(std::vector<torch::Tensor>)`,
+/// so the snapshot can be read back with `torch::load`. In-place writes to
+/// the original tensors after this call materialize a private copy of the
+/// affected storage first and therefore do not leak into the snapshot.
+///
+/// Storages that cannot be converted to copy-on-write (because their DataPtr
+/// carries a custom context, e.g. device caching allocator blocks) are copied
+/// eagerly instead.
+///
+/// \rst
+/// .. code-block:: cpp
+///
+///   auto snapshot = torch::serialize::snapshot_async(
+///       model_parameters, "checkpoint.pt");
+///   // ... keep training while the checkpoint is written ...
+///   snapshot.wait();
+/// \endrst
+TORCH_API AsyncSnapshot snapshot_async(
+    const std::vector<Tensor>& tensors,
+    std::string filename);
+
+} // namespace serialize
+} // namespace torch
@@ -0,0 +1,85 @@
+#include <torch/serialize/snapshot.h>
+
+#include <torch/serialize.h>
+#include <torch/types.h>
+
+#include <c10/core/impl/cow/COW.h>
+
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace torch::serialize {
+
+struct AsyncSnapshot::State {
+  std::thread thread;
+  std::atomic<bool> done{false};
+  std::exception_ptr error;
+};
+
+namespace {
+
+Tensor freeze(const Tensor& tensor) {
+  auto detached = tensor.detach();
+  if (c10::impl::cow::has_simple_data_ptr(
+          *detached.storage().unsafeGetStorageImpl())) {
+    return at::_lazy_clone(detached);
+  }
+  // Storages whose DataPtr carries a custom context (e.g. blocks handed out
+  // by the device caching allocators) cannot be converted to copy-on-write;
+  // fall back to an eager copy for those.
+  return detached.clone();
+}
+
+} // namespace
+
+AsyncSnapshot::AsyncSnapshot(std::vector<Tensor> frozen, std::string filename)
+    : state_(std::make_shared<State>()) {
+  auto state = state_;
+  state_->thread = std::thread([frozen = std::move(frozen),
+                                filename = std::move(filename),
+                                state = std::move(state)]() mutable {
+    try {
+      torch::save(frozen, filename);
+    } catch (...) {
+      state->error = std::current_exception();
+    }
+    // Drop the frozen clones from the worker thread so that any
+    // copy-on-write contexts are released as soon as the write finishes.
+    frozen.clear();
+    state->done = true;
+  });
+}
+
+AsyncSnapshot::~AsyncSnapshot() {
+  if (state_ != nullptr && state_->thread.joinable()) {
+    state_->thread.join();
+  }
+}
+
+void AsyncSnapshot::wait() {
+  if (state_->thread.joinable()) {
+    state_->thread.join();
+  }
+  if (state_->error) {
+    std::rethrow_exception(state_->error);
+  }
+}
+
+bool AsyncSnapshot::done() const {
+  return state_->done.load();
+}
+
+AsyncSnapshot snapshot_async(
+    const std::vector<Tensor>& tensors,
+    std::string filename) {
+  std::vector<Tensor> frozen;
+  frozen.reserve(tensors.size());
+  for (const auto& tensor : tensors) {
+    frozen.push_back(freeze(tensor));
+  }
+  return AsyncSnapshot(std::move(frozen), std::move(filename));
+}
+
+} // namespace torch::serialize
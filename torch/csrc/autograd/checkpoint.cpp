@@ -0,0 +1,178 @@
+#include <torch/csrc/autograd/checkpoint.h>
+
+#include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/grad_mode.h>
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace torch::autograd {
+
+namespace {
+
+using HooksFactory = std::function<std::unique_ptr<SavedVariableHooks>()>;
+
+// Innermost-wins stack of native default hook factories for the current
+// thread. A new SavedVariable asks the innermost factory for its hooks,
+// which is what scopes a checkpointed region to the forward calls made
+// inside it.
+std::vector<HooksFactory>& hooks_factory_stack() {
+  thread_local std::vector<HooksFactory> stack;
+  return stack;
+}
+
+struct NativeHooksGuard {
+  explicit NativeHooksGuard(HooksFactory factory) {
+    hooks_factory_stack().push_back(std::move(factory));
+  }
+
+  NativeHooksGuard(const NativeHooksGuard&) = delete;
+  NativeHooksGuard& operator=(const NativeHooksGuard&) = delete;
+
+  ~NativeHooksGuard() {
+    hooks_factory_stack().pop_back();
+  }
+};
+
+// Shared state of one checkpointed region: what to re-run, and the
+// tensors rematerialized by that re-run, indexed by pack order.
+struct RecomputeContext {
+  CheckpointFunction function;
+  variable_list inputs;
+  CheckpointPolicy policy;
+
+  // Guards the recompute; unpack may be called concurrently from engine
+  // worker threads.
+  std::mutex mutex;
+  bool recomputed = false;
+  std::vector<at::Tensor> rematerialized;
+
+  // Number of pack calls seen by the region's forward; assigns each
+  // dropped activation its index into rematerialized.
+  size_t pack_count = 0;
+};
+
+// Hooks installed during recompute: keep every packed tensor (the inner
+// graph is discarded without running backward) and collect them in pack
+// order so the outer region can look its activations up by index.
+struct CollectSavedVariableHooks : public SavedVariableHooks {
+  explicit CollectSavedVariableHooks(std::shared_ptr<RecomputeContext> ctx)
+      : ctx_(std::move(ctx)) {}
+
+  void call_pack_hook(const at::Tensor& tensor) override {
+    ctx_->rematerialized.push_back(tensor);
+    data_ = tensor;
+  }
+
+  at::Tensor call_unpack_hook() override {
+    return data_;
+  }
+
+ private:
+  std::shared_ptr<RecomputeContext> ctx_;
+  at::Tensor data_;
+};
+
+// Hooks installed during the region's forward. Activations the policy
+// keeps are stored here directly; the rest only remember their pack
+// index and are fetched from the shared context after recompute.
+struct CheckpointSavedVariableHooks : public SavedVariableHooks {
+  explicit CheckpointSavedVariableHooks(std::shared_ptr<RecomputeContext> ctx)
+      : ctx_(std::move(ctx)) {}
+
+  void call_pack_hook(const at::Tensor& tensor) override {
+    index_ = ctx_->pack_count++;
+    if (ctx_->policy.decide(tensor) == CheckpointDecision::Save) {
+      saved_ = tensor;
+    }
+  }
+
+  at::Tensor call_unpack_hook() override {
+    if (saved_.defined()) {
+      return saved_;
+    }
+    std::lock_guard<std::mutex> lock(ctx_->mutex);
+    if (!ctx_->recomputed) {
+      // Re-running the region must record a graph even though backward
+      // runs with grad mode off, otherwise no tensors are packed.
+      at::AutoGradMode enable_grad(true);
+      ctx_->rematerialized.reserve(ctx_->pack_count);
+      NativeHooksGuard guard(
+          [ctx = ctx_]() -> std::unique_ptr<SavedVariableHooks> {
+            return std::make_unique<CollectSavedVariableHooks>(ctx);
+          });
+      // Outputs are discarded; only the pack side effects matter.
+      ctx_->function(ctx_->inputs);
+      ctx_->recomputed = true;
+    }
+    TORCH_CHECK(
+        index_ < ctx_->rematerialized.size(),
+        "native checkpoint: recomputation saved ",
+        ctx_->rematerialized.size(),
+        " tensors, but the original forward saved at least ",
+        index_ + 1,
+        ". The checkpointed function must be deterministic in which "
+        "tensors it saves for backward.");
+    return ctx_->rematerialized[index_];
+  }
+
+ private:
+  std::shared_ptr<RecomputeContext> ctx_;
+  at::Tensor saved_;
+  size_t index_ = 0;
+};
+
+} // namespace
+
+CheckpointDecision CheckpointPolicy::decide(const Variable& variable) const {
+  const auto& grad_fn = variable.grad_fn();
+  if (!grad_fn) {
+    // Leaves and constants are alive outside the region; dropping them
+    // would not free anything, and re-running the region cannot recreate
+    // their identity anyway.
+    return CheckpointDecision::Save;
+  }
+  auto it = op_decisions.find(grad_fn->name());
+  return it != op_decisions.end() ? it->second : default_decision;
+}
+
+variable_list checkpoint(
+    CheckpointFunction function,
+    const variable_list& inputs,
+    CheckpointPolicy policy) {
+  TORCH_CHECK(function, "checkpoint expects a non-empty function");
+  if (!at::GradMode::is_enabled()) {
+    // No graph is being recorded, so there is nothing to drop.
+    return function(inputs);
+  }
+  auto ctx = std::make_shared<RecomputeContext>();
+  ctx->inputs = inputs;
+  ctx->policy = std::move(policy);
+
+  variable_list outputs;
+  {
+    NativeHooksGuard guard(
+        [ctx]() -> std::unique_ptr<SavedVariableHooks> {
+          return std::make_unique<CheckpointSavedVariableHooks>(ctx);
+        });
+    outputs = function(inputs);
+  }
+  // Keep the function for recompute only after the forward succeeded.
+  ctx->function = std::move(function);
+  return outputs;
+}
+
+namespace impl {
+
+std::unique_ptr<SavedVariableHooks> get_native_default_saved_variable_hooks() {
+  auto& stack = hooks_factory_stack();
+  if (stack.empty()) {
+    return nullptr;
+  }
+  return stack.back()();
+}
+
+} // namespace impl
+
+} // namespace torch::autograd
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <torch/csrc/autograd/saved_variable_hooks.h>
+#include <torch/csrc/autograd/variable.h>
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+namespace torch::autograd {
+
+// Decision for a single saved activation inside a checkpointed region.
+enum class CheckpointDecision {
+  // Drop the tensor at pack time and rematerialize it by re-running the
+  // region's function when backward first needs it.
+  Recompute,
+  // Keep the tensor alive as usual.
+  Save,
+};
+
+// Policy table consulted once per saved activation, keyed by the name of
+// the autograd node that produced it (e.g. "MmBackward0",
+// "ConvolutionBackward0"). Tensors without a grad_fn (leaves, constants)
+// are always kept: they are alive outside the region anyway, so dropping
+// them saves nothing. The table is plain C++ data evaluated with no GIL
+// or Python callback involved, so the per-activation cost is a hash
+// lookup. A typical selective policy recomputes everything except the
+// outputs of compute-bound ops:
+//
+//   CheckpointPolicy policy;
+//   policy.op_decisions["MmBackward0"] = CheckpointDecision::Save;
+//   policy.op_decisions["ConvolutionBackward0"] = CheckpointDecision::Save;
+struct TORCH_API CheckpointPolicy {
+  CheckpointDecision default_decision = CheckpointDecision::Recompute;
+  std::unordered_map<std::string, CheckpointDecision> op_decisions;
+
+  CheckpointDecision decide(const Variable& variable) const;
+};
+
+using CheckpointFunction =
+    std::function<variable_list(const variable_list&)>;
+
+// Runs `function` on `inputs` as a checkpointed region: activations the
+// policy marks Recompute are dropped after the forward pass and
+// rematerialized by re-running `function` the first time backward unpacks
+// one of them. Equivalent to the non-reentrant torch.utils.checkpoint but
+// implemented entirely with C++ SavedVariable hooks, so it works inside
+// TorchScript and C++-only training loops without touching the GIL.
+//
+// `function` must be a pure function of `inputs` up to RNG draws: it is
+// re-run once during backward and must save the same tensors in the same
+// order. RNG state is not captured, so regions containing dropout or
+// other random ops will rematerialize with fresh randomness; mark such
+// activations Save in the policy instead.
+TORCH_API variable_list checkpoint(
+    CheckpointFunction function,
+    const variable_list& inputs,
+    CheckpointPolicy policy = {});
+
+namespace impl {
+
+// Returns hooks produced by the innermost active native default-hooks
+// guard (e.g. a checkpointed region on this thread), or nullptr when no
+// guard is active. Consulted by SavedVariable ahead of the Python
+// saved-tensor hooks.
+TORCH_API std::unique_ptr<SavedVariableHooks>
+get_native_default_saved_variable_hooks();
+
+} // namespace impl
+
+} // namespace torch::autograd
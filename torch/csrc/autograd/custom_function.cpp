@@ -527,14 +527,9 @@ void AutogradContext::save_variables() {
 
 variable_list AutogradContext::get_saved_variables() const {
   TORCH_CHECK(!has_freed_buffers_, ERR_BACKWARD_TWICE);
-  variable_list saved;
-  saved.reserve(saved_variables_.size());
   auto ptr = grad_fn_.lock();
   TORCH_INTERNAL_ASSERT(ptr);
-  for (auto& var : saved_variables_) {
-    saved.push_back(var.unpack(ptr));
-  }
-  return saved;
+  return SavedVariable::unpack_list(saved_variables_, ptr);
 }
 
 bool AutogradContext::needs_input_grad(size_t output_edge_index) const {
@@ -3,6 +3,7 @@
 #include <torch/csrc/autograd/anomaly_mode.h>
 #include <torch/csrc/autograd/autograd.h>
 #include <torch/csrc/autograd/function.h>
+#include <torch/csrc/autograd/functions/accumulate_grad.h>
 #include <torch/csrc/autograd/functions/basic_ops.h>
 #include <torch/csrc/autograd/grad_mode.h>
 #include <torch/csrc/autograd/variable.h>
@@ -41,6 +42,7 @@
 #include <optional>
 #include <string>
 #include <thread>
+#include <tuple>
 #include <unordered_set>
 #include <utility>
 
@@ -230,48 +232,133 @@ CheckpointValidGuard::~CheckpointValidGuard() {
   checkpoint_valid = prev_checkpoint_valid_state;
 }
 
+// Note [Sharded ready queue]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~
+// A ReadyQueue has many producers (every worker thread whose nodes have a
+// next edge on this queue's device pushes here) but usually a single
+// consumer (the worker thread bound to the queue; reentrant backwards may
+// temporarily add a few more). With a single mutex around the heap, the
+// producers serialize on that mutex, and on large hosts ReadyQueue::push
+// becomes a contention hot spot of the backward pass.
+//
+// To avoid that, the queue's storage is split into kNumShards smaller
+// heaps, each with its own mutex. A producer only touches the shard picked
+// by shard_index() (a hash of its thread id, so a given producer keeps
+// hitting the same, mostly uncontended, lock). Consumers coordinate
+// through total_size_: pop() first reserves one task by decrementing
+// total_size_ under mutex_ (blocking on not_empty_ while the queue is
+// drained), then claims a task by scanning the shards. Since tasks never
+// move between shards and every reservation is backed by a pushed task,
+// the scan is guaranteed to eventually find one; a scan can transiently
+// come up empty only when racing with other consumers, in which case it
+// simply retries.
+//
+// The claim step picks the best task among the shard tops, so the ordering
+// that CompareNodeTaskTime establishes (shutdown tasks, then tasks whose
+// GraphTask has expired, then deepest reentrant depth, then highest
+// sequence number) is preserved up to tasks pushed concurrently with the
+// scan. That ordering is a scheduling heuristic rather than a correctness
+// requirement, so best effort is acceptable here.
+
+size_t ReadyQueue::shard_index() {
+  static thread_local const size_t shard =
+      std::hash<std::thread::id>{}(std::this_thread::get_id()) % kNumShards;
+  return shard;
+}
+
 auto ReadyQueue::push(NodeTask item, bool incrementOutstandingTasks) -> void {
+  auto& shard = shards_[shard_index()];
   {
-    // Lock mutex for writing to heap_
-    std::lock_guard<std::mutex> lock(mutex_);
+    // Lock the shard mutex for writing to its heap_
+    std::lock_guard<std::mutex> lock(shard.mutex_);
     if (incrementOutstandingTasks) {
       std::shared_ptr<GraphTask> graph_task = item.base_.lock();
       TORCH_INTERNAL_ASSERT(graph_task, "GraphTask is no longer valid!");
       ++graph_task->outstanding_tasks_;
     }
-    heap_.push(std::move(item));
+    shard.heap_.push(std::move(item));
+  }
+  {
+    // Publish the task under mutex_ so a consumer that just found
+    // total_size_ == 0 cannot go to sleep and miss the notification.
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++total_size_;
   }
   not_empty_.notify_one();
 }
 
 auto ReadyQueue::pushShutdownTask() -> void {
+  auto& shard = shards_[shard_index()];
+  {
+    std::lock_guard<std::mutex> lock(shard.mutex_);
+    shard.heap_.push(NodeTask({}, nullptr, InputBuffer(0), true));
+  }
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    heap_.push(NodeTask({}, nullptr, InputBuffer(0), true));
+    ++total_size_;
   }
   not_empty_.notify_one();
 }
 
 size_t ReadyQueue::size() const {
-  // Lock mutex for accesses to heap_
-  std::unique_lock<std::mutex> lock(mutex_);
-  return heap_.size();
+  return total_size_.load();
 }
 
 auto ReadyQueue::pop() -> NodeTask {
-  // Lock mutex for accesses to heap_
-  std::unique_lock<std::mutex> lock(mutex_);
-  not_empty_.wait(lock, [this] { return !heap_.empty(); });
-  // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
-  auto task = std::move(const_cast<NodeTask&>(heap_.top()));
-  heap_.pop();
-  return task;
+  // Reserve one task. After this block we own one task somewhere in the
+  // shards, though not a particular one.
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    not_empty_.wait(lock, [this] { return total_size_.load() > 0; });
+    --total_size_;
+  }
+  // Claim the best task currently visible across the shard tops; see
+  // Note [Sharded ready queue] for why this loop terminates.
+  while (true) {
+    int64_t best_shard = -1;
+    bool best_is_shutdown = false;
+    int best_depth = 0;
+    uint64_t best_seq = 0;
+    for (const auto i : c10::irange(kNumShards)) {
+      std::lock_guard<std::mutex> lock(shards_[i].mutex_);
+      if (shards_[i].heap_.empty()) {
+        continue;
+      }
+      const NodeTask& top = shards_[i].heap_.top();
+      const bool is_shutdown = top.isShutdownTask_;
+      const int depth = top.getReentrantDepth();
+      const uint64_t seq =
+          top.fn_ ? top.fn_->sequence_nr() : std::numeric_limits<uint64_t>::max();
+      // Mirrors CompareNodeTaskTime: shutdown tasks first, then deepest
+      // reentrant depth (expired GraphTasks report INT_MAX), then highest
+      // sequence number.
+      if (best_shard < 0 ||
+          std::make_tuple(is_shutdown, depth, seq) >
+              std::make_tuple(best_is_shutdown, best_depth, best_seq)) {
+        best_shard = static_cast<int64_t>(i);
+        best_is_shutdown = is_shutdown;
+        best_depth = depth;
+        best_seq = seq;
+      }
+    }
+    if (best_shard >= 0) {
+      auto& shard = shards_[best_shard];
+      std::lock_guard<std::mutex> lock(shard.mutex_);
+      if (!shard.heap_.empty()) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-const-cast)
+        auto task = std::move(const_cast<NodeTask&>(shard.heap_.top()));
+        shard.heap_.pop();
+        return task;
+      }
+    }
+    // Another consumer claimed the task(s) we saw; our reservation is still
+    // backed by a concurrently pushed task, so rescan.
+    std::this_thread::yield();
+  }
 }
 
 bool ReadyQueue::empty() const {
-  // Lock mutex for accesses to heap_
-  std::unique_lock<std::mutex> lock(mutex_);
-  return heap_.empty();
+  return total_size_.load() == 0;
 }
 
 Engine::Engine()
@@ -422,6 +509,20 @@ void add_node_to_current_graph_task_exec_info(Node* fn) {
   current_graph_task->exec_info_[fn].needed_ = true;
 }
 
+bool stash_deferred_grad_accumulation(
+    std::shared_ptr<Node> node,
+    const Variable& variable,
+    const at::Tensor& new_grad) {
+  if (!current_graph_task) {
+    return false;
+  }
+  std::lock_guard<std::mutex> lock(
+      current_graph_task->deferred_grad_accumulations_lock_);
+  current_graph_task->deferred_grad_accumulations_.push_back(
+      {std::move(node), variable, new_grad});
+  return true;
+}
+
 // NB: The engine itself does not use the outputs of this function.
 std::vector<Node*> get_current_graph_task_execution_order() {
   std::shared_ptr<GraphTask> task = current_graph_task;
@@ -771,6 +872,19 @@ void GraphTask::exec_post_processing() {
     // always saves ThreadLocalState without grad_mode.
     at::ThreadLocalStateGuard tls_guard(this->thread_locals_);
 
+    // Flush deferred grad accumulations before the final callbacks so that
+    // the callbacks observe fully accumulated grads. Running the flush under
+    // the stream guard above orders the batched adds after the leaf streams.
+    // See Note [Coalesced grad accumulation] in accumulate_grad.cpp.
+    std::vector<DeferredGradAccumulation> deferred_accumulations;
+    {
+      std::lock_guard<std::mutex> lock(deferred_grad_accumulations_lock_);
+      deferred_accumulations = std::move(deferred_grad_accumulations_);
+    }
+    if (!deferred_accumulations.empty()) {
+      AccumulateGrad::accumulate_deferred(std::move(deferred_accumulations));
+    }
+
     // WARNING: Don't use a range-for loop here because more callbacks may be
     // added in between callback calls, so iterators may become invalidated.
     // NOLINTNEXTLINE(modernize-loop-convert)
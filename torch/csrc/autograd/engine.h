@@ -17,6 +17,8 @@
 
 #include <c10/util/CallOnce.h>
 
+#include <array>
+#include <atomic>
 #include <exception>
 #include <functional>
 #include <memory>
@@ -100,13 +102,33 @@ struct ReadyQueue {
     }
   };
 
-  // To notify threads waiting on the ReadyQueue of available tasks on the heap_
+  // Pushes are spread across several independently locked heaps so that
+  // concurrent producers (typically the device worker threads feeding the CPU
+  // queue) do not serialize on a single mutex. See Note [Sharded ready queue]
+  // in engine.cpp for how consumers reconcile the shards in pop().
+  static constexpr size_t kNumShards = 8;
+
+  struct Shard {
+    // To protect read and writes to heap_
+    mutable std::mutex mutex_;
+    std::priority_queue<NodeTask, std::vector<NodeTask>, CompareNodeTaskTime>
+        heap_;
+  };
+
+  // Returns the shard the calling thread pushes to.
+  static size_t shard_index();
+
+  // To notify threads waiting on the ReadyQueue of available tasks
   std::condition_variable not_empty_;
-  // To protect read and writes to heap_
+  // Coordinates consumers going to sleep in pop(); the per-shard heaps are
+  // protected by their own mutexes.
   mutable std::mutex mutex_;
+  // Number of pushed tasks that have not yet been reserved by a consumer in
+  // pop(). Only written while holding mutex_ so that waiters cannot miss a
+  // notification; read without it in empty()/size().
+  std::atomic<size_t> total_size_{0};
 
-  std::priority_queue<NodeTask, std::vector<NodeTask>, CompareNodeTaskTime>
-      heap_;
+  std::array<Shard, kNumShards> shards_;
 
  public:
   // incrementOutstandingTasks indicates whether or not we should increment
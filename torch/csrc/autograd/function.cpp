@@ -2,6 +2,7 @@
 
 #include <c10/util/ThreadLocal.h>
 #include <torch/csrc/autograd/engine.h>
+#include <torch/csrc/autograd/node_arena.h>
 #include <torch/csrc/autograd/variable.h>
 
 #include <ATen/ATen.h>
@@ -38,6 +39,14 @@ std::shared_ptr<Node> get_current_node() {
   return current_evaluating_node;
 }
 
+void* Node::operator new(size_t size) {
+  return detail::allocate_node(size);
+}
+
+void Node::operator delete(void* ptr) {
+  detail::free_node(ptr);
+}
+
 void Node::assign_parent() {
   metadata()->assign_parent(current_evaluating_node);
 }
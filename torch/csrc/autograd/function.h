@@ -142,6 +142,12 @@ struct TORCH_API Node : std::enable_shared_from_this<Node> {
   Node& operator=(Node&& other) = delete;
   virtual ~Node() = default;
 
+  /// Node storage is bump-allocated from the active thread's arena while
+  /// a NodeArenaGuard is in scope, and comes from the plain heap
+  /// otherwise. See torch/csrc/autograd/node_arena.h.
+  static void* operator new(size_t size);
+  static void operator delete(void* ptr);
+
   std::shared_ptr<Node> getptr() {
     return shared_from_this();
   }
@@ -5,10 +5,19 @@
 #include <torch/csrc/autograd/functions/tensor.h>
 #include <torch/csrc/autograd/functions/utils.h>
 #include <torch/csrc/autograd/grad_mode.h>
+#include <torch/csrc/autograd/graph_task.h>
 #include <torch/csrc/autograd/variable.h>
 #include <torch/csrc/dynamo/compiled_autograd.h>
 
+#ifndef AT_PER_OPERATOR_HEADERS
+#include <ATen/Functions.h>
+#else
+#include <ATen/ops/_foreach_add.h>
+#endif
+
+#include <algorithm>
 #include <cstdint>
+#include <cstdlib>
 #include <stdexcept>
 #include <utility>
 
@@ -21,6 +30,110 @@ AccumulateGrad::AccumulateGrad(Variable variable_)
   add_input_metadata(variable);
 }
 
+// Note [Coalesced grad accumulation]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// Each AccumulateGrad node normally performs its `variable_grad += new_grad`
+// the moment its input buffer is ready. For models with very many small
+// parameters the per-node overhead of that scheme (one dispatcher round trip
+// and one kernel launch per parameter) dominates the tail of the backward
+// pass. When TORCH_AUTOGRAD_COALESCE_ACCUMULATE_GRAD=1, nodes whose
+// accumulation reduces to a plain dense in-place add instead stash
+// (node, variable, new_grad) on their GraphTask via
+// stash_deferred_grad_accumulation. The engine's dependency counting already
+// tells us when every such input is ready: exec_post_processing runs once
+// outstanding_tasks_ drains, and it flushes the stashed accumulations as one
+// _foreach_add_ per (device, dtype) bucket before the final callbacks run.
+//
+// Only accumulations that are observationally equivalent to the deferred add
+// are stashed: first-order only (no GradMode), an already-defined dense grad
+// of matching device/dtype, and no post hooks or post-accumulate-grad hooks
+// on the node (those expect to observe the grad right after the node fires,
+// as do DDP comm hooks). Everything else takes the eager path below. The
+// deferred new_grads stay alive until the flush, so the mode trades some
+// peak memory for fewer kernel launches.
+bool AccumulateGrad::coalesced_accumulation_enabled() {
+  static const bool enabled = []() {
+    const auto* env = std::getenv("TORCH_AUTOGRAD_COALESCE_ACCUMULATE_GRAD");
+    return env != nullptr && env[0] == '1';
+  }();
+  return enabled;
+}
+
+bool AccumulateGrad::can_defer_accumulation(const at::Tensor& new_grad) {
+  if (GradMode::is_enabled()) {
+    // Double backward needs the differentiable out-of-place sum.
+    return false;
+  }
+  if (!post_hooks().empty() || tensor_post_acc_grad_hooks() != nullptr) {
+    return false;
+  }
+  const at::Tensor& variable_grad = variable.grad();
+  return variable_grad.defined() && variable_grad.layout() == at::kStrided &&
+      new_grad.layout() == at::kStrided &&
+      variable_grad.device() == new_grad.device() &&
+      variable_grad.scalar_type() == new_grad.scalar_type() &&
+      at::inplaceIsVmapCompatible(variable_grad, new_grad);
+}
+
+void AccumulateGrad::accumulate_deferred(
+    std::vector<DeferredGradAccumulation>&& deferred) {
+  // Serialize with anyone else applying these nodes (e.g. a concurrent
+  // backward over the same leaves). Locking in address order avoids
+  // deadlocking against another flush over an overlapping set of nodes.
+  std::vector<AccumulateGrad*> nodes;
+  nodes.reserve(deferred.size());
+  for (const auto& item : deferred) {
+    nodes.push_back(static_cast<AccumulateGrad*>(item.node.get()));
+  }
+  std::sort(nodes.begin(), nodes.end());
+  nodes.erase(std::unique(nodes.begin(), nodes.end()), nodes.end());
+  std::vector<std::unique_lock<std::mutex>> locks;
+  locks.reserve(nodes.size());
+  for (auto* node : nodes) {
+    locks.emplace_back(node->mutex_);
+  }
+
+  struct Bucket {
+    at::Device device;
+    at::ScalarType dtype;
+    std::vector<at::Tensor> grads;
+    std::vector<at::Tensor> new_grads;
+  };
+  std::vector<Bucket> buckets;
+  for (auto& item : deferred) {
+    at::Tensor& grad = item.variable.mutable_grad();
+    // Revalidate under the node lock: the grad may have been replaced (by
+    // the user, or by another backward) since this accumulation was stashed.
+    if (!grad.defined() || grad.layout() != at::kStrided ||
+        item.new_grad.layout() != at::kStrided ||
+        grad.device() != item.new_grad.device() ||
+        grad.scalar_type() != item.new_grad.scalar_type() ||
+        !at::inplaceIsVmapCompatible(grad, item.new_grad)) {
+      accumulateGrad(
+          item.variable,
+          grad,
+          item.new_grad,
+          1 /* num_expected_refs */,
+          [&grad](at::Tensor&& grad_update) { grad = std::move(grad_update); });
+      continue;
+    }
+    auto it = std::find_if(
+        buckets.begin(), buckets.end(), [&grad](const Bucket& bucket) {
+          return bucket.device == grad.device() &&
+              bucket.dtype == grad.scalar_type();
+        });
+    if (it == buckets.end()) {
+      buckets.push_back({grad.device(), grad.scalar_type(), {}, {}});
+      it = std::prev(buckets.end());
+    }
+    it->grads.push_back(grad);
+    it->new_grads.push_back(item.new_grad);
+  }
+  for (const auto& bucket : buckets) {
+    at::_foreach_add_(bucket.grads, bucket.new_grads);
+  }
+}
+
 auto AccumulateGrad::apply(variable_list&& grads) -> variable_list {
   check_input_variables("AccumulateGrad", grads, 1, 0);
 
@@ -35,6 +148,15 @@ auto AccumulateGrad::apply(variable_list&& grads) -> variable_list {
   // std::move(grads[0]) to avoid bumping up refcount
   at::Tensor new_grad = std::move(grads[0]);
 
+  // See Note [Coalesced grad accumulation]. The stash can fail only when
+  // there is no current graph task (the node was applied by hand); fall
+  // through to the eager path in that case.
+  if (C10_UNLIKELY(coalesced_accumulation_enabled()) &&
+      can_defer_accumulation(new_grad) &&
+      stash_deferred_grad_accumulation(getptr(), variable, new_grad)) {
+    return variable_list();
+  }
+
   // Acquire lock to here protect thread safety on variable, this ensures
   // AccumulateGrad does not race to shared variable from different threads
   // when updating the gradients. We don't ensure thread safety on hooks
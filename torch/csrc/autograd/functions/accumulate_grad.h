@@ -18,6 +18,8 @@
 
 namespace torch::autograd {
 
+struct DeferredGradAccumulation;
+
 #define CHECK_RESULT(RESULT, VAR)                                          \
   if (!(RESULT.is_sparse() || VAR.is_sparse() || RESULT.is_sparse_csr() || \
         VAR.is_sparse_csr())) {                                            \
@@ -42,6 +44,22 @@ struct TORCH_API AccumulateGrad : public Node {
 
   variable_list apply(variable_list&& grads) override;
 
+  // True when coalesced grad accumulation is enabled for this process
+  // (TORCH_AUTOGRAD_COALESCE_ACCUMULATE_GRAD=1). See
+  // Note [Coalesced grad accumulation] in accumulate_grad.cpp.
+  static bool coalesced_accumulation_enabled();
+
+  // Whether this accumulation may be stashed on the graph task and flushed in
+  // a batched _foreach_add_ instead of being performed eagerly.
+  bool can_defer_accumulation(const at::Tensor& new_grad);
+
+  // Performs the accumulations that were deferred onto a graph task, batching
+  // same-device/same-dtype in-place adds through _foreach_add_. Called from
+  // GraphTask::exec_post_processing once the engine's dependency counting has
+  // retired every task of the graph.
+  static void accumulate_deferred(
+      std::vector<DeferredGradAccumulation>&& deferred);
+
   std::vector<std::unique_ptr<FunctionPreHook>>& tensor_pre_hooks() noexcept
       override {
     // NB: Since the AccumulateGrad Node is only a weak ref from the Tensor,
@@ -14,6 +14,17 @@ struct ReadyQueue;
 static constexpr int NO_DEVICE = -2;
 static constexpr int CPU_DEVICE = -1;
 
+// A gradient accumulation that an AccumulateGrad node stashed instead of
+// performing eagerly, so that a whole graph's worth of accumulations can be
+// flushed as batched _foreach_add_ calls. The node is kept alive so the flush
+// can serialize with other users of the node's mutex. See
+// Note [Coalesced grad accumulation] in accumulate_grad.cpp.
+struct DeferredGradAccumulation {
+  std::shared_ptr<Node> node;
+  Variable variable;
+  at::Tensor new_grad;
+};
+
 // GraphTask holds metadata needed for a single execution of backward()
 struct GraphTask : std::enable_shared_from_this<GraphTask> {
   std::atomic<uint64_t> outstanding_tasks_{0};
@@ -179,6 +190,15 @@ struct GraphTask : std::enable_shared_from_this<GraphTask> {
   // tasks are done.
   c10::intrusive_ptr<at::ivalue::Future> future_result_;
 
+  // Accumulations deferred by AccumulateGrad nodes when coalesced grad
+  // accumulation is enabled. Drained in exec_post_processing, i.e. once the
+  // engine's dependency counting has retired every task of this graph. See
+  // Note [Coalesced grad accumulation] in accumulate_grad.cpp.
+  std::vector<DeferredGradAccumulation> deferred_grad_accumulations_;
+  // To protect reads and writes to deferred_grad_accumulations_. Intentionally
+  // not reusing mutex_, which is not held while nodes execute.
+  std::mutex deferred_grad_accumulations_lock_;
+
   // Final callbacks installed during execution of this GraphTask
   std::vector<std::function<void()>> final_callbacks_;
   // To protect reads and writes to final_callbacks_. Intentionally no reusing
@@ -223,4 +243,13 @@ TORCH_API std::vector<Node*> get_current_graph_task_execution_order();
 TORCH_API int get_current_graph_task_id();
 void add_node_to_current_graph_task_exec_info(Node* fn);
 
+// Stashes a deferred gradient accumulation on the current graph task; returns
+// false when there is no current graph task (e.g. the node was invoked outside
+// the engine), in which case the caller must accumulate eagerly. See
+// Note [Coalesced grad accumulation] in accumulate_grad.cpp.
+bool stash_deferred_grad_accumulation(
+    std::shared_ptr<Node> node,
+    const Variable& variable,
+    const at::Tensor& new_grad);
+
 } // namespace torch::autograd
@@ -274,6 +274,10 @@ PyObject* THPAutograd_initExtension(PyObject* _unused, PyObject* unused) {
           [](const KinetoEvent& e) { return e.linkedCorrelationId(); })
       // compute flops
       .def("flops", [](const KinetoEvent& e) { return e.flops(); })
+      // compute bytes read and written
+      .def(
+          "bytes_accessed",
+          [](const KinetoEvent& e) { return e.bytesAccessed(); })
       // Whether this is async event or not
       .def("is_async", [](const KinetoEvent& e) { return e.isAsync(); })
       .def("cuda_elapsed_us", &KinetoEvent::cudaElapsedUs)
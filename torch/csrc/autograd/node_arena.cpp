@@ -0,0 +1,105 @@
+#include <torch/csrc/autograd/node_arena.h>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <vector>
+
+namespace torch::autograd {
+
+namespace {
+
+// Every Node allocation is prefixed by a header holding the owning arena
+// (nullptr for plain heap allocations), so operator delete can route the
+// free without any global lookup. max_align keeps the Node itself as
+// aligned as ::operator new would.
+constexpr size_t kHeaderSize = alignof(std::max_align_t);
+constexpr size_t kSlabSize = 64 * 1024;
+
+class NodeArena {
+ public:
+  // The creating scope holds the initial reference; every allocation
+  // takes another one. Slabs are freed when the count drops to zero,
+  // i.e. once the scope ended and the last Node from it was destroyed.
+  NodeArena() : refcount_(1) {}
+
+  // Only called from the owning thread (the arena is thread local).
+  void* allocate(size_t size) {
+    size = (size + kHeaderSize - 1) & ~(kHeaderSize - 1);
+    if (size > kSlabSize) {
+      // Oversized request: give it a dedicated slab, keep bump state.
+      slabs_.emplace_back(new char[size]);
+      refcount_.fetch_add(1, std::memory_order_relaxed);
+      return slabs_.back().get();
+    }
+    if (remaining_ < size) {
+      slabs_.emplace_back(new char[kSlabSize]);
+      cur_ = slabs_.back().get();
+      remaining_ = kSlabSize;
+    }
+    void* ptr = cur_;
+    cur_ += size;
+    remaining_ -= size;
+    refcount_.fetch_add(1, std::memory_order_relaxed);
+    return ptr;
+  }
+
+  // May be called from any thread: graphs are commonly released by
+  // engine workers or a garbage collector.
+  void release() {
+    if (refcount_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      delete this;
+    }
+  }
+
+ private:
+  std::atomic<size_t> refcount_;
+  std::vector<std::unique_ptr<char[]>> slabs_;
+  char* cur_ = nullptr;
+  size_t remaining_ = 0;
+};
+
+thread_local NodeArena* current_node_arena = nullptr;
+
+} // namespace
+
+NodeArenaGuard::NodeArenaGuard() : prev_arena_(current_node_arena) {
+  current_node_arena = new NodeArena();
+}
+
+NodeArenaGuard::~NodeArenaGuard() {
+  NodeArena* arena = current_node_arena;
+  current_node_arena = static_cast<NodeArena*>(prev_arena_);
+  // Drop the scope's reference; the slabs go away when the last Node
+  // allocated from this arena is destroyed (possibly right now).
+  arena->release();
+}
+
+namespace detail {
+
+void* allocate_node(size_t size) {
+  NodeArena* arena = current_node_arena;
+  char* base = arena
+      ? static_cast<char*>(arena->allocate(kHeaderSize + size))
+      : static_cast<char*>(::operator new(kHeaderSize + size));
+  *reinterpret_cast<NodeArena**>(base) = arena;
+  return base + kHeaderSize;
+}
+
+void free_node(void* ptr) {
+  if (ptr == nullptr) {
+    return;
+  }
+  char* base = static_cast<char*>(ptr) - kHeaderSize;
+  NodeArena* arena = *reinterpret_cast<NodeArena**>(base);
+  if (arena) {
+    arena->release();
+  } else {
+    ::operator delete(base);
+  }
+}
+
+} // namespace detail
+
+} // namespace torch::autograd
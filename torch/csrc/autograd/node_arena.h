@@ -0,0 +1,55 @@
+#pragma once
+
+#include <torch/csrc/Export.h>
+
+#include <cstddef>
+
+namespace torch::autograd {
+
+// Scoped, opt-in arena allocation for autograd Nodes.
+//
+// Small-op training allocates one Node per forward op and frees it when
+// the graph dies, which shows up as malloc/free traffic in tight loops.
+// While a NodeArenaGuard is active on a thread, Node storage (the Node
+// subclass object itself; see Node::operator new) is bump-allocated from
+// 64 KiB slabs owned by the scope's arena. Node destructors still run
+// individually when their graph dies, but each free is just a counter
+// decrement: the slabs are returned to the system in one shot once the
+// scope has ended and the last Node allocated in it has been destroyed,
+// whichever comes later. Graphs may therefore safely outlive the guard,
+// e.g. when a loss tensor escapes the scope and backward() runs outside
+// it.
+//
+// Guards nest; each scope gets its own arena. Nodes created by other
+// threads while the guard is alive are not affected (the active arena is
+// thread local, matching how graphs are built on the forward thread).
+//
+// Typical use wraps a training session or step:
+//
+//   torch::autograd::NodeArenaGuard arena;
+//   for (...) { loss = model(input); loss.backward(); ... }
+class TORCH_API NodeArenaGuard {
+ public:
+  NodeArenaGuard();
+  ~NodeArenaGuard();
+
+  NodeArenaGuard(const NodeArenaGuard&) = delete;
+  NodeArenaGuard& operator=(const NodeArenaGuard&) = delete;
+
+ private:
+  // The arena active before this guard, restored on destruction.
+  void* prev_arena_;
+};
+
+namespace detail {
+
+// Entry points used by Node::operator new/delete. Allocations carry a
+// small header identifying their arena (or its absence), so frees are
+// routed correctly no matter which thread drops the last reference or
+// whether a guard was active at allocation time.
+TORCH_API void* allocate_node(size_t size);
+TORCH_API void free_node(void* ptr);
+
+} // namespace detail
+
+} // namespace torch::autograd
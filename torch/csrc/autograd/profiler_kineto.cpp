@@ -494,7 +494,10 @@ void onFunctionExit(
   const auto& config = state_ptr->config();
   auto* kineto_ctx_ptr =
       static_cast<torch::profiler::impl::KinetoObserverContext*>(ctx_ptr);
-  TORCH_INTERNAL_ASSERT(kineto_ctx_ptr != nullptr);
+  if (kineto_ctx_ptr == nullptr) {
+    // begin_op dropped this op (profiler_sample_rate sampling).
+    return;
+  }
   kineto_ctx_ptr->event_->end_time_ = c10::getApproximateTime();
   if (!config.experimental_config.performance_events.empty()) {
     state_ptr->recordQueue.getSubqueue()->disable_perf_profiler(
@@ -1056,6 +1059,12 @@ TYPED_ATTR(
     !e.extra_args_.empty()
         ? torch::profiler::impl::computeFlops(e.name_, e.extra_args_)
         : 0)
+TYPED_ATTR(
+    TorchOp,
+    bytesAccessed,
+    !e.extra_args_.empty()
+        ? torch::profiler::impl::computeBytes(e.name_, e.extra_args_)
+        : 0)
 TYPED_ATTR(Backend, backend, e.backend_)
 TYPED_ATTR(Allocation, nBytes, e.alloc_size_)
 TYPED_ATTR(Kineto, linkedCorrelationId, [&]() {
@@ -39,6 +39,7 @@ struct TORCH_API KinetoEvent {
   bool hasKwinputs() const;
   const std::unordered_map<std::string, c10::IValue> kwinputs() const;
   uint64_t flops() const;
+  uint64_t bytesAccessed() const;
   int64_t sequenceNr() const;
   bool hasStack() const;
   const c10::ArrayRef<std::string> stack() const;
@@ -94,8 +94,9 @@ static PyObject* unpack_saved_variables(
   // because we will never hit this line of code if the buffers are freed--
   // and in any case saved_for will be non-NULL.)
   TORCH_INTERNAL_ASSERT(saved_for);
+  auto unpacked_vars = SavedVariable::unpack_list(saved_variables, saved_for);
   for (const auto i : c10::irange(num_saved)) {
-    auto unpacked_var = saved_variables[i].unpack(saved_for);
+    auto& unpacked_var = unpacked_vars[i];
     THPObjectPtr value;
     if (!unpacked_var.defined()) {
       Py_INCREF(Py_None);
@@ -409,6 +409,38 @@ static bool THPVariable_tryResurrect(THPVariable* self) {
   return true;
 }
 
+// Opt-in batching for the final release of the C++ Tensor owned by a dying
+// Python wrapper.  Dropping the last reference to a TensorImpl can be
+// expensive (storage deallocation, autograd metadata teardown), and doing it
+// inline in tp_clear charges that cost to whatever happened to drop the last
+// Python reference.  When enabled, the Tensor is parked in a pending batch
+// instead and the cost is paid at the next explicit drain, which callers are
+// expected to run at a natural checkpoint (e.g. an iteration boundary).
+// Both the flag and the batch are only touched with the GIL held.
+static bool defer_tensor_decrefs = false;
+static std::vector<Variable> deferred_tensor_decrefs;
+
+void THPVariable_drainDeferredTensorDecrefs() {
+  if (deferred_tensor_decrefs.empty()) {
+    return;
+  }
+  std::vector<Variable> batch;
+  batch.swap(deferred_tensor_decrefs);
+  // As in THPVariable_subclass_clear, release the GIL while the tensors die;
+  // MapAllocator can take significant time to release large tensors.
+  pybind11::gil_scoped_release no_gil;
+  batch.clear();
+}
+
+bool THPVariable_setDeferTensorDecrefs(bool enabled) {
+  const bool prev = defer_tensor_decrefs;
+  defer_tensor_decrefs = enabled;
+  if (!enabled) {
+    THPVariable_drainDeferredTensorDecrefs();
+  }
+  return prev;
+}
+
 static int THPVariable_subclass_clear(THPVariable* self) {
   // Is it OK for an object to still be live after running
   // tp_clear? Yes. When Python is breaking reference cycles, it can't assume
@@ -498,7 +530,14 @@ static int THPVariable_subclass_clear(THPVariable* self) {
     }
   }
   TORCH_INTERNAL_ASSERT(!isResurrectable((THPVariable*)self));
-  {
+  if (defer_tensor_decrefs && !self->cdata.unsafeIsBorrowed() &&
+      tensor.defined()) {
+    // Park the Tensor in the pending batch; the final release (and any
+    // storage deallocation it triggers) happens at the next drain.  The
+    // extra reference taken here makes the reset below cheap.
+    deferred_tensor_decrefs.emplace_back(tensor);
+    self->cdata = MaybeOwned<Variable>();
+  } else {
     // MapAllocator can take significant time to release large tensors;
     // release the GIL here to avoid impacting main thread perf.
     pybind11::gil_scoped_release no_gil;
@@ -1904,6 +1943,45 @@ PyObject* THPVariable_pynew(
   END_HANDLE_TH_ERRORS
 }
 
+// Freelist of wrapper objects for the common case where the wrapper is
+// exactly a torch.Tensor (THPVariableClass).  Eager ops allocate one wrapper
+// per returned tensor, so recycling the allocation the way CPython's float
+// freelist does avoids a round trip through the type's allocator on hot
+// paths.  Cached objects have had all of their Python state torn down by
+// THPVariable_subclass_dealloc and keep their reference to the type alive;
+// the freelist is only touched with the GIL held.
+constexpr Py_ssize_t kMaxVariableFreeList = 100;
+// NOLINTNEXTLINE(*-c-arrays,cppcoreguidelines-avoid-non-const-global-variables)
+static PyObject* variable_freelist[kMaxVariableFreeList];
+static Py_ssize_t variable_freelist_size = 0;
+
+// Returns true if self was cached for reuse, in which case the caller must
+// neither free it nor drop its reference to the type.  Only exact
+// torch.Tensor instances are cached: subclasses can differ in basicsize and
+// running a finalizer sets GC state we do not reset.
+static bool THPVariable_cacheForReuse(PyObject* self) {
+  PyTypeObject* type = Py_TYPE(self);
+  if (type != (PyTypeObject*)THPVariableClass || type->tp_finalize ||
+      type->tp_del || variable_freelist_size >= kMaxVariableFreeList) {
+    return false;
+  }
+  variable_freelist[variable_freelist_size++] = self;
+  return true;
+}
+
+static PyObject* THPVariable_allocFromFreeList(PyTypeObject* type) {
+  if (variable_freelist_size == 0 || type != (PyTypeObject*)THPVariableClass) {
+    return nullptr;
+  }
+  PyObject* obj = variable_freelist[--variable_freelist_size];
+  // The cached object was torn down by THPVariable_subclass_dealloc: slots,
+  // dict and weakrefs are cleared and it is untracked by the GC.  Bring it
+  // back to the state tp_alloc would have produced.
+  _Py_NewReference(obj);
+  PyObject_GC_Track(obj);
+  return obj;
+}
+
 // NB: this is not the tp_dealloc on THPVariable; instead, its the dealloc
 // on subclasses.  It's never valid to construct a THPVariable so it's not
 // necessary to implement the dealloc for that case
@@ -1996,6 +2074,10 @@ void THPVariable_subclass_dealloc(PyObject* self) {
   // Finally clear out the base THPVariable
   THPVariable_subclass_clear((THPVariable*)self);
   ((THPVariable*)self)->cdata.~MaybeOwned<Variable>();
+  if (THPVariable_cacheForReuse(self)) {
+    // The object (and its reference to the type) now lives on the freelist.
+    return;
+  }
   Py_TYPE(self)->tp_free(self);
 
   // Python defined subclasses should always be on the heap
@@ -2085,7 +2167,10 @@ static PyObject* THPVariable_NewWithVar(
     return THPVariable_Wrap(std::move(_var));
   }
 
-  PyObject* obj = type->tp_alloc(type, 0);
+  PyObject* obj = THPVariable_allocFromFreeList(type);
+  if (!obj) {
+    obj = type->tp_alloc(type, 0);
+  }
   if (obj) {
     auto v = (THPVariable*)obj;
     // TODO: named constructor to avoid default initialization
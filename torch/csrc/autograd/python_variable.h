@@ -31,6 +31,15 @@ TORCH_PYTHON_API void registerPythonTensorClass(
     const std::string& device,
     PyObject* python_tensor_class);
 
+// When enabled, the final release of the C++ Tensor owned by a dying Python
+// wrapper is parked in a pending batch instead of happening inline in
+// tp_clear; the batch is destroyed on the next drain.  Callers that enable
+// this are responsible for draining at a natural checkpoint (e.g. an
+// iteration boundary).  Returns the previous setting; disabling drains
+// whatever is pending.  Both functions must be called with the GIL held.
+TORCH_PYTHON_API bool THPVariable_setDeferTensorDecrefs(bool enabled);
+TORCH_PYTHON_API void THPVariable_drainDeferredTensorDecrefs();
+
 TORCH_PYTHON_API void activateGPUTrace();
 
 TORCH_PYTHON_API extern PyObject* THPVariableClass;
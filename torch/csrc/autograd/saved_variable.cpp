@@ -1,6 +1,7 @@
 #include <torch/csrc/autograd/saved_variable.h>
 
 #include <torch/csrc/autograd/anomaly_mode.h>
+#include <torch/csrc/autograd/checkpoint.h>
 #include <torch/csrc/autograd/edge.h>
 #include <torch/csrc/autograd/engine.h>
 #include <torch/csrc/autograd/function.h>
@@ -104,6 +105,11 @@ void SavedVariable::save_metadata(const Variable& data) {
 }
 
 std::unique_ptr<SavedVariableHooks> SavedVariable::get_default_hooks() {
+  // Native (C++) default hooks, e.g. an active checkpointed region on
+  // this thread, take precedence over the Python saved-tensor hooks.
+  if (auto hooks = impl::get_native_default_saved_variable_hooks()) {
+    return hooks;
+  }
   return Engine::get_default_engine().get_default_saved_variable_hooks();
 }
 
@@ -123,6 +129,36 @@ SavedVariable::SavedVariable(
           is_inplace_on_view) {}
 
 Variable SavedVariable::unpack(std::shared_ptr<Node> saved_for) const {
+  return unpack_impl(std::move(saved_for), /*need_version_check=*/true);
+}
+
+std::vector<Variable> SavedVariable::unpack_list(
+    c10::ArrayRef<SavedVariable> saved,
+    const std::shared_ptr<Node>& saved_for) {
+  // Validate every version counter up front. A mismatch is reported through
+  // the regular unpack path so the error carries the full context. Nothing
+  // should be mutating these tensors while a node unpacks its saved
+  // variables, so checking slightly earlier than unpack would is equivalent.
+  for (const auto& sv : saved) {
+    if (sv.hooks_ || !sv.data_.defined()) {
+      continue;
+    }
+    if (impl::version_counter(sv.data_).current_version() !=
+        sv.saved_version_) {
+      sv.unpack(saved_for);
+    }
+  }
+  std::vector<Variable> unpacked;
+  unpacked.reserve(saved.size());
+  for (const auto& sv : saved) {
+    unpacked.push_back(sv.unpack_impl(saved_for, /*need_version_check=*/false));
+  }
+  return unpacked;
+}
+
+Variable SavedVariable::unpack_impl(
+    std::shared_ptr<Node> saved_for,
+    bool need_version_check) const {
   if (was_default_constructed_) {
     return Variable();
   }
@@ -154,7 +190,7 @@ Variable SavedVariable::unpack(std::shared_ptr<Node> saved_for) const {
 
   // Only check version counter in the case without hooks
   // If user provides hooks, we can't track versions through the hooks
-  if (!hooks_) {
+  if (need_version_check && !hooks_) {
     auto current_version = impl::version_counter(data_).current_version();
 
     if (saved_version_ != current_version) {
@@ -5,9 +5,11 @@
 #include <torch/csrc/autograd/saved_variable_hooks.h>
 
 #include <ATen/core/Tensor.h>
+#include <c10/util/ArrayRef.h>
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace torch::autograd {
 
@@ -43,6 +45,16 @@ class TORCH_API SavedVariable {
   /// circular reference.
   Variable unpack(std::shared_ptr<Node> saved_for = nullptr) const;
 
+  /// Unpacks a run of saved variables, validating every version counter in a
+  /// single sweep before any variable is reconstructed. Equivalent to calling
+  /// `unpack(saved_for)` element-wise, but for nodes with many saved tensors
+  /// the up-front sweep keeps the version-counter loads together instead of
+  /// interleaving them with the refcount and autograd-meta traffic of
+  /// reconstruction.
+  static std::vector<Variable> unpack_list(
+      c10::ArrayRef<SavedVariable> saved,
+      const std::shared_ptr<Node>& saved_for = nullptr);
+
   void register_hooks(std::unique_ptr<SavedVariableHooks>&& hooks);
 
   void reset_data();
@@ -111,6 +123,8 @@ class TORCH_API SavedVariable {
   std::shared_ptr<Node> grad_accumulator_;
   bool requires_grad_ = false;
 
+  Variable unpack_impl(std::shared_ptr<Node> saved_for, bool need_version_check)
+      const;
   void save_metadata(const Variable& data);
   static std::unique_ptr<SavedVariableHooks> get_default_hooks();
   void set_hooks_and_pack_data(
@@ -267,6 +267,15 @@ void create_cpp_hook(const at::TensorBase& self, bool is_retains_grad_hook) {
   }
 }
 
+void convert_to_inference_tensors(at::TensorList tensors) {
+  for (const auto& tensor : tensors) {
+    if (!tensor.defined()) {
+      continue;
+    }
+    tensor.unsafeGetTensorImpl()->convert_to_inference_tensor();
+  }
+}
+
 void set_grad_accumulator(
     const Variable& self,
     std::weak_ptr<Node> grad_accumulator) {
@@ -191,6 +191,15 @@ TORCH_API std::unique_ptr<PostAccumulateGradHook>& post_acc_grad_hooks(
 TORCH_API void create_cpp_hook(
     const at::TensorBase&,
     bool is_retains_grad_hooks = false);
+
+/// Converts `tensors` in place into inference tensors, as if they had
+/// been created inside an InferenceMode region: autograd keys and
+/// metadata are dropped and the version counter is disabled, removing
+/// per-tensor autograd overhead for tensors that will only ever be used
+/// for inference. Throws if any tensor requires grad or shares its
+/// version counter (e.g. is saved for backward). Undefined tensors are
+/// skipped.
+TORCH_API void convert_to_inference_tensors(at::TensorList tensors);
 } // namespace impl
 
 //~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
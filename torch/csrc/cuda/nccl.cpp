@@ -944,41 +944,64 @@ void all2all(
   TORCH_INTERNAL_ASSERT(
       outputTensors.size() == inputTensors.size(),
       "number of input tensors is not equal to number of output tensors");
-  std::vector<size_t> sendCounts(inputTensors.size());
-  std::vector<size_t> sendDisps(inputTensors.size());
-  std::vector<size_t> recvCounts(outputTensors.size());
-  std::vector<size_t> recvDisps(outputTensors.size());
-  uintptr_t sendBase = reinterpret_cast<uintptr_t>(inputTensors[0].data_ptr());
-  uintptr_t recvBase = reinterpret_cast<uintptr_t>(outputTensors[0].data_ptr());
-  size_t dtypeSize = inputTensors.front().element_size();
 
+  // ncclAllToAllv takes a single send and a single recv buffer with per-rank
+  // displacements, which is only expressible when every tensor in each list
+  // aliases one allocation (e.g. the chunks of a flat buffer produced by
+  // torch.split, the common MoE dispatch layout). Displacements computed by
+  // subtracting pointers from different allocations would be garbage, so fall
+  // through to the grouped send/recv loop below for such inputs.
+  const void* sendStorage = inputTensors[0].storage().data();
+  const void* recvStorage = outputTensors[0].storage().data();
+  bool canUseAllToAllv = true;
   for (const auto r : c10::irange(outputTensors.size())) {
-    sendCounts[r] = inputTensors[r].numel();
-    auto sendOffset =
-        reinterpret_cast<uintptr_t>(inputTensors[r].data_ptr()) - sendBase;
-    TORCH_INTERNAL_ASSERT(
-        sendOffset % dtypeSize == 0,
-        "sendOffset is not divisible by dtypeSize");
-    sendDisps[r] = sendOffset / dtypeSize;
-    recvCounts[r] = outputTensors[r].numel();
-    auto recvOffset =
-        reinterpret_cast<uintptr_t>(outputTensors[r].data_ptr()) - recvBase;
-    TORCH_INTERNAL_ASSERT(
-        recvOffset % dtypeSize == 0,
-        "recvOffset is not divisible by dtypeSize");
-    recvDisps[r] = recvOffset / dtypeSize;
+    if (inputTensors[r].storage().data() != sendStorage ||
+        outputTensors[r].storage().data() != recvStorage) {
+      canUseAllToAllv = false;
+      break;
+    }
   }
-  NCCL_CHECK(ncclAllToAllv(
-      inputTensors[0].data_ptr(),
-      sendCounts.data(),
-      sendDisps.data(),
-      outputTensors[0].data_ptr(),
-      recvCounts.data(),
-      recvDisps.data(),
-      to_nccl_data_type(inputTensors.front()),
-      comm,
-      stream.stream()));
-#else
+
+  if (canUseAllToAllv) {
+    std::vector<size_t> sendCounts(inputTensors.size());
+    std::vector<size_t> sendDisps(inputTensors.size());
+    std::vector<size_t> recvCounts(outputTensors.size());
+    std::vector<size_t> recvDisps(outputTensors.size());
+    uintptr_t sendBase =
+        reinterpret_cast<uintptr_t>(inputTensors[0].data_ptr());
+    uintptr_t recvBase =
+        reinterpret_cast<uintptr_t>(outputTensors[0].data_ptr());
+    size_t dtypeSize = inputTensors.front().element_size();
+
+    for (const auto r : c10::irange(outputTensors.size())) {
+      sendCounts[r] = inputTensors[r].numel();
+      auto sendOffset =
+          reinterpret_cast<uintptr_t>(inputTensors[r].data_ptr()) - sendBase;
+      TORCH_INTERNAL_ASSERT(
+          sendOffset % dtypeSize == 0,
+          "sendOffset is not divisible by dtypeSize");
+      sendDisps[r] = sendOffset / dtypeSize;
+      recvCounts[r] = outputTensors[r].numel();
+      auto recvOffset =
+          reinterpret_cast<uintptr_t>(outputTensors[r].data_ptr()) - recvBase;
+      TORCH_INTERNAL_ASSERT(
+          recvOffset % dtypeSize == 0,
+          "recvOffset is not divisible by dtypeSize");
+      recvDisps[r] = recvOffset / dtypeSize;
+    }
+    NCCL_CHECK(ncclAllToAllv(
+        inputTensors[0].data_ptr(),
+        sendCounts.data(),
+        sendDisps.data(),
+        outputTensors[0].data_ptr(),
+        recvCounts.data(),
+        recvDisps.data(),
+        to_nccl_data_type(inputTensors.front()),
+        comm,
+        stream.stream()));
+    return;
+  }
+#endif
   NCCL_CHECK(ncclGroupStart());
   for (const auto r : c10::irange(outputTensors.size())) {
     at::Tensor& input = inputTensors[r];
@@ -1008,7 +1031,6 @@ void all2all(
 #else
   NCCL_CHECK_TIMEOUT(ncclGroupEnd(), _comm);
 #endif
-#endif
 #else
   TORCH_CHECK(false, "all2all is only supported for NCCL lib version >= 2.7.0");
 #endif
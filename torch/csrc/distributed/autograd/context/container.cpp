@@ -217,6 +217,23 @@ void DistAutogradContainer::releaseContext(int64_t context_id) {
 void DistAutogradContainer::sendReleaseContextRpc(
     const std::unordered_set<rpc::worker_id_t>& workerIds,
     int64_t context_id) {
+  // Enqueue the notification and flush, unless another thread is already
+  // flushing; in that case the flusher picks up this entry on its next drain,
+  // so concurrent releases coalesce into one RPC per worker.
+  {
+    std::lock_guard<std::mutex> guard(pending_cleanups_lock_);
+    for (const auto& worker_id : workerIds) {
+      pending_cleanups_[worker_id].push_back(context_id);
+    }
+    if (cleanup_in_flight_) {
+      return;
+    }
+    cleanup_in_flight_ = true;
+  }
+  flushPendingCleanups();
+}
+
+void DistAutogradContainer::flushPendingCleanups() {
   // Best-effort notification to other workers to clean up their Dist autograd
   // context, in order to reduce memory usage.
   // agent.send() or getCurrentRpcAgent may throw an error in the case of an
@@ -230,6 +247,9 @@ void DistAutogradContainer::sendReleaseContextRpc(
     LOG(INFO)
         << "Failed to send RPC to clear Dist Autograd context to all workers: "
         << e.what();
+    std::lock_guard<std::mutex> guard(pending_cleanups_lock_);
+    pending_cleanups_.clear();
+    cleanup_in_flight_ = false;
     return;
   }
 
@@ -237,28 +257,40 @@ void DistAutogradContainer::sendReleaseContextRpc(
 
   rpc::RpcRetryOptions options;
   options.maxRetries = kNumCleanupContextRetries;
-  for (const auto& worker_id : workerIds) {
-    try {
-      auto cleanupFuture = agent->sendWithRetries(
-          agent->getWorkerInfo(worker_id),
-          CleanupAutogradContextReq(context_id).toMessage(),
-          options);
-
-      cleanupFuture->addCallback([worker_id](rpc::JitFuture& future) {
-        if (future.hasError()) {
-          std::string errorMsg = c10::str(
-              "Could not release Dist Autograd Context on node ",
-              worker_id,
-              ": ",
-              future.tryRetrieveErrorMessage());
-          LOG(ERROR) << errorMsg;
-          return;
-        }
-      });
-    } catch (const std::exception& e) {
-      LOG(INFO)
-          << "Failed to send RPC to clear Dist Autograd context to worker id: "
-          << worker_id << " : " << e.what();
+  while (true) {
+    std::unordered_map<rpc::worker_id_t, std::vector<int64_t>> batch;
+    {
+      std::lock_guard<std::mutex> guard(pending_cleanups_lock_);
+      if (pending_cleanups_.empty()) {
+        cleanup_in_flight_ = false;
+        return;
+      }
+      batch.swap(pending_cleanups_);
+    }
+    for (auto& entry : batch) {
+      const auto worker_id = entry.first;
+      try {
+        auto cleanupFuture = agent->sendWithRetries(
+            agent->getWorkerInfo(worker_id),
+            CleanupAutogradContextReq(std::move(entry.second)).toMessage(),
+            options);
+
+        cleanupFuture->addCallback([worker_id](rpc::JitFuture& future) {
+          if (future.hasError()) {
+            std::string errorMsg = c10::str(
+                "Could not release Dist Autograd Context on node ",
+                worker_id,
+                ": ",
+                future.tryRetrieveErrorMessage());
+            LOG(ERROR) << errorMsg;
+            return;
+          }
+        });
+      } catch (const std::exception& e) {
+        LOG(INFO)
+            << "Failed to send RPC to clear Dist Autograd context to worker id: "
+            << worker_id << " : " << e.what();
+      }
     }
   }
 }
@@ -122,12 +122,20 @@ class TORCH_API DistAutogradContainer {
   // Retrieve the shard for given context_id.
   ContextsShard& getShard(int64_t context_id);
 
-  // Sends an RPC to the workers that have a context corresponding to passed in
-  // context_id. This function should be called with the lock.
+  // Enqueues a release notification for the passed in context_id to each of
+  // the workers and flushes the pending batch. If another thread is already
+  // flushing, the enqueued entries are picked up by that thread instead, so
+  // concurrent releases coalesce into one RPC per worker.
   void sendReleaseContextRpc(
       const std::unordered_set<rpc::worker_id_t>& workerIds,
       int64_t context_id);
 
+  // Drains pending_cleanups_ and sends one CleanupAutogradContextReq per
+  // worker covering all context ids accumulated for it, repeating until no
+  // pending entries remain. Must only be called by the thread that set
+  // cleanup_in_flight_.
+  void flushPendingCleanups();
+
   // Erase context_id from the autograd context map, and reset the thread local
   // current context id if it corresponds to the passed in context id. This
   // function should be called with the lock.
@@ -157,6 +165,16 @@ class TORCH_API DistAutogradContainer {
 
   // Maximum allowed value for autograd_context_id or autograd_message_id.
   int64_t max_id_;
+
+  // Lock guarding pending_cleanups_ and cleanup_in_flight_.
+  std::mutex pending_cleanups_lock_;
+
+  // Context-release notifications that have not been sent yet, keyed by the
+  // worker they are destined for.
+  std::unordered_map<rpc::worker_id_t, std::vector<int64_t>> pending_cleanups_;
+
+  // Whether a thread is currently flushing pending_cleanups_.
+  bool cleanup_in_flight_{false};
 };
 
 } // namespace torch::distributed::autograd
@@ -5,17 +5,21 @@
 namespace torch::distributed::autograd {
 
 CleanupAutogradContextReq::CleanupAutogradContextReq(int64_t context_id)
-    : context_id_(context_id){};
+    : context_ids_({context_id}){};
 
-int64_t CleanupAutogradContextReq::getContextId() {
-  return context_id_;
+CleanupAutogradContextReq::CleanupAutogradContextReq(
+    std::vector<int64_t> context_ids)
+    : context_ids_(std::move(context_ids)){};
+
+const std::vector<int64_t>& CleanupAutogradContextReq::getContextIds() {
+  return context_ids_;
 }
 
 c10::intrusive_ptr<rpc::Message> CleanupAutogradContextReq::toMessageImpl() && {
-  // pickle context_id using JIT pickler.
+  // pickle context ids using JIT pickler.
   std::vector<torch::Tensor> tensorTable;
   std::vector<char> payload =
-      jit::pickle(at::IValue(context_id_), &tensorTable);
+      jit::pickle(at::IValue(context_ids_), &tensorTable);
   return c10::make_intrusive<rpc::Message>(
       std::move(payload),
       std::move(tensorTable),
@@ -24,18 +28,23 @@ c10::intrusive_ptr<rpc::Message> CleanupAutogradContextReq::toMessageImpl() && {
 
 std::unique_ptr<CleanupAutogradContextReq> CleanupAutogradContextReq::
     fromMessage(const rpc::Message& message) {
-  // unpickle and get the context_id we need to clean up
+  // unpickle and get the context ids we need to clean up
   auto payload = static_cast<const char*>(message.payload().data());
   auto payload_size = message.payload().size();
-  IValue ivalue_context_id = jit::unpickle(
+  IValue ivalue_context_ids = jit::unpickle(
       payload,
       payload_size,
       *rpc::RpcAgent::getCurrentRpcAgent()->getTypeResolver(),
       message.tensors());
 
-  // convert ivalue to int and construct request
-  int64_t context_id = ivalue_context_id.toInt();
-  return std::make_unique<CleanupAutogradContextReq>(context_id);
+  // convert ivalue to ints and construct request. A plain int is accepted
+  // for compatibility with senders that serialize a single context id.
+  if (ivalue_context_ids.isInt()) {
+    return std::make_unique<CleanupAutogradContextReq>(
+        ivalue_context_ids.toInt());
+  }
+  return std::make_unique<CleanupAutogradContextReq>(
+      ivalue_context_ids.toIntVector());
 }
 
 } // namespace torch::distributed::autograd
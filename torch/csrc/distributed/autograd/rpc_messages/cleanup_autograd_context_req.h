@@ -6,20 +6,24 @@
 
 namespace torch::distributed::autograd {
 
-// Used to request other workers to clean up their autograd context.
+// Used to request other workers to clean up their autograd context. A single
+// message can carry multiple context ids, so bursts of context releases (e.g.
+// pipeline parallel training releasing one context per micro-batch) coalesce
+// into one RPC per worker.
 class TORCH_API CleanupAutogradContextReq : public rpc::RpcCommandBase {
  public:
   explicit CleanupAutogradContextReq(int64_t context_id);
+  explicit CleanupAutogradContextReq(std::vector<int64_t> context_ids);
   // Serialization and deserialization methods.
   c10::intrusive_ptr<rpc::Message> toMessageImpl() && override;
   static std::unique_ptr<CleanupAutogradContextReq> fromMessage(
       const rpc::Message& message);
 
-  // Retrieve the context id we are cleaning up with this message.
-  int64_t getContextId();
+  // Retrieve the context ids we are cleaning up with this message.
+  const std::vector<int64_t>& getContextIds();
 
  private:
-  int64_t context_id_;
+  std::vector<int64_t> context_ids_;
 };
 
 } // namespace torch::distributed::autograd
@@ -8,7 +8,9 @@
 #include <ATen/Functions.h>
 #include <ATen/NativeFunctions.h>
 #else
+#include <ATen/ops/empty.h>
 #include <ATen/ops/empty_like.h>
+#include <ATen/ops/mm.h>
 #endif
 
 #include <torch/library.h>
@@ -484,6 +486,63 @@ at::Tensor two_shot_all_reduce_(
   return input;
 }
 
+// Fused all-gather + matmul for tensor parallel inference. `a_shard` is this
+// rank's [m, k] shard of A in symmetric memory and `b` is a local [k, n]
+// matrix; the result is `all_gather(A) @ B` of shape [world_size * m, n].
+// Instead of materializing the all-gather output and running one large GEMM
+// afterwards, the GEMM for each peer's shard reads the peer buffer directly
+// through its P2P mapping, so remote rows are pulled over the fabric as the
+// GEMM consumes tiles and the transfer hides behind compute. Shards are
+// processed in ring order starting from the local one, which fans concurrent
+// ranks out across different sources instead of all draining one peer.
+at::Tensor allgather_matmul(
+    const at::Tensor& a_shard,
+    const at::Tensor& b,
+    std::string group_name) {
+  TORCH_CHECK(
+      a_shard.dim() == 2 && b.dim() == 2,
+      "allgather_matmul: expected both inputs to be 2D.");
+  TORCH_CHECK(
+      a_shard.is_contiguous(), "allgather_matmul: a_shard must be contiguous.");
+  TORCH_CHECK(
+      a_shard.size(1) == b.size(0),
+      "allgather_matmul: a_shard and b have incompatible shapes.");
+  TORCH_CHECK(
+      a_shard.scalar_type() == b.scalar_type(),
+      "allgather_matmul: a_shard and b must have the same dtype.");
+
+  auto symm_mem = c10d::symmetric_memory::rendezvous(a_shard);
+  TORCH_CHECK(
+      symm_mem != nullptr,
+      "allgather_matmul: a_shard must be allocated with empty_strided_p2p().");
+
+  const int rank = symm_mem->get_rank();
+  const int world_size = symm_mem->get_world_size();
+  const auto m = a_shard.size(0);
+
+  auto out = at::empty({world_size * m, b.size(1)}, a_shard.options());
+
+  // Make sure every rank's shard is fully written before peers pull from it.
+  symm_mem->barrier(0, 0);
+
+  for (int step = 0; step < world_size; ++step) {
+    const int src_rank = (rank + step) % world_size;
+    auto src_shard = src_rank == rank
+        ? a_shard
+        : symm_mem->get_buffer(
+              src_rank,
+              a_shard.sizes(),
+              a_shard.scalar_type(),
+              a_shard.storage_offset());
+    auto out_chunk = out.narrow(0, src_rank * m, m);
+    at::mm_out(out_chunk, src_shard, b);
+  }
+
+  // Hold each rank's shard in place until all peers have consumed it.
+  symm_mem->barrier(0, 0);
+  return out;
+}
+
 TORCH_LIBRARY_FRAGMENT(symm_mem, m) {
   m.def(
       "multimem_all_reduce_(Tensor(a!) input, str reduce_op, str group_name) -> Tensor(a!)",
@@ -522,6 +581,11 @@ TORCH_LIBRARY_FRAGMENT(symm_mem, m) {
       "two_shot_all_reduce_(Tensor(a!) input, str reduce_op, str group_name) -> Tensor(a!)",
       torch::dispatch(c10::DispatchKey::CUDA, ::two_shot_all_reduce_),
       {at::Tag::pt2_compliant_tag});
+
+  m.def(
+      "allgather_matmul(Tensor a_shard, Tensor b, str group_name) -> Tensor",
+      torch::dispatch(c10::DispatchKey::CUDA, ::allgather_matmul),
+      {at::Tag::pt2_compliant_tag});
 }
 
 } // namespace
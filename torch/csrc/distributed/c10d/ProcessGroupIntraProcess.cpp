@@ -0,0 +1,274 @@
+#include <torch/csrc/distributed/c10d/ProcessGroupIntraProcess.hpp>
+
+#include <condition_variable>
+#include <mutex>
+#include <unordered_map>
+
+#include <ATen/Functions.h>
+#include <c10/util/Exception.h>
+#include <c10/util/irange.h>
+
+namespace c10d {
+
+namespace {
+
+// All collectives complete synchronously on the calling thread before a
+// Work is returned, so the Work only has to report completion.
+class IntraProcessWork : public Work {
+ public:
+  IntraProcessWork(int rank, OpType opType) : Work(rank, opType) {}
+
+  bool isCompleted() override {
+    return true;
+  }
+
+  bool isSuccess() const override {
+    return true;
+  }
+
+  bool wait(std::chrono::milliseconds /* timeout */) override {
+    return true;
+  }
+
+  c10::intrusive_ptr<c10::ivalue::Future> getFuture() override {
+    auto fut = c10::make_intrusive<c10::ivalue::Future>(c10::NoneType::get());
+    fut->markCompleted();
+    return fut;
+  }
+};
+
+at::Tensor& checkSingleTensor(std::vector<at::Tensor>& tensors) {
+  TORCH_CHECK(
+      tensors.size() == 1,
+      "The intra-process backend supports a single tensor per rank, got ",
+      tensors.size());
+  auto& tensor = tensors[0];
+  TORCH_CHECK(
+      tensor.device().is_cpu(),
+      "The intra-process backend only supports CPU tensors");
+  TORCH_CHECK(
+      tensor.layout() == at::kStrided && !tensor.is_sparse(),
+      "The intra-process backend only supports dense tensors");
+  return tensor;
+}
+
+// Folds `src` into `dst` in place with the vectorized CPU kernels; this
+// is the per-edge operation of the reduction tree.
+void combine(at::Tensor& dst, const at::Tensor& src, const ReduceOp& op) {
+  switch (op) {
+    // AVG is a SUM whose result gets divided by the world size afterward.
+    case ReduceOp::SUM:
+    case ReduceOp::AVG:
+      dst.add_(src);
+      break;
+    case ReduceOp::PRODUCT:
+      dst.mul_(src);
+      break;
+    case ReduceOp::MIN:
+      at::minimum_out(dst, dst, src);
+      break;
+    case ReduceOp::MAX:
+      at::maximum_out(dst, dst, src);
+      break;
+    case ReduceOp::BAND:
+      dst.bitwise_and_(src);
+      break;
+    case ReduceOp::BOR:
+      dst.bitwise_or_(src);
+      break;
+    case ReduceOp::BXOR:
+      dst.bitwise_xor_(src);
+      break;
+    default:
+      TORCH_CHECK(
+          false, "Unsupported reduce op for the intra-process backend");
+  }
+}
+
+} // namespace
+
+// Shared between every rank's handle of the same group. The barrier's
+// mutex is what publishes one rank's tensor writes to the others: a
+// rank's stores precede its barrier entry, and peers only read the
+// published pointers after leaving the same barrier.
+struct ProcessGroupIntraProcess::SharedState {
+  explicit SharedState(int size) : size(size), slots(size, nullptr) {}
+
+  const int size;
+  std::mutex mutex;
+  std::condition_variable cv;
+  int arrived{0};
+  uint64_t generation{0};
+  // Per-rank tensor pointers for the collective in flight.
+  std::vector<at::Tensor*> slots;
+
+  // Blocks until all `size` ranks have entered.
+  void barrier() {
+    std::unique_lock<std::mutex> lock(mutex);
+    const auto gen = generation;
+    if (++arrived == size) {
+      arrived = 0;
+      ++generation;
+      cv.notify_all();
+    } else {
+      cv.wait(lock, [&] { return generation != gen; });
+    }
+  }
+};
+
+std::shared_ptr<ProcessGroupIntraProcess::SharedState> ProcessGroupIntraProcess::
+    attachToGroup(const std::string& groupName, int size) {
+  static std::mutex registryMutex;
+  static std::unordered_map<
+      std::string,
+      std::weak_ptr<ProcessGroupIntraProcess::SharedState>>
+      registry;
+
+  std::lock_guard<std::mutex> lock(registryMutex);
+  auto& entry = registry[groupName];
+  auto state = entry.lock();
+  if (state == nullptr) {
+    state = std::make_shared<ProcessGroupIntraProcess::SharedState>(size);
+    entry = state;
+    return state;
+  }
+  TORCH_CHECK(
+      state->size == size,
+      "Intra-process group '",
+      groupName,
+      "' already exists with size ",
+      state->size,
+      ", but this rank was constructed with size ",
+      size);
+  return state;
+}
+
+ProcessGroupIntraProcess::ProcessGroupIntraProcess(
+    int rank,
+    int size,
+    const std::string& groupName)
+    : Backend(rank, size), state_(attachToGroup(groupName, size)) {
+  TORCH_CHECK(
+      rank >= 0 && rank < size,
+      "Invalid rank ",
+      rank,
+      " for intra-process group of size ",
+      size);
+}
+
+ProcessGroupIntraProcess::~ProcessGroupIntraProcess() = default;
+
+c10::intrusive_ptr<Work> ProcessGroupIntraProcess::broadcast(
+    std::vector<at::Tensor>& tensors,
+    const BroadcastOptions& opts) {
+  auto& tensor = checkSingleTensor(tensors);
+  const auto root = static_cast<int>(opts.rootRank);
+  TORCH_CHECK(root >= 0 && root < size_, "Invalid root rank ", root);
+  state_->slots[rank_] = &tensor;
+  state_->barrier();
+  if (rank_ != root) {
+    tensor.copy_(*state_->slots[root]);
+  }
+  // The root may not reuse its buffer until every rank has copied it.
+  state_->barrier();
+  return c10::make_intrusive<IntraProcessWork>(rank_, OpType::BROADCAST);
+}
+
+c10::intrusive_ptr<Work> ProcessGroupIntraProcess::allreduce(
+    std::vector<at::Tensor>& tensors,
+    const AllreduceOptions& opts) {
+  auto& tensor = checkSingleTensor(tensors);
+  state_->slots[rank_] = &tensor;
+  state_->barrier();
+  // Binomial reduction tree: at each level the even "stride groups" fold
+  // their partner's buffer into their own, so the folds within a level
+  // run concurrently on disjoint buffers and rank 0 ends up with the
+  // full reduction after ceil(log2(size)) levels.
+  for (int stride = 1; stride < size_; stride *= 2) {
+    if (rank_ % (2 * stride) == 0 && rank_ + stride < size_) {
+      combine(tensor, *state_->slots[rank_ + stride], opts.reduceOp);
+    }
+    state_->barrier();
+  }
+  if (opts.reduceOp == ReduceOp::AVG) {
+    if (rank_ == 0) {
+      tensor.div_(size_);
+    }
+    state_->barrier();
+  }
+  if (rank_ != 0) {
+    tensor.copy_(*state_->slots[0]);
+  }
+  // Rank 0 may not reuse its buffer until every rank has copied it.
+  state_->barrier();
+  return c10::make_intrusive<IntraProcessWork>(rank_, OpType::ALLREDUCE);
+}
+
+c10::intrusive_ptr<Work> ProcessGroupIntraProcess::reduce(
+    std::vector<at::Tensor>& tensors,
+    const ReduceOptions& opts) {
+  auto& tensor = checkSingleTensor(tensors);
+  const auto root = static_cast<int>(opts.rootRank);
+  TORCH_CHECK(root >= 0 && root < size_, "Invalid root rank ", root);
+  state_->slots[rank_] = &tensor;
+  state_->barrier();
+  // Unlike allreduce, the non-root inputs must not be clobbered, so the
+  // root folds every peer's buffer into its own instead of reducing over
+  // a tree of in-place updates.
+  if (rank_ == root) {
+    for (const auto r : c10::irange(size_)) {
+      if (r != root) {
+        combine(tensor, *state_->slots[r], opts.reduceOp);
+      }
+    }
+    if (opts.reduceOp == ReduceOp::AVG) {
+      tensor.div_(size_);
+    }
+  }
+  state_->barrier();
+  return c10::make_intrusive<IntraProcessWork>(rank_, OpType::REDUCE);
+}
+
+c10::intrusive_ptr<Work> ProcessGroupIntraProcess::allgather(
+    std::vector<std::vector<at::Tensor>>& outputTensors,
+    std::vector<at::Tensor>& inputTensors,
+    const AllgatherOptions& /* opts */) {
+  auto& input = checkSingleTensor(inputTensors);
+  TORCH_CHECK(
+      outputTensors.size() == 1 &&
+          outputTensors[0].size() == static_cast<size_t>(size_),
+      "allgather expects one output tensor per rank");
+  state_->slots[rank_] = &input;
+  state_->barrier();
+  for (const auto r : c10::irange(size_)) {
+    outputTensors[0][r].copy_(*state_->slots[r]);
+  }
+  state_->barrier();
+  return c10::make_intrusive<IntraProcessWork>(rank_, OpType::ALLGATHER);
+}
+
+c10::intrusive_ptr<Work> ProcessGroupIntraProcess::_allgather_base(
+    at::Tensor& outputBuffer,
+    at::Tensor& inputBuffer,
+    const AllgatherOptions& /* opts */) {
+  TORCH_CHECK(
+      outputBuffer.numel() == inputBuffer.numel() * size_,
+      "output buffer must hold one input worth of elements per rank");
+  state_->slots[rank_] = &inputBuffer;
+  state_->barrier();
+  auto chunks = outputBuffer.chunk(size_);
+  for (const auto r : c10::irange(size_)) {
+    chunks[r].copy_(*state_->slots[r]);
+  }
+  state_->barrier();
+  return c10::make_intrusive<IntraProcessWork>(
+      rank_, OpType::_ALLGATHER_BASE);
+}
+
+c10::intrusive_ptr<Work> ProcessGroupIntraProcess::barrier(
+    const BarrierOptions& /* opts */) {
+  state_->barrier();
+  return c10::make_intrusive<IntraProcessWork>(rank_, OpType::BARRIER);
+}
+
+} // namespace c10d
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <torch/csrc/distributed/c10d/Backend.hpp>
+
+namespace c10d {
+
+constexpr const char* INTRA_PROCESS_BACKEND_NAME = "intra-process";
+
+// ProcessGroupIntraProcess is a CPU backend for the thread-per-rank
+// deployment model: all ranks are threads of a single process, typically
+// one replica per thread in data-parallel inference. Collectives pass
+// tensor pointers through shared state instead of going through a
+// transport, so an allreduce is a parallel tree of vectorized in-place
+// reductions over the ranks' own buffers followed by a broadcast copy —
+// i.e. it runs at memcpy speed rather than localhost TCP speed.
+//
+// Ranks attach to each other by constructing the group with the same
+// group name and size; the shared state is created by the first rank to
+// arrive and torn down when the last handle goes away. Collectives are
+// synchronous (the returned Work is already completed) and block the
+// calling thread until every rank of the group has entered the same
+// collective, so all ranks must issue collectives in the same order,
+// exactly as with the inter-process backends.
+//
+// Only CPU tensors and single-tensor-per-rank collectives are supported.
+class TORCH_API ProcessGroupIntraProcess : public Backend {
+ public:
+  ProcessGroupIntraProcess(int rank, int size, const std::string& groupName);
+
+  ~ProcessGroupIntraProcess() override;
+
+  const std::string getBackendName() const override {
+    return INTRA_PROCESS_BACKEND_NAME;
+  }
+
+  c10::intrusive_ptr<Work> broadcast(
+      std::vector<at::Tensor>& tensors,
+      const BroadcastOptions& opts = BroadcastOptions()) override;
+
+  c10::intrusive_ptr<Work> allreduce(
+      std::vector<at::Tensor>& tensors,
+      const AllreduceOptions& opts = AllreduceOptions()) override;
+
+  c10::intrusive_ptr<Work> reduce(
+      std::vector<at::Tensor>& tensors,
+      const ReduceOptions& opts = ReduceOptions()) override;
+
+  c10::intrusive_ptr<Work> allgather(
+      std::vector<std::vector<at::Tensor>>& outputTensors,
+      std::vector<at::Tensor>& inputTensors,
+      const AllgatherOptions& opts = AllgatherOptions()) override;
+
+  c10::intrusive_ptr<Work> _allgather_base(
+      at::Tensor& outputBuffer,
+      at::Tensor& inputBuffer,
+      const AllgatherOptions& opts = AllgatherOptions()) override;
+
+  c10::intrusive_ptr<Work> barrier(
+      const BarrierOptions& opts = BarrierOptions()) override;
+
+ private:
+  struct SharedState;
+
+  // Creates or joins the shared state of the group with this name; the
+  // state lives as long as any rank holds a handle to the group.
+  static std::shared_ptr<SharedState> attachToGroup(
+      const std::string& groupName,
+      int size);
+
+  std::shared_ptr<SharedState> state_;
+};
+
+} // namespace c10d
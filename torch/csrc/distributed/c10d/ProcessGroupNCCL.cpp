@@ -1,12 +1,15 @@
 #ifdef USE_C10D_NCCL
 
 #include <dlfcn.h>
+#include <algorithm>
 #include <exception>
+#include <limits>
 #include <map>
 #include <mutex>
 #include <sstream>
 #include <stdexcept>
 #include <tuple>
+#include <unordered_set>
 #include <utility>
 
 #include <ATen/cuda/CUDAContext.h>
@@ -572,6 +575,8 @@ ProcessGroupNCCL::WorkNCCL::WorkNCCL(const WorkNCCL& w)
       numelOut_(w.numelOut_),
       store_(w.store_),
       futureWorkResult_(w.futureWorkResult_),
+      gpuExecutionStarted_(w.gpuExecutionStarted_.load()),
+      gpuExecutionFinished_(w.gpuExecutionFinished_.load()),
       timingEnabled_(w.timingEnabled_),
       trace_id_(w.trace_id_),
       distDebugLevel_(w.distDebugLevel_) {
@@ -636,14 +641,26 @@ bool ProcessGroupNCCL::WorkNCCL::startedGPUExecutionInternal() const {
   if (!timingEnabled_) {
     return false;
   }
+  // A recorded CUDA event stays completed once it completes, so a successful
+  // query never needs to be repeated. The watchdog polls each in-flight work
+  // several times per pass, so caching the result keeps the cudaEventQuery
+  // traffic proportional to the number of works that actually change state.
+  if (gpuExecutionStarted_.load(std::memory_order_relaxed)) {
+    return true;
+  }
   // Checking the work's corresponding CUDA event's status
   if (!ncclStartEvent_->query()) {
     return false;
   }
+  gpuExecutionStarted_.store(true, std::memory_order_relaxed);
   return true;
 }
 
 bool ProcessGroupNCCL::WorkNCCL::finishedGPUExecutionInternal() const {
+  // See startedGPUExecutionInternal for why a successful query is cached.
+  if (gpuExecutionFinished_.load(std::memory_order_relaxed)) {
+    return true;
+  }
   // Checking the work's corresponding CUDA event's status
   // It calls `cudaEventQuery` eventually. Although this seems to be a
   // non-blocking call, but we did notice hangs in the past. It can
@@ -653,6 +670,7 @@ bool ProcessGroupNCCL::WorkNCCL::finishedGPUExecutionInternal() const {
   if (!ncclEndEvent_->query()) {
     return false;
   }
+  gpuExecutionFinished_.store(true, std::memory_order_relaxed);
   return true;
 }
 
@@ -930,6 +948,10 @@ ProcessGroupNCCL::ProcessGroupNCCL(
       getCvarBool(TORCH_NCCL_ENABLE_TIMING, false) || desyncDebug_);
 #endif
   avoidRecordStreams_ = getCvarBool(TORCH_NCCL_AVOID_RECORD_STREAMS, false);
+  hierarchicalAllreduceThreshold_ = static_cast<size_t>(std::max(
+      getCvarInt(TORCH_NCCL_HIERARCHICAL_ALLREDUCE_THRESHOLD, 0), 0));
+  hierarchicalAllreduceLocalSize_ = std::max(
+      getCvarInt(TORCH_NCCL_HIERARCHICAL_ALLREDUCE_LOCAL_SIZE, 0), 0);
 #ifdef NCCL_HAS_COMM_REGISTER
   useTensorRegisterAllocatorHook_ =
       getCvarBool(TORCH_NCCL_USE_TENSOR_REGISTER_ALLOCATOR_HOOK, false);
@@ -1080,6 +1102,107 @@ void ProcessGroupNCCL::performNocolorSplit(at::Device device) {
 #endif
 }
 
+c10::intrusive_ptr<ProcessGroupNCCL> ProcessGroupNCCL::shrinkToSurvivors(
+    at::Device device,
+    const std::vector<int>& survivingRanks) {
+#ifdef NCCL_HAS_COMM_SPLIT
+  TORCH_CHECK_WITH(
+      DistBackendError,
+      !survivingRanks.empty(),
+      "shrinkToSurvivors requires a non-empty set of surviving ranks");
+  std::vector<int> survivors = survivingRanks;
+  std::sort(survivors.begin(), survivors.end());
+  TORCH_CHECK_WITH(
+      DistBackendError,
+      std::adjacent_find(survivors.begin(), survivors.end()) ==
+          survivors.end(),
+      "surviving ranks must not contain duplicates");
+  TORCH_CHECK_WITH(
+      DistBackendError,
+      survivors.front() >= 0 && survivors.back() < size_,
+      "surviving ranks must be ranks of this process group");
+
+  const auto incarnation = ++shrinkCounter_;
+
+  const auto myIt = std::find(survivors.begin(), survivors.end(), rank_);
+  if (myIt == survivors.end()) {
+    // Departing ranks only participate in the collective split so that
+    // the survivors' split can complete; they get no new communicator.
+    performNocolorSplit(device);
+    return nullptr;
+  }
+  const int newRank = static_cast<int>(myIt - survivors.begin());
+  const int newSize = static_cast<int>(survivors.size());
+
+  // Map the surviving group ranks to global ranks before handing them to
+  // the split. groupRanks() is the identity for the default group.
+  std::vector<uint64_t> survivingGlobalRanks;
+  survivingGlobalRanks.reserve(survivors.size());
+  for (const auto r : survivors) {
+    survivingGlobalRanks.push_back(groupRanks()[r]);
+  }
+
+  // Every survivor must pass the same non-negative color to
+  // ncclCommSplit; derive one deterministically from the membership so
+  // no extra agreement round is needed.
+  int color = 0;
+  for (const auto r : survivors) {
+    color = static_cast<int>(
+        (static_cast<int64_t>(color) * 31 + r) % std::numeric_limits<int>::max());
+  }
+
+  // Persist the surviving membership so a later rendezvous (e.g. one
+  // re-admitting a replacement rank) can discover which incarnation of
+  // the group it is joining instead of assuming the original world.
+  if (newRank == 0) {
+    std::ostringstream members;
+    for (const auto i : c10::irange(survivingGlobalRanks.size())) {
+      if (i > 0) {
+        members << ',';
+      }
+      members << survivingGlobalRanks[i];
+    }
+    const auto membersStr = members.str();
+    store_->set(
+        c10::str("shrink_incarnation:", incarnation),
+        std::vector<uint8_t>(membersStr.begin(), membersStr.end()));
+  }
+
+  auto options = Options::create(options_->is_high_priority_stream);
+  options->timeout = options_->timeout;
+#ifdef NCCL_HAS_COMM_NONBLOCKING
+  options->config = options_->config;
+#endif
+  options->split_color = color;
+  options->global_ranks_in_group = std::move(survivingGlobalRanks);
+  options->group_name =
+      c10::str(options_->group_name, ":shrink:", incarnation);
+  // The parent's communicator map is only consulted during the eager
+  // connect below, while `this` is guaranteed alive, so a non-owning
+  // alias avoids an ownership cycle between the two groups.
+  options->split_from =
+      std::shared_ptr<ProcessGroupNCCL>(this, [](ProcessGroupNCCL*) {});
+
+  auto prefixStore = c10::make_intrusive<PrefixStore>(
+      c10::str("shrink:", incarnation, "/"), store_);
+  auto pg = c10::make_intrusive<ProcessGroupNCCL>(
+      prefixStore, newRank, newSize, std::move(options));
+  LOG(INFO) << logPrefix() << "Shrinking to " << newSize
+            << " surviving ranks (incarnation " << incarnation
+            << ") by splitting the established communicator";
+  // Trigger the split eagerly; together with the departing ranks'
+  // nocolor split above this completes the collective over the parent
+  // communicator, reusing its established transport state instead of a
+  // fresh bootstrap.
+  pg->eagerConnectSingleDevice(device);
+  return pg;
+#else
+  C10_THROW_ERROR(
+      DistBackendError,
+      "shrinkToSurvivors requires a NCCL version with ncclCommSplit support");
+#endif
+}
+
 c10::intrusive_ptr<intra_node_comm::IntraNodeComm> ProcessGroupNCCL::
     initIntraNodeComm() {
   using IntraNodeComm = intra_node_comm::IntraNodeComm;
@@ -1160,6 +1283,15 @@ void ProcessGroupNCCL::enableCollectivesTiming() {
   enableTiming_.store(true);
 }
 
+std::vector<CollectiveStats> ProcessGroupNCCL::drainCollectiveStats() {
+  std::vector<CollectiveStats> stats;
+  CollectiveStats record;
+  while (collectiveStatsRing_.pop(record)) {
+    stats.push_back(record);
+  }
+  return stats;
+}
+
 void ProcessGroupNCCL::waitForFutureOrTimeout(
     std::future<bool>& fut,
     const std::chrono::milliseconds& timeOutMilSec,
@@ -1861,6 +1993,15 @@ void ProcessGroupNCCL::watchdogHandler() {
       lastStatusUpdateTime = std::chrono::steady_clock::now();
     }
 
+    // Devices on which this pass has already seen an unfinished work. Works
+    // behind it on the same device were enqueued later, so in the common
+    // single-stream-per-device case their end events cannot have completed
+    // yet either; skipping their queries retires the completed prefix of the
+    // list in one batch and keeps the cudaEventQuery traffic (and the time
+    // workMetaListMutex_ is held) proportional to the number of works that
+    // finished since the last pass rather than to the backlog length. A work
+    // conservatively skipped here is simply retired on a later pass.
+    std::unordered_set<c10::DeviceIndex> devicesWithUnfinishedWork;
     for (auto it = workMetaList_.begin(); it != workMetaList_.end();
          /* no increment */) {
       auto& work = *it;
@@ -1984,8 +2125,15 @@ void ProcessGroupNCCL::watchdogHandler() {
         pgStatus_->lastStartedWorkName = opTypeToString(work.opType_);
       }
 
-      // Clean up completed work
-      if (work.isCompleted()) {
+      // Clean up completed work. Works with an exception are always
+      // retirable; otherwise only query the end event when no earlier work
+      // on the same device is still unfinished.
+      bool workCompleted = work.exception() != nullptr;
+      if (!workCompleted &&
+          devicesWithUnfinishedWork.count(work.device_.index()) == 0) {
+        workCompleted = work.isCompleted();
+      }
+      if (workCompleted) {
         if (work.futureWorkResult_ && work.finishedGPUExecutionInternal() &&
             !work.futureWorkResult_->completed()) {
           work.futureWorkResult_->markCompleted(
@@ -2003,6 +2151,22 @@ void ProcessGroupNCCL::watchdogHandler() {
         pgStatus_->lastCompletedWorkName = opTypeToString(work.opType_);
         pgStatus_->lastCompletedNumelIn = work.numelIn_;
         pgStatus_->lastCompletedNumelOut = work.numelOut_;
+        // Publish the retired work to the stats mailbox for metrics
+        // consumers. push() never blocks and drops the record if nobody
+        // drains the ring.
+        CollectiveStats stats;
+        stats.seq = work.seq_;
+        stats.opType = work.opType_;
+        stats.numelIn = work.numelIn_;
+        stats.numelOut = work.numelOut_;
+        stats.enqueueTimeNs =
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                work.workStartTime_.time_since_epoch())
+                .count();
+        if (work.timingEnabled_) {
+          stats.durationMs = work.getDuration();
+        }
+        collectiveStatsRing_.push(stats);
         NCCLTraceBuffer::get()->retire_id(work.trace_id_, true);
         if (onCompletionHook_) {
           // Move Work object to completedWorkList_ to be consumed by the hook
@@ -2019,6 +2183,7 @@ void ProcessGroupNCCL::watchdogHandler() {
         }
         at::cuda::CUDAGraph::dec_pending_event_queries();
       } else {
+        devicesWithUnfinishedWork.insert(work.device_.index());
         // Increment the iterator if the current WorkNCCL object is not
         // completed.
         ++it;
@@ -3550,6 +3715,156 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce_sparse(
 #endif
 }
 
+/* Note [Hierarchical allreduce]
+ *
+ * On multi-rail nodes a flat ring allreduce leaves NIC bandwidth on the
+ * table: every rank's traffic funnels through whichever rails the flat ring
+ * happens to cross. For buckets above
+ * TORCH_NCCL_HIERARCHICAL_ALLREDUCE_THRESHOLD bytes we instead run
+ *
+ *   1. reduce-scatter over the node-local communicator (NVLink/PCIe only),
+ *   2. allreduce of each rank's shard over its rail communicator (the ranks
+ *      with the same local rank on every node), putting all rails to work
+ *      in parallel,
+ *   3. all-gather over the node-local communicator.
+ *
+ * All three steps run in-place on the bucket: NCCL's in-place convention
+ * for reduce-scatter/all-gather (recv/send buffer at rank * count) means no
+ * scratch memory is needed. The two extra communicators are split lazily
+ * from the main communicator on first use; since every rank takes the
+ * hierarchical path for the same buckets, the splits are collective.
+ *
+ * The schedule assumes ranks are node-contiguous (node = rank / local_size),
+ * which is how torchrun and friends lay ranks out. Local size defaults to
+ * the visible device count and can be overridden with
+ * TORCH_NCCL_HIERARCHICAL_ALLREDUCE_LOCAL_SIZE. PREMUL_SUM is excluded
+ * because its scale would be applied once per stage; AVG composes correctly
+ * (the per-communicator divisions multiply out to the world size).
+ */
+int ProcessGroupNCCL::hierarchicalLocalSize() const {
+  return hierarchicalAllreduceLocalSize_ > 0 ? hierarchicalAllreduceLocalSize_
+                                             : localDeviceCount_;
+}
+
+bool ProcessGroupNCCL::shouldUseHierarchicalAllreduce(
+    const at::Tensor& tensor,
+    const AllreduceOptions& opts) const {
+#ifdef NCCL_HAS_COMM_SPLIT
+  if (hierarchicalAllreduceThreshold_ == 0) {
+    return false;
+  }
+  // The three sub-collectives are issued back to back and checked
+  // individually, which relies on blocking communicators.
+  if (nccl_use_nonblocking()) {
+    return false;
+  }
+  const int localSize = hierarchicalLocalSize();
+  if (localSize <= 1 || size_ <= localSize || size_ % localSize != 0) {
+    return false;
+  }
+  // In-place sharding needs equal shards on every local rank.
+  if (tensor.numel() % localSize != 0) {
+    return false;
+  }
+  if (opts.reduceOp == ReduceOp::PREMUL_SUM) {
+    return false;
+  }
+  return static_cast<size_t>(tensor.nbytes()) >=
+      hierarchicalAllreduceThreshold_;
+#else
+  return false;
+#endif
+}
+
+void ProcessGroupNCCL::initHierarchicalComms(at::Device device) {
+#ifdef NCCL_HAS_COMM_SPLIT
+  if (hierIntraNodeComm_ != nullptr) {
+    return;
+  }
+  const auto key = getKeyFromDevice(device);
+  auto parentComm = getNCCLComm(key, device, OpType::ALLREDUCE);
+  const int localSize = hierarchicalLocalSize();
+  const int nodeIdx = rank_ / localSize;
+  const int localRank = rank_ % localSize;
+  LOG(INFO) << logPrefix()
+            << "Splitting hierarchical allreduce communicators from "
+            << parentComm->repr() << " with local size " << localSize;
+  // Node-local communicator: all ranks on this node, colored by node.
+  hierIntraNodeComm_ = NCCLComm::split(
+      parentComm.get(),
+      nodeIdx,
+      localRank,
+      options_->config,
+      options_->global_ranks_in_group);
+  // Rail communicator: same local rank on every node, colored by local rank.
+  hierRailComm_ = NCCLComm::split(
+      parentComm.get(),
+      localRank,
+      nodeIdx,
+      options_->config,
+      options_->global_ranks_in_group);
+#endif
+}
+
+c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce_hierarchical(
+    at::Tensor& tensor,
+    const AllreduceOptions& opts) {
+  initHierarchicalComms(tensor.device());
+  const int localSize = hierarchicalLocalSize();
+  const int localRank = rank_ % localSize;
+  return collective(
+      tensor,
+      tensor,
+      [&, localSize, localRank](
+          at::Tensor& input,
+          at::Tensor& output,
+          ncclComm_t comm,
+          at::cuda::CUDAStream& stream) {
+        auto ncclDataType = getNcclDataType(input.scalar_type());
+        auto ncclReduceOp =
+            getNcclReduceOp(opts.reduceOp, input, ncclDataType, comm);
+        ncclComm_t intraComm = hierIntraNodeComm_->getNcclComm();
+        ncclComm_t railComm = hierRailComm_->getNcclComm();
+        const size_t shardNumel = input.numel() / localSize;
+        auto* shardPtr = static_cast<char*>(output.data_ptr()) +
+            static_cast<size_t>(localRank) * shardNumel *
+                input.element_size();
+        // See Note [Hierarchical allreduce]. The three calls are
+        // stream-ordered, so each stage sees the previous one's result.
+        auto result = ncclReduceScatter(
+            input.data_ptr(),
+            shardPtr,
+            shardNumel,
+            ncclDataType,
+            ncclReduceOp,
+            intraComm,
+            stream.stream());
+        if (result != ncclSuccess) {
+          return result;
+        }
+        result = ncclAllReduce(
+            shardPtr,
+            shardPtr,
+            shardNumel,
+            ncclDataType,
+            ncclReduceOp,
+            railComm,
+            stream.stream());
+        if (result != ncclSuccess) {
+          return result;
+        }
+        return ncclAllGather(
+            shardPtr,
+            output.data_ptr(),
+            shardNumel,
+            ncclDataType,
+            intraComm,
+            stream.stream());
+      },
+      OpType::ALLREDUCE,
+      "nccl:hierarchical_all_reduce");
+}
+
 c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce_impl(
     at::Tensor& tensor,
     const AllreduceOptions& opts) {
@@ -3621,6 +3936,11 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::allreduce(
       globalRankStride, // globalRankStride
       this->getSize()); // worldSize
 
+  if (shouldUseHierarchicalAllreduce(tensor, opts)) {
+    // See Note [Hierarchical allreduce]
+    return allreduce_hierarchical(tensor, opts);
+  }
+
   // avoidRecordStreams_ note: collective() will stash tensors.
   return allreduce_impl(tensor, opts);
 }
@@ -4430,6 +4750,10 @@ c10::intrusive_ptr<Work> ProcessGroupNCCL::alltoall_base(
             c10::cuda::CUDACachingAllocator::recordStream(
                 output.storage().data_ptr(), stream);
           }
+          // Uneven splits are communicated in place: every split is sent
+          // from / received at its offset into the flat input/output tensor
+          // within a single NCCL group (or one ncclAllToAllv call), so no
+          // staging copies or pack/unpack kernels are launched here.
           torch::cuda::nccl::all2all_single_unequal_split(
               input.data_ptr(),
               send_lengths.data(),
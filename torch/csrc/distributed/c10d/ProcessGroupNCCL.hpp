@@ -9,6 +9,7 @@
 #include <unistd.h>
 #endif
 
+#include <array>
 #include <atomic>
 #include <chrono>
 #include <deque>
@@ -177,6 +178,18 @@ static std::vector<std::string> TORCH_NCCL_USE_TENSOR_REGISTER_ALLOCATOR_HOOK =
     {"TORCH_NCCL_USE_TENSOR_REGISTER_ALLOCATOR_HOOK",
      "NCCL_USE_TENSOR_REGISTER_ALLOCATOR_HOOK"};
 
+// If set to a positive byte count, allreduces at least that large are run as
+// an intra-node reduce-scatter, an inter-node allreduce over per-rail
+// communicators, and an intra-node all-gather instead of one flat NCCL
+// allreduce. See Note [Hierarchical allreduce] in ProcessGroupNCCL.cpp.
+static std::vector<std::string> TORCH_NCCL_HIERARCHICAL_ALLREDUCE_THRESHOLD = {
+    "TORCH_NCCL_HIERARCHICAL_ALLREDUCE_THRESHOLD"};
+
+// Number of ranks per node for the hierarchical allreduce schedule. Defaults
+// to the number of visible CUDA devices when unset or 0.
+static std::vector<std::string> TORCH_NCCL_HIERARCHICAL_ALLREDUCE_LOCAL_SIZE =
+    {"TORCH_NCCL_HIERARCHICAL_ALLREDUCE_LOCAL_SIZE"};
+
 #if defined(__linux__)
 struct DumpPipe {
   DumpPipe(int rank) {
@@ -253,6 +266,56 @@ struct DumpPipe {
 // provided by ProcessGroupNCCL to check if the NCCL operation of WorkNCCL has
 // finished execution on the GPU (not just scheduled).
 //
+// One retired collective, as published by the watchdog thread for external
+// metrics consumers. The duration is measured with the work's CUDA events and
+// is only available when timing is enabled (TORCH_NCCL_ENABLE_TIMING or
+// desync debug); otherwise durationMs stays negative.
+struct CollectiveStats {
+  uint64_t seq{0};
+  OpType opType{OpType::UNKNOWN};
+  size_t numelIn{0};
+  size_t numelOut{0};
+  // steady-clock time at which the collective was enqueued, in nanoseconds
+  int64_t enqueueTimeNs{0};
+  // GPU execution time in milliseconds, or -1 when timing is disabled
+  float durationMs{-1.0f};
+};
+
+// Fixed-capacity single-producer single-consumer ring holding the most
+// recently retired collectives. The watchdog thread is the only producer and
+// a metrics thread the only consumer, so both sides are wait-free and neither
+// takes a lock (or the GIL). When nobody drains the ring, new records are
+// dropped once it fills.
+class CollectiveStatsRing {
+ public:
+  bool push(const CollectiveStats& stats) {
+    const auto tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == kCapacity) {
+      // Full; drop the record instead of stalling the watchdog.
+      return false;
+    }
+    buffer_[tail & (kCapacity - 1)] = stats;
+    tail_.store(tail + 1, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(CollectiveStats& out) {
+    const auto head = head_.load(std::memory_order_relaxed);
+    if (head == tail_.load(std::memory_order_acquire)) {
+      return false;
+    }
+    out = buffer_[head & (kCapacity - 1)];
+    head_.store(head + 1, std::memory_order_release);
+    return true;
+  }
+
+ private:
+  static constexpr size_t kCapacity = 4096; // must be a power of two
+  std::array<CollectiveStats, kCapacity> buffer_{};
+  std::atomic<uint64_t> head_{0};
+  std::atomic<uint64_t> tail_{0};
+};
+
 // Example on using the NCCL process group
 //
 //   ProcessGroupNCCL pg(store, rank, size);
@@ -449,6 +512,12 @@ class TORCH_API ProcessGroupNCCL : public Backend {
     // the future result (e.g., success or failure) of the work
     c10::intrusive_ptr<at::ivalue::Future> futureWorkResult_;
 
+    // Cache a successful query of the start/end events. CUDA events stay
+    // completed once they complete, so the query does not need to be repeated
+    // on subsequent polls of the same work.
+    mutable std::atomic<bool> gpuExecutionStarted_{false};
+    mutable std::atomic<bool> gpuExecutionFinished_{false};
+
     bool timingEnabled_;
     // unique id used to tell the trace buffer that this
     // work has completed
@@ -703,6 +772,11 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       std::function<void(std::shared_ptr<WorkInfo>)>&& hook) override;
   void waitForPendingWorks() override;
 
+  // Drains the stats mailbox the watchdog publishes retired collectives to;
+  // see CollectiveStatsRing. Must only be called from one consumer thread at
+  // a time.
+  std::vector<CollectiveStats> drainCollectiveStats();
+
   void enableCollectivesTiming() override;
 
   // Helper function for iteratively aborting communicators in the provided map
@@ -723,6 +797,29 @@ class TORCH_API ProcessGroupNCCL : public Backend {
 
   void performNocolorSplit(at::Device device);
 
+  // Elastic re-rendezvous fast path: build a process group for the
+  // surviving subset of this group's ranks by splitting the established
+  // NCCL communicator for `device` via `ncclCommSplit`, instead of
+  // paying a full ncclCommInitRank bootstrap at the new world size.
+  //
+  // All ranks of this group must call this with the same set of
+  // surviving group ranks; the split is a collective over the parent
+  // communicator, so departing ranks participate too — they are split
+  // off with NCCL_SPLIT_NOCOLOR and get nullptr back, while surviving
+  // ranks get the new (smaller) process group. Because departing ranks
+  // must still be able to make NCCL calls, this is the fast path for
+  // health-check driven drains and graceful scale-downs; ranks that
+  // died outright require abort() and a full re-init.
+  //
+  // Each shrink records the surviving global ranks in the store under an
+  // incarnation-scoped key, so a later rendezvous admitting a
+  // replacement rank can discover which incarnation it is joining. The
+  // new group shares this group's store behind an incarnation-scoped
+  // prefix.
+  c10::intrusive_ptr<ProcessGroupNCCL> shrinkToSurvivors(
+      at::Device device,
+      const std::vector<int>& survivingRanks);
+
   // This method adds a temporary extension for the timeout period,
   // applying to all collectives between the calling of this API and
   // the completion of the first collective on the GPU. While this feature
@@ -860,6 +957,16 @@ class TORCH_API ProcessGroupNCCL : public Backend {
       at::Tensor& tensor,
       const AllreduceOptions& opts = AllreduceOptions());
 
+  // Hierarchical allreduce helpers, see Note [Hierarchical allreduce].
+  int hierarchicalLocalSize() const;
+  bool shouldUseHierarchicalAllreduce(
+      const at::Tensor& tensor,
+      const AllreduceOptions& opts) const;
+  void initHierarchicalComms(at::Device device);
+  c10::intrusive_ptr<Work> allreduce_hierarchical(
+      at::Tensor& tensor,
+      const AllreduceOptions& opts);
+
   // Checks for NCCL errors on each of the communicators and returns an
   // appropriate exception_ptr (nullptr if no errors).
   static std::exception_ptr checkForNCCLErrorsInternal(
@@ -988,6 +1095,12 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // used to scope keys used in the store.
   uint64_t ncclCommCounter_{0};
 
+  // The number of times this process group has been shrunk via
+  // shrinkToSurvivors. Every rank of the group calls shrink the same
+  // number of times, so this counter yields the same incarnation number
+  // on all ranks without an extra store round trip.
+  uint64_t shrinkCounter_{0};
+
   // The store keys to trace the last NCCL collective kernel CUDA events - start
   // event and end event respectively. These are used to do desync root cause
   // analysis.
@@ -1236,8 +1349,23 @@ class TORCH_API ProcessGroupNCCL : public Backend {
   // Number of devices on this node.
   int localDeviceCount_{0};
 
+  // Hierarchical allreduce state, see Note [Hierarchical allreduce].
+  // Byte threshold above which allreduces go hierarchical; 0 disables.
+  size_t hierarchicalAllreduceThreshold_{0};
+  // Configured ranks per node; 0 means "use localDeviceCount_".
+  int hierarchicalAllreduceLocalSize_{0};
+  // Node-local communicator (all ranks on this rank's node) and rail
+  // communicator (ranks with the same local rank across nodes), split
+  // lazily from the main communicator on first use.
+  std::shared_ptr<NCCLComm> hierIntraNodeComm_;
+  std::shared_ptr<NCCLComm> hierRailComm_;
+
   std::shared_ptr<ProcessGroupStatus> pgStatus_ =
       std::make_shared<ProcessGroupStatus>();
+
+  // Mailbox of retired collectives, fed by the watchdog thread and drained
+  // via drainCollectiveStats().
+  CollectiveStatsRing collectiveStatsRing_;
 };
 
 // Dumps the NCCL comm traces and additional information about the Process
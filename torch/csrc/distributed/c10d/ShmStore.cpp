@@ -0,0 +1,422 @@
+#ifdef __linux__
+
+#include <torch/csrc/distributed/c10d/ShmStore.hpp>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <limits>
+#include <thread>
+
+#include <c10/util/Exception.h>
+
+namespace c10d {
+
+namespace detail {
+
+// Layout of the shared memory segment. The append-only log starts right
+// after the header; a record is
+//
+//   uint32_t keyLen | uint32_t valLen | key bytes | value bytes
+//
+// where valLen == kTombstone marks a deletion and carries no value bytes.
+// logSize is bumped only after a record's bytes are fully written, so a
+// writer dying mid-append leaves the log consistent and the record simply
+// never becomes visible.
+struct ShmStoreSegment {
+  static constexpr uint32_t kMagic = 0x53484d53; // "SHMS"
+
+  // Set (with release ordering) only after the mutex, condition variable and
+  // counters below are fully initialized by the creating process.
+  std::atomic<uint32_t> magic;
+  uint32_t reserved;
+  pthread_mutex_t mutex;
+  pthread_cond_t cond;
+  uint64_t logSize;
+  uint64_t capacity;
+  int32_t refCount;
+  uint8_t log[1];
+};
+
+} // namespace detail
+
+namespace {
+
+using detail::ShmStoreSegment;
+
+constexpr uint32_t kTombstone = std::numeric_limits<uint32_t>::max();
+constexpr size_t kRecordHeaderBytes = 2 * sizeof(uint32_t);
+
+void lockSegment(ShmStoreSegment* segment) {
+  int rv = pthread_mutex_lock(&segment->mutex);
+  if (rv == EOWNERDEAD) {
+    // A process died while holding the lock. The log is append-only with
+    // logSize updated last, so the shared state is still consistent; mark
+    // the mutex usable again and carry on.
+    pthread_mutex_consistent(&segment->mutex);
+    rv = 0;
+  }
+  TORCH_CHECK(
+      rv == 0, "ShmStore: failed to lock shared mutex: ", std::strerror(rv));
+}
+
+void unlockSegment(ShmStoreSegment* segment) {
+  pthread_mutex_unlock(&segment->mutex);
+}
+
+// RAII guard for the process-shared mutex.
+class SegmentLock {
+ public:
+  explicit SegmentLock(ShmStoreSegment* segment) : segment_(segment) {
+    lockSegment(segment_);
+  }
+  ~SegmentLock() {
+    unlockSegment(segment_);
+  }
+  SegmentLock(const SegmentLock&) = delete;
+  SegmentLock& operator=(const SegmentLock&) = delete;
+
+ private:
+  ShmStoreSegment* segment_;
+};
+
+} // namespace
+
+ShmStore::ShmStore(const std::string& name, int numWorkers, size_t size)
+    : Store(),
+      name_(!name.empty() && name[0] == '/' ? name : "/" + name),
+      numWorkers_(numWorkers),
+      size_(size) {
+  bool initializing = false;
+  fd_ = shm_open(name_.c_str(), O_RDWR | O_CREAT | O_EXCL, 0600);
+  if (fd_ >= 0) {
+    initializing = true;
+  } else {
+    TORCH_CHECK(
+        errno == EEXIST,
+        "ShmStore: shm_open(",
+        name_,
+        ") failed: ",
+        std::strerror(errno));
+    fd_ = shm_open(name_.c_str(), O_RDWR, 0600);
+    TORCH_CHECK(
+        fd_ >= 0,
+        "ShmStore: shm_open(",
+        name_,
+        ") failed: ",
+        std::strerror(errno));
+  }
+
+  const auto start = std::chrono::steady_clock::now();
+  if (initializing) {
+    TORCH_CHECK(
+        ftruncate(fd_, static_cast<off_t>(sizeof(ShmStoreSegment) + size_)) ==
+            0,
+        "ShmStore: ftruncate failed: ",
+        std::strerror(errno));
+  } else {
+    // The creator sizes the segment with a single ftruncate; wait for it.
+    while (true) {
+      struct stat st {};
+      TORCH_CHECK(
+          fstat(fd_, &st) == 0,
+          "ShmStore: fstat failed: ",
+          std::strerror(errno));
+      if (st.st_size > 0) {
+        TORCH_CHECK(
+            static_cast<size_t>(st.st_size) > sizeof(ShmStoreSegment),
+            "ShmStore: segment ",
+            name_,
+            " has unexpected size ",
+            st.st_size);
+        size_ = static_cast<size_t>(st.st_size) - sizeof(ShmStoreSegment);
+        break;
+      }
+      const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start);
+      TORCH_CHECK(
+          timeout_ == kNoTimeout || elapsed <= timeout_,
+          "Timeout waiting for ShmStore segment ",
+          name_,
+          " to be initialized");
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  void* addr = mmap(
+      nullptr,
+      sizeof(ShmStoreSegment) + size_,
+      PROT_READ | PROT_WRITE,
+      MAP_SHARED,
+      fd_,
+      0);
+  TORCH_CHECK(
+      addr != MAP_FAILED, "ShmStore: mmap failed: ", std::strerror(errno));
+  segment_ = static_cast<ShmStoreSegment*>(addr);
+
+  if (initializing) {
+    pthread_mutexattr_t mutexAttr;
+    pthread_mutexattr_init(&mutexAttr);
+    pthread_mutexattr_setpshared(&mutexAttr, PTHREAD_PROCESS_SHARED);
+    pthread_mutexattr_setrobust(&mutexAttr, PTHREAD_MUTEX_ROBUST);
+    pthread_mutex_init(&segment_->mutex, &mutexAttr);
+    pthread_mutexattr_destroy(&mutexAttr);
+
+    pthread_condattr_t condAttr;
+    pthread_condattr_init(&condAttr);
+    pthread_condattr_setpshared(&condAttr, PTHREAD_PROCESS_SHARED);
+    pthread_condattr_setclock(&condAttr, CLOCK_MONOTONIC);
+    pthread_cond_init(&segment_->cond, &condAttr);
+    pthread_condattr_destroy(&condAttr);
+
+    segment_->logSize = 0;
+    segment_->capacity = size_;
+    segment_->refCount = 0;
+    segment_->magic.store(ShmStoreSegment::kMagic, std::memory_order_release);
+  } else {
+    while (segment_->magic.load(std::memory_order_acquire) !=
+           ShmStoreSegment::kMagic) {
+      const auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+          std::chrono::steady_clock::now() - start);
+      TORCH_CHECK(
+          timeout_ == kNoTimeout || elapsed <= timeout_,
+          "Timeout waiting for ShmStore segment ",
+          name_,
+          " to be initialized");
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+  }
+
+  SegmentLock lock(segment_);
+  segment_->refCount++;
+}
+
+// NOLINTNEXTLINE(bugprone-exception-escape)
+ShmStore::~ShmStore() {
+  bool last = false;
+  int rv = pthread_mutex_lock(&segment_->mutex);
+  if (rv == EOWNERDEAD) {
+    pthread_mutex_consistent(&segment_->mutex);
+    rv = 0;
+  }
+  if (rv == 0) {
+    segment_->refCount--;
+    last = segment_->refCount == 0;
+    pthread_mutex_unlock(&segment_->mutex);
+  }
+  munmap(segment_, sizeof(ShmStoreSegment) + size_);
+  ::close(fd_);
+  // Mirror FileStore: only clean up when a fixed number of workers was
+  // given, so stray late joiners of long-lived stores still find the
+  // segment.
+  if (last && numWorkers_ >= 0) {
+    shm_unlink(name_.c_str());
+  }
+}
+
+void ShmStore::replay() {
+  const uint8_t* log = segment_->log;
+  while (pos_ < segment_->logSize) {
+    uint32_t keyLen = 0;
+    uint32_t valLen = 0;
+    std::memcpy(&keyLen, log + pos_, sizeof(keyLen));
+    std::memcpy(&valLen, log + pos_ + sizeof(keyLen), sizeof(valLen));
+    std::string key(
+        reinterpret_cast<const char*>(log + pos_ + kRecordHeaderBytes),
+        keyLen);
+    if (valLen == kTombstone) {
+      cache_.erase(key);
+      pos_ += kRecordHeaderBytes + keyLen;
+    } else {
+      const uint8_t* val = log + pos_ + kRecordHeaderBytes + keyLen;
+      cache_[std::move(key)] = std::vector<uint8_t>(val, val + valLen);
+      pos_ += kRecordHeaderBytes + keyLen + valLen;
+    }
+  }
+}
+
+void ShmStore::appendRecord(
+    const std::string& key,
+    const uint8_t* data,
+    size_t len) {
+  const size_t needed = kRecordHeaderBytes + key.size() + len;
+  TORCH_CHECK(
+      segment_->logSize + needed <= segment_->capacity,
+      "ShmStore: capacity of segment ",
+      name_,
+      " (",
+      segment_->capacity,
+      " bytes) exhausted; construct the store with a larger size");
+  uint8_t* dst = segment_->log + segment_->logSize;
+  const uint32_t keyLen = static_cast<uint32_t>(key.size());
+  const uint32_t valLen = static_cast<uint32_t>(len);
+  std::memcpy(dst, &keyLen, sizeof(keyLen));
+  std::memcpy(dst + sizeof(keyLen), &valLen, sizeof(valLen));
+  std::memcpy(dst + kRecordHeaderBytes, key.data(), key.size());
+  if (len > 0) {
+    std::memcpy(dst + kRecordHeaderBytes + key.size(), data, len);
+  }
+  // Publish the record only after its bytes are in place.
+  segment_->logSize += needed;
+  pthread_cond_broadcast(&segment_->cond);
+}
+
+void ShmStore::appendDeletion(const std::string& key) {
+  const size_t needed = kRecordHeaderBytes + key.size();
+  TORCH_CHECK(
+      segment_->logSize + needed <= segment_->capacity,
+      "ShmStore: capacity of segment ",
+      name_,
+      " (",
+      segment_->capacity,
+      " bytes) exhausted; construct the store with a larger size");
+  uint8_t* dst = segment_->log + segment_->logSize;
+  const uint32_t keyLen = static_cast<uint32_t>(key.size());
+  const uint32_t valLen = kTombstone;
+  std::memcpy(dst, &keyLen, sizeof(keyLen));
+  std::memcpy(dst + sizeof(keyLen), &valLen, sizeof(valLen));
+  std::memcpy(dst + kRecordHeaderBytes, key.data(), key.size());
+  segment_->logSize += needed;
+  pthread_cond_broadcast(&segment_->cond);
+}
+
+bool ShmStore::checkLocked(const std::vector<std::string>& keys) {
+  for (const auto& key : keys) {
+    if (cache_.count(key) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void ShmStore::waitLocked(
+    const std::vector<std::string>& keys,
+    const std::chrono::milliseconds& timeout) {
+  replay();
+  if (checkLocked(keys)) {
+    return;
+  }
+  struct timespec deadline {};
+  if (timeout != kNoTimeout) {
+    clock_gettime(CLOCK_MONOTONIC, &deadline);
+    deadline.tv_sec += timeout.count() / 1000;
+    deadline.tv_nsec += (timeout.count() % 1000) * 1000000;
+    if (deadline.tv_nsec >= 1000000000) {
+      deadline.tv_sec += 1;
+      deadline.tv_nsec -= 1000000000;
+    }
+  }
+  while (true) {
+    int rv = 0;
+    if (timeout == kNoTimeout) {
+      rv = pthread_cond_wait(&segment_->cond, &segment_->mutex);
+    } else {
+      rv = pthread_cond_timedwait(
+          &segment_->cond, &segment_->mutex, &deadline);
+    }
+    if (rv == EOWNERDEAD) {
+      pthread_mutex_consistent(&segment_->mutex);
+      rv = 0;
+    }
+    replay();
+    if (checkLocked(keys)) {
+      return;
+    }
+    if (rv == ETIMEDOUT) {
+      TORCH_CHECK(false, "Wait timeout");
+    }
+    TORCH_CHECK(
+        rv == 0,
+        "ShmStore: failed to wait on shared condition variable: ",
+        std::strerror(rv));
+  }
+}
+
+void ShmStore::set(const std::string& key, const std::vector<uint8_t>& value) {
+  std::unique_lock<std::mutex> l(activeOpLock_);
+  SegmentLock lock(segment_);
+  appendRecord(key, value.data(), value.size());
+}
+
+std::vector<uint8_t> ShmStore::compareSet(
+    const std::string& key,
+    const std::vector<uint8_t>& expectedValue,
+    const std::vector<uint8_t>& desiredValue) {
+  std::unique_lock<std::mutex> l(activeOpLock_);
+  SegmentLock lock(segment_);
+  replay();
+  auto it = cache_.find(key);
+  if ((it == cache_.end() && expectedValue.empty()) ||
+      (it != cache_.end() && it->second == expectedValue)) {
+    appendRecord(key, desiredValue.data(), desiredValue.size());
+    return desiredValue;
+  } else if (it == cache_.end()) {
+    return expectedValue;
+  }
+  return it->second;
+}
+
+std::vector<uint8_t> ShmStore::get(const std::string& key) {
+  std::unique_lock<std::mutex> l(activeOpLock_);
+  SegmentLock lock(segment_);
+  waitLocked({key}, timeout_);
+  return cache_[key];
+}
+
+int64_t ShmStore::add(const std::string& key, int64_t value) {
+  std::unique_lock<std::mutex> l(activeOpLock_);
+  SegmentLock lock(segment_);
+  replay();
+  int64_t ti = value;
+  auto it = cache_.find(key);
+  if (it != cache_.end() && !it->second.empty()) {
+    auto buf = reinterpret_cast<const char*>(it->second.data());
+    ti += std::stoll(std::string(buf, it->second.size()));
+  }
+  auto str = std::to_string(ti);
+  appendRecord(
+      key, reinterpret_cast<const uint8_t*>(str.data()), str.size());
+  return ti;
+}
+
+int64_t ShmStore::getNumKeys() {
+  std::unique_lock<std::mutex> l(activeOpLock_);
+  SegmentLock lock(segment_);
+  replay();
+  return static_cast<int64_t>(cache_.size());
+}
+
+bool ShmStore::deleteKey(const std::string& key) {
+  std::unique_lock<std::mutex> l(activeOpLock_);
+  SegmentLock lock(segment_);
+  appendDeletion(key);
+  return true;
+}
+
+bool ShmStore::check(const std::vector<std::string>& keys) {
+  std::unique_lock<std::mutex> l(activeOpLock_);
+  SegmentLock lock(segment_);
+  replay();
+  return checkLocked(keys);
+}
+
+void ShmStore::wait(const std::vector<std::string>& keys) {
+  wait(keys, timeout_);
+}
+
+void ShmStore::wait(
+    const std::vector<std::string>& keys,
+    const std::chrono::milliseconds& timeout) {
+  std::unique_lock<std::mutex> l(activeOpLock_);
+  SegmentLock lock(segment_);
+  waitLocked(keys, timeout);
+}
+
+} // namespace c10d
+
+#endif // __linux__
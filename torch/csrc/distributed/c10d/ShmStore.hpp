@@ -0,0 +1,96 @@
+#pragma once
+
+#ifdef __linux__
+
+#include <pthread.h>
+
+#include <unordered_map>
+
+#include <torch/csrc/distributed/c10d/Store.hpp>
+
+namespace c10d {
+
+namespace detail {
+struct ShmStoreSegment;
+} // namespace detail
+
+// A Store backed by a POSIX shared memory segment, for rendezvous between
+// processes on a single host. Writers append records to a log in the segment
+// under a process-shared (futex-backed) mutex and signal a process-shared
+// condition variable; waiters block on the condition variable instead of
+// polling, so rendezvous completes in the time it takes the kernel to wake
+// the sleepers rather than in filesystem round trips.
+//
+// The segment has a fixed capacity sized for rendezvous traffic (keys and
+// small values); exceeding it raises an error rather than growing the
+// mapping. The mutex is robust: if a process dies while holding it, the next
+// locker recovers instead of deadlocking. The last attached store instance
+// unlinks the segment.
+class TORCH_API ShmStore : public Store {
+ public:
+  static constexpr size_t kDefaultSize = 1024 * 1024;
+
+  explicit ShmStore(
+      const std::string& name,
+      int numWorkers = -1,
+      size_t size = kDefaultSize);
+
+  ~ShmStore() override;
+
+  void set(const std::string& key, const std::vector<uint8_t>& value) override;
+
+  std::vector<uint8_t> compareSet(
+      const std::string& key,
+      const std::vector<uint8_t>& expectedValue,
+      const std::vector<uint8_t>& desiredValue) override;
+
+  std::vector<uint8_t> get(const std::string& key) override;
+
+  int64_t add(const std::string& key, int64_t value) override;
+
+  int64_t getNumKeys() override;
+
+  bool deleteKey(const std::string& key) override;
+
+  bool check(const std::vector<std::string>& keys) override;
+
+  void wait(const std::vector<std::string>& keys) override;
+
+  void wait(
+      const std::vector<std::string>& keys,
+      const std::chrono::milliseconds& timeout) override;
+
+  // Returns the shared memory object name used by this store.
+  const std::string& getName() const noexcept {
+    return name_;
+  }
+
+ private:
+  // All of the private helpers below expect the segment mutex to be held.
+  void replay();
+  void appendRecord(const std::string& key, const uint8_t* data, size_t len);
+  void appendDeletion(const std::string& key);
+  bool checkLocked(const std::vector<std::string>& keys);
+  void waitLocked(
+      const std::vector<std::string>& keys,
+      const std::chrono::milliseconds& timeout);
+
+  std::string name_;
+  int numWorkers_;
+  size_t size_;
+  int fd_{-1};
+  detail::ShmStoreSegment* segment_{nullptr};
+
+  // Local replay state: the next unread offset into the shared log and the
+  // key-value view it produced, mirroring FileStore's cache.
+  uint64_t pos_{0};
+  std::unordered_map<std::string, std::vector<uint8_t>> cache_;
+
+  // Serializes access from threads of this process; cross-process exclusion
+  // is provided by the segment mutex.
+  std::mutex activeOpLock_;
+};
+
+} // namespace c10d
+
+#endif // __linux__
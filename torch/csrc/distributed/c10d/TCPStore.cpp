@@ -256,10 +256,15 @@ using detail::Socket;
 TCPStore::TCPStore(std::string host, const TCPStoreOptions& opts)
     : Store{opts.timeout},
       addr_{std::move(host)},
+      numShards_{std::max<std::size_t>(opts.numShards, 1)},
       numWorkers_{opts.numWorkers},
       usingLibUv_{opts.useLibUV} {
   STATIC_SCOPED_WAIT_COUNTER(pytorch.wait_counter.TCPStore__init);
 
+  TORCH_CHECK(
+      numShards_ == 1 || opts.port > 0,
+      "A sharded TCPStore requires an explicit port; shard i listens on port + i.");
+
   if (opts.useLibUV) {
     TORCH_CHECK(
         ::c10d::detail::is_libuv_tcpstore_backend_available(),
@@ -304,6 +309,17 @@ TCPStore::TCPStore(std::string host, const TCPStoreOptions& opts)
     }
 
     addr_.port = server_->port();
+
+    for (std::size_t shard = 1; shard < numShards_; ++shard) {
+      TCPStoreOptions shardOpts = opts;
+      shardOpts.port = static_cast<std::uint16_t>(opts.port + shard);
+      shardOpts.masterListenFd = std::nullopt;
+      extraShardServers_.push_back(detail::TCPServer::start(shardOpts));
+      C10D_DEBUG(
+          "Shard server {} has started on port = {}.",
+          shard,
+          extraShardServers_.back()->port());
+    }
   } else {
     addr_.port = opts.port;
   }
@@ -313,48 +329,59 @@ TCPStore::TCPStore(std::string host, const TCPStoreOptions& opts)
   auto deadline = std::chrono::steady_clock::now() + opts.timeout;
   auto backoff = std::make_shared<ExponentialBackoffWithJitter>();
 
-  auto retry = 0;
-  do {
-    try {
-      client_ = detail::TCPClient::connect(addr_, opts, backoff);
-      // TCP connection established
-      C10D_DEBUG("TCP client connected to host {}:{}", addr_.host, addr_.port);
-
-      // client's first query for validation
-      validate();
-
-      // ping to verify network connectivity
-      ping();
-
-      // success
-      break;
-    } catch (const c10::DistNetworkError& ex) {
-      if (deadline < std::chrono::steady_clock::now()) {
-        C10D_ERROR(
-            "TCP client failed to connect/validate to host {}:{} - timed out (try={}, timeout={}ms): {}",
-            addr_.host,
-            addr_.port,
+  for (const auto shard : c10::irange(numShards_)) {
+    detail::SocketAddress shardAddr{
+        addr_.host, static_cast<std::uint16_t>(addr_.port + shard)};
+
+    auto retry = 0;
+    do {
+      try {
+        auto client = detail::TCPClient::connect(shardAddr, opts, backoff);
+        // TCP connection established
+        C10D_DEBUG(
+            "TCP client connected to host {}:{}", shardAddr.host, shardAddr.port);
+
+        // client's first query for validation
+        validate(*client);
+
+        // ping to verify network connectivity
+        ping(*client);
+
+        // success
+        if (shard == 0) {
+          client_ = std::move(client);
+        } else {
+          extraShardClients_.push_back(std::move(client));
+        }
+        break;
+      } catch (const c10::DistNetworkError& ex) {
+        if (deadline < std::chrono::steady_clock::now()) {
+          C10D_ERROR(
+              "TCP client failed to connect/validate to host {}:{} - timed out (try={}, timeout={}ms): {}",
+              shardAddr.host,
+              shardAddr.port,
+              retry,
+              opts.timeout.count(),
+              ex.what());
+          throw;
+        }
+
+        auto delayDuration = backoff->nextBackoff();
+
+        C10D_WARNING(
+            "TCP client failed to connect/validate to host {}:{} - retrying (try={}, timeout={}ms, delay={}ms): {}",
+            shardAddr.host,
+            shardAddr.port,
             retry,
             opts.timeout.count(),
+            delayDuration.count(),
             ex.what());
-        throw;
-      }
-
-      auto delayDuration = backoff->nextBackoff();
-
-      C10D_WARNING(
-          "TCP client failed to connect/validate to host {}:{} - retrying (try={}, timeout={}ms, delay={}ms): {}",
-          addr_.host,
-          addr_.port,
-          retry,
-          opts.timeout.count(),
-          delayDuration.count(),
-          ex.what());
 
-      std::this_thread::sleep_for(delayDuration);
-      retry += 1;
-    }
-  } while (true);
+        std::this_thread::sleep_for(delayDuration);
+        retry += 1;
+      }
+    } while (true);
+  }
 
   if (opts.waitWorkers) {
     waitForWorkers();
@@ -401,32 +428,55 @@ void TCPStore::waitForWorkers() {
   }
 }
 
-void TCPStore::validate() {
+void TCPStore::validate(detail::TCPClient& client) {
   const std::lock_guard<std::mutex> lock(activeOpLock_);
-  detail::SendBuffer buffer(*client_, detail::QueryType::VALIDATE);
+  detail::SendBuffer buffer(client, detail::QueryType::VALIDATE);
   buffer.appendValue<std::uint32_t>(c10d::detail::validationMagicNumber);
   buffer.flush();
 }
 
-void TCPStore::ping() {
+void TCPStore::ping(detail::TCPClient& client) {
   const std::lock_guard<std::mutex> lock(activeOpLock_);
-  detail::SendBuffer buffer(*client_, detail::QueryType::PING);
+  detail::SendBuffer buffer(client, detail::QueryType::PING);
 
   uint32_t nonce = getpid();
   buffer.appendValue<std::uint32_t>(nonce);
   buffer.flush();
 
-  uint32_t returnedNonce = client_->receiveValue<std::uint32_t>();
+  uint32_t returnedNonce = client.receiveValue<std::uint32_t>();
   TORCH_INTERNAL_ASSERT(
       nonce == returnedNonce, "Ping failed, invalid nonce returned");
 }
 
+std::size_t TCPStore::shardFor(const std::string& key) const {
+  if (numShards_ == 1) {
+    return 0;
+  }
+  // FNV-1a rather than std::hash, whose result is implementation-defined;
+  // every rank must map a key to the same shard.
+  std::uint64_t hash = 0xcbf29ce484222325ull;
+  for (const char c : key) {
+    hash ^= static_cast<std::uint8_t>(c);
+    hash *= 0x100000001b3ull;
+  }
+  return hash % numShards_;
+}
+
+detail::TCPClient& TCPStore::clientForShard(std::size_t shard) {
+  return shard == 0 ? *client_ : *extraShardClients_[shard - 1];
+}
+
+detail::TCPClient& TCPStore::clientFor(const std::string& key) {
+  return clientForShard(shardFor(key));
+}
+
 void TCPStore::_splitSet(
     const std::string& key,
     const std::vector<uint8_t>& data) {
   const std::lock_guard<std::mutex> lock(activeOpLock_);
-  detail::SendBuffer buffer(*client_, detail::QueryType::SET);
-  buffer.appendString(keyPrefix_ + key);
+  const std::string fullKey = keyPrefix_ + key;
+  detail::SendBuffer buffer(clientFor(fullKey), detail::QueryType::SET);
+  buffer.appendString(fullKey);
   buffer.flush();
   std::this_thread::sleep_for(std::chrono::milliseconds(1000));
   buffer.appendBytes(data);
@@ -436,8 +486,9 @@ void TCPStore::_splitSet(
 void TCPStore::set(const std::string& key, const std::vector<uint8_t>& data) {
   STATIC_SCOPED_WAIT_COUNTER(pytorch.wait_counter.TCPStore__set);
   const std::lock_guard<std::mutex> lock(activeOpLock_);
-  detail::SendBuffer buffer(*client_, detail::QueryType::SET);
-  buffer.appendString(keyPrefix_ + key);
+  const std::string fullKey = keyPrefix_ + key;
+  detail::SendBuffer buffer(clientFor(fullKey), detail::QueryType::SET);
+  buffer.appendString(fullKey);
   buffer.appendBytes(data);
   buffer.flush();
 }
@@ -448,13 +499,15 @@ std::vector<uint8_t> TCPStore::compareSet(
     const std::vector<uint8_t>& desiredValue) {
   STATIC_SCOPED_WAIT_COUNTER(pytorch.wait_counter.TCPStore__compareSet);
   const std::lock_guard<std::mutex> lock(activeOpLock_);
-  detail::SendBuffer buffer(*client_, detail::QueryType::COMPARE_SET);
-  buffer.appendString(keyPrefix_ + key);
+  const std::string fullKey = keyPrefix_ + key;
+  auto& client = clientFor(fullKey);
+  detail::SendBuffer buffer(client, detail::QueryType::COMPARE_SET);
+  buffer.appendString(fullKey);
   buffer.appendBytes(expectedValue);
   buffer.appendBytes(desiredValue);
   buffer.flush();
 
-  return client_->receiveBits();
+  return client.receiveBits();
 }
 
 std::vector<uint8_t> TCPStore::get(const std::string& key) {
@@ -464,12 +517,13 @@ std::vector<uint8_t> TCPStore::get(const std::string& key) {
 }
 
 std::vector<uint8_t> TCPStore::doGet(const std::string& key) {
-  doWait(key, timeout_);
-  detail::SendBuffer buffer(*client_, detail::QueryType::GET);
+  auto& client = clientFor(key);
+  doWait(client, key, timeout_);
+  detail::SendBuffer buffer(client, detail::QueryType::GET);
   buffer.appendString(key);
   buffer.flush();
 
-  return client_->receiveBits();
+  return client.receiveBits();
 }
 
 int64_t TCPStore::add(const std::string& key, int64_t value) {
@@ -481,50 +535,70 @@ int64_t TCPStore::add(const std::string& key, int64_t value) {
 bool TCPStore::deleteKey(const std::string& key) {
   STATIC_SCOPED_WAIT_COUNTER(pytorch.wait_counter.TCPStore__delete);
   const std::lock_guard<std::mutex> lock(activeOpLock_);
-  detail::SendBuffer buffer(*client_, detail::QueryType::DELETE_KEY);
-  buffer.appendString(keyPrefix_ + key);
+  const std::string fullKey = keyPrefix_ + key;
+  auto& client = clientFor(fullKey);
+  detail::SendBuffer buffer(client, detail::QueryType::DELETE_KEY);
+  buffer.appendString(fullKey);
   buffer.flush();
 
-  auto numDeleted = client_->receiveValue<std::int64_t>();
+  auto numDeleted = client.receiveValue<std::int64_t>();
   return numDeleted == 1;
 }
 
 int64_t TCPStore::incrementValueBy(const std::string& key, int64_t delta) {
-  detail::SendBuffer buff(*client_, detail::QueryType::ADD);
+  auto& client = clientFor(key);
+  detail::SendBuffer buff(client, detail::QueryType::ADD);
   buff.appendString(key);
   buff.appendValue<std::int64_t>(delta);
   buff.flush();
 
-  return client_->receiveValue<std::int64_t>();
+  return client.receiveValue<std::int64_t>();
 }
 
 int64_t TCPStore::getNumKeys() {
   const std::lock_guard<std::mutex> lock(activeOpLock_);
-  detail::SendBuffer buffer(*client_, detail::QueryType::GETNUMKEYS);
-  buffer.flush();
+  int64_t numKeys = 0;
+  for (const auto shard : c10::irange(numShards_)) {
+    auto& client = clientForShard(shard);
+    detail::SendBuffer buffer(client, detail::QueryType::GETNUMKEYS);
+    buffer.flush();
 
-  return client_->receiveValue<std::int64_t>();
+    numKeys += client.receiveValue<std::int64_t>();
+  }
+  return numKeys;
 }
 
 bool TCPStore::check(const std::vector<std::string>& keys) {
   STATIC_SCOPED_WAIT_COUNTER(pytorch.wait_counter.TCPStore__check);
   const std::lock_guard<std::mutex> lock(activeOpLock_);
-  detail::SendBuffer buffer(*client_, detail::QueryType::CHECK);
-  buffer.appendValue(keys.size());
-
+  std::vector<std::vector<std::string>> shardKeys(numShards_);
   for (const std::string& key : keys) {
-    buffer.appendString(keyPrefix_ + key);
+    std::string fullKey = keyPrefix_ + key;
+    shardKeys[shardFor(fullKey)].push_back(std::move(fullKey));
   }
-  buffer.flush();
 
-  auto response = client_->receiveValue<detail::CheckResponseType>();
-  if (response == detail::CheckResponseType::READY) {
-    return true;
-  }
-  if (response == detail::CheckResponseType::NOT_READY) {
-    return false;
+  bool ready = true;
+  for (const auto shard : c10::irange(numShards_)) {
+    if (shardKeys[shard].empty()) {
+      continue;
+    }
+    auto& client = clientForShard(shard);
+    detail::SendBuffer buffer(client, detail::QueryType::CHECK);
+    buffer.appendValue(shardKeys[shard].size());
+
+    for (const std::string& key : shardKeys[shard]) {
+      buffer.appendString(key);
+    }
+    buffer.flush();
+
+    auto response = client.receiveValue<detail::CheckResponseType>();
+    if (response == detail::CheckResponseType::NOT_READY) {
+      ready = false;
+    } else if (response != detail::CheckResponseType::READY) {
+      TORCH_CHECK(false, "ready or not_ready response expected");
+    }
   }
-  TORCH_CHECK(false, "ready or not_ready response expected");
+  return ready;
 }
 
 void TCPStore::wait(const std::vector<std::string>& keys) {
@@ -536,20 +610,27 @@ void TCPStore::wait(
     const std::chrono::milliseconds& timeout) {
   STATIC_SCOPED_WAIT_COUNTER(pytorch.wait_counter.TCPStore__wait);
   const std::lock_guard<std::mutex> lock(activeOpLock_);
-  std::vector<std::string> prefixedKeys{};
-  prefixedKeys.reserve(keys.size());
+  std::vector<std::vector<std::string>> shardKeys(numShards_);
   for (const std::string& key : keys) {
-    prefixedKeys.emplace_back(keyPrefix_ + key);
+    std::string fullKey = keyPrefix_ + key;
+    shardKeys[shardFor(fullKey)].push_back(std::move(fullKey));
   }
 
-  doWait(prefixedKeys, timeout);
+  // One vectored wait per shard that owns any of the keys; the timeout
+  // applies to each shard's wait individually.
+  for (const auto shard : c10::irange(numShards_)) {
+    if (!shardKeys[shard].empty()) {
+      doWait(clientForShard(shard), shardKeys[shard], timeout);
+    }
+  }
 }
 
 void TCPStore::doWait(
+    detail::TCPClient& client,
     c10::ArrayRef<std::string> keys,
     std::chrono::milliseconds timeout) {
   {
-    detail::SendBuffer buffer(*client_, detail::QueryType::WAIT);
+    detail::SendBuffer buffer(client, detail::QueryType::WAIT);
     buffer.appendValue(keys.size());
     for (const std::string& key : keys) {
       buffer.appendString(key);
@@ -558,7 +639,7 @@ void TCPStore::doWait(
   }
 
   detail::WaitResponseType response;
-  if (client_->receiveValueWithTimeout<detail::WaitResponseType>(
+  if (client.receiveValueWithTimeout<detail::WaitResponseType>(
           response, timeout)) {
     if (response != detail::WaitResponseType::STOP_WAITING) {
       TORCH_CHECK(false, "Stop_waiting response is expected");
@@ -568,18 +649,18 @@ void TCPStore::doWait(
   // this is the cancel wait timeout, once here we expect the server to respond
   // in a timely fashion
   {
-    detail::SendBuffer buffer(*client_, detail::QueryType::CANCEL_WAIT);
+    detail::SendBuffer buffer(client, detail::QueryType::CANCEL_WAIT);
     buffer.flush();
   }
 
-  response = client_->receiveValue<detail::WaitResponseType>();
+  response = client.receiveValue<detail::WaitResponseType>();
   // this can happen if the server responds before we cancel, just ignore it
   if (response != detail::WaitResponseType::WAIT_CANCELED) {
     if (response != detail::WaitResponseType::STOP_WAITING) {
       TORCH_CHECK(false, "Stop_waiting response is expected");
     }
 
-    response = client_->receiveValue<detail::WaitResponseType>(); // ignore
+    response = client.receiveValue<detail::WaitResponseType>(); // ignore
     if (response != detail::WaitResponseType::WAIT_CANCELED) {
       TORCH_CHECK(false, "wait_canceled response is expected");
     }
@@ -597,8 +678,9 @@ void TCPStore::append(
     const std::vector<uint8_t>& data) {
   STATIC_SCOPED_WAIT_COUNTER(pytorch.wait_counter.TCPStore__append);
   const std::lock_guard<std::mutex> lock(activeOpLock_);
-  detail::SendBuffer buffer(*client_, detail::QueryType::APPEND);
-  buffer.appendString(keyPrefix_ + key);
+  const std::string fullKey = keyPrefix_ + key;
+  detail::SendBuffer buffer(clientFor(fullKey), detail::QueryType::APPEND);
+  buffer.appendString(fullKey);
   buffer.appendBytes(data);
   buffer.flush();
 }
@@ -607,24 +689,33 @@ std::vector<std::vector<uint8_t>> TCPStore::multiGet(
     const std::vector<std::string>& keys) {
   STATIC_SCOPED_WAIT_COUNTER(pytorch.wait_counter.TCPStore__multiGet);
   const std::lock_guard<std::mutex> lock(activeOpLock_);
-  std::vector<std::string> prefixedKeys;
-  prefixedKeys.reserve(keys.size());
-  for (const std::string& key : keys) {
-    prefixedKeys.emplace_back(keyPrefix_ + key);
-  }
-  doWait(prefixedKeys, timeout_);
+  std::vector<std::vector<std::string>> shardKeys(numShards_);
+  std::vector<std::vector<std::size_t>> shardIndices(numShards_);
+  for (const auto i : c10::irange(keys.size())) {
+    std::string fullKey = keyPrefix_ + keys[i];
+    const auto shard = shardFor(fullKey);
+    shardKeys[shard].push_back(std::move(fullKey));
+    shardIndices[shard].push_back(i);
+  }
+
+  std::vector<std::vector<uint8_t>> result(keys.size());
+  for (const auto shard : c10::irange(numShards_)) {
+    if (shardKeys[shard].empty()) {
+      continue;
+    }
+    auto& client = clientForShard(shard);
+    doWait(client, shardKeys[shard], timeout_);
 
-  detail::SendBuffer buffer(*client_, detail::QueryType::MULTI_GET);
-  buffer.appendValue(keys.size());
-  for (auto& key : prefixedKeys) {
-    buffer.appendString(key);
-  }
-  buffer.flush();
+    detail::SendBuffer buffer(client, detail::QueryType::MULTI_GET);
+    buffer.appendValue(shardKeys[shard].size());
+    for (auto& key : shardKeys[shard]) {
+      buffer.appendString(key);
+    }
+    buffer.flush();
 
-  std::vector<std::vector<uint8_t>> result;
-  result.reserve(keys.size());
-  for (size_t i = 0; i < keys.size(); ++i) {
-    result.emplace_back(client_->receiveBits());
+    for (const auto i : c10::irange(shardKeys[shard].size())) {
+      result[shardIndices[shard][i]] = client.receiveBits();
+    }
   }
   return result;
 }
@@ -638,13 +729,28 @@ void TCPStore::multiSet(
       "multiSet keys and values vectors must be of same size");
   const std::lock_guard<std::mutex> lock(activeOpLock_);
 
-  detail::SendBuffer buffer(*client_, detail::QueryType::MULTI_SET);
-  buffer.appendValue<std::int64_t>(keys.size());
-  for (auto i : c10::irange(keys.size())) {
-    buffer.appendString(keyPrefix_ + keys[i]);
-    buffer.appendBytes(values[i]);
+  std::vector<std::vector<std::size_t>> shardIndices(numShards_);
+  std::vector<std::vector<std::string>> shardKeys(numShards_);
+  for (const auto i : c10::irange(keys.size())) {
+    std::string fullKey = keyPrefix_ + keys[i];
+    const auto shard = shardFor(fullKey);
+    shardKeys[shard].push_back(std::move(fullKey));
+    shardIndices[shard].push_back(i);
+  }
+
+  for (const auto shard : c10::irange(numShards_)) {
+    if (shardKeys[shard].empty()) {
+      continue;
+    }
+    detail::SendBuffer buffer(
+        clientForShard(shard), detail::QueryType::MULTI_SET);
+    buffer.appendValue<std::int64_t>(shardKeys[shard].size());
+    for (const auto i : c10::irange(shardKeys[shard].size())) {
+      buffer.appendString(shardKeys[shard][i]);
+      buffer.appendBytes(values[shardIndices[shard][i]]);
+    }
+    buffer.flush();
   }
-  buffer.flush();
 }
 
 bool TCPStore::hasExtendedApi() const {
@@ -67,6 +67,14 @@ struct TCPStoreOptions {
 
   // A boolean value indicating whether to use the experimental libUV backend.
   bool useLibUV = true;
+
+  // Number of server daemons the key space is sharded across. When greater
+  // than one, the server side starts numShards daemons on consecutive ports
+  // starting at `port`, and every client routes each key to the daemon that
+  // owns it via a stable hash, spreading rendezvous traffic at large world
+  // sizes. All participants must use the same value. Requires an explicit
+  // (non-zero) port.
+  std::size_t numShards = 1;
 };
 
 class TORCH_API TCPStore : public Store {
@@ -137,18 +145,30 @@ class TORCH_API TCPStore : public Store {
  private:
   int64_t incrementValueBy(const std::string& key, int64_t delta);
 
-  void ping();
-  void validate();
+  void ping(detail::TCPClient& client);
+  void validate(detail::TCPClient& client);
+
+  // Maps a (prefixed) key to the shard that owns it. Uses a hash that is
+  // stable across processes so every client agrees on the mapping.
+  std::size_t shardFor(const std::string& key) const;
+  detail::TCPClient& clientForShard(std::size_t shard);
+  detail::TCPClient& clientFor(const std::string& key);
 
   std::vector<uint8_t> doGet(const std::string& key);
 
   void doWait(
+      detail::TCPClient& client,
       c10::ArrayRef<std::string> keys,
       std::chrono::milliseconds timeout);
 
   detail::SocketAddress addr_;
   std::shared_ptr<detail::TCPServer> server_;
   std::unique_ptr<detail::TCPClient> client_;
+  // Daemons and connections for shards 1..numShards-1; shard 0 lives in
+  // server_/client_ above.
+  std::vector<std::shared_ptr<detail::TCPServer>> extraShardServers_;
+  std::vector<std::unique_ptr<detail::TCPClient>> extraShardClients_;
+  std::size_t numShards_ = 1;
   std::optional<std::size_t> numWorkers_;
 
   const std::string initKey_ = "init/";
@@ -1,3 +1,4 @@
+#include <ATen/ScalarOps.h>
 #include <c10/core/ScalarType.h>
 #include <c10/util/Exception.h>
 #include <torch/csrc/distributed/c10d/default_comm_hooks.hpp>
@@ -8,24 +9,30 @@
 
 namespace c10d {
 
-c10::intrusive_ptr<c10::ivalue::Future> AllReduceCommHook::runHook(
-    GradBucket& bucket) {
-  std::vector<at::Tensor> tensors = {bucket.getBufferRef()};
-  // Apply the division first to avoid overflow, especially for FP16.
-  tensors[0] /= state_->getSize();
-  return state_->allreduce(tensors)->getFuture();
-}
+namespace {
 
-c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
-    GradBucket& bucket) {
-  auto compressed_tensor = bucket.getBufferRef().to(torch::kFloat16);
-  // Apply the division first to avoid overflow.
-  compressed_tensor /= state_->getSize();
+// Shared implementation of the low-precision compression hooks. The cast to
+// the wire dtype and the pre-division by world size are fused into a single
+// mul_out kernel (same trick as the copy-and-divide fusion in the reducer),
+// and the decompress step after the allreduce is a single cast-on-copy
+// kernel, so the whole pipeline launches two elementwise kernels per bucket.
+c10::intrusive_ptr<c10::ivalue::Future> runCompressedAllReduceHook(
+    const c10::intrusive_ptr<ProcessGroup>& state,
+    GradBucket& bucket,
+    at::ScalarType dtype) {
+  auto& buffer = bucket.getBufferRef();
+  auto compressed_tensor = at::empty_like(buffer, buffer.options().dtype(dtype));
+  // Apply the division first to avoid overflow; fused with the cast.
+  at::mul_out(
+      compressed_tensor,
+      buffer,
+      at::native::wrapped_scalar_tensor(1.0 / state->getSize()));
   std::vector<at::Tensor> tensors = {compressed_tensor};
 
-  auto allreduce_fut = state_->allreduce(tensors)->getFuture();
-  auto decompressed_tensor = bucket.getBufferRef();
-  auto decompress = [decompressed_tensor](c10::ivalue::Future& allreduce_fut) {
+  auto allreduce_fut = state->allreduce(tensors)->getFuture();
+  auto decompressed_tensor = buffer;
+  auto decompress = [decompressed_tensor,
+                     dtype](c10::ivalue::Future& allreduce_fut) {
     auto result = allreduce_fut.value();
     TORCH_INTERNAL_ASSERT(
         result.isTensorList(),
@@ -33,8 +40,10 @@ c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
 
     auto reduce_tensor = result.toTensorVector()[0];
     TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
-        reduce_tensor.scalar_type() == at::ScalarType::Half,
-        "Expected reduced tensor to be fp16 in FP16CompressHook, but got type ",
+        reduce_tensor.scalar_type() == dtype,
+        "Expected reduced tensor to be ",
+        dtype,
+        " in the compressed allreduce hook, but got type ",
         reduce_tensor.scalar_type());
     decompressed_tensor.copy_(reduce_tensor);
     return c10::IValue(decompressed_tensor);
@@ -43,6 +52,73 @@ c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
   return allreduce_fut->then(decompress, allreduce_fut->elementType());
 }
 
+} // namespace
+
+c10::intrusive_ptr<c10::ivalue::Future> AllReduceCommHook::runHook(
+    GradBucket& bucket) {
+  std::vector<at::Tensor> tensors = {bucket.getBufferRef()};
+  // Apply the division first to avoid overflow, especially for FP16.
+  tensors[0] /= state_->getSize();
+  return state_->allreduce(tensors)->getFuture();
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> FP16CompressCommHook::runHook(
+    GradBucket& bucket) {
+  return runCompressedAllReduceHook(state_, bucket, at::ScalarType::Half);
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> BF16CompressCommHook::runHook(
+    GradBucket& bucket) {
+  return runCompressedAllReduceHook(state_, bucket, at::ScalarType::BFloat16);
+}
+
+c10::intrusive_ptr<c10::ivalue::Future> INT8CompressCommHook::runHook(
+    GradBucket& bucket) {
+  auto& buffer = bucket.getBufferRef();
+  const int64_t world_size = state_->getSize();
+  const int64_t numel = buffer.numel();
+
+  auto& residual = residuals_[bucket.getIndex()];
+  if (!residual.defined() || residual.numel() != numel) {
+    // First iteration, or the reducer rebuilt its buckets; start error
+    // feedback from scratch.
+    residual = at::zeros_like(buffer, buffer.options().dtype(at::kFloat));
+  }
+
+  // Compensate this iteration's gradient with the quantization error left
+  // over from the previous one, then quantize symmetrically around zero.
+  // The scale stays on the device the whole time; nothing here syncs.
+  auto compensated = residual.add(buffer);
+  auto scale = compensated.abs().max().clamp_min_(1e-10).div_(127.0);
+  auto quantized =
+      compensated.div(scale).round_().clamp_(-127, 127).to(at::kChar);
+  residual = compensated.sub_(quantized.to(at::kFloat).mul_(scale));
+
+  // Summing int8 across ranks would overflow the wire dtype, so exchange
+  // the payload and the per-rank scales with allgathers instead and
+  // dequantize-sum locally. The payload is what dominates the bytes on the
+  // wire: numel int8 values per rank instead of numel fp32 values.
+  auto scale_in = scale.reshape({1});
+  auto scales_out = at::empty({world_size}, scale_in.options());
+  state_->_allgather_base(scales_out, scale_in);
+  auto quantized_out = at::empty({world_size * numel}, quantized.options());
+  auto allgather_fut =
+      state_->_allgather_base(quantized_out, quantized)->getFuture();
+
+  auto decompress = [buffer, scales_out, quantized_out, world_size, numel](
+                        c10::ivalue::Future& /* unused */) {
+    // Dequantize and sum over ranks in one GEMV, then divide for the mean.
+    auto all_q = quantized_out.view({world_size, numel}).to(at::kFloat);
+    auto reduced = at::mm(scales_out.view({1, world_size}), all_q)
+                       .view({numel})
+                       .div_(static_cast<double>(world_size));
+    buffer.copy_(reduced);
+    return c10::IValue(buffer);
+  };
+
+  return allgather_fut->then(decompress, allgather_fut->elementType());
+}
+
 c10::intrusive_ptr<c10::ivalue::Future> _AllReduceBySumCommHook::runHook(
     GradBucket& bucket) {
   std::vector<at::Tensor> tensors = {bucket.getBufferRef()};
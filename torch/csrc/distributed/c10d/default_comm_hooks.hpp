@@ -3,11 +3,15 @@
 #include <torch/csrc/distributed/c10d/ProcessGroup.hpp>
 #include <torch/csrc/distributed/c10d/comm.hpp>
 
+#include <unordered_map>
+
 namespace c10d {
 
 enum class BuiltinCommHookType : uint8_t {
   ALLREDUCE = 1,
   FP16_COMPRESS = 2,
+  BF16_COMPRESS = 3,
+  INT8_COMPRESS = 4,
 };
 
 class AllReduceCommHook
@@ -32,6 +36,40 @@ class FP16CompressCommHook
   c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
 };
 
+class BF16CompressCommHook
+    : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
+ public:
+  explicit BF16CompressCommHook(const c10::intrusive_ptr<ProcessGroup>& state)
+      : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state) {}
+
+  ~BF16CompressCommHook() override = default;
+
+  c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+};
+
+// Quantizes each bucket to int8 with a symmetric per-bucket scale and keeps
+// the quantization error in an fp32 residual that is added back to the next
+// iteration's gradient (error feedback), so the bias introduced by the
+// aggressive compression cancels out over time. Because an int8 allreduce
+// would overflow when summing across ranks, the compressed payload and the
+// per-rank scales are exchanged with allgathers and dequantize-summed on
+// each rank. The hook is stateful: residuals are kept per bucket index and
+// reset whenever the reducer rebuilds its buckets.
+class INT8CompressCommHook
+    : public CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>> {
+ public:
+  explicit INT8CompressCommHook(const c10::intrusive_ptr<ProcessGroup>& state)
+      : CppCommHookInterface<c10::intrusive_ptr<ProcessGroup>>(state) {}
+
+  ~INT8CompressCommHook() override = default;
+
+  c10::intrusive_ptr<c10::ivalue::Future> runHook(GradBucket& bucket) override;
+
+ private:
+  // Error-feedback residuals, keyed by bucket index.
+  std::unordered_map<size_t, at::Tensor> residuals_;
+};
+
 // Almost same as AllReduceCommHook, but without division inside the hook.
 // This enables the optimization of fusing copy and division and saves one scan
 // over all the input parameters, when no communication hook is provided by the
@@ -14,8 +14,12 @@
 #ifndef _WIN32
 #include <torch/csrc/distributed/c10d/HashStore.hpp>
 #endif
+#ifdef __linux__
+#include <torch/csrc/distributed/c10d/ShmStore.hpp>
+#endif
 #include <torch/csrc/distributed/c10d/FakeProcessGroup.hpp>
 #include <torch/csrc/distributed/c10d/ProcessGroup.hpp>
+#include <torch/csrc/distributed/c10d/ProcessGroupIntraProcess.hpp>
 #include <torch/csrc/distributed/c10d/PyProcessGroup.hpp>
 
 #ifdef USE_C10D_GLOO
@@ -531,9 +535,11 @@ Replaces the tensor in the bucket with the input tensor buffer.
 )");
 
   py::enum_<::c10d::BuiltinCommHookType>(module, "BuiltinCommHookType", R"(
-An enum-like class for built-in communication hooks: ``ALLREDUCE`` and ``FP16_COMPRESS``.)")
+An enum-like class for built-in communication hooks: ``ALLREDUCE``, ``FP16_COMPRESS``, ``BF16_COMPRESS`` and ``INT8_COMPRESS``.)")
       .value("ALLREDUCE", ::c10d::BuiltinCommHookType::ALLREDUCE)
-      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS);
+      .value("FP16_COMPRESS", ::c10d::BuiltinCommHookType::FP16_COMPRESS)
+      .value("BF16_COMPRESS", ::c10d::BuiltinCommHookType::BF16_COMPRESS)
+      .value("INT8_COMPRESS", ::c10d::BuiltinCommHookType::INT8_COMPRESS);
 
   shared_ptr_class_<::c10d::Reducer>(module, "Reducer")
       .def(
@@ -1499,6 +1505,39 @@ Example::
       .def(py::init<>());
 #endif
 
+#ifdef __linux__
+  intrusive_ptr_class_<::c10d::ShmStore>(
+      module,
+      "_ShmStore",
+      store,
+      R"(
+A store implementation backed by a POSIX shared memory segment, for rendezvous
+between processes running on the same host. Waiters block on a process-shared
+condition variable instead of polling, so local rendezvous does not pay
+filesystem round trips.
+
+Arguments:
+    name (str): Name of the shared memory segment; all participating processes
+        must pass the same name.
+    world_size (int, optional): The total number of processes using the store.
+        (default: ``-1`` (negative value indicates a non-fixed number of store users)).
+
+Example::
+    >>> import torch.distributed as dist
+    >>> store = dist._ShmStore("job_42", 2)
+    >>> # Use any of the store methods after initialization
+    >>> store.set("first_key", "first_value")
+      )")
+      .def(
+          py::init<const std::string&, int>(),
+          py::arg("name"),
+          py::arg("world_size") = -1)
+      .def_property_readonly(
+          "name",
+          &::c10d::ShmStore::getName,
+          R"(Gets the name of the shared memory segment used by the store.)");
+#endif
+
   intrusive_ptr_class_<::c10d::TCPStore>(
       module,
       "TCPStore",
@@ -1521,6 +1560,7 @@ Arguments:
     multi_tenant (bool, optional): If True, all ``TCPStore`` instances in the current process with the same host/port will use the same underlying ``TCPServer``. Default is False.
     master_listen_fd (int, optional): If specified, the underlying ``TCPServer`` will listen on this file descriptor, which must be a socket already bound to ``port``. Useful to avoid port assignment races in some scenarios. Default is None (meaning the server creates a new socket and attempts to bind it to ``port``).
     use_libuv (bool, optional): If True, use libuv for ``TCPServer`` backend. Default is True.
+    num_shards (int, optional): Number of server daemons the key space is sharded across. When greater than 1, the server starts ``num_shards`` daemons on consecutive ports starting at ``port`` and each key is routed to the daemon owning it, which spreads rendezvous traffic at large world sizes. All participants must pass the same value. Default is 1.
 Example::
     >>> import torch.distributed as dist
     >>> from datetime import timedelta
@@ -1541,7 +1581,8 @@ Example::
                       bool waitWorkers,
                       bool multiTenant,
                       std::optional<int> masterListenFd,
-                      bool useLibUV) {
+                      bool useLibUV,
+                      std::size_t numShards) {
             std::optional<std::size_t> numWorkers = std::nullopt;
             if (worldSize.has_value() && worldSize.value() > -1) {
               if (worldSize.value() == 0) {
@@ -1558,7 +1599,8 @@ Example::
                 timeout,
                 multiTenant,
                 masterListenFd,
-                useLibUV};
+                useLibUV,
+                numShards};
 
             return c10::make_intrusive<::c10d::TCPStore>(host, opts);
           }),
@@ -1574,6 +1616,7 @@ Example::
           py::arg("multi_tenant") = false,
           py::arg("master_listen_fd") = py::none(),
           py::arg("use_libuv") = true,
+          py::arg("num_shards") = 1,
           py::call_guard<py::gil_scoped_release>())
       .def_property_readonly(
           "host",
@@ -2592,6 +2635,21 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
           .def_readonly("backend", &::c10d::Backend::Options::backend)
           .def_readwrite("_timeout", &::c10d::Backend::Options::timeout);
 
+  // In-process CPU backend for thread-per-rank deployments; ranks attach
+  // to each other by constructing the group with the same name and size.
+  // NOLINTNEXTLINE(bugprone-unused-raii)
+  intrusive_ptr_no_gil_destructor_class_<::c10d::ProcessGroupIntraProcess>(
+      module, "ProcessGroupIntraProcess", backend)
+      .def(
+          py::init([](int rank, int size, const std::string& groupName) {
+            return c10::make_intrusive<::c10d::ProcessGroupIntraProcess>(
+                rank, size, groupName);
+          }),
+          py::arg("rank"),
+          py::arg("size"),
+          py::arg("group_name"),
+          py::call_guard<py::gil_scoped_release>());
+
 #ifdef USE_C10D_GLOO
   static const std::string GLOO_SOCKET_IFNAME_ENV = "GLOO_SOCKET_IFNAME";
 
@@ -2702,6 +2760,21 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
 #endif
 
 #ifdef USE_C10D_NCCL
+  py::class_<::c10d::CollectiveStats>(
+      module,
+      "_CollectiveStats",
+      R"(Record of one completed NCCL collective, drained from the process group's stats mailbox.)")
+      .def_readonly("seq", &::c10d::CollectiveStats::seq)
+      .def_property_readonly(
+          "op_type",
+          [](const ::c10d::CollectiveStats& self) {
+            return ::c10d::opTypeToString(self.opType);
+          })
+      .def_readonly("numel_in", &::c10d::CollectiveStats::numelIn)
+      .def_readonly("numel_out", &::c10d::CollectiveStats::numelOut)
+      .def_readonly("enqueue_time_ns", &::c10d::CollectiveStats::enqueueTimeNs)
+      .def_readonly("duration_ms", &::c10d::CollectiveStats::durationMs);
+
   auto processGroupNCCL =
       intrusive_ptr_no_gil_destructor_class_<::c10d::ProcessGroupNCCL>(
           module, "ProcessGroupNCCL", backend)
@@ -2739,6 +2812,10 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
           .def(
               "comm_split_count",
               &::c10d::ProcessGroupNCCL::getCommSplitCounter)
+          .def(
+              "_drain_collective_stats",
+              &::c10d::ProcessGroupNCCL::drainCollectiveStats,
+              py::call_guard<py::gil_scoped_release>())
           .def(
               "_set_default_timeout",
               [](const c10::intrusive_ptr<::c10d::ProcessGroupNCCL>& self,
@@ -2773,6 +2850,12 @@ options :class:`~torch.distributed.ProcessGroupNCCL.Options`).
           .def(
               "perform_nocolor_split",
               &::c10d::ProcessGroupNCCL::performNocolorSplit)
+          .def(
+              "shrink_to_survivors",
+              &::c10d::ProcessGroupNCCL::shrinkToSurvivors,
+              py::arg("device"),
+              py::arg("surviving_ranks"),
+              py::call_guard<py::gil_scoped_release>())
           .def(
               "abort",
               &::c10d::ProcessGroupNCCL::abort,
@@ -1902,6 +1902,14 @@ void Reducer::register_builtin_comm_hook(
       comm_hook_ = std::make_unique<c10d::FP16CompressCommHook>(process_group_);
       LOG(INFO) << "Built-in communication hook FP16_COMPRESS is registered.";
       break;
+    case c10d::BuiltinCommHookType::BF16_COMPRESS:
+      comm_hook_ = std::make_unique<c10d::BF16CompressCommHook>(process_group_);
+      LOG(INFO) << "Built-in communication hook BF16_COMPRESS is registered.";
+      break;
+    case c10d::BuiltinCommHookType::INT8_COMPRESS:
+      comm_hook_ = std::make_unique<c10d::INT8CompressCommHook>(process_group_);
+      LOG(INFO) << "Built-in communication hook INT8_COMPRESS is registered.";
+      break;
     default:
       TORCH_WARN_ONCE(
           "Unknown built-in DDP comm hook type is provided. No comm hook will be used.");
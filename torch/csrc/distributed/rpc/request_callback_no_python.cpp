@@ -388,13 +388,14 @@ c10::intrusive_ptr<JitFuture> RequestCallbackNoPython::
 c10::intrusive_ptr<JitFuture> RequestCallbackNoPython::
     processCleanupAutogradContextReq(RpcCommandBase& rpc) const {
   auto& cleanupContextReq = static_cast<CleanupAutogradContextReq&>(rpc);
-  auto cleanupContextId = cleanupContextReq.getContextId();
-  // release the context if it still exists on this thread. We need to
-  // check if it exists since it may have been deleted by an in-flight
+  // release the contexts if they still exist on this thread. We need to
+  // check if they exist since they may have been deleted by an in-flight
   // RPC. This can create nested RPCs if there are other nodes that get
   // notified to clean up their context.
-  DistAutogradContainer::getInstance().releaseContextIfPresent(
-      cleanupContextId);
+  for (const auto cleanupContextId : cleanupContextReq.getContextIds()) {
+    DistAutogradContainer::getInstance().releaseContextIfPresent(
+        cleanupContextId);
+  }
   return asFuture(CleanupAutogradContextResp().toMessage());
 }
 
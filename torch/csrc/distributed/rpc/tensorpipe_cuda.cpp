@@ -3,9 +3,15 @@
 
 #if defined(USE_TENSORPIPE) && !defined(USE_ROCM)
 
+#include <ATen/cuda/CUDAEvent.h>
 #include <c10/cuda/CUDACachingAllocator.h>
 #include <c10/cuda/CUDAGuard.h>
 #include <c10/cuda/CUDAStream.h>
+#include <c10/util/env.h>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
 
 C10_DIAGNOSTIC_PUSH_AND_IGNORED_IF_DEFINED("-Wdeprecated")
 #include <tensorpipe/tensorpipe.h>
@@ -70,6 +76,107 @@ C10_REGISTER_CREATOR(
     cuda_basic,
     makeCudaBasicChannel);
 
+// Note [Sticky CUDA receive buffers]
+// ~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~
+// The cuda_gdr channel registers the destination memory with libibverbs and
+// caches the registration per block, so receiving into the same blocks over
+// and over hits RDMA with no registration work on the hot path. The default
+// receive path instead grabs a fresh block from the caching allocator for
+// every message; whenever the allocator hands back a different block (e.g.
+// because the previous one is still referenced by the deserialized tensor),
+// the channel has to register it anew. When
+// TORCH_RPC_STICKY_CUDA_BUFFERS is set, receive buffers are instead drawn
+// from a per-device, size-keyed pool that holds onto its blocks for the
+// lifetime of the process, so repeated RPCs carrying same-shape tensors land
+// in already-registered memory. Reuse of a buffer is ordered after its
+// previous user via a CUDA event recorded when the prior tensor is released;
+// as with the caching allocator, a consumer that last touches the tensor on
+// a stream other than the one current at release time must synchronize on
+// its own. Pooled bytes are capped per device; buffers beyond the cap are
+// returned to the caching allocator.
+class StickyCudaBufferPool {
+ public:
+  static bool enabled() {
+    static bool enabled =
+        c10::utils::has_env("TORCH_RPC_STICKY_CUDA_BUFFERS");
+    return enabled;
+  }
+
+  static StickyCudaBufferPool& get() {
+    // Leaked to avoid destruction-order issues with CUDA teardown.
+    static auto* pool = new StickyCudaBufferPool();
+    return *pool;
+  }
+
+  at::DataPtr allocate(size_t length, at::cuda::CUDAStream stream) {
+    c10::DeviceIndex device = stream.device_index();
+    std::unique_ptr<Buffer> buffer;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      auto& freeList = freeLists_[device];
+      auto it = freeList.find(length);
+      if (it != freeList.end()) {
+        buffer = std::move(it->second);
+        freeList.erase(it);
+        pooledBytes_[device] -= length;
+      }
+    }
+    if (buffer) {
+      // The tensor deserialized from the previous receive into this buffer
+      // may still be in flight on another stream; order this receive after
+      // its release.
+      buffer->ready.block(stream);
+    } else {
+      at::cuda::CUDAStreamGuard guard(stream);
+      buffer = std::make_unique<Buffer>();
+      buffer->data = c10::cuda::CUDACachingAllocator::get()->allocate(length);
+      buffer->size = length;
+      buffer->device = device;
+    }
+    // Keep the caching allocator's stream bookkeeping accurate so that
+    // dropping a buffer (cap overflow) frees it safely.
+    c10::cuda::CUDACachingAllocator::recordStream(buffer->data, stream);
+    void* ptr = buffer->data.get();
+    return at::DataPtr(
+        ptr,
+        buffer.release(),
+        &returnBuffer,
+        c10::Device(c10::kCUDA, device));
+  }
+
+ private:
+  struct Buffer {
+    at::DataPtr data;
+    size_t size = 0;
+    c10::DeviceIndex device = 0;
+    // Recorded when the buffer is released, waited on before reuse.
+    at::cuda::CUDAEvent ready;
+  };
+
+  static void returnBuffer(void* ctx) {
+    std::unique_ptr<Buffer> buffer(static_cast<Buffer*>(ctx));
+    buffer->ready.record(c10::cuda::getCurrentCUDAStream(buffer->device));
+    auto& pool = get();
+    std::lock_guard<std::mutex> lock(pool.mutex_);
+    if (pool.pooledBytes_[buffer->device] + buffer->size >
+        kMaxPooledBytesPerDevice) {
+      // Let the DataPtr fall back to the caching allocator.
+      return;
+    }
+    pool.pooledBytes_[buffer->device] += buffer->size;
+    pool.freeLists_[buffer->device].emplace(buffer->size, std::move(buffer));
+  }
+
+  static constexpr size_t kMaxPooledBytesPerDevice = 1ull << 30; // 1 GiB
+
+  std::mutex mutex_;
+  std::unordered_map<
+      c10::DeviceIndex,
+      std::unordered_multimap<size_t, std::unique_ptr<Buffer>>>
+      freeLists_;
+  std::unordered_map<c10::DeviceIndex, size_t> pooledBytes_;
+};
+
 class TensorpipeCudaConverter : public TensorpipeDeviceTypeConverter {
  public:
   std::optional<std::vector<char>> prepareTensorForSending(
@@ -105,8 +212,9 @@ class TensorpipeCudaConverter : public TensorpipeDeviceTypeConverter {
     // CUDACachingAllocator will call recordStream accordingly on the current
     // stream.
     at::cuda::CUDAStreamGuard guard(stream);
-    at::DataPtr dataPtr =
-        c10::cuda::CUDACachingAllocator::get()->allocate(length);
+    at::DataPtr dataPtr = StickyCudaBufferPool::enabled()
+        ? StickyCudaBufferPool::get().allocate(length, stream)
+        : c10::cuda::CUDACachingAllocator::get()->allocate(length);
 
     tensorpipe::CudaBuffer buffer;
     buffer.ptr = dataPtr.get();
@@ -1,5 +1,6 @@
 #include <torch/csrc/dynamo/extra_state.h>
 
+#include <torch/csrc/autograd/python_variable.h>
 #include <torch/csrc/dynamo/cache_entry.h>
 #include <torch/csrc/dynamo/cpython_defs.h>
 #include <torch/csrc/dynamo/debug_macros.h>
@@ -7,6 +8,8 @@
 #include <torch/csrc/dynamo/guards.h>
 #include <torch/csrc/utils/python_compat.h>
 
+#include <cstring>
+
 #if IS_PYTHON_3_12_PLUS
 #define _PyCode_GetExtra PyUnstable_Code_GetExtra
 #define _PyCode_SetExtra PyUnstable_Code_SetExtra
@@ -35,6 +38,15 @@ void ExtraState::invalidate(CacheEntry* cache_entry) {
   CHECK(cache_entry->_owner == this);
   CHECK(!this->cache_entry_list.empty());
   CHECK(cache_entry == &*cache_entry->_owner_loc);
+  // Drop any fingerprint hints pointing at the entry being erased.
+  for (auto it = this->fingerprint_index.begin();
+       it != this->fingerprint_index.end();) {
+    if (it->second == cache_entry) {
+      it = this->fingerprint_index.erase(it);
+    } else {
+      ++it;
+    }
+  }
   this->cache_entry_list.erase(cache_entry->_owner_loc);
 }
 
@@ -109,54 +121,168 @@ bool backend_match(PyObject* saved_backend, PyObject* backend) {
   return true;
 }
 
+static inline uint64_t hash_combine_u64(uint64_t seed, uint64_t value) {
+  // 64-bit variant of boost::hash_combine.
+  return seed ^ (value + 0x9e3779b97f4a7c15ULL + (seed << 6) + (seed >> 2));
+}
+
+// Cheap structural fingerprint of the frame locals, used to index into the
+// cache entry list. Only properties the guards commonly check are mixed in:
+// tensor dtype/device/shape/requires_grad, int/float/str values, and the
+// python type of everything else. Collisions and instability are harmless
+// because the indexed entry's guards still run before it is used.
+static uint64_t compute_locals_fingerprint(PyObject* f_locals) {
+  uint64_t hash = 0xcbf29ce484222325ULL;
+  if (!PyDict_CheckExact(f_locals)) {
+    return hash;
+  }
+  PyObject* key = nullptr;
+  PyObject* value = nullptr;
+  Py_ssize_t pos = 0;
+  while (PyDict_Next(f_locals, &pos, &key, &value)) {
+    // The dict order is the local variable order, which is stable for a given
+    // code object, so the position itself identifies the variable.
+    hash = hash_combine_u64(hash, (uint64_t)(uintptr_t)Py_TYPE(value));
+    if (THPVariable_Check(value)) {
+      const at::Tensor& tensor = THPVariable_Unpack(value);
+      hash = hash_combine_u64(hash, (uint64_t)tensor.scalar_type());
+      hash = hash_combine_u64(hash, (uint64_t)tensor.device().type());
+      hash = hash_combine_u64(hash, (uint64_t)tensor.device().index());
+      hash = hash_combine_u64(hash, (uint64_t)tensor.requires_grad());
+      for (auto size : tensor.sizes()) {
+        hash = hash_combine_u64(hash, (uint64_t)size);
+      }
+    } else if (value == Py_True || value == Py_False || value == Py_None) {
+      hash = hash_combine_u64(hash, (uint64_t)(uintptr_t)value);
+    } else if (PyLong_CheckExact(value)) {
+      int overflow = 0;
+      long long as_int = PyLong_AsLongLongAndOverflow(value, &overflow);
+      hash = hash_combine_u64(hash, (uint64_t)as_int);
+      hash = hash_combine_u64(hash, (uint64_t)overflow);
+    } else if (PyFloat_CheckExact(value)) {
+      double as_double = PyFloat_AS_DOUBLE(value);
+      uint64_t bits = 0;
+      std::memcpy(&bits, &as_double, sizeof(bits));
+      hash = hash_combine_u64(hash, bits);
+    } else if (PyUnicode_CheckExact(value)) {
+      // Unicode hashing is cached and never calls back into user code.
+      hash = hash_combine_u64(hash, (uint64_t)PyObject_Hash(value));
+    } else if (PyTuple_CheckExact(value) || PyList_CheckExact(value)) {
+      hash = hash_combine_u64(hash, (uint64_t)PySequence_Length(value));
+    }
+  }
+  return hash;
+}
+
+namespace {
+enum class GuardCheckResult { Match, NoMatch, Error };
+} // namespace
+
+// Runs the backend match and the guards of one cache entry. On Error, the
+// python error has been restored (possibly after calling guard_error_hook)
+// and the caller must bail out of the lookup.
+static GuardCheckResult check_cache_entry(
+    CacheEntry& cache_entry,
+    PyObject* backend,
+    py::handle locals,
+    PyObject* f_locals,
+    size_t index,
+    bool is_last) {
+  // Check backend. Py_False means run only mode.
+  bool valid =
+      backend == Py_False || backend_match(cache_entry.backend, backend);
+
+  if (valid) {
+    try {
+      // TODO(anijain2305) - Clean this up when enable_cpp_guard_manager is
+      // True by default
+      if (cache_entry.root_mgr != nullptr) {
+        valid = torch::dynamo::run_root_guard_manager(
+            cache_entry.root_mgr, f_locals);
+      } else {
+        valid = cache_entry.check_fn(locals).cast<bool>();
+      }
+    } catch (py::error_already_set& e) {
+      if (guard_error_hook) {
+        py::handle guard_error_hook_handle(guard_error_hook);
+        guard_error_hook_handle(
+            cache_entry.check_fn, cache_entry.code, locals, index, is_last);
+      }
+      // this function is called from C, so we cannot repropagate
+      // the exception
+      e.restore();
+      return GuardCheckResult::Error;
+    }
+  }
+  return valid ? GuardCheckResult::Match : GuardCheckResult::NoMatch;
+}
+
 void lookup(
     ExtraState* extra_state,
     PyObject* f_locals,
     PyObject* backend,
     PyObject** maybe_cached_code,
     const char** trace_annotation) {
-  size_t index = 0;
   CacheEntry* found = nullptr;
   py::handle locals(f_locals);
-  for (CacheEntry& cache_entry : extra_state->cache_entry_list) {
-    // Check backend. Py_False means run only mode.
-
-    bool valid =
-        backend == Py_False || backend_match(cache_entry.backend, backend);
-
-    if (valid) {
-      try {
-        // TODO(anijain2305) - Clean this up when enable_cpp_guard_manager is
-        // True by default
-        if (cache_entry.root_mgr != nullptr) {
-          valid = torch::dynamo::run_root_guard_manager(
-              cache_entry.root_mgr, f_locals);
-        } else {
-          valid = cache_entry.check_fn(locals).cast<bool>();
-        }
-      } catch (py::error_already_set& e) {
-        if (guard_error_hook) {
-          py::handle guard_error_hook_handle(guard_error_hook);
-          guard_error_hook_handle(
-              cache_entry.check_fn,
-              cache_entry.code,
-              locals,
-              index,
-              index == extra_state->cache_entry_list.size() - 1);
-        }
-        // this function is called from C, so we cannot repropagate
-        // the exception
-        e.restore();
+
+  // Level 1: try the entry whose guards last passed for this locals
+  // fingerprint, skipping the scan entirely on a hit. Not worth the hashing
+  // cost when there is at most one entry.
+  const bool use_fingerprint = extra_state->cache_entry_list.size() > 1;
+  uint64_t fingerprint = 0;
+  if (use_fingerprint) {
+    fingerprint = compute_locals_fingerprint(f_locals);
+    auto hint_it = extra_state->fingerprint_index.find(fingerprint);
+    if (hint_it != extra_state->fingerprint_index.end()) {
+      CacheEntry* hinted = hint_it->second;
+      GuardCheckResult result = check_cache_entry(
+          *hinted,
+          backend,
+          locals,
+          f_locals,
+          0,
+          extra_state->cache_entry_list.size() == 1);
+      if (result == GuardCheckResult::Error) {
         *maybe_cached_code = nullptr;
         return;
       }
+      if (result == GuardCheckResult::Match) {
+        found = hinted;
+      } else {
+        // The hint went stale (e.g. a scalar changed); drop it and fall back
+        // to the scan, which re-learns the mapping on success.
+        extra_state->fingerprint_index.erase(hint_it);
+      }
     }
-    if (valid) {
-      found = &cache_entry;
-      break;
+  }
+
+  // Level 2: linear scan over all the entries.
+  if (found == nullptr) {
+    size_t index = 0;
+    for (CacheEntry& cache_entry : extra_state->cache_entry_list) {
+      GuardCheckResult result = check_cache_entry(
+          cache_entry,
+          backend,
+          locals,
+          f_locals,
+          index,
+          index == extra_state->cache_entry_list.size() - 1);
+      if (result == GuardCheckResult::Error) {
+        *maybe_cached_code = nullptr;
+        return;
+      }
+      if (result == GuardCheckResult::Match) {
+        found = &cache_entry;
+        if (use_fingerprint) {
+          extra_state->fingerprint_index[fingerprint] = found;
+        }
+        break;
+      }
+      ++index;
     }
-    ++index;
   }
+
   if (found) {
     extra_state->move_to_front(found);
     *maybe_cached_code = found->code.ptr();
@@ -7,6 +7,7 @@
 #include <torch/csrc/dynamo/utils.h>
 #include <torch/csrc/utils/pybind.h>
 #include <list>
+#include <unordered_map>
 
 namespace py = pybind11;
 
@@ -42,6 +43,12 @@ typedef struct CacheEntry CacheEntry;
 typedef struct VISIBILITY_HIDDEN ExtraState {
   // List of cache entries for compiled code objects
   std::list<CacheEntry> cache_entry_list;
+  // Maps the structural fingerprint of the frame locals (tensor shapes,
+  // dtypes, scalar values) to the cache entry whose guards last passed for
+  // it, so lookup can try the likely entry first instead of scanning the
+  // list. The fingerprint is only a hint - the entry's guards still run -
+  // and the linear scan stays as the fallback.
+  std::unordered_map<uint64_t, CacheEntry*> fingerprint_index;
   // Frame state to detect dynamic shape dims
   py::dict frame_state;
   bool cache_limit_hit{false};
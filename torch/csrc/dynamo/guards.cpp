@@ -25,6 +25,7 @@
 #include <ATen/xpu/EmptyTensor.h>
 #endif
 
+#include <cstdlib>
 #include <sstream>
 #include <tuple>
 #include <utility>
@@ -1522,6 +1523,16 @@ std::unique_ptr<GuardManager> make_guard_manager(
  * GuardAccessor also owns the GuardManager associated with the retrieved
  * value from the GuardAccessor.
  */
+// Flat guard lowering replaces the recursive GuardManager walk with a single
+// straight-line pass over a precomputed step table (see
+// RootGuardManager::build_flat_plan). It is opt-in while it soaks; set
+// TORCHDYNAMO_FLAT_GUARDS=1 or call torch._C._dynamo.guards
+// set_flat_guards_enabled.
+static bool& flat_guards_enabled() {
+  static bool enabled = std::getenv("TORCHDYNAMO_FLAT_GUARDS") != nullptr;
+  return enabled;
+}
+
 class GuardAccessor {
  public:
   GuardAccessor(
@@ -1557,6 +1568,19 @@ class GuardAccessor {
   virtual GuardDebugInfo check_verbose_nopybind(PyObject* obj) = 0;
   virtual std::string repr() const = 0;
 
+  // Flat guard lowering support. Accessors whose fetch can be separated from
+  // the subtree recursion override has_flat_access to return true and
+  // implement access_nopybind, which returns a NEW reference to the child
+  // value, or nullptr (with any error cleared) when the access fails and the
+  // guard should fail. Accessors with side channels (e.g. lambda accessors)
+  // keep the default and force the tree walk.
+  virtual bool has_flat_access() const {
+    return false;
+  }
+  virtual PyObject* access_nopybind(PyObject* obj) { // new ref
+    return nullptr;
+  }
+
   virtual ~GuardAccessor() = default;
 
  protected:
@@ -1651,6 +1675,14 @@ class GuardManager {
 
   virtual void add_leaf_guard(std::shared_ptr<LeafGuard> leaf_guard) {
     _leaf_guards.emplace_back(std::move(leaf_guard));
+    _notify_tree_mutation();
+  }
+
+  // Whether this manager node can be lowered into the root's flat guard
+  // plan. DictGuardManager walks dict entries itself rather than through
+  // accessors, so it cannot.
+  virtual bool is_flattenable() const {
+    return true;
   }
 
   /**
@@ -1680,6 +1712,7 @@ class GuardManager {
         source,
         example_value,
         guard_manager_enum));
+    _notify_tree_mutation();
     return _accessors.back()->get_guard_manager().get();
   }
 
@@ -1876,6 +1909,10 @@ class GuardManager {
   // False. This is used for sorting optimization.
   int64_t _fail_count{0};
 
+  // Tells the root that the tree changed shape so that any lowered flat plan
+  // is rebuilt on the next check. Defined after RootGuardManager.
+  void _notify_tree_mutation();
+
  private:
   // Root of the guard manager, this is the used to install the relational
   // guard resetters.
@@ -1911,6 +1948,23 @@ class GuardManager {
   uint64_t _dict_tag{0};
 };
 
+/**
+ * One step of a lowered guard plan. The whole guard tree (root leaf guards
+ * and epilogue guards excepted) is flattened into a vector of these, and
+ * checked with a single non-recursive loop over a table of fetched values.
+ */
+struct FlatGuardStep {
+  enum class Kind : uint8_t { Leaf, Access };
+  Kind kind;
+  // Index of the value this step operates on in the slot table. Slot 0 is
+  // the value passed to RootGuardManager::check.
+  int32_t input_slot;
+  // For Access steps, the slot the fetched value is stored into.
+  int32_t output_slot;
+  LeafGuard* leaf{nullptr};
+  GuardAccessor* accessor{nullptr};
+};
+
 /**
  * RootGuardManager is the root of the guard tree. This is primarily
  * constructed to hold the relational guard pointers so that we can reset the
@@ -1968,7 +2022,21 @@ class RootGuardManager : public GuardManager {
     at::impl::PythonTorchFunctionTLS::set_disabled_state(
         at::impl::TorchFunctionDisabledState::ALL_DISABLED);
 
-    if (!GuardManager::check_accessors_nopybind(value)) {
+    bool accessors_passed = false;
+    if (flat_guards_enabled()) {
+      if (!_flat_plan_built) {
+        build_flat_plan();
+      }
+      // Fall back to the tree walk when the tree has nodes that cannot be
+      // lowered (DictGuardManager, lambda accessors, ...).
+      accessors_passed = _flat_plan_valid
+          ? run_flat_plan(value)
+          : GuardManager::check_accessors_nopybind(value);
+    } else {
+      accessors_passed = GuardManager::check_accessors_nopybind(value);
+    }
+
+    if (!accessors_passed) {
       at::impl::PythonTorchFunctionTLS::set_disabled_state(old_state);
       _reset_relational_guard_state();
       return false;
@@ -2068,7 +2136,104 @@ class RootGuardManager : public GuardManager {
     return ret;
   }
 
+  // Drops the lowered plan; it is rebuilt lazily on the next check. Called
+  // whenever a leaf guard or accessor is added anywhere in the tree.
+  void invalidate_flat_plan() {
+    _flat_plan_built = false;
+    _flat_plan_valid = false;
+    _flat_steps.clear();
+  }
+
  private:
+  // Lowers the guard tree into _flat_steps. The root's own leaf guards and
+  // the epilogue guards are not lowered; they keep running in
+  // check_nopybind around the accessor section. The plan freezes the
+  // accessor order of the moment, so the fail-count resorting optimization
+  // does not apply while it is in use.
+  void build_flat_plan() {
+    _flat_plan_built = true;
+    _flat_steps.clear();
+    _num_flat_slots = 1;
+    _flat_plan_valid = lower_into_flat_plan(this, 0);
+    if (!_flat_plan_valid) {
+      _flat_steps.clear();
+      return;
+    }
+    _flat_slots.resize(_num_flat_slots);
+  }
+
+  bool lower_into_flat_plan(GuardManager* manager, int32_t slot) {
+    if (!manager->is_flattenable()) {
+      return false;
+    }
+    if (manager != this) {
+      for (auto* leaf : manager->get_leaf_guards()) {
+        FlatGuardStep step{};
+        step.kind = FlatGuardStep::Kind::Leaf;
+        step.input_slot = slot;
+        step.output_slot = -1;
+        step.leaf = leaf;
+        _flat_steps.emplace_back(step);
+      }
+    }
+    for (auto* accessor : manager->get_accessors()) {
+      if (!accessor->has_flat_access()) {
+        return false;
+      }
+      int32_t child_slot = _num_flat_slots++;
+      FlatGuardStep step{};
+      step.kind = FlatGuardStep::Kind::Access;
+      step.input_slot = slot;
+      step.output_slot = child_slot;
+      step.accessor = accessor;
+      _flat_steps.emplace_back(step);
+      if (!lower_into_flat_plan(
+              accessor->get_guard_manager().get(), child_slot)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Straight-line walk over the lowered steps. Every Access step stores a
+  // new reference into its output slot; the references are released in bulk
+  // at the end. DFS emission order guarantees that an input slot is always
+  // filled before the steps that read it. _flat_slots is a member scratch
+  // buffer, safe because check_nopybind holds _lock. Note that the flat walk
+  // does not consult dict version tags and does not update fail counts.
+  bool run_flat_plan(PyObject* value) {
+    _flat_slots[0] = value;
+    bool result = true;
+    for (const FlatGuardStep& step : _flat_steps) {
+      if (step.kind == FlatGuardStep::Kind::Leaf) {
+        if (!step.leaf->check_nopybind(_flat_slots[step.input_slot])) {
+          result = false;
+          break;
+        }
+      } else {
+        PyObject* fetched =
+            step.accessor->access_nopybind(_flat_slots[step.input_slot]);
+        if (fetched == nullptr) {
+          result = false;
+          break;
+        }
+        _flat_slots[step.output_slot] = fetched;
+      }
+    }
+    for (int32_t slot = 1; slot < _num_flat_slots; slot++) {
+      Py_XDECREF(_flat_slots[slot]);
+      _flat_slots[slot] = nullptr;
+    }
+    return result;
+  }
+
+  // The lowered guard plan and its value scratch table.
+  std::vector<FlatGuardStep> _flat_steps;
+  std::vector<PyObject*> _flat_slots;
+  int32_t _num_flat_slots{1};
+  bool _flat_plan_built{false};
+  bool _flat_plan_valid{false};
+
   // Reset the state of all the relational guards on failure.
   void _reset_relational_guard_state() {
     for (auto& guard : _relational_guard_resetters) {
@@ -2120,6 +2285,10 @@ class RootGuardManager : public GuardManager {
   bool _init_local_state = false;
 };
 
+void GuardManager::_notify_tree_mutation() {
+  _root->invalidate_flat_plan();
+}
+
 /*
  * Dicts are common in python code. Therefore, we handle guards for dicts
  * differently and use PyDict_* APIs which are faster than PyObject_* APIs
@@ -2141,6 +2310,12 @@ class DictGuardManager : public GuardManager {
         _expected_type(Py_TYPE(example_value.ptr())),
         _is_exact_dict_type(PyDict_CheckExact(example_value.ptr())) {}
 
+  // DictGuardManager iterates over the dict entries itself instead of going
+  // through accessors, so it cannot be lowered into the flat guard plan.
+  bool is_flattenable() const override {
+    return false;
+  }
+
   GuardManager* get_key_manager(
       py::object key_index,
       std::string source,
@@ -2782,6 +2957,19 @@ class GetAttrGuardAccessor : public GuardAccessor {
     return result;
   }
 
+  bool has_flat_access() const override {
+    return true;
+  }
+
+  PyObject* access_nopybind(PyObject* obj) override { // new ref
+    PyObject* x = PyObject_GetAttr(obj, _attr_name); // new ref
+    if (x == nullptr) {
+      // Attribute absent, clear the exception and fail the guard.
+      PyErr_Clear();
+    }
+    return x;
+  }
+
   std::string repr() const override {
     // Helpful when priting GuardManager tree structure.
     return "GetAttrGuardAccessor(" + py::str(_attr_name).cast<std::string>() +
@@ -2841,6 +3029,19 @@ class GetGenericDictGuardAccessor : public GuardAccessor {
     return result;
   }
 
+  bool has_flat_access() const override {
+    return true;
+  }
+
+  PyObject* access_nopybind(PyObject* obj) override { // new ref
+    PyObject* x = PyObject_GenericGetDict(obj, nullptr); // new ref
+    if (x == nullptr) {
+      // Attribute absent, clear the exception and fail the guard.
+      PyErr_Clear();
+    }
+    return x;
+  }
+
   std::string repr() const override {
     // Helpful when priting GuardManager tree structure.
     return "GetGenericDictGuardAccessor";
@@ -2893,6 +3094,18 @@ class GetItemGuardAccessor : public GuardAccessor {
     return result;
   }
 
+  bool has_flat_access() const override {
+    return true;
+  }
+
+  PyObject* access_nopybind(PyObject* obj) override { // new ref
+    PyObject* x = PyObject_GetItem(obj, _attr_name); // new ref
+    if (x == nullptr) {
+      PyErr_Clear();
+    }
+    return x;
+  }
+
   std::string repr() const override {
     return "GetItemGuardAccessor(" + py::str(_attr_name).cast<std::string>() +
         ")";
@@ -2956,6 +3169,22 @@ class DictGetItemGuardAccessor : public GuardAccessor {
     return result;
   }
 
+  bool has_flat_access() const override {
+    return true;
+  }
+
+  PyObject* access_nopybind(PyObject* obj) override { // new ref
+    // NB: the flat plan does not consult dict version tags, so the
+    // immutable-object subtree skip does not apply here.
+    PyObject* x = PyDict_GetItem(obj, _key); // borrowed ref
+    if (x == nullptr) {
+      PyErr_Clear();
+      return nullptr;
+    }
+    Py_INCREF(x);
+    return x;
+  }
+
   std::string repr() const override {
     return "DictGetItemGuardAccessor(" + py::str(_key).cast<std::string>() +
         ")";
@@ -3014,6 +3243,20 @@ class ListGetItemGuardAccessor : public GuardAccessor {
     return result;
   }
 
+  bool has_flat_access() const override {
+    return true;
+  }
+
+  PyObject* access_nopybind(PyObject* obj) override { // new ref
+    PyObject* x = PyList_GetItem(obj, _index); // borrowed ref
+    if (x == nullptr) {
+      PyErr_Clear();
+      return nullptr;
+    }
+    Py_INCREF(x);
+    return x;
+  }
+
   std::string repr() const override {
     return "ListGetItemGuardAccessor(" + std::to_string(_index) + ")";
   }
@@ -3067,6 +3310,20 @@ class TupleGetItemGuardAccessor : public GuardAccessor {
     return result;
   }
 
+  bool has_flat_access() const override {
+    return true;
+  }
+
+  PyObject* access_nopybind(PyObject* obj) override { // new ref
+    PyObject* x = PyTuple_GetItem(obj, _index); // borrowed ref
+    if (x == nullptr) {
+      PyErr_Clear();
+      return nullptr;
+    }
+    Py_INCREF(x);
+    return x;
+  }
+
   std::string repr() const override {
     return "TupleGetItemGuardAccessor(" + std::to_string(_index) + ")";
   }
@@ -3290,6 +3547,16 @@ class GlobalsGuardAccessor : public GuardAccessor {
     return _guard_manager->check_verbose_nopybind(_globals_dict);
   }
 
+  bool has_flat_access() const override {
+    return true;
+  }
+
+  PyObject* access_nopybind(PyObject* obj) override { // new ref
+    // Ignore the obj arg; hand out the globals dict, same as check_nopybind.
+    Py_INCREF(_globals_dict);
+    return _globals_dict;
+  }
+
   std::string repr() const override {
     return "GlobalsGuardAccessor";
   }
@@ -3333,6 +3600,16 @@ class TypeGuardAccessor : public GuardAccessor {
     return _guard_manager->check_verbose_nopybind(x);
   }
 
+  bool has_flat_access() const override {
+    return true;
+  }
+
+  PyObject* access_nopybind(PyObject* obj) override { // new ref
+    PyObject* x = (PyObject*)Py_TYPE(obj); // borrowed ref
+    Py_INCREF(x);
+    return x;
+  }
+
   std::string repr() const override {
     return "TypeGuardAccessor";
   }
@@ -4498,6 +4775,10 @@ PyObject* torch_c_dynamo_guards_init() {
   py_m.def("install_object_aliasing_guard", install_object_aliasing_guard);
   py_m.def(
       "install_no_tensor_aliasing_guard", install_no_tensor_aliasing_guard);
+  py_m.def("set_flat_guards_enabled", [](bool enabled) {
+    flat_guards_enabled() = enabled;
+  });
+  py_m.def("flat_guards_enabled", []() { return flat_guards_enabled(); });
 
 // initialize dict_version_map watcher for 3.12
 #if IS_PYTHON_3_12_PLUS
@@ -101,10 +101,80 @@ static PyTypeObject NodeBaseType = {
     NodeBase_new, /* tp_new */
 };
 
+// Returns 1 if getattr(obj, name) compares equal to expected, 0 if it does
+// not, -1 on error.
+static int compare_attribute(
+    PyObject* obj,
+    PyObject* name,
+    PyObject* expected) {
+  PyObject* value = PyObject_GetAttr(obj, name);
+  if (!value) {
+    return -1;
+  }
+  int eq = PyObject_RichCompareBool(value, expected, Py_EQ);
+  Py_DECREF(value);
+  return eq;
+}
+
+// Walks the node list starting at `root` and returns the non-erased nodes
+// whose `op` and `target` compare equal to the given values. This is the
+// inner loop of anchor candidate collection in subgraph matching; doing the
+// scan here keeps passes over large graphs from being bound by a Python loop
+// over every node.
+static PyObject* py_fx_find_matching_nodes(PyObject* self, PyObject* args) {
+  PyObject* root_obj = nullptr;
+  PyObject* op = nullptr;
+  PyObject* target = nullptr;
+  if (!PyArg_ParseTuple(args, "O!UO", &NodeBaseType, &root_obj, &op, &target)) {
+    return nullptr;
+  }
+  static PyObject* op_attr = PyUnicode_InternFromString("op");
+  static PyObject* target_attr = PyUnicode_InternFromString("target");
+  PyObject* result = PyList_New(0);
+  if (!result) {
+    return nullptr;
+  }
+  NodeBase* root = (NodeBase*)root_obj;
+  // Hold a strong reference to the current node: the comparisons below can
+  // run arbitrary __eq__ code which may mutate the graph.
+  NodeBase* cur = (NodeBase*)Py_NewRef(root->_next);
+  while (cur != root) {
+    int eq = 0;
+    if (!cur->_erased) {
+      eq = compare_attribute((PyObject*)cur, op_attr, op);
+      if (eq > 0) {
+        eq = compare_attribute((PyObject*)cur, target_attr, target);
+      }
+    }
+    if (eq < 0 || (eq > 0 && PyList_Append(result, (PyObject*)cur) < 0)) {
+      Py_DECREF(cur);
+      Py_DECREF(result);
+      return nullptr;
+    }
+    NodeBase* next = (NodeBase*)Py_NewRef(cur->_next);
+    Py_DECREF(cur);
+    cur = next;
+  }
+  Py_DECREF(cur);
+  return result;
+}
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+static PyMethodDef fx_functions[] = {
+    {"_fx_find_matching_nodes",
+     py_fx_find_matching_nodes,
+     METH_VARARGS,
+     nullptr},
+    {nullptr} /* Sentinel */
+};
+
 bool NodeBase_init(PyObject* module) {
   if (PyModule_AddType(module, &NodeBaseType) < 0) {
     return false;
   }
+  if (PyModule_AddFunctions(module, fx_functions) < 0) {
+    return false;
+  }
   return true;
 }
 
@@ -29,7 +29,8 @@ AOTIModelContainerRunner::AOTIModelContainerRunner(
     const std::string& model_so_path,
     size_t num_models,
     const std::string& device_str,
-    const std::string& cubin_dir) {
+    const std::string& cubin_dir,
+    AOTIModelContainerRunner* shared_weights_from) {
   model_so_ = std::make_unique<at::DynamicLibrary>(model_so_path.c_str());
   TORCH_CHECK(model_so_, "Failed to load model: ", model_so_path);
   create_func_ = reinterpret_cast<decltype(create_func_)>(
@@ -76,11 +77,38 @@ AOTIModelContainerRunner::AOTIModelContainerRunner(
         reinterpret_cast<AOTIProxyExecutorHandle>(proxy_executor_.get());
   }
 
-  AOTI_RUNTIME_ERROR_CODE_CHECK(create_func_(
-      &container_handle_,
-      num_models,
-      device_str.c_str(),
-      cubin_dir.empty() ? nullptr : cubin_dir.c_str()));
+  if (shared_weights_from != nullptr) {
+    TORCH_CHECK(
+        shared_weights_from != this,
+        "Cannot share weights with the runner being constructed");
+    // The symbol is resolved lazily so that model.so files built before it
+    // existed keep working as long as weight sharing is not requested.
+    decltype(&AOTInductorModelContainerCreateWithSharedConstants)
+        create_shared_func = nullptr;
+    try {
+      create_shared_func = reinterpret_cast<decltype(create_shared_func)>(
+          model_so_->sym("AOTInductorModelContainerCreateWithSharedConstants"));
+    } catch (const std::exception&) {
+      TORCH_CHECK(
+          false,
+          "Failed to find AOTInductorModelContainerCreateWithSharedConstants in ",
+          model_so_path,
+          "; the model was compiled before weight sharing was supported. "
+          "Recompile it to share weights across runners.");
+    }
+    AOTI_RUNTIME_ERROR_CODE_CHECK(create_shared_func(
+        &container_handle_,
+        num_models,
+        device_str.c_str(),
+        cubin_dir.empty() ? nullptr : cubin_dir.c_str(),
+        shared_weights_from->container_handle_));
+  } else {
+    AOTI_RUNTIME_ERROR_CODE_CHECK(create_func_(
+        &container_handle_,
+        num_models,
+        device_str.c_str(),
+        cubin_dir.empty() ? nullptr : cubin_dir.c_str()));
+  }
 }
 
 AOTIModelContainerRunner::~AOTIModelContainerRunner() {
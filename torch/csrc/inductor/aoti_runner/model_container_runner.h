@@ -22,7 +22,7 @@ class TORCH_API AOTIModelContainerRunner {
       delete;
   AOTIModelContainerRunner& operator=(AOTIModelContainerRunner&& other) =
       delete;
-  ~AOTIModelContainerRunner();
+  virtual ~AOTIModelContainerRunner();
 
   std::vector<at::Tensor> run(
       std::vector<at::Tensor>& inputs,
@@ -39,16 +39,25 @@ class TORCH_API AOTIModelContainerRunner {
   void run_const_fold(
       bool use_inactive,
       AOTInductorStreamHandle cuda_stream_handle = nullptr);
-  void swap_constant_buffer();
+  virtual void swap_constant_buffer();
 
   std::vector<std::string> get_call_spec();
 
  protected:
+  // If `shared_weights_from` is not nullptr, the new runner attaches to that
+  // runner's constant buffer (e.g. the weights in device memory) instead of
+  // loading its own copy, so multiple replicas of the same model only hold the
+  // weights once. Both runners must be created from the same model_so_path,
+  // and the owning runner must outlive every runner attached to it. Weight
+  // hot-swapping (update_inactive_constant_buffer + swap_constant_buffer) goes
+  // through the owning runner, which propagates the new constants to all
+  // attached runners.
   AOTIModelContainerRunner(
       const std::string& model_so_path,
       size_t num_models,
       const std::string& device_str,
-      const std::string& cubin_dir);
+      const std::string& cubin_dir,
+      AOTIModelContainerRunner* shared_weights_from = nullptr);
 
   std::unique_ptr<at::DynamicLibrary> model_so_;
   decltype(&AOTInductorModelContainerCreateWithDevice) create_func_{nullptr};
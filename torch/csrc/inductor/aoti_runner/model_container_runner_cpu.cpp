@@ -7,8 +7,14 @@ namespace torch::inductor {
 // We provide NO BC guarantee for these APIs
 AOTIModelContainerRunnerCpu::AOTIModelContainerRunnerCpu(
     const std::string& model_so_path,
-    size_t num_models)
-    : AOTIModelContainerRunner(model_so_path, num_models, "cpu", "") {}
+    size_t num_models,
+    AOTIModelContainerRunner* shared_weights_from)
+    : AOTIModelContainerRunner(
+          model_so_path,
+          num_models,
+          "cpu",
+          "",
+          shared_weights_from) {}
 
 AOTIModelContainerRunnerCpu::~AOTIModelContainerRunnerCpu() = default;
 
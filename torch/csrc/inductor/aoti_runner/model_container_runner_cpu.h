@@ -6,9 +6,12 @@
 namespace torch::inductor {
 class TORCH_API AOTIModelContainerRunnerCpu : public AOTIModelContainerRunner {
  public:
+  // @param shared_weights_from: if not nullptr, share the constant buffer of
+  // that runner instead of loading a separate copy; see the base class ctor
   AOTIModelContainerRunnerCpu(
       const std::string& model_so_path,
-      size_t num_models = 1);
+      size_t num_models = 1,
+      AOTIModelContainerRunner* shared_weights_from = nullptr);
 
   ~AOTIModelContainerRunnerCpu();
 
@@ -1,4 +1,7 @@
 #if !defined(C10_MOBILE) && !defined(ANDROID)
+#include <ATen/cuda/CUDAEvent.h>
+#include <c10/cuda/CUDACachingAllocator.h>
+#include <c10/cuda/CUDAGuard.h>
 #include <torch/csrc/inductor/aoti_runner/model_container_runner_cuda.h>
 
 namespace torch::inductor {
@@ -7,12 +10,14 @@ AOTIModelContainerRunnerCuda::AOTIModelContainerRunnerCuda(
     const std::string& model_so_path,
     size_t num_models,
     const std::string& device_str,
-    const std::string& cubin_dir)
+    const std::string& cubin_dir,
+    AOTIModelContainerRunner* shared_weights_from)
     : AOTIModelContainerRunner(
           model_so_path,
           num_models,
           device_str,
-          cubin_dir) {}
+          cubin_dir,
+          shared_weights_from) {}
 
 AOTIModelContainerRunnerCuda::~AOTIModelContainerRunnerCuda() = default;
 
@@ -30,6 +35,66 @@ std::vector<at::Tensor> AOTIModelContainerRunnerCuda::run_with_cuda_stream(
       inputs, reinterpret_cast<AOTInductorStreamHandle>(cuda_stream.stream()));
 }
 
+std::vector<at::Tensor> AOTIModelContainerRunnerCuda::run_pipelined(
+    std::vector<at::Tensor>& inputs) {
+  at::cuda::CUDAStream ambient_stream = c10::cuda::getCurrentCUDAStream();
+  if (!slot_streams_[0].has_value()) {
+    for (auto& slot_stream : slot_streams_) {
+      slot_stream = c10::cuda::getStreamFromPool(
+          /* isHighPriority = */ false, ambient_stream.device_index());
+    }
+  }
+  at::cuda::CUDAStream slot_stream = *slot_streams_[next_slot_];
+  next_slot_ = (next_slot_ + 1) % kNumPipelineSlots;
+
+  // Chain the slot stream behind whatever produced the inputs, and mark the
+  // inputs as used on it so the caching allocator does not hand their memory
+  // out before the run finishes.
+  {
+    at::cuda::CUDAEvent inputs_ready;
+    inputs_ready.record(ambient_stream);
+    inputs_ready.block(slot_stream);
+  }
+  for (const at::Tensor& input : inputs) {
+    c10::cuda::CUDACachingAllocator::recordStream(
+        input.storage().data_ptr(), slot_stream);
+  }
+
+  std::vector<at::Tensor> outputs;
+  {
+    // Make the slot stream current so activations allocated inside the model
+    // are tied to it rather than the caller's stream.
+    c10::cuda::CUDAStreamGuard guard(slot_stream);
+    outputs = AOTIModelContainerRunner::run(
+        inputs,
+        reinterpret_cast<AOTInductorStreamHandle>(slot_stream.stream()));
+  }
+
+  // Chain the caller's stream behind the run so the outputs can be consumed
+  // with ordinary stream semantics while the next micro-batch overlaps on the
+  // other slot.
+  at::cuda::CUDAEvent outputs_ready;
+  outputs_ready.record(slot_stream);
+  outputs_ready.block(ambient_stream);
+  for (const at::Tensor& output : outputs) {
+    c10::cuda::CUDACachingAllocator::recordStream(
+        output.storage().data_ptr(), ambient_stream);
+  }
+  return outputs;
+}
+
+void AOTIModelContainerRunnerCuda::swap_constant_buffer() {
+  // The container's execution lock only covers run submission; pipelined
+  // micro-batches may still be reading the active weights on the slot
+  // streams. Drain them before the buffers flip.
+  for (auto& slot_stream : slot_streams_) {
+    if (slot_stream.has_value()) {
+      slot_stream->synchronize();
+    }
+  }
+  AOTIModelContainerRunner::swap_constant_buffer();
+}
+
 namespace {
 std::unique_ptr<AOTIModelContainerRunner> create_aoti_runner_cuda(
     const std::string& model_so_path,
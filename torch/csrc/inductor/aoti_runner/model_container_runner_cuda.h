@@ -4,6 +4,9 @@
 #include <c10/cuda/CUDAStream.h>
 #include <torch/csrc/inductor/aoti_runner/model_container_runner.h>
 
+#include <array>
+#include <optional>
+
 namespace torch::inductor {
 
 // NOTICE: Following APIs are subject to change due to active development
@@ -11,11 +14,15 @@ namespace torch::inductor {
 class TORCH_API AOTIModelContainerRunnerCuda : public AOTIModelContainerRunner {
  public:
   // @param device_str: cuda device string, e.g. "cuda", "cuda:0"
+  // @param shared_weights_from: if not nullptr, share the constant buffer
+  // (the weights in device memory) of that runner instead of loading a
+  // separate copy; see the base class ctor
   AOTIModelContainerRunnerCuda(
       const std::string& model_so_path,
       size_t num_models = 1,
       const std::string& device_str = "cuda",
-      const std::string& cubin_dir = "");
+      const std::string& cubin_dir = "",
+      AOTIModelContainerRunner* shared_weights_from = nullptr);
 
   ~AOTIModelContainerRunnerCuda();
 
@@ -24,6 +31,30 @@ class TORCH_API AOTIModelContainerRunnerCuda : public AOTIModelContainerRunner {
   std::vector<at::Tensor> run_with_cuda_stream(
       std::vector<at::Tensor>& inputs,
       at::cuda::CUDAStream cuda_stream);
+
+  // Runs one micro-batch on an internal pair of CUDA streams, alternating
+  // between them so consecutive calls are double-buffered: while micro-batch
+  // N computes on one stream, micro-batch N+1's copies and kernels are
+  // enqueued on the other. Events chain each slot stream behind the caller's
+  // current stream (so inputs are ready before the run) and chain the
+  // caller's stream behind the run (so outputs follow ordinary stream
+  // semantics). Per-slot activation buffers come from the container's model
+  // instances; construct the runner with num_models >= 2, otherwise calls
+  // serialize waiting for the single model instance. Micro-batches must be
+  // submitted from one thread.
+  std::vector<at::Tensor> run_pipelined(std::vector<at::Tensor>& inputs);
+
+  // Drains in-flight pipelined micro-batches before swapping, since they
+  // read the active weights outside the container's execution lock.
+  void swap_constant_buffer() override;
+
+ private:
+  static constexpr size_t kNumPipelineSlots = 2;
+
+  // Streams backing the pipeline slots; created on first run_pipelined call.
+  std::array<std::optional<at::cuda::CUDAStream>, kNumPipelineSlots>
+      slot_streams_;
+  size_t next_slot_{0};
 };
 
 } // namespace torch::inductor
@@ -40,6 +40,20 @@ AOTIRuntimeError AOTInductorModelContainerCreateWithDevice(
     const char* device_str,
     const char* cubin_dir);
 
+// Same as AOTInductorModelContainerCreateWithDevice, but the new container
+// shares the constant buffer (e.g. the weights in device memory) owned by
+// `shared_constants_handle` instead of loading its own copy. Each container
+// still keeps per-run activation buffers. The owning container must outlive
+// every container attached to it; weight updates go through the owning
+// container, whose AOTInductorModelContainerSwapConstantBuffer propagates the
+// new constants to all attached containers.
+AOTIRuntimeError AOTInductorModelContainerCreateWithSharedConstants(
+    AOTInductorModelContainerHandle* container_handle,
+    size_t num_models,
+    const char* device_str,
+    const char* cubin_dir,
+    AOTInductorModelContainerHandle shared_constants_handle);
+
 // Deletes the AOTInductor model container.
 AOTIRuntimeError AOTInductorModelContainerDelete(
     AOTInductorModelContainerHandle container_handle);
@@ -4,6 +4,7 @@
 #include <fcntl.h>
 #include <sys/mman.h>
 #include <unistd.h>
+#include <cstdint>
 #include <optional>
 #include <regex>
 #include <stdexcept>
@@ -124,6 +125,23 @@ class AOTInductorModelBase {
 
   ~AOTInductorModelBase() {
 #ifdef USE_CUDA
+    if (streaming_) {
+      auto& st = *streaming_;
+      for (auto slot : {0, 1}) {
+        if (st.copy_done[slot]) {
+          cudaEventDestroy(st.copy_done[slot]);
+        }
+        if (st.slot_free[slot]) {
+          cudaEventDestroy(st.slot_free[slot]);
+        }
+      }
+      if (st.copy_stream) {
+        cudaStreamDestroy(st.copy_stream);
+      }
+      if (st.host_registered) {
+        cudaHostUnregister(_get_constants_start());
+      }
+    }
     if (run_finished_) {
       auto code = cudaEventDestroy(*run_finished_);
       if (code != cudaSuccess) {
@@ -195,6 +213,12 @@ class AOTInductorModelBase {
   }
 
   void load_constants() {
+#ifdef USE_CUDA
+    if (streaming_) {
+      load_constants_streaming();
+      return;
+    }
+#endif // USE_CUDA
     size_t num_constants = this->num_constants();
     constants_map_->reserve(num_constants);
 
@@ -228,47 +252,7 @@ class AOTInductorModelBase {
       bytes_read += data_size;
 
       // Create at::Tensor from copied memory.
-      auto dtype = this->constant_dtype(i);
-      auto ndim = this->constant_ndim(i);
-      auto size = this->constant_shape(i);
-      auto stride = this->constant_stride(i);
-      auto offset = this->constant_offset(i);
-      auto layout = this->constant_layout(i);
-      auto opaque_metadata_ptr = this->opaque_metadata(i);
-      auto opaque_metadata_size = this->opaque_metadata_size(i);
-
-      AtenTensorHandle tensor_handle = nullptr;
-#ifdef AOTI_USE_CREATE_TENSOR_FROM_BLOB_V1
-      // When opaque_metadata_size is not 0, we need to have the
-      // aoti_torch_create_tensor_from_blob_v2 available
-      AOTI_RUNTIME_CHECK(
-          opaque_metadata_size == 0,
-          "Expect opaque_metadata_size to be 0 when AOTI_USE_CREATE_TENSOR_FROM_BLOB_V1 is defined");
-      AOTI_TORCH_ERROR_CODE_CHECK(aoti_torch_create_tensor_from_blob(
-          internal_ptr,
-          ndim,
-          size,
-          stride,
-          offset,
-          dtype,
-          device_type_,
-          device_idx_,
-          &tensor_handle));
-#else
-      AOTI_TORCH_ERROR_CODE_CHECK(aoti_torch_create_tensor_from_blob_v2(
-          internal_ptr,
-          ndim,
-          size,
-          stride,
-          offset,
-          dtype,
-          device_type_,
-          device_idx_,
-          &tensor_handle,
-          layout,
-          opaque_metadata_ptr,
-          opaque_metadata_size));
-#endif // AOTI_USE_CREATE_TENSOR_FROM_BLOB_V1
+      AtenTensorHandle tensor_handle = make_constant_tensor(i, internal_ptr);
       constants_map_->emplace(std::move(name), tensor_handle);
     }
     if (constants_map_) {
@@ -277,6 +261,63 @@ class AOTInductorModelBase {
   }
 
 #ifdef USE_CUDA
+  // Weight streaming
+  //
+  // For models whose constants do not fit in device memory, constants can
+  // stay pinned in host memory and be copied in bounded "layer groups"
+  // instead of being resident all at once. Groups follow constants_info_
+  // order, which the compiler emits in constant-use order, so group k+1
+  // holds the weights consumed right after group k's. Two device slots are
+  // double-buffered: while group k's kernels run on the compute stream,
+  // group k+1 is copied on a side stream; activation waits on the copy
+  // with stream events only, never blocking the host.
+  //
+  // Generated code (or a caller driving the model group by group) calls
+  // activate_constants_group(k, stream) before issuing group k's kernels.
+  // Folded constants are excluded from streaming and get a small permanent
+  // allocation, since const folding writes into their storage.
+
+  // Must be called before load_constants. `max_resident_bytes` bounds the
+  // device memory used for streamed constants; half is used per slot.
+  void enable_weight_streaming(size_t max_resident_bytes) {
+    AOTI_RUNTIME_CHECK(
+        !constants_map_ || constants_map_->empty(),
+        "enable_weight_streaming must be called before load_constants");
+    streaming_.emplace();
+    streaming_->slot_size = max_resident_bytes / 2;
+  }
+
+  bool weight_streaming_enabled() const {
+    return streaming_.has_value();
+  }
+
+  size_t num_constant_groups() const {
+    return streaming_ ? streaming_->groups.size() : 1;
+  }
+
+  // Makes `stream` wait until group `group`'s constants are on device,
+  // rebinds the constant tensors to their slot, and kicks off the copy of
+  // the next group on the side stream.
+  void activate_constants_group(size_t group, DeviceStreamType stream) {
+    AOTI_RUNTIME_CHECK(
+        streaming_.has_value(), "weight streaming is not enabled");
+    auto& st = *streaming_;
+    AOTI_RUNTIME_CHECK(group < st.groups.size(), "invalid constant group");
+    size_t slot = group % 2;
+    prefetch_constants_group(group);
+    AOTI_RUNTIME_DEVICE_CHECK(
+        cudaStreamWaitEvent(stream, st.copy_done[slot], 0));
+    // All compute through group - 1 has been issued on `stream` at this
+    // point, so the other slot may be overwritten once `stream` reaches
+    // here; the side stream waits on this event before reusing it.
+    AOTI_RUNTIME_DEVICE_CHECK(
+        cudaEventRecord(st.slot_free[(group + 1) % 2], stream));
+    rebind_constants_group(group, slot);
+    if (group + 1 < st.groups.size()) {
+      prefetch_constants_group(group + 1);
+    }
+  }
+
   CUDAPtr&& release_constant_blob() {
     return std::move(constant_blob_);
   }
@@ -486,6 +527,215 @@ class AOTInductorModelBase {
   }
 
  protected:
+  // Creates the at::Tensor for constant `i` backed by `internal_ptr`.
+  AtenTensorHandle make_constant_tensor(size_t i, uint8_t* internal_ptr) {
+    auto dtype = this->constant_dtype(i);
+    auto ndim = this->constant_ndim(i);
+    auto size = this->constant_shape(i);
+    auto stride = this->constant_stride(i);
+    auto offset = this->constant_offset(i);
+    auto layout = this->constant_layout(i);
+    auto opaque_metadata_ptr = this->opaque_metadata(i);
+    auto opaque_metadata_size = this->opaque_metadata_size(i);
+
+    AtenTensorHandle tensor_handle = nullptr;
+#ifdef AOTI_USE_CREATE_TENSOR_FROM_BLOB_V1
+    // When opaque_metadata_size is not 0, we need to have the
+    // aoti_torch_create_tensor_from_blob_v2 available
+    AOTI_RUNTIME_CHECK(
+        opaque_metadata_size == 0,
+        "Expect opaque_metadata_size to be 0 when AOTI_USE_CREATE_TENSOR_FROM_BLOB_V1 is defined");
+    AOTI_TORCH_ERROR_CODE_CHECK(aoti_torch_create_tensor_from_blob(
+        internal_ptr,
+        ndim,
+        size,
+        stride,
+        offset,
+        dtype,
+        device_type_,
+        device_idx_,
+        &tensor_handle));
+#else
+    AOTI_TORCH_ERROR_CODE_CHECK(aoti_torch_create_tensor_from_blob_v2(
+        internal_ptr,
+        ndim,
+        size,
+        stride,
+        offset,
+        dtype,
+        device_type_,
+        device_idx_,
+        &tensor_handle,
+        layout,
+        opaque_metadata_ptr,
+        opaque_metadata_size));
+#endif // AOTI_USE_CREATE_TENSOR_FROM_BLOB_V1
+    return tensor_handle;
+  }
+
+#ifdef USE_CUDA
+  struct StreamingState {
+    // Device memory per slot; each group must fit in one slot.
+    size_t slot_size = 0;
+    CUDAPtr slots[2];
+    // Which group currently occupies each slot (SIZE_MAX if none).
+    size_t slot_group[2] = {SIZE_MAX, SIZE_MAX};
+    cudaStream_t copy_stream = nullptr;
+    cudaEvent_t copy_done[2] = {nullptr, nullptr};
+    cudaEvent_t slot_free[2] = {nullptr, nullptr};
+    // Half-open [begin, end) ranges into constants_info_, in use order.
+    std::vector<std::pair<size_t, size_t>> groups;
+    // Per-constant offsets into its slot and into the host blob.
+    std::vector<size_t> offset_in_slot;
+    std::vector<size_t> host_offset;
+    bool host_registered = false;
+  };
+
+  void load_constants_streaming() {
+    auto& st = *streaming_;
+    size_t num_constants = this->num_constants();
+    constants_map_->reserve(num_constants);
+    st.offset_in_slot.resize(num_constants, 0);
+    st.host_offset.resize(num_constants, 0);
+
+    // Folded constants get a small permanent allocation outside the
+    // streamed slots; const folding writes into their storage.
+    size_t folded_size = 0;
+    std::vector<size_t> folded_offset(num_constants, 0);
+
+    // Partition the remaining constants into layer groups in use order,
+    // each bounded by the slot size.
+    size_t group_begin = 0;
+    size_t group_bytes = 0;
+    size_t bytes_read = 0;
+    for (size_t i = 0; i < num_constants; i++) {
+      size_t data_size = this->constant_data_size(i);
+      st.host_offset[i] = bytes_read;
+      bytes_read += data_size;
+      size_t aligned_size = data_size;
+      if (aligned_size % AOTI_CONST_GPU_ALIGNMENT) {
+        aligned_size = AOTI_CONST_GPU_ALIGNMENT +
+            (aligned_size / AOTI_CONST_GPU_ALIGNMENT) *
+                AOTI_CONST_GPU_ALIGNMENT;
+      }
+      if (this->constant_from_folded(i)) {
+        folded_offset[i] = folded_size;
+        folded_size += aligned_size;
+        continue;
+      }
+      AOTI_RUNTIME_CHECK(
+          aligned_size <= st.slot_size,
+          "weight streaming budget too small for constant " +
+              std::string(this->constant_name(i)));
+      if (group_bytes + aligned_size > st.slot_size) {
+        st.groups.emplace_back(group_begin, i);
+        group_begin = i;
+        group_bytes = 0;
+      }
+      st.offset_in_slot[i] = group_bytes;
+      group_bytes += aligned_size;
+    }
+    st.groups.emplace_back(group_begin, num_constants);
+
+    st.slots[0] = RAII_cudaMalloc(st.slot_size);
+    st.slots[1] = RAII_cudaMalloc(st.slot_size);
+    if (folded_size != 0) {
+      constant_blob_ = RAII_cudaMalloc(folded_size);
+    }
+    AOTI_RUNTIME_DEVICE_CHECK(
+        cudaStreamCreateWithFlags(&st.copy_stream, cudaStreamNonBlocking));
+    for (auto slot : {0, 1}) {
+      AOTI_RUNTIME_DEVICE_CHECK(cudaEventCreateWithFlags(
+          &st.copy_done[slot], cudaEventDisableTiming));
+      AOTI_RUNTIME_DEVICE_CHECK(cudaEventCreateWithFlags(
+          &st.slot_free[slot], cudaEventDisableTiming));
+      // Record once so the first waits see a signaled event.
+      AOTI_RUNTIME_DEVICE_CHECK(cudaEventRecord(st.slot_free[slot], nullptr));
+      AOTI_RUNTIME_DEVICE_CHECK(cudaEventRecord(st.copy_done[slot], nullptr));
+    }
+
+    // Pin the embedded host blob so the group copies can run
+    // asynchronously on the side stream. Registration failure (e.g. an
+    // exotic mapping) is not fatal; copies just lose async overlap.
+    if (bytes_read != 0 &&
+        cudaHostRegister(
+            _get_constants_start(), bytes_read, cudaHostRegisterDefault) ==
+            cudaSuccess) {
+      st.host_registered = true;
+    } else {
+      (void)cudaGetLastError();
+    }
+
+    // Bind folded constants once; they stay resident.
+    for (size_t i = 0; i < num_constants; i++) {
+      if (!this->constant_from_folded(i)) {
+        continue;
+      }
+      uint8_t* internal_ptr = (this->constant_data_size(i) != 0)
+          ? static_cast<uint8_t*>(constant_blob_.get()) + folded_offset[i]
+          : nullptr;
+      constants_map_->emplace(
+          this->constant_name(i), make_constant_tensor(i, internal_ptr));
+    }
+
+    // Make group 0 resident so the model is immediately runnable; the
+    // first activate_constants_group(0, stream) is then a cheap no-op
+    // wait.
+    prefetch_constants_group(0);
+    rebind_constants_group(0, 0);
+    AOTI_RUNTIME_DEVICE_CHECK(cudaStreamSynchronize(st.copy_stream));
+  }
+
+  // Copies `group` into its slot on the side stream if not already there.
+  void prefetch_constants_group(size_t group) {
+    auto& st = *streaming_;
+    if (group >= st.groups.size()) {
+      return;
+    }
+    size_t slot = group % 2;
+    if (st.slot_group[slot] == group) {
+      return;
+    }
+    // Do not overwrite the slot while compute that uses its previous
+    // occupant is still in flight.
+    AOTI_RUNTIME_DEVICE_CHECK(
+        cudaStreamWaitEvent(st.copy_stream, st.slot_free[slot], 0));
+    auto* slot_ptr = static_cast<uint8_t*>(st.slots[slot].get());
+    for (size_t i = st.groups[group].first; i < st.groups[group].second; i++) {
+      size_t data_size = this->constant_data_size(i);
+      if (data_size == 0 || this->constant_from_folded(i)) {
+        continue;
+      }
+      AOTI_RUNTIME_DEVICE_CHECK(cudaMemcpyAsync(
+          slot_ptr + st.offset_in_slot[i],
+          _get_constants_start() + st.host_offset[i],
+          data_size,
+          cudaMemcpyHostToDevice,
+          st.copy_stream));
+    }
+    AOTI_RUNTIME_DEVICE_CHECK(
+        cudaEventRecord(st.copy_done[slot], st.copy_stream));
+    st.slot_group[slot] = group;
+  }
+
+  // Points the constant tensors of `group` at its slot.
+  void rebind_constants_group(size_t group, size_t slot) {
+    auto& st = *streaming_;
+    auto* slot_ptr = static_cast<uint8_t*>(st.slots[slot].get());
+    for (size_t i = st.groups[group].first; i < st.groups[group].second; i++) {
+      if (this->constant_from_folded(i)) {
+        continue;
+      }
+      uint8_t* internal_ptr = (this->constant_data_size(i) != 0)
+          ? slot_ptr + st.offset_in_slot[i]
+          : nullptr;
+      RAIIAtenTensorHandle tensor(make_constant_tensor(i, internal_ptr));
+      (*constants_map_)[this->constant_name(i)] = std::move(tensor);
+    }
+    update_constants_array_from_map();
+  }
+#endif // USE_CUDA
+
   uint8_t* _get_constants_start() {
 #ifndef USE_MMAP_SELF
     return const_cast<uint8_t*>(_binary_constants_bin_start);
@@ -554,8 +804,12 @@ class AOTInductorModelBase {
   std::shared_ptr<std::vector<ConstantHandle>> constants_;
 
 #ifdef USE_CUDA
-  // Holds the blob storage for constants' at::Tensor for CUDA.
+  // Holds the blob storage for constants' at::Tensor for CUDA. In weight
+  // streaming mode this only holds the folded constants.
   CUDAPtr constant_blob_;
+
+  // Engaged when weight streaming is enabled; see "Weight streaming".
+  std::optional<StreamingState> streaming_;
 #endif // USE_CUDA
 #ifdef USE_MMAP_SELF
   uint8_t* self_mmap = NULL;
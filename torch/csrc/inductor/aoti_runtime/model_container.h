@@ -16,12 +16,28 @@ namespace torch::aot_inductor {
 
 class AOTInductorModelContainer {
  public:
+  // When `shared_constants_owner` is provided, this container does not load
+  // or own any constants. Instead it attaches to the owner's (read-only)
+  // constant blob, so N serving replicas of one model keep a single copy of
+  // the weights on the device and only carry per-run activation buffers.
+  // The owner must outlive every attached container. Weight updates and
+  // buffer swaps must go through the owner, which propagates the new
+  // constants to all attached containers on swap_constant_buffer().
   AOTInductorModelContainer(
       size_t num_models,
       const std::string& device_str,
-      const std::optional<std::string>& cubin_dir = std::nullopt) {
-    constants_map_ = std::make_shared<ConstantMap>();
-    constants_array_ = std::make_shared<std::vector<ConstantHandle>>();
+      const std::optional<std::string>& cubin_dir = std::nullopt,
+      AOTInductorModelContainer* shared_constants_owner = nullptr)
+      : shared_constants_owner_(shared_constants_owner) {
+    if (shared_constants_owner_ != nullptr) {
+      constants_map_ =
+          shared_constants_owner_->get_constants_map(/* get_inactive= */ false);
+      constants_array_ = shared_constants_owner_->get_constants_array(
+          /* get_inactive= */ false);
+    } else {
+      constants_map_ = std::make_shared<ConstantMap>();
+      constants_array_ = std::make_shared<std::vector<ConstantHandle>>();
+    }
 
     models_.reserve(num_models);
     available_models_.reserve(num_models);
@@ -52,12 +68,18 @@ class AOTInductorModelContainer {
       output_names_.emplace_back(model->output_name(static_cast<int64_t>(i)));
     }
 
-    model->load_constants();
+    if (shared_constants_owner_ == nullptr) {
+      model->load_constants();
 #ifdef USE_CUDA
-    constant_blob_ = model->release_constant_blob();
-    constants_internal_offset_.resize(model->num_constants());
-    model->compute_cuda_constant_blob(blob_size_, constants_internal_offset_);
+      constant_blob_ = model->release_constant_blob();
+      constants_internal_offset_.resize(model->num_constants());
+      model->compute_cuda_constant_blob(blob_size_, constants_internal_offset_);
 #endif
+    } else {
+      // The owner's blob already holds the weights; just subscribe to buffer
+      // swaps. Attaching must not race with the owner's swap_constant_buffer.
+      shared_constants_owner_->register_shared_follower(this);
+    }
 
     for (auto& model : models_) {
       model->update_constants_map(constants_map_);
@@ -67,6 +89,12 @@ class AOTInductorModelContainer {
     out_spec_ = model->get_out_spec();
   }
 
+  ~AOTInductorModelContainer() {
+    if (shared_constants_owner_ != nullptr) {
+      shared_constants_owner_->unregister_shared_follower(this);
+    }
+  }
+
   void run(
       AtenTensorHandle*
           input_handles, // array of input AtenTensorHandle; handles
@@ -77,10 +105,16 @@ class AOTInductorModelContainer {
                           // borrowed
       DeviceStreamType stream,
       AOTIProxyExecutorHandle proxy_executor) {
+    if (shared_constants_owner_ != nullptr) {
+      // Constant folding happens once, on the owner's buffer. Do it before
+      // taking our own execution lock: the owner's swap_constant_buffer takes
+      // locks in owner-then-follower order and we must never invert that.
+      shared_constants_owner_->ensure_constant_folded(stream, proxy_executor);
+    }
     std::shared_lock model_lk(model_exec_mutex_);
     auto* model = get_available_model();
 
-    if (!constant_folded_) {
+    if (shared_constants_owner_ == nullptr && !constant_folded_) {
       // At this point, constant is not ready yet. We need to call constant
       // folding before we execute the model. We obtain a unique lock at this
       // point to make sure constant is ready for all.
@@ -166,6 +200,11 @@ class AOTInductorModelContainer {
       bool inactive_buffer,
       DeviceStreamType stream,
       AOTIProxyExecutorHandle proxy_executor) {
+    if (shared_constants_owner_ != nullptr) {
+      shared_constants_owner_->run_const_fold(
+          inactive_buffer, stream, proxy_executor);
+      return;
+    }
     std::shared_lock model_lk(model_exec_mutex_);
     auto* model = get_available_model();
 
@@ -235,6 +274,11 @@ class AOTInductorModelContainer {
       const std::unordered_map<std::string, AtenTensorHandle>& constants_map,
       bool use_inactive,
       bool validate_full_update) {
+    if (shared_constants_owner_ != nullptr) {
+      shared_constants_owner_->update_constant_buffer(
+          constants_map, use_inactive, validate_full_update);
+      return;
+    }
     if (this->num_models() == 0) {
       throw std::runtime_error("No model available in container!");
     }
@@ -349,6 +393,10 @@ class AOTInductorModelContainer {
   }
 
   void swap_constant_buffer() {
+    if (shared_constants_owner_ != nullptr) {
+      shared_constants_owner_->swap_constant_buffer();
+      return;
+    }
     std::lock_guard unique_lk(model_exec_mutex_);
 
     auto constants_map = get_constants_map(/* get_inactive= */ true);
@@ -361,6 +409,14 @@ class AOTInductorModelContainer {
     }
 
     use_secondary_ = !use_secondary_;
+
+    // Point every attached container at the buffer that just became active.
+    std::lock_guard followers_lk(shared_followers_mutex_);
+    for (auto* follower : shared_followers_) {
+      follower->adopt_owner_constants(
+          get_constants_map(/* get_inactive= */ false),
+          get_constants_array(/* get_inactive= */ false));
+    }
   }
 
   size_t num_inputs() const {
@@ -392,6 +448,71 @@ class AOTInductorModelContainer {
   }
 
  private:
+  // Runs constant folding on this container's active buffer if that has not
+  // happened yet. Called by attached containers before their first run; it
+  // checks out one of this container's own models, so attached containers
+  // never compete for the owner's model pool during normal inference.
+  void ensure_constant_folded(
+      DeviceStreamType stream,
+      AOTIProxyExecutorHandle proxy_executor) {
+    if (constant_folded_) {
+      return;
+    }
+    std::unique_lock constants_folding_lk(model_exec_mutex_);
+    // Double locking to make sure constant folding is only ran once.
+    if (constant_folded_) {
+      return;
+    }
+    auto* model = get_available_model();
+    try {
+      auto folded_const_map = model->run_const_fold(
+          stream, proxy_executor, /* initialization = */ true);
+      update_constant_buffer(
+          folded_const_map,
+          /* use_inactive = */ false,
+          /* validate_full_update = */ false);
+      constant_folded_ = true;
+    } catch (...) {
+      std::lock_guard lk(models_mutex_);
+      available_models_.push_back(model);
+      throw;
+    }
+    {
+      std::lock_guard lk(models_mutex_);
+      pending_models_.push_back(model);
+    }
+    pending_models_available_.notify_one();
+  }
+
+  // Called by the owner after a buffer swap so that this attached container
+  // starts serving from the newly active constants. The owner holds its own
+  // model_exec_mutex_ at this point; we take ours, never the other way round.
+  void adopt_owner_constants(
+      std::shared_ptr<ConstantMap> constants_map,
+      std::shared_ptr<std::vector<ConstantHandle>> constants_array) {
+    std::lock_guard unique_lk(model_exec_mutex_);
+    constants_map_ = std::move(constants_map);
+    constants_array_ = std::move(constants_array);
+    for (auto& model : models_) {
+      model->update_constants_map(
+          constants_map_, /* remap_constants_array = */ false);
+      model->update_constants_array(constants_array_);
+    }
+  }
+
+  void register_shared_follower(AOTInductorModelContainer* follower) {
+    std::lock_guard lk(shared_followers_mutex_);
+    shared_followers_.push_back(follower);
+  }
+
+  void unregister_shared_follower(AOTInductorModelContainer* follower) {
+    std::lock_guard lk(shared_followers_mutex_);
+    shared_followers_.erase(
+        std::remove(
+            shared_followers_.begin(), shared_followers_.end(), follower),
+        shared_followers_.end());
+  }
+
   std::vector<std::string> input_names_;
   std::vector<std::string> output_names_;
   const char* in_spec_;
@@ -427,6 +548,17 @@ class AOTInductorModelContainer {
   std::shared_ptr<std::vector<ConstantHandle>> constants_array_;
   std::shared_ptr<std::vector<ConstantHandle>> constants_array_secondary_;
 
+  // Non-null when this container shares the constants of another container
+  // instead of owning its own copy. The owner must outlive this container.
+  AOTInductorModelContainer* shared_constants_owner_{nullptr};
+
+  // Containers attached to this container's constants. They are re-pointed at
+  // the newly active buffer whenever swap_constant_buffer() flips it.
+  std::vector<AOTInductorModelContainer*> shared_followers_;
+
+  // Protects shared_followers_.
+  std::mutex shared_followers_mutex_;
+
   // Holds all the AOTInductorModel instances owned by this container.
   std::vector<std::unique_ptr<AOTInductorModel>> models_;
 
@@ -1,6 +1,7 @@
 #include <nlohmann/json.hpp>
 #include <fstream>
 #include <iostream>
+#include <unordered_map>
 
 #include <torch/csrc/inductor/aoti_torch/oss_proxy_executor.h>
 
@@ -354,6 +355,24 @@ OSSProxyExecutor::OSSProxyExecutor(const std::string& json_path, bool is_cpu) {
   }
 }
 
+// Returns this thread's reusable argument frame for the given call-site.
+// call_function may run concurrently on the same executor from different
+// model instances, so the frames are per-thread rather than stored on the
+// OSSOpKernel; they are fully overwritten before use, so a stale entry for
+// a destructed executor at a recycled address is harmless.
+std::vector<c10::IValue>& OSSProxyExecutor::scratch_stack(
+    int extern_node_index) {
+  thread_local std::unordered_map<
+      const OSSProxyExecutor*,
+      std::vector<std::vector<c10::IValue>>>
+      frames;
+  auto& executor_frames = frames[this];
+  if (executor_frames.size() < op_kernels_.size()) {
+    executor_frames.resize(op_kernels_.size());
+  }
+  return executor_frames[extern_node_index];
+}
+
 void OSSProxyExecutor::call_function(
     int extern_node_index,
     int num_ints,
@@ -365,7 +384,12 @@ void OSSProxyExecutor::call_function(
       "Invalid extern node index");
   OSSOpKernel& op_kernel = op_kernels_[extern_node_index];
 
-  std::vector<c10::IValue> stack = op_kernel.stack_;
+  // Op handles are resolved once at load time and the static arguments are
+  // preboxed into op_kernel.stack_; per call we only have to refresh the
+  // dynamic arguments. Reuse a per-thread frame per call-site so fallback
+  // heavy graphs do not pay a heap allocation for the stack on every step.
+  std::vector<c10::IValue>& stack = scratch_stack(extern_node_index);
+  stack = op_kernel.stack_;
   auto& dynamic_args = op_kernel.dynamic_args_;
 
   int tensor_id = 0;
@@ -488,6 +512,10 @@ void OSSProxyExecutor::call_function(
       tensor_id,
       ", expected num = ",
       num_tensors);
+
+  // Drop the references to the outputs but keep the frame's capacity for
+  // the next call to this call-site.
+  stack.clear();
 }
 
 } // namespace torch::aot_inductor
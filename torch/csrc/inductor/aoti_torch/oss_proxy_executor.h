@@ -96,6 +96,8 @@ class OSSProxyExecutor : public ProxyExecutor {
       const nlohmann::json& serialized_node,
       OSSOpKernel& op_kernel);
 
+  std::vector<c10::IValue>& scratch_stack(int extern_node_index);
+
   std::vector<OSSOpKernel> op_kernels_;
   std::unique_ptr<c10::Device> device_;
 };
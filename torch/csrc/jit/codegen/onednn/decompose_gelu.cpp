@@ -0,0 +1,106 @@
+#include <torch/csrc/jit/codegen/onednn/decompose_gelu.h>
+#include <torch/csrc/jit/codegen/onednn/operator.h>
+
+#include <torch/csrc/jit/passes/dead_code_elimination.h>
+
+namespace torch {
+namespace jit {
+namespace fuser {
+namespace onednn {
+
+// oneDNN graph's GELU op computes the erf flavor, so aten::gelu with
+// approximate='tanh' cannot be mapped directly and would split the
+// partition right after the GEMM it serves as an epilogue for. Like silu,
+// we decompose it into primitive ops the bridge understands, but only when
+// it follows a GEMM- or convolution-like producer, where the backend can
+// fuse the whole chain and keep the activation in cache.
+static bool isDecomposableProducer(Node* producer) {
+  if (producer->kind() == aten::_convolution) {
+    // TODO: remove transpose check once the bridge supported ConvTranspose
+    bool transposed = Operator::Bool(producer, 6);
+    return !transposed;
+  }
+  return producer->kind() == aten::linear ||
+      producer->kind() == aten::matmul || producer->kind() == aten::mm ||
+      producer->kind() == aten::addmm;
+}
+
+static bool shouldDecomposeGelu(Node* node) {
+  if (node->kind() != aten::gelu) {
+    return false;
+  }
+  auto approximate = toIValue(node->namedInput("approximate"));
+  if (!approximate.has_value() || !approximate->isString() ||
+      approximate->toStringRef() != "tanh") {
+    return false;
+  }
+  auto producer = node->input(0)->node();
+  if (isDecomposableProducer(producer)) {
+    return true;
+  }
+  // A broadcast bias or residual add between the GEMM and the activation is
+  // part of the same epilogue chain.
+  if (producer->kind() == aten::add &&
+      (isDecomposableProducer(producer->input(0)->node()) ||
+       isDecomposableProducer(producer->input(1)->node()))) {
+    return true;
+  }
+  return false;
+}
+
+static void DecomposeGelu(Node* node) {
+  if (shouldDecomposeGelu(node)) {
+    auto dtype = node->input(0)->type()->expect<TensorType>();
+
+    WithInsertPoint guard(node);
+    auto g = node->owningGraph();
+    auto x = node->input(0);
+
+    // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+    // The scalar operands are turned into 1D tensors by
+    // PrepareBinaryForLLGA, which runs after this pass.
+    auto x_square = g->insert(aten::square, {x});
+    x_square->setType(dtype);
+    auto x_cube = g->insert(aten::mul, {x_square, x});
+    x_cube->setType(dtype);
+    auto scaled_cube = g->insert(aten::mul, {x_cube, 0.044715});
+    scaled_cube->setType(dtype);
+    auto inner = g->insert(aten::add, {x, scaled_cube});
+    inner->setType(dtype);
+    auto scaled_inner =
+        g->insert(aten::mul, {inner, 0.7978845608028654}); // sqrt(2 / pi)
+    scaled_inner->setType(dtype);
+    auto tanh = g->insert(aten::tanh, {scaled_inner});
+    tanh->setType(dtype);
+    auto one_plus_tanh = g->insert(aten::add, {tanh, 1.});
+    one_plus_tanh->setType(dtype);
+    auto x_gated = g->insert(aten::mul, {x, one_plus_tanh});
+    x_gated->setType(dtype);
+    auto result = g->insert(aten::mul, {x_gated, 0.5});
+    result->setType(dtype);
+
+    node->output()->replaceAllUsesWith(result);
+  }
+}
+
+static void DecomposeGelu(Block* block) {
+  for (auto node : block->nodes()) {
+    for (auto sub : node->blocks()) {
+      DecomposeGelu(sub);
+    }
+
+    if (node->kind() == aten::gelu) {
+      DecomposeGelu(node);
+    }
+  }
+}
+
+void DecomposeGeluForLLGA(std::shared_ptr<Graph>& graph) {
+  DecomposeGelu(graph->block());
+  EliminateDeadCode(graph);
+}
+
+} // namespace onednn
+} // namespace fuser
+} // namespace jit
+} // namespace torch
@@ -20,7 +20,8 @@ static bool shouldDecomposeSilu(Node* node) {
     bool transposed = Operator::Bool(inputToSilu, 6);
     return !transposed;
   }
-  if (inputToSilu->kind() == aten::linear) {
+  if (inputToSilu->kind() == aten::linear || inputToSilu->kind() == aten::matmul ||
+      inputToSilu->kind() == aten::mm || inputToSilu->kind() == aten::addmm) {
     return true;
   }
   return false;
@@ -151,8 +151,15 @@ Operator LlgaGraphHelper::createOperator(Node* node) {
         .setAttr(dnnl::graph::op::attr::alpha, Operator::Float, 1);
   else if (nodeKind == Symbol::fromQualString("aten::sigmoid"))
     return makeEltwiseOp(node, opkind::Sigmoid);
-  else if (nodeKind == Symbol::fromQualString("aten::gelu"))
+  else if (nodeKind == Symbol::fromQualString("aten::gelu")) {
+    // LLGA's GELU computes the erf flavor. The tanh approximation is
+    // decomposed into primitive ops ahead of time when it follows a GEMM
+    // (see decompose_gelu.cpp); reject whatever is left so it falls back
+    // instead of silently computing the wrong flavor.
+    auto approximate = toIValue(node->namedInput("approximate"));
+    REQUIRE(approximate.has_value() && approximate->toStringRef() == "none");
     return makeEltwiseOp(node, opkind::GELU);
+  }
   else if (nodeKind == Symbol::fromQualString("aten::round"))
     return makeEltwiseOp(node, opkind::Round);
   else if (nodeKind == Symbol::fromQualString("aten::exp"))
@@ -1,4 +1,5 @@
 #include <oneapi/dnnl/dnnl_graph.hpp>
+#include <torch/csrc/jit/codegen/onednn/decompose_gelu.h>
 #include <torch/csrc/jit/codegen/onednn/decompose_silu.h>
 #include <torch/csrc/jit/codegen/onednn/defer_size_check.h>
 #include <torch/csrc/jit/codegen/onednn/graph_fuser.h>
@@ -10,6 +11,7 @@
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/passes/decompose_ops.h>
 #include <torch/csrc/jit/passes/pass_manager.h>
+#include <torch/csrc/jit/passes/remove_dropout.h>
 #include <torch/csrc/jit/passes/remove_mutation.h>
 #include <torch/csrc/jit/passes/tensorexpr_fuser.h>
 #include <torch/csrc/jit/runtime/custom_operator.h>
@@ -67,9 +69,15 @@ void fuseGraph(std::shared_ptr<Graph>& g) {
       return supportedOps.count(nodeToFunctionalize->kind()) != 0;
     });
     RemoveListMutation(g);
-    GRAPH_DUMP("After mutation removal. Before DecomposeSiluForLlga", g);
+    GRAPH_DUMP("After mutation removal. Before removeDropout", g);
+    // Inference-mode dropout is an identity op that would otherwise split
+    // partitions between a GEMM and its epilogue.
+    removeDropout(g);
+    GRAPH_DUMP("After removeDropout. Before DecomposeSiluForLlga", g);
     DecomposeSiluForLLGA(g);
-    GRAPH_DUMP("After DecomposeSiluForLlga. Before PrepareBinaryForLLGA", g);
+    GRAPH_DUMP("After DecomposeSiluForLlga. Before DecomposeGeluForLlga", g);
+    DecomposeGeluForLLGA(g);
+    GRAPH_DUMP("After DecomposeGeluForLlga. Before PrepareBinaryForLLGA", g);
     PrepareBinaryForLLGA(g);
     GRAPH_DUMP("After PrepareBinaryForLLGA. Before DeferSizeCheck", g);
     DeferSizeCheck(g);
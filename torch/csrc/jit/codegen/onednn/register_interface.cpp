@@ -13,6 +13,8 @@ static bool canFuseNode(const Node* node) {
     case aten::layer_norm:
     case aten::add:
     case aten::mul:
+    case aten::div:
+    case aten::silu:
     case aten::tanh:
     case aten::relu:
     case aten::elu:
@@ -9,6 +9,8 @@
 #include <optional>
 
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 using at::TypeKind;
@@ -414,11 +416,34 @@ std::variant<OperatorName, FunctionSchema> parseSchemaOrName(
 }
 
 FunctionSchema parseSchema(const std::string& schema, bool allow_typevars) {
+  // Schema strings are parsed over and over at startup: every TORCH_LIBRARY
+  // registration, JIT operator table, and unboxed wrapper comes through
+  // here, and identical strings recur across those paths. Copying a parsed
+  // FunctionSchema is much cheaper than lexing and parsing the string, so
+  // keep a process-wide cache of results. The allow_typevars flag is part of
+  // the key since it changes how unknown lowercase types are treated. Both
+  // statics are intentionally leaked: cache entries hold TypePtrs whose
+  // singletons may be torn down first at exit.
+  static auto* cache_mutex = new std::mutex();
+  static auto* cache = new std::unordered_map<std::string, FunctionSchema>();
+  std::string key = (allow_typevars ? "v:" : "n:") + schema;
+  {
+    std::lock_guard<std::mutex> lock(*cache_mutex);
+    auto it = cache->find(key);
+    if (it != cache->end()) {
+      return it->second;
+    }
+  }
   auto parsed = parseSchemaOrName(schema, allow_typevars);
   TORCH_CHECK(
       std::holds_alternative<FunctionSchema>(parsed),
       "Tried to parse a function schema but only the operator name was given");
-  return std::get<FunctionSchema>(std::move(parsed));
+  auto result = std::get<FunctionSchema>(std::move(parsed));
+  {
+    std::lock_guard<std::mutex> lock(*cache_mutex);
+    cache->emplace(std::move(key), result);
+  }
+  return result;
 }
 
 OperatorName parseName(const std::string& name) {
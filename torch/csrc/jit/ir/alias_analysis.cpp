@@ -328,7 +328,7 @@ bool AliasDb::hasWriters(const Value* v) const {
   }
 
   const auto& el = it->second;
-  return writtenToLocationsIndex_->intersects(
+  return writtenToLocationsIndex().intersects(
       memoryDAG_->getMemoryLocations(el));
 }
 
@@ -1522,6 +1522,40 @@ void AliasDb::copyValue(Value* from, Value* to) {
   origElem->values.insert(to);
 }
 
+void AliasDb::registerWrittenValue(
+    Node* n,
+    const Value* v,
+    bool writeToContained) {
+  if (!isMutableTypeInternal(v)) {
+    return;
+  }
+  auto it = elementMap_.find(v);
+  TORCH_INTERNAL_ASSERT(
+      it != elementMap_.end(), "Tried to write to value not in MemoryDAG");
+  MemoryLocations writtenMemoryLocations;
+  if (writeToContained) {
+    memoryDAG_->collectAllContainedMemoryLocations(
+        it->second, writtenMemoryLocations);
+  } else {
+    writtenMemoryLocations = memoryDAG_->getMemoryLocations(it->second);
+  }
+  (*writeIndex_)[n] |= writtenMemoryLocations;
+  // Additions only widen the written-to set, so when the cache is fresh it
+  // can be updated in place instead of being marked stale.
+  if (!writtenToLocationsStale_) {
+    *writtenToLocationsIndex_ |= writtenMemoryLocations;
+  }
+}
+
+void AliasDb::eraseNodeWrites(Node* n) {
+  if (writeIndex_->erase(n) == 0) {
+    return;
+  }
+  // Removal can shrink the written-to set; defer the rebuild so that bulk
+  // removals pay for a single one at the next query.
+  writtenToLocationsStale_ = true;
+}
+
 bool AliasDb::moveAfterTopologicallyValid(Node* n, Node* movePoint) {
   return tryMove(n, movePoint, MoveSide::AFTER, /*dryRun=*/false);
 }
@@ -1981,13 +2015,21 @@ std::optional<Element*> AliasDb::setWildcard(const Value* v) {
   return maybe_wildcardElement;
 }
 
-void AliasDb::buildWrittenToLocationsIndex() {
+void AliasDb::buildWrittenToLocationsIndex() const {
   MemoryLocations ret;
   for (const auto& pr : *writeIndex_) {
     const auto& writtenLocs = pr.second;
     ret |= writtenLocs;
   }
   writtenToLocationsIndex_ = ret;
+  writtenToLocationsStale_ = false;
+}
+
+const MemoryLocations& AliasDb::writtenToLocationsIndex() const {
+  if (writtenToLocationsStale_) {
+    buildWrittenToLocationsIndex();
+  }
+  return *writtenToLocationsIndex_;
 }
 
 void Lint(const AliasDb* db) {
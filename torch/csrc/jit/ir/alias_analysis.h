@@ -166,6 +166,23 @@ class AliasDb {
   // Create a new `value` that does not alias anything else.
   TORCH_API void createValue(const Value* value);
 
+  // Record that `n` writes to `v`, updating the write index in place. Use
+  // together with the methods above when inserting a mutating node after
+  // construction, instead of rebuilding the whole AliasDb (which makes pass
+  // pipelines quadratic in graph size). When `writeToContained` is true the
+  // write covers everything `v` may contain, matching how ops that mutate
+  // containers are analyzed.
+  TORCH_API void registerWrittenValue(
+      Node* n,
+      const Value* v,
+      bool writeToContained = false);
+  // Forget all writes recorded for `n`, e.g. before destroying the node. The
+  // memory DAG entries for the node's values are left in place; they become
+  // unreachable and are merely conservative. The written-to locations cache
+  // is only marked stale, so bulk removals pay for a single rebuild at the
+  // next query rather than one per node.
+  TORCH_API void eraseNodeWrites(Node* n);
+
   // Enable more precise treatment of prim::TupleConstruct.
   void enablePreciseTupleContainerAnalysis();
 
@@ -301,9 +318,13 @@ class AliasDb {
   // Map of nodes to the memory locations that they write to
   using TWriteIndex = ska::flat_hash_map<Node*, MemoryLocations>;
   std::optional<TWriteIndex> writeIndex_;
-  // Collection of all memory locations that are written to.
-  std::optional<MemoryLocations> writtenToLocationsIndex_;
-  void buildWrittenToLocationsIndex();
+  // Collection of all memory locations that are written to. Rebuilt lazily:
+  // eraseNodeWrites only marks it stale, so queries trigger at most one
+  // rebuild per batch of mutations.
+  mutable std::optional<MemoryLocations> writtenToLocationsIndex_;
+  mutable bool writtenToLocationsStale_ = false;
+  void buildWrittenToLocationsIndex() const;
+  const MemoryLocations& writtenToLocationsIndex() const;
 
   std::unordered_set<const Value*> wildcards_;
 
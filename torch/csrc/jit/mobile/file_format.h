@@ -137,7 +137,11 @@ static inline std::tuple<std::shared_ptr<char>, size_t> get_file_content(
   struct stat statbuf {};
   fstat(fd, &statbuf);
   size_t size = statbuf.st_size;
-  void* ptr = mmap(nullptr, statbuf.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  // MAP_PRIVATE + PROT_WRITE gives copy-on-write pages: tensors handed out
+  // aliasing the mapping can be mutated in place without faulting or
+  // touching the file on disk.
+  void* ptr = mmap(
+      nullptr, statbuf.st_size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
   close(fd);
   auto deleter = [statbuf](char* ptr) { munmap(ptr, statbuf.st_size); };
   std::shared_ptr<char> data(reinterpret_cast<char*>(ptr), deleter);
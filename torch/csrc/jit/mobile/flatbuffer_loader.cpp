@@ -75,7 +75,8 @@ static constexpr c10::string_view kCustomClassPrefix =
 static constexpr c10::string_view kTorchPrefix = "__torch__";
 static constexpr c10::string_view kJitPrefix = "torch.jit";
 
-class FlatbufferLoader final {
+class FlatbufferLoader final
+    : public std::enable_shared_from_this<FlatbufferLoader> {
  public:
   FlatbufferLoader();
 
@@ -123,6 +124,16 @@ class FlatbufferLoader final {
     should_copy_tensor_memory_ = should_copy_tensor_memory;
   }
 
+  // Defers parsing of method bodies until a method is first called.
+  // `buffer` backs the flatbuffer input (typically an mmap-ed file) and
+  // is kept alive, together with this loader, by the pending methods
+  // until every one of them has been materialized. Only valid when the
+  // loader itself is owned by a shared_ptr.
+  void setShouldDelayMethodParsing(std::shared_ptr<char> buffer) {
+    should_delay_method_parsing_ = true;
+    buffer_ = std::move(buffer);
+  }
+
   std::shared_ptr<mobile::CompilationUnit> mcu_;
   std::shared_ptr<CompilationUnit> cu_;
 
@@ -130,6 +141,9 @@ class FlatbufferLoader final {
   IValue parseIValue(const mobile::serialization::IValue* ivalue);
   std::unique_ptr<mobile::Function> parseFunction(
       const mobile::serialization::Function* method);
+  void parseFunctionInto(
+      mobile::Function& function,
+      const mobile::serialization::Function* method);
   void parseAndPopulate(
       uint32_t i,
       const mobile::serialization::IValue* ivalue);
@@ -147,8 +161,10 @@ class FlatbufferLoader final {
       ivalue_parsers_;
   TypeResolver type_resolver_ = nullptr;
   mobile::serialization::Module* module_ = nullptr;
+  std::shared_ptr<char> buffer_;
   bool module_parsed_ = false;
   bool should_copy_tensor_memory_ = false;
+  bool should_delay_method_parsing_ = false;
   // 0 -> mobile_ivalue_size_ elements are from the mobile module.
   uint32_t mobile_ivalue_size_ = 0;
 };
@@ -271,7 +287,20 @@ void FlatbufferLoader::parseAndPopulate(
     uint32_t i,
     const mobile::serialization::IValue* ivalue) {
   if (const auto* func = ivalue->val_as_Function()) {
-    auto func_ptr = parseFunction(func);
+    std::unique_ptr<mobile::Function> func_ptr;
+    if (should_delay_method_parsing_) {
+      // Register a shell that only knows its name, so method lookup
+      // works; the body is materialized on first call, straight from the
+      // mapped flatbuffer input.
+      func_ptr = std::make_unique<mobile::Function>(
+          c10::QualifiedName(func->qn()->str()));
+      func_ptr->set_delayed_parse(
+          [loader = shared_from_this(), func](mobile::Function& function) {
+            loader->parseFunctionInto(function, func);
+          });
+    } else {
+      func_ptr = parseFunction(func);
+    }
     all_functions_[i] = func_ptr.get();
     mcu_->register_function(std::move(func_ptr));
   } else {
@@ -345,18 +374,25 @@ std::unique_ptr<mobile::Function> FlatbufferLoader::parseFunction(
     const mobile::serialization::Function* method) {
   auto function = std::make_unique<mobile::Function>(
       c10::QualifiedName(method->qn()->str()));
+  parseFunctionInto(*function, method);
+  return function;
+}
+
+void FlatbufferLoader::parseFunctionInto(
+    mobile::Function& function,
+    const mobile::serialization::Function* method) {
   // TODO(qihan) add debug handle
   // const auto* debug_handle = method->debug_info()->debug_handle();
   for (const auto* inst : *method->instructions()) {
-    function->append_instruction(
+    function.append_instruction(
         static_cast<OpCode>(inst->op()), inst->x(), inst->n());
   }
 
   for (uint32_t i : *method->constants()) {
-    function->append_constant(getIValue(i));
+    function.append_constant(getIValue(i));
   }
 
-  appendUpgraderFunctions(function.get());
+  appendUpgraderFunctions(&function);
   // 2. Decides if upgrader is needed
   const uint32_t operator_version = module_->operator_version();
   bool use_upgrader =
@@ -368,14 +404,14 @@ std::unique_ptr<mobile::Function> FlatbufferLoader::parseFunction(
       num_args = op->num_args_serialized();
     }
 
-    function->append_operator(
+    function.append_operator(
         op->name()->str(), op->overload_name()->str(), num_args);
   }
 
-  function->initialize_operators(true);
+  function.initialize_operators(true);
 
   for (const auto i : *method->type_annotations()) {
-    function->append_type(getOrCreateTypeAnnotations(i));
+    function.append_type(getOrCreateTypeAnnotations(i));
   }
 
   // 3. If upgrader is needed, change change the OP instrunction to CALL
@@ -383,11 +419,11 @@ std::unique_ptr<mobile::Function> FlatbufferLoader::parseFunction(
   // function and do the actual change)
   if (use_upgrader) {
 #ifndef DISABLE_UPGRADER
-    applyUpgrader(function.get(), operator_version);
+    applyUpgrader(&function, operator_version);
 #endif
   }
 
-  function->set_register_size(method->register_size());
+  function.set_register_size(method->register_size());
   if (method->schema()) {
     try {
       auto parseArgList = [this](const auto* args_fb) {
@@ -412,11 +448,10 @@ std::unique_ptr<mobile::Function> FlatbufferLoader::parseFunction(
           false /*is_varargs*/,
           false /*is_varret*/);
 
-      function->setSchema(std::move(schema));
+      function.setSchema(std::move(schema));
     } catch (const c10::Error& e) {
     }
   }
-  return function;
 }
 
 IValue parseEnum(
@@ -788,13 +823,36 @@ mobile::Module parse_and_initialize_mobile_module(
     std::shared_ptr<char> data,
     size_t size,
     std::optional<at::Device> device,
-    ExtraFilesMap* extra_files) {
-  mobile::Module m = parse_and_initialize_mobile_module(
-      data.get(),
-      size,
-      device,
-      extra_files,
-      /*should_copy_tensor_memory=*/false);
+    ExtraFilesMap* extra_files,
+    bool should_delay_method_parsing) {
+  if (!should_delay_method_parsing) {
+    mobile::Module m = parse_and_initialize_mobile_module(
+        data.get(),
+        size,
+        device,
+        extra_files,
+        /*should_copy_tensor_memory=*/false);
+    m.set_delete_memory(std::move(data));
+    return m;
+  }
+
+  // Validate Flatbuffer module before parsing.
+  flatbuffers::Verifier verifier(reinterpret_cast<uint8_t*>(data.get()), size);
+  TORCH_CHECK(
+      mobile::serialization::VerifyModuleBuffer(verifier),
+      "Malformed Flatbuffer module");
+
+  // The loader must outlive the parse call: every method that has not
+  // been called yet holds a callback into it (and through it, `data`).
+  auto loader = std::make_shared<FlatbufferLoader>();
+  loader->setShouldDelayMethodParsing(data);
+
+  auto* flatbuffer_module = mobile::serialization::GetMutableModule(data.get());
+  auto* end = data.get() + size;
+  mobile::Module m = loader->parseModule(flatbuffer_module, end);
+  if (extra_files != nullptr) {
+    parseExtraFiles(flatbuffer_module, *extra_files);
+  }
   m.set_delete_memory(std::move(data));
   return m;
 }
@@ -832,10 +890,11 @@ mobile::Module parse_and_initialize_mobile_module_for_jit(
 mobile::Module load_mobile_module_from_file(
     const std::string& filename,
     std::optional<c10::Device> device,
-    ExtraFilesMap* extra_files) {
+    ExtraFilesMap* extra_files,
+    bool should_delay_method_parsing) {
   auto [data, size] = get_file_content(filename.c_str());
   return parse_and_initialize_mobile_module(
-      std::move(data), size, device, extra_files);
+      std::move(data), size, device, extra_files, should_delay_method_parsing);
 }
 
 uint64_t get_bytecode_version(std::istream& in) {
@@ -70,11 +70,17 @@ TORCH_API mobile::Module parse_and_initialize_mobile_module(
 //
 // If you do not want the Module to hold a reference to `data`, see the raw
 // pointer overload of this function.
+//
+// If should_delay_method_parsing is true, method bodies are not parsed at
+// load time; each method materializes its bytecode, constants, and
+// operators straight from `data` (which stays mapped/alive) the first time
+// it is called. This trades first-call latency for a much cheaper load.
 TORCH_API mobile::Module parse_and_initialize_mobile_module(
     std::shared_ptr<char> data,
     size_t size, // of `data`, in bytes.
     std::optional<at::Device> device = std::nullopt,
-    ExtraFilesMap* extra_files = nullptr);
+    ExtraFilesMap* extra_files = nullptr,
+    bool should_delay_method_parsing = false);
 
 // Parse a mobile::Module from raw bytes, also returning JIT-related metadata.
 //
@@ -100,7 +106,8 @@ TORCH_API mobile::Module parse_and_initialize_mobile_module_for_jit(
 TORCH_API mobile::Module load_mobile_module_from_file(
     const std::string& filename,
     std::optional<at::Device> device = std::nullopt,
-    ExtraFilesMap* extra_files = nullptr);
+    ExtraFilesMap* extra_files = nullptr,
+    bool should_delay_method_parsing = false);
 
 TORCH_API uint64_t get_bytecode_version(std::istream& in);
 TORCH_API uint64_t get_bytecode_version(const std::string& filename);
@@ -131,7 +131,22 @@ const c10::FunctionSchema& Function::getSchema() const {
   return *schema_;
 }
 
+void Function::set_delayed_parse(std::function<void(Function&)> parse) {
+  delayed_parse_ = std::move(parse);
+}
+
+void Function::ensure_defined() {
+  if (delayed_parse_) {
+    // Drop the callback before running it so a re-entrant call (e.g. a
+    // method invoking itself) does not parse twice.
+    auto parse = std::move(delayed_parse_);
+    delayed_parse_ = nullptr;
+    parse(*this);
+  }
+}
+
 void Function::run(Stack& stack) {
+  ensure_defined();
   initialize_operators(/* should_check_operators */ true);
   if (hasSchema()) { // if we have a schema then resolve optional args if any
     getSchema().checkAndNormalizeInputs<c10::DynamicType>(
@@ -151,6 +166,7 @@ size_t Function::num_inputs() const {
 }
 
 bool Function::call(Stack&, c10::function_ref<void(const mobile::Code&)> f) {
+  ensure_defined();
   initialize_operators(true);
   f(code_);
   return true;
@@ -161,6 +177,7 @@ const Code& Function::get_code() const {
 }
 
 Code& Function::get_code() {
+  ensure_defined();
   return code_;
 }
 
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <vector>
 
 #include <ATen/core/function.h>
@@ -23,7 +24,9 @@ class TORCH_API Function : public torch::jit::Function {
       std::optional<c10::FunctionSchema> schema);
   void run(Stack& stack) override;
   at::IValue operator()(Stack& stack);
-  void ensure_defined() override {}
+  // Materializes a lazily loaded function by running its pending parse
+  // callback, if any. Called before anything that needs code_ populated.
+  void ensure_defined() override;
   size_t num_inputs() const override;
   const c10::QualifiedName& qualname() const override;
   bool call(Stack&, c10::function_ref<void(const mobile::Code&)>) override;
@@ -68,10 +71,17 @@ class TORCH_API Function : public torch::jit::Function {
   // in unsupported_op_names
   bool initialize_operators(bool should_check_operators);
 
+  // Lazily loaded modules register a parse callback instead of a fully
+  // populated Code; ensure_defined() runs it once, before the first
+  // execution, to materialize code_ (and the schema). See
+  // FlatbufferLoader::setShouldDelayMethodParsing.
+  void set_delayed_parse(std::function<void(Function&)> parse);
+
  private:
   c10::QualifiedName name_;
   Code code_;
   std::optional<c10::FunctionSchema> schema_; // (byte-code version 4+)
+  std::function<void(Function&)> delayed_parse_;
 };
 
 std::optional<std::function<void(Stack&)>> makeOperatorFunction(
@@ -587,7 +587,12 @@ mobile::Module _load_mobile_from_bytes(
     }
     case FileFormat::FlatbufferFileFormat: {
       return parse_and_initialize_mobile_module(
-          data, size, device, &extra_files);
+          data,
+          size,
+          device,
+          &extra_files,
+          (module_load_options &
+           MobileModuleLoadOptions::LAZY_METHOD_PARSING) != 0);
     }
     default: {
       TORCH_CHECK(false, "Format error");
@@ -171,13 +171,12 @@ std::map<std::string, at::Tensor> load_parameters_from_zip(
   return map;
 }
 
-} // namespace
-
 /**
- * Extracts the parameter map stored in @p module. Expects a layout
- * compatible with the one created by #_save_parameters().
+ * Returns the Dict<string, Tensor> stored in @p module under the attribute
+ * written by #_save_parameters(). Calls #TORCH_CHECK() if no such attribute
+ * exists.
  */
-std::map<std::string, at::Tensor> mobile_module_to_parameter_map(
+c10::Dict<c10::IValue, c10::IValue> extract_parameter_dict(
     const mobile::Module& module) {
   // Safely look for a slot with the expected name. Note that
   // c10::ivalue::Object::getAttr() is not safe if the attribute isn't present.
@@ -201,20 +200,7 @@ std::map<std::string, at::Tensor> mobile_module_to_parameter_map(
             keyType->fallback()->kind() == TypeKind::StringType &&
             valueType != nullptr &&
             valueType->fallback()->kind() == TypeKind::TensorType) {
-          // Name and type are good; copy the contents to the output map.
-          std::map<std::string, at::Tensor> params;
-          for (const auto& e : data_dict) {
-            // The source Tensor points into the flatbuffer data associated with
-            // the Module. But, this Tensor needs to outlive the Module, since
-            // the caller of _load_parameters() won't have a pointer to the
-            // Module. So, return a deep copy.
-            const auto& source = e.value().toTensor();
-            at::Tensor copy = at::empty_like(source); // Must be the same shape.
-            copy.copy_(source);
-
-            params[e.key().toStringRef()] = copy;
-          }
-          return params;
+          return data_dict;
         }
       }
     }
@@ -227,6 +213,76 @@ std::map<std::string, at::Tensor> mobile_module_to_parameter_map(
       "' in deserialized mobile::Module");
 }
 
+/**
+ * Extracts the parameter map from @p module without copying tensor bytes.
+ * The tensors parsed from a flatbuffer alias the (typically mmapped) buffer
+ * backing the module, so each returned tensor is re-wrapped in a storage
+ * whose DataPtr keeps @p data alive; the mapping is released once the last
+ * tensor is gone.
+ */
+std::map<std::string, at::Tensor> parameter_map_sharing_buffer(
+    const mobile::Module& module,
+    const std::shared_ptr<char>& data) {
+  std::map<std::string, at::Tensor> params;
+  for (const auto& e : extract_parameter_dict(module)) {
+    const auto& source = e.value().toTensor();
+    if (source.is_quantized()) {
+      // Rebuilding a quantized tensor around a foreign storage would also
+      // need its quantizer carried over; these are rare in checkpoints, so
+      // just pay for the copy.
+      at::Tensor copy = at::empty_like(source);
+      copy.copy_(source);
+      params[e.key().toStringRef()] = copy;
+      continue;
+    }
+    const at::Storage& source_storage = source.storage();
+
+    auto* ctx = new std::shared_ptr<char>(data);
+    at::DataPtr data_ptr(
+        source_storage.mutable_data(),
+        ctx,
+        [](void* ctx) { delete static_cast<std::shared_ptr<char>*>(ctx); },
+        source.device());
+    at::Storage storage(
+        c10::Storage::use_byte_size_t(),
+        source_storage.nbytes(),
+        std::move(data_ptr),
+        /*allocator=*/nullptr,
+        /*resizable=*/false);
+
+    params[e.key().toStringRef()] = at::empty({0}, source.options())
+                                        .set_(
+                                            storage,
+                                            source.storage_offset(),
+                                            source.sizes(),
+                                            source.strides());
+  }
+  return params;
+}
+
+} // namespace
+
+/**
+ * Extracts the parameter map stored in @p module. Expects a layout
+ * compatible with the one created by #_save_parameters().
+ */
+std::map<std::string, at::Tensor> mobile_module_to_parameter_map(
+    const mobile::Module& module) {
+  std::map<std::string, at::Tensor> params;
+  for (const auto& e : extract_parameter_dict(module)) {
+    // The source Tensor points into the flatbuffer data associated with
+    // the Module. But, this Tensor needs to outlive the Module, since
+    // the caller of _load_parameters() won't have a pointer to the
+    // Module. So, return a deep copy.
+    const auto& source = e.value().toTensor();
+    at::Tensor copy = at::empty_like(source); // Must be the same shape.
+    copy.copy_(source);
+
+    params[e.key().toStringRef()] = copy;
+  }
+  return params;
+}
+
 static std::map<std::string, at::Tensor> _load_parameters_bytes(
     const std::shared_ptr<char>& data,
     size_t size,
@@ -238,7 +294,10 @@ static std::map<std::string, at::Tensor> _load_parameters_bytes(
   switch (format) {
     case FileFormat::FlatbufferFileFormat: {
       auto m = parse_flatbuffer_no_object(data, size, device);
-      map = mobile_module_to_parameter_map(m);
+      // The buffer was verified and parsed in place (mmapped when loading
+      // from a file); hand the tensors out aliasing it instead of copying
+      // every parameter through memcpy.
+      map = parameter_map_sharing_buffer(m, data);
       break;
     }
 
@@ -10,6 +10,10 @@ enum MobileModuleLoadOptions {
   // files automatically without explicit entries mapping. Refer to PR for a
   // detail: https://github.com/pytorch/pytorch/pull/99747
   PARSE_ALL_EXTRA_FILE_MAPS = 2,
+  // LAZY_METHOD_PARSING defers parsing of method bodies until a method is
+  // first called. Only honored by the flatbuffer format, where methods can
+  // be materialized straight from the (typically mmap-ed) input buffer.
+  LAZY_METHOD_PARSING = 4,
 };
 
 const uint64_t kDefaultMobileLoadOptions =
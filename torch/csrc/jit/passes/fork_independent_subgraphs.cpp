@@ -0,0 +1,250 @@
+#include <torch/csrc/jit/passes/fork_independent_subgraphs.h>
+
+#include <c10/util/env.h>
+#include <c10/util/irange.h>
+#include <torch/csrc/jit/ir/alias_analysis.h>
+#include <torch/csrc/jit/jit_log.h>
+
+#include <algorithm>
+#include <atomic>
+
+namespace torch::jit {
+
+namespace {
+
+std::atomic<bool> fork_independent_subgraphs_enabled{
+    c10::utils::has_env("PYTORCH_JIT_FORK_INDEPENDENT_SUBGRAPHS")};
+
+// A maximal single-consumer chain of eligible nodes, in the order they
+// appear in the block. Chains are grown greedily: a node extends the chain
+// whose tail produced one of its inputs, provided no other open chain feeds
+// it. Nodes fed by several open chains are convergence points; they close
+// those chains and start a fresh one.
+struct Chain {
+  std::vector<Node*> nodes;
+  bool open = true;
+};
+
+bool isEligibleNode(const Node* node) {
+  return node->blocks().empty() && !node->hasSideEffects() &&
+      node->kind() != prim::Constant && node->kind() != prim::BailOut &&
+      node->kind() != prim::profile && node->kind() != prim::profile_ivalue;
+}
+
+// Rough proxy for runtime cost: the number of tensor elements the node reads
+// and writes, taken from the shapes the profiling executor recorded in the
+// value types. Unprofiled values count as one element, so chains of unknown
+// shapes never cross a meaningful threshold.
+int64_t nodeCost(const Node* node) {
+  int64_t cost = 0;
+  auto accumulate = [&](const Value* v) {
+    if (auto tt = v->type()->cast<TensorType>()) {
+      if (auto sizes = tt->sizes().concrete_sizes()) {
+        int64_t numel = 1;
+        for (auto s : *sizes) {
+          numel *= s;
+        }
+        cost += numel;
+        return;
+      }
+    }
+    cost += 1;
+  };
+  for (const Value* v : node->inputs()) {
+    accumulate(v);
+  }
+  for (const Value* v : node->outputs()) {
+    accumulate(v);
+  }
+  return cost;
+}
+
+bool chainIsSafeToFork(const Chain& chain, AliasDb& db) {
+  for (const Node* node : chain.nodes) {
+    for (const Value* v : node->inputs()) {
+      if (db.hasWriters(v)) {
+        return false;
+      }
+    }
+    for (const Value* v : node->outputs()) {
+      if (db.hasWriters(v)) {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Returns the single value the chain exposes to the rest of the block, or
+// nullptr if there is none or more than one. Only such chains can be turned
+// into a fork, whose subgraph returns exactly one value. The value must come
+// from the chain's tail, so every external use sits after the fork insertion
+// point.
+Value* singleExternalOutput(
+    const Chain& chain,
+    const std::unordered_set<Node*>& members) {
+  Value* external = nullptr;
+  for (Node* node : chain.nodes) {
+    for (Value* output : node->outputs()) {
+      for (const Use& use : output->uses()) {
+        if (members.count(use.user)) {
+          continue;
+        }
+        if (external != nullptr && external != output) {
+          return nullptr;
+        }
+        external = output;
+      }
+    }
+  }
+  if (external != nullptr && external->node() != chain.nodes.back()) {
+    return nullptr;
+  }
+  return external;
+}
+
+void forkChain(Graph& graph, const Chain& chain, Value* external_output) {
+  std::unordered_set<Node*> members(chain.nodes.begin(), chain.nodes.end());
+
+  auto subgraph = std::make_shared<Graph>();
+  Node* fork = graph.create(prim::fork, 1);
+  fork->g_(attr::Subgraph, subgraph);
+
+  // Clone the chain into the subgraph. Values produced outside the chain
+  // become fork inputs; they are all defined before the chain's tail, so the
+  // fork can be inserted in the tail's position.
+  std::unordered_map<Value*, Value*> inner;
+  for (Node* node : chain.nodes) {
+    for (Value* input : node->inputs()) {
+      if (inner.count(input)) {
+        continue;
+      }
+      Value* placeholder = subgraph->addInput()->copyMetadata(input);
+      fork->addInput(input);
+      inner[input] = placeholder;
+    }
+    Node* cloned = subgraph->createClone(
+        node, [&](Value* v) { return inner.at(v); });
+    subgraph->insertNode(cloned);
+    for (const auto i : c10::irange(node->outputs().size())) {
+      inner[node->output(i)] = cloned->output(i);
+    }
+  }
+  subgraph->registerOutput(inner.at(external_output));
+  fork->output()->setType(FutureType::create(external_output->type()));
+  fork->insertBefore(chain.nodes.back());
+
+  // Wait as late as possible: right before the first external use, so that
+  // everything in between runs concurrently with the forked chain.
+  Node* first_use = nullptr;
+  for (const Use& use : external_output->uses()) {
+    if (members.count(use.user)) {
+      continue;
+    }
+    if (first_use == nullptr || use.user->isBefore(first_use)) {
+      first_use = use.user;
+    }
+  }
+  TORCH_INTERNAL_ASSERT(first_use != nullptr);
+  Node* wait = graph.create(aten::wait, {fork->output()}, 1);
+  wait->output()->copyMetadata(external_output);
+  wait->insertBefore(first_use);
+  external_output->replaceAllUsesWith(wait->output());
+
+  for (auto it = chain.nodes.rbegin(); it != chain.nodes.rend(); ++it) {
+    (*it)->destroy();
+  }
+}
+
+bool forkIndependentSubgraphs(Block* block, AliasDb& db, int64_t min_cost) {
+  std::vector<Chain> chains;
+  std::unordered_map<Node*, size_t> chain_of;
+
+  for (Node* node : block->nodes()) {
+    if (!isEligibleNode(node)) {
+      continue;
+    }
+    // Open chains whose values this node consumes.
+    std::vector<size_t> producers;
+    for (Value* input : node->inputs()) {
+      auto it = chain_of.find(input->node());
+      if (it == chain_of.end() || !chains[it->second].open) {
+        continue;
+      }
+      if (std::find(producers.begin(), producers.end(), it->second) ==
+          producers.end()) {
+        producers.push_back(it->second);
+      }
+    }
+    if (producers.size() == 1) {
+      Chain& chain = chains[producers[0]];
+      Node* tail = chain.nodes.back();
+      const bool uses_tail = std::any_of(
+          node->inputs().begin(), node->inputs().end(), [&](Value* input) {
+            return input->node() == tail;
+          });
+      if (uses_tail) {
+        // Extends the chain whose tail feeds it.
+        chain.nodes.push_back(node);
+        chain_of[node] = producers[0];
+        continue;
+      }
+    }
+    // A convergence point (or a fan-out consumer): the chains it draws from
+    // can no longer grow, and the node starts a chain of its own.
+    for (size_t idx : producers) {
+      chains[idx].open = false;
+    }
+    chain_of[node] = chains.size();
+    chains.push_back(Chain{{node}, true});
+  }
+
+  // A forked chain only pays off if another expensive chain runs while it is
+  // in flight, so require at least two qualifying chains.
+  std::vector<std::pair<const Chain*, Value*>> candidates;
+  for (const Chain& chain : chains) {
+    int64_t cost = 0;
+    for (const Node* node : chain.nodes) {
+      cost += nodeCost(node);
+    }
+    if (cost < min_cost || !chainIsSafeToFork(chain, db)) {
+      continue;
+    }
+    std::unordered_set<Node*> members(chain.nodes.begin(), chain.nodes.end());
+    Value* external_output = singleExternalOutput(chain, members);
+    if (external_output == nullptr || external_output->uses().empty()) {
+      continue;
+    }
+    candidates.emplace_back(&chain, external_output);
+  }
+  if (candidates.size() < 2) {
+    return false;
+  }
+  for (const auto& [chain, external_output] : candidates) {
+    forkChain(*block->owningGraph(), *chain, external_output);
+  }
+  return true;
+}
+
+} // namespace
+
+bool ForkIndependentSubgraphs(
+    std::shared_ptr<Graph>& graph,
+    int64_t min_cost) {
+  AliasDb db(graph);
+  bool changed = forkIndependentSubgraphs(graph->block(), db, min_cost);
+  if (changed) {
+    GRAPH_DUMP("After ForkIndependentSubgraphs: ", graph);
+  }
+  return changed;
+}
+
+bool forkIndependentSubgraphsEnabled() {
+  return fork_independent_subgraphs_enabled;
+}
+
+void setForkIndependentSubgraphsEnabled(bool enabled) {
+  fork_independent_subgraphs_enabled = enabled;
+}
+
+} // namespace torch::jit
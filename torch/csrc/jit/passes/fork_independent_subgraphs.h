@@ -0,0 +1,30 @@
+#pragma once
+
+#include <torch/csrc/jit/ir/ir.h>
+
+namespace torch::jit {
+
+// Wraps independent chains of side-effect-free nodes into prim::fork /
+// aten::wait pairs so that the branches of multi-branch models run
+// concurrently on the interop thread pool instead of serially.
+//
+// A chain is only forked when the shapes recorded by the profiling executor
+// suggest it is expensive enough to amortize the task-launch overhead:
+// `min_cost` is the minimum number of tensor elements a chain must read and
+// write. Chains containing nodes with side effects, sub-blocks, or values
+// with writers (according to alias analysis) are never touched, and a fork
+// is only inserted when at least two chains qualify, since a single forked
+// chain has nothing to overlap with.
+//
+// Returns true if any fork was inserted.
+TORCH_API bool ForkIndependentSubgraphs(
+    std::shared_ptr<Graph>& graph,
+    int64_t min_cost = 256 * 1024);
+
+// Controls whether the profiling graph executor runs
+// `ForkIndependentSubgraphs`. Defaults to the
+// PYTORCH_JIT_FORK_INDEPENDENT_SUBGRAPHS environment variable.
+TORCH_API bool forkIndependentSubgraphsEnabled();
+TORCH_API void setForkIndependentSubgraphsEnabled(bool enabled);
+
+} // namespace torch::jit
@@ -8,6 +8,8 @@
 #include <c10/util/irange.h>
 #include <algorithm>
 #include <optional>
+#include <sstream>
+#include <unordered_map>
 
 namespace torch::jit {
 
@@ -596,6 +598,54 @@ bool areNodeInputsConstant(
       [&valsToParamsMap](Value* v) { return isConstant(v, valsToParamsMap); });
 }
 
+// Builds a fingerprint identifying a foldable node: op kind, opset version,
+// scalar attributes, and the identity of each constant input tensor. Nodes
+// with equal fingerprints fold to the same value, so repeated chains over
+// the same initializers (common with Shape/Gather/Concat subgraphs emitted
+// per use of a weight) are evaluated once per pass. Returns an empty string
+// for nodes carrying attribute kinds we do not fingerprint; those are
+// simply not memoized.
+std::string foldFingerprint(
+    const Node* node,
+    const std::vector<at::Tensor>& inputTensorValues,
+    int opset_version) {
+  std::ostringstream oss;
+  oss << node->kind().toQualString() << ':' << opset_version;
+  for (auto name : node->attributeNames()) {
+    oss << ';' << name.toUnqualString() << '=';
+    switch (node->kindOf(name)) {
+      case AttributeKind::i:
+        oss << node->i(name);
+        break;
+      case AttributeKind::is:
+        for (auto v : node->is(name)) {
+          oss << v << ',';
+        }
+        break;
+      case AttributeKind::f:
+        oss << node->f(name);
+        break;
+      case AttributeKind::fs:
+        for (auto v : node->fs(name)) {
+          oss << v << ',';
+        }
+        break;
+      case AttributeKind::s:
+        oss << node->s(name);
+        break;
+      default:
+        return std::string();
+    }
+  }
+  // Input tensors are identified by TensorImpl pointer, not content; the
+  // memo cache retains a reference to each fingerprinted input so the
+  // pointer cannot be reused for a different tensor while the cache lives.
+  for (const auto& tensor : inputTensorValues) {
+    oss << '|' << tensor.unsafeGetTensorImpl();
+  }
+  return oss.str();
+}
+
 std::vector<Node*> getOnnxConstParentsToRemove(Node* node) {
   std::vector<Node*> parentNodes;
   for (auto val : node->inputs()) {
@@ -628,6 +678,13 @@ void ConstantFoldONNX(Block* b, ParamMap& paramsDict, int opset_version) {
   }
   TORCH_INTERNAL_ASSERT(b->param_node());
   auto valsToParamsMap = buildValueToParamsMap(b, paramsDict);
+  // Memo cache for folded results, keyed by node fingerprint. The value
+  // keeps the fingerprinted input tensors alive so that the TensorImpl
+  // pointers baked into the key stay unique for the cache's lifetime
+  // (folding destroys consumed onnx::Constant nodes, which would otherwise
+  // free their tensors and allow pointer reuse).
+  std::unordered_map<std::string, std::pair<std::vector<at::Tensor>, at::Tensor>>
+      foldCache;
   // Only the root block is constant-folded. Folding nested blocks is
   // not supported for now.
   for (auto it = b->nodes().begin(), end = b->nodes().end(); it != end; ++it) {
@@ -649,8 +706,24 @@ void ConstantFoldONNX(Block* b, ParamMap& paramsDict, int opset_version) {
       // it.
       continue;
     }
-    auto updatedValWrapped = onnx_constant_fold::runTorchBackendForOnnx(
+    auto fingerprint = onnx_constant_fold::foldFingerprint(
         node, inputTensorValues, opset_version);
+    std::optional<at::Tensor> updatedValWrapped;
+    if (!fingerprint.empty()) {
+      auto cached = foldCache.find(fingerprint);
+      if (cached != foldCache.end()) {
+        updatedValWrapped = cached->second.second;
+      }
+    }
+    if (updatedValWrapped == std::nullopt) {
+      updatedValWrapped = onnx_constant_fold::runTorchBackendForOnnx(
+          node, inputTensorValues, opset_version);
+      if (updatedValWrapped != std::nullopt && !fingerprint.empty()) {
+        foldCache.emplace(
+            std::move(fingerprint),
+            std::make_pair(inputTensorValues, *updatedValWrapped));
+      }
+    }
     if (updatedValWrapped == std::nullopt) {
       // Constant folding is not supported for this op. Skip it.
       continue;
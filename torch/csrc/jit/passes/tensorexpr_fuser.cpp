@@ -10,6 +10,7 @@
 #include <torch/csrc/jit/ir/alias_analysis.h>
 #include <torch/csrc/jit/jit_log.h>
 #include <torch/csrc/jit/jit_opt_limit.h>
+#include <torch/csrc/jit/passes/canonicalize.h>
 #include <torch/csrc/jit/passes/common_subexpression_elimination.h>
 #include <torch/csrc/jit/passes/constant_pooling.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
@@ -24,6 +25,8 @@
 #include <torch/csrc/jit/runtime/symbolic_shape_registry_util.h>
 #include <torch/csrc/jit/tensorexpr/kernel.h>
 
+#include <mutex>
+#include <sstream>
 #include <utility>
 
 C10_DEFINE_bool(
@@ -1352,6 +1355,61 @@ void FuseTensorExprs(
   GRAPH_DUMP("After TExprFuser: ", graph);
 }
 
+// Shape symbols are drawn from a global counter, so isomorphic
+// generalizations of the same subgraph print different SS(-N) ids from one
+// re-specialization to the next. Renumbers them by first appearance so that
+// equal strings mean equal kernels; `renumber` carries assignments already
+// fixed by the symbolic shape argument order.
+static std::string renumberShapeSymbols(
+    const std::string& ir,
+    std::unordered_map<int64_t, int64_t>& renumber) {
+  std::string out;
+  out.reserve(ir.size());
+  size_t pos = 0;
+  while (pos < ir.size()) {
+    size_t start = ir.find("SS(", pos);
+    size_t end = start == std::string::npos ? start : ir.find(')', start);
+    if (end == std::string::npos) {
+      out.append(ir, pos, std::string::npos);
+      break;
+    }
+    const std::string sym_str = ir.substr(start + 3, end - start - 3);
+    int64_t sym = 0;
+    try {
+      sym = std::stoll(sym_str);
+    } catch (const std::exception&) {
+      // Not a shape symbol (e.g. "SS(" inside a string constant); copy it
+      // through untouched.
+      out.append(ir, pos, end - pos);
+      pos = end;
+      continue;
+    }
+    out.append(ir, pos, start + 3 - pos);
+    auto inserted =
+        renumber.emplace(sym, -static_cast<int64_t>(renumber.size()) - 1);
+    out.append(std::to_string(inserted.first->second));
+    pos = end;
+  }
+  return out;
+}
+
+// Dynamic-shape fusion groups are rebuilt from scratch whenever the executor
+// re-specializes, but shape generalization maps many concrete shapes onto
+// the same symbolic kernel, whose loop bounds are already runtime arguments.
+// Cache compiled kernels by a canonicalized signature of the generalized
+// subgraph, so a mid-traffic re-specialization that lands on a known
+// signature reuses the compiled kernel instead of paying for NNC compilation
+// again. The key covers everything compilation consumes: the canonical IR
+// (value types included), the symbolic shape argument order, the striding
+// descriptors, and the output convention. Entries are retained for the
+// lifetime of the process; the cache is bounded by the number of distinct
+// generalized subgraphs, which is exactly what it exists to keep small.
+static std::mutex dynamic_kernel_cache_mutex;
+static std::unordered_map<
+    std::string,
+    std::shared_ptr<tensorexpr::TensorExprKernel>>
+    dynamic_kernel_cache;
+
 static Operation createTensorExprOp(const Node* node) {
   bool dynamic_shape_fusion_node =
       node->hasAttribute(attr::striding_inputs_desc);
@@ -1366,7 +1424,7 @@ static Operation createTensorExprOp(const Node* node) {
   }
 
   // Handle the case when dynamic shape fusion is enabled.
-  VLOG(1) << "Compiling a new kernel for " << *node;
+  VLOG(1) << "Creating a dynamic-shape kernel for " << *node;
   std::vector<int64_t> sym_shapes;
   if (node->hasAttribute(attr::symbolic_shape_inputs)) {
     sym_shapes = node->is(attr::symbolic_shape_inputs);
@@ -1410,13 +1468,51 @@ static Operation createTensorExprOp(const Node* node) {
         strideInputFromString(output_desc.at(i))};
   }
 
-  std::shared_ptr<tensorexpr::TensorExprKernel> kernel =
-      std::make_shared<tensorexpr::TensorExprKernel>(
-          subgraph,
-          custom_lowerings,
-          sym_shapes,
-          /*pre_alloc*/ false,
-          stride_map);
+  // See dynamic_kernel_cache above. The renumbering is seeded from
+  // sym_shapes so the runtime argument positions participate in the key.
+  std::unordered_map<int64_t, int64_t> renumber;
+  std::ostringstream cache_key;
+  for (const int64_t sym : sym_shapes) {
+    renumber.emplace(sym, -static_cast<int64_t>(renumber.size()) - 1);
+    cache_key << renumber.at(sym) << ',';
+  }
+  cache_key << '|' << allow_stack_outputs << '|';
+  for (const auto& vec : sym_strides_strs) {
+    for (const std::string& str : vec) {
+      cache_key << str << ',';
+    }
+    cache_key << ';';
+  }
+  for (const std::string& str : output_desc) {
+    cache_key << str << ',';
+  }
+  cache_key << '|'
+            << renumberShapeSymbols(
+                   Canonicalize(subgraph, /*keep_unique_names=*/false)
+                       ->toString(/*print_source_locations=*/false),
+                   renumber);
+
+  std::shared_ptr<tensorexpr::TensorExprKernel> kernel;
+  {
+    std::lock_guard<std::mutex> lock(dynamic_kernel_cache_mutex);
+    auto it = dynamic_kernel_cache.find(cache_key.str());
+    if (it != dynamic_kernel_cache.end()) {
+      VLOG(1) << "Reusing cached dynamic-shape kernel for " << *node;
+      kernel = it->second;
+    }
+  }
+  if (!kernel) {
+    kernel = std::make_shared<tensorexpr::TensorExprKernel>(
+        subgraph,
+        custom_lowerings,
+        sym_shapes,
+        /*pre_alloc*/ false,
+        stride_map);
+    // Compilation runs unlocked, so two threads can race to compile the same
+    // signature; emplace keeps the first kernel and the loser is dropped.
+    std::lock_guard<std::mutex> lock(dynamic_kernel_cache_mutex);
+    dynamic_kernel_cache.emplace(cache_key.str(), kernel);
+  }
 
   auto num_subgraph_inputs = subgraph->inputs().size();
   return [kernel, num_subgraph_inputs, allow_stack_outputs](Stack& stack) {
@@ -65,7 +65,9 @@
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <pybind11/stl_bind.h>
+#include <torch/csrc/jit/mobile/import_data.h>
 #include <torch/csrc/jit/mobile/train/export_data.h>
+#include <torch/csrc/jit/serialization/export.h>
 #include <cstddef>
 #include <memory>
 #include <sstream>
@@ -473,6 +475,74 @@ static std::shared_ptr<Graph> _propagate_and_assign_input_shapes(
   return retval;
 }
 
+// Walks `block` in the order the IR printer emits nodes, invoking `fn` on
+// every tensor-valued prim::Constant. Both halves of plan persistence rely on
+// this order matching: the snapshot collects constants in it and the restore
+// patches them back in it.
+static void forEachTensorConstant(
+    Block* block,
+    const std::function<void(Node*)>& fn) {
+  for (Node* n : block->nodes()) {
+    if (n->kind() == prim::Constant && n->hasAttribute(attr::value) &&
+        n->kindOf(attr::value) == AttributeKind::t) {
+      fn(n);
+    }
+    for (Block* ib : n->blocks()) {
+      forEachTensorConstant(ib, fn);
+    }
+  }
+}
+
+// Captures the executor's type-specialized graph as (IR text, tensor
+// constants), suitable for stashing in a module's extra files. The tensor
+// constants travel out of band because the IR printer elides their payloads
+// (`parseIR` reconstitutes them with placeholder data). Returns None when
+// there is no plan to persist or the graph doesn't round-trip through the
+// parser (e.g. it already references fallback functions).
+static py::object _snapshot_optimized_plan(GraphExecutor& executor) {
+  auto specialized = executor.snapshotSpecializedGraph();
+  if (!specialized) {
+    return py::none();
+  }
+  bool serializable = true;
+  for (Node* n : specialized->nodes()) {
+    if (n->kind() == prim::Constant && !n->outputs().empty() &&
+        n->output()->type()->cast<FunctionType>()) {
+      serializable = false;
+      break;
+    }
+  }
+  if (!serializable) {
+    return py::none();
+  }
+  std::vector<at::Tensor> constants;
+  forEachTensorConstant(specialized->block(), [&](Node* n) {
+    constants.push_back(n->t(attr::value));
+  });
+  return py::make_tuple(
+      specialized->toString(/*print_source_locations=*/false),
+      std::move(constants));
+}
+
+static void _restore_optimized_plan(
+    GraphExecutor& executor,
+    const std::string& serialized_ir,
+    const std::vector<at::Tensor>& constants) {
+  auto specialized = std::make_shared<Graph>();
+  parseIR(serialized_ir, specialized.get(), /*parse_tensor_constants=*/true);
+  size_t idx = 0;
+  forEachTensorConstant(specialized->block(), [&](Node* n) {
+    TORCH_CHECK(
+        idx < constants.size(),
+        "Optimized plan snapshot has fewer tensor constants than its IR expects");
+    n->t_(attr::value, constants[idx++]);
+  });
+  TORCH_CHECK(
+      idx == constants.size(),
+      "Optimized plan snapshot has more tensor constants than its IR expects");
+  executor.restoreOptimizedPlan(specialized);
+}
+
 void addFunctionToModule(Module& module, const StrongFunctionPtr& func) {
   // Make a graph with a fake self argument
   auto graph = toGraphFunction(*func.function_).graph()->copy();
@@ -1515,6 +1585,22 @@ void initJitScriptBindings(PyObject* module) {
                 .get_executor()
                 .debugFlushCompilationCache();
           })
+      .def(
+          "_snapshot_optimized_plan",
+          [](const StrongFunctionPtr& self) {
+            return _snapshot_optimized_plan(
+                toGraphFunction(*self.function_).get_executor());
+          })
+      .def(
+          "_restore_optimized_plan",
+          [](const StrongFunctionPtr& self,
+             const std::string& serialized_ir,
+             const std::vector<at::Tensor>& constants) {
+            _restore_optimized_plan(
+                toGraphFunction(*self.function_).get_executor(),
+                serialized_ir,
+                constants);
+          })
       .def_property_readonly(
           "name",
           [](const StrongFunctionPtr& self) { return self.function_->name(); })
@@ -1572,6 +1658,19 @@ void initJitScriptBindings(PyObject* module) {
           [](Method& self) {
             return self.get_executor().debugFlushCompilationCache();
           })
+      .def(
+          "_snapshot_optimized_plan",
+          [](Method& self) {
+            return _snapshot_optimized_plan(self.get_executor());
+          })
+      .def(
+          "_restore_optimized_plan",
+          [](Method& self,
+             const std::string& serialized_ir,
+             const std::vector<at::Tensor>& constants) {
+            _restore_optimized_plan(
+                self.get_executor(), serialized_ir, constants);
+          })
       .def_property_readonly(
           "code_with_constants",
           [](Method& self) {
@@ -2373,6 +2472,19 @@ void initJitScriptBindings(PyObject* module) {
         _save_parameters(map, filename, use_flatbuffer);
       });
 
+  m.def(
+      "_set_export_storage_deduplication",
+      [](bool enabled) { setExportStorageDeduplication(enabled); });
+  m.def("_get_export_storage_deduplication", []() {
+    return getExportStorageDeduplication();
+  });
+
+  m.def("_load_parameters", [](const std::string& filename) {
+    // Flatbuffer archives are mmapped and the returned tensors alias the
+    // mapping, so this avoids decoding a pickle opcode stream entirely.
+    return _load_parameters(filename);
+  });
+
   m.def("_load_mobile_module_from_file", [](const std::string& filename) {
     return torch::jit::load_mobile_module_from_file(filename);
   });
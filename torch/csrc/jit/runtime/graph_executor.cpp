@@ -855,6 +855,23 @@ void GraphExecutor::debugFlushCompilationCache() {
   }
 }
 
+std::shared_ptr<Graph> GraphExecutor::snapshotSpecializedGraph() {
+  if (auto ppImpl =
+          std::dynamic_pointer_cast<ProfilingGraphExecutorImpl>(pImpl)) {
+    return ppImpl->snapshotSpecializedGraph();
+  }
+  // Plan persistence is only meaningful for the profiling executor.
+  return nullptr;
+}
+
+void GraphExecutor::restoreOptimizedPlan(
+    const std::shared_ptr<Graph>& specialized_graph) {
+  if (auto ppImpl =
+          std::dynamic_pointer_cast<ProfilingGraphExecutorImpl>(pImpl)) {
+    ppImpl->restoreOptimizedPlan(specialized_graph);
+  }
+}
+
 bool GraphExecutor::isOptimized() const {
   return pImpl && pImpl->isOptimized();
 }
@@ -92,6 +92,14 @@ struct TORCH_API GraphExecutor {
 
   void debugFlushCompilationCache();
 
+  // Plan persistence for the profiling executor: returns a serializable,
+  // type-specialized copy of the profiled graph (or nullptr if profiling is
+  // not finished or the legacy executor is in use), and rebuilds the
+  // optimized plan from such a graph so a restarted process skips the
+  // profiling warmup. See ProfilingGraphExecutorImpl for details.
+  std::shared_ptr<Graph> snapshotSpecializedGraph();
+  void restoreOptimizedPlan(const std::shared_ptr<Graph>& specialized_graph);
+
   bool isOptimized() const;
 
  private:
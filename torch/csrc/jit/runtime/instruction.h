@@ -73,7 +73,9 @@ namespace torch::jit {
   _(WARN, "I") /* emit a warning with line information */                      \
   _(ENTER, "EN") /* enter scope of a contextmanager */                         \
   _(EXIT, "EX") /* exit the last entered contextmanager */                     \
-  _(AWAITABLE, "CN") /* initialize await for code entry x with N inputs  */
+  _(AWAITABLE, "CN") /* initialize await for code entry x with N inputs  */    \
+  _(LOAD2, "RR") /* superinstruction: push values from registers X and N */    \
+  _(OP_STORE, "OR") /* superinstruction: invoke operator X, store to reg N */
 
 enum OpCode : uint8_t {
 #define DEFINE_OP(op, _) op,
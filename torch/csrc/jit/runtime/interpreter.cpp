@@ -6,6 +6,7 @@
 #include <c10/core/thread_pool.h>
 #include <c10/macros/Macros.h>
 #include <c10/util/Exception.h>
+#include <c10/util/env.h>
 #include <c10/util/irange.h>
 #include <torch/csrc/autograd/edge.h>
 #include <torch/csrc/autograd/grad_mode.h>
@@ -119,6 +120,12 @@ bool in_torchscript_runtime() {
   return tls_int_state_ptr_ != nullptr;
 }
 
+std::atomic<bool>& getInstructionFusionMode() {
+  static std::atomic<bool> fusion_mode{
+      c10::utils::has_env("PYTORCH_JIT_SUPERINSTRUCTIONS")};
+  return fusion_mode;
+}
+
 // InterpreterState state that and used to compute a Code
 struct InterpreterStateImpl : c10::intrusive_ptr_target {
   InterpreterStateImpl(const Code& code, TaskLauncher taskLauncher)
@@ -358,11 +365,27 @@ struct InterpreterStateImpl : c10::intrusive_ptr_target {
             stackSizeGuard.callAssert();
           }
             INST_NEXT;
+          case INST(OP_STORE): {
+            [[maybe_unused]] auto _ = instGuard();
+            {
+              auto stackSizeGuard = stackSizeAssertGuard();
+              frame.function->operator_table_[inst.X](stack);
+              stackSizeGuard.callAssert();
+            }
+            reg(inst.N) = pop(stack);
+          }
+            INST_NEXT;
           case INST(LOAD): {
             [[maybe_unused]] auto _ = instGuard();
             stack.emplace_back(reg(inst.X));
           }
             INST_NEXT;
+          case INST(LOAD2): {
+            [[maybe_unused]] auto _ = instGuard();
+            stack.emplace_back(reg(inst.X));
+            stack.emplace_back(reg(inst.N));
+          }
+            INST_NEXT;
           case INST(MOVE): {
             [[maybe_unused]] auto _ = instGuard();
             stack.emplace_back(std::move(reg(inst.X)));
@@ -1,4 +1,5 @@
 #pragma once
+#include <atomic>
 #include <memory>
 #include <optional>
 #include <vector>
@@ -42,6 +43,12 @@ using TaskLauncher = std::function<void(std::function<void()>)>;
 
 bool TORCH_API in_torchscript_runtime();
 
+// When true, Code emission fuses the dominant adjacent instruction pairs into
+// superinstructions (LOAD+LOAD, OP+STORE), cutting dispatch overhead on
+// small-op-heavy graphs. Defaults to the PYTORCH_JIT_SUPERINSTRUCTIONS
+// environment variable. Mobile bytecode is never affected.
+TORCH_API std::atomic<bool>& getInstructionFusionMode();
+
 struct TORCH_API Code {
   Code() = default;
   explicit Code(interpreter::CodeImpl* pImpl);
@@ -12,6 +12,7 @@
 #include <torch/csrc/jit/runtime/calculate_necessary_args.h>
 #include <torch/csrc/jit/runtime/graph_iterator.h>
 #include <torch/csrc/jit/runtime/instruction.h>
+#include <torch/csrc/jit/runtime/interpreter.h>
 #include <torch/csrc/jit/runtime/interpreter/preprocess_graph.h>
 
 C10_DECLARE_bool(torch_jit_enable_expanded_stacks);
@@ -187,6 +188,87 @@ struct CodeImpl {
     // we deferred the emission of bailout blocks so they appear at the end
     // emit them now and patch up the jumps
     insertBailoutBlocks();
+    fuseSuperInstructions();
+  }
+
+  // Peephole over the finished instruction stream that merges the dominant
+  // adjacent pairs into superinstructions (LOAD+LOAD -> LOAD2 and
+  // OP+STORE -> OP_STORE), halving dispatch overhead for those sequences on
+  // small-op-heavy graphs. Opt-in via `getInstructionFusionMode()`. Never
+  // invoked for MobileCodeImpl, whose bytecode format does not include these
+  // opcodes.
+  void fuseSuperInstructions() {
+    if (!getInstructionFusionMode() || instructions_.empty()) {
+      return;
+    }
+
+    const auto is_jump = [](OpCode op) {
+      return op == JF || op == JMP || op == LOOP;
+    };
+
+    const size_t size = instructions_.size();
+    // A pair can only be fused if no jump lands on its second instruction.
+    std::vector<bool> is_jump_target(size, false);
+    for (const auto i : c10::irange(size)) {
+      if (is_jump(instructions_[i].op)) {
+        is_jump_target.at(i + instructions_[i].X) = true;
+      }
+    }
+
+    std::vector<Instruction> fused;
+    std::vector<Node*> fused_source;
+    fused.reserve(size);
+    fused_source.reserve(size);
+    // old_to_new[i] is the index of the (possibly fused) instruction that
+    // old instruction i became part of; new_to_old maps back to the first
+    // constituent. Both are needed to rewrite relative jump offsets.
+    std::vector<size_t> old_to_new(size);
+    std::vector<size_t> new_to_old;
+    new_to_old.reserve(size);
+
+    constexpr int32_t max_n = std::numeric_limits<uint16_t>::max();
+    size_t i = 0;
+    while (i < size) {
+      const auto& cur = instructions_[i];
+      old_to_new[i] = fused.size();
+      if (i + 1 < size && !is_jump_target[i + 1]) {
+        const auto& next = instructions_[i + 1];
+        const bool fits_n = next.X >= 0 && next.X <= max_n;
+        if (cur.op == LOAD && next.op == LOAD && fits_n) {
+          fused.emplace_back(LOAD2, cur.X, static_cast<uint16_t>(next.X));
+          fused_source.push_back(instructions_source_[i]);
+          new_to_old.push_back(i);
+          old_to_new[i + 1] = old_to_new[i];
+          i += 2;
+          continue;
+        }
+        if (cur.op == OP && next.op == STORE && fits_n) {
+          fused.emplace_back(OP_STORE, cur.X, static_cast<uint16_t>(next.X));
+          fused_source.push_back(instructions_source_[i]);
+          new_to_old.push_back(i);
+          old_to_new[i + 1] = old_to_new[i];
+          i += 2;
+          continue;
+        }
+      }
+      fused.push_back(cur);
+      fused_source.push_back(instructions_source_[i]);
+      new_to_old.push_back(i);
+      ++i;
+    }
+
+    // Rewrite the relative jump offsets against the new layout. Jumps are
+    // never part of a fused pair, so each one still occupies its own slot.
+    for (const auto n : c10::irange(fused.size())) {
+      if (is_jump(fused[n].op)) {
+        const size_t old_target = new_to_old[n] + fused[n].X;
+        fused[n].X = static_cast<int32_t>(old_to_new[old_target]) -
+            static_cast<int32_t>(n);
+      }
+    }
+
+    instructions_ = std::move(fused);
+    instructions_source_ = std::move(fused_source);
   }
 
   const std::vector<c10::IValue>& constant_table() const {
@@ -15,6 +15,7 @@
 #include <torch/csrc/jit/passes/create_autodiff_subgraphs.h>
 #include <torch/csrc/jit/passes/dead_code_elimination.h>
 #include <torch/csrc/jit/passes/decompose_ops.h>
+#include <torch/csrc/jit/passes/fork_independent_subgraphs.h>
 #include <torch/csrc/jit/passes/graph_fuser.h>
 #include <torch/csrc/jit/passes/guard_elimination.h>
 #include <torch/csrc/jit/passes/inline_autodiff_subgraphs.h>
@@ -531,6 +532,12 @@ void ProfilingGraphExecutorImpl::runProfilingOptimizations(
     runNoGradOptimizations(copy, remaining_bailout_depth);
   }
   EliminateDeadCode(copy);
+  if (forkIndependentSubgraphsEnabled()) {
+    // Runs last so the chains it forks are the ones that survived fusion,
+    // and so the profiled shapes baked into the value types can serve as the
+    // cost model.
+    ForkIndependentSubgraphs(copy);
+  }
   GRAPH_DEBUG("After runProfilingOptimizations:\n", *copy);
 }
 
@@ -698,6 +705,44 @@ const ExecutionPlan& ProfilingGraphExecutorImpl::getOptimizedPlanFor(
   return *optimized_plan_;
 }
 
+std::shared_ptr<Graph> ProfilingGraphExecutorImpl::snapshotSpecializedGraph() {
+  std::lock_guard<std::mutex> lock(compile_mutex);
+  // Nothing worth persisting until profiling has observed enough runs. A
+  // plan built by the simple-executor path (bailout depth 0) carries no
+  // shape signatures, and the profiled graph may have been released by
+  // clearTheGraphCompilationIntermediateGraphs.
+  if (!pr_ || !pr_->ready()) {
+    return nullptr;
+  }
+  auto copy = pr_->graph()->copy();
+  ProfilingRecord::removeProfileCounter(copy->block());
+  RemoveProfileNodesAndSpecializeTypes(copy);
+  return copy;
+}
+
+void ProfilingGraphExecutorImpl::restoreOptimizedPlan(
+    const std::shared_ptr<Graph>& specialized_graph) {
+  std::lock_guard<std::mutex> lock(compile_mutex);
+  if (optimized_plan_) {
+    return;
+  }
+  if (!remaining_bailout_depth_.has_value()) {
+    remaining_bailout_depth_ = getInstantiatedBailoutDepth();
+  }
+  // Mirrors the tail of getOptimizedPlanFor, starting from the point where a
+  // ready profiling record has been folded into the value types. The profile
+  // nodes are already gone, so RemoveProfileNodesAndSpecializeTypes inside
+  // the pipeline is a no-op and the recorded types drive specialization.
+  auto copy = specialized_graph->copy();
+  runProfilingOptimizations(copy, *remaining_bailout_depth_);
+  replaceFallbackGraphWithFallbackFunction(copy->block());
+  runFinalOptimizations(copy);
+  CheckStrictFusion(copy);
+  GRAPH_DUMP("Restored Optimized Graph: ", copy);
+  optimized_plan_ = ExecutionPlan(copy, function_name_);
+  time_optimized_plan_created_ = getNowInSecs();
+}
+
 const ExecutionPlan& ProfilingGraphExecutorImpl::getPlanFor(
     Stack& stack,
     std::optional<size_t> remaining_bailout_depth) {
@@ -24,6 +24,25 @@ struct TORCH_API ProfilingGraphExecutorImpl : public GraphExecutorImplBase {
 
   void debugFlushCompilationCache();
 
+  // Returns a copy of the type-specialized graph the optimized plan is
+  // derived from: the profiled graph with profile nodes removed and the
+  // observed tensor types baked into the value types. Unlike the optimized
+  // plan itself (whose fusion groups live in subgraph attributes), this form
+  // round-trips through the IR printer and parser, so it can be persisted
+  // alongside a module and handed back to restoreOptimizedPlan() after a
+  // restart. Returns nullptr until profiling has finished or if the profiled
+  // graph has already been released.
+  std::shared_ptr<Graph> snapshotSpecializedGraph();
+
+  // Rebuilds the optimized plan from a graph previously produced by
+  // snapshotSpecializedGraph(), rerunning the deterministic optimization
+  // pipeline so fusion groups and their TypeCheck guards are regenerated
+  // from the recorded shape signatures without any instrumented profiling
+  // runs. Inputs that don't match the recorded signatures fall back exactly
+  // as they would with a freshly profiled plan. No-op if an optimized plan
+  // already exists.
+  void restoreOptimizedPlan(const std::shared_ptr<Graph>& specialized_graph);
+
   bool isOptimized() const override {
     return optimized_plan_.has_value();
   }
@@ -175,6 +175,11 @@ void OptimizeGraph(
   EliminateNoOpSlice(graph);
   EliminateDeadCode(graph);
   FuseInferenceOpsForSparseNN(graph);
+  if (opts.enable_out_variant) {
+    // Must run before UseVariadicCat rewrites aten::cat into prim::VarConcat;
+    // the fused op only has an out variant.
+    FuseCatLayerNorm(graph);
+  }
   UseVariadicCat(graph);
   UseVariadicStack(graph);
   EliminateTrivialEquallySplit(graph);
@@ -1074,7 +1079,8 @@ void BlockRunner::create_memory_planner() {
         block_info_,
         static_module_.opts().enable_out_variant,
         manage_output_tensors_enabled_,
-        static_module_.opts().optimize_memory);
+        static_module_.opts().optimize_memory,
+        static_module_.opts().freeze_memory_plan);
   }
 }
 
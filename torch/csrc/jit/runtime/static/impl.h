@@ -172,6 +172,14 @@ struct TORCH_API StaticModuleOptions {
   bool use_maybe_copy_variants{true};
   // enable TensorExpr fusion of ops at model loading time
   bool enable_tensorexpr_fusion{false};
+  // Freeze the memory plan once per-tensor capacities stop growing between
+  // iterations. The planner then keeps a single arena sized for the largest
+  // batch seen and carves smaller batches out of prefixes of the same slabs,
+  // instead of re-collecting sizes and re-allocating the arena on every
+  // iteration. Warm the runtime up with the largest batch you expect before
+  // steady state; batches that outgrow the frozen plan still run correctly
+  // but fall back to ordinary heap allocations.
+  bool freeze_memory_plan{false};
 };
 
 /*
@@ -204,7 +204,9 @@ MemoryPlanner::MemoryPlanner(
     BlockRunner* block_runner,
     const BlockInfo& block_info,
     bool enable_out_variant,
-    bool manage_output_tensors) {
+    bool manage_output_tensors,
+    bool freeze_plan)
+    : freeze_plan_(freeze_plan) {
   const auto& managed_tensor_values = block_info.managed_tensor_values();
   const auto& managed_output_tensor_values =
       block_info.managed_output_tensor_values();
@@ -273,6 +275,12 @@ MemoryPlanner::MemoryPlanner(
 }
 
 uint8_t* MemoryPlanner::allocateBuffer(size_t num_bytes) {
+  if (C10_UNLIKELY(frozen_ && buffer_.get() != nullptr)) {
+    // A frozen plan keeps its arena alive across iterations; hand back the
+    // same slab.
+    TORCH_DCHECK_EQ(num_bytes, static_cast<size_t>(buffer_end_ - buffer_start_));
+    return buffer_start_;
+  }
   buffer_ = allocate_buffer(num_bytes);
   uint8_t* start = static_cast<uint8_t*>(buffer_.get());
   buffer_start_ = start;
@@ -350,7 +358,9 @@ void MemoryPlanner::deallocate() {
   // lower than expected and trigger the debug assertion in
   // ~intrusive_ptr_target.
   deallocateManagedTensors();
-  buffer_ = {};
+  if (!frozen_) {
+    buffer_ = {};
+  }
 }
 
 void MemoryPlanner::deallocateOutputTensors() {
@@ -374,12 +384,14 @@ StandardMemoryPlanner::StandardMemoryPlanner(
     const BlockInfo& block_info,
     bool enable_out_variant,
     bool manage_output_tensors,
-    bool optimize_memory)
+    bool optimize_memory,
+    bool freeze_plan)
     : MemoryPlanner(
           block_runner,
           block_info,
           enable_out_variant,
-          manage_output_tensors) {
+          manage_output_tensors,
+          freeze_plan) {
   const auto& managed_tensor_values = block_info.managed_tensor_values();
   if (enable_out_variant) {
     const auto tensor_value_to_tensor =
@@ -436,6 +448,38 @@ void StandardMemoryPlanner::allocateManagedTensors() {
 }
 
 void StandardMemoryPlanner::deallocateManagedTensors() {
+  if (C10_UNLIKELY(frozen_)) {
+    // The plan is frozen: per-group capacities and offsets are fixed, so
+    // skip the size bookkeeping entirely. We still have to put back any
+    // storage the model may have swapped out from under us.
+    for (const auto group_idx : c10::irange(managed_tensors_.size())) {
+      auto& ms = managed_tensors_[group_idx];
+      const auto& tensors = ms.group();
+      for (auto& tensor : tensors) {
+        const auto& storage = tensor->storage();
+        if (C10_UNLIKELY(
+                compute_aligned_tensor_size(storage.nbytes()) >
+                ms.maxTensorSize())) {
+          TORCH_WARN_ONCE(
+              "A managed tensor outgrew Static Runtime's frozen memory plan; "
+              "it is served from ordinary heap allocations instead of the "
+              "planned arena. Warm the runtime up with the largest batch you "
+              "expect before the plan freezes.");
+        }
+        at::StorageImpl* tensorStorageImpl = storage.unsafeGetStorageImpl();
+        if (C10_UNLIKELY(tensorStorageImpl != &storages_[group_idx])) {
+          tensorStorageImpl->reset();
+          tensor->unsafeGetTensorImpl()->set_storage_keep_dtype(
+              at::Storage(c10::intrusive_ptr<at::StorageImpl>::
+                              unsafe_adapt_non_heap_allocated(
+                                  &storages_[group_idx], tensors.size())));
+        }
+      }
+    }
+    return;
+  }
+
+  const size_t prev_managed_bytes = managed_bytes_;
   managed_bytes_ = 0;
   // free memory used by outputs of ops in out variants
   // but keep the TensorImpl and StorageImpl around.
@@ -509,6 +553,11 @@ void StandardMemoryPlanner::deallocateManagedTensors() {
   }
 
   TORCH_DCHECK_EQ(storages_.size(), managed_tensors_.size());
+  // Group capacities only ever grow, so stable total bytes mean a stable
+  // plan; freeze it if requested so later iterations skip all of the above.
+  if (freeze_plan_ && !first_time && managed_bytes_ == prev_managed_bytes) {
+    frozen_ = true;
+  }
   VLOG(1) << "managed_bytes: " << managed_bytes_;
 }
 
@@ -147,7 +147,8 @@ class MemoryPlanner {
       BlockRunner* block_runner,
       const BlockInfo& block_info,
       bool enable_out_variant,
-      bool manage_output_tensors);
+      bool manage_output_tensors,
+      bool freeze_plan = false);
 
   // disable copying and moving
   MemoryPlanner(const MemoryPlanner&) = delete;
@@ -230,12 +231,26 @@ class MemoryPlanner {
     return buffer_start_ <= data_ptr && data_ptr < buffer_end_;
   }
 
+  // True once a planner created with `freeze_plan` has stopped growing its
+  // capacities and locked the arena. Only used in testing.
+  bool is_frozen() const {
+    return frozen_;
+  }
+
  protected:
   uint8_t* allocateBuffer(size_t num_bytes);
 
   size_t managed_bytes_{0};
   size_t reused_tensors_{0};
 
+  // See the doc comment for `StaticModuleOptions::freeze_memory_plan`.
+  // When `freeze_plan_` is set, `frozen_` flips to true as soon as the
+  // per-group capacities stop growing between iterations; from then on the
+  // arena is kept alive across runs and smaller batches are carved out of
+  // the same slabs with no re-planning.
+  bool freeze_plan_{false};
+  bool frozen_{false};
+
   // We allocate StorageImpls ourselves so that 1) we don't have to do
   // an extra two loads per Tensor (which will likely miss in the CPU
   // data cache) first reading the Storage (i.e., StorageImpl pointer)
@@ -286,7 +301,8 @@ class StandardMemoryPlanner : public MemoryPlanner {
       const BlockInfo& block_info,
       bool enable_out_variant,
       bool manage_output_tensors,
-      bool optimize_memory);
+      bool optimize_memory,
+      bool freeze_plan = false);
 
  protected:
   void allocateManagedTensors() override;
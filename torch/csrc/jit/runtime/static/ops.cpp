@@ -2126,6 +2126,173 @@ REGISTER_OPERATOR_FUNCTOR(aten::layer_norm, aten_layer_norm, [](Node* n) -> SROp
   };
 });
 
+namespace {
+
+// Returns true if `LayerNorm(cat(inputs, dim))` can be computed without
+// materializing the concatenated tensor: the concat must be along the last
+// dim, normalization must be over that same dim, and every input must be a
+// contiguous float tensor holding whole rows. Each output row is then the
+// concatenation of one row from every input, so we can accumulate the row
+// statistics across the segments and normalize each segment straight into
+// the output buffer.
+bool can_use_fused_cat_layer_norm_rows(
+    at::TensorList inputs,
+    int64_t dim,
+    c10::IntArrayRef normalized_shape,
+    const at::Tensor& weight,
+    const at::Tensor& bias,
+    int64_t& M,
+    int64_t& N) {
+  if (inputs.empty() || normalized_shape.size() != 1) {
+    return false;
+  }
+  const auto& first = inputs[0];
+  const auto ndim = first.dim();
+  if (ndim < 1 || dim != ndim - 1) {
+    return false;
+  }
+  N = 0;
+  for (const auto& input : inputs) {
+    if (input.scalar_type() != at::kFloat || !input.is_contiguous() ||
+        input.dim() != ndim) {
+      return false;
+    }
+    for (const auto d : c10::irange(ndim - 1)) {
+      if (input.size(d) != first.size(d)) {
+        return false;
+      }
+    }
+    N += input.size(ndim - 1);
+  }
+  if (normalized_shape[0] != N || N == 0) {
+    return false;
+  }
+  for (const auto* param : {&weight, &bias}) {
+    if (param->defined() &&
+        (param->scalar_type() != at::kFloat || !param->is_contiguous() ||
+         param->numel() != N)) {
+      return false;
+    }
+  }
+  M = first.numel() / first.size(ndim - 1);
+  return true;
+}
+
+void fused_cat_layer_norm_rows_out(
+    at::Tensor& out,
+    at::TensorList inputs,
+    const float* gamma_data,
+    const float* beta_data,
+    float eps,
+    int64_t M,
+    int64_t N) {
+  const auto num_inputs = inputs.size();
+  std::vector<const float*> input_data(num_inputs);
+  std::vector<int64_t> segment_sizes(num_inputs);
+  std::vector<int64_t> segment_offsets(num_inputs);
+  int64_t offset = 0;
+  for (const auto k : c10::irange(num_inputs)) {
+    input_data[k] = inputs[k].const_data_ptr<float>();
+    segment_sizes[k] = inputs[k].size(-1);
+    segment_offsets[k] = offset;
+    offset += segment_sizes[k];
+  }
+  float* out_data = out.mutable_data_ptr<float>();
+  const float scale = 1.0f / static_cast<float>(N);
+  at::parallel_for(0, M, 1, [&](int64_t begin, int64_t end) {
+    for (const auto m : c10::irange(begin, end)) {
+      float sum = 0.0f;
+      float sum_sq = 0.0f;
+      for (const auto k : c10::irange(num_inputs)) {
+        const float* row = input_data[k] + m * segment_sizes[k];
+        for (const auto j : c10::irange(segment_sizes[k])) {
+          sum += row[j];
+          sum_sq += row[j] * row[j];
+        }
+      }
+      const float mean = sum * scale;
+      const float rstd = 1.0f /
+          std::sqrt(std::max(sum_sq * scale - mean * mean, 0.0f) + eps);
+      float* out_row = out_data + m * N;
+      for (const auto k : c10::irange(num_inputs)) {
+        const float* row = input_data[k] + m * segment_sizes[k];
+        float* dst = out_row + segment_offsets[k];
+        for (const auto j : c10::irange(segment_sizes[k])) {
+          const auto c = segment_offsets[k] + j;
+          const float gamma = gamma_data ? gamma_data[c] : 1.0f;
+          const float beta = beta_data ? beta_data[c] : 0.0f;
+          dst[j] = (row[j] - mean) * rstd * gamma + beta;
+        }
+      }
+    }
+  });
+}
+
+} // namespace
+
+// NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+REGISTER_OPERATOR_FUNCTOR(
+    static_runtime::fused_cat_layer_norm,
+    static_runtime_fused_cat_layer_norm,
+    [](Node* n) -> SROperator {
+      if (!sr_schema_check(
+              n,
+              "static_runtime::fused_cat_layer_norm(Tensor[] inputs, int dim, int[] normalized_shape, Tensor? weight=None, Tensor? bias=None, float eps=1e-05, bool cudnn_enable=True) -> Tensor")) {
+        return nullptr;
+      }
+      return [](ProcessedNode* p_node) {
+        // ignore Input(6): `bool cudnn_enable=True`
+        const auto inputs = p_node->Input(0).toTensorVector();
+        TORCH_CHECK(!inputs.empty(), "fused_cat_layer_norm requires inputs");
+        const auto dim =
+            c10::maybe_wrap_dim(p_node->Input(1).toInt(), inputs[0].dim());
+        const auto normalized_shape = p_node->Input(2).toDimVector();
+        const float eps = p_node->Input(5).toDouble();
+
+        c10::MaybeOwned<at::Tensor> weight_maybe_owned =
+            borrow_from_optional_tensor_ivalue(p_node->Input(3));
+        const at::Tensor& weight = *weight_maybe_owned;
+        c10::MaybeOwned<at::Tensor> bias_maybe_owned =
+            borrow_from_optional_tensor_ivalue(p_node->Input(4));
+        const at::Tensor& bias = *bias_maybe_owned;
+
+        if (p_node->Output(0).isNone()) {
+          p_node->Output(0) = create_empty_from(inputs[0]);
+        }
+        auto& out = p_node->Output(0).toTensor();
+
+        int64_t M = 0;
+        int64_t N = 0;
+        if (can_use_fused_cat_layer_norm_rows(
+                inputs, dim, normalized_shape, weight, bias, M, N)) {
+          auto out_sizes = inputs[0].sizes().vec();
+          out_sizes.back() = N;
+          at::native::resize_(out, out_sizes, std::nullopt);
+          fused_cat_layer_norm_rows_out(
+              out,
+              inputs,
+              weight.defined() ? weight.const_data_ptr<float>() : nullptr,
+              bias.defined() ? bias.const_data_ptr<float>() : nullptr,
+              eps,
+              M,
+              N);
+          return;
+        }
+
+        // Fallback for layouts the fused kernel doesn't handle: materialize
+        // the concat and reuse the regular layer_norm kernel.
+        const auto input = at::cpu::cat(inputs, dim);
+        auto M_N = at::native::_check_layer_norm_inputs(
+            input, normalized_shape, weight, bias);
+        auto X = input.expect_contiguous();
+        auto gamma = weight.expect_contiguous();
+        auto beta = bias.expect_contiguous();
+        at::native::resize_(out, X->sizes(), std::nullopt);
+        at::native::layer_norm_cpu_out(
+            out, *X, *gamma, *beta, eps, M_N.first, M_N.second);
+      };
+    });
+
 REGISTER_OPERATOR_FUNCTOR(aten::norm, aten_norm, [](Node* n) -> SROperator {
   if (n->matches(torch::schema(
           "aten::norm.ScalarOpt_dtype(Tensor self, Scalar? p, *, ScalarType dtype) -> Tensor"))) {
@@ -432,6 +432,9 @@ TORCH_LIBRARY_FRAGMENT(static_runtime, m) {
       "static_runtime::layer_norm(Tensor input, int[] normalized_shape, Tensor? weight=None, Tensor? bias=None, float eps=1e-05, bool cudnn_enable=True) -> (Tensor, Tensor, Tensor)",
       c10::AliasAnalysisKind::PURE_FUNCTION));
   m.def("static_runtime::signed_log1p(Tensor input) -> Tensor");
+  m.def(torch::schema(
+      "static_runtime::fused_cat_layer_norm(Tensor[] inputs, int dim, int[] normalized_shape, Tensor? weight=None, Tensor? bias=None, float eps=1e-05, bool cudnn_enable=True) -> Tensor",
+      c10::AliasAnalysisKind::PURE_FUNCTION));
   m.def(torch::schema(
       "static_runtime::dict_unpack(...) -> ...",
       c10::AliasAnalysisKind::CONSERVATIVE));
@@ -482,6 +485,28 @@ void FuseSignLog1P(std::shared_ptr<torch::jit::Graph>& graph) {
   fuse.runOnGraph(graph);
 }
 
+void FuseCatLayerNorm(std::shared_ptr<torch::jit::Graph>& graph) {
+  // The matcher only fires when the concat result has no other users, so
+  // the fused op is free to skip materializing it. Common in ranking models
+  // where embedding_bag outputs are concatenated and layer-normalized.
+  std::string pattern = R"IR(
+    graph(%inputs, %dim, %shape, %weight, %bias, %eps, %cudnn_enable):
+        %cat : Tensor = aten::cat(%inputs, %dim)
+        %res : Tensor = aten::layer_norm(%cat, %shape, %weight, %bias, %eps, %cudnn_enable)
+        return (%res)
+  )IR";
+
+  std::string fused_pattern = R"IR(
+    graph(%inputs, %dim, %shape, %weight, %bias, %eps, %cudnn_enable):
+        %res : Tensor = static_runtime::fused_cat_layer_norm(%inputs, %dim, %shape, %weight, %bias, %eps, %cudnn_enable)
+        return (%res)
+    )IR";
+
+  SubgraphRewriter fuse;
+  fuse.RegisterRewritePattern(pattern, fused_pattern);
+  fuse.runOnGraph(graph);
+}
+
 namespace {
 
 using TupleUnpackBlock = std::vector<Node*>;
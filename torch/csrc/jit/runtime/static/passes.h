@@ -33,6 +33,8 @@ TORCH_API bool forwardHasOp(const Module& module, const char* op_name);
 
 TORCH_API void FuseSignLog1P(std::shared_ptr<Graph>& graph);
 
+TORCH_API void FuseCatLayerNorm(std::shared_ptr<Graph>& graph);
+
 TORCH_API void UseVariadicTupleUnpack(const std::shared_ptr<Graph>& graph);
 
 // c10::Symbol::fromQualString is a bit long to type everywhere, and
@@ -259,6 +259,15 @@ Table(const std::vector<std::pair<std::string, IValue>>& entries);
 TORCH_API void enableMobileInterfaceCallExport();
 bool getMobileInterfaceCallExport();
 
+// When enabled, ScriptModuleSerializer hashes storage contents and writes
+// byte-identical storages within an archive only once; readers alias the
+// shared record, so duplicated weights (e.g. across ensemble heads) cost
+// neither file size nor load-time RAM. Off by default because aliasing makes
+// formerly independent storages share memory after a save/load round trip,
+// which is observable by code that mutates loaded weights in place.
+TORCH_API void setExportStorageDeduplication(bool enabled);
+TORCH_API bool getExportStorageDeduplication();
+
 TORCH_API CompilationOptions getOptionsFromGlobal();
 
 TORCH_API void save_jit_module(
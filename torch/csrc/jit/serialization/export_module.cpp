@@ -32,8 +32,10 @@
 #include <ATen/core/jit_type.h>
 #include <ATen/core/qualified_name.h>
 #include <cerrno>
+#include <cstring>
 #include <sstream>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -432,6 +434,11 @@ auto& mobileInterfaceCallExport() {
   return flag;
 }
 
+auto& exportStorageDeduplication() {
+  static std::atomic<bool> flag{false};
+  return flag;
+}
+
 } // namespace
 
 TORCH_API void enableMobileInterfaceCallExport() {
@@ -441,6 +448,13 @@ bool getMobileInterfaceCallExport() {
   return mobileInterfaceCallExport().load(std::memory_order_relaxed);
 }
 
+void setExportStorageDeduplication(bool enabled) {
+  exportStorageDeduplication().store(enabled, std::memory_order_relaxed);
+}
+bool getExportStorageDeduplication() {
+  return exportStorageDeduplication().load(std::memory_order_relaxed);
+}
+
 void SetExportModuleExtraFilesHook(ExportModuleExtraFilesHook hook) {
   GetExtraFilesHook() = std::move(hook);
 }
@@ -509,6 +523,12 @@ void ScriptModuleSerializer::writeArchive(
   std::vector<std::string> tensor_names;
   // tensors that are already serialized in use_storage_context
   std::unordered_set<std::string> serialized_tensors;
+  // Content-addressed dedup of storages within this archive (see
+  // setExportStorageDeduplication): maps a hash of the storage bytes to the
+  // tensors already assigned a name with that hash, so hash collisions can
+  // be resolved with a byte compare before sharing a name.
+  std::unordered_map<size_t, std::vector<std::pair<std::string, at::Tensor>>>
+      content_names;
   Pickler data_pickle(
       [&](const char* buf, size_t size) {
         data.insert(data.end(), buf, buf + size);
@@ -534,7 +554,33 @@ void ScriptModuleSerializer::writeArchive(
           }
           tensor_names.push_back(tensor_name);
         } else {
-          tensor_names.push_back(std::to_string(tensor_names.size()));
+          std::string tensor_name = std::to_string(tensor_names.size());
+          const at::Storage& storage = tensor.storage();
+          if (getExportStorageDeduplication() && tensor.device().is_cpu() &&
+              storage.nbytes() > 0) {
+            // Byte-identical storages share one record; the unpickler's
+            // per-archive storage cache turns the shared key back into a
+            // shared allocation on load.
+            const char* bytes = static_cast<const char*>(storage.data());
+            size_t nbytes = storage.nbytes();
+            size_t hash = std::hash<std::string_view>()(
+                std::string_view(bytes, nbytes));
+            auto& candidates = content_names[hash];
+            bool found = false;
+            for (const auto& candidate : candidates) {
+              const at::Storage& other = candidate.second.storage();
+              if (other.nbytes() == nbytes &&
+                  std::memcmp(other.data(), bytes, nbytes) == 0) {
+                tensor_name = candidate.first;
+                found = true;
+                break;
+              }
+            }
+            if (!found) {
+              candidates.emplace_back(tensor_name, tensor);
+            }
+          }
+          tensor_names.push_back(std::move(tensor_name));
         }
         return tensor_names.back();
       });
@@ -546,8 +592,14 @@ void ScriptModuleSerializer::writeArchive(
 
   TORCH_INTERNAL_ASSERT(tensor_names.size() == data_pickle.tensorData().size());
 
+  // With storage deduplication, several tensors may carry the same name;
+  // only the first occurrence gets a record.
+  std::unordered_set<std::string> written_names;
   for (const auto& td : data_pickle.tensorData()) {
     std::string tensor_name = tensor_names[i++];
+    if (!written_names.insert(tensor_name).second) {
+      continue;
+    }
     if (td.is_meta() || skip_tensor_data) {
       writer_.writeRecord(tensor_dir + tensor_name, nullptr, 0);
       continue;
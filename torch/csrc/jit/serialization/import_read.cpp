@@ -1,10 +1,23 @@
+#include <c10/core/Event.h>
+#include <c10/core/impl/VirtualGuardImpl.h>
+#include <c10/util/env.h>
 #include <caffe2/serialize/inline_container.h>
 #include <torch/csrc/jit/serialization/import_read.h>
 
+#include <array>
 #include <utility>
 
 namespace torch::jit {
 
+namespace {
+
+// Chunk size used when streaming record bytes to an accelerator through
+// pinned staging buffers; large enough to reach peak H2D bandwidth, small
+// enough that keeping two staging buffers around stays cheap.
+constexpr size_t kDeviceReadChunkSize = 16 * 1024 * 1024;
+
+} // namespace
+
 IValue readArchiveAndTensors(
     const std::string& archive_name,
     const std::string& pickle_prefix,
@@ -51,6 +64,63 @@ IValue readArchiveAndTensors(
       false,
       type_parser,
       std::move(storage_context));
+  // Opt-in direct-to-device materialization: tensor storages destined for an
+  // accelerator are allocated there and filled by streaming the record bytes
+  // through pinned staging buffers, overlapping archive reads with H2D
+  // copies, instead of building every tensor on CPU and moving it afterwards.
+  static const bool stream_to_device =
+      c10::utils::has_env("TORCH_LOAD_STREAM_TO_DEVICE");
+  if (stream_to_device && device.has_value() && !device->is_cpu()) {
+    unpickler.set_device_record_reader([&](const std::string& name,
+                                           const at::Tensor& dst) {
+      std::string ss = tensor_dir_path + name;
+      const size_t nbytes = dst.nbytes();
+      if (dst.device().is_cpu()) {
+        stream_reader.getRecord(ss, dst.data_ptr(), nbytes);
+        return;
+      }
+      // Double-buffered pinned staging: while chunk i is being copied to the
+      // device asynchronously, chunk i + 1 is read from the archive into the
+      // other buffer.
+      const size_t chunk_size = std::min(kDeviceReadChunkSize, nbytes);
+      auto iter = stream_reader.createChunkReaderIter(ss, nbytes, chunk_size);
+      const auto staging_options =
+          at::TensorOptions().dtype(at::kByte).pinned_memory(true);
+      std::array<at::Tensor, 2> staging = {
+          at::empty({static_cast<int64_t>(chunk_size)}, staging_options),
+          at::empty({static_cast<int64_t>(chunk_size)}, staging_options)};
+      std::array<c10::Event, 2> copied = {
+          c10::Event(dst.device().type()), c10::Event(dst.device().type())};
+      c10::impl::VirtualGuardImpl impl(dst.device().type());
+      const auto stream = impl.getStream(dst.device());
+      size_t offset = 0;
+      for (size_t i = 0; offset < nbytes; ++i) {
+        auto& buf = staging[i % 2];
+        // Wait until the copy issued two chunks ago has drained this buffer
+        // before overwriting it (no-op on the first two iterations).
+        copied[i % 2].synchronize();
+        const size_t n = iter.next(buf.data_ptr());
+        TORCH_CHECK(
+            n > 0,
+            "record '",
+            ss,
+            "' ended after ",
+            offset,
+            " bytes, expected ",
+            nbytes);
+        dst.narrow(0, static_cast<int64_t>(offset), static_cast<int64_t>(n))
+            .copy_(
+                buf.narrow(0, 0, static_cast<int64_t>(n)),
+                /*non_blocking=*/true);
+        copied[i % 2].record(stream);
+        offset += n;
+      }
+      // The staging buffers are released on return; make sure all in-flight
+      // copies out of them have finished.
+      copied[0].synchronize();
+      copied[1].synchronize();
+    });
+  }
   unpickler.set_version(stream_reader.version());
   return unpickler.parse_ivalue();
 }
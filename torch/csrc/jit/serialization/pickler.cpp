@@ -1,4 +1,5 @@
 #include <ATen/ATen.h>
+#include <ATen/MapAllocator.h>
 #include <ATen/core/Dict.h>
 #ifdef USE_RPC
 #include <torch/csrc/distributed/rpc/rref_context.h>
@@ -8,6 +9,7 @@
 #include <torch/csrc/jit/api/function_impl.h>
 #include <torch/csrc/jit/serialization/pickler.h>
 #include <torch/csrc/utils/byte_order.h>
+#include <atomic>
 #include <string>
 #include <type_traits>
 
@@ -19,6 +21,16 @@ using ::c10::IValue;
 // See https://docs.python.org/3/library/pickle.html#data-stream-format
 constexpr static uint8_t PROTOCOL_VERSION = 2;
 
+static std::atomic<bool> pickle_mapped_storages_by_handle{false};
+
+void setPickleMappedStoragesByHandle(bool state) {
+  pickle_mapped_storages_by_handle = state;
+}
+
+bool getPickleMappedStoragesByHandle() {
+  return pickle_mapped_storages_by_handle;
+}
+
 // NOLINTNEXTLINE(bugprone-exception-escape)
 Pickler::~Pickler() {
   flush();
@@ -287,6 +299,55 @@ void Pickler::pushString(const std::string& string) {
   }
 }
 
+bool Pickler::pushMappedStorageOfTensor(const at::Tensor& tensor) {
+  if (!tensor.device().is_cpu()) {
+    return false;
+  }
+  const at::Storage& storage = tensor.storage();
+  bool refcounted = true;
+  at::MapAllocator* map_ctx =
+      at::RefcountedMapAllocator::fromDataPtr(storage.data_ptr());
+  if (map_ctx == nullptr) {
+    refcounted = false;
+    map_ctx = at::MapAllocator::fromDataPtr(storage.data_ptr());
+  }
+  // Only mappings with a shm handle can be reattached by name on the
+  // consumer side; fd-based mappings have had their name unlinked already.
+  if (map_ctx == nullptr ||
+      !(map_ctx->flags() & at::ALLOCATOR_MAPPED_SHAREDMEM) ||
+      (map_ctx->flags() & at::ALLOCATOR_MAPPED_FROMFD) ||
+      map_ctx->filename()[0] == '\0') {
+    return false;
+  }
+
+  // Tuple for persistent_load
+  push<PickleOpCode>(PickleOpCode::MARK);
+  // typename
+  pushString("storage_mapped");
+  // data_type
+  std::string data_type =
+      std::string(toString(tensor.scalar_type())).append("Storage");
+  pushGlobal("torch", data_type);
+  // shared memory handle
+  pushString(map_ctx->filename());
+  // location
+  pushString(tensor.device().str());
+  // size
+  pushInt(
+      static_cast<int64_t>(tensor.storage().nbytes() / tensor.element_size()));
+  // whether the mapping is refcounted, so the consumer attaches with the
+  // matching allocator
+  pushBool(refcounted);
+
+  push<PickleOpCode>(PickleOpCode::TUPLE);
+  push<PickleOpCode>(PickleOpCode::BINPERSID);
+
+  // Note: nothing is appended to tensor_data_; the pickle carries no payload
+  // for this storage.
+  memoized_storage_map_[storage.unsafeGetStorageImpl()] = pushNextBinPut();
+  return true;
+}
+
 void Pickler::pushStorageOfTensor(const at::Tensor& tensor) {
   const at::Storage& storage = tensor.storage();
   void* addr = storage.unsafeGetStorageImpl();
@@ -296,6 +357,10 @@ void Pickler::pushStorageOfTensor(const at::Tensor& tensor) {
     return;
   }
 
+  if (getPickleMappedStoragesByHandle() && pushMappedStorageOfTensor(tensor)) {
+    return;
+  }
+
   // Tuple for persistent_load
   push<PickleOpCode>(PickleOpCode::MARK);
   // typename
@@ -118,6 +118,16 @@ struct WriteableTensorData {
 void setTypeTags(bool state);
 bool getTypeTags();
 
+// When enabled, CPU storages that already live in named shared memory
+// (at::MapAllocator mappings with ALLOCATOR_MAPPED_SHAREDMEM) are pickled as
+// a (handle, numel) reference instead of copying their bytes into the
+// stream, and the Unpickler reattaches the existing mapping. The resulting
+// pickle can only be loaded on the machine that produced it, while the
+// producer's mapping still exists; leave this off for pickles that cross
+// machines or outlive the process. Off by default.
+TORCH_API void setPickleMappedStoragesByHandle(bool state);
+TORCH_API bool getPickleMappedStoragesByHandle();
+
 class TORCH_API Pickler {
   AT_DISALLOW_COPY_AND_ASSIGN(Pickler);
 
@@ -184,6 +194,9 @@ class TORCH_API Pickler {
   // unmemoized version
   void pushStringImpl(const std::string& string);
   void pushStorageOfTensor(const at::Tensor& tensor);
+  // Serializes a shared-memory storage as a reference to its mapping rather
+  // than by value; returns false if the storage is not eligible.
+  bool pushMappedStorageOfTensor(const at::Tensor& tensor);
 
   void pushBinGet(uint32_t memo_id);
   void pushSpecializedList(
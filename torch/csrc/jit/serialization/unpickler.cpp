@@ -1,4 +1,5 @@
 #include <ATen/ATen.h>
+#include <ATen/MapAllocator.h>
 #include <ATen/core/Dict.h>
 #ifdef USE_RPC
 #include <torch/csrc/distributed/rpc/rref_context.h>
@@ -567,6 +568,46 @@ PickleOpCode Unpickler::readInstruction() {
       TORCH_CHECK(!stack_.empty(), "Parsing error: stack_ is empty");
       auto tuple = pop(stack_).toTuple();
       const auto& args = tuple->elements();
+      if (args.at(0).toStringRef() == "storage_mapped") {
+        // (typename, dtype, handle, location, numel, refcounted): a CPU
+        // storage that already lives in named shared memory, written by
+        // Pickler::pushMappedStorageOfTensor. The pickle carries no bytes;
+        // reattach the producer's mapping instead.
+        at::ScalarType type = args.at(1).toScalarType();
+        const std::string& handle = args.at(2).toStringRef();
+        int64_t numel = args.at(4).toInt();
+        bool refcounted = args.at(5).toBool();
+        caffe2::TypeMeta dtype = at::CPU(type).typeMeta();
+        size_t nbytes = numel * dtype.itemsize();
+
+        // NOCREATE makes a vanished producer mapping a loud error instead of
+        // silently attaching a fresh, zero-filled segment.
+        int flags = at::ALLOCATOR_MAPPED_SHAREDMEM | at::ALLOCATOR_MAPPED_NOCREATE;
+        size_t actual_size = 0;
+        at::DataPtr storage_ptr = refcounted
+            ? at::RefcountedMapAllocator::makeDataPtr(
+                  handle.c_str(), flags, nbytes, &actual_size)
+            : at::MapAllocator::makeDataPtr(
+                  handle, flags, nbytes, &actual_size);
+
+        at::Storage storage(
+            c10::Storage::use_byte_size_t(),
+            nbytes,
+            std::move(storage_ptr),
+            /*allocator=*/nullptr,
+            /*resizable=*/false);
+
+        auto options = at::CPU(type).options();
+        at::Tensor tensor;
+        if (options.backend() == c10::Backend::QuantizedCPU) {
+          tensor = at::_empty_affine_quantized({}, options, 0, 0)
+                       .set_(storage, 0, {}, {});
+        } else {
+          tensor = at::empty({0}, options).set_(storage);
+        }
+        stack_.emplace_back(std::move(tensor));
+        break;
+      }
       AT_ASSERT(
           args.at(0).toStringRef() == "storage",
           "unknown PERSID key ",
@@ -581,30 +622,53 @@ PickleOpCode Unpickler::readInstruction() {
       }
 
       at::Storage storage;
+      bool streamed_to_device = false;
+      auto cached_storage = local_storage_cache_.find(key);
       if (storage_context_ != nullptr && storage_context_->hasStorage(key)) {
         // for torch.package logic where storage may be loaded already
         storage = storage_context_->getStorage(key);
+      } else if (cached_storage != local_storage_cache_.end()) {
+        // this key was already materialized for this archive; alias it
+        storage = cached_storage->second;
       } else {
         int64_t numel = args.at(4).toInt();
         caffe2::TypeMeta dtype = at::CPU(type).typeMeta();
 
-        at::DataPtr storage_ptr;
-        if (numel > 0) {
-          // If there are no elements in the tensor, there's no point in
-          // reading a zero (0) byte file from the input stream and paying
-          // that cost.
-          storage_ptr = read_record_(key);
-        }
+        if (read_record_to_device_ && numel > 0 &&
+            storage_context_ == nullptr && !isQIntType(type) &&
+            (device.is_cuda() || device.is_xpu() ||
+             device.is_privateuseone())) {
+          // Materialize the storage directly on the target device and stream
+          // the record bytes into it, rather than reading into a CPU buffer
+          // and paying for a separate blocking Tensor.to copy below.
+          auto bytes = at::empty(
+              {numel * static_cast<int64_t>(dtype.itemsize())},
+              at::TensorOptions().dtype(at::kByte).device(device));
+          read_record_to_device_(key, bytes);
+          storage = bytes.storage();
+          streamed_to_device = true;
+        } else {
+          at::DataPtr storage_ptr;
+          if (numel > 0) {
+            // If there are no elements in the tensor, there's no point in
+            // reading a zero (0) byte file from the input stream and paying
+            // that cost.
+            storage_ptr = read_record_(key);
+          }
 
-        storage = at::Storage(
-            c10::Storage::use_byte_size_t(),
-            numel * dtype.itemsize(),
-            std::move(storage_ptr),
-            /*allocator=*/nullptr,
-            /*resizable=*/false); // NB: we didn't set any allocator for the
-                                  // tensor
-        if (storage_context_ != nullptr) {
-          storage_context_->addStorage(key, storage);
+          storage = at::Storage(
+              c10::Storage::use_byte_size_t(),
+              numel * dtype.itemsize(),
+              std::move(storage_ptr),
+              /*allocator=*/nullptr,
+              /*resizable=*/false); // NB: we didn't set any allocator for the
+                                    // tensor
+          if (storage_context_ != nullptr) {
+            storage_context_->addStorage(key, storage);
+          }
+        }
+        if (storage_context_ == nullptr) {
+          local_storage_cache_.emplace(key, storage);
         }
       }
 
@@ -612,6 +676,10 @@ PickleOpCode Unpickler::readInstruction() {
       if (use_storage_device_) {
         options = options.device(storage.device());
         device = storage.device();
+      } else if (streamed_to_device) {
+        // The storage already lives on the target device; the Tensor.to
+        // below becomes a no-op.
+        options = options.device(storage.device());
       }
 
       at::Tensor tensor;
@@ -108,6 +108,16 @@ class TORCH_API Unpickler {
     return parser.parseType(str);
   }
 
+  // Optional streaming variant of `read_record`: fills the flat byte tensor
+  // `dst` (which may live on an accelerator) with the bytes of the record
+  // `name`. When set, storages destined for an accelerator are allocated
+  // there directly and the record bytes are streamed into them, instead of
+  // being read into a CPU buffer and moved with a blocking `Tensor.to`.
+  void set_device_record_reader(
+      std::function<void(const std::string&, const at::Tensor&)> reader) {
+    read_record_to_device_ = std::move(reader);
+  }
+
  private:
   // No arguments ensures that a template argument must be specified
   // so that the number of bytes read / type read is explicit
@@ -177,6 +187,9 @@ class TORCH_API Unpickler {
   IValue empty_tuple_;
 
   std::function<at::DataPtr(const std::string&)> read_record_;
+  // See set_device_record_reader.
+  std::function<void(const std::string&, const at::Tensor&)>
+      read_record_to_device_;
   std::optional<at::Device> device_;
   // When set to true, Unpickler will ignore the pickled device and use the
   // device of the DataPtr returned by the read_record_ function. The default
@@ -189,6 +202,13 @@ class TORCH_API Unpickler {
   // ScriptModules and eager modules
   std::shared_ptr<DeserializationStorageContext> storage_context_;
 
+  // Caches storages by root key for the lifetime of this Unpickler, so a key
+  // referenced by several tensors in one archive aliases a single allocation
+  // (archives written with storage deduplication reuse keys; see
+  // ScriptModuleSerializer::writeArchive). Only consulted when
+  // storage_context_ is absent; torch.package shares through the context.
+  std::unordered_map<std::string, at::Storage> local_storage_cache_;
+
   // See [type tag serialization]
   uint64_t version_;
 
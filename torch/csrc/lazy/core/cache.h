@@ -98,6 +98,19 @@ class Cache {
     element_list_.clear();
   }
 
+  // Invokes 'fn' on every (key, object) pair currently in the cache, in LRU
+  // order (most recently used first). The cache lock is held for the whole
+  // iteration, so 'fn' must not call back into the cache.
+  void ForEach(const std::function<void(const K&, const TypePtr&)>& fn) const {
+    if (!max_size_) {
+      return;
+    }
+    std::lock_guard<std::mutex> g(lock_);
+    for (const auto& element : element_list_) {
+      fn(element.first, element.second);
+    }
+  }
+
   int Numel() const {
     if (!max_size_) {
       return 0;
@@ -1,5 +1,8 @@
 #include <c10/util/env.h>
+#include <c10/util/irange.h>
 #include <torch/csrc/lazy/backend/backend_interface.h>
+
+#include <fstream>
 #include <torch/csrc/lazy/core/cache.h>
 #include <torch/csrc/lazy/core/config.h>
 #include <torch/csrc/lazy/core/ir.h>
@@ -118,18 +121,131 @@ void Node::addComputedShape(const std::function<Shape()>& shape_fn) {
 
 using ShapeCache = Cache<hash_t, Shape, HashReducer>;
 
-// Compute the shape using the provided shape_fn.
-Shape Node::computeShape(const std::function<Shape()>& shape_fn) {
+namespace {
+
+ShapeCache* GetShapeCache() {
   static ShapeCache* cache = new ShapeCache(FLAGS_torch_lazy_shape_cache_size);
+  return cache;
+}
+
+} // namespace
 
+// Compute the shape using the provided shape_fn.
+Shape Node::computeShape(const std::function<Shape()>& shape_fn) {
   auto hash = shapeHash();
-  auto shape = cache->Get(hash);
+  auto shape = GetShapeCache()->Get(hash);
   if (shape == nullptr) {
-    shape = cache->Add(hash, std::make_shared<Shape>(shape_fn()));
+    shape = GetShapeCache()->Add(hash, std::make_shared<Shape>(shape_fn()));
   }
   return *shape;
 }
 
+namespace {
+
+constexpr uint32_t kShapeCacheFileMagic = 0x4c545343; // 'LTSC'
+constexpr uint32_t kShapeCacheFileVersion = 1;
+
+template <typename T>
+void WriteRaw(std::ostream& os, const T& value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  os.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool ReadRaw(std::istream& is, T& value) {
+  static_assert(std::is_trivially_copyable_v<T>);
+  is.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return !is.fail();
+}
+
+} // namespace
+
+bool SaveShapeCache(const std::string& path, const std::string& fingerprint) {
+  std::ofstream file(path, std::ios::binary | std::ios::trunc);
+  if (!file) {
+    return false;
+  }
+  WriteRaw(file, kShapeCacheFileMagic);
+  WriteRaw(file, kShapeCacheFileVersion);
+  WriteRaw(file, DataHash(fingerprint.data(), fingerprint.size()));
+  WriteRaw(file, static_cast<uint64_t>(GetShapeCache()->Numel()));
+  GetShapeCache()->ForEach(
+      [&file](const hash_t& hash, const std::shared_ptr<Shape>& shape) {
+        WriteRaw(file, hash);
+        WriteRaw(file, static_cast<int32_t>(shape->scalar_type()));
+        WriteRaw(file, static_cast<uint64_t>(shape->dim()));
+        for (const auto size : shape->sizes()) {
+          WriteRaw(file, size);
+        }
+        const auto& is_symbolic = shape->is_symbolic();
+        WriteRaw(file, static_cast<uint8_t>(is_symbolic.has_value()));
+        if (is_symbolic.has_value()) {
+          for (const bool dim_is_symbolic : *is_symbolic) {
+            WriteRaw(file, static_cast<uint8_t>(dim_is_symbolic));
+          }
+        }
+      });
+  return file.good();
+}
+
+size_t LoadShapeCache(const std::string& path, const std::string& fingerprint) {
+  std::ifstream file(path, std::ios::binary);
+  if (!file) {
+    return 0;
+  }
+  uint32_t magic = 0;
+  uint32_t version = 0;
+  hash_t fingerprint_hash;
+  uint64_t count = 0;
+  if (!ReadRaw(file, magic) || magic != kShapeCacheFileMagic ||
+      !ReadRaw(file, version) || version != kShapeCacheFileVersion ||
+      !ReadRaw(file, fingerprint_hash) ||
+      fingerprint_hash != DataHash(fingerprint.data(), fingerprint.size()) ||
+      !ReadRaw(file, count)) {
+    return 0;
+  }
+  size_t loaded = 0;
+  for (uint64_t i = 0; i < count; ++i) {
+    hash_t hash;
+    int32_t scalar_type = 0;
+    uint64_t ndim = 0;
+    if (!ReadRaw(file, hash) || !ReadRaw(file, scalar_type) ||
+        !ReadRaw(file, ndim)) {
+      break;
+    }
+    std::vector<int64_t> sizes(ndim);
+    bool sizes_ok = true;
+    for (auto& size : sizes) {
+      sizes_ok = sizes_ok && ReadRaw(file, size);
+    }
+    uint8_t has_symbolic = 0;
+    if (!sizes_ok || !ReadRaw(file, has_symbolic)) {
+      break;
+    }
+    std::optional<std::vector<bool>> is_symbolic;
+    if (has_symbolic) {
+      is_symbolic.emplace(ndim);
+      bool symbolic_ok = true;
+      for (const auto dim : c10::irange(ndim)) {
+        uint8_t dim_is_symbolic = 0;
+        symbolic_ok = symbolic_ok && ReadRaw(file, dim_is_symbolic);
+        (*is_symbolic)[dim] = dim_is_symbolic != 0;
+      }
+      if (!symbolic_ok) {
+        break;
+      }
+    }
+    GetShapeCache()->Add(
+        hash,
+        std::make_shared<Shape>(
+            static_cast<c10::ScalarType>(scalar_type),
+            sizes,
+            std::move(is_symbolic)));
+    ++loaded;
+  }
+  return loaded;
+}
+
 const std::vector<Output>& Node::operands() const {
   return operands_as_outputs_;
 }
@@ -281,6 +281,28 @@ struct TORCH_API Value {
   size_t index = 0;
 };
 
+// The shape cache memoizes the results of the shape inference functions (see
+// shape_inference.cpp) keyed by Node::shapeHash(). Since those results only
+// depend on the traced program, they can be persisted to disk to speed up warm
+// restarts. Note that the trie cache of IR nodes (trie.cpp) holds live Node
+// pointers and cannot be persisted; the shape cache is the process-independent
+// part of tracing. The caller-provided fingerprint (e.g., a hash of the model
+// and its configuration) guards against reusing shapes from a different
+// program.
+
+// Saves the current contents of the shape cache to 'path'.
+// Returns false if the file could not be written.
+TORCH_API bool SaveShapeCache(
+    const std::string& path,
+    const std::string& fingerprint);
+
+// Populates the shape cache from a file saved by SaveShapeCache.
+// Returns the number of shapes loaded; zero if the file is missing, malformed,
+// or was saved with a different fingerprint.
+TORCH_API size_t LoadShapeCache(
+    const std::string& path,
+    const std::string& fingerprint);
+
 } // namespace torch::lazy
 
 namespace c10 {
@@ -196,6 +196,16 @@ void initLazyBindings(PyObject* module) {
   lazy.def("_dump_ir_cache", [](const std::string& filename) {
     TrieCache::Get()->DumpToDotFile(filename);
   });
+  lazy.def(
+      "_save_shape_cache",
+      [](const std::string& path, const std::string& fingerprint) {
+        return torch::lazy::SaveShapeCache(path, fingerprint);
+      });
+  lazy.def(
+      "_load_shape_cache",
+      [](const std::string& path, const std::string& fingerprint) {
+        return torch::lazy::LoadShapeCache(path, fingerprint);
+      });
   lazy.def("_set_reuse_ir", [](bool val) { FLAGS_torch_lazy_reuse_ir = val; });
   lazy.def("_set_symbolic_shape_mode", [](bool val) {
     FLAGS_ltc_enable_symbolic_shapes = val;
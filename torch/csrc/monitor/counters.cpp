@@ -61,6 +61,10 @@ void unregisterStat(Stat<int64_t>* stat) {
 
   stats().int64s.erase(stat);
 }
+uint64_t nextStatId() {
+  static std::atomic<uint64_t> id{0};
+  return id.fetch_add(1, std::memory_order_relaxed);
+}
 } // namespace detail
 
 } // namespace torch::monitor
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <atomic>
 #include <bitset>
+#include <memory>
 #include <mutex>
 #include <sstream>
 #include <unordered_map>
@@ -66,6 +68,11 @@ void TORCH_API registerStat(Stat<double>* stat);
 void TORCH_API registerStat(Stat<int64_t>* stat);
 void TORCH_API unregisterStat(Stat<double>* stat);
 void TORCH_API unregisterStat(Stat<int64_t>* stat);
+
+// Returns a process-unique id for a Stat instance. Used to key per-thread
+// shard caches so that a Stat allocated at a recycled address is never
+// confused with its predecessor.
+uint64_t TORCH_API nextStatId();
 } // namespace detail
 
 // Stat is used to compute summary statistics in a performant way over fixed
@@ -87,6 +94,13 @@ void TORCH_API unregisterStat(Stat<int64_t>* stat);
 //
 // When the Stat is destructed it will log any remaining data even if the window
 // hasn't elapsed.
+//
+// Values are accumulated into per-thread shards so that concurrent `add`
+// calls from different threads never contend on a shared mutex; each shard's
+// lock is only ever taken by its owning thread and by the thread that closes
+// a window, when all shards are merged and reset. This keeps `add` cheap
+// enough for high-frequency instrumentation (e.g. per-op latencies) while
+// the logged events are identical to the single-lock implementation.
 template <typename T>
 class Stat {
  private:
@@ -98,6 +112,14 @@ class Stat {
     int64_t count{0};
   };
 
+  // Per-thread accumulation shard. Only the owning thread writes to it, so
+  // the mutex is uncontended on the hot path and exists to synchronize with
+  // the thread that merges shards at a window boundary.
+  struct Shard {
+    std::mutex mu;
+    Values values;
+  };
+
  public:
   Stat(
       std::string name,
@@ -134,34 +156,43 @@ class Stat {
 
   // add adds the value v to the current window.
   void add(T v) {
-    std::lock_guard<std::mutex> guard(mu_);
-    maybeLogLocked();
+    // Close the previous window first if it has elapsed.
+    maybeLog();
 
     if (alreadyLogged()) {
+      // The current window was flushed early after hitting maxSamples;
+      // discard until the next window opens.
       return;
     }
 
     if (aggregations_.test(static_cast<int>(Aggregation::VALUE))) {
-      current_.value = v;
-    }
-    if (aggregations_.test(static_cast<int>(Aggregation::MEAN)) ||
-        aggregations_.test(static_cast<int>(Aggregation::SUM))) {
-      current_.sum += v;
+      lastValue_.store(v, std::memory_order_relaxed);
     }
 
-    if (aggregations_.test(static_cast<int>(Aggregation::MAX))) {
-      if (current_.max < v || current_.count == 0) {
-        current_.max = v;
+    auto& shard = threadShard();
+    {
+      std::lock_guard<std::mutex> guard(shard.mu);
+      auto& values = shard.values;
+      if (aggregations_.test(static_cast<int>(Aggregation::MEAN)) ||
+          aggregations_.test(static_cast<int>(Aggregation::SUM))) {
+        values.sum += v;
       }
-    }
-    if (aggregations_.test(static_cast<int>(Aggregation::MIN))) {
-      if (current_.min > v || current_.count == 0) {
-        current_.min = v;
+      if (aggregations_.test(static_cast<int>(Aggregation::MAX))) {
+        if (values.max < v || values.count == 0) {
+          values.max = v;
+        }
+      }
+      if (aggregations_.test(static_cast<int>(Aggregation::MIN))) {
+        if (values.min > v || values.count == 0) {
+          values.min = v;
+        }
       }
+      values.count += 1;
     }
+    samplesInWindow_.fetch_add(1, std::memory_order_relaxed);
 
-    current_.count += 1;
-    maybeLogLocked();
+    // Flush early if this add filled the window.
+    maybeLog();
   }
 
   const std::string& name() const noexcept {
@@ -170,9 +201,7 @@ class Stat {
 
   // count returns the number of items in the current open window.
   int64_t count() noexcept {
-    std::lock_guard<std::mutex> guard(mu_);
-
-    return current_.count;
+    return samplesInWindow_.load(std::memory_order_relaxed);
   }
 
   std::unordered_map<Aggregation, T, AggregationHash> get() noexcept {
@@ -192,22 +221,74 @@ class Stat {
 
  private:
   bool alreadyLogged() {
-    return lastLoggedWindowId_ == currentWindowId();
+    return lastLoggedWindowId_.load(std::memory_order_acquire) ==
+        currentWindowId();
+  }
+
+  // Returns this thread's shard for this Stat, creating and registering it
+  // on first use. The cache is keyed by a process-unique stat id rather
+  // than `this` so a Stat allocated at a recycled address never picks up a
+  // dead Stat's shard; entries for destructed Stats are retained (they are
+  // small and Stats are typically few and long-lived).
+  Shard& threadShard() {
+    thread_local std::unordered_map<uint64_t, std::shared_ptr<Shard>>
+        shardCache;
+    auto& slot = shardCache[statId_];
+    if (!slot) {
+      slot = std::make_shared<Shard>();
+      std::lock_guard<std::mutex> guard(mu_);
+      shards_.push_back(slot);
+    }
+    return *slot;
   }
 
-  void maybeLogLocked() {
+  void maybeLog() {
     auto windowId = currentWindowId();
-    bool shouldLog = windowId_ != windowId || current_.count >= maxSamples_;
-    if (shouldLog && !alreadyLogged()) {
-      logLocked();
-      lastLoggedWindowId_ = windowId_;
-      windowId_ = windowId;
+    bool shouldLog = windowId_.load(std::memory_order_relaxed) != windowId ||
+        samplesInWindow_.load(std::memory_order_relaxed) >= maxSamples_;
+    if (!shouldLog || alreadyLogged()) {
+      return;
+    }
+    std::lock_guard<std::mutex> guard(mu_);
+    // Re-check under the lock; another thread may have closed the window
+    // while we were waiting.
+    windowId = currentWindowId();
+    shouldLog = windowId_.load(std::memory_order_relaxed) != windowId ||
+        samplesInWindow_.load(std::memory_order_relaxed) >= maxSamples_;
+    if (!shouldLog || alreadyLogged()) {
+      return;
     }
+    logLocked();
+    lastLoggedWindowId_.store(
+        windowId_.load(std::memory_order_relaxed), std::memory_order_release);
+    windowId_.store(windowId, std::memory_order_relaxed);
   }
 
   void logLocked() {
-    prev_ = current_;
-    current_ = Values();
+    // Merge and reset all per-thread shards for the closing window.
+    Values merged;
+    for (auto& shard : shards_) {
+      std::lock_guard<std::mutex> guard(shard->mu);
+      const Values& values = shard->values;
+      if (values.count != 0) {
+        if (merged.count == 0) {
+          merged = values;
+        } else {
+          merged.sum += values.sum;
+          if (merged.max < values.max) {
+            merged.max = values.max;
+          }
+          if (merged.min > values.min) {
+            merged.min = values.min;
+          }
+          merged.count += values.count;
+        }
+      }
+      shard->values = Values();
+    }
+    merged.value = lastValue_.load(std::memory_order_relaxed);
+    samplesInWindow_.store(0, std::memory_order_relaxed);
+    prev_ = merged;
 
     // don't log event if there's no data
     if (prev_.count == 0) {
@@ -264,13 +345,18 @@ class Stat {
 
   const std::string name_;
   const std::bitset<NUM_AGGREGATIONS> aggregations_;
+  const uint64_t statId_ = detail::nextStatId();
 
+  // Guards shards_, prev_ and window transitions; `add` only takes it on
+  // first use from a new thread or when closing a window.
   std::mutex mu_;
-  Values current_;
+  std::vector<std::shared_ptr<Shard>> shards_;
   Values prev_;
 
-  uint64_t windowId_{0};
-  uint64_t lastLoggedWindowId_{0};
+  std::atomic<T> lastValue_{0};
+  std::atomic<int64_t> samplesInWindow_{0};
+  std::atomic<uint64_t> windowId_{0};
+  std::atomic<uint64_t> lastLoggedWindowId_{0};
   const std::chrono::milliseconds windowSize_;
   const int64_t maxSamples_;
 };
@@ -0,0 +1,215 @@
+#include <torch/csrc/monitor/ring_log.h>
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#include <c10/util/Exception.h>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace torch::monitor {
+
+namespace {
+
+int64_t nowNs() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::system_clock::now().time_since_epoch())
+      .count();
+}
+
+size_t ringFileSize(uint64_t capacity) {
+  return kRingLogHeaderSize + capacity * sizeof(ScalarRecord);
+}
+
+} // namespace
+
+#ifndef _WIN32
+
+RingLogFile::RingLogFile(const std::string& path, uint64_t capacity)
+    : capacity_(capacity) {
+  TORCH_CHECK(capacity > 0, "RingLogFile capacity must be positive");
+  mappedSize_ = ringFileSize(capacity);
+
+  int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  TORCH_CHECK(
+      fd >= 0, "RingLogFile: failed to open ", path, ": ", strerror(errno));
+  if (::ftruncate(fd, static_cast<off_t>(mappedSize_)) != 0) {
+    auto err = errno;
+    ::close(fd);
+    TORCH_CHECK(
+        false, "RingLogFile: failed to size ", path, ": ", strerror(err));
+  }
+  mapping_ = ::mmap(
+      nullptr, mappedSize_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  // The mapping keeps its own reference to the file.
+  ::close(fd);
+  TORCH_CHECK(
+      mapping_ != MAP_FAILED,
+      "RingLogFile: failed to mmap ",
+      path,
+      ": ",
+      strerror(errno));
+
+  header_ = static_cast<RingLogFileHeader*>(mapping_);
+  records_ = reinterpret_cast<ScalarRecord*>(
+      static_cast<char*>(mapping_) + kRingLogHeaderSize);
+
+  header_->version = kRingLogVersion;
+  header_->recordSize = sizeof(ScalarRecord);
+  header_->capacity = capacity;
+  header_->cursor.store(0, std::memory_order_relaxed);
+  // Publish the magic last so a reader that sees it can trust the rest of
+  // the header.
+  std::atomic_thread_fence(std::memory_order_release);
+  header_->magic = kRingLogMagic;
+}
+
+RingLogFile::~RingLogFile() {
+  if (mapping_ != nullptr) {
+    ::munmap(mapping_, mappedSize_);
+  }
+}
+
+void RingLogFile::log(const char* name, double value) noexcept {
+  const uint64_t seq =
+      header_->cursor.fetch_add(1, std::memory_order_relaxed) + 1;
+  ScalarRecord& slot = records_[(seq - 1) % capacity_];
+
+  // Invalidate the slot so a concurrent reader never pairs the old sequence
+  // number with the new payload, then publish the new sequence number after
+  // the payload is complete.
+  slot.seq.store(0, std::memory_order_release);
+  slot.timestampNs = nowNs();
+  slot.value = value;
+  std::strncpy(slot.name, name, kScalarRecordNameLen - 1);
+  slot.name[kScalarRecordNameLen - 1] = '\0';
+  slot.seq.store(seq, std::memory_order_release);
+}
+
+uint64_t RingLogFile::written() const noexcept {
+  return header_->cursor.load(std::memory_order_relaxed);
+}
+
+RingLogReader::RingLogReader(const std::string& path) {
+  int fd = ::open(path.c_str(), O_RDONLY);
+  TORCH_CHECK(
+      fd >= 0, "RingLogReader: failed to open ", path, ": ", strerror(errno));
+
+  RingLogFileHeader header;
+  ssize_t n = ::read(fd, &header, sizeof(header));
+  if (n != static_cast<ssize_t>(sizeof(header)) ||
+      header.magic != kRingLogMagic || header.version != kRingLogVersion ||
+      header.recordSize != sizeof(ScalarRecord) || header.capacity == 0) {
+    ::close(fd);
+    TORCH_CHECK(false, "RingLogReader: ", path, " is not a valid ring file");
+  }
+
+  capacity_ = header.capacity;
+  mappedSize_ = ringFileSize(capacity_);
+  mapping_ = ::mmap(nullptr, mappedSize_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  TORCH_CHECK(
+      mapping_ != MAP_FAILED,
+      "RingLogReader: failed to mmap ",
+      path,
+      ": ",
+      strerror(errno));
+
+  header_ = static_cast<const RingLogFileHeader*>(mapping_);
+  records_ = reinterpret_cast<const ScalarRecord*>(
+      static_cast<const char*>(mapping_) + kRingLogHeaderSize);
+}
+
+RingLogReader::~RingLogReader() {
+  if (mapping_ != nullptr) {
+    ::munmap(const_cast<void*>(mapping_), mappedSize_);
+  }
+}
+
+uint64_t RingLogReader::cursor() const noexcept {
+  return header_->cursor.load(std::memory_order_acquire);
+}
+
+bool RingLogReader::read(uint64_t seq, ScalarRecord& out) const noexcept {
+  if (seq == 0) {
+    return false;
+  }
+  const ScalarRecord& slot = records_[(seq - 1) % capacity_];
+
+  // Seqlock-style validation: the copy is consistent only if the sequence
+  // number still matches after the payload was read.
+  if (slot.seq.load(std::memory_order_acquire) != seq) {
+    return false;
+  }
+  out.timestampNs = slot.timestampNs;
+  out.value = slot.value;
+  std::memcpy(out.name, slot.name, kScalarRecordNameLen);
+  std::atomic_thread_fence(std::memory_order_acquire);
+  if (slot.seq.load(std::memory_order_relaxed) != seq) {
+    return false;
+  }
+  out.seq.store(seq, std::memory_order_relaxed);
+  return true;
+}
+
+#else // _WIN32
+
+RingLogFile::RingLogFile(
+    const std::string& path [[maybe_unused]],
+    uint64_t capacity)
+    : capacity_(capacity) {
+  TORCH_CHECK(false, "RingLogFile is not supported on Windows");
+}
+
+RingLogFile::~RingLogFile() = default;
+
+void RingLogFile::log(
+    const char* name [[maybe_unused]],
+    double value [[maybe_unused]]) noexcept {}
+
+uint64_t RingLogFile::written() const noexcept {
+  return 0;
+}
+
+RingLogReader::RingLogReader(const std::string& path [[maybe_unused]]) {
+  TORCH_CHECK(false, "RingLogReader is not supported on Windows");
+}
+
+RingLogReader::~RingLogReader() = default;
+
+uint64_t RingLogReader::cursor() const noexcept {
+  return 0;
+}
+
+bool RingLogReader::read(
+    uint64_t seq [[maybe_unused]],
+    ScalarRecord& out [[maybe_unused]]) const noexcept {
+  return false;
+}
+
+#endif // _WIN32
+
+void RingLogHandler::handle(const Event& e) {
+  for (const auto& kv : e.data) {
+    double value = 0;
+    if (auto* d = std::get_if<double>(&kv.second)) {
+      value = *d;
+    } else if (auto* i = std::get_if<int64_t>(&kv.second)) {
+      value = static_cast<double>(*i);
+    } else if (auto* b = std::get_if<bool>(&kv.second)) {
+      value = *b ? 1.0 : 0.0;
+    } else {
+      // Strings don't fit a fixed-size record.
+      continue;
+    }
+    std::string name = e.name + "." + kv.first;
+    file_->log(name.c_str(), value);
+  }
+}
+
+} // namespace torch::monitor
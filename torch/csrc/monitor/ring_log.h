@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <c10/macros/Macros.h>
+
+#include <torch/csrc/monitor/events.h>
+
+namespace torch::monitor {
+
+// Length of the name field in a ScalarRecord, including the NUL terminator.
+// Longer names are truncated on write.
+constexpr size_t kScalarRecordNameLen = 40;
+
+// ScalarRecord is the fixed-size on-disk record written by RingLogFile. One
+// cache line per record so concurrent writers to adjacent slots never share a
+// line.
+//
+// `seq` doubles as the publication flag: it is zero while the payload is
+// being (re)written and holds the one-based global sequence number of the
+// record once the payload is complete. A reader should load `seq` with
+// acquire ordering, copy the payload, then load `seq` again; the copy is
+// consistent iff both loads returned the same non-zero value.
+struct alignas(64) ScalarRecord {
+  std::atomic<uint64_t> seq{0};
+  // Nanoseconds relative to the Unix epoch, same clock as Event::timestamp.
+  int64_t timestampNs{0};
+  double value{0};
+  // NUL-terminated, truncated scalar name. Ex: loss, lr, grad_norm.
+  char name[kScalarRecordNameLen]{};
+};
+static_assert(sizeof(ScalarRecord) == 64, "ScalarRecord must stay 64 bytes");
+
+// RingLogFileHeader is the first page of the ring file. Records follow at
+// offset kRingLogHeaderSize and slot i lives at cursor position
+// `seq % capacity`. The cursor counts records ever written, so
+// `cursor - capacity` (when positive) is the oldest sequence number that may
+// still be intact.
+struct RingLogFileHeader {
+  uint64_t magic{0};
+  uint32_t version{0};
+  uint32_t recordSize{0};
+  uint64_t capacity{0};
+  std::atomic<uint64_t> cursor{0};
+};
+
+constexpr uint64_t kRingLogMagic = 0x52474c4f47544f4dULL; // "MOTGOLGR"
+constexpr uint32_t kRingLogVersion = 1;
+constexpr size_t kRingLogHeaderSize = 4096;
+
+// RingLogFile is a single-process, multi-thread scalar logging sink backed by
+// an mmap'd ring of fixed-size records. After construction the hot path is a
+// relaxed fetch_add on the cursor plus a 64 byte store into the mapping: no
+// syscalls, no allocation and no locks, so it is safe to call per training
+// step (loss, learning rate, grad norm, ...). A separate reader process tails
+// the file by polling the header cursor and validating record sequence
+// numbers; the writer never blocks on a slow or absent reader, old records
+// are simply overwritten.
+//
+// Not supported on Windows.
+class TORCH_API RingLogFile {
+ public:
+  // Creates (or truncates) the file at `path` sized for `capacity` records
+  // and maps it. Throws on IO errors or if capacity is zero.
+  RingLogFile(const std::string& path, uint64_t capacity);
+  ~RingLogFile();
+
+  RingLogFile(const RingLogFile&) = delete;
+  RingLogFile& operator=(const RingLogFile&) = delete;
+
+  // log appends one record. Thread safe and wait-free; names longer than
+  // kScalarRecordNameLen - 1 bytes are truncated.
+  void log(const char* name, double value) noexcept;
+
+  uint64_t capacity() const noexcept {
+    return capacity_;
+  }
+
+  // written returns the number of records ever logged, i.e. the next
+  // sequence number.
+  uint64_t written() const noexcept;
+
+ private:
+  uint64_t capacity_;
+  size_t mappedSize_{0};
+  void* mapping_{nullptr};
+  RingLogFileHeader* header_{nullptr};
+  ScalarRecord* records_{nullptr};
+};
+
+// RingLogReader maps an existing ring file read-only and reconstructs
+// records by sequence number. It is intended for the tailing process; the
+// typical loop polls cursor() and reads every sequence number it has not
+// seen yet, skipping records that were overwritten before they could be
+// copied.
+class TORCH_API RingLogReader {
+ public:
+  explicit RingLogReader(const std::string& path);
+  ~RingLogReader();
+
+  RingLogReader(const RingLogReader&) = delete;
+  RingLogReader& operator=(const RingLogReader&) = delete;
+
+  uint64_t capacity() const noexcept {
+    return capacity_;
+  }
+
+  // cursor returns the number of records the writer has started; sequence
+  // numbers 1..cursor() have been at least partially written.
+  uint64_t cursor() const noexcept;
+
+  // read copies the record with one-based sequence number `seq` into `out`.
+  // Returns false if the record is not yet published, was overwritten by a
+  // later lap of the ring, or was torn by a concurrent writer.
+  bool read(uint64_t seq, ScalarRecord& out) const noexcept;
+
+ private:
+  uint64_t capacity_{0};
+  size_t mappedSize_{0};
+  void* mapping_{nullptr};
+  const RingLogFileHeader* header_{nullptr};
+  const ScalarRecord* records_{nullptr};
+};
+
+// RingLogHandler bridges the existing event API onto a RingLogFile: every
+// numeric entry of a logged Event is written as one record named
+// "<event name>.<key>". String values are skipped since records are fixed
+// size. Register it like any other handler:
+//
+//   auto handler = std::make_shared<RingLogHandler>(
+//       std::make_shared<RingLogFile>("/tmp/trainer.ring", 1 << 20));
+//   registerEventHandler(handler);
+class TORCH_API RingLogHandler : public EventHandler {
+ public:
+  explicit RingLogHandler(std::shared_ptr<RingLogFile> file)
+      : file_(std::move(file)) {}
+
+  void handle(const Event& e) override;
+
+ private:
+  std::shared_ptr<RingLogFile> file_;
+};
+
+} // namespace torch::monitor
@@ -326,6 +326,15 @@ uint64_t ThreadLocalSubqueue::TorchOpStorage::EventBlock<T, ChunkSize>::
 // ---------------------------------
 std::unique_ptr<KinetoObserverContext> ThreadLocalSubqueue::begin_op(
     const at::RecordFunction& fn) {
+  // Sampling mode: admit only every Nth op event so memory stays bounded on
+  // long captures. USER_SCOPE events (record_function annotations and
+  // ProfilerStep markers) are always admitted to preserve trace structure.
+  // Dropped ops return nullptr; onFunctionExit treats that as a no-op.
+  const auto sample_rate = config_.experimental_config.profiler_sample_rate;
+  if (sample_rate > 1 && fn.scope() != at::RecordScope::USER_SCOPE &&
+      (sample_count_++ % sample_rate) != 0) {
+    return nullptr;
+  }
   auto [event, corr_id] = torch_ops_.op_events_.emplace_back(
       torch::profiler::impl::TorchOpBasicFields{
           fn.seqNr(),
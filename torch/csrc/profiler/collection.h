@@ -560,6 +560,9 @@ class TORCH_API ThreadLocalSubqueue {
   ProfilerConfig config_;
   kineto::DeviceAndResource kineto_info_;
   std::unique_ptr<perf_profiler_t> perf_profiler_;
+  // Number of torch op events seen by this thread, used to pick every Nth
+  // event when `experimental_config.profiler_sample_rate > 1`.
+  int64_t sample_count_{0};
 
   friend class RecordQueue;
   // See `containers.h` for block size benchmarks.
@@ -18,14 +18,16 @@ ExperimentalConfig::ExperimentalConfig(
     std::vector<std::string> performance_events,
     bool enable_cuda_sync_events,
     bool adjust_profiler_step,
-    bool adjust_timestamps)
+    bool adjust_timestamps,
+    int64_t profiler_sample_rate)
     : profiler_metrics{std::move(profiler_metrics)},
       profiler_measure_per_kernel{profiler_measure_per_kernel},
       verbose{verbose},
       performance_events(std::move(performance_events)),
       enable_cuda_sync_events{enable_cuda_sync_events},
       adjust_profiler_step{adjust_profiler_step},
-      adjust_timestamps{adjust_timestamps} {}
+      adjust_timestamps{adjust_timestamps},
+      profiler_sample_rate{profiler_sample_rate} {}
 
 /*explicit*/ ExperimentalConfig::operator bool() const {
   return !profiler_metrics.empty();
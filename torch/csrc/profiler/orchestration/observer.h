@@ -47,7 +47,8 @@ enum class C10_API_ENUM ActiveProfilerType {
   KINETO,
   NVTX,
   ITT,
-  PRIVATEUSE1
+  PRIVATEUSE1,
+  MEMORY_PROVENANCE
 };
 
 struct TORCH_API ExperimentalConfig {
@@ -58,7 +59,8 @@ struct TORCH_API ExperimentalConfig {
       std::vector<std::string> performance_events = {},
       bool enable_cuda_sync_events = false,
       bool adjust_profiler_step = false,
-      bool adjust_timestamps = false);
+      bool adjust_timestamps = false,
+      int64_t profiler_sample_rate = 1);
   explicit operator bool() const;
 
   std::vector<std::string> profiler_metrics;
@@ -93,6 +95,15 @@ struct TORCH_API ExperimentalConfig {
    * information instead of the original information.
    */
   bool adjust_timestamps;
+
+  /*
+   * Record only every Nth torch op event, bounding the profiler's memory
+   * growth on long-running captures. 1 (the default) records everything.
+   * USER_SCOPE events (e.g. record_function annotations and ProfilerStep
+   * markers) are always kept so the trace structure survives. Consumers
+   * aggregating op counts should multiply them by the sample rate.
+   */
+  int64_t profiler_sample_rate;
 };
 
 struct TORCH_API ProfilerConfig {
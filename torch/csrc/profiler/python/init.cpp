@@ -319,7 +319,8 @@ void initPythonBindings(PyObject* module) {
       .value("KINETO", ActiveProfilerType::KINETO)
       .value("NVTX", ActiveProfilerType::NVTX)
       .value("ITT", ActiveProfilerType::ITT)
-      .value("PRIVATEUSE1", ActiveProfilerType::PRIVATEUSE1);
+      .value("PRIVATEUSE1", ActiveProfilerType::PRIVATEUSE1)
+      .value("MEMORY_PROVENANCE", ActiveProfilerType::MEMORY_PROVENANCE);
 
   py::enum_<ActivityType>(m, "ProfilerActivity")
       .value("CPU", ActivityType::CPU)
@@ -336,7 +337,9 @@ void initPythonBindings(PyObject* module) {
               bool /* verbose */,
               std::vector<std::string> /* performance_events  */,
               bool /* enable_cuda_sync_events */,
-              bool /* adjust_profiler_step */
+              bool /* adjust_profiler_step */,
+              bool /* adjust_timestamps */,
+              int64_t /* profiler_sample_rate */
               >(),
           "An experimental config for Kineto features. Please note that"
           "backward compatibility is not guaranteed.\n"
@@ -351,13 +354,18 @@ void initPythonBindings(PyObject* module) {
           "       that expose CUDA device, stream and event synchronization activities. This feature is new\n"
           "       and currently disabled by default.\n"
           "    adjust_profiler_step (bool) : whether to adjust the profiler step to\n"
-          "       match the parent python event duration. This feature is new and currently disabled by default.\n",
+          "       match the parent python event duration. This feature is new and currently disabled by default.\n"
+          "    profiler_sample_rate (int) : record only every Nth torch op event to bound profiler\n"
+          "       memory growth on long captures. 1 (the default) records everything; user-scope\n"
+          "       events are always kept.\n",
           py::arg("profiler_metrics") = std::vector<std::string>(),
           py::arg("profiler_measure_per_kernel") = false,
           py::arg("verbose") = false,
           py::arg("performance_events") = std::vector<std::string>(),
           py::arg("enable_cuda_sync_events") = false,
-          py::arg("adjust_profiler_step") = false)
+          py::arg("adjust_profiler_step") = false,
+          py::arg("adjust_timestamps") = false,
+          py::arg("profiler_sample_rate") = 1)
       .def(py::pickle(
           [](const ExperimentalConfig& p) { // __getstate__
             py::list py_metrics;
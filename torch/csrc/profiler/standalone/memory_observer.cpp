@@ -0,0 +1,173 @@
+#include <torch/csrc/profiler/standalone/memory_observer.h>
+
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace torch::profiler::impl {
+namespace {
+
+struct LiveAllocation {
+  int64_t bytes;
+  std::string stack;
+};
+
+// Maps every live allocation to its creating stack. Allocations can be freed
+// from threads other than the one that made them, so the index is shared and
+// mutex protected; the op stack itself is thread local.
+class ProvenanceIndex {
+ public:
+  static ProvenanceIndex& get() {
+    static ProvenanceIndex index;
+    return index;
+  }
+
+  void onAlloc(void* ptr, int64_t bytes, std::string stack) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    live_[ptr] = LiveAllocation{bytes, std::move(stack)};
+  }
+
+  void onFree(void* ptr) {
+    std::lock_guard<std::mutex> guard(mutex_);
+    live_.erase(ptr);
+  }
+
+  void clear() {
+    std::lock_guard<std::mutex> guard(mutex_);
+    live_.clear();
+  }
+
+  MemoryProvenanceSnapshot snapshot() const {
+    MemoryProvenanceSnapshot out;
+    std::lock_guard<std::mutex> guard(mutex_);
+    for (const auto& [ptr, alloc] : live_) {
+      auto& group = out.groups[alloc.stack];
+      group.bytes += alloc.bytes;
+      ++group.count;
+    }
+    return out;
+  }
+
+ private:
+  mutable std::mutex mutex_;
+  std::unordered_map<void*, LiveAllocation> live_;
+};
+
+thread_local std::vector<std::string> op_stack;
+
+std::string currentStack() {
+  if (op_stack.empty()) {
+    return "<no active op>";
+  }
+  std::string out;
+  for (const auto& frame : op_stack) {
+    if (!out.empty()) {
+      out += ';';
+    }
+    out += frame;
+  }
+  return out;
+}
+
+struct MemoryObserverThreadLocalState : ProfilerStateBase {
+  explicit MemoryObserverThreadLocalState(const ProfilerConfig& config)
+      : ProfilerStateBase(config) {}
+  ~MemoryObserverThreadLocalState() override = default;
+
+  ActiveProfilerType profilerType() override {
+    return ActiveProfilerType::MEMORY_PROVENANCE;
+  }
+
+  void reportMemoryUsage(
+      void* ptr,
+      int64_t alloc_size,
+      size_t /*total_allocated*/,
+      size_t /*total_reserved*/,
+      c10::Device /*device*/) override {
+    if (alloc_size > 0) {
+      ProvenanceIndex::get().onAlloc(ptr, alloc_size, currentStack());
+    } else {
+      ProvenanceIndex::get().onFree(ptr);
+    }
+  }
+
+  static MemoryObserverThreadLocalState* getTLS() {
+    auto tls = ProfilerStateBase::get(/*global=*/false);
+    TORCH_INTERNAL_ASSERT_DEBUG_ONLY(
+        tls == nullptr ||
+        tls->profilerType() == ActiveProfilerType::MEMORY_PROVENANCE);
+    return static_cast<MemoryObserverThreadLocalState*>(tls);
+  }
+};
+
+} // namespace
+
+void enableMemoryProvenanceObserver() {
+  TORCH_CHECK(
+      ProfilerStateBase::get(/*global=*/false) == nullptr,
+      "Cannot enable the memory provenance observer while another profiler "
+      "is active on this thread");
+  ProvenanceIndex::get().clear();
+
+  // profile_memory routes reportMemoryUsageToProfiler calls to this state.
+  c10::ThreadLocalDebugInfo::_push(
+      c10::DebugInfoKind::PROFILER_STATE,
+      std::make_shared<MemoryObserverThreadLocalState>(ProfilerConfig(
+          ProfilerState::CPU,
+          /*report_input_shapes=*/false,
+          /*profile_memory=*/true)));
+
+  auto state_ptr = MemoryObserverThreadLocalState::getTLS();
+  TORCH_INTERNAL_ASSERT(state_ptr, "Expected profiler state set");
+
+  auto handle = at::addThreadLocalCallback(at::RecordFunctionCallback(
+      [](const at::RecordFunction& fn)
+          -> std::unique_ptr<at::ObserverContext> {
+        if (MemoryObserverThreadLocalState::getTLS() != nullptr) {
+          op_stack.emplace_back(fn.name());
+        }
+        return nullptr;
+      },
+      [](const at::RecordFunction&, at::ObserverContext*) {
+        // Async ops may end on a different thread than they started on; in
+        // that case there is nothing to pop here.
+        if (!op_stack.empty()) {
+          op_stack.pop_back();
+        }
+      }));
+  state_ptr->setCallbackHandle(handle);
+}
+
+void disableMemoryProvenanceObserver() {
+  auto state = ProfilerStateBase::pop(/*global=*/false);
+  TORCH_CHECK(
+      state != nullptr &&
+          state->profilerType() == ActiveProfilerType::MEMORY_PROVENANCE,
+      "Memory provenance observer is not running");
+  state->removeCallback();
+  op_stack.clear();
+}
+
+MemoryProvenanceSnapshot memoryProvenanceSnapshot() {
+  return ProvenanceIndex::get().snapshot();
+}
+
+MemoryProvenanceSnapshot diffMemoryProvenanceSnapshots(
+    const MemoryProvenanceSnapshot& before,
+    const MemoryProvenanceSnapshot& after) {
+  MemoryProvenanceSnapshot out;
+  for (const auto& [stack, group] : after.groups) {
+    out.groups[stack] = group;
+  }
+  for (const auto& [stack, group] : before.groups) {
+    auto& delta = out.groups[stack];
+    delta.bytes -= group.bytes;
+    delta.count -= group.count;
+    if (delta.bytes == 0 && delta.count == 0) {
+      out.groups.erase(stack);
+    }
+  }
+  return out;
+}
+
+} // namespace torch::profiler::impl
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+
+#include <torch/csrc/profiler/api.h>
+
+namespace torch::profiler::impl {
+
+// Aggregated view of the allocations that are live when the snapshot is
+// taken, grouped by the RecordFunction stack that created them. Stacks are
+// joined with ";" with the innermost frame last; allocations made outside
+// any observed op fall into the "<no active op>" group.
+struct TORCH_API MemoryProvenanceSnapshot {
+  struct Group {
+    int64_t bytes{0};
+    int64_t count{0};
+  };
+  std::unordered_map<std::string, Group> groups;
+};
+
+// Starts the memory provenance observer: an online index mapping each live
+// allocation to the stack of ops that was active when it was made, built
+// incrementally from allocator and RecordFunction events on the calling
+// thread. Unlike profile_memory with the Kineto profiler, nothing is
+// buffered per event - the index only grows with the number of *live*
+// allocations - so it can stay enabled across thousands of steps. Clears
+// any index left over from a previous session.
+TORCH_API void enableMemoryProvenanceObserver();
+
+// Stops the observer. The index is retained so it can still be snapshotted.
+TORCH_API void disableMemoryProvenanceObserver();
+
+// Aggregates the current index. Cheap enough to call every few steps.
+TORCH_API MemoryProvenanceSnapshot memoryProvenanceSnapshot();
+
+// Per-stack growth from `before` to `after` (bytes and allocation counts in
+// `after` minus those in `before`); groups with no change are dropped.
+// Answers "what grew between step N and step M, grouped by stack" from two
+// snapshots without any trace post-processing.
+TORCH_API MemoryProvenanceSnapshot diffMemoryProvenanceSnapshots(
+    const MemoryProvenanceSnapshot& before,
+    const MemoryProvenanceSnapshot& after);
+
+} // namespace torch::profiler::impl
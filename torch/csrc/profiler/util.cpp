@@ -463,6 +463,7 @@ static constexpr auto kDilation = "dilation";
 static constexpr auto kMatSize = "mat_size";
 static constexpr auto kMat1Size = "mat1_size";
 static constexpr auto kMat2Size = "mat2_size";
+static constexpr auto kElemSize = "elem_size";
 
 static std::vector<c10::IntArrayRef> getInputSizes(
     const std::string& op_name,
@@ -497,9 +498,19 @@ static std::vector<c10::IntArrayRef> getInputSizes(
   return inputSizes;
 }
 
+// Element size (in bytes) of a tensor input whose tensor-ness was already
+// validated by getInputSizes; used for byte-traffic computation.
+static at::IValue getElementSize(
+    c10::ArrayRef<const c10::IValue> inputs,
+    size_t index) {
+  return at::IValue(
+      static_cast<int64_t>(inputs[index].toTensor().element_size()));
+}
+
 std::unordered_map<std::string, c10::IValue> saveExtraArgs(
     const at::RecordFunction& fn) {
-  // for specific types of fn, return the saved extra args for computing flops
+  // for specific types of fn, return the saved extra args for computing
+  // flops and byte traffic
   std::unordered_map<std::string, c10::IValue> map;
   auto inputs = fn.inputs();
   std::string fname(fn.name());
@@ -526,6 +537,7 @@ std::unordered_map<std::string, c10::IValue> saveExtraArgs(
     map[kPadding] = inputs[kConv2dPadding];
     map[kDilation] = inputs[kConv2dDilation];
     map[kGroups] = inputs[kConv2dGroups];
+    map[kElemSize] = getElementSize(inputs, 0);
   } else if (fname == kMMOp) {
     const auto inputSizes = getInputSizes(fname, 2, inputs, {0, 1});
     if (inputSizes.empty()) {
@@ -534,6 +546,7 @@ std::unordered_map<std::string, c10::IValue> saveExtraArgs(
 
     map[kMat1Size] = at::IValue(inputSizes[0]);
     map[kMat2Size] = at::IValue(inputSizes[1]);
+    map[kElemSize] = getElementSize(inputs, 0);
   } else if (fname == kAddMMOp) {
     const auto inputSizes = getInputSizes(fname, 3, inputs, {0, 1, 2});
     if (inputSizes.empty()) {
@@ -545,18 +558,21 @@ std::unordered_map<std::string, c10::IValue> saveExtraArgs(
     // "Operations Count for the BLAS and LAPACK", Table 3, SGEMM)
     map[kMat1Size] = at::IValue(inputSizes[1]);
     map[kMat2Size] = at::IValue(inputSizes[2]);
+    map[kElemSize] = getElementSize(inputs, 1);
   } else if (fname == kMulOp) {
     const auto inputSizes = getInputSizes(fname, 1, inputs, {0});
     if (inputSizes.empty()) {
       return map;
     }
     map[kMatSize] = at::IValue(inputSizes[0]);
+    map[kElemSize] = getElementSize(inputs, 0);
   } else if (fname == kAddOp) {
     const auto inputSizes = getInputSizes(fname, 1, inputs, {0});
     if (inputSizes.empty()) {
       return map;
     }
     map[kMatSize] = at::IValue(inputSizes[0]);
+    map[kElemSize] = getElementSize(inputs, 0);
   } else if (fname == kBMMOp) {
     const auto inputSizes = getInputSizes(fname, 2, inputs, {0, 1});
     if (inputSizes.empty()) {
@@ -565,6 +581,7 @@ std::unordered_map<std::string, c10::IValue> saveExtraArgs(
 
     map[kMat1Size] = at::IValue(inputSizes[0]);
     map[kMat2Size] = at::IValue(inputSizes[1]);
+    map[kElemSize] = getElementSize(inputs, 0);
   } else if (fname == kBAddBMMOp) {
     const auto inputSizes = getInputSizes(fname, 3, inputs, {0, 1, 2});
     if (inputSizes.empty()) {
@@ -577,6 +594,7 @@ std::unordered_map<std::string, c10::IValue> saveExtraArgs(
     // "Operations Count for the BLAS and LAPACK", Table 3, SGEMM)
     map[kMat1Size] = at::IValue(inputSizes[1]);
     map[kMat2Size] = at::IValue(inputSizes[2]);
+    map[kElemSize] = getElementSize(inputs, 1);
   }
 
   return map;
@@ -788,4 +806,113 @@ uint64_t computeFlops(
   return 0;
 }
 
+static uint64_t numelOfSizes(const c10::DimVector& sizes) {
+  uint64_t numel = 1;
+  for (int64_t dim : sizes) {
+    numel *= dim;
+  }
+  return numel;
+}
+
+uint64_t computeBytes(
+    const std::string& op_name,
+    const std::unordered_map<std::string, c10::IValue>& extra_args) {
+  // Counts assume each input tensor is read once and each output tensor is
+  // written once (the roofline convention); cache reuse inside the kernel is
+  // intentionally ignored. Missing or malformed arguments return 0 silently
+  // because computeFlops already warns about the same map.
+  auto elem_size_it = extra_args.find(kElemSize);
+  if (elem_size_it == extra_args.end() || !elem_size_it->second.isInt()) {
+    return 0;
+  }
+  const uint64_t elem_size = elem_size_it->second.toInt();
+
+  if (op_name == kConv2dOp) {
+    if (extra_args.find(kInputSize) == extra_args.end() ||
+        extra_args.find(kWeightSize) == extra_args.end() ||
+        extra_args.find(kPadding) == extra_args.end() ||
+        extra_args.find(kStride) == extra_args.end() ||
+        extra_args.find(kDilation) == extra_args.end()) {
+      return 0;
+    }
+    auto input_sizes_ref = extra_args.at(kInputSize);
+    auto kernel_sizes_ref = extra_args.at(kWeightSize);
+    auto padding_ref = extra_args.at(kPadding);
+    auto stride_ref = extra_args.at(kStride);
+    auto dilation_ref = extra_args.at(kDilation);
+    if (!input_sizes_ref.isIntList() || !kernel_sizes_ref.isIntList() ||
+        !padding_ref.isIntList() || !stride_ref.isIntList() ||
+        !dilation_ref.isIntList()) {
+      return 0;
+    }
+    const auto input_sizes = input_sizes_ref.toDimVector();
+    const auto kernel_sizes = kernel_sizes_ref.toDimVector();
+    const std::vector<int64_t> padding = padding_ref.toIntVector();
+    const std::vector<int64_t> stride = stride_ref.toIntVector();
+    const std::vector<int64_t> dilation = dilation_ref.toIntVector();
+    if (input_sizes.size() != 4 || kernel_sizes.size() != 4 ||
+        padding.size() != 2 || dilation.size() != 2 || stride.size() != 2 ||
+        stride[0] * stride[1] == 0) {
+      return 0;
+    }
+    // Output spatial extent mirrors the computation in computeFlops above.
+    uint64_t output_h = (input_sizes[2] + 2 * padding[0] -
+                         dilation[0] * (kernel_sizes[2] - 1) - 1) /
+            stride[0] +
+        1;
+    uint64_t output_w = (input_sizes[3] + 2 * padding[1] -
+                         dilation[1] * (kernel_sizes[3] - 1) - 1) /
+            stride[1] +
+        1;
+    uint64_t output_numel =
+        input_sizes[0] * kernel_sizes[0] * output_h * output_w;
+    return elem_size *
+        (numelOfSizes(input_sizes) + numelOfSizes(kernel_sizes) +
+         output_numel);
+  } else if (
+      op_name == kMMOp || op_name == kAddMMOp || op_name == kBMMOp ||
+      op_name == kBAddBMMOp) {
+    if (extra_args.find(kMat1Size) == extra_args.end() ||
+        extra_args.find(kMat2Size) == extra_args.end()) {
+      return 0;
+    }
+    auto mat1_sizes_ref = extra_args.at(kMat1Size);
+    auto mat2_sizes_ref = extra_args.at(kMat2Size);
+    if (!mat1_sizes_ref.isIntList() || !mat2_sizes_ref.isIntList()) {
+      return 0;
+    }
+    const auto mat1_size = mat1_sizes_ref.toDimVector();
+    const auto mat2_size = mat2_sizes_ref.toDimVector();
+    if (mat1_size.empty() || mat2_size.empty()) {
+      return 0;
+    }
+    int64_t overlap_dim = mat1_size.back();
+    if (overlap_dim == 0) {
+      return 0;
+    }
+    // The output has mat1's leading (and, for bmm, batch) dimensions with
+    // mat2's trailing dimension substituted for the contraction dimension.
+    uint64_t output_numel =
+        numelOfSizes(mat1_size) / overlap_dim * mat2_size.back();
+    uint64_t bytes = elem_size *
+        (numelOfSizes(mat1_size) + numelOfSizes(mat2_size) + output_numel);
+    if (op_name == kAddMMOp || op_name == kBAddBMMOp) {
+      // The additive input is read once; it has the output's shape.
+      bytes += elem_size * output_numel;
+    }
+    return bytes;
+  } else if (op_name == kMulOp || op_name == kAddOp) {
+    if (extra_args.find(kMatSize) == extra_args.end()) {
+      return 0;
+    }
+    auto mat_sizes = extra_args.at(kMatSize);
+    if (!mat_sizes.isIntList()) {
+      return 0;
+    }
+    // Two inputs read, one output written, all of the broadcast shape.
+    return 3 * elem_size * numelOfSizes(mat_sizes.toDimVector());
+  }
+  return 0;
+}
+
 } // namespace torch::profiler::impl
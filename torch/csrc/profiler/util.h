@@ -105,6 +105,10 @@ uint64_t TORCH_API computeFlops(
     const std::string& op_name,
     const std::unordered_map<std::string, c10::IValue>& extra_args);
 
+uint64_t TORCH_API computeBytes(
+    const std::string& op_name,
+    const std::unordered_map<std::string, c10::IValue>& extra_args);
+
 std::string shapeToStr(const std::vector<int64_t>& shape);
 
 template <typename T>
@@ -0,0 +1,147 @@
+#include <torch/csrc/utils/op_benchmark.h>
+
+#include <ATen/ATen.h>
+#include <c10/util/ApproximateClock.h>
+#include <c10/util/irange.h>
+
+#include <algorithm>
+#include <memory>
+#include <ostream>
+#include <utility>
+
+namespace torch::benchmark {
+namespace {
+
+struct Entry {
+  std::string name;
+  std::function<void()> fn;
+};
+
+std::vector<Entry>& registry() {
+  static std::vector<Entry> entries;
+  return entries;
+}
+
+constexpr int64_t kWarmupIters = 3;
+constexpr int64_t kMaxIters = 10000;
+constexpr int64_t kTargetSampleNs = 100 * 1000 * 1000; // 100ms per benchmark
+
+OpBenchmarkResult runOne(const Entry& entry) {
+  for ([[maybe_unused]] const auto i : c10::irange(kWarmupIters)) {
+    entry.fn();
+  }
+
+  std::vector<int64_t> samples;
+  int64_t total_ns = 0;
+  while (total_ns < kTargetSampleNs &&
+         static_cast<int64_t>(samples.size()) < kMaxIters) {
+    const auto start = c10::getTime();
+    entry.fn();
+    const auto elapsed = c10::getTime() - start;
+    samples.push_back(elapsed);
+    total_ns += elapsed;
+  }
+
+  std::sort(samples.begin(), samples.end());
+  OpBenchmarkResult result;
+  result.name = entry.name;
+  result.num_iters = static_cast<int64_t>(samples.size());
+  result.mean_ns =
+      static_cast<double>(total_ns) / static_cast<double>(samples.size());
+  result.p50_ns = static_cast<double>(samples[samples.size() / 2]);
+  result.p90_ns = static_cast<double>(samples[samples.size() * 9 / 10]);
+  return result;
+}
+
+} // namespace
+
+RegisterOpBenchmark::RegisterOpBenchmark(
+    std::string name,
+    std::function<void()> fn) {
+  registry().push_back(Entry{std::move(name), std::move(fn)});
+}
+
+std::vector<OpBenchmarkResult> runOpBenchmarks() {
+  std::vector<OpBenchmarkResult> results;
+  results.reserve(registry().size());
+  for (const auto& entry : registry()) {
+    results.push_back(runOne(entry));
+  }
+  return results;
+}
+
+void dumpOpBenchmarks(std::ostream& out) {
+  for (const auto& result : runOpBenchmarks()) {
+    out << result.name << " iters=" << result.num_iters
+        << " mean=" << result.mean_ns << "ns p50=" << result.p50_ns
+        << "ns p90=" << result.p90_ns << "ns" << '\n';
+  }
+}
+
+#ifdef TORCH_ENABLE_EMBEDDED_OP_BENCHMARKS
+
+namespace {
+
+// Inputs are created lazily on the first iteration (not at static-init
+// time, when ATen may not be ready) and cached per registration.
+void registerMatmul(int64_t n) {
+  RegisterOpBenchmark(
+      "matmul_" + std::to_string(n) + "x" + std::to_string(n),
+      [n, cache = std::make_shared<std::vector<at::Tensor>>()]() {
+        if (cache->empty()) {
+          cache->push_back(at::randn({n, n}));
+          cache->push_back(at::randn({n, n}));
+        }
+        at::matmul((*cache)[0], (*cache)[1]);
+      });
+}
+
+void registerSoftmax(int64_t rows, int64_t cols) {
+  RegisterOpBenchmark(
+      "softmax_" + std::to_string(rows) + "x" + std::to_string(cols),
+      [rows, cols, cache = std::make_shared<std::vector<at::Tensor>>()]() {
+        if (cache->empty()) {
+          cache->push_back(at::randn({rows, cols}));
+        }
+        at::softmax((*cache)[0], -1);
+      });
+}
+
+void registerConv2d(int64_t channels, int64_t spatial) {
+  RegisterOpBenchmark(
+      "conv2d_" + std::to_string(channels) + "x" + std::to_string(spatial) +
+          "x" + std::to_string(spatial),
+      [channels,
+       spatial,
+       cache = std::make_shared<std::vector<at::Tensor>>()]() {
+        if (cache->empty()) {
+          cache->push_back(at::randn({1, channels, spatial, spatial}));
+          cache->push_back(at::randn({channels, channels, 3, 3}));
+        }
+        at::conv2d(
+            (*cache)[0],
+            (*cache)[1],
+            /*bias=*/{},
+            /*stride=*/1,
+            /*padding=*/1);
+      });
+}
+
+struct RegisterDefaultOpBenchmarks {
+  RegisterDefaultOpBenchmarks() {
+    for (const auto n : {64, 256, 1024}) {
+      registerMatmul(n);
+    }
+    registerSoftmax(32, 1024);
+    registerSoftmax(8, 4096);
+    registerConv2d(64, 56);
+    registerConv2d(128, 28);
+  }
+};
+RegisterDefaultOpBenchmarks register_default_op_benchmarks;
+
+} // namespace
+
+#endif // TORCH_ENABLE_EMBEDDED_OP_BENCHMARKS
+
+} // namespace torch::benchmark
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <c10/macros/Macros.h>
+#include <torch/csrc/Export.h>
+
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+namespace torch::benchmark {
+
+// A tiny in-process operator benchmark runner that ships inside libtorch so
+// per-op CPU timings can be collected on the exact deployed binary and
+// hardware, without a Python environment. Benchmarks register themselves via
+// static initializers (TORCH_REGISTER_OP_BENCHMARK); a single call to
+// dumpOpBenchmarks() runs them all and prints one line per benchmark.
+//
+// The default matmul/conv/softmax registrations are only compiled when the
+// build sets BUILD_EMBEDDED_OP_BENCHMARKS=ON; the registry and runner are
+// always available so deployments can register their own workloads.
+
+struct OpBenchmarkResult {
+  std::string name;
+  int64_t num_iters{0};
+  double mean_ns{0};
+  double p50_ns{0};
+  double p90_ns{0};
+};
+
+// Runs every registered benchmark: a few warmup iterations, then timed
+// iterations until ~100ms of samples (capped at 10k iterations) have been
+// collected per benchmark.
+TORCH_API std::vector<OpBenchmarkResult> runOpBenchmarks();
+
+// Runs all benchmarks and writes "<name> iters=<n> mean=<ns> p50=<ns>
+// p90=<ns>" lines to `out`.
+TORCH_API void dumpOpBenchmarks(std::ostream& out);
+
+// Registration helper; use through TORCH_REGISTER_OP_BENCHMARK.
+struct TORCH_API RegisterOpBenchmark {
+  RegisterOpBenchmark(std::string name, std::function<void()> fn);
+};
+
+#define TORCH_REGISTER_OP_BENCHMARK(name, ...)     \
+  static ::torch::benchmark::RegisterOpBenchmark   \
+      C10_ANONYMOUS_VARIABLE(TorchOpBenchmark)(name, __VA_ARGS__)
+
+} // namespace torch::benchmark
@@ -1290,7 +1290,8 @@ FunctionSignature::FunctionSignature(const std::string& fmt, int index)
       max_pos_args(0),
       index(index),
       hidden(false),
-      deprecated(false) {
+      deprecated(false),
+      allows_varargs_intlist(false) {
   auto open_paren = fmt.find('(');
   if (open_paren == std::string::npos) {
     throw std::runtime_error("missing opening parenthesis: " + fmt);
@@ -1351,6 +1352,13 @@ FunctionSignature::FunctionSignature(const std::string& fmt, int index)
       max_pos_args++;
     }
   }
+
+  // if there is a single positional IntArrayRef argument, i.e. expand(..),
+  // view(...), allow a var-args style IntArrayRef, so expand(5,3) behaves as
+  // expand((5,3))
+  allows_varargs_intlist = max_pos_args == 1 &&
+      (params[0].type_ == ParameterType::INT_LIST ||
+       params[0].type_ == ParameterType::SYM_INT_LIST);
 }
 
 std::string FunctionSignature::toString() const {
@@ -1484,16 +1492,7 @@ bool FunctionSignature::parse(
   Py_ssize_t nargs = args ? PyTuple_GET_SIZE(args) : 0;
   auto remaining_kwargs = kwargs ? PyDict_Size(kwargs) : 0;
   size_t arg_pos = 0;
-  bool allow_varargs_intlist = false;
-
-  // if there is a single positional IntArrayRef argument, i.e. expand(..),
-  // view(...), allow a var-args style IntArrayRef, so expand(5,3) behaves as
-  // expand((5,3))
-  if (max_pos_args == 1 &&
-      (params[0].type_ == ParameterType::INT_LIST ||
-       params[0].type_ == ParameterType::SYM_INT_LIST)) {
-    allow_varargs_intlist = true;
-  }
+  const bool allow_varargs_intlist = allows_varargs_intlist;
 
   if (static_cast<size_t>(nargs) > max_pos_args && !allow_varargs_intlist) {
     if (raise_exception) {
@@ -1503,6 +1502,50 @@ bool FunctionSignature::parse(
     return false;
   }
 
+  // Snapshot the kwargs entries once so that each parameter lookup scans a
+  // few interned name pointers instead of probing the dict once per
+  // parameter. CPython interns keyword names at call sites and
+  // python_name/numpy_python_names are interned at construction, so pointer
+  // identity is exact whenever every key is interned; dicts splatted with
+  // ** can carry uninterned or subclassed string keys, in which case we
+  // keep the PyDict_GetItem path.
+  constexpr Py_ssize_t kMaxFastKwargs = 8;
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+  PyObject* kwarg_keys[kMaxFastKwargs];
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays,modernize-avoid-c-arrays)
+  PyObject* kwarg_values[kMaxFastKwargs];
+  Py_ssize_t num_fast_kwargs = -1;
+  if (kwargs && remaining_kwargs <= kMaxFastKwargs) {
+    num_fast_kwargs = 0;
+    PyObject* key = nullptr;
+    PyObject* value = nullptr;
+    Py_ssize_t pos = 0;
+    // Note that this dict traversal is NoGil safe as the kwargs dict is
+    // only accessible within this thread.
+    while (PyDict_Next(kwargs, &pos, &key, &value)) {
+      if (!PyUnicode_CheckExact(key) || !PyUnicode_CHECK_INTERNED(key)) {
+        num_fast_kwargs = -1;
+        break;
+      }
+      kwarg_keys[num_fast_kwargs] = key;
+      kwarg_values[num_fast_kwargs] = value;
+      num_fast_kwargs++;
+    }
+  }
+  auto lookup_kwarg = [&](PyObject* name) -> PyObject* {
+    if (num_fast_kwargs >= 0) {
+      for (Py_ssize_t j = 0; j < num_fast_kwargs; j++) {
+        if (kwarg_keys[j] == name) {
+          return kwarg_values[j];
+        }
+      }
+      return nullptr;
+    }
+    // Note that this call is NoGil safe as it works on kwargs which are
+    // local to the current function call.
+    return PyDict_GetItem(kwargs, name);
+  };
+
   int i = 0;
   if (self != nullptr && check_has_torch_function(self, /*ignore_mode*/ true)) {
     append_overloaded_tensor(&overloaded_args, self);
@@ -1520,14 +1563,12 @@ bool FunctionSignature::parse(
       }
       obj = PyTuple_GET_ITEM(args, arg_pos);
     } else if (kwargs) {
-      // Note that this call is NoGil safe as it works on kwargs which are local
-      // to the current function call.
-      obj = PyDict_GetItem(kwargs, param.python_name);
+      obj = lookup_kwarg(param.python_name);
       for (PyObject* numpy_name : param.numpy_python_names) {
         if (obj) {
           break;
         }
-        obj = PyDict_GetItem(kwargs, numpy_name);
+        obj = lookup_kwarg(numpy_name);
       }
       is_kwd = true;
     }
@@ -1673,7 +1714,16 @@ PythonArgs PythonArgParser::raw_parse(
         traceable, signature, parsed_args, std::move(overloaded_args));
   }
 
+  const size_t num_args = (args ? PyTuple_GET_SIZE(args) : 0) +
+      (kwargs ? PyDict_Size(kwargs) : 0);
   for (auto& signature : signatures_) {
+    // Cheap rejection on argument count before attempting a full match: a
+    // signature cannot bind fewer arguments than its required count, nor
+    // more than max_args unless it takes a var-args style int list.
+    if (num_args < signature.min_args ||
+        (num_args > signature.max_args && !signature.allows_varargs_intlist)) {
+      continue;
+    }
     std::vector<PyObject*> overloaded_args;
     if (signature.parse(
             self, args, kwargs, parsed_args, overloaded_args, false)) {
@@ -205,6 +205,11 @@ struct FunctionSignature {
   int index;
   bool hidden;
   bool deprecated;
+  // True for signatures whose single positional parameter is an
+  // IntArrayRef/SymIntArrayRef, which also accept var-args style calls
+  // like expand(5, 3); such signatures can bind more positional
+  // arguments than max_args.
+  bool allows_varargs_intlist;
 };
 
 // PythonArgs contains bound Python arguments for an actual invocation
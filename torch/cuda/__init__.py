@@ -33,6 +33,7 @@ from .graphs import (
     graph_pool_handle,
     is_current_stream_capturing,
     make_graphed_callables,
+    segmented_graph,
 )
 from .streams import Event, ExternalStream, Stream
 
@@ -1668,6 +1669,7 @@ __all__ = [
     "reset_peak_memory_stats",
     "seed",
     "seed_all",
+    "segmented_graph",
     "set_device",
     "set_per_process_memory_fraction",
     "set_rng_state",
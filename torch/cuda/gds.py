@@ -1,6 +1,6 @@
 import os
 import sys
-from typing import Callable, List, Optional
+from typing import Any, Callable, List, Optional
 
 import torch
 from torch.types import Storage
@@ -127,3 +127,139 @@ class _GdsFile:
             self.handle is not None
         ), "Cannot save data to a file that is not registered."
         torch._C._gds_save_storage(self.handle, storage, offset)
+
+
+class _GdsRecordReader:
+    r"""Reads tensor records of a PyTorch zip archive directly into CUDA storages.
+
+    Records written by ``torch.save`` or :class:`torch._C.PyTorchFileWriter`
+    are stored uncompressed, so each one can be read at its raw file offset
+    (obtained from :class:`torch._C.PyTorchFileReader`). When cuFile
+    (GPUDirect Storage) is available the bytes move disk -> GPU without
+    touching host memory; otherwise reads fall back to a double-buffered
+    pinned-memory ring that overlaps file reads with host-to-device copies,
+    so they never bounce through pageable RAM.
+
+    Args:
+        filename (str): Path to the archive.
+        device (torch.device or int, optional): CUDA device to load storages
+            onto. (Default: the current CUDA device)
+        buffer_size (int, optional): Size in bytes of each pinned bounce
+            buffer used by the fallback path. (Default: 16 MiB)
+    """
+
+    def __init__(
+        self,
+        filename: str,
+        device: Optional[Any] = None,
+        buffer_size: int = 16 * 1024 * 1024,
+    ):
+        self.filename = filename
+        if device is None:
+            device = torch.cuda.current_device()
+        self.device = (
+            torch.device("cuda", device)
+            if isinstance(device, int)
+            else torch.device(device)
+        )
+        self.reader = torch._C.PyTorchFileReader(filename)
+        self.buffer_size = buffer_size
+        self._gds_file: Optional[_GdsFile] = None
+        try:
+            self._gds_file = _GdsFile(filename, os.O_RDONLY)
+        except (RuntimeError, OSError):
+            # No cuFile support, or O_DIRECT is unsupported on this
+            # filesystem; reads go through the pinned bounce-buffer ring.
+            self._gds_file = None
+        self._copy_stream: Optional[torch.cuda.Stream] = None
+        self._pinned: List[torch.Tensor] = []
+        self._pinned_views: List[Any] = []
+        self._events: List[torch.cuda.Event] = []
+
+    def records(self) -> List[str]:
+        """Returns the names of all records in the archive."""
+        return self.reader.get_all_records()
+
+    def load_record(
+        self, name: str, storage: Optional[Storage] = None
+    ) -> Storage:
+        """Loads one record into a CUDA storage.
+
+        Args:
+            name (str): Name of the record (e.g. ``"archive/data/0"``).
+            storage (Storage, optional): CUDA storage to load into; must
+                match the record size. A new storage on ``self.device`` is
+                allocated when omitted.
+        """
+        nbytes = self.reader.get_record_size(name)
+        offset = self.reader.get_record_offset(name)
+        if storage is None:
+            storage = torch.empty(
+                nbytes, dtype=torch.uint8, device=self.device
+            ).untyped_storage()
+        else:
+            assert (
+                storage.nbytes() == nbytes
+            ), f"storage holds {storage.nbytes()} bytes but record {name} has {nbytes}"
+        if nbytes == 0:
+            return storage
+        if self._gds_file is not None:
+            self._gds_file.load_storage(storage, offset)
+        else:
+            self._load_via_pinned_ring(storage, offset, nbytes)
+        return storage
+
+    def _ensure_ring(self) -> None:
+        if self._copy_stream is not None:
+            return
+        self._copy_stream = torch.cuda.Stream(self.device)
+        self._pinned = [
+            torch.empty(self.buffer_size, dtype=torch.uint8, pin_memory=True)
+            for _ in range(2)
+        ]
+        try:
+            # numpy views expose the buffer protocol for readinto; without
+            # numpy, each chunk takes one extra host copy below
+            self._pinned_views = [buf.numpy() for buf in self._pinned]
+        except (RuntimeError, ModuleNotFoundError):
+            self._pinned_views = []
+        self._events = [torch.cuda.Event() for _ in range(2)]
+
+    def _load_via_pinned_ring(
+        self, storage: Storage, offset: int, nbytes: int
+    ) -> None:
+        self._ensure_ring()
+        assert self._copy_stream is not None
+        dst = torch.empty(0, dtype=torch.uint8, device=self.device).set_(storage)
+        stream = self._copy_stream
+        stream.wait_stream(torch.cuda.current_stream(self.device))
+        with open(self.filename, "rb") as f:
+            f.seek(offset)
+            pos = 0
+            i = 0
+            while pos < nbytes:
+                chunk = min(self.buffer_size, nbytes - pos)
+                # the device copy out of this buffer from two chunks ago
+                # must finish before the buffer is refilled from the file
+                self._events[i].synchronize()
+                if self._pinned_views:
+                    n = f.readinto(memoryview(self._pinned_views[i])[:chunk])
+                else:
+                    data = f.read(chunk)
+                    n = len(data)
+                    self._pinned[i][:n] = torch.frombuffer(
+                        bytearray(data), dtype=torch.uint8
+                    )
+                if n != chunk:
+                    raise RuntimeError(
+                        f"unexpected end of file reading {chunk} bytes at "
+                        f"offset {offset + pos} of {self.filename}"
+                    )
+                with torch.cuda.stream(stream):
+                    dst[pos : pos + chunk].copy_(
+                        self._pinned[i][:chunk], non_blocking=True
+                    )
+                self._events[i].record(stream)
+                pos += chunk
+                i ^= 1
+        torch.cuda.current_stream(self.device).wait_stream(stream)
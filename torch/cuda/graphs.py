@@ -188,6 +188,96 @@ class graph:
         # returning None should propagate exceptions from either capture_end or stream_ctx.__exit__()
 
 
+class segmented_graph:
+    r"""Captures the static portions of a workload as separate CUDA graphs sharing one memory pool.
+
+    Whole-region capture fails if any op in the region is incompatible with
+    capture, for example :func:`torch.nonzero`, whose output shape is data
+    dependent. ``segmented_graph`` works around a single such op (or several)
+    by capturing the static prefix and suffix as individual graphs around the
+    dynamic "island": segments captured through :meth:`capture_segment` share
+    this instance's memory pool, islands registered with :meth:`run_eager`
+    execute eagerly, and :meth:`replay` re-runs the whole sequence in order,
+    replaying the graphs with the islands executed eagerly in between.
+
+    Because islands run eagerly on every replay, tensors they return have
+    fresh addresses each time. A captured segment that consumes an island's
+    result must read it through a static buffer the island writes into, the
+    same input-copying idiom used for graphed callables' inputs.
+
+    Arguments:
+        pool (optional): Opaque token (returned by a call to :func:`~torch.cuda.graph_pool_handle()` or
+            :meth:`other_Graph_instance.pool()<torch.cuda.CUDAGraph.pool>`) hinting that all segments'
+            captures may share memory from the specified pool. If not supplied, a fresh pool is created
+            and shared by the segments. See :ref:`Graph memory management<graph-memory-management>`.
+        stream (torch.cuda.Stream, optional): If supplied, will be set as the current stream during
+            each capture. If not supplied, each capture uses :class:`~torch.cuda.graph`'s internal
+            side stream.
+        capture_error_mode (str, optional): specifies the cudaStreamCaptureMode used for each
+            segment's capture. See :class:`~torch.cuda.graph`.
+
+    .. warning::
+        This API is in beta and may change in future releases.
+
+    Example::
+
+        >>> # xdoctest: +SKIP
+        >>> seg = torch.cuda.segmented_graph()
+        >>> with seg.capture_segment():
+        ...     static_y = static_a @ static_b
+        >>> def island():
+        ...     # data-dependent op that cannot be captured; writes its
+        ...     # result into a static, max-sized buffer
+        ...     count_buf.zero_()
+        ...     count_buf[0] = torch.count_nonzero(static_y)
+        >>> seg.run_eager(island)
+        >>> with seg.capture_segment():
+        ...     static_z = static_y * count_buf[0]
+        >>> seg.replay()
+    """
+
+    def __init__(self, pool=None, stream=None, capture_error_mode: str = "global"):
+        self._pool = pool if pool is not None else graph_pool_handle()
+        self._stream = stream
+        self._capture_error_mode = capture_error_mode
+        self._sequence: typing.List[tuple] = []
+
+    def capture_segment(self):
+        r"""Return a context manager that captures one static segment into this instance's shared pool.
+
+        Segments replay in the order they were captured.
+        """
+        cuda_graph = CUDAGraph()
+        self._sequence.append(("graph", cuda_graph))
+        return graph(
+            cuda_graph,
+            pool=self._pool,
+            stream=self._stream,
+            capture_error_mode=self._capture_error_mode,
+        )
+
+    def run_eager(self, func, *args, **kwargs):
+        r"""Run ``func(*args, **kwargs)`` eagerly now and at the same position in every :meth:`replay`.
+
+        Returns the result of this first call.
+        """
+        self._sequence.append(("eager", func, args, kwargs))
+        return func(*args, **kwargs)
+
+    def replay(self):
+        r"""Replay the captured segments in order, executing the registered eager islands in between."""
+        for item in self._sequence:
+            if item[0] == "graph":
+                item[1].replay()
+            else:
+                _, func, args, kwargs = item
+                func(*args, **kwargs)
+
+    def pool(self):
+        r"""Return the opaque token for the memory pool shared by this instance's segments."""
+        return self._pool
+
+
 def make_graphed_callables(
     callables, sample_args, num_warmup_iters=3, allow_unused_input=False, pool=None
 ):
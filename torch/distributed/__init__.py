@@ -119,6 +119,9 @@ if is_available():
     if sys.platform != "win32":
         from torch._C._distributed_c10d import HashStore
 
+    if sys.platform == "linux":
+        from torch._C._distributed_c10d import _ShmStore
+
     from .device_mesh import DeviceMesh, init_device_mesh
 
     # Variables prefixed with underscore are not auto imported
@@ -7,6 +7,7 @@ from dataclasses import dataclass, field
 from typing import Any, Dict, List, Set, Tuple, Union
 
 import torch
+from torch._C import _fx_find_matching_nodes
 from torch.fx import Graph, Node
 from torch.fx._compatibility import compatibility
 
@@ -351,12 +352,23 @@ class SubgraphMatcher:
         """
         from torch.fx.passes.utils.fuser_utils import validate_partition
 
-        # find candidate nodes to match with pattern anchors
+        # Find candidate nodes to match with pattern anchors. This scan is the
+        # only part of matching that is linear in the target graph size, so
+        # anchors compared purely by (op, target) equality are scanned over the
+        # C++ node list; anchors with wildcard or attribute-matching semantics
+        # (placeholder, output, get_attr) fall back to the Python comparison.
         match_candidates: Dict[Node, List[Node]] = defaultdict(list)
         for pattern_anchor in self.pattern_anchors:
-            for node in graph.nodes:
-                if self._nodes_are_equal(pattern_anchor, node):
-                    match_candidates[pattern_anchor].append(node)
+            if pattern_anchor.op in ("call_function", "call_method", "call_module"):
+                candidates = _fx_find_matching_nodes(
+                    graph._root, pattern_anchor.op, pattern_anchor.target
+                )
+            else:
+                candidates = [
+                    n for n in graph.nodes if self._nodes_are_equal(pattern_anchor, n)
+                ]
+            if candidates:
+                match_candidates[pattern_anchor] = candidates
         match_candidates_list = list(match_candidates.items())
 
         logger.info("Initial match_candidates_list: %s\n", match_candidates_list)
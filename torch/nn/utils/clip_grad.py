@@ -83,7 +83,9 @@ def clip_grad_norm_(
         if (foreach is None and _has_foreach_support(device_grads, device)) or (
             foreach and _device_has_foreach_support(device)
         ):
-            norms.extend(torch._foreach_norm(device_grads, norm_type))
+            # Fused reduction over every gradient buffer in the group; one
+            # scalar comes back instead of one norm per tensor.
+            norms.append(torch._foreach_global_norm(device_grads, norm_type))
         elif foreach:
             raise RuntimeError(
                 f"foreach=True was passed, but can't use the foreach API on {device.type} tensors"
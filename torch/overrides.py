@@ -1467,6 +1467,7 @@ def get_testing_overrides() -> Dict[Callable, Callable]:
         Tensor.rename: lambda self, name: -1,
         Tensor.repeat: lambda self, *size: -1,
         Tensor.requires_grad_: lambda self, requires_grad=True: -1,
+        Tensor.reserve_: lambda self, numel: -1,
         Tensor.reshape_as: lambda self, other: -1,
         Tensor.resize: lambda self, *size: -1,
         Tensor.resize_: lambda self, size: -1,
@@ -38,7 +38,7 @@ def _pin_memory_loop(in_queue, out_queue, device_id, done_event, device):
         idx, data = r
         if not done_event.is_set() and not isinstance(data, ExceptionWrapper):
             try:
-                data = pin_memory(data, device)
+                data = pin_memory_batch(data, device)
             except Exception:
                 data = ExceptionWrapper(
                     where=f"in pin memory thread for device {device_id}"
@@ -60,9 +60,70 @@ def _pin_memory_loop(in_queue, out_queue, device_id, done_event, device):
 
 
 def pin_memory(data, device=None):
+    return _map_batch_leaves(data, lambda sample: _pin_memory_leaf(sample, device))
+
+
+def pin_memory_batch(data, device=None):
+    r"""Pin every dense CPU tensor in a (possibly nested) batch in one call.
+
+    All eligible tensors are handed to ``torch._pin_memory_batch``, which lays
+    them out in a single pinned slab, so the whole batch costs one pinned
+    allocation instead of one per tensor. Anything the batched op cannot
+    handle (sparse or already-pinned tensors, custom objects with a
+    ``pin_memory`` method) goes through the per-tensor path instead.
+    """
+    tensors = []
+
+    def collect(sample):
+        if _is_batch_pinnable(sample):
+            tensors.append(sample)
+
+    _for_each_batch_leaf(data, collect)
+    if len(tensors) <= 1:
+        return pin_memory(data, device)
+    pinned = iter(torch._pin_memory_batch(tensors, device))
+
+    def substitute(sample):
+        if _is_batch_pinnable(sample):
+            return next(pinned)
+        return _pin_memory_leaf(sample, device)
+
+    return _map_batch_leaves(data, substitute)
+
+
+def _is_batch_pinnable(sample):
+    return (
+        isinstance(sample, torch.Tensor)
+        and sample.device.type == "cpu"
+        and sample.layout == torch.strided
+        and not sample.is_pinned()
+    )
+
+
+def _pin_memory_leaf(data, device):
     if isinstance(data, torch.Tensor):
         return data.pin_memory(device)
-    elif isinstance(data, (str, bytes)):
+    elif hasattr(data, "pin_memory"):
+        return data.pin_memory()
+    else:
+        return data
+
+
+def _for_each_batch_leaf(data, fn):
+    if isinstance(data, (str, bytes)):
+        return
+    elif isinstance(data, collections.abc.Mapping):
+        for sample in data.values():
+            _for_each_batch_leaf(sample, fn)
+    elif isinstance(data, collections.abc.Sequence):
+        for sample in data:
+            _for_each_batch_leaf(sample, fn)
+    else:
+        fn(data)
+
+
+def _map_batch_leaves(data, fn):
+    if isinstance(data, (str, bytes)):
         return data
     elif isinstance(data, collections.abc.Mapping):
         try:
@@ -72,20 +133,20 @@ def pin_memory(data, device=None):
                 # Create a clone and update it if the sequence type is mutable.
                 clone = copy.copy(data)
                 clone.update(
-                    {k: pin_memory(sample, device) for k, sample in data.items()}
+                    {k: _map_batch_leaves(sample, fn) for k, sample in data.items()}
                 )
                 return clone
             else:
-                return type(data)({k: pin_memory(sample, device) for k, sample in data.items()})  # type: ignore[call-arg]
+                return type(data)({k: _map_batch_leaves(sample, fn) for k, sample in data.items()})  # type: ignore[call-arg]
         except TypeError:
             # The mapping type may not support `copy()` / `update(mapping)`
             # or `__init__(iterable)`.
-            return {k: pin_memory(sample, device) for k, sample in data.items()}
+            return {k: _map_batch_leaves(sample, fn) for k, sample in data.items()}
     elif isinstance(data, tuple) and hasattr(data, "_fields"):  # namedtuple
-        return type(data)(*(pin_memory(sample, device) for sample in data))
+        return type(data)(*(_map_batch_leaves(sample, fn) for sample in data))
     elif isinstance(data, tuple):
         return [
-            pin_memory(sample, device) for sample in data
+            _map_batch_leaves(sample, fn) for sample in data
         ]  # Backwards compatibility.
     elif isinstance(data, collections.abc.Sequence):
         try:
@@ -95,14 +156,12 @@ def pin_memory(data, device=None):
                 # Create a clone and update it if the sequence type is mutable.
                 clone = copy.copy(data)  # type: ignore[arg-type]
                 for i, item in enumerate(data):
-                    clone[i] = pin_memory(item, device)
+                    clone[i] = _map_batch_leaves(item, fn)
                 return clone
-            return type(data)([pin_memory(sample, device) for sample in data])  # type: ignore[call-arg]
+            return type(data)([_map_batch_leaves(sample, fn) for sample in data])  # type: ignore[call-arg]
         except TypeError:
             # The sequence type may not support `copy()` / `__setitem__(index, item)`
             # or `__init__(iterable)` (e.g., `range`).
-            return [pin_memory(sample, device) for sample in data]
-    elif hasattr(data, "pin_memory"):
-        return data.pin_memory()
+            return [_map_batch_leaves(sample, fn) for sample in data]
     else:
-        return data
+        return fn(data)
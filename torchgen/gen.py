@@ -565,6 +565,9 @@ class RegisterSchema:
 class ComputeOperators:
     target: Literal[Target.DECLARATION, Target.DEFINITION]
     static_dispatch_backend_indices: list[BackendIndex]
+    # If set, operators that are not selected get error stubs instead of
+    # dispatcher entry points (see --stub-unselected-operators).
+    selector: SelectiveBuilder | None = None
 
     @method_with_native_function
     def __call__(self, f: NativeFunction) -> str:
@@ -612,7 +615,26 @@ struct TORCH_API {name} {{
 STATIC_CONST_STR_OUT_OF_LINE_FOR_WIN_CUDA({name}, name, "aten::{f.func.name.name}")
 STATIC_CONST_STR_OUT_OF_LINE_FOR_WIN_CUDA({name}, overload_name, "{f.func.name.overload_name}")
 STATIC_CONST_STR_OUT_OF_LINE_FOR_WIN_CUDA({name}, schema_str, {cpp_string(str(f.func))})
+"""
+            if self.selector is not None and not self.selector.is_native_function_selected(
+                f
+            ):
+                # The operator is outside this build's allowlist. Keep the
+                # schema strings (the declarations in Operators.h reference
+                # them) but replace both entry points with error stubs; with
+                # nothing referencing the typed handle or the static dispatch
+                # functions, the linker can strip the unused kernel bodies.
+                for is_redispatching_fn in [False, True]:
+                    method_name = f"{name}::{'redispatch' if is_redispatching_fn else 'call'}"
+                    defns += f"""
+// aten::{f.func}
+{sig.defn(name=method_name, is_redispatching_fn=is_redispatching_fn)} {{
+    TORCH_CHECK(false, "{name} was excluded from this build by the operator allowlist");
+}}
+"""
+                return defns
 
+            defns += f"""
 // aten::{f.func}
 static C10_NOINLINE c10::TypedOperatorHandle<{name}::schema> create_{name}_typed_handle() {{
   return c10::Dispatcher::singleton()
@@ -2184,6 +2206,7 @@ def gen_source_files(
     force_schema_registration: bool,
     per_operator_headers: bool,
     skip_dispatcher_op_registration: bool,
+    stub_unselected_operators: bool,
     update_aoti_c_shim: bool,
 ) -> None:
     extra_cuda_headers = """\
@@ -2493,6 +2516,7 @@ codegen to generate the correct cpp call for this op. Contact AOTInductor team f
                 ComputeOperators(
                     Target.DEFINITION,
                     static_dispatch_backend_indices=static_dispatch_idx,
+                    selector=selector if stub_unselected_operators else None,
                 )(fn)
             ],
         },
@@ -2795,6 +2819,17 @@ def main() -> None:
         action="store_true",
         help="Avoid registering operators into the dispatcher.",
     )
+    parser.add_argument(
+        "--stub-unselected-operators",
+        "--stub_unselected_operators",
+        action="store_true",
+        help="With static dispatch, generate error stubs instead of "
+        "dispatcher entry points for operators that are not covered by "
+        "the operator selection, so that their kernel bodies can be "
+        "stripped from the binary. Requires --static-dispatch-backend "
+        "and an operator selection (--op-registration-whitelist or "
+        "--op-selection-yaml-path).",
+    )
     parser.add_argument(
         "--force-schema-registration",
         "--force_schema_registration",
@@ -2914,6 +2949,19 @@ def main() -> None:
             if dp_key not in functions_keys:
                 functions_keys.add(dp_key)
 
+    if options.stub_unselected_operators:
+        assert options.static_dispatch_backend, (
+            "--stub-unselected-operators only makes sense together with "
+            "--static-dispatch-backend; without static dispatch every "
+            "operator goes through the dispatcher and none can be stubbed."
+        )
+        assert not selector.include_all_operators, (
+            "--stub-unselected-operators requires an operator selection "
+            "(--op-registration-whitelist or --op-selection-yaml-path); "
+            "with no selection every operator is selected and the flag "
+            "has no effect."
+        )
+
     if "sources" in options.generate:
         gen_source_files(
             native_functions=native_functions,
@@ -2934,6 +2982,7 @@ def main() -> None:
             force_schema_registration=options.force_schema_registration,
             per_operator_headers=options.per_operator_headers,
             skip_dispatcher_op_registration=options.skip_dispatcher_op_registration,
+            stub_unselected_operators=options.stub_unselected_operators,
             update_aoti_c_shim=options.update_aoti_c_shim,
         )
 